@@ -34,6 +34,8 @@
 #include "rel_exp.h"
 #include "rel_rel.h"
 #include "rel_updates.h"
+#include "mal_interpreter.h"
+#include "mal_dataflow.h"
 
 #include "mtime.h"
 #include "blob.h"
@@ -54,9 +56,17 @@ MT_Lock embedded_lock MT_LOCK_INITIALIZER("embedded_lock");
 static void monetdb_destroy_column(monetdb_column* column);
 
 typedef struct {
+	monetdb_column_view view;
+	bat bid;
+} monetdb_column_view_internal;
+
+typedef struct monetdb_result_internal {
 	monetdb_result res;
 	res_table *monetdb_resultset;
 	monetdb_column **converted_columns;
+	monetdb_column_view_internal **column_views;
+	struct monetdb_result_internal *chunk;
+	size_t chunk_offset;
 } monetdb_result_internal;
 
 monetdb_connection monetdb_connect(void) {
@@ -93,8 +103,6 @@ void monetdb_disconnect(monetdb_connection conn) {
 #define NULLFILE "/dev/null"
 #endif
 
-#define EMBEDDED_SCRIPT_SIZE_MAX 10485760 // 10 MB
-
 char* monetdb_startup(char* dbdir, char silent, char sequential) {
 	str retval = MAL_SUCCEED;
 	char* sqres = NULL;
@@ -113,21 +121,25 @@ char* monetdb_startup(char* dbdir, char silent, char sequential) {
 
 	if (monetdb_embedded_initialized) goto cleanup;
 
-	// decompress scripts
+	// decompress scripts, their sizes are known when they are inlined so
+	// the buffers only need room for the terminating zero
 	if (!mal_init_inline) {
-		mz_ulong decompress_len_mal = EMBEDDED_SCRIPT_SIZE_MAX;
-		mz_ulong decompress_len_sql = EMBEDDED_SCRIPT_SIZE_MAX;
-		mal_init_inline = GDKzalloc(decompress_len_mal);
-		createdb_inline = GDKzalloc(decompress_len_sql);
+		mz_ulong decompress_len_mal = mal_init_inline_len;
+		mz_ulong decompress_len_sql = createdb_inline_len;
+		mal_init_inline = GDKmalloc(decompress_len_mal + 1);
+		createdb_inline = GDKmalloc(decompress_len_sql + 1);
 		if (!mal_init_inline || !createdb_inline) {
 			retval = GDKstrdup("Memory allocation failed");
 			goto cleanup;
 		}
 		if (mz_uncompress(mal_init_inline, &decompress_len_mal, mal_init_inline_arr, sizeof(mal_init_inline_arr)) != 0 ||
-			mz_uncompress(createdb_inline, &decompress_len_sql, createdb_inline_arr, sizeof(createdb_inline_arr)) != 0) {
+			mz_uncompress(createdb_inline, &decompress_len_sql, createdb_inline_arr, sizeof(createdb_inline_arr)) != 0 ||
+			decompress_len_mal != mal_init_inline_len || decompress_len_sql != createdb_inline_len) {
 			retval = GDKstrdup("Script decompression failed");
 			goto cleanup;
 		}
+		mal_init_inline[decompress_len_mal] = 0;
+		createdb_inline[decompress_len_sql] = 0;
 	}
 
 	embedded_stdout = fopen(NULLFILE, "w");
@@ -189,6 +201,59 @@ int monetdb_is_initialized(void) {
 }
 
 
+/* move the result set of the last statement out of the mvc and into the embedded result */
+static char* monetdb_result_take(mvc *m, monetdb_result_internal *res_internal) {
+	res_internal->res.ncols = m->results->nr_cols;
+	if (m->results->nr_cols > 0 && m->results->order) {
+		res_internal->res.nrows = BATcount(BATdescriptor(m->results->order));
+		BBPunfix(m->results->order);
+	}
+	res_internal->monetdb_resultset = m->results;
+	res_internal->converted_columns = GDKzalloc(sizeof(monetdb_column*) * res_internal->res.ncols);
+	res_internal->res.type = (char) m->results->query_type;
+	res_internal->res.id = (size_t) m->results->query_id;
+	m->results = NULL;
+	if (!res_internal->converted_columns) {
+		return GDKstrdup("Malloc fail");
+	}
+	return MAL_SUCCEED;
+}
+
+/* arm the interrupt record of the connection for the query about to run, kernel operations
+ * only see it on registered threads so the calling thread is registered for the duration */
+static Thread monetdb_query_begin(Client c, int *registered) {
+	Thread thr = THRself();
+
+	c->qinterrupt.stop = 0;
+	c->qinterrupt.deadline = c->qtimeout ? GDKusec() + c->qtimeout : 0;
+	c->qinterrupt.maxmem = c->qmaxmem;
+	c->qinterrupt.memclaim = 0;
+	c->qstart = GDKusec();
+	*registered = 0;
+	if (!thr) {
+		thr = THRnew("monetdb_query");
+		if (!thr) {
+			return NULL;
+		}
+		GDKsetbuf(GDKzalloc(GDKMAXERRLEN));
+		*registered = 1;
+	}
+	THRset_interrupt(thr, &c->qinterrupt);
+	return thr;
+}
+
+static void monetdb_query_end(Thread thr, int registered) {
+	if (!thr) {
+		return;
+	}
+	THRset_interrupt(thr, NULL);
+	if (registered) {
+		GDKfree(GDKerrbuf);
+		GDKsetbuf(0);
+		THRdel(thr);
+	}
+}
+
 static char* monetdb_query_internal(monetdb_connection conn, char* query, char execute, monetdb_result** result, long* affected_rows, long* prepare_id, char language) {
 	str res = MAL_SUCCEED;
 	int sres;
@@ -201,6 +266,8 @@ static char* monetdb_query_internal(monetdb_connection conn, char* query, char e
 	buffer query_buf;
 	stream *query_stream;
 	monetdb_result_internal *res_internal = NULL;
+	Thread thr = NULL;
+	int registered = 0;
 
 	// TODO what about execute flag?! remove when result set is there for prepared stmts
 	(void) execute;
@@ -256,6 +323,7 @@ static char* monetdb_query_internal(monetdb_connection conn, char* query, char e
 	}
 
 	MSinitClientPrg(c, "user", qname);
+	thr = monetdb_query_begin(c, &registered);
 	res = SQLparser(c);
 	if (res != MAL_SUCCEED) {
 		goto cleanup;
@@ -276,22 +344,7 @@ static char* monetdb_query_internal(monetdb_connection conn, char* query, char e
 
 
 	if (result && m->results) {
-		res_internal->res.ncols = m->results->nr_cols;
-		if (m->results->nr_cols > 0 && m->results->order) {
-			res_internal->res.nrows = BATcount(BATdescriptor(m->results->order));
-			BBPunfix(m->results->order);
-		}
-		res_internal->monetdb_resultset = m->results;
-		res_internal->converted_columns = GDKzalloc(sizeof(monetdb_column*) * res_internal->res.ncols);
-		if (!res_internal->converted_columns) {
-			res = GDKstrdup("Malloc fail");
-			GDKfree(res_internal);
-			goto cleanup;
-		}
-		res_internal->res.type = (char) m->results->query_type;
-		res_internal->res.id = (size_t) m->results->query_id;
-		// tODO: check alloc
-		m->results = NULL;
+		res = monetdb_result_take(m, res_internal);
 	}
 
 cleanup:
@@ -302,10 +355,15 @@ cleanup:
 	c->fdin = NULL;
 
 	sres = SQLautocommit(c, m);
+	monetdb_query_end(thr, registered);
 	if (!sres && !res) {
 		return GDKstrdup("Cannot COMMIT/ROLLBACK without a valid transaction.");
 	}
 	if (res != MAL_SUCCEED && res_internal != NULL) {
+		if (res_internal->monetdb_resultset) {
+			res_tables_destroy(res_internal->monetdb_resultset);
+		}
+		GDKfree(res_internal->converted_columns);
 		GDKfree(res_internal);
 		*result = NULL;
 	}
@@ -326,11 +384,667 @@ char* monetdb_query(monetdb_connection conn, char* query, char execute, monetdb_
 	return(monetdb_query_internal(conn, query, execute, result, affected_rows, prepare_id, 'S'));
 }
 
+/*
+ * Asynchronous queries
+ * Submitted queries are queued and picked up by a small pool of embedded
+ * worker threads, created on first use. Each worker runs one query at a time
+ * through monetdb_query; the plan itself is still executed by the dataflow
+ * workers. A connection can have a single query in flight.
+ */
+struct monetdb_query_handle {
+	Client c;
+	char *query;
+	monetdb_query_callback callback;
+	void *userdata;
+	monetdb_result *result;
+	long affected_rows;
+	char *msg;
+	int done;
+	int cancelled;
+	MT_Sema finished;
+	struct monetdb_query_handle *next;
+};
+
+static MT_Lock async_lock MT_LOCK_INITIALIZER("async_lock");
+
+static struct {
+	MT_Sema queued;
+	monetdb_query_handle *head, *tail;
+	monetdb_query_handle **running;
+	MT_Id *workers;
+	int nworkers;
+	int stopping;
+} async_queue;
+
+static void monetdb_async_worker(void *arg) {
+	int id = (int) (intptr_t) arg;
+	Thread thr = THRnew("monetdb_async");
+
+	// registered once, instead of for every query it runs
+	GDKsetbuf(GDKmalloc(GDKMAXERRLEN));
+	if (GDKerrbuf) {
+		GDKclrerr();
+	}
+	for (;;) {
+		monetdb_query_handle *job;
+
+		MT_sema_down(&async_queue.queued);
+		MT_lock_set(&async_lock);
+		job = async_queue.head;
+		if (job) {
+			async_queue.head = job->next;
+			if (!async_queue.head) {
+				async_queue.tail = NULL;
+			}
+			async_queue.running[id] = job;
+		}
+		MT_lock_unset(&async_lock);
+		if (!job) {
+			// woken up without work, the pool is shutting down
+			break;
+		}
+
+		if (job->cancelled) {
+			job->msg = createException(MAL, "mal.interpreter", RUNTIME_QRY_INTERRUPT);
+		} else {
+			job->msg = monetdb_query(job->c, job->query, 1, &job->result, &job->affected_rows, NULL);
+		}
+		GDKfree(job->query);
+		job->query = NULL;
+
+		MT_lock_set(&async_lock);
+		async_queue.running[id] = NULL;
+		job->done = 1;
+		MT_lock_unset(&async_lock);
+		if (job->callback) {
+			job->callback(job->c, job->userdata, job->msg, job->result, job->affected_rows);
+			MT_sema_destroy(&job->finished);
+			GDKfree(job);
+		} else {
+			MT_sema_up(&job->finished);
+		}
+	}
+	GDKfree(GDKerrbuf);
+	GDKsetbuf(0);
+	if (thr) {
+		THRdel(thr);
+	}
+}
+
+static char* monetdb_async_start(void) {
+	int i;
+
+	if (async_queue.workers) {
+		return MAL_SUCCEED;
+	}
+	async_queue.nworkers = GDKnr_threads > 1 ? GDKnr_threads : 1;
+	async_queue.workers = GDKzalloc(sizeof(MT_Id) * async_queue.nworkers);
+	async_queue.running = GDKzalloc(sizeof(monetdb_query_handle*) * async_queue.nworkers);
+	if (!async_queue.workers || !async_queue.running) {
+		GDKfree(async_queue.workers);
+		GDKfree(async_queue.running);
+		async_queue.workers = NULL;
+		async_queue.running = NULL;
+		return GDKstrdup("Malloc fail");
+	}
+	MT_sema_init(&async_queue.queued, 0, "async_queue.queued");
+	for (i = 0; i < async_queue.nworkers; i++) {
+		if (MT_create_thread(&async_queue.workers[i], monetdb_async_worker, (void *) (intptr_t) i, MT_THR_JOINABLE) < 0) {
+			async_queue.nworkers = i;
+			break;
+		}
+	}
+	if (async_queue.nworkers == 0) {
+		GDKfree(async_queue.workers);
+		GDKfree(async_queue.running);
+		async_queue.workers = NULL;
+		async_queue.running = NULL;
+		MT_sema_destroy(&async_queue.queued);
+		return GDKstrdup("Cannot start query worker");
+	}
+	return MAL_SUCCEED;
+}
+
+/* lets the workers finish the queued queries, then joins them */
+static void monetdb_async_stop(void) {
+	int i;
+
+	MT_lock_set(&async_lock);
+	if (!async_queue.workers) {
+		MT_lock_unset(&async_lock);
+		return;
+	}
+	async_queue.stopping = 1;
+	MT_lock_unset(&async_lock);
+	for (i = 0; i < async_queue.nworkers; i++) {
+		MT_sema_up(&async_queue.queued);
+	}
+	for (i = 0; i < async_queue.nworkers; i++) {
+		MT_join_thread(async_queue.workers[i]);
+	}
+	MT_sema_destroy(&async_queue.queued);
+	GDKfree(async_queue.workers);
+	GDKfree(async_queue.running);
+	async_queue.workers = NULL;
+	async_queue.running = NULL;
+	async_queue.nworkers = 0;
+	async_queue.stopping = 0;
+}
+
+static char* monetdb_query_enqueue(monetdb_connection conn, char* query, monetdb_query_callback callback, void* userdata, monetdb_query_handle** handle) {
+	Client c = (Client) conn;
+	monetdb_query_handle *job, *j;
+	str msg = MAL_SUCCEED;
+	int i;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!query) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	job = GDKzalloc(sizeof(monetdb_query_handle));
+	if (!job || !(job->query = GDKstrdup(query))) {
+		GDKfree(job);
+		return GDKstrdup("Malloc fail");
+	}
+	job->c = c;
+	job->callback = callback;
+	job->userdata = userdata;
+	MT_sema_init(&job->finished, 0, "monetdb_query_handle.finished");
+
+	MT_lock_set(&async_lock);
+	if (async_queue.stopping) {
+		msg = GDKstrdup("Embedded MonetDB is shutting down");
+		goto failed;
+	}
+	for (j = async_queue.head; j; j = j->next) {
+		if (j->c == c) {
+			break;
+		}
+	}
+	for (i = 0; !j && i < async_queue.nworkers; i++) {
+		if (async_queue.running[i] && async_queue.running[i]->c == c) {
+			j = async_queue.running[i];
+		}
+	}
+	if (j) {
+		msg = GDKstrdup("Connection already has a query in flight");
+		goto failed;
+	}
+	if ((msg = monetdb_async_start()) != MAL_SUCCEED) {
+		goto failed;
+	}
+	if (async_queue.tail) {
+		async_queue.tail->next = job;
+	} else {
+		async_queue.head = job;
+	}
+	async_queue.tail = job;
+	if (handle) {
+		*handle = job;
+	}
+	MT_lock_unset(&async_lock);
+	MT_sema_up(&async_queue.queued);
+	return MAL_SUCCEED;
+failed:
+	MT_lock_unset(&async_lock);
+	MT_sema_destroy(&job->finished);
+	GDKfree(job->query);
+	GDKfree(job);
+	return msg;
+}
+
+char* monetdb_query_async(monetdb_connection conn, char* query, monetdb_query_callback callback, void* userdata) {
+	if (!callback) {
+		return GDKstrdup("Invalid parameters");
+	}
+	return monetdb_query_enqueue(conn, query, callback, userdata, NULL);
+}
+
+char* monetdb_query_submit(monetdb_connection conn, char* query, monetdb_query_handle** handle) {
+	if (!handle) {
+		return GDKstrdup("Invalid parameters");
+	}
+	*handle = NULL;
+	return monetdb_query_enqueue(conn, query, NULL, NULL, handle);
+}
+
+int monetdb_query_poll(monetdb_query_handle* handle) {
+	int done;
+
+	if (!handle) {
+		return 1;
+	}
+	MT_lock_set(&async_lock);
+	done = handle->done;
+	MT_lock_unset(&async_lock);
+	return done;
+}
+
+char* monetdb_query_collect(monetdb_query_handle* handle, monetdb_result** result, long* affected_rows) {
+	str msg;
+
+	if (!handle) {
+		return GDKstrdup("Invalid parameters");
+	}
+	MT_sema_down(&handle->finished);
+	MT_sema_destroy(&handle->finished);
+	msg = handle->msg;
+	if (result) {
+		*result = handle->result;
+	} else if (handle->result) {
+		monetdb_cleanup_result(handle->c, handle->result);
+	}
+	if (affected_rows) {
+		*affected_rows = handle->affected_rows;
+	}
+	GDKfree(handle);
+	return msg;
+}
+
+char* monetdb_interrupt(monetdb_connection conn) {
+	Client c = (Client) conn;
+	monetdb_query_handle *j;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	MT_lock_set(&async_lock);
+	for (j = async_queue.head; j; j = j->next) {
+		if (j->c == c) {
+			j->cancelled = 1;
+		}
+	}
+	MT_lock_unset(&async_lock);
+	// polled between instructions and inside long running kernel loops
+	c->qinterrupt.stop = 1;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_set_query_timeout(monetdb_connection conn, size_t timeout_ms) {
+	Client c = (Client) conn;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	c->qtimeout = (lng) timeout_ms * 1000;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_set_query_memory_limit(monetdb_connection conn, size_t bytes) {
+	Client c = (Client) conn;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	c->qmaxmem = (lng) bytes;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_set_memory_limit(size_t bytes) {
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	// also steers the kernel away from building hash tables that would not fit
+	GDK_mem_maxsize = bytes ? bytes : GDK_VM_MAXSIZE;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_dataflow_statistics(monetdb_dataflow_stats* stats) {
+	DataflowStats s;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!stats) {
+		return GDKstrdup("Invalid stats pointer");
+	}
+	getDataflowStats(&s);
+	stats->executed = s.executed;
+	stats->core_local = s.corelocal;
+	stats->node_local = s.nodelocal;
+	stats->remote = s.remote;
+	stats->routed = s.routed;
+	stats->stolen = s.stolen;
+	stats->admitted = s.admitted;
+	stats->deferred = s.deferred;
+	stats->forced = s.forced;
+	stats->numa_nodes = s.nodes;
+	return MAL_SUCCEED;
+}
+
+typedef struct {
+	monetdb_statement res;
+	Client c;
+	int id;
+	ValRecord *data;
+} monetdb_statement_internal;
+
+static monetdb_types embedded_type(int localtype) {
+	switch (ATOMstorage(localtype)) {
+	case TYPE_bit:
+	case TYPE_bte:
+		return monetdb_int8_t;
+	case TYPE_sht:
+		return monetdb_int16_t;
+	case TYPE_int:
+		if (localtype == TYPE_date) {
+			return monetdb_date;
+		}
+		if (localtype == TYPE_daytime) {
+			return monetdb_time;
+		}
+		return monetdb_int32_t;
+	case TYPE_oid:
+		return monetdb_size_t;
+	case TYPE_lng:
+		if (localtype == TYPE_timestamp) {
+			return monetdb_timestamp;
+		}
+		return monetdb_int64_t;
+	case TYPE_flt:
+		return monetdb_float;
+	case TYPE_dbl:
+		return monetdb_double;
+	default:
+		if (localtype == TYPE_blob || localtype == TYPE_sqlblob) {
+			return monetdb_blob;
+		}
+		return monetdb_str;
+	}
+}
+
+char* monetdb_prepare(monetdb_connection conn, char* query, monetdb_statement **stmt) {
+	Client c = (Client) conn;
+	monetdb_result* prep_result = NULL;
+	monetdb_statement_internal *stmt_internal;
+	long prep_id = -1;
+	size_t query_len, i;
+	char *prep_query;
+	str res = MAL_SUCCEED;
+	mvc *m;
+	cq *q;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	if (!query || !stmt) {
+		return GDKstrdup("Invalid parameters");
+	}
+	query_len = strlen(query) + 9;
+	prep_query = GDKmalloc(query_len);
+	if (!prep_query) {
+		return GDKstrdup("Malloc fail");
+	}
+	snprintf(prep_query, query_len, "PREPARE %s", query);
+	res = monetdb_query_internal(conn, prep_query, 1, &prep_result, NULL, &prep_id, 'S');
+	GDKfree(prep_query);
+	if (res != MAL_SUCCEED) {
+		return res;
+	}
+	// the result only describes the statement, the parameter types are kept in the cache entry
+	monetdb_cleanup_result(conn, prep_result);
+
+	m = ((backend *) c->sqlcontext)->mvc;
+	if (prep_id < 0 || (q = qc_find(m->qc, (int) prep_id)) == NULL) {
+		return GDKstrdup("Prepared statement not found in query cache");
+	}
+	stmt_internal = GDKzalloc(sizeof(monetdb_statement_internal));
+	if (!stmt_internal) {
+		return GDKstrdup("Malloc fail");
+	}
+	stmt_internal->c = c;
+	stmt_internal->id = q->id;
+	stmt_internal->res.nparam = (size_t) q->paramlen;
+	if (q->paramlen > 0) {
+		stmt_internal->res.type = GDKzalloc(sizeof(monetdb_types) * q->paramlen);
+		stmt_internal->data = GDKzalloc(sizeof(ValRecord) * q->paramlen);
+		if (!stmt_internal->res.type || !stmt_internal->data) {
+			monetdb_cleanup_statement(conn, (monetdb_statement*) stmt_internal);
+			return GDKstrdup("Malloc fail");
+		}
+	}
+	// unbound parameters are NULL
+	for (i = 0; i < stmt_internal->res.nparam; i++) {
+		int tpe = q->params[i].type->localtype;
+		stmt_internal->res.type[i] = embedded_type(tpe);
+		if (VALinit(&stmt_internal->data[i], tpe, ATOMnilptr(tpe)) == NULL) {
+			monetdb_cleanup_statement(conn, (monetdb_statement*) stmt_internal);
+			return GDKstrdup("Malloc fail");
+		}
+	}
+	*stmt = (monetdb_statement*) stmt_internal;
+	return MAL_SUCCEED;
+}
+
+static char* monetdb_bind_internal(monetdb_statement *stmt, size_t parameter_nr, int tpe, const void *data) {
+	monetdb_statement_internal *stmt_internal = (monetdb_statement_internal *) stmt;
+	ValPtr v;
+	int target;
+
+	if (!stmt || parameter_nr >= stmt->nparam) {
+		return GDKstrdup("Parameter index out of range");
+	}
+	v = &stmt_internal->data[parameter_nr];
+	target = v->vtype;
+	VALclear(v);
+	if (VALinit(v, tpe, data) == NULL) {
+		VALinit(v, target, ATOMnilptr(target));
+		return GDKstrdup("Malloc fail");
+	}
+	if (tpe != target && VALconvert(target, v) == NULL) {
+		VALclear(v);
+		VALinit(v, target, ATOMnilptr(target));
+		return GDKstrdup("Cannot convert parameter to the prepared type");
+	}
+	return MAL_SUCCEED;
+}
+
+#define GENERATE_BIND_FUNCTION(ctype, typename, mtype)                         \
+	char* monetdb_bind_##typename(monetdb_statement *stmt, size_t parameter_nr, ctype data) { \
+		mtype value = (mtype) data;                                            \
+		return monetdb_bind_internal(stmt, parameter_nr, TYPE_##mtype, &value); \
+	}
+
+GENERATE_BIND_FUNCTION(int8_t, int8_t, bte)
+GENERATE_BIND_FUNCTION(int16_t, int16_t, sht)
+GENERATE_BIND_FUNCTION(int32_t, int32_t, int)
+GENERATE_BIND_FUNCTION(int64_t, int64_t, lng)
+GENERATE_BIND_FUNCTION(size_t, size_t, oid)
+GENERATE_BIND_FUNCTION(float, float, flt)
+GENERATE_BIND_FUNCTION(double, double, dbl)
+
+char* monetdb_bind_str(monetdb_statement *stmt, size_t parameter_nr, const char *data) {
+	return monetdb_bind_internal(stmt, parameter_nr, TYPE_str, data ? data : str_nil);
+}
+
+static date date_from_data(monetdb_data_date *ptr);
+static daytime time_from_data(monetdb_data_time *ptr);
+static timestamp timestamp_from_data(monetdb_data_timestamp *ptr);
+
+char* monetdb_bind_date(monetdb_statement *stmt, size_t parameter_nr, monetdb_data_date data) {
+	date value = date_from_data(&data);
+	return monetdb_bind_internal(stmt, parameter_nr, TYPE_date, &value);
+}
+
+char* monetdb_bind_time(monetdb_statement *stmt, size_t parameter_nr, monetdb_data_time data) {
+	daytime value = time_from_data(&data);
+	return monetdb_bind_internal(stmt, parameter_nr, TYPE_daytime, &value);
+}
+
+char* monetdb_bind_timestamp(monetdb_statement *stmt, size_t parameter_nr, monetdb_data_timestamp data) {
+	timestamp value = timestamp_from_data(&data);
+	return monetdb_bind_internal(stmt, parameter_nr, TYPE_timestamp, &value);
+}
+
+char* monetdb_bind_null(monetdb_statement *stmt, size_t parameter_nr) {
+	monetdb_statement_internal *stmt_internal = (monetdb_statement_internal *) stmt;
+	int tpe;
+	if (!stmt || parameter_nr >= stmt->nparam) {
+		return GDKstrdup("Parameter index out of range");
+	}
+	tpe = stmt_internal->data[parameter_nr].vtype;
+	return monetdb_bind_internal(stmt, parameter_nr, tpe, ATOMnilptr(tpe));
+}
+
+/* Call the cached MAL function of the prepared statement directly with the
+ * bound values, bypassing the SQL scanner, parser and optimizers. This
+ * mirrors SQLexecutePrepared, minus the atom casting of parsed arguments. */
+char* monetdb_execute(monetdb_statement *stmt, monetdb_result **result, long *affected_rows) {
+	monetdb_statement_internal *stmt_internal = (monetdb_statement_internal *) stmt;
+	monetdb_result_internal *res_internal = NULL;
+	Client c;
+	backend *b;
+	mvc *m;
+	cq *q;
+	MalBlkPtr mb;
+	MalStkPtr glb;
+	InstrPtr pci;
+	ValPtr *argv = NULL;
+	str res = MAL_SUCCEED;
+	Thread thr;
+	int i, registered;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!stmt) {
+		return GDKstrdup("Invalid parameters");
+	}
+	c = stmt_internal->c;
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	b = (backend *) c->sqlcontext;
+	m = b->mvc;
+	if (m->session->status < 0 && m->session->auto_commit == 0) {
+		return GDKstrdup("Current transaction is aborted (please ROLLBACK)");
+	}
+	q = qc_find(m->qc, stmt_internal->id);
+	if (!q || !q->code) {
+		return GDKstrdup("Prepared statement is no longer available");
+	}
+	mb = ((Symbol) q->code)->def;
+	pci = getInstrPtr(mb, 0);
+	if ((size_t) (pci->argc - pci->retc) != stmt->nparam) {
+		return GDKstrdup("Wrong number of arguments for prepared statement");
+	}
+	argv = GDKzalloc(sizeof(ValPtr) * pci->argc);
+	if (!argv) {
+		return GDKstrdup("Malloc fail");
+	}
+	for (i = pci->retc; i < pci->argc; i++) {
+		argv[i] = &stmt_internal->data[i - pci->retc];
+	}
+
+	SQLtrans(m);
+	b->output_format = OFMT_NONE;
+	m->user_id = m->role_id = USER_MONETDB;
+	m->errstr[0] = '\0';
+	m->rowcnt = -1;
+	if (result) {
+		res_internal = GDKzalloc(sizeof(monetdb_result_internal));
+		if (!res_internal) {
+			res = GDKstrdup("Malloc fail");
+			goto cleanup;
+		}
+		*result = (monetdb_result*) res_internal;
+		m->reply_size = -2; /* do not clean up result tables */
+	}
+
+	glb = (MalStkPtr) q->stk;
+	thr = monetdb_query_begin(c, &registered);
+	res = callMAL(c, mb, &glb, argv, 0);
+	monetdb_query_end(thr, registered);
+	if (glb) {
+		/* cleanup the arguments, but keep the stack for the next call */
+		for (i = pci->retc; i < pci->argc; i++) {
+			ValPtr v = &glb->stk[pci->argv[i]];
+			garbageElement(c, v);
+			v->vtype = TYPE_int;
+			v->val.ival = int_nil;
+		}
+	}
+	q->stk = (backend_stack) glb;
+	if (res != MAL_SUCCEED) {
+		m->session->status = -10;
+		goto cleanup;
+	}
+
+	if (!m->results && m->rowcnt >= 0 && affected_rows) {
+		*affected_rows = m->rowcnt;
+	}
+	if (result && m->results) {
+		res = monetdb_result_take(m, res_internal);
+	}
+
+cleanup:
+	GDKfree(argv);
+	if (m->results) {
+		res_tables_destroy(m->results);
+		m->results = NULL;
+	}
+	if (!SQLautocommit(c, m) && !res) {
+		res = GDKstrdup("Cannot COMMIT/ROLLBACK without a valid transaction.");
+	}
+	if (res != MAL_SUCCEED && res_internal != NULL) {
+		if (res_internal->monetdb_resultset) {
+			res_tables_destroy(res_internal->monetdb_resultset);
+		}
+		GDKfree(res_internal->converted_columns);
+		GDKfree(res_internal);
+		*result = NULL;
+	}
+	return res;
+}
+
+void monetdb_cleanup_statement(monetdb_connection conn, monetdb_statement *stmt) {
+	monetdb_statement_internal *stmt_internal = (monetdb_statement_internal *) stmt;
+	Client c = (Client) conn;
+	size_t i;
+
+	if (!stmt) {
+		return;
+	}
+	if (monetdb_is_initialized() && MCvalid(c) && c->sqlcontext) {
+		mvc *m = ((backend *) c->sqlcontext)->mvc;
+		cq *q = qc_find(m->qc, stmt_internal->id);
+		if (q) {
+			qc_delete(m->qc, q);
+		}
+	}
+	if (stmt_internal->data) {
+		for (i = 0; i < stmt->nparam; i++) {
+			VALclear(&stmt_internal->data[i]);
+		}
+	}
+	GDKfree(stmt_internal->data);
+	GDKfree(stmt->type);
+	GDKfree(stmt);
+}
+
 char* monetdb_append(monetdb_connection conn, const char* schema, const char* table, append_data *data, int ncols) {
 	Client c = (Client) conn;
 	mvc* m;
+	Thread thr;
 
-	int i;
+	int i, registered;
 	str res = MAL_SUCCEED;
 
 	if (!monetdb_is_initialized()) {
@@ -383,39 +1097,134 @@ char* monetdb_append(monetdb_connection conn, const char* schema, const char* ta
 		if (rel && backend_dumpstmt((backend *) c->sqlcontext, c->curprg->def, rel, 1, 1, "append") < 0) {
 			return GDKstrdup("Append plan generation failure");
 		}
+		thr = monetdb_query_begin(c, &registered);
 		if ((res = SQLoptimizeQuery(c, c->curprg->def)) != MAL_SUCCEED ||
 				c->curprg->def->errors || (res = SQLengine(c)) != MAL_SUCCEED) {
+			monetdb_query_end(thr, registered);
+			// roll back a failed append, e.g. a key violation, in auto-commit mode
+			m->session->status = -1;
+			SQLautocommit(c, m);
 			return(res);
 		}
+		monetdb_query_end(thr, registered);
 	}
 	SQLautocommit(c, m);
 	return NULL;
 }
 
-void monetdb_cleanup_result(monetdb_connection conn, monetdb_result* result) {
-	monetdb_result_internal* res = (monetdb_result_internal *) result;
+static void monetdb_destroy_result(monetdb_result_internal* res) {
+	size_t i;
 
+	if (!res) {
+		return;
+	}
+	monetdb_destroy_result(res->chunk);
+	if (res->column_views) {
+		for (i = 0; i < res->res.ncols; i++) {
+			if (res->column_views[i]) {
+				BBPunfix(res->column_views[i]->bid);
+				GDKfree((void*) res->column_views[i]->view.dict);
+				GDKfree((void*) res->column_views[i]->view.codes);
+				GDKfree(res->column_views[i]);
+			}
+		}
+	}
+	if (res->converted_columns) {
+		for (i = 0; i < res->res.ncols; i++) {
+			monetdb_destroy_column(res->converted_columns[i]);
+		}
+	}
+	if (res->monetdb_resultset) {
+		res_tables_destroy(res->monetdb_resultset);
+	}
+	GDKfree(res->converted_columns);
+	GDKfree(res->column_views);
+	GDKfree(res);
+}
+
+void monetdb_cleanup_result(monetdb_connection conn, monetdb_result* result) {
 	if (!monetdb_is_initialized()) {
 		return;
 	}
 	if (!MCvalid((Client) conn)) {
 		return;
 	}
-	if (!result) {
-		return;
+	monetdb_destroy_result((monetdb_result_internal *) result);
+}
+
+/* Hand out the next max_rows rows of a result as a result of its own. The
+ * chunk columns are BATslice views on the result columns, so no data is
+ * copied; fetching a chunk only converts the rows of that chunk. The chunk
+ * is owned by the result and is invalidated by the next call. The offset
+ * handling follows mvc_export_chunk. */
+char* monetdb_result_next_chunk(monetdb_result* result, size_t max_rows, monetdb_result** chunk) {
+	monetdb_result_internal* res = (monetdb_result_internal *) result;
+	monetdb_result_internal* chk;
+	res_table *t;
+	BUN cnt;
+	int i;
+
+	if (!result || !chunk || max_rows == 0) {
+		return GDKstrdup("Invalid parameters");
 	}
-	if (res->monetdb_resultset) {
-		res_tables_destroy(res->monetdb_resultset);
+	*chunk = NULL;
+	monetdb_destroy_result(res->chunk);
+	res->chunk = NULL;
+
+	cnt = (BUN) max_rows;
+	if (res->chunk_offset >= result->nrows)
+		cnt = 0;
+	else if (res->chunk_offset + cnt > result->nrows)
+		cnt = (BUN) (result->nrows - res->chunk_offset);
+	if (cnt == 0 || !res->monetdb_resultset) {
+		// end of the result
+		return MAL_SUCCEED;
+	}
+
+	chk = GDKzalloc(sizeof(monetdb_result_internal));
+	if (!chk) {
+		return GDKstrdup("Malloc fail");
+	}
+	chk->res = *result;
+	chk->res.nrows = (size_t) cnt;
+	t = res->monetdb_resultset;
+	chk->monetdb_resultset = res_table_create(NULL, t->id, t->query_id, t->nr_cols, t->query_type, NULL, NULL);
+	chk->converted_columns = GDKzalloc(sizeof(monetdb_column*) * result->ncols);
+	if (!chk->monetdb_resultset || !chk->converted_columns) {
+		monetdb_destroy_result(chk);
+		return GDKstrdup("Malloc fail");
 	}
-	if (res->converted_columns) {
-		size_t i;
-		for (i = 0; i < res->res.ncols; i++) {
-			monetdb_destroy_column(res->converted_columns[i]);
+	for (i = 0; i < t->nr_cols; i++) {
+		res_col *src = t->cols + i, *dst = chk->monetdb_resultset->cols + i;
+		BAT *b, *v;
+
+		if ((b = BATdescriptor(src->b)) == NULL) {
+			monetdb_destroy_result(chk);
+			return GDKstrdup("Cannot access result column");
+		}
+		v = BATslice(b, (BUN) res->chunk_offset, (BUN) res->chunk_offset + cnt);
+		BBPunfix(b->batCacheid);
+		if (v == NULL) {
+			monetdb_destroy_result(chk);
+			return GDKstrdup("Malloc fail");
+		}
+		dst->tn = GDKstrdup(src->tn);
+		dst->name = GDKstrdup(src->name);
+		dst->type = src->type;
+		dst->mtype = TYPE_bat;
+		dst->b = v->batCacheid;
+		BBPretain(dst->b);
+		BBPunfix(v->batCacheid);
+		chk->monetdb_resultset->cur_col++;
+		if (!dst->tn || !dst->name) {
+			monetdb_destroy_result(chk);
+			return GDKstrdup("Malloc fail");
 		}
 	}
-	GDKfree(res->converted_columns);
-	GDKfree(res);
-
+	res->chunk_offset += cnt;
+	res->chunk = chk;
+	*chunk = (monetdb_result*) chk;
+	return MAL_SUCCEED;
 }
 
 str monetdb_get_columns(monetdb_connection conn, const char* schema_name, const char *table_name, int *column_count, char ***column_names, int **column_types) {
@@ -486,6 +1295,7 @@ void monetdb_unregister_progress(monetdb_connection conn) {
 void monetdb_shutdown(void) {
 	MT_lock_set(&embedded_lock);
 	if (monetdb_embedded_initialized) {
+		monetdb_async_stop();
 		mserver_reset(0);
 		fclose(embedded_stdout);
 		monetdb_embedded_initialized = 0;
@@ -758,6 +1568,123 @@ wrapup:
 	return NULL;
 }
 
+/* Small string heaps are fully duplicate eliminated, so the heap offsets
+ * map one-to-one onto the distinct values. Number them in order of first
+ * appearance to expose the column as a dictionary. */
+static str monetdb_view_dictionary(monetdb_column_view_internal *view, BAT *b) {
+	BUN i, cnt = BATcount(b);
+	uint32_t *codes, *map, ndict = 0;
+	const char **dict;
+
+	codes = GDKmalloc(sizeof(uint32_t) * MAX(cnt, 1));
+	map = GDKmalloc(sizeof(uint32_t) * b->tvheap->free);
+	dict = GDKmalloc(sizeof(const char*) * MAX(cnt, 1));
+	if (!codes || !map || !dict) {
+		GDKfree(codes);
+		GDKfree(map);
+		GDKfree(dict);
+		return MAL_MALLOC_FAIL;
+	}
+	memset(map, 0xFF, sizeof(uint32_t) * b->tvheap->free);
+	for (i = 0; i < cnt; i++) {
+		size_t off = VarHeapVal(Tloc(b, 0), i, b->twidth);
+		if (map[off] == (uint32_t) -1) {
+			map[off] = ndict;
+			dict[ndict++] = b->tvheap->base + off;
+		}
+		codes[i] = map[off];
+	}
+	GDKfree(map);
+	view->view.dict_count = ndict;
+	view->view.dict = dict;
+	view->view.codes = codes;
+	return MAL_SUCCEED;
+}
+
+/* Expose the tail (and string) heap of a result column without copying it.
+ * The BAT stays fixed until the result is cleaned up. */
+monetdb_column_view* monetdb_result_fetch_view(monetdb_result* res, size_t column_index) {
+	monetdb_result_internal* result = (monetdb_result_internal*) res;
+	monetdb_column_view_internal* view;
+	BAT* b;
+	int bat_type;
+
+	if (!res || column_index >= res->ncols) {
+		return NULL;
+	}
+	if (result->column_views && result->column_views[column_index]) {
+		return &result->column_views[column_index]->view;
+	}
+	if (!result->column_views) {
+		result->column_views = GDKzalloc(sizeof(monetdb_column_view_internal*) * res->ncols);
+		if (!result->column_views) {
+			return NULL;
+		}
+	}
+	b = BATdescriptor(result->monetdb_resultset->cols[column_index].b);
+	if (!b) {
+		return NULL;
+	}
+	view = GDKzalloc(sizeof(monetdb_column_view_internal));
+	if (!view) {
+		BBPunfix(b->batCacheid);
+		return NULL;
+	}
+	bat_type = b->ttype;
+	if (bat_type == TYPE_bit || bat_type == TYPE_bte) {
+		view->view.type = monetdb_int8_t;
+	} else if (bat_type == TYPE_sht) {
+		view->view.type = monetdb_int16_t;
+	} else if (bat_type == TYPE_int) {
+		view->view.type = monetdb_int32_t;
+	} else if (bat_type == TYPE_oid || bat_type == TYPE_void) {
+		view->view.type = monetdb_size_t;
+	} else if (bat_type == TYPE_lng) {
+		view->view.type = monetdb_int64_t;
+	} else if (bat_type == TYPE_flt) {
+		view->view.type = monetdb_float;
+	} else if (bat_type == TYPE_dbl) {
+		view->view.type = monetdb_double;
+	} else if (ATOMstorage(bat_type) == TYPE_str) {
+		view->view.type = monetdb_str;
+		view->view.heap = b->tvheap->base;
+		view->view.offset_width = (unsigned char) b->twidth;
+		view->view.offset_base = b->twidth <= 2 ? (size_t) GDK_VAROFFSET : 0;
+		if (GDK_ELIMDOUBLES(b->tvheap) && monetdb_view_dictionary(view, b) != MAL_SUCCEED) {
+			GDKfree(view);
+			BBPunfix(b->batCacheid);
+			return NULL;
+		}
+	} else {
+		// no native layout, use monetdb_result_fetch
+		GDKfree(view);
+		BBPunfix(b->batCacheid);
+		return NULL;
+	}
+	view->bid = b->batCacheid;
+	view->view.count = BATcount(b);
+	view->view.null_value = ATOMnilptr(bat_type);
+	view->view.scale = pow(10, result->monetdb_resultset->cols[column_index].type.scale);
+	if (BATtdense(b)) {
+		view->view.dense = 1;
+		view->view.seqbase = (size_t) b->tseqbase;
+	}
+	if (bat_type != TYPE_void) {
+		view->view.data = Tloc(b, 0);
+	}
+	result->column_views[column_index] = view;
+	return &view->view;
+}
+
+const char* monetdb_column_view_str(const monetdb_column_view* view, size_t row) {
+	const char *value;
+	if (!view || view->type != monetdb_str || row >= view->count) {
+		return NULL;
+	}
+	value = view->heap + VarHeapVal(view->data, row, view->offset_width);
+	return GDK_STRNIL(value) ? NULL : value;
+}
+
 void* monetdb_result_fetch_rawcol(monetdb_result* res, size_t column_index) {
 	monetdb_result_internal* result = (monetdb_result_internal*) res;
 	if (column_index >= res->ncols) // index out of range
@@ -765,6 +1692,851 @@ void* monetdb_result_fetch_rawcol(monetdb_result* res, size_t column_index) {
 	return &(result->monetdb_resultset->cols[column_index]);
 }
 
+/*
+ * Apache Arrow C data interface
+ * Results are exported as a struct array with a child per column. Fixed-width
+ * columns whose layout matches Arrow share the tail heap of the result BAT,
+ * which stays fixed until the consumer releases the array. Validity bitmaps
+ * are derived from the nil values.
+ */
+typedef struct {
+	bat bid;
+	void *owned[3];
+	const void *buffers[3];
+} arrow_private;
+
+static void arrow_release_schema(struct ArrowSchema *schema) {
+	int64_t i;
+	if (!schema || !schema->release) {
+		return;
+	}
+	for (i = 0; i < schema->n_children; i++) {
+		if (schema->children[i]->release) {
+			schema->children[i]->release(schema->children[i]);
+		}
+		GDKfree(schema->children[i]);
+	}
+	GDKfree(schema->children);
+	GDKfree((void*) schema->format);
+	GDKfree((void*) schema->name);
+	schema->release = NULL;
+}
+
+static void arrow_release_array(struct ArrowArray *array) {
+	arrow_private *priv;
+	int64_t i;
+	if (!array || !array->release) {
+		return;
+	}
+	for (i = 0; i < array->n_children; i++) {
+		if (array->children[i]->release) {
+			array->children[i]->release(array->children[i]);
+		}
+		GDKfree(array->children[i]);
+	}
+	GDKfree(array->children);
+	priv = (arrow_private *) array->private_data;
+	if (priv) {
+		for (i = 0; i < 3; i++) {
+			GDKfree(priv->owned[i]);
+		}
+		if (priv->bid) {
+			BBPunfix(priv->bid);
+			BBPrelease(priv->bid);
+		}
+		GDKfree(priv);
+	}
+	array->release = NULL;
+}
+
+static void *arrow_alloc_buffer(arrow_private *priv, int idx, size_t size) {
+	priv->owned[idx] = GDKzalloc(MAX(size, 1));
+	priv->buffers[idx] = priv->owned[idx];
+	return priv->owned[idx];
+}
+
+/* one pass over the values, eight rows per validity byte */
+#define ARROW_VALIDITY(TPE, ISNIL)                                             \
+	do {                                                                       \
+		const TPE *vals = (const TPE *) Tloc(b, 0);                            \
+		BUN i, j, nonnil = 0;                                                  \
+		for (i = 0; i < cnt; i += 8) {                                         \
+			unsigned char byte = 0;                                            \
+			BUN end = MIN(cnt - i, 8);                                         \
+			for (j = 0; j < end; j++) {                                        \
+				int valid = !(ISNIL(vals[i + j]));                             \
+				byte |= (unsigned char) (valid << j);                          \
+				nonnil += valid;                                               \
+			}                                                                  \
+			validity[i / 8] = byte;                                            \
+		}                                                                      \
+		null_count = (int64_t) (cnt - nonnil);                                 \
+	} while (0)
+
+#define ARROW_ISNIL(v, tpe) ((v) == tpe##_nil)
+#define ARROW_ISNIL_bte(v) ARROW_ISNIL(v, bte)
+#define ARROW_ISNIL_sht(v) ARROW_ISNIL(v, sht)
+#define ARROW_ISNIL_int(v) ARROW_ISNIL(v, int)
+#define ARROW_ISNIL_lng(v) ARROW_ISNIL(v, lng)
+#define ARROW_ISNIL_oid(v) ARROW_ISNIL(v, oid)
+#define ARROW_ISNIL_flt(v) ARROW_ISNIL(v, flt)
+#define ARROW_ISNIL_dbl(v) ARROW_ISNIL(v, dbl)
+#define ARROW_ISNIL_timestamp(v) ts_isnil(v)
+
+#define ARROW_DECIMAL(TPE)                                                     \
+	do {                                                                       \
+		const TPE *vals = (const TPE *) Tloc(b, 0);                            \
+		int64_t *dst = arrow_alloc_buffer(priv, 1, 16 * cnt);                  \
+		BUN i;                                                                 \
+		if (!dst)                                                              \
+			goto alloc_fail;                                                   \
+		/* little-endian 128-bit two's complement */                            \
+		for (i = 0; i < cnt; i++) {                                            \
+			dst[2 * i] = (int64_t) vals[i];                                    \
+			dst[2 * i + 1] = vals[i] < 0 ? -1 : 0;                             \
+		}                                                                      \
+		ARROW_VALIDITY(TPE, ARROW_ISNIL_##TPE);                                \
+	} while (0)
+
+static str arrow_export_column(res_col *col, struct ArrowSchema *schema, struct ArrowArray *array) {
+	arrow_private *priv;
+	unsigned char *validity = NULL;
+	int64_t null_count = 0;
+	char format[32];
+	BUN cnt;
+	BAT *b;
+	int tpe;
+
+	if ((b = BATdescriptor(col->b)) == NULL) {
+		return GDKstrdup("Cannot access result column");
+	}
+	priv = GDKzalloc(sizeof(arrow_private));
+	if (!priv) {
+		BBPunfix(b->batCacheid);
+		return GDKstrdup("Malloc fail");
+	}
+	cnt = BATcount(b);
+	tpe = b->ttype;
+	array->private_data = priv;
+	array->release = arrow_release_array;
+	array->buffers = priv->buffers;
+	array->length = (int64_t) cnt;
+	array->n_buffers = 2;
+	if (!b->tnonil || tpe == TYPE_void) {
+		validity = arrow_alloc_buffer(priv, 0, (cnt + 7) / 8);
+		if (!validity) {
+			goto alloc_fail;
+		}
+	}
+
+	if (col->type.type->eclass == EC_DEC && ATOMstorage(tpe) != TYPE_flt && ATOMstorage(tpe) != TYPE_dbl) {
+		snprintf(format, sizeof(format), "d:%u,%u", col->type.digits, col->type.scale);
+		switch (ATOMstorage(tpe)) {
+		case TYPE_bte:
+			ARROW_DECIMAL(bte);
+			break;
+		case TYPE_sht:
+			ARROW_DECIMAL(sht);
+			break;
+		case TYPE_int:
+			ARROW_DECIMAL(int);
+			break;
+		case TYPE_lng:
+			ARROW_DECIMAL(lng);
+			break;
+		default:
+			goto unsupported;
+		}
+	} else if (tpe == TYPE_void) {
+		uint64_t *dst = arrow_alloc_buffer(priv, 1, sizeof(uint64_t) * cnt);
+		BUN i;
+		if (!dst) {
+			goto alloc_fail;
+		}
+		strcpy(format, "L");
+		if (b->tseqbase == oid_nil) {
+			null_count = (int64_t) cnt;
+		} else {
+			for (i = 0; i < cnt; i++) {
+				dst[i] = (uint64_t) (b->tseqbase + i);
+			}
+			memset(validity, 0xFF, (cnt + 7) / 8);
+		}
+	} else if (tpe == TYPE_bit) {
+		const bit *vals = (const bit *) Tloc(b, 0);
+		unsigned char *dst = arrow_alloc_buffer(priv, 1, (cnt + 7) / 8);
+		BUN i;
+		if (!dst) {
+			goto alloc_fail;
+		}
+		strcpy(format, "b");
+		for (i = 0; i < cnt; i++) {
+			dst[i / 8] |= (unsigned char) ((vals[i] == 1) << (i % 8));
+		}
+		if (validity) {
+			ARROW_VALIDITY(bte, ARROW_ISNIL_bte);
+		}
+	} else if (tpe == TYPE_date) {
+		const date *vals = (const date *) Tloc(b, 0);
+		int32_t *dst = arrow_alloc_buffer(priv, 1, sizeof(int32_t) * cnt);
+		date epoch = MTIMEtodate(1, 1, 1970);
+		BUN i;
+		if (!dst) {
+			goto alloc_fail;
+		}
+		strcpy(format, "tdD");
+		for (i = 0; i < cnt; i++) {
+			// the value of a null is left 0
+			if (!date_isnil(vals[i]))
+				dst[i] = vals[i] - epoch;
+		}
+		if (validity) {
+			ARROW_VALIDITY(int, ARROW_ISNIL_int);
+		}
+	} else if (tpe == TYPE_daytime) {
+		// milliseconds since midnight in both
+		strcpy(format, "ttm");
+		priv->buffers[1] = Tloc(b, 0);
+		if (validity) {
+			ARROW_VALIDITY(int, ARROW_ISNIL_int);
+		}
+	} else if (tpe == TYPE_timestamp) {
+		const timestamp *vals = (const timestamp *) Tloc(b, 0);
+		int64_t *dst = arrow_alloc_buffer(priv, 1, sizeof(int64_t) * cnt);
+		date epoch = MTIMEtodate(1, 1, 1970);
+		BUN i;
+		if (!dst) {
+			goto alloc_fail;
+		}
+		strcpy(format, "tsm:");
+		for (i = 0; i < cnt; i++) {
+			if (!ts_isnil(vals[i]))
+				dst[i] = (int64_t) (vals[i].days - epoch) * 24 * 60 * 60 * 1000 + vals[i].msecs;
+		}
+		if (validity) {
+			ARROW_VALIDITY(timestamp, ARROW_ISNIL_timestamp);
+		}
+	} else if (ATOMstorage(tpe) == TYPE_str || tpe == TYPE_blob || tpe == TYPE_sqlblob) {
+		BATiter li = bat_iterator(b);
+		int is_str = ATOMstorage(tpe) == TYPE_str;
+		int32_t *offsets = arrow_alloc_buffer(priv, 1, sizeof(int32_t) * (cnt + 1));
+		size_t total = 0;
+		char *data;
+		BUN p, q, i = 0;
+		if (!offsets) {
+			goto alloc_fail;
+		}
+		strcpy(format, is_str ? "u" : "z");
+		BATloop(b, p, q) {
+			const void *t = BUNtail(li, p);
+			if (is_str ? !GDK_STRNIL((const char *) t) : ((const blob *) t)->nitems != ~(size_t) 0) {
+				total += is_str ? strlen((const char *) t) : ((const blob *) t)->nitems;
+			}
+		}
+		if (total > (size_t) INT32_MAX) {
+			arrow_release_array(array);
+			return GDKstrdup("Column too large for Arrow 32-bit offsets");
+		}
+		data = arrow_alloc_buffer(priv, 2, total);
+		if (!data) {
+			goto alloc_fail;
+		}
+		array->n_buffers = 3;
+		total = 0;
+		BATloop(b, p, q) {
+			const void *t = BUNtail(li, p);
+			int valid = is_str ? !GDK_STRNIL((const char *) t) : ((const blob *) t)->nitems != ~(size_t) 0;
+			if (valid) {
+				size_t len = is_str ? strlen((const char *) t) : ((const blob *) t)->nitems;
+				memcpy(data + total, is_str ? t : (const void *) ((const blob *) t)->data, len);
+				total += len;
+			} else {
+				null_count++;
+			}
+			if (validity) {
+				validity[i / 8] |= (unsigned char) (valid << (i % 8));
+			}
+			offsets[++i] = (int32_t) total;
+		}
+	} else {
+		// same layout, share the tail heap
+		switch (ATOMstorage(tpe)) {
+		case TYPE_bte:
+			strcpy(format, "c");
+			if (validity)
+				ARROW_VALIDITY(bte, ARROW_ISNIL_bte);
+			break;
+		case TYPE_sht:
+			strcpy(format, "s");
+			if (validity)
+				ARROW_VALIDITY(sht, ARROW_ISNIL_sht);
+			break;
+		case TYPE_int:
+			strcpy(format, "i");
+			if (validity)
+				ARROW_VALIDITY(int, ARROW_ISNIL_int);
+			break;
+		case TYPE_lng:
+			strcpy(format, "l");
+			if (validity)
+				ARROW_VALIDITY(lng, ARROW_ISNIL_lng);
+			break;
+		case TYPE_oid:
+			strcpy(format, "L");
+			if (validity)
+				ARROW_VALIDITY(oid, ARROW_ISNIL_oid);
+			break;
+		case TYPE_flt:
+			strcpy(format, "f");
+			if (validity)
+				ARROW_VALIDITY(flt, ARROW_ISNIL_flt);
+			break;
+		case TYPE_dbl:
+			strcpy(format, "g");
+			if (validity)
+				ARROW_VALIDITY(dbl, ARROW_ISNIL_dbl);
+			break;
+		default:
+			goto unsupported;
+		}
+		priv->buffers[1] = Tloc(b, 0);
+	}
+	if (priv->buffers[1] == Tloc(b, 0)) {
+		// keep the BAT alive until the consumer releases the array
+		priv->bid = b->batCacheid;
+		BBPretain(priv->bid);
+	} else {
+		BBPunfix(b->batCacheid);
+	}
+	if (null_count == 0) {
+		GDKfree(priv->owned[0]);
+		priv->owned[0] = NULL;
+		priv->buffers[0] = NULL;
+	}
+	array->null_count = null_count;
+
+	schema->format = GDKstrdup(format);
+	schema->name = GDKstrdup(col->name);
+	schema->flags = ARROW_FLAG_NULLABLE;
+	schema->release = arrow_release_schema;
+	if (!schema->format || !schema->name) {
+		return GDKstrdup("Malloc fail");
+	}
+	return MAL_SUCCEED;
+unsupported:
+	BBPunfix(b->batCacheid);
+	arrow_release_array(array);
+	return GDKstrdup("Unsupported column type for Arrow export");
+alloc_fail:
+	BBPunfix(b->batCacheid);
+	arrow_release_array(array);
+	return GDKstrdup("Malloc fail");
+}
+
+char* monetdb_result_to_arrow(monetdb_result* result, struct ArrowSchema* schema, struct ArrowArray* array) {
+	monetdb_result_internal* res = (monetdb_result_internal *) result;
+	res_table *t;
+	str msg = MAL_SUCCEED;
+	int i;
+
+	if (!result || !schema || !array || !res->monetdb_resultset) {
+		return GDKstrdup("Invalid parameters");
+	}
+	t = res->monetdb_resultset;
+	memset(schema, 0, sizeof(struct ArrowSchema));
+	memset(array, 0, sizeof(struct ArrowArray));
+	schema->release = arrow_release_schema;
+	array->release = arrow_release_array;
+	schema->format = GDKstrdup("+s");
+	schema->name = GDKstrdup("");
+	schema->children = GDKzalloc(sizeof(struct ArrowSchema*) * MAX(t->nr_cols, 1));
+	array->private_data = GDKzalloc(sizeof(arrow_private));
+	array->children = GDKzalloc(sizeof(struct ArrowArray*) * MAX(t->nr_cols, 1));
+	if (!schema->format || !schema->name || !schema->children || !array->private_data || !array->children) {
+		msg = GDKstrdup("Malloc fail");
+		goto cleanup;
+	}
+	array->buffers = ((arrow_private *) array->private_data)->buffers;
+	array->n_buffers = 1;
+	array->length = (int64_t) result->nrows;
+	for (i = 0; i < t->nr_cols; i++) {
+		schema->children[i] = GDKzalloc(sizeof(struct ArrowSchema));
+		array->children[i] = GDKzalloc(sizeof(struct ArrowArray));
+		if (schema->children[i]) {
+			schema->n_children++;
+		}
+		if (array->children[i]) {
+			array->n_children++;
+		}
+		if (!schema->children[i] || !array->children[i]) {
+			msg = GDKstrdup("Malloc fail");
+			goto cleanup;
+		}
+		if ((msg = arrow_export_column(t->cols + i, schema->children[i], array->children[i])) != MAL_SUCCEED) {
+			goto cleanup;
+		}
+	}
+	return MAL_SUCCEED;
+cleanup:
+	arrow_release_schema(schema);
+	arrow_release_array(array);
+	return msg;
+}
+
+/* build a BAT of the natural GDK type of an Arrow column, nils where the
+ * validity bitmap says so */
+#define ARROW_IMPORT(TPE, CONV)                                                \
+	do {                                                                       \
+		TPE *dst;                                                              \
+		if ((b = COLnew(0, TYPE_##TPE, cnt, TRANSIENT)) == NULL)               \
+			return GDKstrdup("Malloc fail");                                   \
+		dst = (TPE *) Tloc(b, 0);                                              \
+		for (i = 0; i < cnt; i++) {                                            \
+			BUN k = i + offset;                                                \
+			dst[i] = (validity && !(validity[k / 8] & (1 << (k % 8)))) ?       \
+				TPE##_nil : (TPE) (CONV);                                      \
+		}                                                                      \
+	} while (0)
+
+/* import the rows [start, start + cnt) of a child of a struct array, start
+ * and cnt are the offset and length of the parent */
+static str arrow_import_column(struct ArrowSchema *schema, struct ArrowArray *array, BUN start, BUN cnt, sql_column *col, BAT **ret) {
+	const char *format = schema->format;
+	const unsigned char *validity = array->null_count != 0 ? array->buffers[0] : NULL;
+	BUN i, offset = (BUN) array->offset + start;
+	int scale = -1;
+	BAT *b = NULL;
+
+	if (strcmp(format, "c") == 0) {
+		const int8_t *vals = array->buffers[1];
+		ARROW_IMPORT(bte, vals[k]);
+	} else if (strcmp(format, "s") == 0) {
+		const int16_t *vals = array->buffers[1];
+		ARROW_IMPORT(sht, vals[k]);
+	} else if (strcmp(format, "i") == 0) {
+		const int32_t *vals = array->buffers[1];
+		ARROW_IMPORT(int, vals[k]);
+	} else if (strcmp(format, "l") == 0) {
+		const int64_t *vals = array->buffers[1];
+		ARROW_IMPORT(lng, vals[k]);
+	} else if (strcmp(format, "f") == 0) {
+		const float *vals = array->buffers[1];
+		ARROW_IMPORT(flt, vals[k]);
+	} else if (strcmp(format, "g") == 0) {
+		const double *vals = array->buffers[1];
+		ARROW_IMPORT(dbl, vals[k]);
+	} else if (strcmp(format, "b") == 0) {
+		const unsigned char *vals = array->buffers[1];
+		ARROW_IMPORT(bit, (vals[k / 8] >> (k % 8)) & 1);
+	} else if (strncmp(format, "d:", 2) == 0) {
+		const int64_t *vals = array->buffers[1];
+		int precision;
+		if (sscanf(format + 2, "%d,%d", &precision, &scale) != 2) {
+			return GDKstrdup("Invalid Arrow decimal format");
+		}
+		// only the low 64 bits are representable
+		ARROW_IMPORT(lng, vals[2 * k]);
+	} else if (strcmp(format, "tdD") == 0) {
+		const int32_t *vals = array->buffers[1];
+		date epoch = MTIMEtodate(1, 1, 1970);
+		ARROW_IMPORT(date, vals[k] + epoch);
+	} else if (strcmp(format, "ttm") == 0) {
+		const int32_t *vals = array->buffers[1];
+		ARROW_IMPORT(daytime, vals[k]);
+	} else if (strncmp(format, "tsm:", 4) == 0) {
+		const int64_t *vals = array->buffers[1];
+		date epoch = MTIMEtodate(1, 1, 1970);
+		timestamp *dst;
+		if ((b = COLnew(0, TYPE_timestamp, cnt, TRANSIENT)) == NULL) {
+			return GDKstrdup("Malloc fail");
+		}
+		dst = (timestamp *) Tloc(b, 0);
+		for (i = 0; i < cnt; i++) {
+			BUN k = i + offset;
+			if (validity && !(validity[k / 8] & (1 << (k % 8)))) {
+				dst[i] = *timestamp_nil;
+			} else {
+				int64_t ms = vals[k], day = ms / (24 * 60 * 60 * 1000);
+				ms -= day * 24 * 60 * 60 * 1000;
+				if (ms < 0) {
+					ms += 24 * 60 * 60 * 1000;
+					day--;
+				}
+				dst[i].days = (date) (day + epoch);
+				dst[i].msecs = (daytime) ms;
+			}
+		}
+	} else if (strcmp(format, "u") == 0) {
+		const int32_t *offsets = array->buffers[1];
+		const char *data = array->buffers[2];
+		char *buf = NULL;
+		size_t buflen = 0;
+		if ((b = COLnew(0, TYPE_str, cnt, TRANSIENT)) == NULL) {
+			return GDKstrdup("Malloc fail");
+		}
+		for (i = 0; i < cnt; i++) {
+			BUN k = i + offset;
+			const char *v = str_nil;
+			if (!validity || (validity[k / 8] & (1 << (k % 8)))) {
+				size_t len = (size_t) (offsets[k + 1] - offsets[k]);
+				if (len + 1 > buflen) {
+					GDKfree(buf);
+					buflen = MAX(len + 1, 2 * buflen);
+					if ((buf = GDKmalloc(buflen)) == NULL) {
+						BBPreclaim(b);
+						return GDKstrdup("Malloc fail");
+					}
+				}
+				memcpy(buf, data + offsets[k], len);
+				buf[len] = '\0';
+				v = buf;
+			}
+			if (BUNappend(b, v, FALSE) != GDK_SUCCEED) {
+				GDKfree(buf);
+				BBPreclaim(b);
+				return GDKstrdup("Malloc fail");
+			}
+		}
+		GDKfree(buf);
+	} else {
+		return GDKstrdup("Unsupported Arrow format");
+	}
+	if (ATOMstorage(b->ttype) != TYPE_str) {
+		BATsetcount(b, cnt);
+		b->tnonil = validity == NULL;
+		b->tnil = 0;
+		b->tsorted = b->trevsorted = cnt <= 1;
+		b->tkey = cnt <= 1;
+	}
+
+	if (col->type.type->eclass == EC_DEC && scale != (int) col->type.scale) {
+		BBPreclaim(b);
+		return GDKstrdup("Arrow decimal scale does not match the column");
+	}
+	if (b->ttype != col->type.type->localtype) {
+		BAT *c = BATconvert(b, NULL, col->type.type->localtype, 1);
+		BBPreclaim(b);
+		if (!c) {
+			return GDKstrdup("Cannot convert Arrow column to the column type");
+		}
+		b = c;
+	}
+	*ret = b;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_append_arrow(monetdb_connection conn, const char* schema_name, const char* table_name, struct ArrowSchema* schema, struct ArrowArray* array) {
+	Client c = (Client) conn;
+	append_data *data = NULL;
+	BAT **bats = NULL;
+	str msg = MAL_SUCCEED;
+	sql_schema *s;
+	sql_table *t;
+	mvc *m;
+	node *n;
+	int i, ncols;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!table_name || !schema || !array || strcmp(schema->format, "+s") != 0 || schema->n_children != array->n_children) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	if ((msg = getSQLContext(c, NULL, &m, NULL)) != MAL_SUCCEED) {
+		return msg;
+	}
+	SQLtrans(m);
+	if ((s = mvc_bind_schema(m, schema_name)) == NULL || (t = mvc_bind_table(m, s, table_name)) == NULL) {
+		return GDKstrdup("Can't find table.");
+	}
+	ncols = list_length(t->columns.set);
+	if (ncols != schema->n_children) {
+		return GDKstrdup("Incorrect number of columns.");
+	}
+	data = GDKzalloc(sizeof(append_data) * ncols);
+	bats = GDKzalloc(sizeof(BAT*) * ncols);
+	if (!data || !bats) {
+		msg = GDKstrdup("Malloc fail");
+		goto cleanup;
+	}
+	for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
+		sql_column *col = n->data;
+		if (array->children[i]->length < array->length + array->offset) {
+			msg = GDKstrdup("Arrow column too short");
+			goto cleanup;
+		}
+		if ((msg = arrow_import_column(schema->children[i], array->children[i], (BUN) array->offset, (BUN) array->length, col, &bats[i])) != MAL_SUCCEED) {
+			goto cleanup;
+		}
+		data[i].colname = col->base.name;
+		data[i].batid = (size_t) bats[i]->batCacheid;
+	}
+	// the append plan takes over the references
+	for (i = 0; i < ncols; i++) {
+		BBPkeepref(bats[i]->batCacheid);
+		bats[i] = NULL;
+	}
+	msg = monetdb_append(conn, schema_name, table_name, data, ncols);
+cleanup:
+	if (bats) {
+		for (i = 0; i < ncols; i++) {
+			if (bats[i]) {
+				BBPreclaim(bats[i]);
+			}
+		}
+	}
+	GDKfree(bats);
+	GDKfree(data);
+	return msg;
+}
+
+/*
+ * Columnar append from plain C arrays
+ * Input columns use the same layout as monetdb_result_fetch returns, entries
+ * equal to the null_value of the column are stored as nil. For plain tables
+ * without keys, indices or triggers the BATs go straight into the column
+ * deltas; no plan is generated, optimized or interpreted.
+ */
+#define APPEND_FIXED(TPE, GDKTPE)                                              \
+	do {                                                                       \
+		monetdb_column_##TPE *in = (monetdb_column_##TPE *) column;            \
+		GDKTPE *dst;                                                           \
+		size_t i;                                                              \
+		if ((b = COLnew(0, TYPE_##GDKTPE, in->count, TRANSIENT)) == NULL)      \
+			return GDKstrdup("Malloc fail");                                   \
+		dst = (GDKTPE *) Tloc(b, 0);                                           \
+		if (in->null_value == (TPE) GDKTPE##_nil) {                            \
+			memcpy(dst, in->data, in->count * sizeof(GDKTPE));                 \
+			for (i = 0; i < in->count && !nils; i++)                           \
+				nils = dst[i] == GDKTPE##_nil;                                 \
+		} else {                                                               \
+			for (i = 0; i < in->count; i++) {                                  \
+				if (in->data[i] == in->null_value) {                           \
+					dst[i] = GDKTPE##_nil;                                     \
+					nils = 1;                                                  \
+				} else {                                                       \
+					dst[i] = (GDKTPE) in->data[i];                             \
+				}                                                              \
+			}                                                                  \
+		}                                                                      \
+	} while (0)
+
+#define APPEND_TEMPORAL(TPE, GDKTPE)                                           \
+	do {                                                                       \
+		monetdb_column_##TPE *in = (monetdb_column_##TPE *) column;            \
+		GDKTPE *dst;                                                           \
+		size_t i;                                                              \
+		if ((b = COLnew(0, TYPE_##GDKTPE, in->count, TRANSIENT)) == NULL)      \
+			return GDKstrdup("Malloc fail");                                   \
+		dst = (GDKTPE *) Tloc(b, 0);                                           \
+		for (i = 0; i < in->count; i++) {                                      \
+			dst[i] = TPE##_from_data(&in->data[i]);                            \
+			if (TPE##_is_null(in->data[i])) {                                  \
+				dst[i] = *(GDKTPE *) ATOMnilptr(TYPE_##GDKTPE);                \
+				nils = 1;                                                      \
+			}                                                                  \
+		}                                                                      \
+	} while (0)
+
+static str monetdb_append_column_bat(monetdb_column *column, sql_column *col, BAT **ret) {
+	BAT *b = NULL;
+	int nils = 0;
+	size_t i;
+
+	switch (column->type) {
+	case monetdb_int8_t:
+		APPEND_FIXED(int8_t, bte);
+		break;
+	case monetdb_int16_t:
+		APPEND_FIXED(int16_t, sht);
+		break;
+	case monetdb_int32_t:
+		APPEND_FIXED(int32_t, int);
+		break;
+	case monetdb_int64_t:
+		APPEND_FIXED(int64_t, lng);
+		break;
+	case monetdb_size_t:
+		APPEND_FIXED(size_t, oid);
+		break;
+	case monetdb_float:
+		APPEND_FIXED(float, flt);
+		break;
+	case monetdb_double:
+		APPEND_FIXED(double, dbl);
+		break;
+	case monetdb_date:
+		APPEND_TEMPORAL(date, date);
+		break;
+	case monetdb_time:
+		APPEND_TEMPORAL(time, daytime);
+		break;
+	case monetdb_timestamp:
+		APPEND_TEMPORAL(timestamp, timestamp);
+		break;
+	case monetdb_str: {
+		monetdb_column_str *in = (monetdb_column_str *) column;
+		if ((b = COLnew(0, TYPE_str, in->count, TRANSIENT)) == NULL) {
+			return GDKstrdup("Malloc fail");
+		}
+		for (i = 0; i < in->count; i++) {
+			int isnil = str_is_null(in->data[i]) || (in->null_value && strcmp(in->data[i], in->null_value) == 0);
+			nils |= isnil;
+			if (BUNappend(b, isnil ? str_nil : in->data[i], FALSE) != GDK_SUCCEED) {
+				BBPreclaim(b);
+				return GDKstrdup("Malloc fail");
+			}
+		}
+		break;
+	}
+	case monetdb_blob: {
+		monetdb_column_blob *in = (monetdb_column_blob *) column;
+		int tpe = col->type.type->localtype;
+		blob *buf = NULL;
+		size_t buflen = 0;
+		if (ATOMstorage(tpe) == TYPE_str || ATOMvarsized(tpe) == 0 || (b = COLnew(0, tpe, in->count, TRANSIENT)) == NULL) {
+			return GDKstrdup(b ? "Malloc fail" : "Column is not a blob column");
+		}
+		for (i = 0; i < in->count; i++) {
+			int isnil = blob_is_null(in->data[i]);
+			size_t len = isnil ? 0 : in->data[i].size;
+			if (blobsize(len) > buflen) {
+				GDKfree(buf);
+				buflen = blobsize(len);
+				if ((buf = GDKmalloc(buflen)) == NULL) {
+					BBPreclaim(b);
+					return GDKstrdup("Malloc fail");
+				}
+			}
+			buf->nitems = isnil ? ~(size_t) 0 : len;
+			if (len > 0) {
+				memcpy(buf->data, in->data[i].data, len);
+			}
+			nils |= isnil;
+			if (BUNappend(b, buf, FALSE) != GDK_SUCCEED) {
+				GDKfree(buf);
+				BBPreclaim(b);
+				return GDKstrdup("Malloc fail");
+			}
+		}
+		GDKfree(buf);
+		break;
+	}
+	default:
+		return GDKstrdup("Unsupported column type");
+	}
+	if (!ATOMvarsized(b->ttype)) {
+		BATsetcount(b, column->count);
+		b->tsorted = b->trevsorted = b->tkey = BATcount(b) <= 1;
+	}
+	b->tnonil = !nils;
+	b->tnil = nils;
+
+	if (nils && !col->null) {
+		BBPreclaim(b);
+		return createException(SQL, "monetdb.append", "NOT NULL constraint violated for column %s", col->base.name);
+	}
+	if (b->ttype != col->type.type->localtype) {
+		BAT *c = BATconvert(b, NULL, col->type.type->localtype, 1);
+		BBPreclaim(b);
+		if (!c) {
+			return createException(SQL, "monetdb.append", "Cannot convert input to the type of column %s", col->base.name);
+		}
+		b = c;
+	}
+	*ret = b;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_append_columns(monetdb_connection conn, const char* schema_name, const char* table_name, monetdb_column** input, size_t column_count) {
+	Client c = (Client) conn;
+	append_data *data = NULL;
+	BAT **bats = NULL;
+	str msg = MAL_SUCCEED;
+	sql_schema *s;
+	sql_table *t;
+	mvc *m;
+	node *n;
+	size_t i, count;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (!table_name || !input || column_count < 1) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	if ((msg = getSQLContext(c, NULL, &m, NULL)) != MAL_SUCCEED) {
+		return msg;
+	}
+	if (m->session->status < 0 && m->session->auto_commit == 0) {
+		return GDKstrdup("Current transaction is aborted (please ROLLBACK)");
+	}
+	SQLtrans(m);
+	if ((s = mvc_bind_schema(m, schema_name)) == NULL || (t = mvc_bind_table(m, s, table_name)) == NULL) {
+		return GDKstrdup("Can't find table.");
+	}
+	if (column_count != (size_t) list_length(t->columns.set)) {
+		return GDKstrdup("Incorrect number of columns.");
+	}
+	count = input[0]->count;
+	for (i = 0; i < column_count; i++) {
+		if (!input[i] || input[i]->count != count) {
+			return GDKstrdup("All columns need to have the same length");
+		}
+	}
+	bats = GDKzalloc(sizeof(BAT*) * column_count);
+	if (!bats) {
+		return GDKstrdup("Malloc fail");
+	}
+	for (i = 0, n = t->columns.set->h; i < column_count && n; i++, n = n->next) {
+		if ((msg = monetdb_append_column_bat(input[i], n->data, &bats[i])) != MAL_SUCCEED) {
+			goto cleanup;
+		}
+	}
+
+	if (isTable(t) && list_empty(t->idxs.set) && list_empty(t->keys.set) && list_empty(t->triggers.set)) {
+		// nothing to derive or check, append to the column deltas directly
+		for (i = 0, n = t->columns.set->h; i < column_count && n; i++, n = n->next) {
+			if (store_funcs.append_col(m->session->tr, n->data, bats[i], TYPE_bat) != LOG_OK) {
+				msg = GDKstrdup("Append failed");
+				m->session->status = -1;
+				break;
+			}
+		}
+		if (!SQLautocommit(c, m) && !msg) {
+			msg = GDKstrdup("Cannot COMMIT/ROLLBACK without a valid transaction.");
+		}
+	} else {
+		// keys and indices are maintained by the generated insert plan
+		if ((data = GDKzalloc(sizeof(append_data) * column_count)) == NULL) {
+			msg = GDKstrdup("Malloc fail");
+			goto cleanup;
+		}
+		for (i = 0, n = t->columns.set->h; i < column_count && n; i++, n = n->next) {
+			data[i].colname = ((sql_column *) n->data)->base.name;
+			data[i].batid = (size_t) bats[i]->batCacheid;
+			BBPkeepref(bats[i]->batCacheid);
+			bats[i] = NULL;
+		}
+		msg = monetdb_append(conn, schema_name, table_name, data, (int) column_count);
+	}
+cleanup:
+	for (i = 0; i < column_count; i++) {
+		if (bats[i]) {
+			BBPreclaim(bats[i]);
+		}
+	}
+	GDKfree(bats);
+	GDKfree(data);
+	return msg;
+}
+
 void data_from_date(date d, monetdb_data_date *ptr)
 {
 	int day, month, year;
@@ -82,6 +82,65 @@ typedef struct {
 
 typedef void* monetdb_connection;
 
+/* Apache Arrow C data interface, the definitions are part of the stable Arrow ABI */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+	const char* format;
+	const char* name;
+	const char* metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema** children;
+	struct ArrowSchema* dictionary;
+	void (*release)(struct ArrowSchema*);
+	void* private_data;
+};
+
+struct ArrowArray {
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void** buffers;
+	struct ArrowArray** children;
+	struct ArrowArray* dictionary;
+	void (*release)(struct ArrowArray*);
+	void* private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
+/* read-only view on a result column, valid until monetdb_cleanup_result */
+typedef struct {
+	monetdb_types type;
+	size_t count;
+	const void *data;       /* NULL if not materialized: dense, or all nil otherwise */
+	char dense;             /* row i holds seqbase + i */
+	size_t seqbase;
+	const void *null_value; /* nil sentinel of the column type */
+	double scale;
+	/* string columns: data holds an offset per row into heap */
+	const char *heap;
+	unsigned char offset_width; /* 1, 2, 4 or 8 bytes per offset */
+	size_t offset_base;         /* added to every offset */
+	/* duplicate eliminated string columns: row i is dict[codes[i]] */
+	size_t dict_count;
+	const char **dict;
+	const uint32_t *codes;
+} monetdb_column_view;
+
+typedef struct {
+	size_t nparam;
+	monetdb_types *type;
+} monetdb_statement;
+
 #define DEFAULT_STRUCT_DEFINITION(ctype, typename)                              \
 	typedef struct                                          \
 	{                                                                          \
@@ -109,6 +168,9 @@ DEFAULT_STRUCT_DEFINITION(monetdb_data_date, date);
 DEFAULT_STRUCT_DEFINITION(monetdb_data_time, time);
 DEFAULT_STRUCT_DEFINITION(monetdb_data_timestamp, timestamp);
 
+#define DEFAULT_BIND_DEFINITION(ctype, typename)                                \
+	embedded_export char* monetdb_bind_##typename(monetdb_statement *stmt, size_t parameter_nr, ctype data)
+
 
 embedded_export monetdb_connection monetdb_connect(void);
 embedded_export void  monetdb_disconnect(monetdb_connection conn);
@@ -118,9 +180,70 @@ embedded_export int   monetdb_is_initialized(void);
 embedded_export char* monetdb_set_autocommit(monetdb_connection conn, char val);
 embedded_export char* monetdb_query(monetdb_connection conn, char* query, char execute, monetdb_result** result, long *affected_rows, long* prepare_id);
 embedded_export monetdb_column* monetdb_result_fetch(monetdb_result* result, size_t column_index);
+// the chunk belongs to the result, it is valid until the next call or until the result is cleaned up
+// and must not be passed to monetdb_cleanup_result
+embedded_export char* monetdb_result_next_chunk(monetdb_result* result, size_t max_rows, monetdb_result** chunk); // *chunk is NULL at the end
+embedded_export monetdb_column_view* monetdb_result_fetch_view(monetdb_result* result, size_t column_index);
+embedded_export const char* monetdb_column_view_str(const monetdb_column_view* view, size_t row); // NULL for nil
 embedded_export void* monetdb_result_fetch_rawcol(monetdb_result* result, size_t column_index); // actually a res_col
 
+// asynchronous queries, a connection can have one query in flight
+typedef struct monetdb_query_handle monetdb_query_handle;
+// called on a worker thread, takes ownership of error and result
+typedef void (*monetdb_query_callback)(monetdb_connection conn, void* userdata, char* error, monetdb_result* result, long affected_rows);
+embedded_export char* monetdb_query_async(monetdb_connection conn, char* query, monetdb_query_callback callback, void* userdata);
+embedded_export char* monetdb_query_submit(monetdb_connection conn, char* query, monetdb_query_handle** handle);
+embedded_export int   monetdb_query_poll(monetdb_query_handle* handle); // non-zero once the query has finished
+embedded_export char* monetdb_query_collect(monetdb_query_handle* handle, monetdb_result** result, long* affected_rows); // waits, frees the handle
+
+// aborts the query running (or queued) on the connection, it fails and is rolled back
+embedded_export char* monetdb_interrupt(monetdb_connection conn);
+embedded_export char* monetdb_set_query_timeout(monetdb_connection conn, size_t timeout_ms); // 0 disables the timeout
+
+// memory budgets, 0 removes the budget
+// a query whose intermediates outgrow the budget of its connection is aborted
+embedded_export char* monetdb_set_query_memory_limit(monetdb_connection conn, size_t bytes);
+// beyond the global budget large columns are moved to memory mapped files (with a database directory), other allocations fail
+embedded_export char* monetdb_set_memory_limit(size_t bytes);
+
+// locality and memory admission of the parallel workers since startup
+typedef struct {
+	int64_t executed;   // instructions run by the workers
+	int64_t core_local; // whose columns were last touched by the same worker
+	int64_t node_local; // by another worker on the same NUMA node
+	int64_t remote;     // by a worker on another NUMA node
+	int64_t routed;     // handed to the worker that touched their columns
+	int64_t stolen;     // taken from the queue of another worker
+	int64_t admitted;   // reserved memory for their estimated result before running
+	int64_t deferred;   // held back until other instructions freed memory
+	int64_t forced;     // ran beyond the memory limit, nothing else could free memory
+	int numa_nodes;     // the workers are bound to, 1 when they are not bound
+} monetdb_dataflow_stats;
+embedded_export char* monetdb_dataflow_statistics(monetdb_dataflow_stats* stats);
+
+// prepared statements, parameters are bound by position and the compiled plan is re-used for every execution
+embedded_export char* monetdb_prepare(monetdb_connection conn, char* query, monetdb_statement **stmt);
+DEFAULT_BIND_DEFINITION(int8_t, int8_t);
+DEFAULT_BIND_DEFINITION(int16_t, int16_t);
+DEFAULT_BIND_DEFINITION(int32_t, int32_t);
+DEFAULT_BIND_DEFINITION(int64_t, int64_t);
+DEFAULT_BIND_DEFINITION(size_t, size_t);
+DEFAULT_BIND_DEFINITION(float, float);
+DEFAULT_BIND_DEFINITION(double, double);
+DEFAULT_BIND_DEFINITION(const char *, str);
+DEFAULT_BIND_DEFINITION(monetdb_data_date, date);
+DEFAULT_BIND_DEFINITION(monetdb_data_time, time);
+DEFAULT_BIND_DEFINITION(monetdb_data_timestamp, timestamp);
+embedded_export char* monetdb_bind_null(monetdb_statement *stmt, size_t parameter_nr);
+embedded_export char* monetdb_execute(monetdb_statement *stmt, monetdb_result **result, long *affected_rows);
+embedded_export void  monetdb_cleanup_statement(monetdb_connection conn, monetdb_statement *stmt);
+
 embedded_export char* monetdb_append(monetdb_connection conn, const char* schema, const char* table, append_data *data, int ncols);
+// columns in the layout of monetdb_result_fetch, entries equal to null_value are appended as NULL
+embedded_export char* monetdb_append_columns(monetdb_connection conn, const char* schema_name, const char* table_name, monetdb_column** input, size_t column_count);
+// Arrow record batches (struct arrays), exported arrays share the fixed-width result columns
+embedded_export char* monetdb_result_to_arrow(monetdb_result* result, struct ArrowSchema* schema, struct ArrowArray* array);
+embedded_export char* monetdb_append_arrow(monetdb_connection conn, const char* schema_name, const char* table_name, struct ArrowSchema* schema, struct ArrowArray* array);
 embedded_export void  monetdb_cleanup_result(monetdb_connection conn, monetdb_result* result);
 char* monetdb_get_columns(monetdb_connection conn, const char* schema_name, const char *table_name, int *column_count, char ***column_names, int **column_types);
 
@@ -1,79 +1,81 @@
 unsigned char mal_init_inline_arr[] = 
-{120,218,236,189,125,115,228,54,146,62,248,183,244,41,56,190,248,69,151,198,37,77,75,222,189,189,179,166,29,215,111,246,244,110,191,77,119,187,119,239,60,14,5,171,138,146,56,174,34,203,36,75,45,249,211,95,38,192,23,144,4,72,0,4,64,244,221,76,76,180,85,85,0,50,241,32,51,31,188,36,193,227,227,193,255,237,210,205,97,27,5,187,93,88,220,94,30,31,175,83,248,43,217,4,225,58,205,23,247,223,95,111,139,19,252,39,56,14,55,155,44,202,243,224,205,211,79,127,59,36,97,246,112,245,244,249,187,143,240,211,101,183,206,102,181,61,193,127,68,117,224,39,82,37,74,138,224,155,79,183,81,89,239,36,184,62,36,235,34,78,147,96,29,110,215,135,109,88,68,121,80,224,239,217,58,128,34,113,18,5,233,117,112,191,132,47,195,34,136,233,143,199,71,119,225,246,16,5,95,110,211,60,170,138,193,111,247,103,1,182,77,127,132,207,89,84,28,178,36,218,4,113,18,100,225,38,14,147,60,64,165,225,167,227,35,236,124,4,255,196,32,121,251,16,108,162,235,24,139,22,105,176,138,224,255,197,151,40,74,130,199,164,252,251,87,193,34,78,214,219,67,30,223,69,39,103,223,176,152,129,236,18,179,32,16,162,246,241,213,219,54,106,180,22,162,6,181,68,184,65,173,62,110,164,230,48,110,2,212,40,44,199,71,20,53,13,204,58,136,29,31,241,49,59,125,255,234,47,23,20,56,242,167,24,187,34,108,176,11,6,224,251,244,180,3,31,173,72,225,11,6,16,132,138,125,4,73,229,97,4,161,200,13,86,24,3,177,42,103,15,199,210,254,70,80,188,160,48,46,31,4,206,187,138,107,60,46,122,72,94,80,40,161,50,223,139,217,202,92,52,161,129,229,131,52,160,248,85,241,37,13,142,131,242,127,119,97,22,135,171,45,148,190,39,189,125,56,11,130,87,4,211,60,222,197,219,48,67,92,170,54,227,228,166,106,244,248,136,105,245,33,248,11,14,85,116,191,142,246,5,29,49,44,150,199,55,128,59,252,190,74,139,91,168,116,115,64,213,97,36,178,168,81,224,144,83,236,55,81,17,101,59,244,11,172,250,251,33,220,100,97,163,51,224,113,216,22,160,91,107,152,143,143,228,7,154,63,204,181,26,35,227,93,143,89,19,165,161,210,145,216,109,186,161,186,137,212,101,61,129,215,240,194,117,55,90,211,78,211,241,109,133,233,47,183,17,64,123,143,189,191,1,213,19,68,165,238,97,9,15,245,20,218,68,131,100,109,246,231,4,131,243,150,145,179,81,118,168,207,221,64,203,198,217,161,62,243,66,109,55,210,186,238,115,43,58,14,244,185,27,29,91,193,113,160,207,188,224,216,141,141,108,159,91,65,177,238,31,175,243,101,159,217,206,172,211,66,210,104,63,117,140,182,144,52,218,79,28,163,45,132,157,121,158,78,236,78,126,43,67,93,224,75,127,235,58,225,173,12,117,97,69,158,23,222,46,152,14,181,122,116,251,176,143,178,85,186,141,215,93,235,140,215,183,52,84,85,1,168,19,151,194,60,88,68,247,123,196,234,219,0,255,56,189,63,57,129,120,122,209,117,65,169,46,131,43,253,173,235,131,82,93,198,138,60,39,228,119,153,244,153,237,116,175,203,245,152,66,223,199,123,126,42,238,57,88,138,84,207,193,161,254,214,245,68,169,158,99,69,158,43,182,122,46,24,235,246,84,69,106,176,233,128,96,63,169,53,182,231,19,165,181,203,116,248,195,211,23,175,158,190,109,179,76,83,125,180,219,101,245,94,207,171,38,216,41,69,154,220,69,89,129,3,121,147,69,48,85,136,19,96,209,218,49,131,70,253,178,128,140,250,47,94,254,244,225,229,203,182,250,77,245,81,245,203,234,61,245,171,38,120,234,87,19,4,162,126,89,176,165,62,177,70,137,56,249,242,127,222,183,244,166,245,198,227,36,212,235,41,92,122,0,215,210,40,85,129,113,69,193,2,63,175,194,156,124,172,157,43,9,161,112,184,13,182,233,13,204,227,138,219,93,126,2,189,140,203,41,21,86,217,167,95,162,140,216,103,203,206,160,130,84,79,95,191,251,169,213,83,90,111,188,167,80,175,215,83,82,87,208,211,94,71,184,42,159,63,102,44,107,64,229,243,199,93,165,73,205,202,168,6,148,62,127,204,83,27,107,11,20,199,33,57,61,127,204,83,188,150,15,99,208,90,34,240,116,47,231,249,239,223,253,119,75,
-117,90,181,89,32,240,148,111,170,246,116,39,213,91,203,3,190,125,221,139,172,230,161,205,66,191,103,197,162,234,195,208,68,240,239,31,218,19,137,178,34,237,193,208,76,16,42,246,89,8,43,11,13,39,77,78,147,232,6,34,236,29,196,174,52,45,250,134,179,94,201,105,253,252,89,71,235,178,226,168,214,88,177,63,93,88,13,104,189,62,172,186,218,54,82,163,120,91,171,59,52,187,121,249,234,117,91,93,90,113,124,118,3,21,251,234,98,229,150,186,233,33,217,224,170,240,176,255,18,102,240,87,105,26,73,4,203,183,188,192,32,26,221,68,89,11,233,235,112,149,203,104,240,227,211,103,253,200,77,42,223,139,103,27,240,115,186,61,20,140,213,146,221,168,42,20,94,111,83,178,64,61,221,167,160,90,144,28,118,43,48,225,182,37,64,153,52,99,176,21,65,251,227,235,119,239,62,180,176,173,106,142,133,16,82,179,223,53,82,155,139,238,38,253,146,140,226,187,15,11,88,28,39,193,245,46,221,80,245,151,101,28,108,247,224,249,155,23,176,158,127,243,238,5,174,188,195,237,101,183,34,198,145,50,12,182,59,208,169,216,209,30,43,119,54,25,210,221,254,80,109,49,100,48,193,137,147,13,13,24,155,248,46,222,224,62,193,125,176,122,128,240,113,124,196,91,122,221,195,140,47,9,254,28,60,84,235,183,164,218,226,249,253,144,22,113,53,165,130,73,210,195,18,22,249,8,22,9,78,20,169,63,162,44,69,184,194,132,107,133,164,120,29,112,161,132,200,143,202,192,249,225,221,207,111,95,180,167,81,101,11,52,238,54,45,136,66,47,105,161,63,147,34,173,36,203,96,119,82,155,114,57,242,52,210,238,130,253,54,92,71,245,208,103,241,205,109,209,88,116,105,225,155,104,29,239,128,26,137,93,95,6,241,53,212,3,176,210,93,12,99,187,89,98,229,199,101,67,103,240,211,26,80,89,225,38,89,29,21,113,174,134,66,161,65,28,159,155,24,166,66,219,232,186,224,10,56,107,228,239,130,221,1,12,17,26,19,0,29,231,9,172,88,55,165,65,173,98,174,47,189,250,248,246,233,219,54,48,180,30,55,54,102,104,31,215,116,9,248,40,73,139,211,240,148,122,242,163,70,175,197,219,240,237,201,50,160,1,103,139,51,34,232,69,246,5,248,11,181,107,148,139,147,235,90,57,12,9,92,229,94,189,253,177,171,28,214,227,41,119,122,78,85,203,162,61,52,67,118,178,106,140,155,229,78,2,19,255,184,0,195,238,151,222,195,202,144,148,110,10,161,166,143,249,29,32,69,162,49,120,127,124,245,246,213,167,151,29,135,165,53,71,1,78,162,24,5,87,234,48,189,72,210,44,8,187,3,64,112,167,62,44,68,255,248,248,144,228,225,53,174,150,171,21,9,252,179,224,141,0,254,2,95,54,170,151,65,34,36,117,210,93,25,194,177,81,110,155,119,212,49,133,13,135,217,141,76,219,245,20,5,127,89,228,81,180,41,219,189,75,227,77,187,225,188,167,50,194,22,135,219,248,15,186,107,73,154,96,80,255,18,227,190,103,128,141,182,167,81,219,174,176,94,39,202,50,154,210,200,240,224,146,179,44,196,74,223,199,11,178,207,220,18,183,143,251,88,129,211,239,246,105,86,224,54,44,187,142,165,38,64,6,187,125,164,181,10,11,70,206,46,206,50,96,189,213,247,240,245,47,223,135,201,195,213,197,175,104,199,248,9,160,253,181,233,239,179,255,122,78,11,55,58,124,96,215,219,81,184,57,165,5,64,163,240,134,112,127,24,60,123,250,9,86,69,95,82,242,59,216,198,246,176,75,242,206,110,237,38,218,70,224,9,84,135,128,40,113,254,235,50,184,69,5,74,93,170,111,89,109,104,181,70,155,23,228,115,240,236,231,183,224,43,27,192,0,2,47,210,27,145,92,58,68,116,191,190,13,147,27,164,62,50,16,219,16,98,39,212,96,161,23,168,179,41,63,35,42,163,90,93,237,14,219,34,238,233,70,190,221,111,137,146,203,32,191,141,175,201,110,61,124,202,97,6,55,170,68,53,48,66,169,96,75,61,153,104,95,240,57,139,129,121,90,4,28,17,58,226,195,14,132,69,191,16,139,92,29,146,171,56,33,109,176,22,65,190,40,55,67,227,109,51,13,76,19,58,52,228,220,225,22,183,88,210,93,196,140,141,134,110,203,224,58,205,214,17,6,93,41,53,175,72,113,103,202,102,241,166,241,163,37,86,100,
-117,28,208,56,44,250,192,190,143,50,208,126,87,9,195,158,147,145,37,166,83,78,17,242,104,157,130,62,232,114,100,243,164,32,44,147,229,133,1,117,229,176,110,52,239,98,61,93,255,230,64,110,191,143,32,92,6,113,91,191,3,251,49,16,43,73,171,95,125,201,194,125,163,30,253,178,60,183,128,73,20,157,218,30,112,86,22,183,78,18,37,100,51,80,141,171,65,138,90,85,38,103,130,249,168,58,48,47,149,133,134,196,79,44,31,111,32,210,6,219,24,34,105,62,93,71,37,244,136,186,42,16,42,41,221,211,185,23,117,70,212,3,31,26,211,142,134,156,102,108,153,99,231,34,92,223,46,138,2,103,29,75,140,61,251,235,120,27,125,159,23,217,0,44,164,82,159,160,67,152,69,126,33,142,69,0,216,68,73,94,134,51,186,7,15,177,175,244,65,122,162,83,60,236,35,242,211,33,143,242,122,190,217,252,142,154,16,149,219,115,29,108,136,158,226,145,2,95,98,112,112,88,152,192,226,153,50,49,148,169,27,203,163,236,174,179,82,33,106,65,207,22,249,31,223,111,147,27,118,26,210,230,58,90,172,233,230,243,44,34,71,233,180,155,191,224,156,112,121,71,12,30,187,12,61,203,81,195,71,249,31,143,218,43,163,228,58,13,22,193,170,29,150,23,244,35,224,12,99,222,252,125,194,170,128,53,153,216,150,193,204,10,98,90,8,0,172,182,212,226,96,173,141,204,142,5,51,156,145,193,204,47,92,165,135,162,156,18,197,73,240,11,12,86,22,175,96,129,190,36,70,240,107,64,139,50,107,187,87,69,213,86,78,130,229,62,75,247,81,6,43,239,58,100,98,91,25,132,205,108,115,22,176,93,187,137,138,143,216,231,94,239,16,88,182,39,101,65,6,203,42,51,129,230,16,172,139,3,204,37,9,126,140,200,77,148,175,179,120,95,164,25,181,204,124,137,44,121,27,149,199,250,187,125,134,83,101,50,11,35,7,17,48,248,5,99,72,236,242,26,155,220,69,187,52,123,8,246,56,107,36,162,112,210,29,172,86,251,51,80,239,61,124,139,42,46,78,218,135,48,240,19,248,89,184,134,21,218,162,221,73,236,99,208,233,100,85,148,63,121,93,31,178,12,191,4,144,211,53,29,45,170,7,168,190,11,239,171,125,42,220,227,223,70,36,61,226,164,158,222,246,148,34,115,220,79,224,65,29,240,49,156,129,37,245,52,171,203,7,124,229,136,51,86,89,33,232,170,116,22,93,43,176,196,3,171,102,241,79,203,83,141,187,186,125,72,183,196,38,42,170,31,84,12,11,243,53,202,224,151,36,220,213,90,49,115,123,62,44,121,84,252,87,244,208,193,99,25,192,138,132,51,163,104,233,1,53,127,139,152,81,251,24,21,84,135,71,240,245,163,202,35,30,120,248,128,113,61,66,9,143,206,130,87,73,89,30,63,47,91,1,237,183,40,75,162,45,141,85,57,68,173,164,216,62,4,43,48,131,223,0,208,28,189,45,37,189,134,137,224,58,132,112,8,189,219,28,246,91,178,188,168,27,194,249,245,3,218,121,7,141,206,70,76,216,7,161,187,103,64,161,255,175,168,103,168,184,5,71,246,1,40,167,209,30,214,147,86,154,174,115,72,226,223,129,77,22,208,213,147,46,254,79,215,224,138,57,127,8,6,57,165,174,203,108,95,64,103,49,225,8,151,82,52,78,28,246,132,79,67,82,16,70,37,190,139,183,241,77,132,135,172,196,199,227,156,216,68,240,6,197,29,31,5,217,47,184,92,76,147,237,195,175,101,102,15,241,189,47,1,126,5,17,13,153,137,180,117,6,133,195,95,40,97,214,229,171,194,88,142,134,28,42,31,11,127,249,37,139,139,8,227,112,167,101,12,160,104,44,196,189,73,187,160,81,137,27,214,38,161,123,69,82,144,66,146,197,244,14,125,255,55,140,226,97,25,103,75,149,151,101,132,198,22,243,195,42,143,0,116,128,133,234,144,7,215,56,42,116,153,159,4,17,89,16,239,160,39,16,198,80,40,235,71,132,9,138,60,218,94,119,29,149,59,90,39,60,47,237,142,77,105,45,52,120,147,209,192,33,46,167,19,85,200,165,195,65,226,6,142,98,6,97,190,31,44,62,146,126,173,163,103,97,30,245,52,105,109,187,148,60,194,148,111,244,249,41,42,211,204,202,95,233,241,40,78,255,201,244,7,219,25,138,28,113,254,49,205,96,33,191,24,243,154,170,32,39,98,149,187,105,216,99,198,
-89,128,51,163,44,218,180,119,35,105,27,31,34,152,154,228,145,180,204,178,188,180,232,140,150,7,75,103,148,144,155,125,202,76,57,165,39,155,76,120,120,139,225,188,75,88,56,49,167,177,1,199,169,19,20,176,6,51,204,184,99,26,226,1,43,217,124,34,236,128,155,255,212,237,59,150,197,19,198,231,160,103,207,222,39,61,57,57,216,16,132,231,130,30,251,54,242,68,212,67,25,182,23,250,10,113,223,104,141,209,222,137,24,185,189,94,141,243,79,89,152,228,120,94,50,30,252,153,194,151,108,31,6,154,224,232,95,151,110,186,240,38,252,45,170,131,78,81,253,126,22,212,1,233,248,104,149,2,175,135,73,149,33,83,238,161,229,104,192,56,115,39,17,99,179,131,137,45,224,70,39,73,184,53,130,135,74,16,87,40,25,108,58,206,11,203,254,28,138,75,118,189,41,221,234,251,80,35,156,206,55,197,5,189,223,215,5,218,150,18,222,69,139,100,23,141,73,128,98,23,188,106,37,139,118,122,133,63,51,211,151,144,24,18,25,131,52,200,97,2,13,180,176,68,132,161,218,23,64,115,155,134,155,114,103,120,19,195,196,6,6,168,158,101,84,35,85,205,4,94,189,35,85,146,8,195,124,152,97,217,247,48,128,57,6,152,106,81,6,211,150,227,35,220,99,166,89,193,16,248,235,157,232,187,56,101,50,144,139,116,71,210,226,118,59,208,4,166,85,69,10,70,253,167,63,181,44,25,192,253,27,76,243,187,211,237,94,151,105,177,238,250,12,250,141,139,4,232,117,118,128,101,5,134,224,132,153,205,116,156,246,21,93,68,228,18,194,170,162,125,129,73,181,22,201,101,164,66,56,127,0,134,218,4,139,213,121,59,84,172,46,186,251,227,125,38,32,85,153,57,82,148,23,205,80,225,14,120,61,221,200,169,20,160,192,36,45,218,193,49,139,14,93,222,89,110,162,109,179,16,22,198,127,82,19,68,48,182,118,123,184,190,222,70,77,228,71,233,228,136,17,207,26,35,52,62,50,155,37,155,1,245,1,24,117,108,76,7,63,36,221,13,99,144,240,38,220,75,168,215,93,178,87,202,237,88,98,122,17,101,228,224,19,212,195,89,0,252,182,71,35,197,169,1,41,79,188,4,103,11,27,28,50,178,85,131,179,252,244,116,21,157,210,253,238,214,121,205,46,202,110,34,220,218,89,132,204,110,210,138,209,77,176,159,80,87,100,194,5,126,69,6,173,189,87,84,102,165,165,73,212,222,71,40,144,206,215,133,142,244,86,229,70,131,87,213,215,163,90,148,255,171,146,8,64,200,89,18,125,193,141,163,161,13,252,231,111,94,0,188,80,240,82,88,115,73,214,192,229,209,215,180,54,96,65,190,172,194,238,192,22,178,146,82,102,27,100,246,155,68,109,136,246,155,162,221,30,22,160,53,165,210,37,57,153,255,227,220,224,20,151,227,121,64,137,146,30,74,181,178,69,80,159,28,236,126,27,45,112,203,125,96,146,71,21,161,101,57,177,181,222,221,11,3,90,166,220,171,136,138,174,184,125,8,171,90,116,243,94,108,109,62,156,157,157,117,4,215,181,56,178,97,157,28,147,249,87,190,37,59,62,233,93,185,80,37,115,134,242,145,18,186,51,72,54,252,49,10,110,112,26,65,246,191,54,1,204,135,97,93,117,38,169,40,140,124,140,156,71,173,32,33,22,58,128,88,221,202,69,79,115,146,202,115,10,152,17,189,219,106,175,178,244,55,146,220,142,68,141,19,118,76,190,32,114,91,81,17,245,140,59,92,181,42,162,222,204,129,234,82,149,188,28,172,159,223,22,147,234,195,223,147,234,131,51,76,170,127,189,157,38,127,179,218,142,212,103,70,242,54,130,181,0,146,70,116,79,38,117,56,142,89,176,238,206,0,200,60,245,190,34,255,238,42,129,213,2,247,26,217,129,108,109,153,182,213,128,162,151,99,109,144,193,156,216,6,25,208,137,109,144,65,157,216,6,25,216,137,109,144,193,29,110,131,187,155,81,78,150,91,123,209,245,236,142,14,110,61,199,59,99,243,30,170,196,135,112,123,19,173,178,144,93,138,194,116,104,191,122,88,220,196,155,214,9,212,26,154,108,121,66,159,185,159,190,254,169,172,221,59,7,232,29,183,144,130,160,35,204,180,138,248,58,174,207,66,90,59,133,229,195,79,248,0,93,179,233,79,22,151,69,188,139,154,28,139,42,147,33,142,216,229,103,85,190,105,131,8,37,96,181,227,213,53,
-64,181,232,173,132,75,218,97,29,14,122,136,101,249,59,192,20,111,154,42,149,150,11,95,122,50,30,4,175,174,97,94,27,228,7,88,67,226,25,58,113,203,234,97,207,224,221,171,23,167,73,188,61,251,38,96,117,138,138,245,109,87,169,251,50,253,131,124,110,105,133,165,81,83,174,102,173,188,83,148,15,43,160,123,12,241,181,178,100,76,30,7,127,125,18,220,7,127,13,86,103,107,152,19,183,56,18,86,63,255,132,153,87,71,161,59,242,199,119,236,44,225,187,150,61,148,213,112,68,26,213,126,196,125,229,122,160,74,126,134,241,202,49,97,167,149,240,67,107,35,217,145,188,63,214,30,73,202,33,43,54,24,213,162,197,211,239,233,119,52,159,48,78,246,7,152,73,147,135,67,72,42,35,249,162,251,252,228,158,183,81,205,161,88,144,136,133,251,99,177,191,125,200,201,102,9,254,204,223,154,33,150,209,29,118,118,18,20,23,172,28,82,188,47,168,90,98,61,130,154,143,130,116,189,62,100,244,200,233,172,179,118,221,246,199,20,150,219,95,170,105,224,45,128,81,253,189,141,81,56,126,71,255,11,99,21,179,211,204,110,40,160,141,159,179,199,20,248,5,217,33,110,156,54,39,52,69,119,87,58,57,39,113,78,159,162,75,200,38,241,43,50,68,113,94,173,206,78,177,141,104,67,103,150,233,161,16,254,74,13,44,78,142,143,234,246,219,113,163,14,156,68,2,214,16,169,116,124,196,60,124,201,44,33,201,86,58,224,137,112,49,15,224,226,22,198,54,198,224,179,71,235,187,139,182,15,199,71,183,49,121,68,57,42,78,202,103,130,75,221,201,190,55,38,213,224,230,105,69,201,141,104,26,67,64,208,241,17,40,71,4,97,30,100,188,93,210,135,57,112,13,27,226,121,75,142,11,104,226,77,49,217,70,13,22,209,245,117,37,30,55,254,33,124,29,125,91,39,114,158,208,134,113,48,75,189,150,108,196,140,171,231,86,119,123,122,200,7,197,223,130,47,31,149,61,143,25,61,113,2,155,224,164,16,115,238,112,95,125,25,28,146,45,90,3,168,253,132,168,138,122,147,191,142,143,182,241,19,98,96,248,47,74,127,242,24,154,126,10,182,65,158,139,104,159,225,52,207,74,95,215,109,33,146,101,99,4,251,109,140,173,81,37,0,0,242,224,54,52,141,41,53,216,250,57,152,208,219,180,136,154,103,188,27,155,201,15,49,61,233,192,164,38,154,111,67,109,161,218,145,39,137,162,208,103,92,91,209,200,222,218,53,234,236,173,242,124,170,69,165,70,29,236,98,212,193,74,243,38,89,67,178,70,94,57,30,205,150,109,149,100,29,167,14,44,117,19,84,216,241,81,11,71,12,114,52,157,158,85,66,224,203,76,214,83,83,14,159,75,228,185,117,233,46,40,122,56,10,28,31,149,97,32,208,139,2,120,107,0,27,153,84,163,0,62,240,223,132,129,64,57,10,148,30,87,135,129,64,45,10,28,31,245,195,64,160,24,5,142,143,186,97,32,80,137,2,224,242,189,48,16,40,68,1,246,202,132,107,78,72,177,28,5,98,232,0,215,225,161,149,34,228,123,125,205,219,160,193,158,61,81,238,186,50,211,198,4,194,76,87,209,67,53,223,221,146,61,203,234,198,155,119,239,131,207,79,95,207,201,162,56,122,84,167,252,54,222,7,183,233,118,147,171,17,160,36,230,121,55,97,83,117,0,44,4,212,254,192,4,236,184,72,6,89,6,250,118,114,40,27,100,191,242,1,238,208,40,248,42,132,153,78,38,62,251,161,207,135,180,10,119,12,241,161,144,38,166,180,72,27,116,234,26,82,121,32,77,185,56,39,161,97,96,87,21,229,67,35,231,231,188,68,195,106,186,95,109,163,49,16,52,217,42,103,77,42,216,167,26,102,84,174,132,15,99,218,162,124,174,233,132,73,87,140,54,157,154,228,252,156,222,94,144,175,163,132,60,211,22,87,151,209,144,62,5,120,84,67,227,60,152,204,17,212,66,202,71,77,105,63,137,130,85,157,242,43,166,10,147,29,160,4,220,162,93,142,57,7,232,193,120,161,13,35,129,172,60,77,132,32,223,64,131,236,139,59,13,57,216,230,23,198,146,241,184,48,139,170,164,131,255,255,14,194,240,128,124,167,61,32,75,102,52,154,65,104,208,26,24,141,37,51,152,205,174,17,155,64,250,255,153,241,74,91,123,27,58,161,231,226,95,161,71,18,69,249,56,116,241,175,56,52,239,136,
-12,143,206,191,130,146,195,193,187,153,28,161,190,251,87,132,210,129,84,62,92,125,247,175,112,229,209,240,12,15,213,191,98,215,244,145,172,135,146,38,249,15,108,5,136,214,253,180,34,127,201,95,62,57,80,237,186,100,233,174,187,205,201,110,1,140,173,189,205,111,107,30,31,49,203,118,249,109,77,98,54,96,21,184,71,139,125,133,145,83,60,136,248,196,219,224,165,250,85,25,105,117,114,86,206,122,28,111,152,134,71,230,92,119,100,164,198,100,116,63,228,248,72,7,217,160,6,150,110,122,171,236,127,176,7,142,89,154,231,123,114,126,94,176,231,159,205,195,201,173,19,208,11,8,50,71,71,11,38,241,112,153,9,2,16,219,50,135,50,46,170,59,9,202,179,217,242,145,228,37,221,79,206,201,227,249,204,83,78,167,208,62,88,83,64,7,226,17,42,250,136,132,140,71,68,195,71,237,125,34,204,175,204,202,148,39,0,151,22,199,218,108,13,34,55,250,29,31,179,67,128,90,123,53,255,76,227,100,209,126,14,59,107,125,202,89,8,114,6,131,101,18,111,175,232,174,116,78,226,120,4,125,129,207,101,166,219,130,41,41,0,14,101,55,120,253,39,124,106,221,243,6,93,153,83,187,74,126,163,225,107,60,220,198,175,120,15,249,182,80,5,27,141,178,57,149,175,21,232,104,79,190,151,235,67,30,237,226,57,187,80,201,103,99,214,46,150,211,157,108,64,79,80,62,221,147,204,191,201,125,168,245,104,93,204,83,132,195,189,168,243,231,241,148,197,245,16,92,66,244,248,223,130,255,124,247,234,237,213,219,151,193,147,39,193,233,119,199,71,139,236,124,153,93,0,185,60,97,161,93,102,32,28,68,46,79,191,235,194,85,203,194,246,202,196,156,178,145,203,99,124,88,168,234,90,43,67,46,217,76,232,237,250,188,60,156,88,95,148,127,148,71,192,229,9,176,242,224,85,250,52,99,247,172,138,152,223,51,103,117,91,18,107,203,3,58,156,96,101,193,105,176,62,15,254,250,203,147,95,225,71,242,159,44,248,54,88,95,180,47,120,77,110,34,94,111,219,207,5,100,23,146,189,159,216,215,90,29,134,191,200,137,181,160,183,231,127,201,46,152,30,119,122,219,234,233,38,190,190,6,158,74,214,145,21,51,230,207,119,26,161,204,211,0,245,119,200,183,213,176,141,133,146,58,123,222,161,246,181,76,78,182,126,153,50,49,164,126,176,136,207,96,102,121,27,110,175,73,198,52,132,205,83,28,71,114,253,83,115,23,32,206,182,217,188,231,95,49,211,153,228,209,135,249,154,174,204,54,100,126,178,46,134,18,39,104,59,188,199,251,233,124,254,45,115,208,247,236,155,203,65,249,173,227,70,235,202,112,239,234,248,168,162,226,141,255,250,14,107,37,17,26,102,26,95,211,154,57,29,108,103,202,15,61,214,117,34,218,61,36,101,217,133,10,189,116,160,136,240,154,55,76,120,33,107,171,235,224,33,61,160,204,179,224,93,117,181,223,242,248,168,188,192,34,10,162,36,61,220,220,214,73,211,248,40,238,154,188,247,163,76,115,193,132,204,228,56,56,170,159,136,15,22,152,68,18,39,119,233,246,174,122,131,8,94,237,113,210,62,170,198,231,36,184,153,186,203,224,129,185,175,141,183,43,138,85,175,56,121,187,116,187,128,60,128,81,63,237,69,150,158,248,84,216,125,80,96,6,237,3,94,66,207,125,183,139,64,35,50,254,15,3,143,245,84,26,13,104,67,159,225,169,159,89,41,154,20,226,74,43,25,77,200,67,42,15,3,143,81,213,216,180,174,17,180,164,141,52,46,87,152,161,111,78,155,195,74,90,161,94,238,95,89,87,168,17,174,201,235,52,17,21,237,216,135,3,110,110,178,214,203,43,14,237,167,141,73,202,53,251,208,2,73,124,134,66,87,173,155,136,24,173,170,59,101,234,139,100,120,151,200,196,73,147,23,221,146,221,122,60,30,128,138,111,146,52,139,174,96,190,146,87,87,99,113,181,73,216,124,16,70,155,190,240,74,193,237,67,173,69,41,37,63,62,58,34,192,17,24,19,124,134,13,119,110,96,130,198,170,241,228,201,167,15,63,191,236,41,126,149,164,248,115,251,241,254,139,95,133,250,166,90,42,147,205,42,70,231,250,22,197,150,202,245,83,32,181,134,97,182,137,147,112,139,119,6,181,245,227,1,10,133,249,35,219,180,194,110,96,179,71,56,61,201,187,56,233,166,246,144,255,178,2,161,
-12,124,199,21,185,77,191,224,117,211,108,2,92,22,144,231,40,216,39,96,195,251,113,25,225,189,72,6,102,23,138,133,84,68,28,222,221,4,139,30,116,236,77,165,207,223,188,192,87,81,65,193,238,181,13,228,65,243,59,178,161,134,27,109,12,96,221,253,192,188,216,68,119,189,91,73,89,41,24,24,176,16,79,6,62,92,177,129,65,10,224,247,184,126,160,185,47,178,37,109,47,37,110,111,66,30,121,157,87,210,142,134,60,137,85,57,158,204,234,55,57,73,123,89,81,123,117,89,157,135,143,201,97,72,188,1,83,188,107,207,119,90,143,243,189,123,245,226,127,232,51,122,173,85,84,245,4,21,74,133,34,229,115,70,97,70,86,192,187,242,26,191,242,128,135,209,64,66,62,251,208,232,252,186,108,59,207,218,114,52,34,143,165,51,51,208,52,201,211,45,61,103,16,171,212,85,224,54,204,133,227,193,62,94,131,2,153,178,253,248,80,94,100,83,158,116,17,177,244,193,174,174,196,155,168,16,75,236,209,59,202,101,106,240,233,157,145,73,47,202,104,36,215,119,230,208,103,251,196,128,51,167,152,220,105,15,42,210,215,162,185,71,130,81,162,245,108,97,53,127,32,135,139,221,71,11,187,167,63,11,250,36,32,179,252,136,238,241,26,18,246,155,91,232,90,202,60,124,88,107,248,211,135,247,164,250,249,229,144,144,101,235,32,208,136,192,139,75,118,26,199,147,121,99,82,102,37,99,92,44,219,162,21,21,190,83,233,249,50,98,91,103,31,31,53,165,206,191,233,34,98,95,181,127,239,154,254,38,77,34,39,230,223,23,228,198,5,56,114,93,185,193,112,151,157,185,194,48,2,179,184,131,60,50,110,92,162,247,8,122,123,149,153,31,118,236,77,3,60,253,74,223,129,21,89,243,244,124,51,111,251,233,167,15,208,198,119,87,173,183,154,252,132,210,203,140,10,20,129,251,41,208,252,55,211,4,99,185,190,224,21,59,103,146,18,188,146,150,189,204,127,139,247,245,138,119,25,174,210,172,184,74,147,43,114,165,34,187,109,203,81,13,165,240,149,67,189,112,24,240,157,32,19,84,99,15,20,166,169,73,238,176,30,87,181,179,201,152,147,93,198,206,3,228,155,201,131,138,141,12,141,106,153,72,193,31,89,121,13,38,97,134,98,248,42,86,218,137,198,87,69,65,67,3,140,34,197,35,220,83,120,116,148,53,60,23,47,32,233,123,46,124,59,191,231,114,84,35,158,203,85,110,62,207,21,168,73,198,117,92,85,43,158,219,83,137,122,174,120,84,93,123,46,15,51,226,185,92,21,103,246,92,145,178,226,17,118,226,185,120,237,79,223,115,91,199,4,115,121,46,71,53,226,185,92,229,230,243,92,129,154,100,92,199,85,181,226,185,61,149,168,231,138,71,213,181,231,242,48,35,158,203,85,113,102,207,21,41,43,30,97,39,158,139,171,130,190,231,182,14,176,230,242,92,142,106,196,115,185,202,205,231,185,2,53,201,184,142,171,106,197,115,123,42,81,207,21,143,170,107,207,229,97,70,60,151,171,226,204,158,43,82,86,60,194,147,60,23,41,222,226,2,27,154,159,40,88,115,154,222,19,188,146,150,61,235,52,125,76,53,191,167,233,218,131,170,48,77,239,143,172,188,6,30,76,211,29,13,176,197,105,186,236,32,107,78,211,93,120,174,141,105,186,133,129,117,56,77,215,30,84,133,105,186,19,207,181,55,77,119,52,192,22,167,233,178,131,172,57,77,119,225,185,54,166,233,22,6,214,225,52,93,123,80,21,166,233,78,60,215,222,52,221,209,0,91,156,166,99,160,176,56,77,143,147,169,130,53,201,190,39,120,37,45,123,86,178,31,83,205,111,178,215,30,84,5,178,239,143,172,188,6,30,144,189,163,1,182,72,246,178,131,172,73,246,46,60,215,6,217,91,24,88,135,100,175,61,168,10,100,239,196,115,237,145,189,163,1,182,72,246,40,206,34,217,67,243,19,5,107,134,140,158,224,149,180,236,89,67,198,152,106,126,135,12,237,65,85,8,25,253,145,149,215,192,131,144,225,104,128,45,134,12,124,3,141,204,32,99,185,190,231,194,183,195,158,11,5,196,238,49,44,91,26,49,142,106,196,115,185,202,73,122,238,152,106,26,3,43,80,147,140,235,184,170,74,158,171,61,168,212,115,197,163,202,120,110,127,100,229,53,152,132,25,241,92,174,138,42,158,235,104,128,107,207,149,83,216,134,231,106,146,189,11,
-207,229,168,70,60,151,171,220,124,158,43,80,147,140,235,184,170,86,60,183,167,18,245,92,241,168,186,246,92,30,102,196,115,185,42,206,236,185,34,101,197,35,60,201,115,81,156,69,207,133,2,98,247,24,150,61,171,231,142,169,230,183,231,106,15,170,130,231,246,71,86,94,3,15,60,215,209,0,155,246,220,240,238,166,149,182,211,190,26,37,226,60,146,217,211,10,154,56,31,26,227,16,95,135,122,19,113,18,155,84,132,87,23,177,16,156,121,79,211,148,170,92,200,171,178,12,194,109,158,150,47,209,202,131,250,213,126,204,8,119,53,180,99,129,136,32,95,235,74,97,145,5,42,232,103,200,0,81,87,177,1,246,244,149,160,14,163,32,203,88,9,21,121,33,217,3,179,86,162,52,10,10,157,153,58,36,163,189,100,239,88,208,141,20,164,145,65,146,239,223,141,176,200,67,124,183,214,95,240,189,87,171,24,175,252,57,17,36,191,246,52,180,52,19,64,57,2,130,149,83,95,56,93,80,233,129,169,9,3,202,28,152,50,40,246,104,220,221,91,183,103,76,50,164,189,170,37,237,211,253,129,190,137,233,47,227,150,180,119,101,74,123,121,228,57,29,24,180,165,253,28,198,180,87,179,166,161,62,141,90,83,247,110,20,93,123,170,218,25,178,168,250,94,19,233,136,196,213,206,142,37,85,162,248,250,15,170,46,178,32,85,237,13,217,80,37,86,108,69,114,189,145,182,157,189,41,227,217,203,89,143,108,20,226,235,103,215,124,246,99,136,43,68,32,101,253,13,27,208,94,198,130,38,69,31,102,218,71,114,169,236,174,157,58,217,102,42,194,77,175,157,64,160,218,172,216,80,46,156,181,181,147,133,84,56,247,107,167,201,32,207,189,118,50,58,10,190,174,157,116,35,133,193,181,19,39,35,185,167,225,87,189,118,114,228,206,243,174,157,38,25,146,161,181,147,192,146,246,174,76,201,197,218,201,165,49,205,185,118,210,181,39,19,107,167,190,29,113,181,251,106,215,78,142,108,104,190,181,211,84,227,153,180,118,18,91,207,222,161,249,88,93,59,57,54,32,167,107,39,146,154,106,119,237,212,73,222,85,17,110,122,237,68,110,120,87,153,21,27,74,45,182,182,118,178,144,89,236,126,237,52,25,228,185,215,78,70,71,193,215,181,147,110,164,48,184,118,226,60,224,209,211,240,171,94,59,57,114,231,121,215,78,147,12,201,208,218,73,96,73,123,87,166,228,98,237,228,210,152,230,92,59,233,218,147,137,181,83,223,142,184,218,125,181,107,39,71,54,52,223,218,105,170,241,76,90,59,137,173,103,239,208,124,172,174,157,28,27,144,211,181,19,121,70,199,238,218,169,243,20,147,138,112,211,107,39,250,158,54,133,89,177,161,103,172,172,173,157,44,60,98,229,126,237,52,25,228,185,215,78,70,71,193,215,181,147,110,164,48,184,118,226,60,233,218,211,240,171,94,59,57,114,231,121,215,78,147,12,201,208,218,73,96,73,123,87,166,228,98,237,228,210,152,230,92,59,233,218,147,137,181,83,223,142,184,218,125,181,107,39,71,54,52,223,218,105,170,241,76,90,59,137,173,103,239,208,124,172,174,157,28,27,144,211,181,19,121,214,210,238,218,169,243,52,170,138,112,211,107,39,16,168,54,43,182,248,172,172,145,181,147,163,71,101,237,174,157,38,131,60,247,218,201,232,40,248,186,118,210,141,20,6,215,78,156,27,11,122,26,126,213,107,39,87,87,27,204,186,118,154,100,72,134,214,78,2,75,218,187,50,37,23,107,39,151,198,52,231,218,73,215,158,76,172,157,250,118,196,213,238,171,93,59,57,178,161,249,214,78,83,141,103,210,218,73,108,61,123,135,230,99,117,237,228,216,128,156,174,157,200,20,205,238,218,169,115,31,136,138,112,211,107,39,40,164,54,43,182,120,91,137,145,181,147,163,203,74,236,174,157,38,131,60,247,218,201,232,40,248,186,118,210,141,20,6,215,78,156,59,163,122,26,126,213,107,39,87,151,75,205,186,118,154,100,72,134,214,78,2,75,218,187,50,37,23,107,39,151,198,52,231,218,73,215,158,76,172,157,250,118,196,213,238,171,93,59,57,178,161,249,214,78,83,141,103,210,218,73,108,61,123,135,230,99,117,237,228,216,128,236,175,157,118,113,82,245,173,236,131,160,119,23,149,237,208,98,45,141,161,145,239,216,54,195,251,78,155,66,139,188,96,46,105,228,53,28,222,127,215,30,17,5,125,219,
-35,80,193,141,229,186,112,67,163,125,128,225,203,120,55,112,137,166,146,38,34,187,24,209,10,7,78,66,51,153,5,74,127,80,76,0,23,222,115,212,11,239,135,129,83,209,68,11,184,240,94,0,92,87,51,41,224,166,90,28,199,174,105,179,87,119,225,118,102,187,19,234,70,2,143,156,126,78,172,79,160,104,120,47,80,210,165,13,10,117,27,0,81,217,18,201,106,86,62,172,46,33,172,198,55,73,154,69,93,109,123,239,58,32,45,127,167,47,10,34,248,96,203,168,64,31,129,222,234,156,124,113,149,164,8,175,52,37,141,137,78,81,120,123,232,121,189,83,52,70,222,235,34,72,179,130,110,10,205,80,81,151,49,67,20,234,197,15,135,29,221,132,38,216,16,123,180,129,57,135,244,224,136,221,131,54,244,29,199,47,200,15,109,188,226,100,27,39,81,112,125,72,214,100,185,197,211,2,100,145,63,46,143,143,86,73,240,253,19,226,227,101,185,101,80,100,135,232,4,126,162,59,67,65,184,189,137,86,89,120,118,29,21,235,219,197,42,89,6,143,255,175,199,240,123,132,219,185,32,249,140,214,236,68,12,94,223,101,195,1,173,220,116,247,13,167,155,99,178,204,4,204,142,34,67,184,79,80,72,51,98,18,41,2,234,238,40,216,49,214,190,173,254,126,8,147,34,222,70,210,74,255,222,76,199,7,212,172,154,229,216,110,245,211,176,245,10,244,106,75,239,217,114,83,107,25,252,174,110,208,85,245,246,168,142,171,34,61,122,85,83,13,42,127,231,162,161,38,221,136,201,247,85,27,30,48,99,42,234,57,65,37,115,208,13,106,205,69,94,80,254,111,151,110,14,80,106,247,91,244,192,244,44,75,11,40,188,184,251,158,60,183,148,128,74,57,62,140,6,122,225,171,142,42,125,222,252,215,203,255,155,150,108,212,216,70,215,197,41,253,50,8,201,67,122,193,234,129,182,128,98,247,97,81,68,96,143,183,97,126,11,205,67,7,79,122,77,226,111,77,131,235,112,187,198,197,43,52,71,106,193,178,118,123,136,56,109,33,110,186,109,117,155,42,34,83,77,229,183,198,180,194,1,48,212,212,245,214,88,83,96,227,166,154,130,86,140,193,94,100,211,13,107,117,216,254,118,69,109,249,234,62,205,174,72,219,183,29,159,88,6,212,140,69,174,81,215,108,36,239,211,188,248,62,248,229,123,248,229,201,175,139,95,190,167,5,225,207,219,178,221,147,101,240,11,86,249,117,177,58,57,97,35,142,164,70,171,206,59,46,56,115,63,84,112,157,38,121,193,107,146,81,53,139,190,15,130,219,128,8,15,242,219,244,176,133,63,162,32,127,72,214,16,108,128,173,110,163,112,115,28,84,255,83,239,218,8,216,76,174,124,15,114,97,199,176,45,210,185,57,59,54,50,102,252,142,73,142,220,220,131,86,178,6,40,215,33,14,210,185,238,188,91,208,135,176,144,117,200,46,91,173,182,233,10,190,14,139,116,87,253,93,41,80,64,95,178,197,9,244,170,146,245,236,245,187,103,228,219,203,186,208,117,150,238,104,49,182,80,249,109,83,108,189,219,147,150,218,109,193,183,151,237,254,158,116,139,224,183,77,153,228,176,221,246,203,224,183,77,153,12,6,164,95,6,191,109,202,124,201,98,224,228,110,215,200,183,77,161,253,161,224,232,12,223,54,69,54,209,150,83,4,190,109,138,108,163,228,166,32,29,99,139,208,111,153,206,71,225,158,211,121,248,150,53,127,24,159,5,204,106,224,63,39,228,223,99,182,48,126,113,69,190,173,205,224,109,154,238,97,2,114,40,96,82,124,246,77,191,37,18,218,249,13,213,35,120,124,220,177,136,56,185,65,94,71,37,2,108,225,184,59,240,109,29,110,162,34,40,110,193,208,30,112,149,139,191,19,233,65,152,131,109,210,230,96,138,29,111,183,199,71,88,236,58,206,242,34,120,76,138,7,105,70,170,226,204,58,189,166,173,64,213,111,46,69,10,45,97,146,180,137,238,209,255,3,129,114,241,230,94,77,183,227,35,60,133,204,0,194,155,32,44,168,94,143,136,152,71,68,237,160,214,250,248,104,80,237,179,150,222,100,4,40,185,6,253,33,160,191,55,138,230,69,154,69,181,78,84,191,110,155,9,24,239,46,199,136,65,236,3,223,154,221,114,18,242,115,211,100,80,117,62,57,236,86,81,134,154,82,24,226,4,190,142,243,186,125,26,27,242,223,183,248,197,247,163,49,226,227,223,95,75,133,
-137,178,92,99,103,245,82,128,74,66,243,164,127,157,84,127,104,155,59,211,36,90,60,175,185,242,59,198,238,219,1,178,121,33,86,180,61,108,48,118,124,127,7,171,141,86,27,229,111,80,154,96,87,23,109,26,195,184,220,117,195,21,227,208,1,183,135,151,66,191,13,196,126,219,237,251,170,7,231,152,48,62,106,193,48,106,109,118,233,140,44,24,64,213,24,227,154,31,63,125,32,214,34,30,72,166,1,116,118,210,198,50,189,190,206,163,162,92,75,117,218,251,20,198,204,62,240,7,186,112,71,99,167,169,30,191,208,186,103,103,201,175,224,222,96,249,181,103,229,191,60,198,111,37,132,46,201,134,30,93,73,116,164,127,60,172,62,146,74,61,21,72,202,67,41,168,210,129,254,247,91,210,220,175,60,101,24,93,190,93,4,91,162,71,144,149,161,163,35,250,121,154,172,67,102,103,148,126,142,18,156,10,20,95,210,178,229,188,229,29,37,67,5,164,135,24,55,217,208,1,109,190,38,191,115,225,164,85,89,165,91,45,39,36,162,136,91,126,134,63,115,27,46,17,40,219,135,144,68,90,106,53,126,72,226,117,186,137,158,22,229,208,52,177,191,47,232,191,159,223,102,79,139,118,224,15,171,22,130,245,109,152,133,107,152,58,31,31,45,48,180,146,181,246,9,229,131,122,48,96,102,23,227,158,18,107,26,101,3,139,47,216,2,223,18,127,132,70,80,58,51,55,75,147,187,40,99,229,23,41,124,168,149,104,71,46,164,158,252,191,99,24,31,218,75,8,42,215,241,125,25,1,226,86,39,223,147,159,26,65,244,51,52,28,173,127,99,181,6,94,162,45,6,37,112,249,225,186,108,19,199,168,211,234,71,242,99,211,42,253,220,180,202,80,193,235,244,75,148,49,163,221,129,130,252,220,50,205,18,135,18,97,128,97,139,69,32,74,230,81,155,45,127,222,239,135,90,38,63,15,183,124,192,34,117,203,13,190,81,152,173,27,36,214,2,67,133,111,63,146,146,12,14,228,115,112,13,100,31,54,126,125,22,80,35,206,33,174,84,22,179,12,78,207,131,248,58,72,210,2,138,31,146,13,219,183,236,74,82,133,15,17,244,41,143,62,246,53,41,127,41,251,162,173,81,131,201,126,27,23,123,176,187,90,167,36,138,54,219,136,254,125,29,71,219,13,111,134,133,48,85,53,25,152,240,171,106,28,48,109,37,218,198,187,24,205,156,209,235,38,190,139,18,218,114,176,32,129,16,75,19,255,75,129,1,90,107,64,104,105,39,182,4,140,187,123,70,58,126,12,190,220,130,192,124,31,174,97,118,19,102,216,223,86,184,170,227,224,112,211,175,241,231,161,166,137,190,196,97,187,1,177,30,236,97,9,31,164,36,148,211,74,110,192,101,218,7,183,190,24,2,233,130,53,160,93,122,23,209,128,158,38,55,81,94,15,24,196,42,96,204,132,142,221,246,161,9,82,165,46,36,84,71,80,106,83,79,77,41,190,205,84,126,24,231,1,45,9,222,150,180,108,190,174,134,107,72,225,76,78,225,15,46,20,102,22,21,93,117,27,128,247,176,2,174,212,5,10,21,120,235,107,40,214,104,251,35,174,101,14,251,86,208,68,41,212,55,75,34,6,246,217,131,6,228,103,248,173,177,205,54,125,213,192,201,41,242,65,93,145,112,47,163,199,32,34,67,166,7,197,47,250,26,117,65,31,131,136,25,214,114,200,90,131,58,134,212,144,169,77,80,176,129,78,66,191,118,134,112,92,28,138,168,156,136,228,25,97,170,229,38,47,200,127,161,219,229,121,75,127,54,92,214,100,39,17,213,119,165,190,233,122,125,200,178,8,83,236,64,149,71,208,248,35,152,242,29,31,61,130,230,31,157,5,193,171,235,235,0,129,133,121,236,38,120,66,142,228,232,42,53,206,241,96,174,252,1,236,0,22,29,180,246,26,166,113,171,136,210,27,93,211,70,88,50,63,108,107,159,9,94,37,176,86,223,192,188,0,112,130,113,3,144,10,44,3,170,228,120,122,72,119,147,152,26,4,167,67,66,25,108,115,124,148,199,127,68,203,82,47,4,20,244,33,254,188,1,214,2,126,189,14,64,19,162,33,18,45,195,201,216,12,116,172,5,112,152,175,227,184,90,30,117,184,159,252,214,155,39,87,211,71,104,12,55,33,241,191,180,249,222,184,49,11,24,26,241,184,203,150,186,104,123,245,244,242,190,64,43,105,150,79,12,249,200,73,170,45,90,44,178,47,142,133,
-171,100,214,172,181,19,67,254,94,146,233,78,105,217,240,159,246,187,171,113,254,91,106,179,229,202,223,119,166,204,108,95,233,111,180,183,172,3,177,75,67,50,23,30,148,144,119,166,207,172,4,250,27,87,66,103,245,137,71,129,18,29,233,46,90,179,248,230,182,144,80,143,141,148,41,174,23,23,249,57,117,242,11,174,61,210,66,77,167,94,147,207,12,161,86,19,77,145,173,240,164,44,25,203,228,202,187,152,32,48,78,114,88,17,84,161,171,54,76,2,74,221,203,14,54,180,78,35,244,21,249,220,240,18,84,133,133,27,184,246,109,148,177,178,32,30,108,129,138,170,5,91,88,180,160,236,8,41,11,107,73,129,168,179,40,177,91,115,71,151,150,105,77,237,81,49,129,41,224,111,76,89,106,85,220,205,46,168,249,190,222,235,98,202,71,251,120,155,222,28,184,21,94,150,191,65,13,248,116,198,182,126,121,116,44,249,63,178,21,73,14,223,177,11,204,62,60,177,166,239,241,63,39,228,223,230,120,228,211,171,55,47,241,155,171,77,203,100,133,123,133,245,78,101,221,4,169,221,219,87,43,119,62,219,165,202,93,207,230,40,238,201,19,60,215,197,135,2,191,148,218,177,203,235,231,111,94,220,133,217,203,191,51,225,225,247,67,8,11,166,7,66,200,95,82,210,106,206,156,201,254,73,162,189,183,47,229,219,251,235,120,115,175,63,41,52,39,161,222,107,5,245,126,24,111,238,39,5,245,126,144,80,239,39,5,245,226,28,211,39,239,132,109,189,250,248,246,213,107,198,230,128,60,11,92,6,32,103,17,43,174,143,229,170,220,145,34,222,69,77,251,184,93,124,102,218,132,72,163,166,237,136,52,106,216,152,104,155,134,45,138,52,106,216,172,104,155,134,108,75,24,244,30,208,54,58,113,143,23,172,72,185,171,226,15,153,144,85,150,21,68,45,242,43,233,14,249,75,221,240,72,53,78,248,146,104,120,216,248,122,13,255,85,182,221,97,3,236,183,43,173,240,107,53,133,127,144,109,247,39,53,133,127,144,86,248,39,53,133,155,88,39,108,113,56,220,81,251,85,136,120,230,205,143,13,125,230,109,144,137,129,230,13,145,13,134,230,173,145,137,138,230,77,146,13,143,230,236,114,100,146,72,138,21,225,110,79,146,201,134,34,102,93,242,170,127,22,221,141,152,77,217,42,102,30,146,60,188,142,2,230,68,232,254,42,218,167,235,219,197,201,247,117,233,246,108,180,41,211,116,244,19,172,100,126,134,239,3,242,61,145,19,44,30,63,254,158,252,63,248,249,211,115,220,59,255,207,48,57,132,217,67,112,190,12,206,255,207,255,120,140,219,226,29,241,35,146,233,30,75,113,213,252,92,43,128,74,157,82,177,164,145,19,88,157,238,247,41,172,147,202,77,33,152,196,199,184,61,83,180,52,101,103,206,84,120,209,8,111,175,227,136,6,164,204,69,204,62,188,33,45,89,40,144,172,102,4,93,230,116,181,58,128,227,180,94,174,182,154,113,102,143,205,74,105,36,181,114,76,218,150,221,210,168,4,238,226,237,54,150,21,219,97,227,250,39,112,30,6,96,181,144,88,87,236,113,178,116,243,67,49,145,219,252,95,85,90,31,10,138,252,214,149,148,127,173,170,252,15,42,173,255,164,170,252,15,74,202,255,164,170,124,197,216,131,173,14,113,118,19,67,165,89,219,158,153,54,220,109,207,86,107,6,183,103,176,13,143,219,179,218,154,205,237,153,110,195,233,230,237,87,249,127,53,225,255,129,251,238,163,124,143,165,198,23,71,180,88,39,141,13,139,252,241,125,37,170,189,133,70,9,128,87,171,238,93,181,189,63,198,30,28,237,154,38,162,117,174,202,120,63,23,49,65,187,126,46,10,216,102,157,69,52,63,184,241,242,50,225,165,73,8,28,99,126,2,252,31,25,70,132,177,117,41,22,26,7,157,148,234,160,183,137,174,227,36,90,236,200,86,45,201,60,0,75,195,127,111,201,191,187,184,60,90,32,122,180,161,192,111,94,68,215,143,217,221,213,34,131,16,182,38,201,148,15,73,186,123,96,44,7,139,179,135,114,29,201,184,207,170,40,249,220,180,100,9,153,23,138,50,91,41,232,52,174,183,163,60,187,201,122,149,31,86,87,96,22,87,160,68,148,1,45,192,132,136,108,122,148,54,41,216,123,237,214,186,250,146,133,251,214,113,32,61,21,169,12,174,180,196,13,125,74,172,167,192,142,167,193,46,167,83,179,1,
-21,90,245,174,160,52,209,131,153,81,146,146,80,87,163,139,221,90,157,46,62,221,108,234,222,145,185,30,175,111,216,134,78,223,122,245,120,125,107,162,11,15,194,38,140,87,178,70,131,212,16,162,125,161,188,190,105,8,133,175,197,125,74,147,226,150,223,190,100,200,228,52,35,50,85,82,170,182,212,214,204,93,67,59,5,196,219,218,85,144,79,213,144,12,207,116,252,250,205,112,252,160,84,172,191,228,209,80,75,218,106,198,129,83,83,173,189,208,29,211,224,162,254,171,211,150,32,158,209,125,146,198,237,201,231,126,219,28,31,148,139,172,88,249,155,182,155,10,162,143,172,38,253,24,52,18,0,75,21,154,8,24,95,95,47,160,222,121,45,20,151,29,23,245,86,81,231,169,64,26,252,232,6,54,86,109,36,85,87,82,182,31,110,64,221,130,85,84,124,137,162,36,120,132,114,30,145,4,15,252,243,226,81,235,8,176,137,169,93,203,147,227,1,106,68,98,195,218,116,30,126,110,248,73,67,30,62,202,223,145,39,136,0,149,216,227,214,51,61,228,232,116,240,228,244,162,125,114,122,19,37,81,86,157,190,195,10,147,199,100,11,114,252,203,107,16,42,72,182,215,74,22,216,94,85,243,150,197,73,223,14,218,37,250,207,247,144,223,155,153,79,156,84,150,216,245,108,50,123,39,165,75,247,166,211,252,214,89,54,51,207,207,163,130,150,102,158,212,225,138,188,196,212,36,220,231,201,131,67,30,109,200,234,122,159,197,52,207,181,181,248,17,104,3,214,95,119,143,163,200,77,95,145,155,137,138,244,108,164,92,187,8,204,176,156,218,247,55,189,152,108,126,234,246,15,251,168,115,248,217,18,243,144,209,148,161,93,74,255,11,62,62,104,255,116,29,195,200,37,159,243,210,222,169,237,47,30,162,48,91,18,111,88,66,123,39,29,111,39,65,164,233,31,39,194,85,129,70,186,151,173,227,142,214,204,190,148,214,236,128,15,9,188,40,255,203,169,47,14,199,184,66,108,42,246,106,150,139,23,154,249,82,46,42,8,194,120,55,220,96,239,197,80,147,190,82,168,111,211,67,150,227,58,229,0,63,45,143,143,74,79,91,146,205,207,242,195,73,176,15,179,112,23,97,234,225,217,55,188,85,238,134,134,190,77,195,64,140,63,6,227,132,63,172,42,179,220,93,16,57,65,45,165,150,161,172,161,188,90,87,176,188,11,15,219,66,74,61,144,192,42,19,44,226,132,227,215,39,67,74,42,104,134,66,59,153,50,67,186,85,39,20,178,26,54,217,75,176,190,172,60,78,176,148,229,56,91,181,101,65,118,28,74,86,227,37,211,226,207,139,50,128,148,59,6,191,149,113,164,50,246,64,40,150,111,58,32,233,197,199,79,52,219,236,47,81,25,172,154,53,116,55,108,179,59,61,162,160,221,235,223,115,81,200,44,27,57,227,240,195,130,153,153,139,4,117,123,196,202,193,140,108,25,33,245,60,123,88,200,85,235,224,67,93,16,29,29,136,75,100,116,150,17,254,75,255,150,146,190,201,11,206,192,213,196,79,31,238,194,8,69,102,155,17,73,56,62,62,34,150,244,211,155,79,100,62,72,198,249,172,158,39,85,26,34,131,52,238,212,59,215,34,84,20,209,220,206,43,44,219,168,81,126,155,147,38,168,213,18,219,89,36,105,242,71,148,165,199,71,132,36,234,185,233,233,191,255,31,255,251,127,252,219,249,57,209,230,219,242,67,203,191,171,141,154,179,82,41,122,65,14,180,89,221,26,138,47,59,31,209,239,10,239,61,96,175,17,69,114,148,237,32,41,204,233,33,249,190,233,34,79,229,74,142,170,206,116,106,220,81,26,124,90,86,101,40,202,81,24,190,101,70,132,167,47,21,161,170,45,212,234,234,74,120,17,200,183,97,11,142,194,148,103,171,86,72,21,142,214,196,128,75,181,31,58,43,185,90,113,42,175,86,157,148,27,210,158,35,186,103,35,148,212,9,228,210,157,40,43,241,172,133,254,50,218,147,70,172,94,95,202,250,221,222,148,115,17,181,222,148,149,56,189,105,45,176,7,122,211,136,213,235,77,89,191,215,155,223,183,87,122,61,106,42,14,244,106,65,238,190,186,198,47,227,52,1,90,111,79,231,70,59,221,210,78,179,227,77,27,125,195,108,148,81,181,206,166,38,215,68,155,159,37,236,180,165,133,174,177,54,141,112,194,29,153,193,179,59,79,129,120,75,134,78,236,152,144,68,247,74,186,115,79,54,
-24,54,243,248,102,194,120,196,157,206,241,214,52,236,206,92,112,199,206,215,213,116,84,211,45,12,242,125,180,142,175,227,117,75,185,246,170,178,11,89,33,161,75,49,12,86,161,133,84,91,151,101,7,37,57,181,228,212,193,109,142,16,214,95,131,224,228,81,241,169,154,123,37,48,129,31,156,181,246,246,87,62,97,166,64,217,12,125,62,136,43,3,231,204,56,53,91,180,214,112,156,249,55,157,203,213,14,95,180,158,36,46,191,166,179,251,226,54,44,130,13,174,55,32,186,3,187,28,213,15,114,226,44,189,6,162,139,127,132,23,188,43,43,18,177,151,3,14,171,81,62,158,57,168,68,197,103,45,37,122,145,170,173,130,136,69,217,13,206,146,78,81,167,227,35,226,45,116,183,11,159,90,195,43,38,130,47,128,16,76,115,91,131,67,231,99,69,57,199,230,232,65,214,68,195,19,63,118,222,215,59,201,132,249,147,108,235,188,57,90,51,69,235,182,12,147,229,223,84,90,47,203,247,37,148,63,240,165,52,131,37,137,144,104,160,90,179,157,230,236,181,179,204,128,134,113,118,158,47,200,154,128,110,49,144,133,67,117,105,164,120,215,153,148,226,239,130,147,232,16,94,131,153,214,199,251,199,71,96,50,164,10,190,211,32,207,227,213,246,33,72,240,94,206,248,174,189,155,80,111,104,183,116,162,95,141,42,213,221,154,30,209,10,44,245,248,168,220,181,30,87,11,6,173,173,20,126,49,170,18,22,82,131,9,107,140,169,195,158,94,20,205,209,197,192,202,68,230,208,130,232,122,36,123,106,241,144,94,171,44,83,235,10,221,39,75,243,224,109,240,229,22,86,199,193,6,163,7,170,244,22,252,27,157,231,168,124,80,152,172,101,23,255,172,18,82,235,215,128,157,159,116,60,84,77,165,166,70,95,39,242,160,55,252,94,193,83,146,45,22,238,4,156,244,26,203,41,193,128,21,248,34,203,156,89,18,135,202,206,147,194,71,20,161,243,39,96,174,240,219,50,56,59,91,6,255,241,36,63,224,167,214,131,189,155,77,43,77,138,156,68,209,13,149,64,234,228,146,111,36,13,207,19,18,130,50,16,92,30,145,182,31,29,31,113,172,181,180,236,71,196,97,30,241,109,151,157,191,161,1,179,147,166,222,169,75,163,164,212,249,27,59,211,150,53,233,154,170,57,179,37,54,195,172,163,79,156,228,241,166,179,27,84,222,222,12,163,134,79,82,18,134,190,77,183,155,188,126,54,188,217,37,194,167,47,215,81,134,87,52,4,251,20,55,174,112,224,113,138,223,190,66,127,183,199,199,225,179,114,175,138,88,162,48,250,148,165,175,232,206,102,154,181,109,188,252,181,137,66,229,230,38,153,100,144,57,46,125,62,24,107,81,218,104,241,55,160,188,32,127,148,151,66,245,12,158,238,158,144,205,221,214,142,99,101,232,148,192,203,193,250,229,252,244,252,226,215,246,245,71,120,77,86,70,78,231,98,136,74,41,152,26,62,210,190,11,139,53,222,141,249,208,98,76,162,17,204,37,75,149,250,215,34,49,42,21,233,160,66,225,46,106,103,165,53,150,67,181,92,146,148,60,208,235,36,32,79,200,126,137,243,238,244,3,193,193,205,95,1,52,184,85,35,6,166,21,138,81,230,127,84,192,224,148,147,62,203,47,137,11,170,130,168,84,7,90,28,76,80,23,17,34,40,127,4,143,255,16,194,209,73,57,120,72,210,228,97,151,47,194,237,54,253,66,110,109,232,156,32,149,5,152,35,108,44,25,84,223,211,236,96,124,70,62,196,139,135,224,19,244,152,112,55,26,239,95,106,71,236,44,3,50,236,92,115,150,184,44,43,150,35,211,247,25,166,6,103,87,151,89,242,212,251,229,203,224,144,87,151,130,148,11,31,122,200,137,250,45,242,40,130,161,73,176,236,158,108,16,244,14,225,41,248,213,217,78,91,63,206,104,213,53,56,234,117,47,110,161,45,74,170,119,221,83,175,196,162,57,169,236,161,199,59,9,108,42,9,182,197,13,2,88,62,74,88,3,88,230,112,12,99,200,84,146,192,144,182,104,2,67,38,29,183,163,162,128,145,187,117,5,120,50,199,99,198,64,173,30,56,42,145,101,56,122,28,91,182,174,61,128,89,62,194,9,200,98,195,166,201,178,39,205,57,231,234,117,194,6,88,173,127,172,78,124,28,201,17,120,57,41,72,250,12,59,143,248,70,116,188,61,124,170,206,100,229,150,27,60,212,23,200,30,39,30,
-201,68,27,70,40,103,163,139,233,216,200,249,189,65,73,77,30,144,88,222,119,170,242,154,217,76,247,209,48,133,167,200,46,123,173,144,32,207,75,217,96,11,92,114,133,47,4,61,100,203,92,118,206,229,134,159,57,107,252,0,11,95,246,182,62,228,234,146,210,221,125,13,185,170,80,246,178,115,14,36,91,149,148,22,109,29,73,40,77,203,95,246,14,61,100,27,40,203,95,114,207,25,164,27,105,234,92,242,247,236,229,251,211,84,234,26,1,179,35,209,111,2,85,224,141,254,104,37,206,176,55,235,183,126,28,195,42,156,225,102,170,112,165,8,134,121,172,154,112,120,199,42,54,16,118,30,32,197,138,11,65,124,238,228,150,97,92,41,231,197,176,66,33,233,149,244,57,17,152,152,159,226,243,169,103,253,100,67,209,133,50,68,198,190,119,165,140,240,62,153,242,89,210,250,70,25,122,0,51,126,225,114,55,145,45,16,38,178,117,246,236,55,76,134,100,192,191,91,230,114,236,196,33,80,56,113,224,102,28,119,159,30,10,212,159,30,226,39,45,7,227,73,203,50,185,69,129,100,110,145,228,99,77,130,230,120,181,25,123,31,213,134,60,30,54,146,253,23,12,101,255,245,89,122,211,203,230,11,212,178,249,218,217,213,193,64,58,159,212,89,96,160,118,22,216,122,11,5,207,99,10,122,122,89,55,84,191,137,130,164,68,168,156,164,117,143,52,89,115,98,146,44,130,174,64,217,180,181,178,125,129,125,213,103,176,242,2,68,237,237,154,6,241,117,28,242,13,226,115,7,130,115,93,78,123,213,249,177,56,195,179,163,97,99,23,194,33,227,181,56,106,35,149,206,189,247,135,132,5,8,70,138,60,58,62,106,238,50,140,147,197,61,251,146,53,230,245,203,193,241,17,243,96,104,190,142,49,9,235,10,126,198,87,47,95,97,213,75,126,75,215,219,162,105,9,63,136,91,130,95,171,150,152,182,214,105,174,171,21,84,189,228,183,164,170,21,109,137,105,171,8,181,177,42,194,22,86,76,75,170,90,209,150,154,182,244,161,106,35,165,15,84,23,39,125,147,106,91,148,190,65,117,237,73,127,224,218,227,166,63,108,156,81,187,213,31,182,219,75,126,75,234,3,119,219,29,185,91,253,161,187,189,228,183,164,62,120,183,221,209,187,213,31,190,219,75,126,75,234,3,216,214,42,11,241,149,131,186,190,87,214,190,20,182,167,168,94,211,94,211,226,38,186,201,162,72,87,195,178,246,165,176,61,69,13,155,246,154,22,163,251,189,166,118,80,243,146,219,142,162,86,180,157,166,37,88,166,104,106,4,53,47,185,237,40,106,68,219,105,181,116,254,88,95,167,243,199,151,130,182,212,245,34,109,49,62,254,123,86,232,70,11,168,122,201,111,73,53,90,208,150,152,120,184,210,214,10,171,94,242,91,82,141,172,171,174,86,81,188,213,213,10,170,94,242,91,82,213,138,182,212,180,117,29,174,116,195,3,86,189,228,183,164,168,85,217,18,211,214,54,77,51,93,181,176,238,165,160,45,85,197,104,91,199,71,213,85,42,215,48,147,102,245,90,62,208,23,129,10,116,131,175,223,188,123,145,199,55,73,136,176,243,90,65,37,160,21,242,102,82,129,86,157,86,218,147,200,11,5,117,216,238,173,115,58,147,188,64,208,46,5,109,74,40,199,111,243,122,91,112,53,5,89,208,94,51,172,99,154,98,139,216,242,144,166,32,171,106,147,12,239,152,166,237,54,187,154,238,211,47,19,16,133,218,29,45,153,246,52,208,196,246,248,26,234,34,41,210,80,23,197,90,67,238,114,179,220,160,104,238,23,91,157,51,91,7,203,213,5,103,35,97,21,51,121,215,212,252,217,155,155,202,11,245,159,157,7,127,13,158,93,180,46,47,27,104,156,125,233,180,150,160,206,11,165,243,234,141,210,140,116,86,220,93,181,225,166,34,9,4,125,30,107,114,66,71,176,249,241,110,148,98,86,218,35,243,25,241,26,107,82,191,27,164,121,81,55,184,198,64,247,80,24,123,40,211,252,13,218,155,64,132,75,171,43,37,222,49,79,84,152,177,189,110,195,78,44,144,74,90,77,25,49,190,29,114,27,118,103,141,205,30,95,109,44,253,109,191,233,22,57,40,198,157,85,50,50,239,90,123,223,38,44,147,223,184,3,235,108,100,173,166,141,32,207,66,7,26,183,110,165,79,116,233,249,37,215,82,158,116,172,243,137,9,130,22,139,26,29,186,39,170,20,253,
-146,103,35,79,218,214,248,100,10,73,139,4,72,116,69,145,166,95,242,108,226,73,219,250,158,76,33,106,145,0,53,171,211,160,106,117,219,155,72,214,102,44,80,133,174,21,237,80,151,176,39,90,163,50,101,203,219,228,36,210,54,97,153,218,180,173,106,157,70,136,219,132,133,170,83,183,146,149,78,35,239,73,150,170,73,223,178,214,106,128,192,181,45,246,7,77,2,255,137,59,213,251,161,109,165,63,24,160,111,177,160,177,161,251,65,145,188,121,146,64,208,231,177,38,39,116,4,155,31,239,134,26,113,255,196,155,204,253,208,178,186,31,38,208,182,168,121,37,75,83,39,109,101,123,155,70,217,70,172,78,129,176,213,108,79,147,174,167,89,160,42,89,75,219,225,20,170,54,96,141,186,68,173,104,145,38,104,218,128,85,42,147,180,138,101,78,162,232,41,214,169,71,208,146,22,58,157,158,245,173,84,119,125,253,19,119,66,247,67,103,22,249,131,137,245,245,128,168,209,161,83,93,95,243,100,161,168,207,163,141,78,232,12,17,32,209,21,69,154,230,77,217,126,104,207,14,127,152,178,190,22,10,80,179,58,13,170,86,183,189,137,100,109,198,2,85,232,90,209,14,117,9,123,162,53,42,83,182,188,77,78,34,109,19,150,169,77,219,170,214,105,132,184,77,88,168,58,117,43,89,233,52,242,158,100,169,154,244,45,107,173,6,8,92,219,98,159,232,50,56,251,6,165,198,100,158,116,236,244,137,9,6,31,16,53,54,124,79,84,25,156,39,11,69,125,30,109,116,66,103,136,0,137,174,168,49,56,71,210,103,130,218,104,163,250,93,161,2,212,172,78,157,193,53,108,111,26,131,27,178,64,5,6,87,181,67,77,6,159,106,141,170,12,174,96,147,83,24,220,136,101,234,50,184,178,117,154,96,112,35,22,170,204,224,106,86,58,137,193,167,89,170,30,131,75,91,235,116,6,215,183,216,63,233,50,248,91,238,164,239,79,29,59,253,147,9,6,31,16,53,54,124,127,82,101,112,158,44,20,245,121,180,209,9,157,33,2,36,186,162,198,224,111,121,211,186,63,181,237,239,79,83,24,92,40,64,205,234,212,25,92,195,246,166,49,184,33,11,84,96,112,85,59,212,100,240,169,214,168,202,224,10,54,57,133,193,141,88,166,46,131,43,91,167,9,6,55,98,161,202,12,174,102,165,147,24,124,154,165,234,49,184,180,181,78,103,112,117,139,237,189,248,178,125,37,162,4,171,11,222,3,128,213,201,19,211,141,70,47,234,23,78,84,47,189,205,163,34,167,55,104,20,157,27,171,89,225,82,46,132,143,140,15,93,206,40,173,75,251,234,182,126,242,61,125,233,61,115,245,57,124,113,182,141,146,155,226,118,17,148,195,4,95,253,26,112,1,250,248,233,3,230,34,144,226,189,177,34,55,103,147,159,80,145,144,121,175,75,87,94,178,122,192,219,81,100,229,61,123,104,93,200,203,136,43,175,191,42,165,198,73,64,26,230,137,44,210,215,233,151,40,227,203,196,15,221,62,98,233,254,139,80,66,230,189,46,91,44,2,86,217,190,176,176,150,247,243,126,175,32,143,148,30,150,119,192,34,181,188,158,192,44,222,73,75,251,8,165,217,151,12,226,71,124,177,24,128,183,15,215,248,174,160,44,61,144,119,169,244,95,206,83,217,140,146,192,215,88,122,72,32,185,193,172,190,3,124,64,110,166,36,247,131,148,220,242,210,239,33,147,237,73,93,6,249,5,254,49,10,243,197,213,58,77,216,139,76,169,18,235,219,16,175,105,192,247,45,149,23,225,210,59,125,170,1,47,71,0,127,184,142,179,188,40,191,207,165,134,66,70,57,50,36,154,202,181,71,75,70,199,76,75,199,15,83,117,44,71,150,171,161,220,16,203,251,211,5,62,251,164,168,101,110,96,156,229,29,80,79,67,99,131,45,239,177,19,20,85,25,241,237,62,220,116,212,36,111,231,30,4,18,234,116,13,242,125,22,237,81,46,27,88,32,96,55,12,69,62,102,81,184,190,37,95,210,187,128,41,107,157,5,159,178,67,178,174,222,159,89,149,79,105,15,179,248,230,182,192,171,105,225,67,156,149,85,114,188,212,123,27,102,55,17,94,226,26,38,253,54,57,67,162,209,213,15,156,174,62,221,123,215,83,169,81,173,231,22,163,99,219,178,188,41,35,155,219,232,112,46,59,182,82,29,254,208,235,240,132,241,181,215,95,89,191,149,162,61,168,91,50,138,200,141,251,
-92,82,66,208,10,40,210,134,222,174,229,202,177,165,232,85,140,69,105,7,126,67,161,230,249,242,214,65,158,180,182,99,27,185,61,68,212,67,131,188,141,112,16,49,100,33,182,1,81,138,29,114,83,41,198,107,184,100,193,153,154,124,173,1,68,110,202,38,2,68,100,34,249,215,30,69,20,236,4,61,199,142,149,248,23,74,20,172,165,7,139,41,91,113,29,79,200,194,40,255,239,184,184,93,176,216,236,179,232,58,190,111,190,56,225,236,122,82,60,222,147,146,45,251,128,207,176,218,137,214,191,113,134,97,88,30,185,3,117,88,210,186,67,107,45,97,93,105,48,36,84,86,103,49,119,184,110,245,46,224,238,234,150,107,99,82,150,89,204,145,207,194,254,13,75,100,201,74,40,171,213,195,174,184,30,158,81,152,173,187,210,214,114,27,147,240,251,71,82,157,17,71,62,147,247,107,132,160,244,170,220,81,10,170,183,128,236,211,60,198,55,112,46,131,211,115,52,64,124,219,200,53,238,0,240,134,154,175,26,139,193,144,82,109,24,166,232,213,11,5,87,83,80,251,192,129,237,67,116,23,225,155,72,114,131,240,9,181,28,1,240,3,31,65,35,42,246,189,25,43,87,135,67,68,65,250,174,191,254,85,183,156,80,250,41,140,183,220,125,241,2,126,8,242,95,104,83,103,103,201,175,236,246,38,252,240,24,191,227,6,23,145,58,244,133,55,67,138,116,192,82,215,165,167,76,133,109,55,20,96,4,100,153,7,223,219,185,137,238,165,32,171,27,101,35,68,249,85,80,94,157,11,131,87,190,66,227,23,34,107,73,254,253,150,146,192,175,202,154,146,185,20,213,16,81,60,62,26,87,174,19,193,166,234,119,72,226,117,186,137,158,22,45,202,8,4,168,113,92,226,191,159,223,102,79,139,246,253,241,97,80,54,219,108,204,5,11,250,130,118,98,44,173,215,79,213,94,193,49,186,65,237,24,187,19,234,213,66,107,154,106,220,145,141,139,67,17,181,148,203,51,18,69,150,155,156,188,188,101,9,83,58,242,22,38,241,6,113,221,78,127,104,201,215,229,60,37,93,211,215,100,208,131,189,71,32,231,81,176,122,56,62,122,4,146,30,157,5,193,171,235,235,0,231,143,48,187,217,4,79,130,34,59,224,44,39,198,169,203,241,81,253,195,151,219,120,27,149,181,215,208,233,85,68,35,80,253,170,52,208,12,95,45,82,133,174,87,73,144,102,27,156,246,164,120,195,63,204,120,10,44,3,170,228,104,107,228,30,82,182,6,57,105,60,36,219,120,23,131,184,227,163,60,254,35,90,150,122,33,162,248,198,210,100,251,16,108,200,235,75,65,101,208,132,104,136,177,144,9,154,228,240,52,47,90,71,149,199,97,1,131,179,95,103,204,93,233,196,20,22,251,176,248,30,191,7,191,226,188,11,236,253,243,15,47,73,185,6,221,242,45,94,65,121,76,189,44,95,114,72,223,238,21,109,234,129,15,22,16,203,31,227,155,229,146,38,90,183,222,226,67,106,84,111,27,218,151,111,236,105,189,192,14,197,147,82,204,220,42,202,182,193,243,116,7,229,227,21,140,199,135,232,230,0,211,203,224,229,253,30,171,160,224,234,0,157,212,36,167,62,55,97,156,228,205,185,31,171,68,44,167,69,220,81,227,121,152,71,91,242,163,97,125,176,157,122,96,136,78,162,113,169,74,54,74,189,78,97,130,142,18,91,91,245,239,223,125,124,245,63,106,74,128,209,109,195,117,4,35,24,223,196,9,81,163,82,7,127,34,127,92,111,195,155,242,245,0,236,59,150,80,179,178,250,213,151,44,220,179,236,69,190,13,174,194,237,246,170,52,23,98,243,255,248,166,84,238,31,223,160,47,253,227,27,42,22,95,206,4,223,144,44,133,127,124,83,182,137,77,253,227,155,179,227,163,224,61,196,160,29,190,99,24,126,36,186,64,217,112,189,142,246,228,157,203,248,254,53,162,96,240,40,126,180,12,30,237,240,159,28,254,33,239,84,188,127,132,45,4,193,163,232,209,247,56,155,192,161,138,144,80,192,173,163,221,190,120,168,162,24,248,28,174,192,99,112,99,48,109,112,228,21,190,31,234,46,220,198,165,249,210,102,226,78,51,8,62,245,147,116,31,101,36,185,2,58,134,135,204,167,128,121,148,160,135,220,65,17,8,166,160,200,209,187,234,165,116,203,186,88,175,16,138,217,73,137,217,65,72,137,79,183,113,210,170,155,75,213,253,199,55,155,180,56,
-133,1,250,199,55,164,218,167,230,109,87,212,180,242,218,182,16,221,94,28,252,199,55,248,22,44,140,39,225,62,102,218,192,210,176,222,43,200,57,211,46,124,192,74,85,96,165,10,190,77,233,187,249,234,82,100,177,8,3,180,108,143,96,53,128,65,152,193,80,224,251,247,162,82,114,105,4,180,57,246,93,165,165,233,108,234,247,142,65,96,34,83,200,218,8,137,254,20,19,106,123,225,150,119,106,205,186,5,187,74,228,185,6,179,104,108,49,23,235,31,184,92,71,31,97,221,31,160,187,250,253,144,54,47,100,233,58,23,249,177,55,39,12,201,111,181,151,87,155,134,248,14,212,170,147,216,59,88,135,31,72,189,232,30,8,124,251,208,126,21,225,239,219,11,148,95,135,158,40,95,243,117,168,74,242,82,43,62,254,253,117,176,141,127,139,106,93,136,3,55,171,126,104,52,220,179,115,8,136,107,105,71,255,150,90,162,183,227,16,168,226,36,102,152,255,21,124,138,193,57,255,136,200,175,36,253,14,254,219,122,5,14,243,218,187,51,131,113,142,125,181,237,246,38,90,101,225,25,162,208,33,150,101,80,99,10,12,19,176,141,97,233,239,46,101,26,225,215,189,232,215,5,218,189,82,83,2,106,8,244,16,180,37,108,130,163,78,172,166,75,44,208,36,150,82,35,30,192,36,86,6,37,30,64,37,150,133,165,82,137,73,28,43,219,105,79,145,59,67,207,204,222,57,186,86,123,54,181,176,103,79,63,85,38,113,169,212,234,72,99,23,220,214,24,179,208,211,179,52,23,245,198,199,219,228,107,28,79,82,55,22,42,27,235,104,26,15,35,27,79,133,54,30,196,54,214,4,183,54,100,94,176,194,121,241,186,104,237,118,4,76,166,106,191,7,75,50,227,137,111,146,52,139,80,34,206,194,138,152,172,252,130,166,222,113,55,222,81,57,23,236,102,28,126,129,115,130,224,54,10,55,1,121,163,119,222,158,11,199,201,254,80,96,79,200,78,19,172,232,232,94,247,241,17,217,79,33,53,112,206,247,143,111,80,2,76,40,27,218,90,0,175,157,230,197,195,54,58,169,153,141,92,122,158,102,248,210,243,178,33,70,50,93,117,214,89,53,68,64,169,75,185,21,79,148,57,62,2,109,96,206,242,138,104,6,178,195,96,3,115,191,232,20,91,130,57,11,252,10,19,150,67,33,252,149,242,107,156,64,31,42,49,93,69,168,84,97,223,129,28,233,220,238,54,222,211,183,127,159,209,89,91,41,22,171,128,232,60,205,112,25,156,50,253,33,237,183,200,122,204,18,48,221,120,216,24,20,6,255,59,142,224,216,137,228,115,19,93,86,144,247,239,70,122,170,32,240,223,4,29,252,103,26,39,139,45,35,45,99,254,174,144,204,183,140,248,60,99,62,36,241,246,170,156,143,18,87,143,242,2,87,214,17,121,209,91,176,96,74,50,185,237,181,138,175,95,253,215,75,84,160,241,249,255,76,227,86,206,50,84,10,94,55,51,206,202,81,241,235,15,199,228,235,116,143,166,14,243,251,58,241,157,228,189,231,193,199,215,196,159,63,126,40,119,1,171,186,229,124,181,20,240,242,227,243,99,146,140,158,146,53,52,9,93,1,179,88,195,190,157,29,127,34,171,14,178,183,3,142,131,153,228,48,41,189,73,34,186,3,70,245,131,174,145,224,84,47,200,179,244,75,206,245,165,120,118,224,95,249,138,124,107,53,109,3,251,81,232,109,219,250,185,150,65,88,55,132,243,254,115,16,59,124,103,6,243,236,8,126,60,110,182,157,182,103,100,99,98,191,141,238,23,80,138,174,173,214,116,209,21,126,31,38,15,103,103,103,39,229,127,155,135,54,158,190,125,245,227,187,215,47,178,104,23,238,223,84,245,153,118,169,32,43,77,147,118,195,36,190,6,70,236,53,27,52,237,18,152,224,195,175,189,166,35,228,71,242,102,207,62,86,5,35,41,137,190,84,17,28,218,185,186,248,181,213,46,124,102,90,254,180,15,215,236,51,43,209,53,110,244,132,193,155,40,187,137,130,167,121,158,174,99,186,9,248,41,196,253,200,5,84,57,57,11,126,196,105,209,10,170,86,7,255,216,76,185,245,3,133,143,201,54,109,185,231,141,175,135,221,130,191,176,79,175,97,241,5,213,102,76,185,207,100,222,213,168,248,6,16,200,202,85,57,74,134,98,193,2,156,143,206,207,78,170,245,63,204,50,122,2,53,65,225,73,20,75,121,149,172,51,178,175,216,22,
-183,220,199,209,58,42,223,190,58,32,182,174,222,78,70,193,237,169,184,250,9,130,30,190,38,30,139,203,74,95,179,159,76,43,208,177,198,109,152,220,28,194,155,136,81,13,77,160,218,129,106,237,186,60,127,243,2,127,251,216,57,238,123,89,154,58,90,226,211,215,245,33,80,150,222,100,225,238,140,121,170,141,52,188,163,190,36,110,254,199,67,66,78,228,46,187,10,49,169,31,188,122,48,188,92,157,74,69,64,175,52,163,251,133,196,20,88,197,242,244,144,173,163,133,64,41,116,229,31,227,45,179,227,69,29,142,78,172,161,202,97,77,183,71,27,9,116,213,177,141,26,82,44,95,214,206,194,210,125,211,116,22,198,121,180,216,229,55,229,166,63,158,170,179,122,144,223,153,221,63,252,72,118,173,239,113,231,27,221,126,27,174,34,244,94,88,149,160,220,176,222,191,13,118,208,6,140,50,138,237,72,13,243,60,202,138,197,29,97,4,64,99,199,1,1,134,149,22,123,22,23,226,6,242,219,241,6,62,222,14,52,128,231,186,99,13,188,74,6,26,0,30,27,109,224,53,190,236,88,216,5,48,205,209,46,224,3,127,162,6,160,198,104,3,239,226,77,221,64,189,156,172,26,64,63,63,95,238,147,112,23,17,109,48,76,147,63,192,8,105,16,16,53,251,41,67,22,99,242,191,200,183,104,22,69,84,30,9,86,210,96,2,22,94,111,211,47,139,246,97,23,52,69,14,190,95,148,63,55,109,125,98,44,24,194,69,134,235,207,213,54,5,26,1,202,136,238,163,245,1,151,135,116,10,87,53,142,167,39,69,150,110,207,90,100,2,69,126,163,221,36,49,189,219,149,155,48,91,129,157,98,169,70,250,231,16,34,58,16,90,94,158,194,180,142,101,110,34,114,116,64,73,44,139,111,110,34,18,126,202,134,160,236,22,215,52,120,26,125,252,115,222,120,103,173,37,233,6,105,57,68,101,130,40,204,182,15,48,139,220,70,56,201,172,185,234,172,29,188,243,188,26,171,19,86,125,252,129,217,24,135,133,248,158,13,17,40,101,19,231,160,219,134,4,11,84,144,30,45,103,17,44,170,19,186,111,207,40,183,33,153,141,81,178,126,96,197,19,149,75,127,249,82,67,201,158,17,110,34,82,102,211,27,200,103,100,208,240,8,250,14,22,241,225,10,166,147,197,3,201,31,217,226,146,190,194,249,11,61,44,43,16,84,236,19,214,184,99,85,200,162,27,152,191,71,25,27,206,151,152,32,64,254,184,141,182,123,126,44,173,234,85,65,190,210,236,27,60,70,69,32,72,172,196,68,131,38,247,25,73,133,30,193,208,186,1,110,175,226,118,200,117,217,72,251,184,187,67,112,121,184,3,183,96,55,255,15,171,3,206,236,178,29,67,187,248,68,53,121,225,120,127,113,252,241,233,155,247,175,95,150,85,186,135,47,244,104,165,90,83,144,52,9,44,86,74,197,239,240,40,63,200,191,25,87,96,207,188,3,77,172,0,190,86,76,83,137,39,193,98,31,220,3,186,7,156,113,156,156,44,209,105,96,166,240,24,175,61,223,227,63,231,103,143,57,83,4,92,188,237,160,129,140,252,84,89,64,253,237,25,76,182,192,85,242,69,251,144,228,221,251,79,120,54,178,199,106,226,58,213,220,58,40,39,215,162,54,152,176,134,53,193,22,118,41,56,102,211,226,55,2,229,214,105,148,173,145,157,149,212,107,106,169,43,248,55,24,99,180,187,152,128,95,60,224,129,87,213,156,88,203,221,46,77,62,1,113,168,234,217,212,67,77,41,123,16,93,75,174,24,211,246,57,105,1,109,242,52,106,210,22,26,88,249,234,214,23,7,168,105,219,84,227,194,26,12,106,250,38,204,126,235,236,31,52,17,139,0,219,151,120,151,110,161,70,170,164,101,85,71,67,197,143,49,44,70,81,185,178,141,128,108,26,151,4,9,184,10,180,36,137,254,97,82,168,142,125,85,75,67,211,23,135,253,54,38,41,221,85,51,2,151,234,203,133,25,44,78,109,51,37,101,235,74,26,186,62,167,20,142,83,231,61,206,104,200,161,125,70,87,178,101,179,98,191,202,139,55,192,38,91,69,100,171,90,234,222,255,178,220,83,41,137,44,47,159,190,175,246,217,1,223,198,205,68,90,51,211,51,121,165,235,74,234,58,191,168,231,66,25,44,18,163,130,18,112,156,252,147,78,156,132,106,70,225,6,75,170,169,89,85,210,80,19,143,53,136,106,163,81,159,36,242,172,
-226,100,163,164,91,83,75,99,220,171,5,103,153,67,20,21,204,64,231,103,34,69,255,25,23,74,42,98,121,117,229,222,131,231,132,55,196,219,59,251,175,48,27,254,231,33,47,78,227,228,20,47,58,169,36,133,67,227,94,109,109,169,97,91,85,154,0,109,29,170,24,100,97,102,186,142,132,240,150,171,128,50,130,164,106,49,171,87,89,93,245,159,218,171,16,136,90,99,209,245,38,74,112,95,78,85,213,186,150,186,142,31,163,223,15,36,63,182,110,100,84,73,168,144,61,224,171,215,85,116,172,43,169,171,88,49,0,230,23,145,102,48,17,188,0,3,142,215,57,115,107,17,51,81,173,87,106,85,246,79,221,126,93,232,170,252,141,155,66,68,38,212,44,10,221,254,244,123,81,75,248,251,187,79,85,169,166,237,119,229,55,236,166,76,189,5,43,50,223,56,193,84,62,37,148,203,42,26,94,118,191,167,153,193,36,123,176,90,90,229,226,73,64,201,14,240,219,173,234,84,128,173,170,174,41,57,126,194,186,52,32,224,218,58,109,141,81,117,86,210,145,180,109,22,91,130,205,251,167,175,127,106,215,97,86,90,41,204,224,0,24,88,143,222,210,9,254,63,43,53,170,35,115,50,213,15,129,226,31,114,186,151,14,131,139,91,19,176,144,93,255,246,32,140,81,187,112,157,165,139,2,31,147,43,42,48,232,167,26,145,214,42,26,32,33,85,88,187,37,99,86,47,157,203,67,127,218,72,107,149,44,146,222,61,226,48,160,77,216,149,31,28,242,106,251,181,246,128,214,10,190,175,92,154,173,195,157,26,52,164,10,171,12,125,198,136,232,136,211,197,53,148,131,8,135,19,200,106,67,171,82,130,139,15,85,97,18,62,67,42,129,217,199,52,243,187,206,42,41,51,11,131,114,11,183,134,15,247,184,197,70,132,59,210,5,46,133,148,124,145,169,166,238,135,31,162,60,221,222,81,187,163,137,199,164,165,96,131,231,82,113,49,180,222,221,197,69,10,78,162,166,107,89,71,93,81,152,203,199,215,15,116,193,176,13,201,46,28,204,32,182,105,140,167,34,25,30,120,109,43,211,32,207,80,148,121,212,184,124,95,167,153,112,113,217,28,60,246,199,156,183,206,198,253,45,106,121,117,77,226,16,205,9,130,192,13,132,39,156,70,229,114,131,67,65,206,226,148,134,169,172,163,62,76,63,39,25,240,124,149,157,126,214,62,165,20,104,248,207,60,77,212,38,208,88,193,134,110,28,89,89,180,57,172,213,28,178,172,162,227,140,88,177,204,202,64,237,200,93,51,193,122,27,198,187,92,172,224,46,220,43,234,135,53,116,212,131,122,123,114,139,24,27,207,232,190,123,249,208,120,109,157,116,91,39,41,6,212,78,139,232,239,48,17,140,21,119,160,218,53,157,134,188,44,34,79,132,41,170,75,235,232,40,74,159,63,91,61,112,14,19,226,50,164,113,39,118,135,252,182,76,44,83,154,212,53,213,52,150,167,80,57,160,181,243,96,147,126,193,105,123,53,11,19,226,153,110,11,53,211,37,21,212,149,123,69,182,65,200,136,191,123,253,233,125,128,7,40,244,124,27,31,214,139,239,202,163,33,118,126,219,60,112,208,221,74,143,11,186,194,98,78,3,122,9,32,75,178,91,95,229,228,224,145,102,43,29,160,201,199,249,244,1,234,62,191,61,176,71,101,207,179,136,156,122,39,181,40,58,143,184,142,49,230,223,100,97,66,206,68,64,0,121,86,166,157,48,21,6,119,113,244,165,149,11,149,68,247,197,152,122,193,128,126,247,69,71,193,247,89,90,7,42,252,57,88,227,239,132,157,26,10,110,241,96,15,32,144,123,75,14,90,131,162,220,229,102,101,174,14,201,171,178,235,45,169,216,52,145,10,5,112,215,32,66,223,192,255,148,207,0,3,60,229,83,172,228,24,144,248,117,71,143,46,20,163,138,188,133,42,3,93,135,18,188,142,183,176,207,139,104,79,100,108,195,188,192,63,78,190,103,41,191,4,249,10,190,187,12,56,53,241,76,158,212,132,63,78,240,159,94,77,248,142,91,19,15,23,73,77,146,4,195,30,46,86,53,225,59,110,77,180,9,82,147,28,168,193,63,189,154,240,29,183,230,245,182,148,9,127,156,224,63,189,154,240,29,183,230,102,181,165,53,201,25,26,158,145,117,107,194,119,1,115,138,180,185,11,147,117,249,100,84,219,85,194,210,89,200,185,47,231,100,177,73,115,3,6,91,51,6,18,231,224,
-254,105,101,34,171,225,123,244,95,125,252,127,94,126,120,199,78,48,194,236,129,94,170,65,108,2,155,10,210,187,40,235,101,144,67,101,102,165,210,23,42,121,55,244,36,5,70,111,60,111,171,5,54,230,30,11,20,234,33,22,236,197,0,206,176,32,215,58,248,135,5,94,210,237,28,11,20,234,33,22,16,217,220,99,129,66,61,196,2,98,181,123,44,80,232,172,88,48,122,37,241,150,205,13,25,84,229,237,171,215,98,77,18,20,45,131,68,71,162,52,16,218,210,37,76,34,73,11,37,32,222,125,26,214,134,52,39,9,71,79,180,60,34,211,212,24,55,15,104,160,230,251,120,48,104,128,42,220,27,132,158,165,233,54,34,119,183,144,173,72,166,231,157,182,101,223,51,33,39,103,116,200,89,233,236,244,9,254,30,146,72,17,6,189,240,30,5,114,225,136,196,24,119,100,113,123,106,76,174,74,207,217,201,18,254,109,179,231,162,57,146,57,185,42,61,23,222,153,100,161,231,162,25,145,57,185,42,61,103,39,66,173,55,151,88,232,185,104,254,99,78,238,120,8,203,227,155,68,210,211,63,190,250,233,109,87,9,172,30,44,78,207,151,143,151,231,39,50,221,239,202,147,244,118,125,217,163,131,207,106,212,90,30,57,64,64,184,50,154,13,129,214,162,200,1,2,194,245,208,108,8,180,150,66,14,16,16,174,130,102,67,160,181,0,114,128,128,112,237,51,27,2,173,101,143,3,4,132,43,30,39,8,52,233,26,171,92,146,11,158,62,251,216,85,2,42,203,116,187,35,67,178,215,138,242,70,7,155,209,98,100,150,103,164,167,10,179,59,139,61,29,153,213,25,233,169,194,108,206,98,79,71,102,113,70,122,170,48,123,179,216,83,54,86,227,223,54,122,42,138,207,211,229,169,244,148,141,201,248,183,141,158,138,226,240,116,121,227,193,247,84,118,193,253,242,167,174,224,36,186,145,233,232,169,206,50,91,77,218,232,128,158,202,46,174,167,247,82,101,73,109,171,151,99,11,233,233,189,84,89,62,219,234,229,216,162,121,122,47,85,150,202,182,122,57,18,106,13,244,82,33,208,90,235,229,72,152,53,208,75,133,32,107,170,151,181,18,223,126,43,25,101,95,189,125,254,161,43,186,190,200,65,166,187,109,73,146,209,86,79,234,232,224,54,186,140,68,93,131,189,86,136,190,214,123,61,18,133,13,246,90,33,26,91,239,245,72,84,54,216,107,133,232,108,189,215,35,81,218,96,175,21,162,181,245,94,143,68,109,131,189,86,136,222,134,123,221,48,137,236,84,249,197,203,190,2,155,72,161,219,167,58,83,102,61,169,227,12,45,59,117,54,216,107,133,32,110,189,215,35,65,220,96,175,21,130,184,245,94,143,4,113,131,189,86,8,226,214,123,61,18,196,13,246,90,33,136,91,239,245,72,16,55,216,107,133,32,110,184,215,205,197,126,113,178,88,157,55,73,188,231,191,46,87,23,236,199,147,128,253,212,209,234,205,171,183,189,60,135,90,44,52,29,239,14,187,230,226,93,242,54,189,125,24,103,248,129,220,192,155,51,176,140,106,194,67,202,141,86,45,45,170,107,142,102,215,96,54,60,42,249,171,217,236,132,171,129,83,60,88,117,174,146,244,138,36,71,77,241,163,178,145,105,138,45,3,114,117,56,62,142,145,84,87,82,119,176,147,82,86,5,74,231,138,235,120,163,23,74,250,140,170,150,79,123,161,164,55,168,50,151,229,222,79,137,5,79,255,103,64,191,240,94,41,86,142,105,34,15,158,105,173,212,189,216,133,6,179,225,161,225,127,46,52,112,138,7,171,142,1,78,125,250,63,227,238,46,161,216,104,124,146,84,86,5,74,231,138,235,120,163,23,74,250,140,170,150,79,123,161,164,55,168,50,155,172,181,119,145,61,192,202,183,216,173,71,94,26,207,139,23,81,66,222,184,222,211,239,217,121,240,109,240,236,98,73,238,239,13,147,34,194,28,94,178,146,166,87,191,61,148,47,243,68,157,170,119,182,63,236,217,103,3,6,84,146,205,50,26,85,143,187,130,159,166,51,163,229,29,254,71,83,63,80,239,179,89,69,12,128,134,74,153,135,140,106,183,154,106,113,159,113,68,205,42,50,29,50,162,148,41,200,198,92,131,221,50,231,165,162,205,224,173,162,189,117,45,245,108,123,43,62,180,174,167,159,97,111,197,199,232,167,131,230,192,91,245,45,206,176,183,154,177,51,167,222,202,30,245,240,210,41,103,240,
-86,209,153,144,150,122,182,189,149,121,179,188,162,126,134,189,21,175,174,152,14,154,3,111,213,183,56,195,222,106,198,206,156,122,43,123,88,199,75,148,157,193,91,69,167,122,90,234,217,246,86,188,98,69,79,63,195,222,138,151,190,76,7,205,129,183,234,91,156,97,111,53,99,103,182,189,149,204,0,120,235,214,249,102,194,61,149,252,159,9,19,149,91,235,214,153,102,194,141,34,30,207,132,113,158,190,154,106,113,38,188,181,163,136,255,51,225,150,107,248,177,110,237,169,244,213,120,235,252,235,214,70,145,175,195,91,231,93,183,118,20,249,202,188,213,143,117,107,79,37,255,215,173,165,147,204,191,110,109,20,241,120,221,202,56,201,188,235,214,142,34,254,175,91,91,174,225,199,186,181,167,146,255,235,214,210,73,230,95,183,54,138,120,188,110,101,156,100,222,117,107,71,17,255,215,173,36,166,240,214,173,243,113,107,79,37,255,185,149,168,220,90,183,206,196,173,141,34,30,115,43,50,255,106,170,197,153,240,214,142,34,254,115,107,203,53,216,85,132,39,222,42,90,79,120,233,173,204,186,117,94,111,21,172,91,253,243,86,125,139,51,236,173,102,236,204,169,183,250,177,110,237,169,244,213,120,235,252,235,214,70,145,175,195,91,231,93,183,118,20,249,202,188,213,143,117,107,79,37,255,215,173,165,147,204,191,110,109,20,241,120,221,202,56,201,188,235,214,142,34,254,175,91,201,147,212,126,121,107,79,37,255,189,149,168,236,131,183,54,138,120,236,173,248,170,31,47,188,181,163,136,255,222,74,180,228,237,50,205,231,173,61,149,252,247,86,162,114,107,151,105,38,111,109,20,241,216,91,49,150,172,166,90,156,9,111,237,40,242,149,121,43,187,230,247,196,91,69,171,127,47,189,149,217,101,154,215,91,5,187,76,254,121,171,190,197,25,246,86,51,118,230,212,91,217,53,191,39,222,42,90,253,123,233,173,204,46,211,188,222,42,216,101,242,207,91,245,45,206,176,183,154,177,51,167,222,202,94,60,230,137,183,138,110,40,243,210,91,201,107,121,125,240,86,92,144,125,21,222,170,111,113,134,189,213,140,157,57,245,86,63,118,153,122,42,125,53,222,58,255,46,83,163,200,215,225,173,243,238,50,117,20,241,205,91,217,75,207,53,46,143,248,248,243,179,1,127,56,157,230,174,167,147,47,143,24,87,207,180,237,157,42,93,30,49,164,31,168,247,217,172,34,6,64,67,165,204,67,166,114,121,196,128,118,159,113,68,205,42,50,29,50,162,148,113,114,61,213,186,60,98,14,111,85,120,56,98,126,111,29,126,8,199,161,183,202,63,132,51,179,183,234,91,156,97,111,53,99,103,78,189,117,36,181,100,14,111,85,72,50,153,223,91,135,147,153,28,122,171,124,50,211,204,222,170,111,113,134,189,213,140,157,57,245,214,145,101,196,28,222,170,176,160,152,223,91,135,23,174,14,189,85,126,225,58,179,183,234,91,156,97,111,53,99,103,182,189,85,229,242,8,71,222,170,123,121,196,140,222,42,117,121,132,11,111,85,190,60,98,14,111,149,191,60,194,178,183,234,93,30,225,139,183,250,177,110,213,189,60,98,126,111,157,127,221,170,124,121,196,204,222,58,239,186,85,239,242,8,95,188,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,98,70,111,85,185,60,194,145,183,234,94,30,49,163,183,74,93,30,225,194,91,149,47,143,152,195,91,229,47,143,176,236,173,122,151,71,248,226,173,35,143,242,207,225,173,10,15,245,207,239,173,195,151,71,56,244,86,249,203,35,102,246,86,125,139,51,236,173,102,236,204,169,183,250,177,110,213,189,60,98,126,111,157,127,221,170,124,121,196,204,222,58,239,186,85,239,242,8,95,188,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,204,232,173,42,151,71,56,242,86,221,203,35,102,244,86,169,203,35,92,120,171,242,229,17,115,120,171,252,229,17,150,189,85,239,242,136,25,189,85,229,242,8,71,222,170,123,121,196,140,222,42,117,121,132,11,111,85,190,60,98,14,111,149,191,60,194,178,183,234,93,30,225,139,183,142,60,202,63,135,183,42,60,212,63,191,183,14,95,30,225,208,91,229,47,143,152,217,
-91,245,45,206,176,183,154,177,51,167,222,58,242,40,255,28,222,170,240,80,255,252,222,58,124,121,132,67,111,149,191,60,98,102,111,213,183,56,195,222,106,198,206,156,122,235,200,163,252,115,120,171,194,67,253,243,123,235,240,229,17,14,189,85,254,242,136,153,189,85,223,226,12,123,171,25,59,115,234,173,126,236,50,233,94,30,49,191,183,206,191,203,164,124,121,196,204,222,58,239,46,147,222,229,17,206,188,181,214,245,207,90,151,71,188,249,249,245,128,63,252,121,154,187,254,121,242,229,17,227,234,153,182,189,63,43,93,30,49,164,31,168,247,217,172,34,6,64,67,165,204,67,166,114,121,196,128,118,159,113,68,205,42,50,29,50,162,148,113,114,253,179,214,229,17,115,120,171,194,195,17,243,123,235,240,67,56,14,189,85,254,33,156,153,189,85,223,226,12,123,171,25,59,115,234,173,35,169,37,115,120,171,66,146,201,252,222,58,156,204,228,208,91,229,147,153,102,246,86,125,139,51,236,173,102,236,204,169,183,142,44,35,230,240,86,133,5,197,252,222,58,188,112,117,232,173,242,11,215,153,189,85,223,226,12,123,171,25,59,179,237,173,42,151,71,56,242,86,221,203,35,102,244,86,169,203,35,92,120,171,242,229,17,115,120,171,252,229,17,150,189,85,239,242,8,95,188,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,194,23,111,245,99,221,170,123,121,196,252,222,58,255,186,85,249,242,136,153,189,117,222,117,171,222,229,17,51,122,171,202,229,17,142,188,85,247,242,136,25,189,85,234,242,8,23,222,170,124,121,196,28,222,42,127,121,132,101,111,213,187,60,194,23,111,29,121,148,127,14,111,85,120,168,127,126,111,29,190,60,194,161,183,202,95,30,49,179,183,234,91,156,97,111,53,99,103,78,189,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,98,70,111,85,185,60,194,145,183,234,94,30,49,163,183,74,93,30,225,194,91,149,47,143,152,195,91,229,47,143,176,236,173,122,151,71,204,232,173,42,151,71,56,242,86,221,203,35,102,244,86,169,203,35,92,120,171,242,229,17,115,120,171,252,229,17,150,189,85,239,242,8,95,188,117,228,81,254,57,188,85,225,161,254,249,189,117,248,242,8,135,222,42,127,121,196,204,222,170,111,113,134,189,213,140,157,57,245,214,145,71,249,231,240,86,133,135,250,231,247,214,225,203,35,28,122,171,252,229,17,51,123,171,190,197,25,246,86,51,118,230,212,91,71,30,229,159,195,91,21,30,234,159,223,91,135,47,143,112,232,173,242,151,71,204,236,173,250,22,103,216,91,205,216,153,83,111,245,99,151,73,247,242,136,249,189,117,254,93,38,229,203,35,102,246,214,121,119,153,244,46,143,112,230,173,181,174,223,142,95,30,129,127,119,244,124,250,226,69,30,223,36,225,150,231,14,223,18,111,165,191,7,81,150,165,89,144,38,181,90,12,78,223,170,221,18,161,163,135,0,48,9,229,64,208,85,146,146,18,186,16,137,193,169,199,104,29,30,114,208,234,237,171,215,193,93,184,61,68,170,10,200,227,164,136,144,140,134,223,138,111,204,80,27,43,80,228,179,172,197,200,92,141,161,46,221,144,157,168,193,33,2,66,217,58,244,49,81,66,67,206,38,132,87,130,40,141,202,103,52,78,73,155,144,186,251,67,93,186,25,155,80,132,67,4,132,170,77,76,192,68,9,141,33,189,198,2,61,187,87,197,185,154,197,42,201,136,182,167,116,244,176,72,50,227,16,89,38,25,53,156,28,144,12,179,37,172,54,86,218,36,35,216,251,85,151,110,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,236,22,43,231,201,76,171,36,35,218,85,213,209,195,34,201,140,67,100,153,100,212,112,114,64,50,204,73,134,218,88,105,147,140,224,200,66,93,186,13,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,39,3,156,196,108,171,36,35,58,12,
-208,209,195,34,201,140,67,100,153,100,212,112,114,64,50,204,1,156,218,88,105,147,140,224,164,77,93,186,13,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,7,90,248,183,75,146,17,157,97,233,232,97,145,100,198,33,178,76,50,106,56,57,32,25,230,220,88,109,172,180,73,70,112,64,172,46,221,6,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,48,41,97,32,65,193,42,201,160,60,201,68,137,57,73,102,28,34,203,36,163,134,147,3,146,1,193,122,99,165,77,50,32,102,186,165,216,34,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,12,146,140,240,138,103,7,7,255,82,119,57,207,127,240,175,8,145,121,146,153,128,147,77,146,233,223,107,109,251,224,127,248,2,235,153,15,254,101,225,48,76,50,58,152,88,33,25,193,197,221,22,15,254,37,110,232,158,239,224,95,9,14,115,36,163,141,137,51,146,113,156,93,38,117,5,185,103,36,51,71,118,217,4,156,28,144,140,195,236,178,225,123,215,253,32,25,215,217,101,58,152,216,38,25,71,217,101,18,23,203,123,65,50,46,179,203,180,49,113,70,50,142,179,203,164,110,206,159,63,187,76,17,34,203,36,227,79,118,89,255,45,2,182,179,203,134,95,23,48,115,118,153,44,28,118,72,102,254,236,50,193,107,18,44,102,151,73,188,15,97,190,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,76,248,178,33,7,217,101,82,111,21,154,63,187,76,17,34,203,36,227,79,118,89,255,13,75,182,179,203,134,95,165,52,115,118,153,44,28,118,72,102,254,236,50,193,43,164,44,102,151,73,188,43,106,190,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,76,248,34,70,7,103,50,82,111,92,156,255,76,70,17,34,243,36,51,1,39,155,36,211,127,251,164,237,51,153,225,215,76,206,124,38,35,11,135,97,146,209,193,196,10,201,8,94,175,105,241,76,70,226,61,154,243,157,201,40,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,198,113,118,153,212,251,109,61,35,153,57,178,203,38,224,228,128,100,28,102,151,13,191,212,215,15,146,113,157,93,166,131,137,109,146,113,148,93,38,241,214,98,47,72,198,101,118,153,54,38,206,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,100,77,197,75,157,114,176,93,214,147,237,231,118,153,34,68,230,73,102,2,78,54,73,134,168,213,74,167,178,189,93,214,72,244,112,187,76,22,14,195,36,163,131,137,21,146,193,13,187,213,196,56,162,70,50,29,137,126,109,151,41,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,
-198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,17,186,227,165,78,57,88,201,244,100,251,185,146,81,132,200,60,201,76,192,201,38,201,16,181,90,233,84,182,87,50,141,68,15,87,50,178,112,24,38,25,29,76,172,144,12,174,165,86,19,227,136,26,201,116,36,250,181,146,81,130,195,28,201,104,99,226,140,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,142,179,203,122,178,191,2,146,153,35,187,108,2,78,14,72,198,97,118,89,35,209,95,146,113,157,93,166,131,137,109,146,113,148,93,214,145,232,45,201,184,204,46,211,198,196,25,201,56,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,35,154,240,82,167,28,144,76,79,182,159,36,163,8,145,121,146,153,128,147,77,146,33,106,181,210,169,108,147,76,35,209,67,146,145,133,195,48,201,232,96,98,133,100,144,230,86,19,227,136,26,201,116,36,250,69,50,74,112,152,35,25,109,76,156,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,115,36,83,107,118,90,71,48,146,131,192,203,157,194,191,59,186,124,252,249,153,56,186,159,202,178,204,128,108,30,38,58,122,232,91,74,126,88,245,130,188,34,68,98,112,100,108,70,74,1,121,156,20,17,146,209,240,116,193,166,175,180,242,169,
-212,198,10,20,249,44,107,49,93,137,211,45,5,165,27,178,19,53,56,68,64,40,91,135,62,38,74,104,200,217,4,213,96,53,49,142,124,70,227,148,180,137,158,196,201,54,65,164,155,177,9,69,56,68,64,168,218,196,4,76,148,208,144,90,202,8,2,61,155,7,129,127,187,36,25,81,50,132,142,30,22,73,102,28,34,203,36,163,134,147,3,146,97,242,169,212,198,74,155,100,4,169,84,234,210,109,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,205,131,192,191,93,146,140,40,25,66,71,15,139,36,51,14,145,101,146,81,195,201,1,201,48,249,84,106,99,165,77,50,130,84,42,117,233,54,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,51,242,14,55,171,36,163,240,34,183,57,73,102,28,34,203,36,163,134,147,3,146,25,126,23,164,13,146,145,127,13,228,12,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,25,185,101,199,42,201,40,92,181,51,39,201,140,67,100,153,100,212,112,114,64,50,195,183,117,217,32,25,249,139,186,102,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,204,72,30,132,85,146,81,72,134,152,147,100,198,33,178,76,50,106,56,57,32,153,225,124,42,27,36,35,159,74,53,3,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,144,100,200,233,16,47,117,202,193,193,127,79,182,159,7,255,138,16,153,39,153,9,56,217,36,25,162,86,43,157,202,246,193,127,35,209,195,131,127,89,56,12,147,140,14,38,86,72,6,83,15,86,19,227,136,26,201,116,36,250,117,240,175,4,135,57,146,209,198,196,25,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,181,2,152,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,178,86,0,115,156,93,214,147,237,103,118,153,34,68,150,73,198,159,236,178,50,188,57,204,46,107,36,122,152,93,38,11,135,29,146,153,63,187,140,9,111,142,178,203,58,18,253,202,46,83,130,195,10,201,248,147,93,70,54,238,120,169,83,14,206,100,122,178,253,60,147,81,132,200,60,201,76,192,201,38,201,16,181,90,233,84,182,207,100,26,137,30,158,201,200,194,97,152,100,116,48,177,66,50,120,42,180,154,24,71,212,72,166,35,209,175,51,25,37,56,204,145,140,54,38,206,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,
-68,191,178,203,148,224,176,66,50,254,100,151,181,2,152,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,50,178,166,226,165,78,57,216,46,235,201,246,115,187,76,17,34,243,36,51,1,39,155,36,67,212,106,165,83,217,222,46,107,36,122,184,93,38,11,135,97,146,209,193,196,10,201,224,134,221,106,98,28,81,35,153,142,68,191,182,203,148,224,48,71,50,218,152,56,35,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,28,103,151,245,100,127,5,36,51,71,118,217,4,156,28,144,140,195,236,178,70,162,191,36,227,58,187,76,7,19,219,36,227,40,187,172,35,209,91,146,113,153,93,166,141,137,51,146,113,156,93,214,147,237,103,118,153,34,68,150,73,198,159,236,178,50,188,57,204,46,107,36,122,152,93,38,11,135,29,146,153,63,187,140,9,111,142,178,203,58,18,253,202,46,83,130,195,10,201,248,147,93,214,10,96,142,179,203,122,178,253,204,46,83,132,200,50,201,248,147,93,86,134,55,135,217,101,141,68,15,179,203,100,225,176,67,50,243,103,151,49,225,205,81,118,89,71,162,95,217,101,74,112,88,33,25,127,178,203,8,221,241,82,167,28,172,100,122,178,253,92,201,40,66,100,158,100,38,224,100,147,100,136,90,173,116,42,219,43,153,70,162,135,43,25,89,56,12,147,140,14,38,86,72,6,215,82,171,137,113,68,141,100,58,18,253,90,201,40,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,199,217,101,61,217,95,1,201,204,145,93,54,1,39,7,36,227,48,187,172,145,232,47,201,184,206,46,211,193,196,54,201,56,202,46,235,72,244,150,100,92,102,151,105,99,226,140,100,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,17,77,120,169,83,14,72,166,39,219,79,146,81,132,200,60,201,76,192,201,38,201,16,181,90,233,84,182,73,166,145,232,33,201,200,194,97,152,100,116,48,177,66,50,72,115,171,137,113,68,141,100,58,18,253,34,25,37,56,204,145,140,54,38,206,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,
-34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,28,103,151,245,100,127,5,36,51,71,118,217,4,156,28,144,140,195,236,178,70,162,191,36,227,58,187,76,7,19,219,36,227,40,187,172,35,209,91,146,113,153,93,166,141,137,57,146,169,53,251,115,29,193,72,14,2,47,119,10,255,238,232,242,230,231,215,226,232,254,103,89,150,25,144,205,195,68,71,15,125,75,217,29,182,189,32,175,8,145,24,28,25,155,145,82,64,30,39,69,132,100,52,252,243,130,77,95,105,229,83,169,141,21,40,242,89,214,98,186,18,167,91,10,74,55,100,39,106,112,136,128,80,182,14,125,76,148,208,144,179,9,170,193,106,98,28,249,140,198,41,105,19,61,137,147,109,130,72,55,99,19,138,112,136,128,80,181,137,9,152,40,161,33,181,148,17,4,122,54,15,2,255,118,73,50,162,100,8,29,61,44,146,204,56,68,150,73,70,13,39,7,36,195,228,83,169,141,149,54,201,8,82,169,212,165,219,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,7,129,127,187,36,25,81,50,132,142,30,22,73,102,28,34,203,36,163,134,147,3,146,97,242,169,212,198,74,155,100,4,169,84,234,210,109,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,102,228,29,110,86,73,70,225,69,110,115,146,204,56,68,150,73,70,13,39,7,36,51,252,46,72,27,36,35,255,26,200,25,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,51,114,203,142,85,146,81,184,106,103,78,146,25,135,200,50,201,168,225,228,128,100,134,111,235,178,65,50,242,23,117,205,64,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,153,145,60,8,171,36,163,144,12,49,39,201,140,67,100,153,100,212,112,114,64,50,195,249,84,54,72,70,62,149,106,6,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,32,201,144,211,33,94,234,148,131,131,255,158,108,63,15,254,21,33,50,79,50,19,112,178,73,50,68,173,86,58,149,237,131,255,70,162,135,7,255,178,112,24,38,25,29,76,172,144,12,166,30,172,38,198,17,53,146,233,72,244,235,224,95,9,14,115,36,163,141,137,51,146,113,156,93,214,147,253,21,144,204,28,217,101,19,112,114,64,50,14,179,203,26,137,254,146,140,235,236,50,29,76,108,147,140,163,236,178,142,68,111,73,198,101,118,153,54,38,206,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,140,108,220,241,82,167,28,156,201,244,100,251,121,38,163,8,145,121,146,153,128,147,77,146,33,106,181,210,169,108,159,201,52,18,61,60,147,145,133,195,48,201,232,96,98,133,100,240,84,104,53,49,142,168,145,76,71,162,95,103,50,74,112,152,35,25,109,76,156,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,
-57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,113,156,93,214,147,253,21,144,204,28,217,101,19,112,114,64,50,14,179,203,26,137,254,146,140,235,236,50,29,76,108,147,140,163,236,178,142,68,111,73,198,101,118,153,54,38,206,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,100,77,197,75,157,114,176,93,214,147,237,231,118,153,34,68,230,73,102,2,78,54,73,134,168,213,74,167,178,189,93,214,72,244,112,187,76,22,14,195,36,163,131,137,21,146,193,13,187,213,196,56,162,70,50,29,137,126,109,151,41,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,17,186,227,165,78,57,88,201,244,100,251,185,146,81,132,200,60,201,76,192,201,38,201,16,181,90,233,84,182,87,50,141,68,15,87,50,178,112,24,38,25,29,76,172,144,12,174,165,86,19,227,136,26,201,116,36,250,181,146,81,130,195,28,201,104,99,226,140,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,142,179,203,122,178,191,2,146,153,35,187,108,2,78,14,72,198,97,118,89,35,209,95,146,113,157,93,166,131,137,109,146,113,148,93,214,145,232,45,201,184,204,46,211,198,196,25,201,56,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,35,154,240,82,167,28,144,76,79,182,159,36,163,8,145,121,146,153,128,147,77,146,33,106,181,210,169,108,147,76,35,209,67,146,145,133,195,48,201,232,96,98,133,100,144,230,86,19,227,136,26,201,116,36,250,69,
-50,74,112,152,35,25,109,76,156,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,10,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,115,36,83,107,246,109,29,193,242,34,99,78,149,225,67,165,11,254,221,209,229,233,139,23,61,93,214,105,178,6,241,73,88,196,136,253,53,134,49,208,9,2,25,3,196,128,56,30,12,147,69,115,177,105,235,195,104,112,135,255,153,44,155,136,254,60,44,196,104,103,169,192,241,174,82,201,43,115,35,252,153,162,60,44,196,100,87,75,129,162,174,214,106,252,165,54,51,146,89,195,203,8,196,191,59,42,188,120,245,89,60,103,249,139,236,220,105,64,54,15,10,29,61,244,227,223,38,190,235,77,93,20,33,18,131,35,19,9,165,20,144,199,73,17,33,25,13,255,178,96,147,178,90,89,130,106,99,5,138,124,150,181,152,174,196,233,150,130,210,13,217,137,26,28,34,32,148,173,67,31,19,37,52,228,108,130,106,176,154,24,71,62,163,113,74,218,68,79,226,100,155,32,210,205,216,132,34,28,34,32,84,109,98,2,38,74,104,72,45,208,5,129,158,205,238,113,77,50,162,20,31,207,72,102,28,34,203,36,163,134,147,3,146,97,178,4,29,145,140,32,65,208,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,217,61,174,73,70,148,226,227,25,201,140,67,100,153,100,212,112,114,64,50,76,150,160,35,146,17,36,8,250,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,187,199,53,201,136,82,124,60,35,153,113,136,44,147,140,26,78,14,72,134,201,18,116,68,50,130,4,65,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,51,114,119,148,85,146,81,184,64,106,78,146,25,135,200,50,201,168,225,228,128,100,134,239,160,179,65,50,242,215,207,205,64,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,153,145,236,30,171,36,163,144,226,51,39,201,140,67,100,153,100,212,112,114,64,50,195,89,130,54,72,70,62,65,112,6,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,32,201,144,211,33,94,234,20,254,96,153,100,122,178,185,137,118,183,115,175,100,20,33,50,79,50,19,112,178,73,50,68,173,86,58,149,218,88,169,147,76,35,113,186,165,24,39,25,89,56,12,147,140,14,38,86,72,6,83,15,86,19,227,136,26,201,116,36,78,182,9,163,36,163,4,135,57,146,209,198,196,25,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,
-36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,181,2,152,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,50,178,113,199,75,157,194,31,44,147,76,79,54,15,18,29,61,204,146,140,34,68,230,73,102,2,78,54,73,134,168,213,74,167,82,27,43,117,146,105,36,78,183,20,227,36,35,11,135,97,146,209,193,196,10,201,224,169,208,106,98,28,81,35,153,142,196,201,54,97,148,100,148,224,48,71,50,218,152,56,35,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,140,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,178,86,0,115,156,93,214,147,237,103,118,153,34,68,150,73,198,159,236,178,50,188,57,204,46,107,36,122,152,93,38,11,135,29,146,153,63,187,140,9,111,142,178,203,58,18,253,202,46,83,130,195,10,201,248,147,93,70,214,84,188,212,41,252,193,50,201,244,100,243,32,209,209,195,44,201,40,66,100,158,100,38,224,100,147,100,136,90,173,116,42,181,177,82,39,153,70,226,116,75,49,78,50,178,112,24,38,25,29,76,172,144,12,110,216,173,38,198,17,53,146,233,72,156,108,19,70,73,70,9,14,115,36,163,141,137,51,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,132,238,120,169,83,14,86,50,61,217,126,174,100,20,33,50,79,50,19,112,178,73,50,68,173,86,58,149,237,149,76,35,209,195,149,140,44,28,134,73,70,7,19,43,36,131,107,169,213,196,56,162,70,50,29,137,126,173,100,148,224,48,71,50,
-218,152,56,35,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,140,227,236,178,158,236,175,128,100,230,200,46,155,128,147,3,146,113,152,93,214,72,244,151,100,92,103,151,233,96,98,155,100,28,101,151,117,36,122,75,50,46,179,203,180,49,113,70,50,142,179,203,122,178,253,204,46,83,132,200,50,201,248,147,93,86,134,55,135,217,101,141,68,15,179,203,100,225,176,67,50,243,103,151,49,225,205,81,118,89,71,162,95,217,101,74,112,88,33,25,127,178,203,136,38,188,212,41,7,36,211,147,237,39,201,40,66,100,158,100,38,224,100,147,100,136,90,173,116,42,219,36,211,72,244,144,100,100,225,48,76,50,58,152,88,33,25,164,185,213,196,56,162,70,50,29,137,126,145,140,18,28,230,72,70,27,19,103,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,142,179,203,122,178,191,2,146,153,35,187,108,2,78,14,72,198,97,118,89,35,209,95,146,113,157,93,166,131,137,109,146,113,148,93,214,145,232,45,201,184,204,46,211,198,196,28,201,212,154,253,175,58,130,145,28,4,94,238,20,254,221,209,229,205,187,23,226,232,254,191,184,44,3,16,196,155,40,88,61,4,127,68,89,202,96,51,160,1,15,25,29,109,36,237,69,168,226,46,221,244,2,190,34,92,98,160,218,82,135,172,72,74,13,121,204,20,209,146,215,243,127,45,216,180,150,86,158,149,218,232,129,58,159,213,44,169,43,119,186,5,161,14,70,237,71,13,26,17,40,154,86,163,143,143,18,50,42,182,66,245,88,77,140,59,159,209,116,149,108,165,39,119,178,173,16,29,76,218,138,34,52,34,80,244,108,101,2,62,74,200,140,107,55,70,21,108,62,197,60,100,37,74,173,240,146,172,198,225,114,66,86,106,152,57,35,43,38,95,203,41,89,9,18,182,124,34,171,81,104,108,146,149,18,62,110,200,74,59,238,76,36,43,35,209,198,46,89,105,196,24,115,100,53,49,178,216,37,43,54,47,99,30,178,18,165,104,120,73,86,227,112,57,33,43,53,204,156,145,21,147,247,229,148,172,4,137,95,62,145,213,40,52,54,201,74,9,31,55,100,165,29,119,38,146,149,145,104,99,151,172,52,98,140,57,178,154,24,89,236,146,21,155,223,49,15,89,137,82,61,188,36,171,113,184,156,144,149,26,102,206,200,138,201,31,115,74,86,130,4,50,159,200,106,20,26,155,100,165,132,143,27,178,210,142,59,19,201,202,72,180,177,75,86,26,49,198,28,89,77,140,44,118,201,106,228,22,34,7,100,165,112,33,209,252,100,53,14,151,19,178,82,195,204,25,89,13,223,114,102,143,172,
-228,175,57,155,141,172,70,161,177,73,86,74,248,184,33,43,237,184,51,145,172,140,68,27,187,100,165,17,99,204,145,213,196,200,98,151,172,70,242,77,28,144,149,66,234,201,252,100,53,14,151,19,178,82,195,204,25,89,13,231,179,217,35,43,249,132,182,217,200,106,20,26,155,100,165,132,143,27,178,210,142,59,19,201,202,72,180,177,75,86,26,49,198,28,89,77,140,44,198,201,138,156,161,205,154,13,216,211,192,231,109,64,69,184,108,145,213,4,204,236,147,21,81,110,134,108,192,70,174,183,219,128,178,208,88,33,43,29,124,44,146,21,38,122,204,145,13,216,145,235,227,54,160,18,52,166,201,74,27,31,199,100,197,166,158,224,223,238,201,74,148,127,162,163,141,117,178,26,135,203,9,89,169,97,230,140,172,152,148,55,181,209,155,72,86,130,108,55,117,29,236,145,213,40,52,54,201,74,9,31,55,100,165,29,119,38,146,149,145,104,99,151,172,52,98,140,57,178,154,24,89,236,146,21,155,122,50,15,89,137,242,79,188,36,171,113,184,156,144,149,26,102,206,200,138,73,121,115,74,86,130,108,55,159,200,106,20,26,155,100,165,132,143,27,178,210,142,59,19,201,202,72,180,177,75,86,26,49,198,28,89,77,140,44,118,201,138,77,61,153,135,172,68,249,39,94,146,213,56,92,78,200,74,13,51,103,100,197,164,188,57,37,43,65,182,155,79,100,53,10,141,77,178,82,194,199,13,89,105,199,157,137,100,101,36,218,216,37,171,255,183,189,55,108,146,219,54,214,133,63,219,191,130,78,213,169,172,114,214,178,165,243,126,138,45,85,217,142,94,199,117,21,59,71,118,116,115,238,173,212,214,236,12,119,53,199,179,51,235,25,238,74,202,175,127,1,146,67,130,36,128,70,55,30,128,204,91,39,85,177,118,102,200,238,70,247,131,110,116,19,108,8,124,12,46,88,69,122,150,180,193,106,150,221,128,19,9,150,188,27,144,169,174,44,193,106,105,187,1,91,167,152,125,55,96,207,119,177,187,1,67,85,147,50,88,45,101,55,160,225,20,179,238,6,28,241,93,226,110,64,150,106,18,6,171,165,237,6,28,184,189,89,118,3,78,36,88,242,110,64,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,238,6,12,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,187,1,89,170,73,24,172,150,182,27,176,46,75,206,186,27,112,34,193,146,119,3,50,213,149,42,88,69,232,44,125,176,170,133,155,97,55,96,207,119,177,187,1,67,85,147,36,88,73,244,147,48,88,233,103,103,115,236,6,28,241,93,226,110,64,150,106,208,193,74,172,159,204,193,106,150,221,128,19,9,150,252,204,138,169,174,44,193,106,105,187,1,91,167,152,125,55,96,207,119,177,207,172,66,85,147,50,88,45,101,55,160,225,20,179,238,6,28,241,93,226,51,43,150,106,18,6,171,165,237,6,28,184,61,115,235,137,254,59,127,176,114,237,63,145,72,147,60,88,209,234,202,18,172,120,58,203,22,172,140,45,111,60,235,69,6,43,199,110,55,190,12,233,130,21,169,154,148,193,138,165,159,60,193,74,236,119,34,131,21,196,219,164,13,86,2,31,131,11,86,145,158,37,109,176,50,183,158,204,19,172,92,251,79,22,25,172,104,117,101,9,86,60,157,101,11,86,198,150,183,172,193,202,177,219,109,73,193,138,84,77,202,96,197,210,79,158,96,37,246,59,145,193,10,226,109,210,6,43,129,143,193,5,171,72,207,146,54,88,205,178,27,112,34,193,146,119,3,50,213,149,37,88,45,109,55,96,235,20,179,239,6,236,249,46,118,55,96,168,106,82,6,171,165,236,6,52,156,98,214,221,128,35,190,75,220,13,200,82,77,194,96,181,180,221,128,3,183,55,203,110,192,137,4,75,222,13,200,84,87,150,96,181,180,221,128,173,83,204,190,27,176,231,187,216,221,128,161,170,73,25,172,150,178,27,208,112,138,89,119,3,142,248,46,113,55,32,75,53,9,131,213,210,118,3,214,153,222,172,187,1,39,18,44,121,55,32,83,93,169,130,85,132,206,210,7,171,90,184,25,118,3,246,124,23,187,27,48,84,53,73,130,149,68,63,9,131,149,46,71,206,177,27,112,196,119,137,187,1,89,170,65,7,43,177,126,50,7,171,89,118,3,78,36,88,242,110,64,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,238,6,
-12,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,187,1,89,170,73,24,172,150,182,27,112,224,246,102,217,13,56,145,96,201,27,44,152,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,193,34,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,110,176,96,169,38,97,176,90,218,110,192,129,219,51,183,158,232,191,243,7,43,215,254,19,137,52,201,131,21,173,174,44,193,138,167,179,108,193,202,216,242,198,179,94,100,176,114,236,118,227,203,144,46,88,145,170,73,25,172,88,250,201,19,172,196,126,39,50,88,65,188,77,218,96,37,240,49,184,96,21,233,89,210,6,171,89,118,3,78,36,88,242,110,64,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,238,6,12,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,187,1,89,170,73,24,172,150,182,27,112,224,246,102,217,13,56,145,96,201,187,1,153,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,27,48,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,238,6,100,169,38,97,176,90,218,110,192,58,120,218,182,183,101,203,172,38,18,44,57,179,98,170,43,85,176,138,208,89,250,96,85,11,55,216,242,150,39,179,234,249,46,54,179,10,85,77,146,96,37,209,79,194,96,165,51,188,235,72,191,35,9,86,35,190,75,204,172,88,170,65,7,43,177,126,50,7,43,115,235,201,60,193,202,181,255,100,145,193,138,86,87,150,96,197,211,89,182,96,101,108,121,203,26,172,28,187,221,150,20,172,72,213,164,12,86,44,253,228,9,86,98,191,19,25,172,32,222,38,109,176,18,248,24,92,176,138,244,44,105,131,149,185,245,100,158,96,229,218,127,178,200,96,69,171,43,75,176,226,233,44,91,176,50,182,188,101,13,86,142,221,110,75,10,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,122,50,79,176,114,237,63,89,100,176,162,213,149,37,88,241,116,150,45,88,25,91,222,178,6,43,199,110,183,37,5,43,82,53,41,131,21,75,63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,53,203,110,192,137,4,255,50,193,106,190,221,128,17,58,203,22,172,178,239,6,236,249,46,61,88,205,179,27,80,162,159,60,193,42,235,110,192,17,223,133,7,171,252,187,1,197,250,201,28,172,102,217,13,56,145,96,201,187,1,153,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,27,48,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,238,6,100,169,38,97,176,90,218,110,192,90,30,219,246,182,108,193,106,34,193,146,131,21,83,93,169,130,85,132,206,210,7,171,90,184,193,150,183,60,193,170,231,187,216,96,21,170,154,36,193,74,162,159,132,193,74,7,205,235,72,191,35,9,86,35,190,75,12,86,44,213,160,131,149,88,63,153,131,149,185,245,100,158,96,229,218,127,178,200,96,69,171,43,75,176,226,233,44,91,176,50,182,188,101,13,86,142,221,110,75,10,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,122,50,79,176,114,237,63,89,100,176,162,213,149,37,88,241,116,150,45,88,25,91,222,178,6,43,199,110,183,37,5,43,82,53,41,131,21,75,63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,101,110,61,153,39,88,185,246,159,44,50,88,209,234,202,18,172,120,58,203,22,172,140,45,111,89,131,149,99,183,219,146,130,21,169,154,148,193,138,165,159,60,193,74,236,119,34,131,21,196,219,164,13,86,2,31,131,11,86,145,158,37,109,176,50,183,158,204,19,172,92,251,79,22,25,172,104,117,101,9,86,60,157,101,11,86,198,150,183,172,193,202,177,219,109,73,193,138,84,77,202,96,197,210,79,158,96,37,246,59,145,193,10,226,109,210,6,43,129,143,193,5,171,72,207,146,54,88,205,178,27,112,34,193,191,76,176,154,111,55,96,132,206,178,5,171,236,187,1,123,190,75,15,86,243,236,6,148,232,39,79,176,202,186,27,112,196,119,225,193,42,255,110,64,177,126,208,193,170,147,79,
-221,219,121,190,235,173,217,104,110,219,71,114,253,247,72,166,111,126,180,122,59,245,181,242,119,198,248,189,244,173,135,79,50,121,89,117,48,22,192,96,249,168,255,225,50,171,121,189,165,168,198,12,167,225,16,50,152,134,213,181,216,74,111,27,197,81,84,35,6,211,114,112,13,198,142,13,189,223,40,240,228,101,17,246,198,244,3,15,62,133,97,79,179,164,142,6,230,99,175,163,26,51,28,22,246,20,171,107,177,149,156,216,27,82,141,24,140,4,123,245,246,129,192,131,84,37,216,155,208,15,60,199,16,133,189,154,37,117,210,39,27,123,61,213,152,225,112,176,167,89,93,139,173,228,194,222,136,106,196,96,36,216,171,159,6,6,158,139,40,193,222,132,126,224,177,100,40,236,213,44,169,131,251,216,216,235,169,198,12,135,131,61,205,234,90,108,37,23,246,70,84,35,6,35,193,30,231,152,51,9,246,164,231,151,161,176,23,116,14,23,27,123,236,3,182,162,177,23,126,80,20,7,123,178,19,160,36,216,235,24,27,85,22,78,174,241,211,27,27,28,126,122,51,68,158,143,120,224,98,214,195,136,178,84,95,10,8,202,50,108,156,52,163,183,4,201,136,129,212,228,3,134,193,201,47,44,124,222,214,250,34,72,202,135,209,144,39,221,156,9,6,70,102,193,71,154,48,173,192,32,45,36,167,96,34,141,155,80,68,34,45,56,155,8,71,154,40,149,128,32,141,147,71,176,145,38,77,34,32,72,11,202,32,120,72,99,167,15,113,72,11,207,29,130,145,38,75,28,32,72,227,100,13,108,164,73,83,6,8,210,130,242,5,30,210,216,201,66,28,210,194,51,133,96,164,201,210,4,8,210,56,57,2,27,105,210,4,1,130,180,160,236,128,135,52,118,106,16,135,180,240,188,32,24,105,178,164,128,143,180,142,235,7,97,78,240,119,59,6,254,62,70,219,7,64,90,224,229,69,89,234,3,51,51,176,50,171,121,189,165,168,198,12,167,225,16,50,24,78,126,240,119,43,50,254,62,66,222,135,136,20,193,195,129,116,115,31,132,89,130,8,123,194,68,1,134,189,144,92,129,143,61,110,186,16,143,189,224,140,129,133,61,81,210,128,194,30,39,111,144,96,79,154,58,160,176,23,148,61,176,177,199,78,32,162,177,23,158,67,112,176,39,75,35,80,216,227,100,18,18,236,73,147,9,20,246,130,242,9,54,246,216,41,69,52,246,194,179,10,14,246,100,137,5,10,123,156,220,66,130,61,105,122,129,194,94,80,134,193,198,30,59,201,136,198,94,120,158,193,193,158,44,213,144,96,175,99,252,245,215,162,245,222,235,159,255,236,222,13,251,245,215,245,158,211,227,106,123,42,251,205,104,135,135,170,56,220,168,111,247,183,101,113,42,215,135,253,166,56,220,151,234,243,198,80,132,79,158,192,53,8,45,155,99,147,152,72,224,221,233,221,100,191,44,83,147,30,29,122,100,240,109,177,11,18,42,92,157,92,69,10,165,214,182,103,44,205,61,118,214,210,189,141,64,160,112,41,79,73,148,12,119,60,173,57,245,133,64,155,92,117,60,165,201,49,198,201,152,220,22,125,91,207,0,57,198,164,25,22,37,81,42,140,49,181,230,212,23,0,99,17,170,227,41,141,41,43,25,196,204,20,105,9,65,213,149,92,45,63,168,210,154,156,33,168,242,212,57,87,80,53,106,14,51,6,85,71,141,98,177,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,214,126,150,16,84,93,85,163,229,7,85,90,147,51,4,85,158,58,231,10,170,70,49,117,198,160,234,40,190,46,54,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,203,26,84,205,162,246,18,130,170,171,28,190,252,160,74,107,114,134,160,202,83,231,92,65,213,120,74,52,99,80,117,60,85,90,108,80,37,181,150,47,168,178,84,55,75,80,21,251,57,104,80,133,120,183,140,65,85,224,211,82,5,213,72,79,150,58,168,14,246,25,153,85,115,203,254,149,28,65,117,34,79,224,222,154,249,131,42,83,147,121,130,106,132,58,179,7,213,118,115,152,241,116,144,103,103,76,80,237,165,136,71,94,142,160,26,170,181,12,65,85,162,186,124,65,213,216,179,39,246,115,241,65,117,36,69,52,198,82,7,85,150,214,210,6,85,177,234,230,13,170,196,
-182,211,236,65,149,177,97,117,97,65,149,214,228,12,65,149,167,206,185,130,170,127,31,119,174,160,26,190,239,123,25,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,86,205,151,16,84,93,165,243,229,7,85,90,147,51,4,85,158,58,231,10,170,198,211,193,25,131,170,227,193,224,98,131,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,213,172,154,47,33,168,186,74,231,203,15,170,180,38,103,8,170,60,117,206,21,84,141,167,131,51,6,85,199,131,193,197,6,85,82,107,249,130,42,75,117,179,4,85,177,159,131,6,85,136,119,203,24,84,5,62,45,85,80,141,244,100,169,131,234,224,253,121,179,106,110,121,47,59,71,80,157,200,19,248,206,248,252,65,149,169,201,60,65,53,66,157,217,131,106,219,244,192,120,58,200,179,51,38,168,246,82,196,35,47,71,80,13,213,90,134,160,42,81,93,190,160,106,244,162,16,251,185,248,160,58,146,34,26,99,169,131,42,75,107,105,131,170,88,117,243,6,85,179,106,190,132,160,234,42,157,47,63,168,210,154,156,33,168,242,212,57,87,80,53,158,14,206,24,84,29,15,6,23,27,84,73,173,229,11,170,44,213,205,18,84,197,126,14,26,84,33,222,45,99,80,21,248,180,84,65,53,210,147,101,13,170,68,143,178,236,65,149,209,221,108,97,65,149,214,228,12,65,149,167,206,185,130,170,191,233,95,174,160,26,222,36,112,25,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,86,205,151,16,84,93,165,243,229,7,85,90,147,51,4,85,158,58,231,10,170,198,211,193,25,131,170,227,193,224,98,131,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,212,65,117,208,23,218,172,154,91,250,13,231,8,170,19,121,2,123,33,207,31,84,153,154,204,19,84,35,212,153,61,168,182,205,188,141,167,131,60,59,99,130,106,47,69,60,242,114,4,213,80,173,101,8,170,18,213,229,11,170,70,143,117,177,159,139,15,170,35,41,162,49,150,58,168,178,180,150,54,168,138,85,55,111,80,53,171,230,75,8,170,174,210,249,242,131,42,173,201,25,130,42,79,157,115,5,85,227,233,224,140,65,213,241,96,112,177,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,86,205,151,16,84,93,165,243,229,7,85,90,147,51,4,85,158,58,231,10,170,198,211,193,25,131,170,227,193,224,98,131,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,149,56,208,46,123,80,101,28,133,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,66,100,174,160,26,126,162,228,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,50,104,80,237,164,125,249,82,116,12,232,27,95,228,122,249,82,30,85,125,242,4,54,78,166,101,67,34,239,24,121,160,234,27,123,208,106,117,40,196,224,17,120,160,170,79,64,172,199,211,182,103,28,13,234,177,179,150,238,109,4,2,133,167,130,82,18,37,195,29,79,107,78,125,33,208,38,87,29,79,105,114,140,113,142,6,125,227,137,97,122,6,200,49,38,61,21,148,146,40,21,198,152,90,115,234,11,128,177,8,213,241,148,38,77,85,93,65,140,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,149,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,149,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,
-181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,212,65,149,115,12,104,142,160,42,61,1,116,254,160,202,212,100,158,160,26,161,206,236,65,53,232,104,208,228,65,149,125,42,232,204,65,53,84,107,25,130,170,68,117,249,130,106,248,209,160,41,131,170,236,84,208,249,130,42,75,107,105,131,170,88,117,243,6,85,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,82,7,85,206,49,160,57,130,170,244,4,208,249,131,42,83,147,121,130,106,132,58,179,7,213,160,163,65,147,7,85,246,169,160,51,7,213,80,173,101,8,170,18,213,229,11,170,225,71,131,166,12,170,178,83,65,231,11,170,44,173,165,13,170,98,213,205,27,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,203,26,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,203,26,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,75,29,84,57,199,128,230,8,170,210,19,64,231,15,170,76,77,230,9,170,17,234,204,30,84,131,142,6,77,30,84,217,167,130,206,28,84,67,181,150,33,168,74,84,151,47,168,134,31,13,154,50,168,202,78,5,157,47,168,178,180,150,54,168,138,85,55,111,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,12,26,84,251,3,115,251,142,235,91,243,69,198,173,113,14,193,118,242,204,247,245,47,214,147,171,149,159,53,207,226,117,147,182,182,64,230,176,177,170,97,200,219,224,246,168,255,97,242,81,108,222,250,9,70,12,162,112,29,191,60,224,216,112,185,150,90,228,173,214,148,159,160,124,8,53,113,215,16,44,16,56,85,71,163,250,172,62,224,208,53,33,157,15,93,53,183,71,253,15,8,93,61,193,12,232,210,92,174,165,22,177,161,107,68,48,31,186,52,135,14,2,98,179,91,209,53,33,157,15,93,53,183,71,253,15,8,93,61,193,12,232,210,92,174,163,0,224,39,152,15,93,238,243,177,227,35,99,208,41,215,105,34,227,244,248,229,200,200,232,63,68,25,28,25,29,167,251,202,35,99,192,25,189,233,209,53,56,84,17,139,46,231,33,137,41,209,101,158,67,10,65,151,235,52,209,100,232,226,91,132,64,87,156,
-29,162,208,53,56,93,12,139,46,231,105,97,41,209,101,30,200,7,65,151,235,88,189,100,232,226,91,132,64,87,156,29,162,208,53,56,102,7,139,46,231,177,57,41,209,101,158,76,5,65,151,235,124,169,100,232,226,91,132,64,87,156,29,162,208,117,179,75,230,187,52,233,236,232,82,76,177,232,82,4,243,162,139,111,17,2,93,113,118,136,66,215,230,122,151,10,93,154,116,118,116,41,166,88,116,41,130,121,209,197,183,8,129,174,56,59,176,235,93,174,243,191,0,245,174,144,83,188,18,213,187,38,199,75,197,214,187,188,135,68,161,235,93,246,211,139,34,234,93,244,25,68,25,208,133,205,25,131,142,179,73,138,46,92,206,232,63,45,37,29,186,48,57,99,192,97,28,25,208,133,205,25,131,206,117,72,138,46,92,206,232,63,54,32,29,186,48,57,99,64,87,250,12,232,194,230,140,65,13,206,147,162,11,151,51,250,251,103,167,67,23,38,103,12,104,207,156,1,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,243,161,203,217,223,60,30,93,65,93,202,211,160,107,218,62,59,18,93,254,38,216,96,116,57,186,51,203,209,21,208,99,57,3,186,176,57,99,80,187,222,164,232,194,229,140,254,110,176,233,208,133,201,25,3,154,141,102,64,23,54,103,12,234,91,153,20,93,184,156,209,223,22,49,29,186,48,57,99,64,215,189,12,232,194,230,140,65,13,220,146,162,11,151,51,250,251,131,165,67,23,38,103,12,104,63,149,1,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,243,161,203,217,191,45,30,93,65,93,216,210,160,107,218,30,44,18,93,254,38,95,96,116,57,186,79,201,209,21,208,67,42,3,186,176,57,99,80,59,162,164,232,194,229,140,254,110,55,233,208,133,201,25,3,154,169,100,64,23,54,103,12,234,203,145,20,93,184,156,209,223,246,33,29,186,48,57,99,64,87,129,12,232,194,230,140,65,47,168,39,69,23,46,103,244,191,255,156,14,93,152,156,49,224,245,218,12,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,103,66,23,54,103,156,144,206,142,46,92,206,216,19,204,139,46,76,206,56,34,152,15,93,53,150,211,228,140,19,210,249,208,85,179,70,230,140,61,193,12,232,210,30,18,154,51,142,8,206,132,46,108,206,56,33,157,29,93,184,156,177,39,152,23,93,152,156,113,68,112,38,116,97,115,198,9,233,236,232,194,229,140,61,193,188,232,194,228,140,35,130,51,161,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,243,161,171,230,150,38,103,156,144,206,135,174,154,53,50,103,236,9,102,64,151,198,48,52,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,103,66,23,54,103,156,144,206,142,46,92,206,216,19,204,139,46,76,206,56,34,56,19,186,176,57,227,132,116,118,116,225,114,198,158,96,94,116,97,114,198,17,193,153,208,133,205,25,39,164,179,163,11,151,51,246,4,243,162,11,147,51,142,8,166,66,87,207,243,133,172,167,248,43,171,225,95,140,0,246,34,190,171,184,155,17,105,159,23,188,190,226,175,108,48,120,49,4,217,11,121,103,113,23,249,128,97,176,122,139,191,178,65,225,197,16,104,47,228,221,197,93,228,105,71,246,66,214,95,156,139,52,113,135,113,4,210,194,122,140,179,144,198,239,50,30,133,52,70,159,241,80,164,9,59,141,35,144,198,234,53,206,69,154,184,219,56,2,105,97,253,198,89,72,227,119,28,143,66,26,163,231,120,40,210,132,93,199,17,72,99,245,29,103,71,79,105,231,113,72,244,12,234,61,206,139,158,236,238,227,113,209,51,188,255,120,112,244,148,117,32,135,35,141,170,246,69,33,141,83,249,3,34,141,168,193,74,144,198,168,194,162,144,198,183,12,137,180,56,123,68,34,
-141,170,252,69,33,141,83,5,4,34,141,168,199,74,144,198,168,200,162,144,198,183,12,137,180,56,123,68,34,141,170,2,70,33,141,83,17,4,34,141,168,205,74,144,198,168,206,162,144,198,183,12,137,180,56,123,68,34,141,170,8,70,33,141,83,29,4,34,141,168,211,74,144,198,168,212,162,144,198,183,12,137,180,56,123,68,34,141,170,14,70,33,141,83,41,4,34,141,168,217,74,144,198,168,218,162,144,198,183,12,137,180,56,123,8,234,105,156,254,229,236,122,154,180,131,57,164,158,22,212,195,156,87,79,99,119,49,143,171,167,133,247,49,15,174,167,201,58,153,195,145,134,206,61,197,221,204,129,72,67,230,158,252,142,230,40,164,161,114,79,97,87,115,56,210,208,185,167,184,179,57,16,105,200,220,147,223,221,28,133,52,84,238,41,236,112,14,71,26,58,247,20,119,57,7,34,13,153,123,242,59,157,163,144,134,202,61,133,221,206,225,72,67,231,158,226,142,231,64,164,33,115,79,126,215,115,20,210,80,185,167,176,243,57,28,105,232,220,83,220,253,28,136,52,100,238,201,239,128,142,66,26,42,247,20,118,65,71,32,141,213,7,157,139,52,113,39,116,4,210,194,122,161,179,144,198,239,134,30,133,52,70,63,244,80,164,9,59,162,195,145,134,206,61,197,93,209,129,72,67,230,158,252,206,232,40,164,161,114,79,97,119,116,56,210,208,185,167,184,67,58,16,105,200,220,147,223,37,29,133,52,84,238,41,236,148,14,71,26,58,247,20,119,75,7,34,13,153,123,242,59,166,163,144,134,202,61,133,93,211,225,72,67,231,158,226,206,233,64,164,33,115,79,126,247,116,20,210,80,185,167,176,131,58,28,105,232,220,83,220,69,29,136,52,100,238,201,239,164,142,66,26,42,247,20,118,83,71,32,141,213,79,157,139,52,113,71,117,4,210,194,122,170,179,144,198,239,170,30,133,52,70,95,245,80,164,9,59,171,195,145,134,206,61,197,221,213,129,72,67,230,158,252,14,235,40,164,161,114,79,97,151,117,56,210,208,185,167,184,211,58,16,105,200,220,147,223,109,29,133,52,84,238,41,236,184,14,71,26,58,247,20,119,93,7,34,13,153,123,242,59,175,163,144,134,202,61,133,221,215,225,72,67,231,158,226,14,236,64,164,33,115,79,126,23,118,20,210,80,185,167,176,19,59,28,105,232,220,83,220,141,29,136,52,100,238,201,239,200,142,66,26,42,247,20,118,101,71,32,141,213,151,157,139,52,113,103,118,4,210,194,122,179,179,144,198,239,206,30,133,52,70,127,246,80,164,9,59,180,195,145,134,206,61,197,93,218,129,72,67,230,158,252,78,237,40,164,161,114,79,97,183,118,56,210,208,185,167,184,99,59,16,105,200,220,147,223,181,29,133,52,84,238,41,236,220,14,71,26,58,247,20,119,111,7,34,13,153,123,242,59,184,163,144,134,202,61,133,93,220,225,72,67,231,158,226,78,238,64,164,33,115,79,126,55,119,20,210,80,185,167,176,163,59,28,105,232,220,83,220,213,29,136,52,100,238,201,239,236,142,66,26,42,247,20,118,119,71,32,141,213,223,157,139,52,113,135,119,4,210,194,122,188,179,144,198,239,242,30,133,52,70,159,247,80,164,9,59,189,195,145,134,206,61,197,221,222,129,72,67,230,158,252,142,239,40,164,161,114,79,97,215,119,56,210,208,185,167,184,243,59,16,105,200,220,147,223,253,29,133,52,84,238,41,236,0,15,71,26,58,247,20,119,129,7,34,13,153,123,242,59,193,163,144,134,202,61,133,221,224,225,72,67,231,158,226,142,240,64,164,33,115,79,126,87,120,20,210,80,185,167,176,51,60,28,105,232,220,83,220,29,30,136,52,100,238,201,239,16,143,66,26,42,247,20,118,137,103,35,173,227,250,82,212,37,254,123,235,241,0,47,135,64,123,25,221,35,222,205,134,178,207,75,86,135,120,27,31,197,230,173,159,96,196,32,52,113,122,8,156,238,240,223,219,14,10,120,57,0,216,75,113,111,120,23,113,210,145,189,20,117,134,103,162,75,218,23,30,128,174,160,174,240,28,116,177,123,194,199,160,43,188,35,124,32,186,100,253,224,1,232,226,116,131,103,162,75,218,11,30,128,174,160,78,240,28,116,177,251,192,199,160,43,188,11,124,32,186,100,61,224,1,232,226,116,128,231,70,70,97,255,119,68,100,12,233,254,206,138,140,220,222,239,81,145,49,184,243,123,104,100,20,245,125,
-71,163,139,168,247,197,160,139,81,247,195,161,203,95,133,21,160,43,188,6,11,66,23,223,34,4,186,226,236,16,133,46,162,198,23,131,46,70,173,15,135,46,127,229,85,128,174,240,186,43,8,93,124,139,16,232,138,179,67,20,186,136,186,94,12,186,24,245,61,28,186,252,213,86,1,186,194,107,173,32,116,241,45,66,160,43,206,14,81,232,34,106,121,49,232,98,212,244,112,232,242,87,88,5,232,10,175,175,130,208,197,183,8,129,174,56,59,68,161,139,168,223,197,160,139,81,199,195,161,203,95,85,21,160,43,188,166,10,66,23,223,34,4,186,226,236,192,174,119,49,58,183,115,235,93,194,190,237,136,122,87,72,215,118,86,189,139,219,179,61,170,222,21,220,177,61,180,222,37,234,215,142,70,23,54,103,148,246,106,199,161,11,151,51,178,251,180,131,208,133,201,25,101,61,218,209,232,194,230,140,210,254,236,56,116,225,114,70,118,111,118,16,186,48,57,163,172,47,59,26,93,216,156,81,218,147,29,135,46,92,206,200,238,199,14,66,23,38,103,148,245,98,71,163,11,155,51,74,251,176,227,208,133,203,25,217,61,216,65,232,194,228,140,178,254,235,104,116,97,115,70,105,239,117,28,186,112,57,35,187,239,58,8,93,152,156,81,214,115,29,128,46,78,199,117,38,186,164,253,214,1,232,10,234,182,206,65,23,187,215,122,12,186,194,59,173,7,162,75,214,103,29,141,46,108,206,40,237,177,142,67,23,46,103,100,247,87,7,161,11,147,51,202,122,171,163,209,133,205,25,165,125,213,113,232,194,229,140,236,158,234,32,116,97,114,70,89,63,117,52,186,176,57,163,180,151,58,14,93,184,156,145,221,71,29,132,46,76,206,40,235,161,142,70,23,54,103,148,246,79,199,161,11,151,51,178,123,167,131,208,133,201,25,101,125,211,209,232,194,230,140,210,158,233,56,116,225,114,70,118,191,116,16,186,48,57,163,172,87,58,0,93,156,78,233,76,116,73,251,164,3,208,21,212,37,157,131,46,118,143,244,24,116,133,119,72,15,68,151,172,63,58,26,93,216,156,81,218,27,29,135,46,92,206,200,238,139,14,66,23,38,103,148,245,68,71,163,11,155,51,74,251,161,227,208,133,203,25,217,189,208,65,232,194,228,140,178,62,232,104,116,97,115,70,105,15,116,28,186,112,57,35,187,255,57,8,93,152,156,81,214,251,28,141,46,108,206,40,237,123,142,67,23,46,103,100,247,60,7,161,11,147,51,202,250,157,163,209,133,205,25,165,189,206,113,232,194,229,140,236,62,231,32,116,97,114,70,89,143,115,0,186,56,29,206,153,232,146,246,55,7,160,43,168,187,57,7,93,236,222,230,49,232,10,239,108,30,136,46,89,95,115,52,186,176,57,163,180,167,57,14,93,184,156,145,221,207,28,132,46,76,206,40,235,101,142,70,23,54,103,148,246,49,199,161,11,151,51,178,123,152,131,208,133,201,25,101,253,203,209,232,194,230,140,210,222,229,56,116,225,114,70,118,223,114,16,186,48,57,163,172,103,57,26,93,216,156,81,218,175,28,135,46,92,206,200,238,85,14,66,23,38,103,148,245,41,71,163,11,155,51,74,123,148,227,208,133,203,25,217,253,201,65,232,194,228,140,178,222,228,0,116,113,58,147,51,209,37,237,75,14,64,87,80,87,114,14,186,216,61,201,99,208,21,222,145,60,16,93,178,126,228,104,116,97,115,70,105,47,114,28,186,112,57,35,187,15,57,8,93,152,156,81,214,131,28,141,46,108,206,40,237,63,142,67,23,46,103,100,247,30,7,161,11,147,51,202,250,142,163,209,133,205,25,165,61,199,113,232,194,229,140,236,126,227,32,116,97,114,70,89,175,113,52,186,176,57,163,180,207,56,14,93,184,156,145,221,99,28,132,46,76,206,40,235,47,142,70,23,54,103,148,246,22,199,161,11,151,51,178,251,138,131,208,133,201,25,101,61,197,217,232,234,121,190,144,245,20,183,54,149,127,57,234,94,239,35,30,58,50,55,35,210,62,47,120,125,197,109,237,229,95,14,187,215,219,72,70,12,164,38,31,48,12,86,111,113,91,123,249,151,195,238,245,54,146,242,97,52,228,105,71,246,66,214,95,156,139,52,113,135,113,4,210,194,122,140,179,144,198,239,50,30,133,52,70,159,241,80,164,9,59,141,35,144,198,234,53,206,69,154,184,219,56,2,105,97,253,198,89,72,227,119,28,143,66,26,163,231,120,40,210,132,93,
-199,17,72,99,245,29,103,71,79,105,231,113,72,244,12,234,61,206,139,158,236,238,227,113,209,51,188,255,120,112,244,148,117,32,135,35,141,170,246,69,33,141,83,249,3,34,141,168,193,74,144,198,168,194,162,144,198,183,12,137,180,56,123,68,34,141,170,252,69,33,141,83,5,4,34,141,168,199,74,144,198,168,200,162,144,198,183,12,137,180,56,123,68,34,141,170,2,70,33,141,83,17,4,34,141,168,205,74,144,198,168,206,162,144,198,183,12,137,180,56,123,68,34,141,170,8,70,33,141,83,29,4,34,141,168,211,74,144,198,168,212,162,144,198,183,12,137,180,56,123,68,34,141,170,14,70,33,141,83,41,4,34,141,168,217,74,144,198,168,218,162,144,198,183,12,137,180,56,123,8,234,105,156,254,229,236,122,154,180,131,57,164,158,22,212,195,156,87,79,99,119,49,143,171,167,133,247,49,15,174,167,201,58,153,195,145,134,206,61,197,221,204,129,72,67,230,158,252,142,230,40,164,161,114,79,97,87,115,56,210,208,185,167,184,179,57,16,105,200,220,147,223,221,28,133,52,84,238,41,236,112,14,71,26,58,247,20,119,57,7,34,13,153,123,242,59,157,163,144,134,202,61,133,221,206,225,72,67,231,158,226,142,231,64,164,33,115,79,126,215,115,20,210,80,185,167,176,243,57,28,105,232,220,83,220,253,28,136,52,100,238,201,239,128,142,66,26,42,247,20,118,65,71,32,141,213,7,157,139,52,113,39,116,4,210,194,122,161,179,144,198,239,134,30,133,52,70,63,244,80,164,9,59,162,195,145,134,206,61,197,93,209,129,72,67,230,158,252,206,232,40,164,161,114,79,97,119,116,56,210,208,185,167,184,67,58,16,105,200,220,147,223,37,29,133,52,84,238,41,236,148,14,71,26,58,247,20,119,75,7,34,13,153,123,242,59,166,163,144,134,202,61,133,93,211,225,72,67,231,158,226,206,233,64,164,33,115,79,126,247,116,20,210,80,185,167,176,131,58,28,105,232,220,83,220,69,29,136,52,100,238,201,239,164,142,66,26,42,247,20,118,83,71,32,141,213,79,157,139,52,113,71,117,4,210,194,122,170,179,144,198,239,170,30,133,52,70,95,245,80,164,9,59,171,195,145,134,206,61,197,221,213,129,72,67,230,158,252,14,235,40,164,161,114,79,97,151,117,56,210,208,185,167,184,211,58,16,105,200,220,147,223,109,29,133,52,84,238,41,236,184,14,71,26,58,247,20,119,93,7,34,13,153,123,242,59,175,163,144,134,202,61,133,221,215,225,72,67,231,158,226,14,236,64,164,33,115,79,126,23,118,20,210,80,185,167,176,19,59,28,105,232,220,83,220,141,29,136,52,100,238,201,239,200,142,66,26,42,247,20,118,101,71,32,141,213,151,157,139,52,113,103,118,4,210,194,122,179,179,144,198,239,206,30,133,52,70,127,246,80,164,9,59,180,195,145,134,206,61,197,93,218,129,72,67,230,158,252,78,237,40,164,161,114,79,97,183,118,56,210,208,185,167,184,99,59,16,105,200,220,147,223,181,29,133,52,84,238,41,236,220,14,71,26,58,247,20,119,111,7,34,13,153,123,242,59,184,163,144,134,202,61,133,93,220,225,72,67,231,158,226,78,238,64,164,33,115,79,126,55,119,20,210,80,185,167,176,163,59,28,105,232,220,83,220,213,29,136,52,100,238,201,239,236,142,66,26,42,247,20,118,119,71,32,141,213,223,157,139,52,113,135,119,4,210,194,122,188,179,144,198,239,242,30,133,52,70,159,247,80,164,9,59,189,195,145,134,206,61,197,221,222,129,72,67,230,158,252,142,239,40,164,161,114,79,97,215,119,56,210,208,185,167,184,243,59,16,105,200,220,147,223,253,29,133,52,84,238,41,236,0,15,71,26,58,247,20,119,129,7,34,13,153,123,242,59,193,163,144,134,202,61,133,221,224,225,72,67,231,158,226,142,240,64,164,33,115,79,126,87,120,20,210,80,185,167,176,51,60,28,105,232,220,83,220,29,30,136,52,100,238,201,239,16,143,66,26,42,247,20,118,137,103,35,173,227,250,66,214,38,254,213,127,218,16,240,98,4,181,23,241,109,226,61,140,40,27,189,224,181,137,183,113,210,140,222,18,36,35,6,82,147,15,24,6,167,77,188,133,207,219,90,95,4,73,249,48,26,242,164,83,123,33,107,19,207,70,154,180,77,60,4,105,65,109,226,121,72,99,183,137,143,67,90,120,155,248,96,164,201,218,196,67,144,
-198,105,19,207,70,154,180,77,60,4,105,65,109,226,121,72,99,183,137,143,67,90,120,155,248,96,164,201,218,196,67,144,198,105,19,207,143,158,194,54,241,152,232,25,210,38,158,25,61,185,109,226,35,163,103,112,155,248,240,232,41,106,19,143,71,26,81,32,140,67,26,163,84,136,68,154,191,116,43,66,90,120,233,22,134,52,190,101,72,164,197,217,35,18,105,68,129,48,14,105,140,82,33,18,105,254,210,173,8,105,225,165,91,24,210,248,150,33,145,22,103,143,72,164,17,5,194,56,164,49,74,133,72,164,249,75,183,34,164,133,151,110,97,72,227,91,134,68,90,156,61,34,145,70,20,8,227,144,198,40,21,34,145,230,47,221,138,144,22,94,186,133,33,141,111,25,18,105,113,246,136,68,26,81,32,140,67,26,163,84,136,68,154,191,116,43,66,90,120,233,22,134,52,190,101,72,164,197,217,67,80,79,99,180,137,231,215,211,132,109,226,49,245,180,144,54,241,204,122,26,183,77,124,100,61,45,184,77,124,120,61,77,212,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,4,105,156,54,241,108,164,73,219,196,67,144,22,212,38,158,135,52,118,155,248,56,164,133,183,137,15,70,154,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,8,210,56,109,226,217,72,147,182,137,135,32,45,168,77,60,15,105,236,54,241,113,72,11,111,19,31,140,52,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,16,164,113,218,196,179,145,38,109,19,15,65,90,80,155,120,30,210,216,109,226,227,144,22,222,38,62,24,105,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,33,72,227,180,137,103,35,77,218,38,30,130,180,160,54,241,60,164,177,219,196,199,33,45,188,77,124,48,210,100,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,243,145,214,113,253,76,214,38,254,71,235,65,1,159,141,160,246,89,124,155,120,15,35,202,70,159,241,218,196,219,56,105,70,111,9,146,17,3,169,201,7,12,131,211,38,254,71,219,145,1,159,13,161,246,153,188,77,188,147,60,233,
-212,62,147,181,137,103,35,77,218,38,30,130,180,160,54,241,60,164,177,219,196,199,33,45,188,77,124,48,210,100,109,226,33,72,227,180,137,103,35,77,218,38,30,130,180,160,54,241,60,164,177,219,196,199,33,45,188,77,124,48,210,100,109,226,33,72,227,180,137,231,71,79,97,155,120,76,244,12,105,19,207,140,158,220,54,241,145,209,51,184,77,124,120,244,20,181,137,199,35,141,40,16,198,33,141,81,42,68,34,205,95,186,21,33,45,188,116,11,67,26,223,50,36,210,226,236,17,137,52,162,64,24,135,52,70,169,16,137,52,127,233,86,132,180,240,210,45,12,105,124,203,144,72,139,179,71,36,210,136,2,97,28,210,24,165,66,36,210,252,165,91,17,210,194,75,183,48,164,241,45,67,34,45,206,30,145,72,35,10,132,113,72,99,148,10,145,72,243,151,110,69,72,11,47,221,194,144,198,183,12,137,180,56,123,68,34,141,40,16,198,33,141,81,42,68,34,205,95,186,21,33,45,188,116,11,67,26,223,50,36,210,226,236,33,168,167,49,218,196,243,235,105,194,54,241,152,122,90,72,155,120,102,61,141,219,38,62,178,158,22,220,38,62,188,158,38,106,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,130,52,78,155,120,54,210,164,109,226,33,72,11,106,19,207,67,26,187,77,124,28,210,194,219,196,7,35,77,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,4,105,156,54,241,108,164,73,219,196,67,144,22,212,38,158,135,52,118,155,248,56,164,133,183,137,15,70,154,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,8,210,56,109,226,217,72,147,182,137,135,32,45,168,77,60,15,105,236,54,241,113,72,11,111,19,31,140,52,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,16,164,113,218,196,179,145,38,109,19,15,65,90,80,155,120,30,210,216,109,226,227,144,22,222,38,62,24,105,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,249,72,235,184,174,239,238,3,250,196,171,228,100,196,242,187,191,252,117,194,243,243,103,95,124,249,197,
-179,98,123,163,209,240,245,23,47,94,124,241,114,8,61,47,51,235,88,99,24,83,54,172,165,113,246,145,103,115,62,51,126,59,98,225,238,241,206,101,241,182,27,27,53,10,140,46,187,17,133,104,50,172,239,188,124,200,164,211,52,193,229,238,67,159,0,201,97,125,233,51,33,217,210,167,30,136,100,87,15,121,52,146,137,214,248,169,145,28,210,215,62,19,146,221,125,238,19,32,57,172,239,125,38,36,91,250,224,3,145,236,234,81,143,70,50,209,122,63,53,146,67,250,230,103,66,178,187,143,126,138,213,69,80,95,253,92,171,139,105,159,125,228,234,194,209,3,31,190,186,240,183,246,79,190,186,8,232,203,63,7,146,7,21,218,212,72,118,214,110,243,34,217,172,173,167,65,114,148,86,3,145,236,42,231,103,68,50,204,158,8,36,15,42,192,169,145,236,172,13,231,69,178,89,187,79,131,228,40,173,6,34,217,245,184,32,35,146,97,246,68,32,121,80,97,78,141,100,103,237,57,47,146,205,103,3,105,144,28,165,213,64,36,187,30,71,100,68,50,204,158,8,36,15,42,216,169,145,236,172,109,231,69,178,249,236,33,13,146,163,180,26,136,100,215,227,142,140,72,134,217,19,129,228,65,133,60,53,146,157,181,243,188,72,54,159,109,164,65,114,148,86,3,145,236,122,156,146,17,201,48,123,74,235,201,206,115,24,82,212,147,131,206,101,200,85,79,158,158,211,128,172,39,59,206,80,128,215,147,253,71,67,36,175,39,7,156,235,48,7,146,83,215,46,194,206,125,200,139,228,68,181,11,215,25,13,137,144,60,87,237,34,228,220,136,57,144,156,186,118,17,118,174,68,94,36,39,170,93,184,206,128,72,132,228,185,106,23,33,231,82,204,129,228,212,181,139,176,115,43,242,34,57,81,237,194,117,198,68,34,36,207,85,187,8,57,247,98,14,36,167,174,93,132,157,139,145,23,201,137,106,23,174,51,44,18,33,121,174,218,69,200,185,26,115,32,57,117,237,34,236,220,141,188,72,78,84,187,112,157,145,145,8,201,115,213,46,66,206,237,200,132,100,247,57,30,9,144,28,118,174,71,38,36,91,206,249,0,34,217,117,6,7,26,201,196,209,34,169,145,28,114,46,200,28,72,78,93,187,8,59,55,36,47,146,19,213,46,92,103,124,36,66,242,92,181,139,144,115,71,230,64,114,234,218,69,216,185,36,121,145,156,168,118,225,58,67,36,17,146,231,170,93,132,156,107,50,7,146,83,215,46,194,206,61,201,139,228,68,181,11,215,25,37,137,144,60,87,237,34,228,220,148,57,144,156,186,118,17,118,174,74,94,36,39,170,93,184,206,64,73,132,228,185,106,23,33,231,178,204,129,228,212,181,139,176,115,91,242,34,57,81,237,194,117,198,74,34,36,207,85,187,8,57,247,37,19,146,221,231,192,36,64,114,216,185,48,153,144,108,57,39,6,136,100,215,25,46,104,36,19,71,211,164,70,114,200,185,50,115,32,57,117,237,34,236,220,153,188,72,78,84,187,112,157,17,147,8,201,115,213,46,66,206,173,153,3,201,169,107,23,97,231,218,228,69,114,162,218,133,235,12,154,68,72,158,171,118,17,114,46,206,28,72,78,93,187,8,59,55,39,47,146,19,213,46,92,103,220,36,66,242,92,181,139,144,115,119,230,64,114,234,218,69,216,185,60,121,145,156,168,118,225,58,67,39,17,146,231,170,93,132,156,235,51,7,146,83,215,46,194,206,253,201,139,228,68,181,11,215,25,61,137,144,60,87,237,34,228,220,160,76,72,118,159,35,148,0,201,97,231,10,101,66,178,229,156,33,32,146,93,103,0,161,145,76,28,109,148,26,201,33,231,18,205,129,228,212,181,139,176,115,139,242,34,57,81,237,194,117,198,80,34,36,207,85,187,8,57,247,104,14,36,167,174,93,132,157,139,148,23,201,137,106,23,174,51,140,18,33,121,174,218,69,200,185,74,115,32,57,117,237,34,236,220,165,188,72,78,84,187,112,157,145,148,8,201,115,213,46,66,206,109,154,3,201,169,107,23,97,231,58,229,69,114,162,218,133,235,12,166,68,72,158,171,118,17,114,46,212,28,72,78,93,187,8,59,55,42,47,146,19,213,46,92,103,60,37,66,242,92,181,139,144,115,167,50,33,217,125,14,85,2,36,135,157,75,149,9,201,150,115,170,128,72,118,157,33,133,70,50,113,52,86,106,36,135,156,107,53,7,146,83,215,46,194,206,189,202,139,228,68,181,
-11,215,25,85,137,144,60,87,237,34,228,220,172,57,144,156,186,118,17,118,174,86,94,36,39,170,93,184,206,192,74,132,228,185,106,23,33,231,114,205,129,228,212,181,139,176,115,187,242,34,57,81,237,194,117,198,86,34,36,207,85,187,8,57,247,107,14,36,167,174,93,132,157,11,150,23,201,137,106,23,174,51,188,18,33,121,174,218,69,200,185,98,115,32,57,117,237,34,236,220,177,188,72,78,84,187,112,157,17,150,8,201,115,213,46,66,206,45,75,128,228,78,138,235,178,122,95,150,251,179,54,86,251,143,87,207,254,113,185,59,12,62,190,219,154,31,61,231,169,125,251,234,151,255,253,234,213,143,189,108,223,158,25,20,175,127,42,148,24,197,159,127,40,182,251,245,238,225,180,125,44,13,101,8,196,8,60,226,141,39,18,101,180,80,57,235,191,230,84,84,253,215,178,84,212,136,52,35,150,108,2,44,84,69,249,241,51,100,157,85,45,99,225,174,78,31,21,185,234,184,93,143,196,124,124,54,252,248,156,7,165,142,172,77,222,183,207,106,121,223,62,47,46,14,199,226,113,187,46,139,199,242,120,90,61,241,169,81,38,41,79,185,177,82,7,130,145,49,148,64,112,206,170,110,1,138,23,160,232,70,234,101,227,218,38,227,191,174,162,23,137,229,161,116,203,80,110,239,165,87,143,183,23,195,103,49,106,229,106,10,179,94,237,214,234,162,94,128,149,98,178,186,45,139,195,77,177,63,236,63,223,111,119,197,227,106,247,160,136,31,110,220,139,84,7,191,145,58,226,120,187,217,60,41,46,234,197,121,81,23,157,130,88,104,213,238,31,238,174,203,35,155,219,112,80,120,206,100,232,53,228,105,31,75,100,51,170,229,249,64,10,163,54,195,202,101,212,233,160,230,53,106,91,161,207,102,84,75,169,60,133,81,155,97,229,50,234,116,80,243,26,181,45,86,103,51,170,165,106,156,194,168,205,176,114,25,117,58,168,121,141,218,214,109,179,25,213,82,64,77,97,212,102,88,185,140,58,29,212,188,70,109,75,152,217,140,106,169,37,166,48,106,51,172,92,70,157,14,106,6,163,170,149,119,183,112,219,86,206,5,249,250,176,87,44,171,211,246,118,191,218,93,169,95,123,89,214,171,83,85,220,28,15,119,154,86,81,29,244,63,151,69,115,101,81,30,143,106,101,126,216,23,7,117,251,205,238,240,222,204,28,134,172,67,242,2,166,24,214,209,135,202,118,181,63,212,87,48,212,67,75,68,179,96,168,65,168,0,151,249,205,141,104,34,189,87,165,212,252,174,205,97,113,98,96,205,79,171,135,150,136,102,129,48,191,95,1,14,243,15,118,111,73,244,174,8,8,205,239,220,81,21,39,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,254,193,150,39,137,222,21,1,161,249,157,219,144,226,196,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,63,216,39,36,209,187,34,32,52,191,115,239,78,156,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,7,155,107,36,122,87,4,132,230,119,110,120,137,19,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,255,96,71,138,68,239,138,128,208,252,206,93,34,113,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,143,214,187,34,32,52,191,102,13,51,127,47,6,212,252,17,246,232,37,162,89,0,204,79,40,192,181,242,175,142,145,75,238,234,40,93,249,43,214,184,149,127,39,6,118,229,79,171,135,150,136,102,129,88,249,251,21,48,48,127,85,90,235,26,163,189,121,35,189,87,165,175,220,80,149,97,42,30,178,14,217,34,200,20,35,194,252,85,233,45,251,216,229,162,37,162,89,48,212,32,84,128,203,252,158,247,15,195,244,222,150,27,4,230,15,124,39,144,41,6,214,252,180,122,104,137,104,22,8,243,251,21,224,48,191,239,165,189,32,189,159,203,13,124,243,135,190,72,199,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,239,77,183,32,189,159,203,13,124,243,135,190,125,198,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,239,245,176,32,189,159,203,13,124,243,135,190,178,197,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,239,157,170,32,189,159,203,13,124,243,135,190,231,196,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,239,69,164,32,189,159,203,13,
-124,243,135,190,28,196,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,127,180,222,207,229,6,190,249,157,245,142,56,49,160,230,143,176,71,47,17,205,2,96,126,66,1,174,149,191,89,215,16,45,185,219,114,131,96,229,239,170,119,196,137,129,93,249,211,234,161,37,162,89,32,86,254,126,5,152,230,87,73,130,173,174,161,83,16,183,222,213,175,158,114,131,238,200,18,162,226,17,107,219,184,35,197,144,155,95,221,236,43,251,56,228,162,37,162,89,48,212,32,84,128,203,252,70,93,67,166,247,166,220,32,49,191,163,222,17,41,6,214,252,180,122,104,137,104,22,8,243,251,21,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,163,245,222,150,27,4,230,119,213,59,34,197,128,154,63,194,30,189,68,52,11,128,249,9,5,184,86,254,70,93,67,182,228,110,202,13,146,149,191,163,222,17,41,6,118,229,79,171,135,150,136,102,129,88,249,251,21,96,154,95,173,18,109,117,13,189,6,117,235,93,253,234,41,55,232,246,165,33,42,30,177,182,141,59,82,12,185,249,213,205,190,178,143,67,46,90,34,154,5,67,13,66,5,184,204,111,212,53,100,122,111,202,13,18,243,59,234,29,145,98,96,205,79,171,135,150,136,102,129,48,191,95,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,63,90,239,109,185,65,96,126,87,189,35,82,12,168,249,35,236,209,75,68,179,0,152,159,80,128,107,229,111,212,53,100,75,238,166,220,32,89,249,59,234,29,145,98,96,87,254,180,122,104,137,104,22,136,149,191,95,1,166,249,213,50,193,86,215,208,139,16,183,222,213,175,158,114,131,62,235,35,68,197,35,214,182,113,71,138,33,55,191,186,217,87,246,113,200,69,75,68,179,96,168,65,168,0,151,249,141,186,134,76,239,77,185,65,98,126,71,189,35,82,12,172,249,105,245,208,18,209,44,16,230,247,43,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,71,235,189,45,55,8,204,239,170,119,68,138,1,53,127,132,61,122,137,104,22,0,243,19,10,112,173,252,141,186,134,108,201,221,148,27,36,43,127,71,189,35,82,12,236,202,159,86,15,45,17,205,2,177,242,247,43,192,52,191,138,19,182,186,134,142,66,110,189,171,95,61,229,6,125,48,102,136,138,71,172,109,227,142,20,67,110,126,117,179,175,236,227,144,139,150,136,102,193,80,131,80,1,46,243,27,117,13,153,222,155,114,131,196,252,142,122,71,164,24,88,243,211,234,161,37,162,89,32,204,239,87,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,
-41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,143,214,123,91,110,16,152,223,85,239,136,20,3,106,254,8,123,244,18,209,44,0,230,39,20,224,90,249,27,117,13,217,146,187,41,55,72,86,254,142,122,71,164,24,216,149,63,173,30,90,34,154,5,98,229,239,87,128,105,126,229,40,108,117,13,237,134,220,122,215,167,168,185,203,13,245,105,100,1,42,30,177,182,141,59,82,12,185,249,213,205,190,178,143,67,46,90,34,154,5,67,13,66,5,184,204,111,212,53,100,122,111,202,13,18,243,59,234,29,145,98,96,205,79,171,135,150,136,102,129,48,191,95,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,63,90,239,109,185,65,96,126,87,189,35,82,12,168,249,35,236,209,75,68,179,0,152,159,80,128,107,229,111,212,53,100,75,238,166,220,32,89,249,59,234,29,145,98,96,87,254,180,122,104,137,104,22,136,149,191,95,1,166,249,21,23,91,93,67,51,119,235,93,253,234,41,55,168,95,131,84,60,98,109,27,119,164,24,114,243,171,155,125,101,31,135,92,180,68,52,11,134,26,132,10,112,153,223,168,107,200,244,222,148,27,36,230,119,212,59,34,197,192,154,159,86,15,45,17,205,2,97,126,191,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,127,180,222,219,114,131,192,252,174,122,71,164,24,80,243,71,216,163,151,136,102,1,48,63,161,0,215,202,223,168,107,200,150,220,77,185,65,178,242,119,212,59,34,197,192,174,252,105,245,208,18,209,44,16,43,127,191,2,6,29,189,171,142,249,106,255,177,239,33,173,4,241,180,210,174,142,54,182,138,64,221,73,186,58,134,117,205,30,178,182,182,178,142,19,35,162,163,119,117,28,219,38,64,61,180,68,52,11,134,26,132,10,24,116,246,186,169,222,149,251,114,119,42,47,30,117,213,233,178,184,126,214,201,114,245,236,31,234,243,115,243,243,89,162,230,147,41,83,67,169,23,231,135,155,207,245,23,159,107,218,197,225,190,60,174,170,173,210,181,146,107,117,58,149,119,215,187,178,88,21,106,32,155,173,254,94,153,67,17,122,216,17,194,61,62,107,56,47,76,172,177,206,30,159,55,127,206,37,150,89,69,52,116,182,40,177,254,69,116,182,12,156,121,53,55,131,136,221,255,238,14,155,7,117,221,122,181,91,155,146,159,254,89,30,15,122,118,84,165,150,103,91,153,114,60,174,142,63,252,252,127,94,189,249,169,23,229,111,251,213,241,99,177,126,87,174,127,45,110,148,83,214,183,23,135,155,226,237,239,108,84,79,239,170,4,84,183,251,20,84,85,26,158,128,170,202,238,18,80,85,73,67,60,85,131,236,126,187,83,84,21,
-16,29,84,127,252,225,181,155,168,186,217,74,243,80,145,100,127,250,197,79,185,38,49,37,174,190,111,28,186,149,174,162,218,147,124,83,86,15,234,14,53,125,138,111,15,135,93,185,210,157,26,85,72,62,149,166,98,91,130,205,28,168,74,31,193,70,70,197,245,253,86,77,70,117,227,196,74,13,177,6,250,250,36,15,0,177,6,241,186,63,36,128,88,3,116,221,117,64,68,172,95,22,169,197,153,71,107,63,255,240,253,143,99,122,250,150,226,226,243,103,151,95,94,170,240,49,22,175,37,216,58,13,28,193,214,95,224,8,182,174,2,71,176,245,18,56,130,173,131,136,32,216,81,92,93,159,60,86,254,230,219,159,199,244,212,13,135,221,67,85,22,143,171,221,67,57,145,176,161,231,154,30,82,122,174,25,34,165,231,154,36,82,122,141,133,245,59,31,24,122,141,129,245,102,2,41,189,142,224,231,62,215,247,234,251,49,185,125,121,219,44,63,198,130,125,238,243,122,76,58,78,135,199,164,227,244,117,76,58,46,243,113,233,184,204,22,66,167,35,244,239,255,238,177,216,15,63,126,247,166,73,155,199,4,223,22,255,94,60,51,5,170,233,184,44,198,165,227,178,24,151,142,203,98,92,58,46,139,113,233,184,44,22,64,167,183,188,111,138,253,233,149,155,208,231,67,129,62,247,77,49,46,29,151,193,184,116,92,6,227,210,113,25,140,75,199,101,176,0,58,189,229,47,84,94,169,76,117,169,114,221,198,110,150,72,245,167,63,141,201,181,139,205,183,207,20,2,222,62,191,44,110,31,86,199,213,190,42,245,2,170,171,93,21,215,31,85,126,166,47,220,238,111,139,221,234,120,91,30,139,234,227,253,96,65,106,10,208,24,220,18,218,114,9,208,32,197,18,11,115,9,208,64,195,18,236,146,11,160,207,60,236,48,48,135,9,90,1,230,195,64,43,192,124,24,104,5,152,15,3,250,0,132,14,3,115,104,160,21,160,193,192,140,2,204,135,129,86,128,249,48,160,187,33,206,42,128,126,47,191,3,225,140,2,52,32,156,81,128,6,132,51,10,208,172,119,102,20,32,43,8,205,236,133,92,18,253,252,183,111,221,18,124,30,169,130,207,3,150,68,217,4,112,185,194,108,2,184,64,144,94,0,98,73,148,77,128,249,48,64,44,137,178,9,48,31,6,136,37,81,54,1,92,75,162,108,2,204,135,1,98,73,148,94,0,98,73,148,94,0,98,73,148,77,0,215,146,40,155,0,174,37,81,54,1,92,75,162,108,2,100,5,97,39,193,31,2,150,68,127,249,219,107,183,4,127,136,84,193,31,2,150,68,217,4,112,185,194,108,2,184,64,144,94,0,98,73,148,77,128,249,48,64,44,137,178,9,48,31,6,136,37,81,54,1,92,75,162,108,2,204,135,1,98,73,148,94,0,98,73,148,94,0,98,73,148,77,0,215,146,40,155,0,174,37,81,54,1,92,75,162,108,2,100,5,161,231,193,153,101,203,8,93,167,10,216,247,173,104,118,155,178,131,120,186,185,117,67,92,175,30,78,229,169,248,241,135,215,205,94,9,255,19,57,209,35,65,241,200,60,60,129,35,115,110,163,73,56,50,15,79,224,200,156,27,122,18,142,204,195,19,56,50,231,214,162,132,35,243,240,4,142,204,185,201,41,225,200,60,60,17,35,27,164,10,153,60,8,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,136,145,13,82,232,76,243,140,230,9,28,89,196,46,30,241,200,60,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,49,178,182,180,20,177,9,141,63,50,154,39,112,100,17,187,219,196,35,243,240,4,142,44,98,219,156,120,100,30,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,49,178,65,213,59,147,205,104,158,192,145,53,126,42,239,200,60,60,129,35,107,252,84,222,145,121,120,2,71,214,248,169,188,35,243,240,4,142,44,171,111,164,121,2,71,150,213,55,210,60,17,35,211,141,189,227,246,141,243,71,70,243,4,142,44,98,67,186,120,100,30,158,192,145,69,236,116,23,143,204,195,19,56,178,136,45,244,226,145,121,120,2,71,22,177,55,95,60,50,15,79,224,200,178,250,70,154,167,112,100,158,215,25,44,205,18,232,221,131,33,13,
-202,30,174,25,15,170,21,79,55,183,32,163,125,30,240,208,56,229,200,60,60,129,35,115,21,255,82,142,204,195,19,56,50,87,130,155,114,100,30,158,192,145,185,22,113,41,71,230,225,9,28,153,203,81,165,28,153,135,39,98,100,196,67,227,36,35,163,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,49,50,226,161,113,146,145,209,60,129,35,139,120,183,82,60,50,15,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,140,120,104,156,100,100,52,79,224,200,34,222,57,22,143,204,195,19,56,178,136,151,153,197,35,243,240,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,136,145,17,15,141,147,140,140,230,9,28,153,235,161,113,202,145,121,120,2,71,230,122,104,156,114,100,30,158,192,145,185,30,26,167,28,153,135,39,112,100,89,125,35,205,19,56,178,172,190,145,230,137,24,25,241,208,56,201,200,104,158,192,145,69,180,9,17,143,204,195,19,56,178,136,254,35,226,145,121,120,2,71,22,209,216,68,60,50,15,79,224,200,34,58,166,136,71,230,225,9,28,89,86,223,72,243,20,142,204,211,100,102,250,208,56,224,157,238,128,161,221,61,236,24,15,170,21,79,55,183,32,163,253,33,224,161,113,202,145,121,120,2,71,230,42,254,165,28,153,135,39,112,100,174,4,55,229,200,60,60,129,35,115,45,226,82,142,204,195,19,56,50,151,163,74,57,50,15,79,196,200,136,135,198,73,70,70,243,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,98,100,196,67,227,36,35,163,121,2,71,22,209,241,78,60,50,15,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,140,120,104,156,100,100,52,79,224,200,34,58,65,138,71,230,225,9,28,89,68,139,73,241,200,60,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,98,100,196,67,227,36,35,163,121,2,71,230,122,104,156,114,100,30,158,192,145,185,30,26,167,28,153,135,39,112,100,174,135,198,41,71,230,225,9,28,89,86,223,72,243,4,142,44,171,111,164,121,34,70,70,60,52,78,50,50,154,39,112,100,17,205,155,197,35,243,240,4,142,44,162,43,180,120,100,30,158,192,145,69,180,155,22,143,204,195,19,56,178,136,62,214,226,145,121,120,2,71,150,213,55,210,60,133,35,171,111,91,237,55,109,115,202,234,88,79,231,234,168,31,31,84,71,203,203,226,234,203,142,211,119,135,253,122,85,149,123,245,255,226,245,171,255,247,151,66,19,122,243,195,247,127,254,69,145,158,16,222,182,147,201,69,87,23,174,252,164,235,139,110,139,99,121,175,110,86,151,117,7,108,159,121,118,234,251,98,242,8,220,114,50,241,15,111,221,134,250,34,212,80,83,78,150,179,139,19,113,178,156,70,13,225,180,217,62,50,182,18,40,158,110,110,65,211,234,139,201,99,253,28,214,114,5,173,84,156,242,90,203,195,19,104,45,87,234,128,215,161,43,16,167,226,148,215,90,30,158,64,107,185,210,33,188,14,93,139,139,84,156,242,90,203,195,19,104,45,215,50,6,175,67,87,50,153,82,135,30,158,64,29,186,22,76,41,71,230,225,137,24,217,96,243,74,210,185,60,224,148,20,135,196,134,156,36,214,162,121,2,173,149,97,85,51,224,148,195,90,174,77,70,41,173,229,225,9,180,86,134,85,205,128,83,14,107,181,185,87,86,107,121,120,2,173,149,97,85,51,224,148,195,90,13,167,188,214,242,240,4,90,43,195,170,134,216,118,150,82,135,137,87,53,196,182,179,148,35,75,188,170,25,108,59,75,58,151,7,156,146,226,144,216,74,151,196,90,52,79,160,181,50,172,106,6,156,114,88,203,181,61,48,165,181,60,60,129,214,202,176,170,25,112,202,97,45,215,150,199,148,214,242,240,4,90,43,195,170,102,192,41,135,181,26,78,121,173,229,225,9,180,86,134,85,13,177,97,52,165,14,19,175,106,136,13,163,41,71,150,120,85,51,216,48,154,116,46,15,56,37,197,33,177,9,54,137,181,104,158,64,107,101,88,
-213,12,56,229,176,150,107,99,111,74,107,121,120,2,173,149,97,85,51,224,148,195,90,174,205,202,41,173,229,225,9,180,86,134,85,205,128,83,14,107,185,54,96,167,180,150,135,39,208,90,25,86,53,196,86,239,148,58,76,188,170,33,182,122,167,28,89,226,85,205,96,171,119,82,116,16,155,202,147,232,144,230,9,212,97,134,21,0,177,125,61,165,14,61,60,129,58,204,16,151,137,141,242,41,117,232,225,9,212,97,134,104,73,108,201,79,169,67,15,79,160,14,51,68,75,98,243,127,74,29,38,142,150,196,230,255,148,35,75,28,45,137,205,255,73,70,70,243,4,142,44,109,12,179,143,204,195,19,56,178,180,145,197,62,50,15,79,224,200,210,250,123,251,200,60,60,129,35,75,235,133,237,35,243,240,4,142,44,171,111,164,121,10,71,214,49,252,183,144,46,117,63,121,78,167,251,55,235,208,212,56,182,155,178,184,254,88,252,179,60,30,204,55,42,14,27,78,127,188,159,254,228,230,57,228,225,53,224,191,5,108,201,78,63,74,15,103,248,40,93,91,153,211,143,210,195,25,62,74,215,22,224,244,163,244,112,134,143,210,249,150,105,242,81,122,56,195,71,233,124,171,42,249,40,61,156,113,163,28,108,116,205,138,88,154,51,124,148,206,206,119,201,71,233,225,12,31,165,107,99,101,250,81,122,56,195,71,233,218,144,152,126,148,30,206,240,81,206,224,99,105,206,240,81,206,224,99,105,206,184,81,14,182,221,101,245,177,52,103,248,40,103,240,177,52,103,248,40,157,221,244,146,143,210,195,25,62,74,215,246,168,244,163,244,112,134,143,114,6,31,75,115,134,143,114,6,31,75,115,198,141,114,176,9,40,171,143,165,57,195,71,57,131,143,165,57,195,71,57,131,143,165,57,195,71,233,236,208,151,124,148,30,206,240,81,206,224,99,105,206,240,81,206,224,99,105,206,184,81,82,93,252,210,141,146,230,12,31,165,179,163,95,242,81,122,56,195,71,233,236,238,151,124,148,30,206,240,81,58,59,253,37,31,165,135,51,124,148,51,248,88,154,51,124,148,51,248,88,154,51,110,148,84,55,192,116,163,164,57,195,71,233,236,12,152,124,148,30,206,240,81,58,187,4,38,31,165,135,51,124,148,206,142,129,201,71,233,225,12,31,165,179,123,96,242,81,122,56,195,71,57,131,143,165,57,71,141,178,99,187,218,111,234,71,108,219,102,65,185,173,31,10,111,199,129,235,155,31,173,236,212,215,138,161,169,181,51,57,255,126,1,46,57,226,161,17,151,28,81,57,228,146,35,210,71,146,92,71,175,125,218,233,55,197,79,111,108,212,126,122,51,146,45,104,223,6,139,22,97,4,22,45,194,2,44,90,132,250,9,90,29,177,15,65,218,255,187,157,220,223,39,178,125,8,50,0,151,28,97,3,46,57,194,12,92,114,132,37,72,114,29,189,175,191,14,208,221,235,159,255,236,118,190,95,127,93,123,194,227,106,123,42,141,157,92,15,149,110,128,122,92,237,111,203,226,84,174,15,251,77,113,184,47,213,231,141,225,137,119,167,119,140,189,79,74,12,143,0,30,142,222,232,51,208,128,107,67,82,102,13,120,196,72,173,1,215,102,165,204,26,240,136,145,90,3,174,141,76,153,53,224,17,35,153,6,136,222,115,185,52,64,139,145,90,3,46,183,159,89,3,30,49,82,107,192,181,161,38,179,6,60,98,164,214,128,107,179,77,102,13,120,196,72,166,1,162,91,83,46,13,208,98,164,214,128,171,3,82,102,13,120,196,72,173,1,215,138,53,179,6,60,98,164,214,128,107,67,72,102,13,120,196,72,166,1,162,191,73,46,13,208,98,164,214,128,171,103,72,102,13,120,196,72,173,1,87,31,142,204,26,240,136,145,90,3,174,100,59,179,6,60,98,0,53,208,9,241,242,101,64,102,254,198,167,130,151,47,229,42,56,178,10,4,111,236,42,104,5,144,130,96,160,1,87,102,158,89,3,30,49,82,107,192,149,153,103,214,128,71,140,212,26,112,101,230,153,53,224,17,35,153,6,136,204,60,151,6,104,49,82,107,192,149,153,103,214,128,71,140,212,26,112,101,230,153,53,224,17,35,181,6,92,153,121,102,13,120,196,72,166,1,34,51,207,165,1,90,140,212,26,112,101,230,153,53,224,17,35,181,6,92,153,121,102,13,120,196,72,173,1,87,102,158,89,3,30,49,146,105,128,200,204,115,105,128,22,35,181,6,92,153,121,102,13,
-120,196,72,173,1,87,102,158,89,3,30,49,82,107,192,149,153,103,214,128,71,12,160,6,250,26,73,192,94,142,215,191,88,75,19,163,189,13,95,79,142,122,141,162,116,216,110,52,37,245,79,44,165,97,217,1,64,169,77,223,1,148,218,52,24,64,169,77,39,1,148,154,253,130,8,74,205,158,188,56,60,13,122,61,0,40,1,108,55,72,93,16,148,0,182,27,188,123,143,160,4,176,221,240,29,114,0,37,128,237,6,203,77,4,37,128,237,6,239,244,34,40,1,108,55,124,55,21,64,9,96,187,193,18,1,65,9,96,187,193,187,130,8,74,0,219,13,222,121,67,80,2,216,110,240,238,22,130,18,192,118,131,119,144,16,148,0,182,27,188,75,131,160,4,176,221,224,157,16,4,37,128,237,6,239,54,32,40,201,108,215,147,122,17,178,142,126,101,165,245,98,44,214,139,144,149,52,135,22,181,150,230,208,162,86,211,2,90,78,140,10,104,57,81,42,160,229,196,169,128,150,19,169,2,90,78,172,178,240,69,172,172,5,180,32,118,164,86,215,2,90,16,59,82,43,108,1,45,136,29,169,85,182,128,22,196,142,212,74,91,64,11,98,71,106,181,45,160,5,177,35,181,226,22,208,130,216,145,90,117,11,104,65,236,72,173,188,5,180,32,118,164,86,223,2,90,16,59,82,43,112,1,45,136,29,169,85,184,128,22,196,142,212,74,92,64,11,98,71,106,53,46,160,5,177,35,181,34,23,208,18,218,177,47,239,7,172,201,191,183,174,239,95,142,196,122,25,176,34,103,80,34,214,227,12,74,196,106,156,79,201,133,81,62,37,23,66,249,148,92,248,228,83,114,161,147,79,201,133,77,14,158,252,43,112,62,37,128,237,136,213,55,159,18,192,118,196,202,155,79,9,96,59,98,213,205,167,4,176,29,177,226,230,83,2,216,142,88,109,243,41,1,108,71,172,180,249,148,0,182,35,86,217,124,74,0,219,17,43,108,62,37,128,237,136,213,53,159,18,192,118,196,202,154,79,9,96,59,98,85,205,167,4,176,29,177,162,230,83,2,216,142,88,77,243,41,1,108,71,172,164,249,148,100,182,235,73,133,212,182,191,183,174,201,95,142,215,247,47,67,106,219,44,90,212,90,154,67,139,90,77,11,104,57,49,42,160,229,68,169,128,150,19,167,2,90,78,164,10,104,57,177,202,194,23,177,178,22,208,130,216,145,90,93,11,104,65,236,72,173,176,5,180,32,118,164,86,217,2,90,16,59,82,43,109,1,45,136,29,169,213,182,128,22,196,142,212,138,91,64,11,98,71,106,213,45,160,5,177,35,181,242,22,208,130,216,145,90,125,11,104,65,236,72,173,192,5,180,32,118,164,86,225,2,90,16,59,82,43,113,1,45,136,29,169,213,184,128,22,196,142,212,138,92,64,75,104,199,142,216,139,144,69,249,171,255,180,17,123,49,22,236,69,200,162,156,69,139,88,148,179,104,17,139,114,9,45,23,88,37,180,92,96,149,208,114,129,85,66,203,5,86,9,45,23,88,121,248,242,47,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,18,218,177,35,246,89,200,162,252,71,235,10,255,179,177,96,159,133,44,202,89,180,136,69,57,139,22,177,40,151,208,114,129,85,66,203,5,86,9,45,23,88,37,180,92,96,149,208,114,129,149,135,47,255,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,161,29,59,98,235,187,251,233,170,124,210,118,241,187,191,252,117,66,238,243,103,95,124,249,197,179,98,123,83,111,47,255,226,197,139,47,198,187,108,90,218,195,85,58,150,246,112,213,142,165,77,52,100,69,208,118,181,58,69,208,118,53,17,69,208,118,181,231,68,208,110,
-103,71,18,218,237,108,1,227,123,144,37,36,161,157,4,39,195,44,34,9,237,36,56,25,102,25,73,104,39,193,201,48,11,73,66,59,9,78,134,89,74,18,218,73,112,50,204,98,146,208,78,130,147,97,150,147,132,118,18,156,12,179,160,36,180,147,224,100,152,37,37,161,157,4,39,195,44,42,9,237,36,56,25,102,89,73,104,39,193,201,48,11,75,66,59,9,78,134,89,90,18,218,73,112,50,204,226,146,208,78,130,147,97,150,151,132,54,6,39,29,241,235,178,122,95,150,251,139,235,63,174,246,31,175,158,93,238,14,237,31,239,182,205,31,214,20,243,219,87,191,252,239,87,175,126,236,25,126,123,38,84,188,254,73,159,106,91,252,249,135,98,187,95,239,30,78,219,199,65,103,209,246,178,171,211,71,117,103,117,220,174,59,206,106,136,237,31,207,105,206,221,237,54,17,212,96,181,8,111,159,23,23,135,99,241,184,93,151,197,99,121,60,173,158,216,69,122,84,41,228,197,227,31,31,155,76,82,255,51,86,237,79,63,190,125,245,198,120,39,228,187,213,169,42,222,126,243,250,111,175,138,234,80,223,111,161,215,36,212,56,114,245,28,134,145,107,166,45,140,92,51,83,97,228,154,201,9,35,215,204,71,24,185,102,10,194,200,129,113,215,20,91,228,228,250,169,186,173,250,105,49,157,137,4,57,117,195,96,222,215,196,92,143,126,69,180,28,165,71,9,45,87,233,81,66,203,85,122,148,208,114,149,30,37,180,92,165,71,9,45,87,233,81,66,11,137,47,215,118,128,48,90,61,177,170,52,144,63,13,181,4,181,106,24,241,106,98,206,242,170,132,150,107,57,39,160,229,92,190,9,104,57,151,107,2,90,206,229,153,128,150,115,57,38,160,229,92,126,9,104,33,241,229,44,177,7,209,234,136,41,56,244,200,159,158,189,66,80,83,55,152,146,53,196,26,228,131,104,57,78,70,146,208,114,157,49,36,161,229,58,173,71,66,203,117,238,141,132,86,131,124,12,173,6,249,24,90,72,124,53,200,151,210,234,136,41,19,246,200,159,158,54,66,80,83,55,152,146,53,196,26,228,131,104,57,206,2,146,208,114,157,170,35,161,229,58,159,70,66,203,117,210,139,132,86,131,124,12,173,6,249,24,90,72,124,53,200,151,210,234,207,227,220,223,246,200,159,158,175,65,80,83,55,152,146,53,196,26,228,131,104,57,78,191,145,208,114,157,35,35,161,229,58,145,69,66,203,117,182,137,132,86,131,124,12,173,6,249,24,90,72,124,53,200,151,210,234,136,41,85,245,200,87,31,120,212,212,13,166,100,13,177,6,249,32,90,53,242,49,180,26,228,99,104,53,200,199,208,106,144,143,161,213,32,31,67,171,65,62,134,22,18,95,13,242,165,180,58,98,106,120,61,242,213,7,30,53,117,131,41,89,67,172,65,62,136,86,141,124,12,173,6,249,24,90,13,242,49,180,26,228,99,104,53,200,199,208,106,144,143,161,133,196,87,131,124,41,173,142,216,160,216,207,46,146,142,74,174,102,165,31,68,171,70,62,134,86,131,124,12,173,6,249,24,90,13,242,49,180,26,228,99,104,53,200,199,208,66,226,171,65,190,148,86,159,46,87,71,69,108,181,255,168,211,229,234,200,76,151,171,227,128,216,221,118,127,209,61,177,43,140,71,118,245,191,61,237,111,94,127,167,46,157,60,153,84,223,233,99,249,186,39,117,230,160,213,111,87,251,195,213,126,187,99,112,104,239,32,25,93,22,219,219,253,225,184,221,223,22,234,242,230,220,191,211,128,251,234,67,48,219,213,135,41,191,213,7,247,192,86,31,184,3,235,238,32,25,57,7,166,111,212,151,220,215,230,191,175,177,116,239,50,191,254,193,129,128,251,6,1,93,10,122,83,189,43,247,229,238,84,94,92,215,123,136,171,118,68,55,237,120,44,195,57,189,223,86,235,119,186,60,223,241,248,225,166,229,176,61,21,213,241,161,44,142,205,240,254,242,195,159,254,244,250,85,161,233,23,111,126,248,254,207,191,152,67,217,149,251,219,234,221,197,201,158,1,171,47,155,11,122,46,175,235,207,90,95,63,255,242,230,135,31,191,215,196,238,14,155,135,93,89,172,110,111,143,102,77,233,225,78,143,103,85,253,95,237,138,255,49,173,169,126,251,205,47,234,26,83,73,187,245,195,110,85,53,148,202,91,253,151,186,64,243,250,246,169,113,168,229,136,240,165,50,210,213,246,230,170,188,187,175,62,218,
-159,14,160,56,157,154,191,149,59,136,28,78,161,204,247,174,88,43,11,108,55,250,251,221,246,84,5,50,6,15,215,37,137,199,140,163,2,97,66,51,38,226,52,52,99,4,19,176,25,19,72,226,49,227,104,174,39,52,99,34,78,67,51,70,48,1,155,49,129,36,30,51,142,74,55,9,205,152,136,211,208,140,17,76,192,102,76,32,137,199,140,163,108,44,161,25,19,113,26,154,49,130,9,216,140,9,36,177,137,162,124,119,154,216,168,9,231,137,141,53,167,57,98,227,152,241,140,177,177,53,35,62,98,185,204,152,136,211,28,177,49,196,140,153,98,99,107,70,124,196,114,153,49,17,167,57,98,99,136,25,51,197,198,214,140,248,136,229,50,99,34,78,115,196,198,16,51,102,138,141,106,210,167,113,170,154,112,30,167,90,115,154,195,169,142,25,207,232,84,91,51,226,93,157,203,140,137,56,205,225,84,67,204,152,201,169,182,102,196,187,58,151,25,19,113,154,195,169,134,152,49,147,83,85,104,73,51,27,53,225,60,179,177,230,52,199,108,28,51,158,113,54,182,102,196,207,17,151,25,19,113,154,99,54,134,152,49,211,108,188,217,213,78,117,180,155,4,160,92,77,216,54,174,68,156,134,102,140,96,194,48,227,152,49,120,184,2,51,226,231,136,203,140,137,56,205,49,27,67,204,152,105,54,42,54,105,204,168,9,231,49,99,205,105,14,51,142,25,231,54,227,253,241,176,33,159,27,235,139,252,252,244,21,15,235,106,162,226,49,249,176,199,169,64,126,212,51,100,30,43,202,176,62,246,41,134,46,49,239,180,180,155,214,188,73,249,81,245,243,121,205,155,74,30,159,121,167,213,137,180,230,77,202,143,42,1,205,107,222,84,242,248,204,59,205,147,210,154,55,41,63,42,25,157,215,188,169,228,241,153,119,26,234,211,154,55,41,63,106,61,53,175,121,83,201,99,21,200,249,188,26,163,238,240,167,214,64,126,243,197,94,217,19,236,244,230,77,21,11,195,159,102,39,51,111,206,216,43,123,178,157,222,188,169,98,97,248,83,238,100,230,205,25,123,101,79,188,211,155,55,85,44,12,127,250,157,204,188,57,99,175,236,73,120,66,243,58,159,135,99,212,29,254,84,28,200,111,62,231,44,123,66,158,222,188,169,156,101,248,211,242,100,230,205,233,156,101,79,206,211,155,55,149,179,12,127,138,158,204,188,57,157,179,236,137,122,66,243,58,159,171,99,212,29,254,116,29,200,111,190,217,43,123,210,158,222,188,169,102,83,248,83,247,100,230,205,57,123,101,79,224,19,154,215,249,28,30,163,238,240,167,241,64,126,212,51,249,116,230,149,61,153,79,111,222,84,179,41,252,41,125,50,243,230,156,189,178,39,246,9,205,235,124,110,143,81,119,248,211,123,32,191,249,204,43,123,146,15,50,239,240,127,237,27,226,74,148,211,111,187,175,206,31,235,191,141,166,10,171,99,117,241,164,110,40,82,116,66,253,252,159,175,79,234,223,237,193,232,124,240,115,253,242,123,253,38,253,241,176,214,191,238,111,245,133,154,68,85,234,107,6,125,8,106,194,207,91,202,22,194,207,9,202,247,199,82,93,112,191,221,149,27,45,178,131,203,118,191,173,44,60,244,215,175,246,143,219,227,97,175,111,49,94,215,87,63,108,87,187,237,63,203,162,122,87,22,101,127,77,113,115,56,22,127,249,230,245,160,225,193,227,90,17,55,211,88,69,91,125,217,211,251,190,172,106,66,119,15,187,106,171,155,180,171,145,41,195,84,171,221,225,182,88,31,246,85,249,161,122,90,124,250,99,89,110,212,56,52,139,245,225,168,70,86,245,227,41,54,229,125,185,223,148,251,245,182,60,125,122,177,173,45,244,244,225,94,91,246,178,56,189,59,60,236,54,197,181,130,194,141,146,169,254,237,122,187,223,168,145,107,250,235,7,69,77,209,40,63,148,235,135,74,49,127,162,229,127,216,159,86,55,10,50,237,48,170,227,74,125,177,214,63,95,60,49,135,98,252,96,154,67,91,174,88,237,139,213,67,117,208,223,110,43,147,196,160,181,127,253,235,144,104,243,93,79,238,151,227,246,246,86,73,174,213,212,82,59,220,151,199,149,166,85,107,100,165,213,94,92,239,14,235,95,77,218,171,235,195,113,68,186,254,202,78,185,254,201,79,184,163,92,62,174,118,23,235,187,77,221,126,193,130,252,179,101,140,9,217,32,177,110,85,209,168,90,253,93,104,156,54,19,170,183,166,
-225,21,76,54,151,197,225,161,186,127,168,106,7,0,102,89,92,232,107,14,247,122,220,171,221,199,226,84,234,143,53,187,66,105,66,107,167,253,164,4,41,87,119,79,134,19,104,189,123,216,148,23,55,251,213,93,233,80,72,123,13,41,219,96,150,158,89,223,168,11,77,134,90,43,223,236,110,203,235,227,202,80,142,18,254,78,77,202,94,61,29,255,55,223,112,149,243,251,99,185,91,53,202,40,86,13,167,223,15,12,212,201,162,92,171,242,156,229,241,66,185,198,70,144,78,13,151,234,199,221,213,169,186,171,154,79,167,237,109,163,29,211,27,24,178,61,159,10,167,71,111,136,98,216,171,38,125,167,34,129,150,255,44,68,161,38,198,234,84,220,169,75,111,30,246,245,84,187,44,148,96,79,107,153,46,148,0,251,85,245,112,44,159,152,157,68,110,118,15,167,119,87,202,217,92,20,227,166,249,202,112,221,175,189,112,245,87,181,104,218,67,237,15,239,7,83,238,116,42,213,156,107,250,161,220,157,110,123,60,12,102,97,125,149,233,3,247,122,214,105,107,40,99,172,203,26,136,197,251,119,229,190,184,126,241,66,55,69,49,38,69,199,66,31,67,69,176,248,97,31,200,229,179,23,95,218,88,232,19,140,8,22,175,247,183,28,22,125,116,43,171,183,171,227,118,117,189,43,47,84,64,168,71,83,60,174,142,61,124,234,6,54,77,15,153,98,136,26,227,94,195,233,182,129,164,190,77,7,121,5,231,38,80,106,178,245,197,38,255,91,130,127,49,110,95,115,107,99,250,125,24,211,81,56,81,192,209,147,250,66,255,199,229,53,148,76,87,237,117,61,187,87,123,77,241,139,205,246,164,255,45,78,171,71,29,232,181,0,67,127,166,130,205,122,216,212,104,175,194,232,85,45,229,69,113,234,117,124,42,127,123,80,113,243,60,98,179,164,161,5,232,239,234,101,104,219,243,104,166,250,231,126,232,181,24,45,189,65,123,242,122,245,244,116,42,65,243,148,163,58,254,99,44,71,209,103,233,3,113,212,183,24,145,148,45,249,202,232,110,178,50,62,175,35,156,188,71,24,80,100,235,133,163,75,128,203,102,253,167,165,176,200,210,222,125,165,238,48,165,169,191,28,112,110,22,186,141,80,245,175,131,72,162,87,212,122,45,180,221,124,232,39,193,105,253,174,188,91,53,50,84,26,103,205,159,234,178,242,67,243,231,106,173,215,152,117,71,184,198,82,245,76,25,217,74,93,127,165,232,106,155,189,63,174,238,191,50,14,106,232,126,73,205,212,56,27,72,175,248,180,98,126,223,112,122,90,51,121,90,211,255,125,161,242,135,70,81,13,147,226,87,245,253,31,63,253,228,203,226,115,133,222,83,217,72,244,233,39,207,212,231,237,94,123,189,211,167,159,60,87,31,154,53,230,9,172,211,139,135,237,198,72,127,30,148,245,204,17,63,201,166,231,40,65,254,37,117,127,169,230,167,154,86,251,99,243,97,127,188,210,159,231,131,58,68,158,255,223,89,98,41,19,36,153,140,115,90,140,84,197,250,176,123,184,219,143,117,81,16,120,156,170,62,33,35,82,127,13,233,133,41,144,15,25,160,82,101,204,255,21,21,237,153,181,217,64,28,41,3,75,237,154,242,182,73,196,254,5,12,48,227,36,72,32,87,206,249,113,174,104,108,202,93,181,186,208,99,236,5,252,15,149,99,13,7,80,12,71,160,47,80,132,205,47,138,39,159,126,242,201,224,139,110,140,127,122,245,250,151,111,212,47,147,158,180,205,112,116,202,215,140,166,150,229,247,167,98,117,127,191,219,150,155,167,131,118,180,199,195,127,151,235,170,21,247,84,238,212,7,83,64,192,0,10,143,248,45,251,168,33,156,30,174,199,218,110,101,87,191,14,100,117,137,222,124,238,4,215,31,59,177,245,135,161,204,138,223,68,222,174,106,167,37,86,121,103,163,200,178,197,193,83,0,50,188,106,84,191,60,95,20,12,66,140,254,124,1,86,247,90,249,121,140,153,219,65,78,196,27,124,56,18,146,40,135,180,43,111,170,201,44,121,173,91,66,159,170,242,190,169,118,233,107,116,113,188,60,22,255,125,216,238,21,148,203,51,255,218,219,109,247,251,246,167,226,98,119,121,124,82,28,30,219,231,13,245,157,219,125,93,85,223,110,202,226,66,73,251,228,119,253,40,116,189,173,121,28,116,177,86,38,216,87,74,153,117,218,99,169,203,180,23,78,148,166,249,40,255,184,170,93,232,249,225,
-146,98,166,136,221,108,149,28,205,51,142,134,252,224,233,174,50,123,57,136,35,125,145,166,234,255,92,247,127,234,25,172,27,171,15,234,148,90,186,134,210,40,24,124,83,127,169,159,215,53,207,116,106,236,213,132,159,214,52,139,139,251,195,233,180,189,222,125,236,10,251,245,213,199,242,126,183,90,151,173,102,117,24,56,195,193,184,249,105,209,140,254,212,23,129,246,15,119,215,237,112,15,199,141,250,171,123,98,86,14,134,221,68,19,198,176,143,219,77,61,238,75,125,171,93,1,13,205,145,2,254,86,127,217,151,78,79,231,138,217,84,23,188,225,216,158,222,173,119,229,234,120,85,71,208,11,219,136,70,123,185,180,208,198,45,35,201,191,211,191,212,162,86,77,13,182,150,177,145,215,84,165,130,235,69,225,85,228,19,195,229,15,158,41,110,55,150,217,223,42,166,118,78,173,218,182,10,19,15,247,74,134,30,209,39,93,187,63,172,183,43,237,25,186,107,173,146,134,11,26,176,88,13,26,68,39,202,73,51,109,71,244,212,98,48,229,210,74,26,134,215,118,188,53,55,143,172,246,167,250,75,165,198,227,225,125,113,115,60,220,169,63,155,5,88,56,186,218,185,50,173,227,62,236,170,159,203,234,162,186,222,181,43,202,170,58,182,210,222,183,178,238,202,253,121,65,186,82,139,208,250,207,114,189,91,157,23,158,58,50,52,231,50,104,165,14,198,163,239,80,88,172,167,201,104,84,127,85,254,96,117,44,207,99,105,101,209,143,71,106,233,235,249,84,251,54,61,228,125,245,185,26,5,61,4,163,42,95,15,196,248,172,135,99,124,212,131,50,54,195,214,35,235,63,107,251,214,190,225,233,211,167,182,113,41,75,92,53,156,227,71,149,121,80,231,245,197,63,28,67,107,252,70,228,224,182,122,30,220,172,244,175,223,253,252,86,255,122,183,170,44,3,45,63,220,31,212,236,108,220,155,241,244,245,230,252,224,85,139,92,222,159,31,201,174,187,191,127,83,97,187,249,107,255,176,219,29,207,95,231,196,64,43,187,134,2,91,77,223,253,244,215,255,42,126,248,241,151,159,218,135,242,74,53,255,114,154,161,128,100,142,0,162,161,169,167,85,78,232,88,110,126,169,117,84,244,15,63,45,194,156,175,37,196,57,95,214,200,245,187,175,138,41,211,234,187,218,245,95,28,91,239,103,56,117,195,211,127,188,47,251,79,155,237,237,182,58,141,124,232,248,129,189,69,202,38,200,180,53,130,137,32,199,195,253,159,220,26,152,62,144,213,55,248,245,160,175,8,83,194,152,247,73,49,63,54,49,53,144,245,201,198,187,82,255,223,143,248,159,106,1,76,206,87,122,131,132,90,154,221,30,87,155,242,234,160,50,162,47,159,253,63,23,237,10,123,248,222,209,223,254,250,125,119,135,17,80,107,94,122,119,74,187,211,162,95,132,108,138,235,143,234,147,178,101,191,103,75,95,249,83,195,165,104,185,14,118,65,41,120,170,152,109,21,170,15,254,55,150,211,94,148,116,198,205,198,50,173,254,114,40,225,166,60,173,143,219,235,70,192,27,129,124,143,219,242,189,71,190,71,175,124,250,102,171,124,250,7,129,108,86,103,247,211,121,251,214,133,109,110,180,238,164,219,227,53,194,207,171,250,231,179,39,209,57,102,93,169,250,194,216,186,86,168,53,210,113,219,2,106,36,193,234,230,166,206,72,223,28,222,159,250,181,155,194,244,244,84,223,58,49,106,47,215,222,127,140,228,70,208,230,129,126,179,26,211,201,102,123,131,94,195,157,180,154,204,199,238,90,174,143,182,181,255,225,254,227,149,94,240,93,20,149,62,244,232,178,248,244,147,222,231,119,127,157,186,191,246,167,201,62,166,102,8,151,74,134,27,229,94,155,191,245,150,184,114,211,12,241,186,60,85,205,95,55,239,91,140,94,12,93,251,96,224,219,59,167,83,255,161,254,169,243,233,245,66,245,186,113,222,197,169,95,207,127,250,201,237,246,177,220,183,171,255,186,36,81,214,54,61,168,4,224,66,253,253,133,30,153,78,133,62,153,24,169,73,108,245,32,234,152,227,19,180,77,93,245,254,141,145,156,191,188,219,158,244,121,77,58,249,92,31,30,246,213,241,227,103,231,221,179,221,6,159,186,92,113,241,161,46,196,60,55,138,218,207,255,49,110,194,85,95,57,181,93,163,168,214,49,219,115,128,206,74,74,248,226,137,111,48,215,219,61,87,243,231,205,119,74,167,53,159,193,190,
-177,127,150,199,195,213,225,120,117,216,151,163,138,218,179,127,76,78,242,50,46,238,89,110,111,244,125,245,30,215,149,74,230,213,12,86,115,76,103,252,251,243,126,162,110,123,201,246,244,180,248,97,191,214,85,12,53,17,238,14,42,208,30,87,219,211,104,159,85,125,84,86,123,207,126,91,31,122,184,221,239,182,123,195,5,234,141,56,167,135,235,129,240,215,166,232,151,197,237,189,89,38,186,61,47,106,154,143,205,81,100,231,166,91,253,109,10,105,23,183,151,229,229,59,245,245,139,226,246,120,120,184,127,90,255,247,226,246,254,137,250,241,78,127,173,183,98,63,213,167,171,189,211,95,173,191,212,223,169,80,190,126,186,61,233,19,209,238,154,111,159,117,95,239,15,213,197,250,203,250,219,254,203,151,23,119,151,207,106,151,82,127,223,255,160,140,162,174,126,118,185,126,166,127,209,3,109,183,177,169,139,46,139,223,61,127,246,229,151,95,126,102,12,252,143,234,182,227,102,187,87,121,116,245,81,57,225,67,179,207,176,89,94,168,20,95,249,160,99,187,149,75,253,89,123,158,223,105,202,173,130,13,74,90,132,235,175,62,213,21,157,169,126,13,200,172,118,59,26,42,122,99,221,110,151,23,37,86,152,212,210,254,15,54,66,177,81,152,224,80,186,27,129,66,125,99,32,65,73,127,245,176,223,254,246,208,79,191,115,33,118,107,172,186,251,203,138,30,16,42,38,175,127,45,182,55,109,57,101,187,43,78,202,115,233,133,131,114,198,215,197,230,80,158,246,191,175,138,119,171,199,178,104,111,174,175,106,207,3,44,12,49,206,181,197,227,233,226,236,59,235,220,197,250,231,19,115,39,228,95,183,247,229,119,205,38,125,243,176,202,51,189,182,232,119,26,110,62,239,217,53,229,63,179,222,122,188,125,83,174,15,199,205,197,147,193,201,148,122,54,156,127,50,118,93,106,216,87,7,37,199,187,243,182,120,165,95,189,21,210,216,112,55,37,189,58,103,162,40,22,125,172,251,109,119,117,222,239,169,6,221,43,173,223,178,106,94,97,221,64,216,4,158,58,198,143,183,144,14,158,190,110,30,238,238,175,214,43,5,3,101,180,122,217,99,152,171,14,198,198,251,222,29,255,254,46,35,95,80,223,181,69,215,125,165,191,105,107,176,53,209,162,190,120,194,88,217,240,74,239,51,213,136,57,150,239,143,219,170,12,102,223,221,107,17,161,195,70,209,82,173,119,179,110,79,213,118,61,29,125,189,189,85,9,240,233,39,165,90,6,25,12,47,213,180,223,253,106,8,244,233,39,247,235,193,199,234,157,90,76,109,6,119,40,22,191,158,140,247,66,213,44,62,157,254,242,237,224,155,199,187,209,23,154,202,240,166,90,234,225,87,119,219,253,205,174,26,126,181,250,239,241,87,251,199,245,233,253,224,155,122,211,188,101,226,245,131,183,104,176,254,222,161,181,149,126,173,225,159,229,133,18,72,249,216,54,139,94,221,169,213,99,237,45,135,153,130,134,106,123,195,87,129,20,234,7,237,150,93,226,49,164,154,122,75,34,154,205,99,69,47,113,235,195,138,238,97,82,175,231,115,138,111,190,184,117,56,174,110,27,128,182,27,16,6,16,172,247,33,152,223,180,219,17,6,23,125,188,31,94,115,119,216,12,191,80,25,72,29,148,70,148,186,9,216,98,73,37,5,119,239,183,155,234,221,112,150,212,28,79,245,11,35,198,197,239,202,213,253,240,139,213,233,221,8,212,247,250,187,182,59,220,182,38,166,150,213,71,69,119,120,89,19,148,6,215,29,203,71,203,183,191,150,31,7,159,235,154,251,118,243,193,120,239,125,96,158,86,187,19,31,186,26,120,208,230,162,66,77,192,186,110,170,189,169,205,68,93,86,241,63,182,90,148,173,154,7,179,245,206,37,253,30,231,177,45,69,248,109,104,62,91,251,31,115,46,218,156,78,159,73,60,113,254,31,187,46,219,174,141,18,166,165,211,70,2,189,105,249,226,28,138,207,145,248,28,136,7,18,141,239,50,223,63,86,161,119,95,109,207,17,185,121,68,91,95,164,95,152,92,89,68,208,229,107,174,0,195,123,44,117,111,15,223,115,122,213,228,175,117,89,188,250,120,209,214,193,138,63,78,94,14,109,175,24,63,47,63,41,162,109,2,167,159,90,183,151,233,167,252,131,221,62,202,166,67,70,215,102,169,205,220,219,83,152,155,123,188,140,245,0,237,172,79,79,71,175,118,121,120,171,101,87,61,
-216,39,250,125,205,211,181,249,70,127,253,67,175,241,191,198,10,244,233,160,222,123,44,245,254,35,149,162,40,198,135,247,231,77,88,245,44,42,110,118,155,173,185,254,47,244,251,141,198,99,187,237,254,222,182,244,214,207,210,90,178,95,89,153,53,91,70,46,172,119,52,191,153,147,66,43,77,79,250,139,226,81,247,216,45,154,45,40,197,249,222,191,252,175,87,255,165,127,254,170,152,152,185,185,203,104,207,59,120,93,110,64,65,125,91,19,177,179,61,189,171,164,108,117,103,66,41,219,246,1,151,132,173,182,151,148,109,253,26,157,140,109,205,73,200,182,129,191,136,237,96,43,232,191,198,104,85,102,43,101,171,123,186,72,217,110,174,119,82,182,186,215,136,148,173,114,114,82,182,77,97,148,203,248,120,208,47,248,94,125,56,28,175,106,106,239,154,220,118,127,221,61,25,127,108,40,91,164,26,221,251,213,68,190,41,113,195,105,26,44,174,71,213,235,126,102,14,6,240,176,251,245,106,194,179,223,65,251,219,238,233,166,212,123,128,30,246,155,214,7,214,91,82,27,87,168,255,233,252,168,250,112,213,93,59,122,106,83,127,167,159,203,25,47,97,63,234,141,146,123,229,111,203,83,117,106,218,138,232,167,100,135,155,226,248,187,193,176,167,66,116,29,207,13,81,58,55,59,16,72,191,168,133,19,106,160,151,161,78,218,71,140,173,242,107,177,70,199,157,104,113,104,49,148,176,91,221,24,225,241,98,115,121,122,82,239,37,109,247,84,20,215,229,187,243,187,9,155,67,85,92,108,149,80,197,215,197,151,250,193,230,141,126,136,208,254,242,100,170,62,155,234,28,18,159,47,152,168,49,155,236,195,117,217,169,92,31,244,75,119,123,53,191,116,155,17,149,97,158,231,80,173,248,242,215,118,28,191,26,33,107,12,202,231,35,42,70,149,94,111,147,214,24,58,11,175,164,214,189,1,6,151,255,206,55,37,84,144,213,234,107,195,180,254,167,95,160,190,171,114,78,137,186,17,113,47,74,191,4,24,8,148,99,74,212,58,177,3,204,108,83,175,197,89,198,148,104,84,231,153,18,250,130,137,26,151,55,37,106,197,251,167,68,11,74,98,74,104,12,137,167,68,171,190,150,249,96,131,154,250,144,115,74,52,169,67,39,74,31,4,7,2,229,152,18,181,78,236,0,51,119,220,104,113,150,49,37,26,213,121,166,132,190,96,162,198,229,77,137,102,15,183,119,74,180,160,36,166,196,118,31,49,37,234,21,224,209,92,240,119,220,213,135,156,83,162,89,41,118,162,244,11,219,129,64,57,166,68,173,19,59,192,76,235,104,113,150,49,37,26,213,121,166,196,160,19,206,89,141,203,155,18,181,226,253,83,162,5,37,49,37,52,134,196,83,66,165,146,90,125,109,50,170,255,233,184,171,15,41,208,231,156,19,117,167,210,94,150,62,211,29,72,148,99,78,180,74,105,48,101,246,190,213,2,208,140,111,118,135,85,85,55,149,60,104,163,62,198,99,201,58,17,206,250,50,160,175,191,154,104,107,14,129,181,180,119,167,171,234,248,176,95,27,26,109,54,76,143,53,90,95,53,18,176,254,174,219,148,156,68,190,1,2,55,215,59,45,96,91,29,209,255,244,27,9,174,119,89,231,65,221,210,181,151,165,47,189,12,36,202,49,15,90,165,52,0,51,187,200,106,1,22,51,15,206,250,50,230,129,254,106,162,173,37,204,131,86,163,205,60,24,107,116,166,121,176,218,221,191,91,93,40,44,53,210,169,203,170,149,254,115,36,161,238,181,122,170,174,234,171,175,212,95,131,237,192,187,186,149,94,243,156,75,239,62,63,85,199,195,254,112,247,177,168,47,239,246,74,254,81,239,0,84,124,155,103,20,199,213,102,251,112,106,24,182,239,13,234,193,181,157,60,245,91,25,219,253,234,220,3,118,4,129,94,104,3,3,166,232,83,28,168,1,104,24,88,6,160,251,73,108,131,7,225,149,198,80,161,217,237,218,42,77,175,206,65,119,8,185,52,245,146,67,77,3,141,52,189,83,199,124,19,104,82,42,212,141,162,159,239,31,238,174,116,125,108,184,162,80,176,186,174,154,189,242,205,6,202,250,245,206,199,242,168,0,248,222,88,159,249,248,25,111,30,217,89,107,231,101,101,173,126,184,168,231,50,201,255,92,142,109,69,48,182,215,142,198,109,169,75,174,42,128,2,66,4,24,43,194,45,75,132,70,172,38,25,189,11,54,49,131,250,29,137,
-0,247,171,103,118,206,137,0,208,60,153,12,1,0,96,252,33,2,4,1,32,86,35,163,180,227,93,229,242,1,131,218,104,55,5,116,65,112,194,85,95,26,134,0,7,191,209,200,167,172,245,128,173,172,245,128,213,15,12,8,180,34,248,125,192,176,16,107,250,0,185,2,66,4,176,65,192,46,75,132,70,172,38,177,248,128,97,117,252,60,7,48,8,240,251,128,41,231,68,0,112,250,128,137,210,1,227,15,17,32,8,0,177,26,25,237,165,217,59,125,192,160,24,220,77,129,237,222,194,85,95,26,134,0,7,191,209,200,167,172,245,128,173,172,245,128,235,133,114,176,5,90,17,252,62,96,88,121,54,125,128,92,1,33,2,216,32,96,151,37,66,35,86,147,88,124,192,192,12,221,28,192,32,192,239,3,166,156,19,1,192,233,3,38,74,7,140,63,68,128,32,0,196,106,100,104,145,221,254,214,229,3,6,213,239,110,10,236,204,6,245,103,174,245,246,136,32,4,56,248,141,70,62,101,173,7,108,101,173,7,92,191,17,29,108,129,86,4,191,15,24,150,218,77,31,32,87,64,136,0,54,8,216,101,137,208,136,213,36,22,31,48,48,67,55,7,48,8,240,251,128,41,231,68,0,112,250,128,137,210,1,227,15,17,32,8,0,177,26,25,90,164,218,222,233,86,247,119,247,231,153,169,25,119,95,142,38,226,85,247,131,121,60,84,195,184,251,105,108,243,9,135,177,202,93,220,244,247,54,142,235,49,199,128,177,158,181,63,16,102,186,55,176,251,217,50,231,184,131,247,179,180,226,206,199,30,169,141,169,92,109,155,22,139,41,106,184,197,27,222,226,97,92,204,0,35,13,150,227,178,120,183,58,93,85,255,228,201,84,253,19,44,85,247,33,64,71,221,87,148,166,186,91,97,115,69,251,43,10,172,34,188,248,89,114,230,10,26,65,225,146,141,161,196,148,50,18,83,110,57,123,17,56,122,76,142,178,90,218,205,234,163,190,199,140,61,237,87,227,200,211,126,61,133,83,251,195,120,122,141,40,143,135,110,231,82,143,116,194,105,61,228,196,152,65,134,16,211,88,211,254,104,139,52,140,193,250,88,89,237,237,102,139,26,253,88,158,54,182,76,84,222,120,138,8,195,90,98,138,157,73,228,200,2,249,143,29,0,45,139,109,206,139,165,105,255,36,53,210,126,225,213,202,249,38,8,234,7,81,195,10,63,54,18,124,172,194,81,143,196,70,168,68,214,40,17,38,93,20,90,92,242,157,89,135,107,13,142,159,238,197,140,166,255,88,29,106,46,122,228,14,158,137,182,151,76,184,158,15,143,107,26,126,158,186,94,102,61,116,172,108,154,72,105,174,179,108,220,44,177,207,197,207,92,220,140,103,106,53,138,115,149,37,200,89,31,239,168,111,173,150,172,156,145,165,114,132,21,15,121,187,180,157,239,174,44,142,91,42,236,200,33,84,14,111,16,64,190,169,172,87,199,198,255,53,175,153,104,145,77,43,214,45,179,159,95,233,62,53,99,144,86,53,66,213,47,211,231,35,191,237,174,119,135,107,67,5,237,55,99,45,180,95,91,30,14,52,63,216,158,4,244,180,167,234,104,127,180,105,132,193,202,212,203,89,112,139,106,218,159,172,218,57,223,214,43,104,240,2,85,77,220,108,187,188,121,214,86,48,158,141,221,92,247,46,213,228,81,211,88,28,53,76,205,219,50,194,234,184,245,21,89,38,111,209,50,197,27,116,230,178,61,24,210,38,26,109,21,137,144,118,104,166,135,235,230,134,139,166,93,98,219,26,177,238,207,63,104,174,244,203,155,238,210,95,86,219,221,87,161,100,218,86,66,94,130,99,161,238,14,251,234,157,177,49,181,93,236,76,55,164,14,90,81,14,110,178,97,74,25,188,222,131,58,188,50,88,83,227,237,178,78,169,6,47,83,12,239,242,137,53,186,52,36,102,217,149,229,120,237,201,173,44,203,219,78,60,69,13,39,231,84,81,1,47,98,209,47,96,97,149,228,120,17,38,88,73,250,241,43,86,73,33,175,230,144,175,228,96,149,228,120,53,34,88,73,250,122,172,146,2,94,214,160,95,210,192,42,201,177,89,62,88,73,186,128,143,85,82,192,246,125,122,219,126,140,146,234,102,13,23,93,224,181,30,222,213,52,208,24,244,234,168,111,115,159,6,92,255,60,232,53,243,78,69,143,95,47,38,125,198,6,97,189,190,198,60,146,124,127,58,236,182,125,35,48,125,160,132,222,199,216,116,72,
-169,79,181,209,93,31,219,46,48,197,195,169,238,21,88,83,81,127,13,207,76,127,56,149,126,238,245,37,114,230,250,246,109,253,10,133,62,245,98,83,156,118,135,106,208,15,238,113,181,126,120,184,243,203,208,92,99,8,241,238,112,104,122,137,174,238,239,143,135,213,250,157,182,245,218,33,218,105,220,128,165,121,171,220,203,177,187,108,212,110,69,127,165,59,173,108,215,229,169,235,136,221,118,64,62,247,17,234,207,62,42,119,15,155,114,216,120,178,253,210,184,172,188,223,238,14,183,15,163,235,206,223,6,196,240,174,112,193,139,227,100,230,201,153,59,174,162,74,255,254,147,37,33,29,75,244,220,33,211,88,140,90,54,121,61,205,124,88,224,144,204,168,222,186,106,27,102,221,150,45,205,160,202,172,1,219,139,50,205,164,219,4,204,85,65,62,167,97,43,126,249,184,105,66,212,174,2,31,206,237,114,205,84,85,173,113,235,139,134,27,39,141,67,116,154,101,178,62,235,71,79,199,166,7,209,117,115,56,200,116,247,70,195,205,168,235,60,152,45,122,135,187,54,117,27,30,0,115,247,56,7,219,229,58,86,131,205,97,105,198,57,220,153,102,142,51,130,185,123,156,131,45,65,29,171,193,6,152,52,227,28,238,190,49,199,25,193,252,156,157,170,152,114,186,56,159,114,48,76,132,85,90,214,252,110,229,209,254,102,27,80,79,182,239,186,100,77,96,155,177,4,114,25,30,104,214,30,151,113,241,100,116,174,198,207,255,245,243,224,2,243,56,147,195,186,220,60,232,87,76,142,219,219,219,82,31,165,113,56,147,59,247,201,61,125,60,61,189,58,31,104,53,110,104,215,18,110,214,48,62,214,237,21,2,222,237,157,61,239,243,255,38,91,217,219,183,213,92,135,168,152,237,68,244,219,107,251,135,59,199,198,237,246,52,134,102,207,134,126,61,51,116,15,183,185,171,124,240,178,159,83,166,105,195,144,85,149,72,56,67,178,250,101,151,16,61,233,183,155,242,232,169,121,17,136,165,167,68,194,117,123,130,9,60,153,189,56,76,147,77,55,1,79,69,9,220,15,108,238,80,14,199,211,160,219,198,8,79,64,225,12,201,188,120,50,245,100,154,44,173,158,2,240,52,214,83,34,225,186,253,165,4,158,204,156,216,52,217,116,67,233,84,148,192,189,165,230,110,215,112,60,13,90,85,140,240,4,20,206,144,204,139,39,83,79,166,201,210,234,41,0,79,99,61,37,18,206,220,171,232,6,212,56,71,51,141,54,221,158,56,21,38,112,167,162,185,119,50,28,81,131,78,15,35,68,1,133,51,36,243,34,202,212,147,105,180,180,122,10,64,212,88,79,137,132,51,99,113,85,134,173,12,116,111,176,60,43,131,182,225,26,103,101,144,72,184,78,178,243,163,170,71,71,167,58,221,251,195,194,120,192,142,253,166,230,128,169,82,200,243,86,25,207,29,214,209,66,216,21,48,150,35,194,70,134,80,103,67,248,140,130,84,12,33,134,77,67,62,177,146,168,202,192,114,211,213,45,96,102,233,22,99,121,102,86,219,183,141,51,179,18,9,103,49,100,189,186,154,40,134,0,80,125,83,196,204,106,140,228,155,89,103,33,252,112,57,203,129,155,89,218,86,62,163,32,21,67,136,17,58,179,146,170,202,192,114,179,139,32,96,102,233,78,101,121,102,86,219,254,141,51,179,18,9,103,49,164,93,49,4,128,234,155,34,102,86,99,36,223,204,58,11,225,135,203,89,14,220,204,170,207,112,242,24,5,169,24,66,140,208,153,149,84,85,102,95,132,230,33,139,167,53,196,160,229,89,158,185,213,246,145,227,204,173,68,194,89,76,217,156,2,59,86,12,1,161,250,166,136,185,213,88,201,55,183,206,66,248,1,115,150,3,55,183,234,83,56,60,70,65,42,134,16,35,116,110,37,85,149,89,165,242,101,90,102,205,204,76,102,210,214,204,2,50,173,113,205,44,145,112,157,100,227,76,107,172,152,26,64,83,198,227,101,59,175,31,6,149,105,217,132,176,43,192,149,62,8,108,228,201,180,108,70,65,42,134,16,195,53,179,92,98,37,81,149,129,101,111,166,53,238,160,157,103,102,5,100,90,99,109,37,18,206,98,200,38,211,26,43,134,0,208,121,217,46,157,89,246,76,203,38,132,31,46,227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,50,176,236,205,180,76,219,153,201,76,218,153,21,144,105,141,181,149,72,56,139,
-33,237,138,33,0,116,94,182,75,103,150,61,211,178,9,225,135,203,56,125,136,159,89,102,166,101,51,10,82,49,132,24,161,51,43,169,170,204,238,83,254,76,203,180,158,153,204,164,157,91,1,153,214,88,95,137,132,179,152,178,201,180,198,138,33,32,116,94,182,75,231,150,61,211,178,9,225,7,204,56,125,136,159,91,102,166,101,51,10,82,49,132,24,161,115,43,169,170,204,231,183,190,76,203,124,154,108,38,51,105,159,38,7,100,90,227,167,201,137,132,235,36,27,103,90,99,197,212,0,154,50,30,47,219,121,93,199,168,76,203,38,132,93,1,174,244,65,96,35,79,166,101,51,10,82,49,132,24,174,153,229,18,43,137,170,12,44,123,51,45,211,118,102,50,147,118,102,5,100,90,99,109,37,18,206,98,200,38,211,26,43,134,0,208,121,217,46,157,89,246,76,203,38,132,31,46,227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,50,176,236,205,180,198,71,30,229,153,89,1,153,214,88,91,137,132,179,24,210,174,24,2,64,231,101,187,116,102,217,51,45,155,16,126,184,140,211,135,248,153,101,102,90,54,163,32,21,67,136,17,58,179,146,170,202,236,241,233,207,180,76,235,153,201,76,218,185,21,144,105,141,245,149,72,56,139,41,155,76,107,172,24,2,66,231,101,187,116,110,217,51,45,155,16,126,192,140,211,135,248,185,101,102,90,54,163,32,21,67,136,17,58,183,146,170,106,208,59,211,153,106,217,206,22,205,179,207,50,32,215,26,239,179,76,36,92,39,217,56,215,178,29,186,106,97,60,94,184,243,186,187,82,185,150,77,8,187,2,92,9,132,192,70,158,92,203,102,20,164,98,8,49,92,115,203,37,86,18,85,25,88,246,230,90,227,35,74,243,204,172,128,92,107,172,173,68,194,89,12,217,228,90,182,179,91,61,102,58,47,220,165,51,203,158,107,217,132,240,195,101,156,64,196,207,44,51,215,178,25,5,169,24,66,140,208,153,149,84,85,6,150,189,185,214,248,164,211,60,51,43,32,215,26,107,43,145,112,22,67,218,21,67,0,232,188,112,151,206,44,123,174,101,19,194,15,151,113,2,17,63,179,204,92,203,102,20,164,98,8,49,66,103,86,82,85,153,235,65,127,174,53,62,50,53,207,220,10,200,181,198,250,74,36,156,197,148,77,174,101,59,75,214,99,168,243,194,93,58,183,236,185,150,77,8,63,96,198,9,68,252,220,50,115,45,155,81,144,138,33,196,8,157,91,73,85,85,11,120,179,35,159,106,153,39,181,154,201,140,254,158,2,175,186,134,99,181,86,154,192,76,107,112,208,237,40,211,2,10,215,73,54,206,180,198,138,169,1,52,101,60,94,182,235,163,141,195,102,214,132,169,5,55,54,33,236,10,112,165,15,2,27,121,50,45,155,81,144,138,33,196,112,205,44,151,88,73,84,101,96,217,155,105,153,182,51,147,153,180,51,43,32,211,26,107,43,145,112,22,67,54,153,214,88,49,4,128,206,203,118,233,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,68,194,89,12,105,87,12,1,160,243,178,93,58,179,236,153,150,77,8,63,92,198,233,67,252,204,50,51,45,155,81,144,138,33,196,8,157,89,73,85,213,9,72,102,90,166,245,204,100,38,237,220,10,200,180,198,250,74,36,156,197,148,77,166,53,86,12,1,161,243,178,93,58,183,236,153,150,77,8,63,96,198,233,67,252,220,50,51,45,155,81,144,138,33,196,8,157,91,73,85,213,180,118,188,222,81,153,150,186,196,154,105,233,239,41,240,214,7,222,51,78,239,104,164,9,204,180,6,135,214,143,50,45,160,112,157,100,227,76,107,172,152,26,64,83,198,147,101,251,245,46,244,128,149,49,83,11,110,108,66,216,21,224,74,31,4,54,242,100,90,54,163,32,21,67,136,225,154,89,46,177,146,168,202,192,178,55,211,50,109,103,38,51,105,103,86,64,166,53,214,86,34,225,44,134,108,50,173,177,98,8,0,117,203,118,225,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,68,194,89,12,105,87,12,1,160,110,217,46,156,89,246,76,203,38,132,31,46,
-227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,234,4,36,51,45,211,122,102,50,147,118,110,5,100,90,99,125,37,18,206,98,202,38,211,26,43,134,128,80,183,108,23,206,45,123,166,101,19,194,15,152,113,250,16,63,183,204,76,203,102,20,164,98,8,49,66,231,86,18,85,157,255,119,119,216,60,236,74,125,198,133,121,122,197,111,187,167,155,237,205,205,197,117,115,78,134,150,108,91,13,206,81,80,191,78,143,195,56,62,148,197,246,70,31,250,86,124,246,66,159,147,240,168,79,198,24,157,67,101,16,55,142,151,234,26,130,108,141,52,51,130,81,199,229,94,147,188,44,146,142,228,190,151,93,115,74,48,172,193,184,212,119,87,141,139,56,27,232,178,104,135,121,176,54,135,255,207,215,253,45,214,67,76,218,159,203,227,231,229,166,184,61,30,30,238,79,150,177,14,248,14,142,6,187,175,255,122,174,249,235,63,254,195,222,42,62,90,142,90,136,213,254,215,240,97,175,204,3,86,76,70,234,7,239,80,27,46,194,65,178,185,214,72,42,247,167,242,138,53,188,254,22,43,187,250,231,221,71,114,176,3,206,178,33,75,37,57,187,202,213,237,237,241,105,249,97,123,170,76,17,158,43,17,222,181,19,87,171,160,103,249,205,235,239,235,171,3,72,60,25,207,248,243,141,103,45,24,55,54,231,2,61,183,223,114,245,184,218,25,158,243,230,97,191,174,79,200,169,239,95,31,30,87,199,139,242,153,153,238,151,207,141,26,132,254,239,87,159,126,82,126,105,28,138,241,199,23,93,140,248,131,186,247,178,124,254,68,93,114,250,178,62,171,67,253,88,83,62,61,220,93,148,95,214,63,60,155,254,240,172,254,225,249,244,135,154,212,99,247,67,203,228,244,236,242,84,255,178,238,174,174,79,193,107,9,237,7,151,235,94,78,235,154,204,127,12,190,255,226,226,241,249,229,190,254,225,217,224,135,207,47,78,95,94,62,254,71,253,203,248,142,103,205,29,45,40,30,191,250,180,60,219,172,86,221,87,83,133,30,67,244,185,126,28,12,253,108,134,179,42,55,207,122,173,84,155,242,241,172,176,205,243,241,247,237,245,166,174,54,74,89,155,250,251,163,49,146,245,163,250,182,25,202,105,160,170,163,49,62,245,219,96,132,199,233,0,79,15,215,20,104,46,139,91,243,212,234,114,56,51,110,106,175,208,95,29,142,46,243,146,179,44,13,204,46,111,47,203,203,155,75,29,137,206,136,115,94,252,108,124,241,115,207,197,207,71,23,63,62,119,73,106,129,104,173,170,6,165,13,153,22,171,54,2,3,208,218,46,24,162,215,118,197,16,198,14,26,110,60,159,13,107,183,248,49,220,224,180,189,215,143,118,149,27,211,160,87,216,96,50,232,3,46,21,238,239,45,102,52,231,70,127,217,243,201,101,35,179,245,179,229,180,217,155,191,189,120,161,126,188,172,157,90,243,235,201,252,117,123,163,2,196,190,220,233,243,202,54,251,203,103,117,179,240,118,130,13,85,94,79,188,147,49,243,76,147,187,39,95,171,245,175,130,28,119,83,77,58,155,164,46,113,233,255,26,83,171,62,229,199,57,181,116,7,7,171,227,158,252,112,118,220,147,31,206,142,187,253,33,212,113,155,151,235,214,16,231,57,96,126,63,128,190,249,195,0,241,163,59,162,28,183,91,159,235,199,193,208,231,114,220,90,85,177,142,123,58,200,112,199,173,175,14,70,215,224,146,32,199,109,189,216,229,184,173,23,187,28,247,84,82,166,227,30,19,48,65,107,189,96,234,184,199,87,76,29,183,133,6,192,113,83,6,167,237,189,126,180,171,124,145,142,91,23,196,147,56,110,255,228,99,57,238,166,88,121,54,73,93,65,213,255,53,166,86,157,179,56,167,150,78,173,172,142,123,242,195,217,113,79,126,56,59,238,246,135,80,199,109,94,174,223,52,61,207,1,243,251,1,244,205,31,6,136,31,221,17,229,184,221,250,92,63,14,134,62,151,227,214,170,138,117,220,211,65,134,59,110,125,117,48,186,6,151,4,57,110,235,197,46,199,109,189,216,229,184,167,146,50,29,247,152,128,9,90,235,5,83,199,61,190,98,234,184,45,52,0,142,155,50,56,109,239,245,163,93,229,139,116,220,186,168,156,196,113,251,39,31,203,113,55,149,240,179,73,234,242,188,254,175,49,181,244,119,238,169,165,223,46,177,58,238,201,15,103,199,61,249,225,236,184,219,31,66,29,
-183,121,185,126,109,229,60,7,204,239,7,208,55,127,24,32,126,116,71,148,227,118,235,115,253,56,24,250,92,142,91,171,42,214,113,79,7,25,238,184,245,213,193,232,26,92,18,228,184,173,23,187,28,183,245,98,151,227,158,74,202,116,220,99,2,38,104,173,23,76,29,247,248,138,169,227,182,208,0,56,110,202,224,180,189,215,143,118,149,47,210,113,235,135,121,73,28,183,127,242,177,28,119,115,210,220,217,36,250,211,19,253,95,99,106,233,239,220,83,75,111,86,181,58,238,201,15,103,199,61,249,225,236,184,219,31,66,29,183,121,185,222,5,123,158,3,230,247,3,232,155,63,12,16,63,186,35,202,113,187,245,185,126,28,12,125,46,199,173,85,21,235,184,167,131,12,119,220,250,234,96,116,13,46,9,114,220,214,139,93,142,219,122,177,203,113,79,37,101,58,238,49,1,19,180,214,11,166,142,123,124,197,212,113,91,104,0,28,55,101,112,218,222,235,71,187,202,23,233,184,245,254,246,36,142,219,63,249,88,142,187,57,250,242,108,18,253,233,137,254,175,49,181,244,119,238,169,165,247,190,88,29,247,228,135,179,227,158,252,112,118,220,237,15,161,142,219,188,92,111,170,57,207,1,243,251,1,244,205,31,6,136,31,221,17,229,184,221,250,92,63,14,134,62,151,227,214,170,138,117,220,211,65,134,59,110,125,117,48,186,6,151,4,57,110,235,197,46,199,109,189,216,229,184,167,146,50,29,247,152,128,9,90,235,5,83,199,61,190,98,234,184,45,52,0,142,155,50,56,109,239,245,163,93,229,139,116,220,122,187,92,18,199,237,159,124,19,199,221,109,103,57,253,182,187,42,247,143,219,227,97,175,183,211,92,60,41,46,246,171,187,86,235,167,234,248,143,203,199,213,238,193,248,252,164,219,176,242,195,143,63,255,245,213,119,191,220,150,213,171,158,64,191,47,231,187,195,110,87,174,171,122,99,142,193,161,80,86,217,174,174,119,229,233,105,189,227,76,239,12,186,63,150,187,135,77,121,241,196,186,99,112,189,170,86,187,195,173,177,149,102,125,44,87,85,121,117,42,127,187,40,78,181,184,74,178,203,66,125,30,124,248,227,189,254,99,85,163,175,46,82,153,123,109,122,26,133,33,115,195,170,56,220,151,199,85,13,218,254,50,115,71,211,106,167,254,9,228,175,244,215,236,142,53,185,119,4,188,204,187,171,76,222,155,227,225,126,194,122,127,254,195,24,237,112,231,84,123,151,151,223,249,162,223,89,116,189,126,87,222,173,46,12,150,171,135,234,157,159,231,224,214,32,45,215,87,78,7,219,240,30,168,122,204,249,178,216,222,212,219,167,78,174,177,211,82,24,215,137,100,128,114,109,85,82,233,169,98,170,189,50,254,188,222,53,16,171,202,187,123,167,250,107,10,33,218,175,47,180,136,240,184,45,223,155,18,60,114,37,208,4,66,4,208,215,77,20,223,40,96,128,245,213,20,236,197,200,254,19,67,208,90,232,47,147,202,0,230,90,235,157,98,74,226,158,84,126,119,149,76,0,44,203,245,97,175,232,175,234,46,206,124,198,253,221,52,251,254,218,169,99,159,218,219,54,235,92,162,24,52,2,188,187,107,214,85,31,239,75,187,139,223,222,221,239,244,95,246,217,174,110,11,154,236,234,186,41,206,157,60,189,106,39,121,118,87,153,28,111,143,171,125,117,117,60,168,149,192,128,103,31,87,234,43,14,199,6,230,171,205,221,214,34,128,65,197,43,130,113,157,41,196,177,124,60,252,90,70,75,97,146,241,138,97,94,56,81,198,16,113,215,59,131,127,217,126,123,127,220,62,182,47,255,172,251,107,111,91,233,12,81,45,90,162,245,51,213,76,33,149,169,190,130,144,170,101,65,235,107,10,155,115,82,49,16,239,102,189,223,110,12,158,22,1,67,196,26,114,8,64,213,249,82,11,176,82,202,57,98,17,130,59,155,164,173,67,120,56,149,199,129,148,247,171,211,233,253,113,211,124,40,247,235,243,43,103,122,161,210,142,227,97,183,59,95,111,117,70,154,102,136,51,210,215,77,156,81,45,208,41,208,243,147,156,186,171,104,62,228,186,86,192,113,20,96,4,202,62,236,54,198,69,182,136,67,74,212,95,54,68,170,22,99,42,210,190,124,79,186,127,227,94,2,126,221,117,22,232,105,111,104,88,64,127,60,251,16,43,240,141,219,66,208,165,175,155,88,189,230,105,216,186,99,234,183,58,201,179,187,74,113,180,48,76,
-193,102,200,103,187,223,148,31,6,134,220,6,206,161,250,78,154,107,125,217,132,173,221,209,25,127,158,61,158,94,6,180,177,212,39,76,144,87,27,92,105,1,22,41,212,122,175,151,114,86,116,5,9,48,186,214,182,140,59,110,111,111,71,51,203,92,76,54,63,27,95,108,239,90,245,28,142,91,197,117,213,47,244,203,199,242,28,19,148,51,232,38,105,243,135,90,206,182,95,253,118,252,232,94,29,54,236,130,22,136,205,165,211,53,98,59,160,126,60,173,151,40,108,43,195,0,126,230,133,211,165,184,162,104,89,142,223,85,157,107,186,63,245,127,86,164,195,26,17,13,112,151,221,181,83,217,54,229,14,47,91,71,52,64,182,238,90,91,109,170,178,166,49,189,16,107,197,214,37,68,119,119,80,121,170,234,133,240,190,239,171,210,173,253,169,25,253,213,177,220,149,171,83,121,177,126,183,106,22,212,151,221,74,226,143,143,135,237,198,148,201,114,95,47,214,55,38,217,226,164,38,76,89,255,112,81,103,37,235,213,190,184,86,255,168,171,183,213,101,123,179,142,48,187,235,213,250,87,53,199,244,29,199,234,201,239,28,98,54,55,178,165,108,110,203,37,228,249,74,190,50,219,27,115,9,122,93,222,110,247,108,41,235,187,82,136,248,160,168,220,148,133,69,210,139,39,14,97,158,247,114,252,172,233,20,138,157,90,68,28,26,126,38,137,110,54,252,127,101,133,203,193,
+{120,218,236,189,107,119,220,56,146,54,248,89,250,21,108,239,7,167,186,82,106,75,53,239,206,110,169,93,103,125,235,106,207,248,214,182,203,51,187,213,117,116,152,153,148,196,174,76,50,139,100,202,82,253,250,141,0,120,1,73,128,4,64,0,132,119,167,79,31,151,50,19,64,4,30,68,196,131,75,16,60,62,30,252,223,46,221,28,182,81,176,219,133,197,237,229,241,241,58,133,191,146,77,16,174,211,124,113,255,195,245,182,56,193,127,130,227,112,179,201,162,60,15,222,62,251,252,247,67,18,102,15,87,207,94,188,255,4,63,93,118,235,108,86,219,19,252,71,84,7,126,34,85,162,164,8,30,125,190,141,202,122,39,193,245,33,89,23,113,154,4,235,112,187,62,108,195,34,202,131,2,127,207,214,1,20,137,147,40,72,175,131,251,37,124,25,22,65,76,127,60,62,186,11,183,135,40,248,122,155,230,81,85,12,126,187,63,11,176,109,250,35,124,206,162,226,144,37,209,38,136,147,32,11,55,113,152,228,1,42,13,63,29,31,97,231,35,248,39,6,201,219,135,96,19,93,199,88,180,72,131,85,4,255,47,190,70,81,18,60,33,229,63,188,14,22,113,178,222,30,242,248,46,58,57,123,196,98,6,178,75,204,130,64,136,218,167,215,239,218,168,209,90,136,26,212,18,225,6,181,250,184,145,154,195,184,9,80,163,176,28,31,81,212,52,48,235,32,118,124,196,199,236,244,195,235,191,92,80,224,200,159,98,236,138,176,193,46,24,128,239,243,179,14,124,180,34,133,47,24,64,16,42,246,17,36,149,135,17,132,34,55,88,97,12,196,170,156,61,28,75,251,27,65,241,130,194,184,124,16,56,239,42,174,241,184,232,33,121,65,161,132,202,124,47,102,43,115,209,132,6,150,15,210,128,226,87,197,215,52,56,14,202,255,221,133,89,28,174,182,80,250,158,244,246,225,44,8,94,19,76,243,120,23,111,195,12,113,169,218,140,147,155,170,209,227,35,166,213,135,224,47,56,84,209,253,58,218,23,116,196,176,88,30,223,0,238,240,251,42,45,110,161,210,205,1,85,135,145,200,162,70,129,67,78,177,223,68,69,148,237,208,47,176,234,239,135,112,147,133,141,206,128,199,97,91,128,110,173,97,62,62,146,31,104,254,48,215,106,140,140,119,61,102,77,148,134,74,71,98,183,233,134,234,38,82,151,245,4,94,195,11,215,221,104,77,59,77,199,183,21,166,191,222,70,0,237,61,246,254,6,84,79,16,149,186,135,37,60,212,83,104,19,13,146,181,217,159,19,12,206,91,70,206,70,217,161,62,119,3,45,27,103,135,250,204,11,181,221,72,235,186,207,173,232,56,208,231,110,116,108,5,199,129,62,243,130,99,55,54,178,125,110,5,197,186,127,188,206,151,125,102,59,179,78,11,73,163,253,220,49,218,66,210,104,63,115,140,182,16,118,230,69,58,177,59,249,173,12,117,129,47,253,189,235,132,183,50,212,133,21,121,94,120,187,96,58,212,234,209,237,195,62,202,86,233,54,94,119,173,51,94,223,210,80,85,5,160,78,92,10,243,96,17,221,239,17,171,239,2,252,227,244,254,228,4,226,233,69,215,5,165,186,12,174,244,247,174,15,74,117,25,43,242,156,144,223,101,210,103,182,211,189,46,215,99,10,125,31,239,249,169,184,231,96,41,82,61,7,135,250,123,215,19,165,122,142,21,121,174,216,234,185,96,172,219,83,21,169,193,166,3,130,253,164,214,216,158,79,148,214,46,211,225,143,207,94,190,126,246,174,205,50,77,245,209,110,151,213,123,61,175,154,96,167,20,105,114,23,101,5,14,228,77,22,193,84,33,78,128,69,107,199,12,26,245,203,2,50,234,191,124,245,211,199,87,175,218,234,55,213,71,213,47,171,247,212,175,154,224,169,95,77,16,136,250,101,193,150,250,196,26,37,226,228,171,255,254,208,210,155,214,27,143,147,80,175,167,112,233,1,92,75,163,84,5,198,21,5,11,252,188,10,115,242,177,118,174,36,132,194,225,54,216,166,55,48,143,43,110,119,249,9,244,50,46,167,84,88,101,159,126,141,50,98,159,45,59,131,10,82,61,125,243,254,167,86,79,105,189,241,158,66,189,94,79,73,93,65,79,123,29,225,170,124,254,132,177,172,1,149,207,159,116,149,38,53,43,163,26,80,250,252,9,79,109,172,45,80,28,135,228,244,252,9,79,241,90,62,140,65,107,137,192,211,189,156,231,127,120,255,95,45,213,
+105,213,102,129,192,83,190,169,218,211,157,84,111,45,15,248,246,117,47,178,154,135,54,11,253,158,21,139,170,15,67,19,193,127,124,108,79,36,202,138,180,7,67,51,65,168,216,103,33,172,44,52,156,52,57,77,162,27,136,176,119,16,187,210,180,232,27,206,122,37,167,245,139,231,29,173,203,138,163,90,99,197,254,116,97,53,160,245,250,176,234,106,219,72,141,226,109,173,238,208,236,230,213,235,55,109,117,105,197,241,217,13,84,236,171,139,149,91,234,166,135,100,131,171,194,195,254,107,152,193,95,165,105,36,17,44,223,242,2,131,104,116,19,101,45,164,175,195,85,46,163,193,223,158,61,239,71,110,82,249,94,60,219,128,159,211,237,161,96,172,150,236,70,85,161,240,122,155,146,5,234,233,62,5,213,130,228,176,91,129,9,183,45,1,202,164,25,131,173,8,218,191,189,121,255,254,99,11,219,170,230,88,8,33,53,251,93,35,181,185,232,110,210,175,201,40,190,251,176,128,197,113,18,92,239,210,13,85,127,89,198,193,118,15,94,188,125,9,235,249,183,239,95,226,202,59,220,94,118,43,98,28,41,195,96,187,3,157,138,29,237,177,114,103,147,33,221,237,15,213,22,67,6,19,156,56,217,208,128,177,137,239,226,13,238,19,220,7,171,7,8,31,199,71,188,165,215,61,204,248,146,224,207,193,67,181,126,75,170,45,158,223,15,105,17,87,83,42,152,36,61,44,97,145,143,96,145,224,68,145,250,35,202,82,132,43,76,184,86,72,138,215,1,23,74,136,252,168,12,156,31,223,255,252,238,101,123,26,85,182,64,227,110,211,130,40,244,146,22,250,51,41,210,74,178,12,118,39,181,41,151,35,79,35,237,46,216,111,195,117,84,15,125,22,223,220,22,141,69,151,22,190,137,214,241,14,168,145,216,245,101,16,95,67,61,0,43,221,197,48,182,155,37,86,126,82,54,116,6,63,173,1,149,21,110,146,213,81,17,231,106,40,20,26,196,241,185,137,97,42,180,141,174,11,174,128,179,70,254,46,216,29,192,16,161,49,1,208,113,158,192,138,117,83,26,212,42,230,250,210,235,79,239,158,189,107,3,67,235,113,99,99,134,246,113,77,151,128,143,147,180,56,13,79,169,39,63,110,244,90,188,11,223,157,44,3,26,112,182,56,35,130,94,100,95,129,191,80,187,70,185,56,185,174,149,195,144,192,85,238,245,187,191,117,149,195,122,60,229,78,207,169,106,89,180,135,102,200,78,86,141,113,179,220,73,96,226,31,23,96,216,253,210,123,88,25,146,210,77,33,212,244,9,191,3,164,72,52,6,239,223,94,191,123,253,249,85,199,97,105,205,81,128,147,40,70,193,149,58,76,47,146,52,11,194,238,0,16,220,169,15,11,209,63,62,62,36,121,120,141,171,229,106,69,2,255,44,120,35,128,191,192,151,141,234,101,144,8,73,157,116,87,134,112,108,148,219,230,29,117,76,97,195,97,118,35,211,118,61,69,193,95,22,121,20,109,202,118,239,210,120,211,110,56,239,169,140,176,197,225,54,254,131,238,90,146,38,24,212,191,198,184,239,25,96,163,237,105,212,182,43,172,215,137,178,140,166,52,50,60,184,228,44,11,177,210,247,241,130,236,51,183,196,237,227,62,86,224,244,187,125,154,21,184,13,203,174,99,169,9,144,193,110,31,105,173,194,130,145,179,139,179,12,88,111,245,3,124,253,203,15,97,242,112,117,241,43,218,49,126,2,104,127,109,250,251,252,63,95,208,194,141,14,31,217,245,118,20,110,78,105,1,208,40,188,33,220,31,6,207,159,125,134,85,209,215,148,252,14,182,177,61,236,146,188,179,91,187,137,182,17,120,2,213,33,32,74,156,255,186,12,110,81,129,82,151,234,91,86,27,90,173,209,230,37,249,28,60,255,249,29,248,202,6,48,128,192,139,244,70,36,151,14,17,221,175,111,195,228,6,169,143,12,196,54,132,216,9,53,88,232,5,234,108,202,207,136,202,168,86,87,187,195,182,136,123,186,145,111,247,91,162,228,50,200,111,227,107,178,91,15,159,114,152,193,141,42,81,13,140,80,42,216,82,79,38,218,23,124,206,98,96,158,22,1,71,132,142,248,176,3,97,209,47,196,34,87,135,228,42,78,72,27,172,69,144,47,202,205,208,120,219,76,3,211,132,14,13,57,119,184,197,45,150,116,23,49,99,163,161,219,50,184,78,179,117,132,65,87,74,205,43,82,220,153,178,89,188,105,252,104,137,21,89,
+29,7,52,14,139,62,176,31,162,12,180,223,85,194,176,231,100,100,137,233,148,83,132,60,90,167,160,15,186,28,217,60,41,8,203,100,121,97,64,93,57,172,27,205,187,88,79,215,191,57,144,219,239,35,8,151,65,220,214,239,192,126,12,196,74,210,234,87,95,179,112,223,168,71,191,44,207,45,96,18,69,167,182,7,156,149,197,173,147,68,9,217,12,84,227,106,144,162,86,149,201,153,96,62,170,14,204,75,101,161,33,241,19,203,199,27,136,180,193,54,134,72,154,79,215,81,9,61,162,174,10,132,74,74,247,116,238,69,157,17,245,192,135,198,180,163,33,167,25,91,230,216,185,8,215,183,139,162,192,89,199,18,99,207,254,58,222,70,63,228,69,54,0,11,169,212,39,232,16,102,145,95,137,99,17,0,54,81,146,151,225,140,238,193,67,236,43,125,144,158,232,20,15,251,136,252,116,200,163,188,158,111,54,191,163,38,68,229,246,92,7,27,162,167,120,164,192,215,24,28,28,22,38,176,120,166,76,12,101,234,198,242,40,187,235,172,84,136,90,208,179,69,254,199,15,219,228,134,157,134,180,185,142,22,107,186,249,34,139,200,81,58,237,230,47,56,39,92,222,17,131,199,46,67,207,114,212,240,113,254,199,227,246,202,40,185,78,131,69,176,106,135,229,5,253,8,56,195,152,55,127,159,176,42,96,77,38,182,101,48,179,130,152,22,2,0,171,45,181,56,88,107,35,179,99,193,12,103,100,48,243,11,87,233,161,40,167,68,113,18,252,2,131,149,197,43,88,160,47,137,17,252,26,208,162,204,218,238,117,81,181,149,147,96,185,207,210,125,148,193,202,187,14,153,216,86,6,97,51,219,156,5,108,215,110,162,226,19,246,185,215,59,4,150,237,73,89,144,193,178,202,76,160,57,4,235,226,0,115,73,130,31,35,114,19,229,235,44,222,23,105,70,45,51,95,34,75,222,70,229,177,254,110,159,225,84,153,204,194,200,65,4,12,126,193,24,18,187,188,198,38,119,209,46,205,30,130,61,206,26,137,40,156,116,7,171,213,254,12,212,251,0,223,162,138,139,147,246,33,12,252,4,126,22,174,97,133,182,104,119,18,251,24,116,58,89,21,229,79,94,215,135,44,195,47,1,228,116,77,71,139,234,1,170,239,194,251,106,159,10,247,248,183,17,73,143,56,169,167,183,61,165,200,28,247,51,120,80,7,124,12,103,96,73,61,205,234,242,1,95,57,226,140,85,86,8,186,42,157,69,215,10,44,241,192,170,89,252,211,242,84,227,174,110,31,211,45,177,137,138,234,7,21,195,194,124,141,50,248,37,9,119,181,86,204,220,158,15,75,30,21,255,25,61,116,240,88,6,176,34,225,204,40,90,122,64,205,223,34,102,212,62,69,5,213,225,49,124,253,184,242,136,7,30,62,96,92,143,81,194,227,179,224,117,82,150,199,207,203,86,64,251,45,202,146,104,75,99,85,14,81,43,41,182,15,193,10,204,224,55,0,52,71,111,75,73,175,97,34,184,14,33,28,66,239,54,135,253,150,44,47,234,134,112,126,253,128,118,222,65,163,179,17,19,246,65,232,238,25,80,232,255,51,234,25,42,110,193,145,125,0,202,105,180,135,245,164,149,166,235,28,146,248,119,96,147,5,116,245,164,139,255,179,53,184,98,206,31,130,65,78,169,235,50,219,23,208,89,76,56,194,165,20,141,19,135,61,225,211,144,20,132,81,137,239,226,109,124,19,225,33,43,241,241,56,39,54,17,188,69,113,199,71,65,246,11,46,23,211,100,251,240,107,153,217,67,124,239,107,128,95,65,68,67,102,34,109,157,65,225,240,23,74,152,117,249,170,48,150,163,33,135,202,199,194,95,127,201,226,34,194,56,220,105,25,3,40,26,11,113,111,210,46,104,84,226,134,181,73,232,94,145,20,164,144,100,49,189,71,223,255,13,163,120,88,198,217,82,229,101,25,161,177,197,252,176,202,35,0,29,96,161,58,228,193,53,142,10,93,230,39,65,68,22,196,59,232,9,132,49,20,202,250,17,97,130,34,143,182,215,93,71,229,142,214,9,207,75,187,99,83,90,11,13,222,100,52,112,136,203,233,68,21,114,233,112,144,184,129,163,152,65,152,239,7,139,79,164,95,235,232,121,152,71,61,77,90,219,46,37,143,48,229,27,125,126,138,202,52,179,242,87,122,60,138,211,127,50,253,193,118,134,34,71,156,127,74,51,88,200,47,198,188,166,42,200,137,88,229,110,26,246,152,113,
+22,224,204,40,139,54,237,221,72,218,198,199,8,166,38,121,36,45,179,44,47,45,58,163,229,193,210,25,37,228,102,159,50,83,78,233,201,38,19,30,222,97,56,239,18,22,78,204,105,108,192,113,234,4,5,172,193,12,51,238,152,134,120,192,74,54,159,8,59,224,230,63,117,251,142,101,241,132,241,57,232,249,243,15,73,79,78,14,54,4,225,185,160,199,190,141,60,17,245,80,134,237,133,190,66,220,55,90,99,180,119,34,70,110,175,87,227,252,115,22,38,57,158,151,140,7,127,166,240,37,219,135,129,38,56,250,215,165,155,46,188,13,127,139,234,160,83,84,191,159,5,117,64,58,62,90,165,192,235,97,82,101,200,148,123,104,57,26,48,206,220,73,196,216,236,96,98,11,184,209,73,18,110,141,224,161,18,196,21,74,6,155,142,243,194,178,63,135,226,146,93,111,74,183,250,62,212,8,167,243,77,113,65,239,247,117,129,182,165,132,119,209,34,217,69,99,18,160,216,5,175,90,201,162,157,94,225,207,204,244,37,36,134,68,198,32,13,114,152,64,3,45,44,17,97,168,246,21,208,220,166,225,166,220,25,222,196,48,177,129,1,170,103,25,213,72,85,51,129,215,239,73,149,36,194,48,31,102,88,246,3,12,96,142,1,166,90,148,193,180,229,248,8,247,152,105,86,48,4,254,122,39,250,46,78,153,12,228,34,221,145,180,184,221,14,52,129,105,85,145,130,81,255,233,79,45,75,6,112,255,14,211,252,238,116,187,215,101,90,172,187,62,131,126,227,34,1,122,157,29,96,89,129,33,56,97,102,51,29,167,125,77,23,17,185,132,176,170,104,95,96,82,173,69,114,25,169,16,206,31,128,161,54,193,98,117,222,14,21,171,139,238,254,120,159,9,72,85,102,142,20,229,69,51,84,184,3,94,79,55,114,42,5,40,48,73,139,118,112,204,162,67,151,119,150,155,104,219,44,132,133,241,159,212,4,17,140,173,221,30,174,175,183,81,19,249,81,58,57,98,196,179,198,8,141,143,204,102,201,102,64,125,0,70,29,27,211,193,15,73,119,195,24,36,188,13,247,18,234,117,151,236,149,114,59,150,152,94,70,25,57,248,4,245,112,22,0,191,237,209,72,113,106,64,202,19,47,193,217,194,6,135,140,108,213,224,44,63,61,93,69,167,116,191,187,117,94,179,139,178,155,8,183,118,22,33,179,155,180,98,116,19,236,39,212,21,153,112,129,95,145,65,107,239,21,149,89,105,105,18,181,247,17,10,164,243,117,161,35,189,85,185,209,224,117,245,245,168,22,229,255,170,36,2,16,114,150,68,95,113,227,104,104,3,255,197,219,151,0,47,20,188,20,214,92,146,53,112,121,244,53,173,13,88,144,47,171,176,59,176,133,172,164,148,217,6,153,253,38,81,27,162,253,166,104,183,135,5,104,77,169,116,73,78,230,255,56,55,56,197,229,120,30,80,162,164,135,82,173,108,17,212,39,7,187,223,70,11,220,114,31,152,228,81,69,104,89,78,108,173,119,247,194,128,150,41,247,42,162,162,43,110,31,194,170,22,221,188,23,91,155,15,103,103,103,29,193,117,45,142,108,88,39,199,100,254,149,111,201,142,79,122,87,46,84,201,156,161,124,164,132,238,12,146,13,127,140,130,27,156,70,144,253,175,77,0,243,97,88,87,157,73,42,10,35,31,35,231,81,43,72,136,133,14,32,86,183,114,209,211,156,164,242,156,2,102,68,239,182,218,171,44,253,141,36,183,35,81,227,132,29,147,47,136,220,86,84,68,61,227,14,87,173,138,168,55,115,160,186,84,37,47,7,235,231,183,197,164,250,240,247,164,250,224,12,147,234,95,111,167,201,223,172,182,35,245,153,145,188,141,96,45,128,164,17,221,147,73,29,142,99,22,172,187,51,0,50,79,189,175,200,191,187,74,96,181,192,189,70,118,32,91,91,166,109,53,160,232,229,88,27,100,48,39,182,65,6,116,98,27,100,80,39,182,65,6,118,98,27,100,112,135,219,224,238,102,148,147,229,214,94,116,61,187,163,131,91,207,241,206,216,188,135,42,241,33,220,222,68,171,44,100,151,162,48,29,218,175,30,22,55,241,166,117,2,181,134,38,91,158,208,103,238,103,111,126,42,107,247,206,1,122,199,45,164,32,232,8,51,173,34,190,142,235,179,144,214,78,97,249,240,19,62,64,215,108,250,147,197,101,17,239,162,38,199,162,202,100,136,35,118,249,89,149,111,218,32,66,9,88,237,120,117,13,
+80,45,122,43,225,146,118,88,135,131,30,98,89,254,14,48,197,155,166,74,165,229,194,151,158,140,7,193,235,107,152,215,6,249,1,214,144,120,134,78,220,178,122,216,51,120,255,250,229,105,18,111,207,30,5,172,78,81,177,190,237,42,117,95,166,127,144,207,45,173,176,52,106,202,213,172,149,119,138,242,97,5,116,143,33,190,86,150,140,201,147,224,175,79,131,251,224,175,193,234,108,13,115,226,22,71,194,234,231,95,48,243,234,40,116,71,254,248,158,157,37,124,223,178,135,178,26,142,72,163,218,223,112,95,185,30,168,146,159,97,188,114,76,216,105,37,252,208,218,72,118,36,239,143,181,71,146,114,200,138,13,70,181,104,241,244,7,250,29,205,39,140,147,253,1,102,210,228,225,16,146,202,72,190,232,62,63,185,231,109,84,115,40,22,36,98,225,254,88,236,111,31,114,178,89,130,63,243,183,102,136,101,116,135,157,157,4,197,5,43,135,20,239,11,170,150,88,143,161,230,227,32,93,175,15,25,61,114,58,235,172,93,183,253,49,133,229,246,215,106,26,120,11,96,84,127,111,99,20,142,223,209,255,194,88,197,236,52,179,27,10,104,227,231,236,49,5,126,65,118,136,27,167,205,9,77,209,221,149,78,206,73,156,211,167,232,18,178,73,252,154,12,81,156,87,171,179,83,108,35,218,208,153,101,122,40,132,191,82,3,139,147,227,163,186,253,118,220,168,3,39,145,128,53,68,42,29,31,49,15,95,50,75,72,178,149,14,120,34,92,204,3,184,184,133,177,141,49,248,236,209,250,238,162,237,195,241,209,109,76,30,81,142,138,147,242,153,224,82,119,178,239,141,73,53,184,121,90,81,114,35,154,198,16,16,116,124,4,202,17,65,152,7,25,111,151,244,97,14,92,195,134,120,222,146,227,2,154,120,83,76,182,81,131,69,116,125,93,137,199,141,127,8,95,71,223,213,137,156,39,180,97,28,204,82,175,37,27,49,227,234,185,213,221,158,30,242,65,241,119,224,203,71,101,207,99,70,79,156,192,38,56,41,196,156,59,220,87,95,6,135,100,139,214,0,106,63,37,170,162,222,228,175,227,163,109,252,148,24,24,254,139,210,159,62,129,166,159,129,109,144,231,34,218,103,56,205,179,210,215,117,91,136,100,217,24,193,126,27,99,107,84,9,0,128,60,184,13,77,99,74,13,182,126,14,38,244,46,45,162,230,25,239,198,102,242,67,76,79,58,48,169,137,230,219,80,91,168,118,228,73,162,40,244,25,215,86,52,178,183,118,141,58,123,171,60,159,106,81,169,81,7,187,24,117,176,210,188,73,214,144,172,145,87,142,71,179,101,91,37,89,199,169,3,75,221,4,21,118,124,212,194,17,131,28,77,167,103,149,16,248,50,147,245,212,148,195,231,18,121,110,93,186,11,138,30,142,2,199,71,101,24,8,244,162,0,222,26,192,70,38,213,40,128,15,252,55,97,32,80,142,2,165,199,213,97,32,80,139,2,199,71,253,48,16,40,70,129,227,163,110,24,8,84,162,0,184,124,47,12,4,10,81,128,189,50,225,154,19,82,44,71,129,24,58,192,117,120,104,165,8,249,94,95,243,54,104,176,103,79,148,187,174,204,180,49,129,48,211,85,244,80,205,119,183,100,207,178,186,241,230,253,135,224,203,179,55,115,178,40,142,30,213,41,191,141,247,193,109,186,221,228,106,4,40,137,121,222,77,216,84,29,0,11,1,181,63,48,1,59,46,146,65,150,129,190,157,28,202,6,217,111,124,128,59,52,10,190,10,97,166,147,137,207,126,232,243,33,173,194,29,67,124,40,164,137,41,45,210,6,157,186,134,84,30,72,83,46,206,73,104,24,216,85,69,249,208,200,249,57,47,209,176,154,238,87,219,104,12,4,77,182,202,89,147,10,246,185,134,25,149,43,225,195,152,182,40,159,107,58,97,210,21,163,77,167,38,57,63,167,183,23,228,235,40,33,207,180,197,213,101,52,164,79,1,30,213,208,56,15,38,115,4,181,144,242,81,83,218,79,162,96,85,167,252,138,169,194,100,7,40,1,183,104,151,99,206,1,122,48,94,104,195,72,32,43,79,19,33,200,55,208,32,251,226,78,67,14,182,249,149,177,100,60,46,204,162,42,233,224,255,191,131,48,60,32,223,107,15,200,146,25,141,102,16,26,180,6,70,99,201,12,102,179,107,196,38,144,254,127,102,188,210,214,222,134,78,232,185,248,159,208,35,137,162,124,28,186,248,159,56,52,239,136,
+12,143,206,255,4,37,135,131,119,51,57,66,125,255,63,17,74,7,82,249,112,245,253,255,132,43,143,134,103,120,168,254,39,118,77,31,201,122,40,105,146,255,192,86,128,104,221,79,43,242,151,252,229,147,3,213,174,75,150,238,186,219,156,236,22,192,216,218,219,252,182,230,241,17,179,108,151,223,214,36,102,3,86,129,123,180,216,87,24,57,197,131,136,207,188,13,94,170,95,149,145,86,39,103,229,172,199,241,134,105,120,100,206,117,71,70,106,76,70,247,67,142,143,116,144,13,106,96,233,166,183,202,254,7,123,224,152,165,121,190,39,231,231,5,123,254,217,60,156,220,58,1,189,128,32,115,116,180,96,18,15,151,153,32,0,177,45,115,40,227,162,186,147,160,60,155,45,31,73,94,210,253,228,156,60,158,207,60,229,116,10,237,131,53,5,116,32,30,163,162,143,73,200,120,76,52,124,220,222,39,194,252,202,172,76,121,2,112,105,113,172,205,214,32,114,163,223,241,49,59,4,168,181,87,243,175,52,78,22,237,231,176,179,214,167,156,133,32,103,48,88,38,241,246,138,238,74,231,36,142,71,208,23,248,92,102,186,45,152,146,2,224,80,118,131,215,127,192,167,214,61,111,208,149,57,181,171,228,55,26,190,193,195,109,252,138,247,144,111,11,85,176,209,40,155,83,249,90,129,142,246,228,123,185,62,228,209,46,158,179,11,149,124,54,102,237,98,57,221,201,6,244,4,229,211,61,201,252,155,220,135,90,143,214,197,60,69,56,220,139,58,127,30,79,89,92,15,193,37,68,143,255,45,248,143,247,175,223,93,189,123,21,60,125,26,156,126,127,124,180,200,206,151,217,5,144,203,83,22,218,101,6,194,65,228,242,244,251,46,92,181,44,108,175,76,204,41,27,185,60,198,135,133,170,174,181,50,228,146,205,132,222,174,207,203,195,137,245,69,249,71,121,4,92,158,0,43,15,94,165,79,51,118,207,171,136,249,3,115,86,183,37,177,182,60,160,195,9,86,22,156,6,235,243,224,175,191,60,253,21,126,36,255,201,130,239,130,245,69,251,130,215,228,38,226,245,182,253,92,64,118,33,217,251,137,125,173,213,97,248,139,156,88,11,122,123,254,151,236,130,233,113,167,183,173,158,110,226,235,107,224,169,100,29,89,49,99,254,124,167,17,202,60,13,80,127,135,124,91,13,219,88,40,169,179,231,29,106,95,203,228,100,235,151,41,19,67,234,7,139,248,12,102,150,183,225,246,154,100,76,67,216,60,197,113,36,215,63,53,119,1,226,108,155,205,123,254,21,51,157,73,30,125,152,175,233,202,108,67,230,39,235,98,40,113,130,182,195,123,188,159,206,231,223,49,7,125,207,31,93,14,202,111,29,55,90,87,134,123,87,199,39,21,21,111,252,215,119,88,43,137,208,48,211,248,154,214,204,233,96,59,83,126,232,177,174,19,209,238,33,41,203,46,84,232,165,3,69,132,215,188,97,194,11,89,91,93,7,15,233,1,101,158,5,239,171,171,253,150,199,71,229,5,22,81,16,37,233,225,230,182,78,154,198,71,113,215,228,189,31,101,154,11,38,100,38,199,193,81,253,68,124,176,192,36,146,56,185,75,183,119,213,27,68,240,106,143,147,246,81,53,62,39,193,205,212,93,6,15,204,125,109,188,93,81,172,122,197,201,219,165,219,5,228,1,140,250,105,47,178,244,196,167,194,238,131,2,51,104,31,240,18,122,238,187,93,4,26,145,241,127,24,120,172,167,210,104,64,27,250,12,79,253,204,74,209,164,16,87,90,201,104,66,30,82,121,24,120,140,170,198,166,117,141,160,37,109,164,113,185,194,12,125,115,218,28,86,210,10,245,114,255,202,186,66,141,112,77,94,167,137,168,104,199,62,28,112,115,147,181,94,94,113,104,63,109,76,82,174,217,135,22,72,226,51,20,186,106,221,68,196,104,85,221,41,83,95,36,195,187,68,38,78,154,188,232,150,236,214,227,241,0,84,124,147,164,89,116,5,243,149,188,186,26,139,171,77,194,230,131,48,218,244,133,87,10,110,31,106,45,74,41,249,241,209,17,1,142,192,152,224,51,108,184,115,3,19,52,86,141,167,79,63,127,252,249,85,79,241,171,36,197,159,219,143,247,95,252,42,212,55,213,82,153,108,86,49,58,215,183,40,182,84,174,159,2,169,53,12,179,77,156,132,91,188,51,168,173,31,15,80,40,204,31,217,166,21,118,3,155,61,194,233,73,222,197,73,55,181,135,252,151,21,8,
+101,224,59,174,200,109,250,21,175,155,102,19,224,178,128,60,71,193,62,1,27,222,143,203,8,239,69,50,48,187,80,44,164,34,226,240,238,38,88,244,160,99,111,42,125,241,246,37,190,138,10,10,118,175,109,32,15,154,223,145,13,53,220,104,99,0,235,238,7,230,197,38,186,235,221,74,202,74,193,192,128,133,120,50,240,225,138,13,12,82,0,191,199,245,3,205,125,145,45,105,123,41,113,123,19,242,200,235,188,146,118,52,228,73,172,202,241,100,86,191,201,73,218,203,138,218,171,203,234,60,124,76,14,67,226,13,152,226,93,123,190,211,122,156,239,253,235,151,255,77,159,209,107,173,162,170,39,168,80,42,20,41,159,51,10,51,178,2,222,149,215,248,149,7,60,140,6,18,242,217,135,70,231,215,101,219,121,214,150,163,17,121,44,157,153,129,166,73,158,110,233,57,131,88,165,174,2,183,97,46,28,15,246,241,26,20,200,148,237,199,135,242,34,155,242,164,139,136,165,15,118,117,37,222,68,133,88,98,143,222,81,46,83,131,79,239,140,76,122,81,70,35,185,190,51,135,62,219,39,6,156,57,197,228,78,123,80,145,190,22,205,61,18,140,18,173,103,11,171,249,3,57,92,236,62,90,216,61,253,89,208,39,1,153,229,71,116,143,215,144,176,223,220,66,215,82,230,225,195,90,195,159,62,126,32,213,207,47,135,132,44,91,7,129,70,4,94,92,178,211,56,158,204,27,147,50,43,25,227,98,217,22,173,168,240,189,74,207,151,17,219,58,251,248,168,41,117,254,77,23,17,251,170,253,175,174,233,111,210,36,114,98,254,125,65,110,92,128,35,215,149,27,12,119,217,153,43,12,35,48,139,59,200,35,227,198,37,122,143,160,183,87,153,249,97,199,222,52,192,211,175,244,29,88,145,53,79,207,55,243,182,159,126,250,8,109,124,127,213,122,171,201,79,40,189,204,168,64,17,184,159,2,205,63,154,38,24,203,245,5,175,216,57,147,148,224,149,180,236,101,254,91,188,175,87,188,203,112,149,102,197,85,154,92,145,43,21,217,109,91,142,106,40,133,175,28,234,133,195,128,239,4,153,160,26,123,160,48,77,77,114,135,245,184,170,157,77,198,156,236,50,118,30,32,223,76,30,84,108,100,104,84,203,68,10,254,200,202,107,48,9,51,20,195,87,177,210,78,52,190,42,10,26,26,96,20,41,30,225,158,194,163,163,172,225,185,120,1,73,223,115,225,219,249,61,151,163,26,241,92,174,114,243,121,174,64,77,50,174,227,170,90,241,220,158,74,212,115,197,163,234,218,115,121,152,17,207,229,170,56,179,231,138,148,21,143,176,19,207,197,107,127,250,158,219,58,38,152,203,115,57,170,17,207,229,42,55,159,231,10,212,36,227,58,174,170,21,207,237,169,68,61,87,60,170,174,61,151,135,25,241,92,174,138,51,123,174,72,89,241,8,59,241,92,92,21,244,61,183,117,128,53,151,231,114,84,35,158,203,85,110,62,207,21,168,73,198,117,92,85,43,158,219,83,137,122,174,120,84,93,123,46,15,51,226,185,92,21,103,246,92,145,178,226,17,158,228,185,72,241,22,23,216,208,252,68,193,154,211,244,158,224,149,180,236,89,167,233,99,170,249,61,77,215,30,84,133,105,122,127,100,229,53,240,96,154,238,104,128,45,78,211,101,7,89,115,154,238,194,115,109,76,211,45,12,172,195,105,186,246,160,42,76,211,157,120,174,189,105,186,163,1,182,56,77,151,29,100,205,105,186,11,207,181,49,77,183,48,176,14,167,233,218,131,170,48,77,119,226,185,246,166,233,142,6,216,226,52,29,3,133,197,105,122,156,76,21,172,73,246,61,193,43,105,217,179,146,253,152,106,126,147,189,246,160,42,144,125,127,100,229,53,240,128,236,29,13,176,69,178,151,29,100,77,178,119,225,185,54,200,222,194,192,58,36,123,237,65,85,32,123,39,158,107,143,236,29,13,176,69,178,71,113,22,201,30,154,159,40,88,51,100,244,4,175,164,101,207,26,50,198,84,243,59,100,104,15,170,66,200,232,143,172,188,6,30,132,12,71,3,108,49,100,224,27,104,100,6,25,203,245,61,23,190,29,246,92,40,32,118,143,97,217,210,136,113,84,35,158,203,85,78,210,115,199,84,211,24,88,129,154,100,92,199,85,85,242,92,237,65,165,158,43,30,85,198,115,251,35,43,175,193,36,204,136,231,114,85,84,241,92,71,3,92,123,174,156,194,54,60,87,147,236,93,
+120,46,71,53,226,185,92,229,230,243,92,129,154,100,92,199,85,181,226,185,61,149,168,231,138,71,213,181,231,242,48,35,158,203,85,113,102,207,21,41,43,30,225,73,158,139,226,44,122,46,20,16,187,199,176,236,89,61,119,76,53,191,61,87,123,80,21,60,183,63,178,242,26,120,224,185,142,6,216,180,231,134,119,55,173,180,157,246,213,40,17,231,145,204,158,86,208,196,249,208,24,135,248,58,212,155,136,147,216,164,34,188,186,136,133,224,204,123,154,166,84,229,66,94,149,101,16,110,243,180,124,137,86,30,212,175,246,99,70,184,171,161,29,11,68,4,249,90,87,10,139,44,80,65,63,67,6,136,186,138,13,176,167,175,4,117,24,5,89,198,74,168,200,11,201,30,152,181,18,165,81,80,232,204,212,33,25,237,37,123,199,130,110,164,32,141,12,146,124,255,110,132,69,30,226,187,181,254,130,239,189,90,197,120,229,207,137,32,249,181,167,161,165,153,0,202,17,16,172,156,250,194,233,130,74,15,76,77,24,80,230,192,148,65,177,71,227,238,222,186,61,99,146,33,237,85,45,105,159,238,15,244,77,76,127,25,183,164,189,43,83,218,203,35,207,233,192,160,45,237,231,48,166,189,154,53,13,245,105,212,154,186,119,163,232,218,83,213,206,144,69,213,247,154,72,71,36,174,118,118,44,169,18,197,215,127,80,117,145,5,169,106,111,200,134,42,177,98,43,146,235,141,180,237,236,77,25,207,94,206,122,100,163,16,95,63,187,230,179,31,67,92,33,2,41,235,111,216,128,246,50,22,52,41,250,48,211,62,146,75,101,119,237,212,201,54,83,17,110,122,237,4,2,213,102,197,134,114,225,172,173,157,44,164,194,185,95,59,77,6,121,238,181,147,209,81,240,117,237,164,27,41,12,174,157,56,25,201,61,13,191,233,181,147,35,119,158,119,237,52,201,144,12,173,157,4,150,180,119,101,74,46,214,78,46,141,105,206,181,147,174,61,153,88,59,245,237,136,171,221,55,187,118,114,100,67,243,173,157,166,26,207,164,181,147,216,122,246,14,205,199,234,218,201,177,1,57,93,59,145,212,84,187,107,167,78,242,174,138,112,211,107,39,114,195,187,202,172,216,80,106,177,181,181,147,133,204,98,247,107,167,201,32,207,189,118,50,58,10,190,174,157,116,35,133,193,181,19,231,1,143,158,134,223,244,218,201,145,59,207,187,118,154,100,72,134,214,78,2,75,218,187,50,37,23,107,39,151,198,52,231,218,73,215,158,76,172,157,250,118,196,213,238,155,93,59,57,178,161,249,214,78,83,141,103,210,218,73,108,61,123,135,230,99,117,237,228,216,128,156,174,157,200,51,58,118,215,78,157,167,152,84,132,155,94,59,209,247,180,41,204,138,13,61,99,101,109,237,100,225,17,43,247,107,167,201,32,207,189,118,50,58,10,190,174,157,116,35,133,193,181,19,231,73,215,158,134,223,244,218,201,145,59,207,187,118,154,100,72,134,214,78,2,75,218,187,50,37,23,107,39,151,198,52,231,218,73,215,158,76,172,157,250,118,196,213,238,155,93,59,57,178,161,249,214,78,83,141,103,210,218,73,108,61,123,135,230,99,117,237,228,216,128,156,174,157,200,179,150,118,215,78,157,167,81,85,132,155,94,59,129,64,181,89,177,197,103,101,141,172,157,28,61,42,107,119,237,52,25,228,185,215,78,70,71,193,215,181,147,110,164,48,184,118,226,220,88,208,211,240,155,94,59,185,186,218,96,214,181,211,36,67,50,180,118,18,88,210,222,149,41,185,88,59,185,52,166,57,215,78,186,246,100,98,237,212,183,35,174,118,223,236,218,201,145,13,205,183,118,154,106,60,147,214,78,98,235,217,59,52,31,171,107,39,199,6,228,116,237,68,166,104,118,215,78,157,251,64,84,132,155,94,59,65,33,181,89,177,197,219,74,140,172,157,28,93,86,98,119,237,52,25,228,185,215,78,70,71,193,215,181,147,110,164,48,184,118,226,220,25,213,211,240,155,94,59,185,186,92,106,214,181,211,36,67,50,180,118,18,88,210,222,149,41,185,88,59,185,52,166,57,215,78,186,246,100,98,237,212,183,35,174,118,223,236,218,201,145,13,205,183,118,154,106,60,147,214,78,98,235,217,59,52,31,171,107,39,199,6,100,127,237,180,139,147,170,111,101,31,4,189,187,168,108,135,22,107,105,12,141,124,207,182,25,222,119,218,20,90,228,5,115,73,35,175,225,240,254,251,246,136,40,232,219,
+30,129,10,110,44,215,133,27,26,237,3,12,95,198,187,129,75,52,149,52,17,217,197,136,86,56,112,18,154,201,44,80,250,131,98,2,184,240,158,163,94,120,63,12,156,138,38,90,192,133,247,2,224,186,154,73,1,55,213,226,56,118,77,155,189,186,11,183,51,219,157,80,55,18,120,228,244,115,98,125,2,69,195,123,129,146,46,109,80,168,219,0,136,202,150,72,86,179,242,97,117,9,97,53,190,73,210,44,234,106,219,123,215,1,105,249,123,125,81,16,193,7,91,70,5,250,8,244,86,231,228,139,171,36,69,120,165,41,105,76,116,138,194,219,67,207,235,157,162,49,242,94,23,65,154,21,116,83,104,134,138,186,140,25,162,80,47,126,56,236,232,38,52,65,246,58,237,125,152,21,113,184,205,91,155,201,29,101,248,91,62,3,187,63,117,171,141,142,175,238,195,117,17,148,223,163,224,101,80,164,193,42,10,118,81,118,3,186,175,30,130,107,114,245,118,22,92,135,119,221,87,228,116,181,36,170,248,166,229,74,4,167,228,252,88,163,11,43,110,47,42,123,136,186,189,201,251,221,129,54,170,30,225,159,82,157,82,153,244,123,216,41,252,105,177,103,180,90,51,186,4,56,100,45,133,174,123,175,65,249,132,77,95,87,242,250,10,41,8,195,165,64,79,88,107,125,160,36,12,55,125,5,194,150,201,176,96,168,218,8,125,86,157,73,72,10,46,1,23,202,182,243,18,147,235,193,23,212,12,233,14,244,7,148,189,207,131,226,54,10,110,176,82,142,229,215,110,251,196,91,41,94,15,190,0,192,68,159,36,109,196,86,255,90,118,214,61,15,152,218,191,93,180,129,69,180,244,108,67,60,223,163,13,125,207,153,232,145,31,218,19,128,56,217,198,73,20,92,31,146,53,217,63,228,105,1,178,200,31,151,199,71,171,36,248,225,41,153,180,150,229,32,128,101,135,232,4,126,162,71,29,65,184,189,137,86,89,120,118,29,21,235,219,197,42,89,6,79,254,175,39,240,123,132,231,147,32,249,140,214,236,76,129,121,125,151,157,223,210,202,77,119,223,114,186,57,38,203,204,10,160,163,200,16,238,19,20,210,92,2,16,41,130,181,104,71,193,206,236,171,63,249,250,253,16,38,69,188,141,164,149,254,189,241,170,1,53,171,102,57,182,91,253,52,108,189,2,189,218,210,123,182,220,212,90,6,191,171,27,116,85,189,61,170,227,170,72,143,94,213,84,131,202,63,184,104,168,73,55,98,242,125,213,134,7,204,152,138,122,78,80,201,28,116,131,90,115,129,23,212,217,22,251,125,150,222,95,9,34,102,119,146,210,42,205,204,86,200,215,241,14,5,140,196,137,1,121,170,131,201,77,68,224,43,88,211,156,164,162,101,51,82,158,40,192,168,111,84,44,74,163,134,37,173,129,65,212,196,126,16,74,171,94,253,154,255,70,35,141,193,133,73,187,105,78,28,161,63,4,139,53,124,157,1,30,48,196,97,2,211,150,175,81,124,115,91,228,65,189,41,114,194,89,177,144,186,165,77,224,178,133,124,174,68,10,188,158,219,73,233,241,80,95,151,137,16,232,133,43,90,32,202,37,176,200,79,184,203,183,30,30,213,87,92,72,152,194,139,29,211,173,175,76,191,134,215,93,108,19,131,129,165,153,161,246,122,219,87,169,118,31,9,165,70,220,186,221,224,136,87,203,42,217,198,89,74,75,233,101,255,192,137,60,23,235,129,24,57,208,29,201,69,207,180,225,48,215,105,197,16,55,177,227,101,92,165,27,177,27,96,222,24,166,120,61,146,197,215,225,114,8,164,93,139,111,112,201,97,183,138,50,148,91,149,11,240,220,59,33,103,203,219,67,207,218,36,20,50,177,117,59,210,3,30,228,74,61,185,221,110,121,161,183,82,9,223,63,208,82,169,46,223,232,240,247,135,125,148,189,73,111,224,255,53,111,0,155,129,236,40,203,79,80,15,28,215,90,23,170,67,63,82,66,203,228,67,7,103,129,130,170,216,246,58,194,54,221,199,179,223,39,100,128,186,87,216,169,112,187,45,141,85,190,143,84,104,175,155,213,119,139,172,81,150,99,205,85,49,105,3,166,106,48,174,199,235,86,31,239,158,46,3,175,49,28,48,221,190,186,146,214,42,165,182,32,104,224,39,182,103,213,255,118,233,230,0,33,103,247,91,244,192,244,55,75,11,208,97,113,247,3,185,37,39,1,123,201,241,234,163,14,246,111,255,243,213,255,77,75,54,93,217,70,215,
+197,41,253,18,38,0,120,37,20,142,47,105,1,197,238,195,2,236,36,9,110,195,252,22,154,7,176,78,122,77,226,111,77,131,235,112,187,198,84,9,104,142,212,162,40,112,218,66,163,214,109,171,219,84,17,153,106,42,191,53,166,21,14,128,161,166,174,183,198,154,2,34,52,213,20,180,98,12,246,34,155,110,88,171,195,246,183,43,106,203,87,247,105,118,69,218,190,237,248,196,50,160,102,44,114,141,186,102,35,121,159,230,197,15,193,47,63,192,47,79,127,93,252,242,3,45,8,127,222,150,237,194,124,249,23,172,242,235,98,117,114,194,198,33,73,141,86,157,55,170,114,98,17,42,184,78,147,188,224,53,201,168,154,69,63,4,193,45,153,203,175,130,252,54,61,108,55,24,186,243,135,100,13,1,40,5,192,163,112,115,28,84,255,83,239,218,8,216,204,205,12,61,200,133,29,195,182,72,231,230,236,216,200,152,241,59,38,57,114,115,15,90,201,26,160,92,135,56,72,231,86,163,76,72,250,16,22,178,14,217,101,171,213,54,93,193,215,97,145,238,170,191,43,5,10,232,75,182,56,129,94,85,178,158,191,121,255,156,124,123,217,156,161,101,233,142,22,99,11,149,223,54,197,214,187,61,105,169,221,22,124,123,217,238,239,73,183,8,126,219,148,73,14,219,109,191,12,126,219,148,201,96,64,250,101,240,219,166,204,215,44,6,78,238,118,141,124,219,20,218,31,10,142,206,240,109,83,100,19,109,57,69,224,219,166,200,54,74,110,10,210,49,182,8,253,150,233,124,20,238,57,157,135,111,89,243,135,241,89,192,148,19,254,115,66,254,61,102,11,227,23,87,228,219,218,12,222,165,233,30,38,32,7,152,243,68,103,143,250,45,145,208,206,111,168,30,193,227,227,142,69,196,201,13,242,58,42,17,96,11,199,221,129,111,235,112,19,21,100,198,180,122,192,156,10,252,157,72,15,194,28,108,147,54,7,147,216,120,187,61,62,194,98,215,113,150,23,193,19,82,28,119,50,240,59,220,246,46,231,93,88,245,209,165,72,161,37,76,146,54,209,61,250,127,32,80,46,222,220,171,233,118,124,132,57,239,25,64,120,19,132,5,213,235,49,17,243,152,168,29,212,90,31,31,13,170,125,214,210,155,140,0,37,215,160,63,4,244,247,70,209,188,72,179,168,214,137,234,215,109,51,1,227,221,145,164,3,98,31,128,65,171,73,250,115,211,100,80,117,190,153,29,83,24,226,4,190,142,243,186,125,26,27,242,223,183,248,197,15,163,49,226,211,63,222,72,133,137,178,92,99,103,245,2,129,74,66,243,164,127,157,84,127,104,155,59,211,36,90,60,175,185,242,59,198,238,219,1,178,121,253,122,180,61,108,48,118,252,112,7,107,149,86,27,229,111,80,154,96,87,23,109,26,195,184,220,117,195,21,227,208,1,183,135,151,66,191,13,196,126,219,237,251,170,7,231,152,48,62,106,193,48,106,109,118,233,140,44,24,64,213,24,227,154,159,62,127,36,214,34,30,72,166,1,116,118,210,198,50,189,190,206,163,162,92,75,117,218,251,28,198,76,74,192,71,122,170,134,198,78,31,44,250,133,214,61,59,75,126,5,247,198,133,118,229,89,249,47,79,240,91,9,161,75,178,95,66,87,18,29,233,159,14,171,79,164,82,79,5,242,128,77,41,168,210,129,254,247,59,210,220,175,60,101,24,93,190,91,4,91,162,71,144,149,161,163,35,250,69,154,172,67,102,243,134,126,142,18,156,10,20,95,211,178,229,188,229,29,37,67,5,164,135,24,55,217,208,1,109,190,33,191,115,225,164,85,89,165,91,45,39,36,162,136,91,126,142,63,115,27,46,17,40,219,135,144,68,90,106,53,126,72,226,117,186,137,158,21,229,208,52,177,191,47,232,191,94,220,102,207,138,118,224,15,171,22,130,245,109,152,133,107,152,58,31,31,45,48,180,146,181,246,9,229,131,122,48,96,102,23,227,129,47,107,26,101,3,139,175,216,2,223,18,255,6,141,160,116,102,110,150,38,119,81,198,202,47,82,248,80,43,209,142,92,72,61,249,127,197,48,62,180,151,16,84,174,227,251,50,2,196,173,78,126,32,63,53,130,232,103,104,56,90,255,198,106,13,188,68,91,12,74,224,242,195,117,217,38,142,81,167,213,79,228,71,54,193,234,186,213,42,67,5,111,210,175,81,198,140,118,7,10,242,115,203,52,75,28,74,132,1,134,45,22,129,40,153,71,109,182,252,121,191,31,
+106,153,252,60,220,242,1,139,212,45,55,248,70,97,182,110,144,88,11,12,21,190,253,68,74,50,56,144,207,193,53,144,125,216,248,245,89,64,141,56,135,184,82,89,204,50,56,61,15,226,235,32,73,11,40,126,72,54,108,223,178,43,73,21,62,70,208,167,60,250,212,215,164,252,165,236,139,182,70,13,38,251,109,92,96,42,81,173,83,18,69,155,109,68,255,190,142,163,237,134,55,195,66,152,170,154,12,76,248,85,53,14,248,144,84,180,141,119,49,154,57,163,215,77,124,23,37,180,229,96,65,2,33,150,38,254,151,2,3,180,214,128,208,210,78,108,9,24,119,247,140,116,252,24,124,189,5,129,249,62,92,195,236,38,204,176,191,173,112,85,199,193,225,166,223,224,207,67,77,19,125,137,195,118,3,98,61,216,195,18,62,74,73,40,167,149,220,128,203,180,15,110,125,49,4,210,5,107,64,187,244,46,162,1,61,77,110,162,188,30,48,136,85,192,152,9,29,187,237,67,19,164,74,93,72,168,142,160,212,166,158,154,82,124,155,169,252,48,206,3,90,18,188,45,105,217,124,93,13,215,144,194,153,156,194,31,93,40,204,44,42,186,234,54,0,239,97,5,92,169,11,20,42,240,214,55,80,172,209,246,111,184,150,57,236,91,65,147,236,123,19,223,44,137,24,216,103,15,26,144,159,225,183,198,54,219,244,85,3,39,167,200,71,117,69,194,189,140,30,131,136,12,153,30,20,191,232,107,212,5,125,12,34,102,88,171,99,3,118,80,199,144,26,50,181,9,10,54,208,73,232,215,126,30,61,46,14,69,84,78,68,242,140,48,213,114,147,23,228,191,208,237,242,48,172,63,27,46,107,178,147,136,234,187,82,223,116,189,62,100,89,132,15,116,130,42,143,161,241,199,48,229,59,62,122,12,205,63,62,11,130,215,215,215,1,2,11,243,216,77,240,148,228,203,209,85,106,156,99,214,92,249,3,216,1,44,58,104,237,53,76,227,86,17,165,55,186,166,141,176,100,126,216,214,62,19,188,198,100,137,13,204,11,0,39,24,55,0,169,192,50,160,74,142,169,125,116,55,137,169,65,112,58,36,148,193,54,199,71,121,252,71,180,44,245,66,64,65,31,226,207,27,96,45,224,215,235,0,52,33,26,34,209,50,156,76,142,162,242,162,5,112,152,175,227,184,90,30,117,184,159,252,214,155,39,87,211,71,104,12,55,33,241,191,180,249,222,184,49,11,24,26,241,184,203,150,186,104,123,245,244,234,190,64,43,105,150,79,12,249,200,73,170,45,90,44,178,47,142,133,171,100,214,172,181,19,67,254,94,146,233,78,105,217,240,159,71,237,165,58,204,84,75,109,182,92,249,251,206,148,153,237,43,253,141,246,150,117,32,118,105,72,230,194,131,18,242,206,244,153,149,64,127,227,74,232,172,62,241,40,80,162,35,221,69,107,134,217,67,18,234,177,145,50,197,245,226,34,63,167,78,126,193,181,71,90,168,233,212,27,242,153,33,212,106,162,41,178,21,158,148,37,99,153,92,121,23,19,4,198,73,14,43,130,42,116,213,134,73,64,169,123,217,193,134,214,105,132,190,38,159,27,94,130,170,176,112,3,215,190,141,50,86,22,196,131,45,80,81,181,96,11,139,22,148,29,33,101,97,45,41,16,117,22,37,118,107,238,232,210,50,173,169,61,42,38,48,5,252,141,41,75,173,138,187,217,5,53,63,212,123,93,76,249,104,31,111,211,155,3,183,194,171,242,55,168,1,159,206,216,214,47,143,142,37,255,71,182,34,73,102,44,118,129,217,135,39,214,244,3,254,231,132,252,219,28,143,124,126,253,246,21,126,115,181,105,153,172,112,175,176,222,169,172,155,32,181,123,251,106,229,206,103,187,84,185,235,217,28,197,61,125,138,231,186,120,5,213,215,82,59,118,121,253,226,237,203,187,48,123,245,15,38,60,252,126,8,97,193,244,64,8,249,107,74,90,205,153,51,217,63,73,180,247,238,149,124,123,127,29,111,238,205,103,133,230,36,212,123,163,160,222,143,227,205,253,164,160,222,143,18,234,253,164,160,94,156,227,195,186,119,194,182,94,127,122,247,250,13,99,115,64,158,5,46,3,144,179,136,21,215,199,114,85,238,72,17,239,162,166,125,220,46,62,51,109,66,164,81,211,118,68,26,53,108,76,180,77,195,22,69,26,53,108,86,180,77,67,182,37,12,122,15,104,27,157,184,199,11,86,164,220,85,241,135,76,200,42,203,10,162,22,249,149,
+116,135,252,165,110,120,164,26,39,124,73,52,60,108,124,189,134,255,42,219,238,176,1,246,219,149,86,248,141,154,194,63,202,182,251,147,154,194,63,74,43,252,147,154,194,77,172,19,182,56,28,238,168,253,42,68,60,243,230,199,134,62,243,54,200,196,64,243,134,200,6,67,243,214,200,68,69,243,38,201,134,71,115,118,57,50,73,36,197,138,112,183,39,201,100,67,17,179,46,121,213,63,139,238,70,204,166,108,21,51,15,73,30,94,71,1,115,34,116,127,21,237,211,245,237,226,228,135,186,116,123,54,218,148,105,58,250,25,86,50,63,195,247,1,249,158,200,9,22,79,158,252,64,254,31,252,252,249,5,238,157,255,71,152,28,194,236,33,56,95,6,231,255,231,191,63,193,109,241,142,248,17,201,116,143,165,184,106,126,174,21,64,165,78,169,88,210,200,9,172,78,247,251,20,214,73,229,166,16,76,226,99,220,158,41,90,154,178,51,103,42,188,104,132,183,215,113,68,3,82,230,34,102,175,10,145,150,44,20,72,86,51,130,46,115,186,90,29,192,113,90,47,87,91,205,56,179,199,102,165,52,146,90,57,38,109,203,110,105,84,2,119,241,118,27,203,138,237,176,113,253,19,56,15,3,176,90,72,172,43,246,56,89,186,249,161,152,200,109,254,175,42,173,15,5,69,126,235,74,202,191,81,85,254,71,149,214,127,82,85,254,71,37,229,127,82,85,190,98,236,193,86,135,56,187,137,161,210,172,109,207,76,27,238,182,103,171,53,131,219,51,216,134,199,237,89,109,205,230,246,76,183,225,116,243,246,171,252,191,154,240,255,192,125,247,81,190,199,82,227,139,35,90,172,147,198,134,69,254,248,161,18,213,222,66,163,4,192,171,85,247,174,218,222,31,99,15,142,118,77,19,209,58,87,101,188,159,139,152,160,93,95,90,0,108,179,206,34,154,31,220,120,121,153,240,210,36,4,142,49,63,1,254,143,12,35,194,216,186,20,11,141,131,78,74,117,208,219,68,215,113,130,15,33,226,86,45,201,60,0,75,195,127,111,201,191,187,184,60,90,32,122,180,161,192,111,94,70,215,79,216,221,213,34,131,16,182,38,201,148,15,73,186,123,96,44,7,139,179,135,114,29,201,184,207,170,40,249,220,180,100,9,153,23,138,50,91,41,232,52,174,183,163,60,187,201,122,149,31,86,87,96,22,87,160,68,148,1,45,192,132,136,108,122,148,54,41,216,123,237,214,186,250,154,133,251,214,113,32,61,21,169,12,174,180,196,13,125,92,189,167,192,142,167,193,46,167,83,179,1,21,90,245,174,160,52,209,131,153,81,146,146,80,87,163,139,221,90,157,46,62,219,108,234,222,145,185,30,175,111,216,134,78,223,122,245,120,125,107,162,11,15,194,38,140,87,178,70,131,212,16,162,125,161,188,190,105,8,133,175,197,125,74,147,226,150,223,190,100,200,228,52,35,50,85,82,170,182,212,214,204,93,67,59,5,196,219,218,85,144,79,213,144,12,207,116,252,250,205,112,252,160,84,172,191,228,209,80,75,218,106,198,129,83,83,173,189,208,29,211,224,162,254,171,211,150,32,158,209,125,146,198,237,201,231,126,219,28,31,148,139,172,88,249,81,219,77,5,209,71,86,147,126,12,26,9,128,165,10,77,4,140,175,175,23,80,239,188,22,138,203,142,139,122,171,168,243,84,32,13,126,116,3,27,171,54,146,170,23,160,180,31,110,64,221,130,85,84,124,141,162,36,120,140,114,30,147,4,15,252,243,226,113,235,8,176,137,169,93,203,147,227,1,106,68,98,195,218,116,110,97,105,248,73,67,30,222,179,213,145,39,136,0,149,216,227,214,51,61,228,232,116,240,228,244,162,125,114,122,19,37,81,86,157,190,227,19,255,28,38,91,144,227,95,94,131,80,65,178,189,86,178,192,246,170,154,183,44,78,250,118,208,46,209,127,190,135,252,222,204,124,226,164,178,196,174,103,147,217,59,41,93,186,55,157,230,183,206,178,153,121,126,30,21,180,52,243,164,14,87,228,37,166,38,225,62,79,30,28,242,104,67,86,215,251,44,166,121,174,173,197,143,64,27,176,254,186,123,28,69,110,250,138,220,76,84,164,103,35,229,218,69,96,134,229,212,190,191,233,197,100,243,83,183,127,216,71,157,195,207,150,152,135,140,166,12,237,82,250,95,240,241,65,251,167,235,24,70,46,249,156,151,246,78,109,127,241,16,133,217,146,120,195,18,218,59,233,120,59,9,34,77,255,56,
+17,174,10,52,210,189,108,29,119,180,102,246,165,180,102,7,124,72,224,69,249,95,78,125,113,56,198,21,98,83,177,87,179,92,188,208,204,151,114,81,65,16,198,55,17,12,246,94,12,53,233,43,133,250,54,61,100,57,174,83,14,240,211,242,248,168,244,180,37,217,252,44,63,156,224,77,149,225,46,194,212,195,179,71,188,85,238,134,134,190,77,195,64,140,63,6,227,132,63,172,42,179,220,93,16,57,65,45,165,150,161,172,161,188,90,87,176,188,11,15,236,69,172,3,234,129,4,86,153,96,17,39,28,191,62,25,82,82,65,51,20,218,201,148,25,210,173,58,161,144,213,176,201,94,130,245,101,229,113,130,165,44,199,217,170,45,11,178,227,80,178,26,47,153,22,127,94,148,1,164,220,49,248,173,140,35,149,177,7,66,177,124,211,1,73,47,63,125,166,217,102,127,137,202,96,213,172,161,187,97,155,221,233,17,5,237,94,255,94,136,66,102,217,200,25,135,31,22,204,204,92,36,168,219,35,86,14,102,100,203,8,169,231,217,195,66,174,90,7,31,234,130,232,232,64,92,34,163,179,140,240,95,250,183,148,244,77,94,112,6,174,38,126,250,112,23,70,40,50,219,140,72,194,241,241,17,177,164,159,222,126,38,243,65,50,206,103,245,60,169,210,16,25,164,113,167,222,185,22,161,162,136,230,118,94,97,217,70,141,242,219,156,52,65,173,150,216,206,34,73,147,63,162,44,61,62,34,36,81,207,77,79,255,215,255,241,191,255,251,191,157,159,19,109,190,43,63,180,252,187,218,168,57,43,149,162,183,104,133,120,163,15,253,27,212,251,117,68,191,43,188,247,128,189,10,24,201,81,182,131,164,48,167,135,228,251,166,139,60,149,43,57,170,58,211,169,113,71,105,240,105,89,149,161,40,71,97,248,150,25,17,158,190,84,132,170,182,80,171,171,43,225,69,32,223,134,45,56,10,83,158,173,90,33,85,56,90,19,3,46,213,126,232,172,228,106,197,169,188,90,117,82,110,72,123,142,232,158,141,80,82,39,144,75,119,162,172,196,179,22,250,203,104,79,26,177,122,125,41,235,119,123,83,206,69,212,122,83,86,226,244,166,181,192,30,232,77,35,86,175,55,101,253,94,111,126,223,94,233,245,168,169,56,208,171,5,185,152,246,26,191,140,211,4,104,189,61,157,27,237,116,75,59,205,142,55,109,244,13,179,81,70,213,58,155,154,92,19,109,126,150,176,211,150,22,186,198,218,52,194,9,119,100,6,207,238,60,5,226,45,25,58,177,99,66,18,221,43,233,206,61,217,96,216,204,227,155,9,227,17,119,58,199,91,211,176,59,115,193,29,59,95,87,211,81,77,183,48,200,247,209,58,190,142,215,45,229,218,171,202,46,100,133,132,46,197,48,88,133,22,82,109,93,150,29,148,228,212,146,83,7,183,57,66,88,127,13,130,147,71,197,231,106,238,149,192,4,126,112,214,218,219,95,249,140,153,2,101,51,244,249,32,174,12,156,51,227,212,108,209,90,195,113,230,223,116,46,87,59,124,209,122,146,184,252,154,206,238,139,219,176,8,54,184,222,128,232,14,236,114,84,63,200,137,179,244,26,136,46,254,17,190,78,80,89,145,136,189,185,123,88,141,242,241,204,65,37,42,62,107,41,209,139,84,109,21,68,44,202,110,112,150,116,138,58,29,31,17,111,161,187,93,248,212,26,94,49,17,124,5,132,96,154,219,26,28,58,31,43,202,57,54,71,15,178,38,26,158,248,177,243,190,222,73,38,204,159,100,91,231,205,209,154,41,90,183,101,152,44,255,166,210,122,89,190,47,161,252,129,47,165,25,44,73,132,68,3,213,154,237,52,103,175,157,101,6,52,140,179,243,124,65,214,4,116,139,129,44,28,170,75,35,197,187,206,164,20,127,23,156,68,135,240,26,204,180,62,222,63,62,2,147,33,85,240,13,154,121,30,175,182,15,65,130,23,132,199,119,237,221,132,122,67,187,165,19,253,106,84,169,238,214,244,136,86,96,169,199,71,229,174,245,184,90,48,104,109,165,240,139,81,149,176,144,26,76,88,99,76,29,246,244,162,104,142,46,6,86,38,50,135,22,68,215,35,217,83,139,135,244,90,101,153,90,87,232,62,89,154,7,239,130,175,183,176,58,14,54,24,61,80,165,119,224,223,232,60,71,229,131,194,100,45,187,248,87,149,144,90,191,116,254,252,164,227,161,106,42,53,53,250,58,145,7,189,225,247,10,158,146,108,177,112,39,
+224,164,215,88,78,9,6,172,192,23,89,230,204,146,56,84,118,158,20,62,162,8,157,63,5,115,133,223,150,193,217,217,50,248,247,167,249,1,63,181,30,236,221,108,90,105,82,228,36,138,110,168,4,82,39,151,124,35,105,120,158,144,16,148,129,224,242,152,180,253,248,248,136,99,173,165,101,63,38,14,243,152,111,187,236,252,13,13,152,157,52,245,78,93,26,37,165,206,223,216,153,182,172,73,215,84,205,153,45,177,25,102,29,125,226,36,143,55,157,221,160,242,213,42,48,106,248,36,37,97,232,219,116,187,201,235,103,195,155,93,34,124,250,114,29,101,120,69,67,176,79,113,227,10,7,30,167,248,237,23,54,238,246,248,56,124,86,238,85,17,75,20,70,159,178,244,21,221,217,76,179,182,141,151,191,54,81,168,220,220,36,147,12,50,199,165,207,7,99,45,74,27,45,254,6,148,23,228,143,242,82,168,158,193,211,221,19,178,185,219,218,113,172,12,157,18,120,57,88,191,156,159,158,95,252,218,190,254,8,175,201,202,200,233,92,12,81,41,5,83,195,71,218,119,33,222,196,29,38,15,45,198,36,26,193,92,178,84,169,127,45,18,163,82,145,14,42,20,238,162,118,86,90,99,57,84,203,37,73,201,3,189,78,2,242,132,236,215,56,239,78,63,16,28,220,252,21,64,131,91,53,98,96,90,161,24,101,254,123,5,12,78,57,233,179,252,146,184,160,42,136,74,117,160,197,193,4,117,17,33,130,242,71,240,248,119,33,28,157,148,131,135,36,77,30,118,249,34,220,110,211,175,228,214,134,206,9,82,89,128,57,194,198,146,65,245,61,205,14,198,103,228,67,188,120,8,62,65,143,9,119,163,241,254,165,118,196,206,50,32,195,206,53,103,137,203,178,98,57,50,125,159,97,106,112,118,117,153,37,79,189,95,190,12,14,121,117,41,72,185,240,161,135,156,168,223,34,143,34,24,154,4,203,238,201,6,65,239,16,158,130,95,157,237,180,245,227,140,86,93,131,163,94,247,226,22,218,162,164,122,215,61,245,74,44,154,147,202,30,122,188,147,192,166,146,96,91,220,32,128,229,163,132,53,128,101,14,199,48,134,76,37,9,12,105,139,38,48,100,210,113,59,42,10,24,185,91,87,128,39,115,60,102,12,212,234,129,163,18,89,134,163,199,177,101,235,218,3,152,229,35,156,128,44,54,108,154,44,123,210,156,115,174,94,39,108,128,213,250,199,234,196,199,145,28,129,151,147,130,164,207,176,243,136,71,162,227,237,225,83,117,38,43,183,220,224,161,190,64,246,56,241,72,38,218,48,66,57,27,93,76,199,70,206,239,13,74,106,242,128,196,242,190,87,149,215,204,102,186,143,134,41,60,69,118,217,107,133,4,121,94,202,6,91,224,146,43,124,33,232,33,91,230,178,115,46,55,252,204,89,227,7,88,248,178,183,245,33,87,151,148,238,238,107,200,85,133,178,151,157,115,32,217,170,164,180,104,235,72,66,105,90,254,178,119,232,33,219,64,89,254,146,123,206,32,221,72,83,231,146,191,103,47,223,159,166,82,215,8,152,29,137,126,19,168,2,111,244,71,43,113,134,189,89,191,245,227,24,86,225,12,55,83,133,43,69,48,204,99,213,132,195,59,86,177,129,176,243,0,41,86,92,8,226,115,39,183,12,227,74,57,47,134,21,10,73,175,164,207,137,192,196,252,20,159,79,61,235,39,27,138,46,148,33,50,246,189,43,101,132,247,201,148,207,146,214,55,202,208,3,152,241,11,151,187,137,108,129,48,145,173,179,103,191,97,50,36,3,254,221,50,151,99,39,14,129,194,137,3,55,227,184,251,244,80,160,254,244,16,63,105,57,24,79,90,150,201,45,10,36,115,139,36,31,107,18,52,199,171,205,216,251,168,54,228,241,176,145,236,191,96,40,251,175,207,210,155,94,54,95,160,150,205,215,206,174,14,6,210,249,164,206,2,3,181,179,192,214,91,40,120,30,83,208,211,203,186,161,250,77,20,36,37,66,229,36,173,123,164,201,154,19,147,100,17,116,5,202,166,173,149,237,11,236,171,62,131,149,23,32,106,111,215,52,88,190,35,81,178,65,124,238,64,112,174,203,105,175,58,63,22,103,120,118,52,108,236,66,56,100,188,22,71,109,164,210,185,247,254,144,176,0,193,72,145,71,199,71,205,93,134,113,178,184,103,95,208,200,188,234,47,56,62,98,30,12,205,215,49,38,97,93,193,207,248,30,247,43,172,122,201,111,9,223,
+105,95,183,132,31,196,45,193,175,85,75,76,91,235,52,215,213,10,170,94,242,91,82,213,138,182,196,180,85,132,218,88,21,97,11,43,166,37,85,173,104,75,77,91,250,80,181,145,210,7,170,139,147,190,73,181,45,74,223,160,186,246,164,63,112,237,113,211,31,54,206,168,221,234,15,219,237,37,191,37,245,129,187,237,142,220,173,254,208,221,94,242,91,82,31,188,219,238,232,221,234,15,223,237,37,191,37,245,1,108,107,149,133,248,10,87,93,223,43,107,95,10,219,83,84,175,105,175,105,113,19,221,100,81,164,171,97,89,251,82,216,158,162,134,77,123,77,139,209,253,94,83,59,168,121,201,109,71,81,43,218,78,211,18,44,83,52,53,130,154,151,220,118,20,53,162,237,180,90,58,127,162,175,211,249,147,75,65,91,234,122,145,182,24,31,255,61,43,116,163,5,84,189,228,183,164,26,45,104,75,76,60,92,105,107,133,85,47,249,45,169,70,214,85,87,171,40,222,234,106,5,85,47,249,45,169,106,69,91,106,218,186,14,87,186,225,1,171,94,242,91,82,212,170,108,137,105,107,155,166,153,174,90,88,247,82,208,150,170,98,180,173,227,163,234,42,149,107,152,73,179,122,45,31,232,139,64,5,186,193,215,111,223,191,204,227,155,36,68,216,121,173,160,18,208,10,121,51,169,64,171,78,43,237,73,228,133,130,58,108,247,214,57,157,73,94,32,104,151,130,54,37,148,227,183,121,189,45,184,154,130,44,104,175,25,214,49,77,177,69,108,121,72,83,144,85,181,73,134,119,76,211,118,155,93,77,247,233,215,9,136,66,237,142,150,76,123,26,104,98,123,124,13,117,145,20,105,168,139,98,173,33,119,185,89,110,80,52,247,139,173,206,153,173,131,229,234,130,179,145,176,138,153,188,107,106,254,236,205,77,229,133,250,207,207,131,191,6,207,47,90,151,151,13,52,190,204,155,87,86,107,9,162,199,50,107,0,44,38,183,191,6,219,56,47,218,210,89,113,119,213,134,155,138,36,16,244,101,172,201,9,29,193,230,199,187,81,138,89,105,143,204,23,196,107,172,73,253,110,144,230,69,221,224,26,3,221,67,97,236,161,76,243,55,104,111,2,17,46,173,174,148,120,199,60,81,97,198,246,186,13,59,177,64,42,105,53,101,196,248,118,200,109,216,157,53,54,123,124,181,177,244,183,253,166,91,228,160,24,119,86,201,200,188,107,237,125,155,176,76,126,227,14,172,179,145,181,154,54,130,60,11,29,104,220,186,149,62,213,165,231,87,92,75,121,218,177,206,167,38,8,90,44,106,116,232,158,170,82,244,43,158,141,60,109,91,227,211,41,36,45,18,32,209,21,69,154,126,197,179,137,167,109,235,123,58,133,168,69,2,212,172,78,131,170,213,109,111,34,89,155,177,64,21,186,86,180,67,93,194,158,104,141,202,148,45,111,147,147,72,219,132,101,106,211,182,170,117,26,33,110,19,22,170,78,221,74,86,58,141,188,39,89,170,38,125,203,90,171,1,2,215,182,216,31,53,9,252,39,238,84,239,199,182,149,254,104,128,190,197,130,198,134,238,71,69,242,230,73,2,65,95,198,154,156,208,17,108,126,188,27,106,196,253,19,111,50,247,99,203,234,126,156,64,219,162,230,149,44,77,157,180,149,237,109,26,101,27,177,58,5,194,86,179,61,77,186,158,102,129,170,100,45,109,135,83,168,218,128,53,234,18,181,162,69,154,160,105,3,86,169,76,210,42,150,57,137,162,167,88,167,30,65,75,90,232,116,122,214,183,82,221,245,245,79,220,9,221,143,157,89,228,143,38,214,215,3,162,70,135,78,117,125,205,147,133,162,190,140,54,58,161,51,68,128,68,87,20,105,154,55,101,251,177,61,59,252,113,202,250,90,40,64,205,234,52,168,90,221,246,38,146,181,25,11,84,161,107,69,59,212,37,236,137,214,168,76,217,242,54,57,137,180,77,88,166,54,109,171,90,167,17,226,54,97,161,234,212,173,100,165,211,200,123,146,165,106,210,183,172,181,26,32,112,109,139,125,170,203,224,236,27,148,26,147,121,218,177,211,167,38,24,124,64,212,216,240,61,85,101,112,158,44,20,245,101,180,209,9,157,33,2,36,186,162,198,224,28,73,95,8,106,163,141,234,119,133,10,80,179,58,117,6,215,176,189,105,12,110,200,2,21,24,92,213,14,53,25,124,170,53,170,50,184,130,77,78,97,112,35,150,169,203,224,202,214,105,130,193,141,88,168,50,131,
+171,89,233,36,6,159,102,169,122,12,46,109,173,211,25,92,223,98,255,164,203,224,239,184,147,190,63,117,236,244,79,38,24,124,64,212,216,240,253,73,149,193,121,178,80,212,151,209,70,39,116,134,8,144,232,138,26,131,191,227,77,235,254,212,182,191,63,77,97,112,161,0,53,171,83,103,112,13,219,155,198,224,134,44,80,129,193,85,237,80,147,193,167,90,163,42,131,43,216,228,20,6,55,98,153,186,12,174,108,157,38,24,220,136,133,42,51,184,154,149,78,98,240,105,150,170,199,224,210,214,58,157,193,213,45,182,247,226,203,246,149,136,18,172,46,120,15,0,86,39,79,76,55,26,189,172,95,56,81,189,244,54,143,138,156,222,160,81,116,110,172,102,133,75,185,16,62,50,62,116,57,163,180,46,237,171,219,250,201,247,244,165,247,204,213,231,240,197,217,54,74,110,138,219,69,80,14,19,124,245,107,192,5,232,211,231,143,152,139,64,138,247,198,138,220,156,77,126,66,69,66,230,189,46,93,121,201,234,1,111,71,145,149,247,252,161,117,33,47,35,174,188,254,170,148,26,39,1,105,152,39,178,72,223,164,95,163,140,47,19,63,116,251,136,165,251,47,66,9,153,247,186,108,177,8,88,101,251,194,194,90,222,207,251,189,130,60,82,122,88,222,1,139,212,242,122,2,179,120,39,45,237,19,148,102,95,50,136,31,241,197,98,0,222,62,92,227,187,130,178,244,64,222,165,210,127,57,79,101,51,74,2,223,96,233,33,129,228,6,179,250,14,240,1,185,153,146,220,143,82,114,203,75,191,135,76,182,39,117,25,228,23,248,199,40,204,23,87,235,52,97,47,50,165,74,172,111,67,188,166,1,223,183,84,94,132,75,239,244,169,6,188,28,1,252,225,58,206,242,162,252,62,151,26,10,25,229,200,144,104,42,215,30,45,25,29,51,45,29,63,78,213,177,28,89,174,134,114,67,44,239,79,23,248,236,147,162,150,185,129,113,150,119,64,61,13,141,13,182,188,199,78,80,84,101,196,183,251,112,211,81,147,188,157,123,16,72,168,211,53,200,15,89,180,71,185,108,96,129,128,221,48,20,249,152,69,225,250,150,124,73,239,2,166,172,117,22,124,206,14,201,186,122,127,102,85,62,165,61,204,226,155,219,2,175,166,133,15,113,86,86,201,241,82,239,109,152,221,68,120,137,107,152,244,219,228,12,137,70,87,63,114,186,250,108,239,93,79,165,70,181,158,91,140,142,109,203,242,166,140,108,110,163,195,185,236,216,74,117,248,99,175,195,19,198,215,94,127,101,253,86,138,246,160,110,201,40,34,55,238,115,73,9,65,43,160,72,27,122,187,150,43,199,150,162,87,49,22,165,29,248,13,133,154,231,203,91,7,121,210,218,142,109,228,246,16,81,15,13,242,54,194,65,196,144,133,216,6,68,41,118,200,77,165,24,175,225,146,5,103,106,242,173,6,16,185,41,155,8,16,145,137,228,223,122,20,81,176,19,244,28,59,86,226,95,40,81,176,150,30,44,166,108,197,117,60,33,11,163,252,191,226,226,118,193,98,179,207,162,235,248,190,249,226,132,179,235,73,241,248,64,74,182,236,3,62,195,106,39,90,255,198,25,134,97,121,228,14,212,97,73,235,14,173,181,132,117,165,193,144,80,89,157,197,220,225,186,213,187,128,187,171,91,174,141,73,89,102,49,71,62,11,251,55,44,145,37,43,161,172,86,15,187,226,122,120,70,97,182,238,74,91,203,109,76,194,239,159,72,117,70,28,249,76,222,175,17,130,210,171,114,71,41,168,222,2,178,79,243,24,223,192,185,12,78,207,209,0,241,109,35,215,184,3,192,27,106,190,106,44,6,67,74,181,97,152,162,87,47,20,92,77,65,237,35,7,182,143,209,93,132,111,34,201,13,194,39,212,114,4,192,143,124,4,141,168,216,247,102,172,92,29,14,17,5,233,187,254,250,87,221,114,66,233,231,48,222,114,247,197,11,248,33,200,127,161,77,157,157,37,191,178,219,155,240,195,19,252,142,27,92,68,234,208,23,222,12,41,210,1,75,93,151,158,50,21,182,221,80,128,17,144,101,30,124,111,231,38,186,151,130,172,110,148,141,16,229,87,65,121,117,46,12,94,249,10,141,95,136,172,37,249,247,59,74,2,191,42,107,74,230,82,84,67,68,241,248,104,92,185,78,4,155,170,223,33,137,215,233,38,122,86,180,40,35,16,160,198,113,137,255,122,113,155,61,43,218,247,199,135,65,217,108,179,
+49,23,44,232,11,218,137,177,180,94,63,85,123,5,199,232,6,181,99,236,78,168,87,11,173,105,170,113,71,54,46,14,69,212,82,46,207,72,20,89,110,114,242,242,150,37,76,233,200,91,152,196,27,196,117,59,253,161,37,95,151,243,148,116,77,95,147,65,15,246,30,131,156,199,193,234,225,248,232,49,72,122,124,22,4,175,175,175,3,156,63,194,236,102,19,60,13,138,236,128,179,156,24,167,46,199,71,245,15,95,111,227,109,84,214,94,67,167,87,17,141,64,245,171,210,64,51,124,181,72,21,186,94,39,65,154,109,112,218,147,226,13,255,48,227,41,176,12,168,146,163,173,145,123,72,217,26,228,164,241,144,108,227,93,12,226,142,143,242,248,143,104,89,234,133,136,226,27,75,147,237,67,176,33,175,47,5,149,65,19,162,33,198,66,38,104,146,195,211,188,104,29,85,30,135,5,12,206,126,157,49,119,165,19,83,88,236,195,226,7,252,30,252,138,243,46,176,15,47,62,190,34,229,26,116,203,183,120,5,229,49,245,178,124,201,33,125,187,87,180,169,7,62,88,64,44,127,130,111,150,75,154,104,221,122,139,15,169,81,189,109,104,95,190,177,167,245,2,59,20,79,74,49,115,171,40,219,6,47,210,29,148,143,87,48,30,31,163,155,3,76,47,131,87,247,123,172,130,130,171,3,116,82,147,156,250,220,132,113,146,55,231,126,172,18,177,156,22,113,71,141,23,97,30,109,201,143,134,245,193,118,234,129,33,58,137,198,165,42,217,40,245,38,133,9,58,74,108,109,213,127,120,255,233,245,127,171,41,1,70,183,13,215,17,140,96,124,19,39,68,141,74,29,252,137,252,113,189,13,111,202,215,3,176,239,88,66,205,202,234,87,95,179,112,207,178,23,249,54,184,10,183,219,171,210,92,136,205,255,243,81,169,220,63,31,161,47,253,243,17,21,139,47,103,130,111,72,150,194,63,31,149,109,98,83,255,124,116,118,124,20,124,128,24,180,195,119,12,195,143,68,23,40,27,174,215,209,158,188,115,25,223,191,70,20,12,30,199,143,151,193,227,29,254,147,195,63,228,157,138,247,143,177,133,32,120,28,61,254,1,103,19,56,84,17,18,10,184,117,180,219,23,15,85,20,3,159,195,21,120,12,110,12,166,13,142,188,194,247,67,221,133,219,184,52,95,218,76,220,105,6,193,167,126,146,238,163,140,36,87,64,199,240,144,249,20,48,143,18,244,144,59,40,2,193,20,20,57,122,95,189,148,110,89,23,235,21,66,49,59,41,49,59,8,41,241,233,54,78,90,117,115,169,186,255,124,180,73,139,83,24,160,127,62,34,213,62,55,111,187,162,166,149,215,182,133,232,246,226,224,63,31,225,91,176,48,158,132,251,152,105,3,75,195,122,175,32,231,76,187,240,1,43,85,129,149,42,248,46,165,239,230,171,75,145,197,34,12,208,178,61,130,213,0,6,97,6,67,129,239,223,139,74,201,165,17,208,230,216,119,149,150,166,179,169,223,59,6,129,137,76,33,107,35,36,250,83,76,168,237,133,91,222,169,53,235,22,236,42,145,231,26,204,162,177,197,92,172,127,224,114,29,125,132,117,127,128,238,234,247,67,218,188,144,165,235,92,228,199,222,156,48,36,191,213,94,94,109,26,226,59,80,171,78,98,239,96,29,126,32,245,162,123,32,240,237,67,251,85,132,191,111,47,80,126,29,122,162,124,205,215,161,42,201,75,173,248,244,143,55,193,54,254,45,170,117,33,14,220,172,250,161,209,112,207,206,33,32,174,165,29,253,91,106,137,222,142,67,160,138,147,152,97,254,215,240,41,6,231,252,35,34,191,146,244,59,248,111,235,21,56,204,107,239,206,12,198,57,246,213,182,219,155,104,149,133,103,136,66,135,88,150,65,141,41,48,76,192,54,134,165,191,191,148,105,132,95,247,162,95,23,104,247,74,77,9,168,33,208,67,208,150,176,9,142,58,177,154,46,177,64,147,88,74,141,120,0,147,88,25,148,120,0,149,88,22,150,74,37,38,113,172,108,167,61,69,238,12,61,51,123,231,232,90,237,217,212,194,158,63,251,92,153,196,165,82,171,35,141,93,112,91,99,204,66,79,207,210,92,212,27,31,111,147,175,113,60,73,221,88,168,108,172,163,105,60,140,108,60,21,218,120,16,219,88,19,220,218,144,121,193,10,231,197,235,162,181,219,17,48,153,170,253,30,44,201,140,39,190,73,210,44,66,137,56,11,43,98,178,242,11,154,122,199,
+221,120,71,229,92,176,155,113,248,5,206,9,130,219,40,220,4,228,141,222,121,123,46,28,39,251,67,129,61,33,59,77,176,162,163,123,221,199,71,100,63,133,212,192,57,223,63,31,161,4,152,80,54,180,181,0,94,59,205,139,135,109,116,82,51,27,185,244,60,205,240,165,231,101,67,140,100,186,234,172,179,106,136,128,82,151,114,43,158,40,115,124,4,218,192,156,229,53,209,12,100,135,193,6,230,126,209,41,182,4,115,22,248,21,38,44,135,66,248,43,229,215,56,129,62,84,98,186,138,80,169,194,190,3,57,210,185,221,109,188,167,111,255,62,163,179,182,82,44,86,1,209,121,154,225,50,56,101,250,67,218,111,145,245,152,37,96,186,241,176,49,40,12,254,247,28,193,177,19,201,231,38,186,172,32,239,127,25,233,169,130,192,127,19,116,240,95,105,156,44,182,140,180,140,249,187,66,50,223,50,226,243,140,249,144,196,219,171,114,62,74,92,61,202,11,92,89,71,228,69,111,193,130,41,201,228,182,215,42,190,121,253,159,175,80,129,198,231,255,35,141,91,57,203,80,41,120,211,204,56,43,71,197,175,63,30,147,175,211,61,154,58,204,239,235,196,119,146,247,158,7,159,222,16,127,254,244,177,220,5,172,234,150,243,213,82,192,171,79,47,142,73,50,122,74,214,208,36,116,5,204,98,13,251,118,118,252,153,172,58,200,222,14,56,14,102,146,195,164,244,38,137,232,14,24,213,15,186,70,130,83,189,32,207,210,175,57,215,151,226,217,129,127,237,43,242,173,213,180,13,236,71,161,183,109,235,231,90,6,97,221,16,206,251,207,65,236,240,157,25,204,179,35,248,241,184,217,118,218,158,145,141,137,253,54,186,95,64,41,186,182,90,211,69,87,248,67,152,60,156,157,157,157,148,255,109,30,218,120,246,238,245,223,222,191,121,153,69,187,112,255,182,170,207,180,75,5,89,105,154,180,27,38,241,53,48,98,175,217,160,105,151,192,4,31,126,237,53,29,33,63,146,55,123,246,177,42,24,73,73,244,181,138,224,208,206,213,197,175,173,118,225,51,211,242,231,125,184,102,159,89,137,174,113,163,39,12,222,70,217,77,20,60,203,243,116,29,211,77,192,207,33,238,71,46,160,202,201,89,240,55,156,22,173,160,106,117,240,143,205,148,91,63,80,248,152,108,211,150,123,222,248,122,216,45,248,11,251,244,26,22,95,80,109,198,148,251,66,230,93,141,138,111,1,129,172,92,149,163,100,40,22,44,192,249,232,252,236,164,90,255,195,44,163,39,80,19,20,158,68,177,148,215,201,58,35,251,138,109,113,203,125,28,173,163,242,237,171,3,98,235,234,237,100,20,220,158,138,171,159,32,232,225,107,226,177,184,172,244,53,251,201,180,2,29,107,220,134,201,205,33,188,137,24,213,208,4,170,29,168,214,174,203,139,183,47,241,183,79,157,227,190,87,165,169,163,37,62,123,83,31,2,101,233,77,22,238,206,152,167,218,72,195,59,234,75,226,230,255,118,72,200,137,220,101,87,33,38,245,131,87,15,134,151,171,83,169,8,232,149,102,116,191,144,152,2,171,88,158,30,178,117,180,16,40,133,174,252,183,120,203,236,120,81,135,163,19,107,168,114,88,211,237,209,70,2,93,117,108,163,134,20,203,151,181,179,176,116,223,52,157,133,113,30,45,118,249,77,185,233,143,167,234,172,30,228,119,102,247,15,63,146,93,235,123,220,249,70,183,223,134,171,8,189,23,86,37,40,55,172,247,111,131,29,180,1,163,140,98,59,82,195,60,143,178,98,113,71,24,1,208,216,113,64,128,97,165,197,158,199,133,184,129,252,118,188,129,79,183,3,13,224,185,238,88,3,175,147,129,6,128,199,70,27,120,131,47,59,22,118,1,76,115,180,11,248,192,159,168,1,168,49,218,192,251,120,83,55,80,47,39,171,6,208,207,207,151,251,36,220,69,68,27,12,211,228,15,48,66,26,4,68,205,126,206,144,197,152,252,47,242,45,154,69,17,149,71,130,149,52,152,128,133,215,219,244,235,162,125,216,5,77,145,131,239,151,229,207,77,91,159,25,11,134,112,145,225,250,115,181,77,129,70,128,50,162,251,104,125,192,229,33,157,194,85,141,227,233,73,145,165,219,179,22,153,64,145,223,104,55,73,76,239,118,229,38,204,86,96,167,88,170,145,254,37,132,136,14,132,150,151,167,48,173,99,153,155,136,28,29,80,18,203,226,155,155,136,132,159,178,33,40,187,197,
+53,13,158,70,31,255,156,55,222,89,107,73,186,65,90,14,81,153,32,10,179,237,3,204,34,183,17,78,50,107,174,58,107,7,239,60,175,198,234,132,85,31,127,96,54,198,97,33,190,103,67,4,74,217,196,57,232,182,33,193,2,21,164,71,203,89,4,139,234,132,238,219,51,202,109,72,102,99,148,172,31,88,241,68,229,210,95,190,214,80,178,103,132,155,136,148,217,244,6,242,57,25,52,60,130,190,131,69,124,184,130,233,100,241,64,242,71,182,184,164,175,112,254,74,15,203,10,4,21,251,132,53,238,88,21,178,232,6,230,239,81,198,134,243,37,38,8,144,63,110,163,237,158,31,75,171,122,85,144,175,52,123,132,199,168,8,4,137,149,152,104,208,228,62,35,169,208,35,24,90,55,192,237,85,220,14,185,46,27,105,31,119,119,8,46,15,119,224,22,236,230,255,97,117,192,153,93,182,99,104,23,159,168,38,47,28,239,47,142,63,61,123,251,225,205,171,178,74,247,240,133,30,173,84,107,10,146,38,129,197,74,169,248,29,30,229,7,249,163,113,5,246,204,59,208,196,10,224,107,197,52,149,120,26,44,246,193,61,160,123,192,25,199,201,201,18,157,6,102,10,79,240,218,243,61,254,115,126,246,132,51,69,192,197,219,14,26,200,200,79,149,5,212,223,158,193,100,11,92,37,95,180,15,73,222,127,248,140,103,35,123,172,38,174,83,205,173,131,114,114,45,106,131,9,107,88,19,108,97,151,130,99,54,45,62,18,40,183,78,163,108,141,236,172,164,94,83,75,93,193,191,195,24,163,221,197,4,252,226,1,15,188,170,230,196,90,238,118,105,242,25,136,67,85,207,166,30,106,74,217,131,232,90,114,197,152,182,47,72,11,104,147,167,81,147,182,208,192,202,87,183,190,56,64,77,219,166,26,23,214,96,80,211,183,97,246,91,103,255,160,137,88,4,216,190,196,187,116,11,53,82,37,45,171,58,26,42,126,138,97,49,138,202,149,109,4,100,211,184,36,72,192,85,160,37,73,244,15,147,66,117,236,171,90,26,154,190,60,236,183,49,73,233,174,154,17,184,84,95,46,204,96,113,106,155,41,41,91,87,210,208,245,5,165,112,156,58,239,113,70,67,14,237,51,186,146,45,155,21,251,85,94,188,5,54,217,42,34,91,213,82,247,254,87,229,158,74,73,100,121,249,244,125,181,207,14,248,54,110,38,210,154,153,158,201,43,93,87,82,215,249,101,61,23,202,96,145,24,21,148,128,227,228,95,116,226,36,84,51,10,55,88,82,77,205,170,146,134,154,120,172,65,84,27,141,250,36,145,103,21,39,27,37,221,154,90,26,227,94,45,56,203,28,162,168,96,6,58,63,19,41,250,175,184,80,82,17,203,171,43,247,1,60,39,188,33,222,222,217,127,133,217,240,191,14,121,113,26,39,167,120,209,73,37,41,28,26,247,106,107,75,13,219,170,210,4,104,235,80,197,32,11,51,211,117,36,132,183,92,5,148,17,36,85,139,89,189,202,234,170,255,212,94,133,64,212,26,139,174,55,81,130,251,114,170,170,214,181,212,117,252,20,253,126,32,249,177,117,35,163,74,66,133,236,1,95,189,174,162,99,93,73,93,197,138,1,48,191,136,52,131,137,224,5,24,112,188,206,153,91,139,152,137,106,189,82,171,178,127,234,246,235,66,87,229,111,220,20,34,50,161,102,81,232,246,167,223,139,90,194,63,222,127,174,74,53,109,191,47,191,97,55,101,234,45,88,145,249,198,9,166,242,41,161,92,86,209,240,178,251,61,205,12,38,217,131,213,210,42,23,79,2,74,118,128,223,110,85,167,2,108,85,117,77,201,241,19,214,165,1,1,215,214,105,107,140,170,179,146,142,164,109,179,216,18,108,222,63,123,243,83,187,14,179,210,74,97,6,7,192,192,122,244,150,78,240,255,85,169,81,29,153,147,169,126,8,20,255,144,211,189,116,24,92,220,154,128,133,236,250,183,7,97,140,218,133,235,44,93,20,248,152,92,81,129,65,63,213,136,180,86,209,0,9,169,194,218,45,25,179,122,233,92,30,250,211,70,90,171,100,145,244,238,17,135,1,109,194,174,252,224,144,87,219,175,181,7,180,86,240,125,229,210,108,29,238,212,160,33,85,88,101,232,51,70,68,71,156,46,174,161,28,68,56,156,64,86,27,90,149,18,92,124,168,10,147,240,25,82,9,204,62,166,153,223,117,86,73,153,89,24,148,91,184,53,124,184,199,45,54,34,220,145,46,
+112,41,164,228,139,76,53,117,63,252,24,229,233,246,142,218,29,77,60,38,45,5,27,60,151,138,139,161,245,238,46,46,82,112,18,53,93,203,58,234,138,194,92,62,190,126,160,11,134,109,72,118,225,96,6,177,77,99,60,21,201,240,192,107,91,153,6,121,134,162,204,163,198,229,251,58,205,132,139,203,230,224,177,63,230,188,117,54,238,111,81,203,171,107,18,135,104,78,16,4,110,32,60,225,52,42,151,27,28,10,114,22,167,52,76,101,29,245,97,250,57,201,128,231,171,236,244,179,246,41,165,64,195,127,229,105,162,54,129,198,10,54,116,227,200,202,162,205,97,173,230,144,101,21,29,103,196,138,101,86,6,106,71,238,154,9,214,219,48,222,229,98,5,119,225,94,81,63,172,161,163,30,212,219,147,91,196,216,120,70,247,221,203,135,198,107,235,164,219,58,73,49,160,118,90,68,255,128,137,96,172,184,3,213,174,233,52,228,101,17,121,34,76,81,93,90,71,71,81,250,252,217,234,129,115,152,16,151,33,141,59,177,59,228,183,101,98,153,210,164,174,169,166,177,60,133,202,1,173,157,7,155,244,43,78,219,171,89,152,16,207,116,91,168,153,46,169,160,174,220,107,178,13,66,70,252,253,155,207,31,2,60,64,161,231,219,248,176,94,124,87,30,13,177,243,219,230,129,131,238,86,122,92,208,21,22,115,26,208,75,0,89,146,221,250,42,39,7,143,52,91,233,0,77,62,206,231,143,80,247,197,237,129,61,42,123,145,69,228,212,59,169,69,209,121,196,117,140,49,255,38,11,19,114,38,2,2,200,179,50,237,132,169,48,184,139,163,175,173,92,168,36,186,47,198,212,11,6,244,187,47,58,10,126,200,210,58,80,225,207,193,26,127,39,236,212,80,112,139,7,123,0,129,220,91,114,208,26,20,229,46,55,43,115,117,72,94,151,93,111,73,197,166,137,84,40,128,187,6,17,250,6,254,167,124,6,24,224,41,159,98,37,199,128,196,175,59,122,116,161,24,85,228,29,84,25,232,58,148,224,117,188,133,125,94,68,123,34,99,27,230,5,254,113,242,3,75,249,37,200,87,240,221,101,192,169,137,103,242,164,38,252,113,130,255,244,106,194,119,220,154,120,184,72,106,146,36,24,246,112,177,170,9,223,113,107,162,77,144,154,228,64,13,254,233,213,132,239,184,53,175,183,165,76,248,227,4,255,233,213,132,239,184,53,55,171,45,173,73,206,208,240,140,172,91,19,190,11,152,83,164,205,93,152,172,203,39,163,218,174,18,150,206,66,206,125,57,39,139,77,154,27,48,216,154,49,144,56,7,247,79,43,19,89,13,223,163,255,250,211,255,243,234,227,123,118,130,17,102,15,244,82,13,98,19,216,84,144,222,69,89,47,131,28,42,51,43,149,190,80,201,187,161,39,41,48,122,227,121,91,45,176,49,247,88,160,80,15,177,96,47,6,112,134,5,185,214,193,63,44,240,146,110,231,88,160,80,15,177,128,200,230,30,11,20,234,33,22,16,171,221,99,129,66,103,197,130,209,43,137,183,108,110,200,160,42,239,94,191,17,107,146,160,104,25,36,58,18,165,129,208,150,46,97,18,73,90,40,1,241,254,243,176,54,164,57,73,56,122,162,229,17,153,166,198,184,121,64,3,53,223,199,131,65,3,84,225,222,32,244,60,77,183,17,185,187,133,108,69,50,61,239,180,45,251,158,9,57,57,163,67,206,74,103,167,79,240,247,144,68,138,48,232,133,247,40,144,11,71,36,198,184,35,139,219,83,99,114,85,122,206,78,150,240,111,155,61,23,205,145,204,201,85,233,185,240,206,36,11,61,23,205,136,204,201,85,233,57,59,17,106,189,185,196,66,207,69,243,31,115,114,199,67,88,30,223,36,146,158,254,233,245,79,239,186,74,96,245,96,113,122,190,124,178,60,63,145,233,126,87,158,164,183,235,203,30,29,124,86,163,214,242,200,1,2,194,149,209,108,8,180,22,69,14,16,16,174,135,102,67,160,181,20,114,128,128,112,21,52,27,2,173,5,144,3,4,132,107,159,217,16,104,45,123,28,32,32,92,241,56,65,160,73,215,88,229,146,92,240,236,249,167,174,18,80,89,166,219,29,25,146,189,86,148,55,58,216,140,22,35,179,60,35,61,85,152,221,89,236,233,200,172,206,72,79,21,102,115,22,123,58,50,139,51,210,83,133,217,155,197,158,178,177,26,255,182,209,83,81,124,158,46,79,165,167,108,76,198,191,109,244,84,20,135,
+167,203,27,15,190,167,178,11,238,87,63,117,5,39,209,141,76,71,79,117,150,217,106,210,70,7,244,84,118,113,61,189,151,42,75,106,91,189,28,91,72,79,239,165,202,242,217,86,47,199,22,205,211,123,169,178,84,182,213,203,145,80,107,160,151,10,129,214,90,47,71,194,172,129,94,42,4,89,83,189,172,149,248,238,59,201,40,251,250,221,139,143,93,209,245,69,14,50,221,109,75,146,140,182,122,82,71,7,183,209,101,36,234,26,236,181,66,244,181,222,235,145,40,108,176,215,10,209,216,122,175,71,162,178,193,94,43,68,103,235,189,30,137,210,6,123,173,16,173,173,247,122,36,106,27,236,181,66,244,54,220,235,134,73,100,167,202,47,95,245,21,216,68,10,221,62,213,153,50,235,73,29,103,104,217,169,179,193,94,43,4,113,235,189,30,9,226,6,123,173,16,196,173,247,122,36,136,27,236,181,66,16,183,222,235,145,32,110,176,215,10,65,220,122,175,71,130,184,193,94,43,4,113,195,189,110,46,246,139,147,197,234,188,73,226,61,255,117,185,186,96,63,158,4,236,167,142,86,111,95,191,235,229,57,212,98,161,233,120,119,216,53,23,239,146,183,233,237,195,56,195,15,228,6,222,156,129,101,84,19,30,82,110,180,106,105,81,93,115,52,187,6,179,225,81,201,95,205,102,39,92,13,156,226,193,170,115,149,164,87,36,57,106,138,31,149,141,76,83,108,25,144,171,195,241,113,140,164,186,146,186,131,157,148,178,42,80,58,87,92,199,27,189,80,210,103,84,181,124,218,11,37,189,65,149,185,44,247,126,74,44,120,246,223,3,250,133,247,74,177,114,76,19,121,240,76,107,165,238,197,46,52,152,13,15,13,255,115,161,129,83,60,88,117,12,112,234,179,255,30,119,119,9,197,70,227,147,164,178,42,80,58,87,92,199,27,189,80,210,103,84,181,124,218,11,37,189,65,149,217,100,173,189,139,236,1,86,190,197,110,61,242,210,120,94,190,140,18,242,198,245,158,126,207,207,131,239,130,231,23,75,114,127,111,152,20,17,230,240,146,149,52,189,250,237,161,124,153,39,234,84,189,179,253,97,207,62,27,48,160,146,108,150,209,168,122,220,21,252,52,157,25,45,239,240,63,154,250,129,122,95,204,42,98,0,52,84,202,60,100,84,187,213,84,139,251,130,35,106,86,145,233,144,17,165,76,65,54,230,26,236,150,57,47,21,109,6,111,21,237,173,107,169,103,219,91,241,161,117,61,253,12,123,43,62,70,63,29,52,7,222,170,111,113,134,189,213,140,157,57,245,86,246,168,135,151,78,57,131,183,138,206,132,180,212,179,237,173,204,155,229,21,245,51,236,173,120,117,197,116,208,28,120,171,190,197,25,246,86,51,118,230,212,91,217,195,58,94,162,236,12,222,42,58,213,211,82,207,182,183,226,21,43,122,250,25,246,86,188,244,101,58,104,14,188,85,223,226,12,123,171,25,59,179,237,173,100,6,192,91,183,206,55,19,238,169,228,255,76,152,168,220,90,183,206,52,19,110,20,241,120,38,140,243,244,213,84,139,51,225,173,29,69,252,159,9,183,92,195,143,117,107,79,165,111,198,91,231,95,183,54,138,124,27,222,58,239,186,181,163,200,55,230,173,126,172,91,123,42,249,191,110,45,157,100,254,117,107,163,136,199,235,86,198,73,230,93,183,118,20,241,127,221,218,114,13,63,214,173,61,149,252,95,183,150,78,50,255,186,181,81,196,227,117,43,227,36,243,174,91,59,138,248,191,110,37,49,133,183,110,157,143,91,123,42,249,207,173,68,229,214,186,117,38,110,109,20,241,152,91,145,249,87,83,45,206,132,183,118,20,241,159,91,91,174,193,174,34,60,241,86,209,122,194,75,111,101,214,173,243,122,171,96,221,234,159,183,234,91,156,97,111,53,99,103,78,189,213,143,117,107,79,165,111,198,91,231,95,183,54,138,124,27,222,58,239,186,181,163,200,55,230,173,126,172,91,123,42,249,191,110,45,157,100,254,117,107,163,136,199,235,86,198,73,230,93,183,118,20,241,127,221,74,158,164,246,203,91,123,42,249,239,173,68,101,31,188,181,81,196,99,111,197,87,253,120,225,173,29,69,252,247,86,162,37,111,151,105,62,111,237,169,228,191,183,18,149,91,187,76,51,121,107,163,136,199,222,138,177,100,53,213,226,76,120,107,71,145,111,204,91,217,53,191,39,222,42,90,253,123,233,173,204,46,211,188,222,42,216,101,242,207,91,245,
+45,206,176,183,154,177,51,167,222,202,174,249,61,241,86,209,234,223,75,111,101,118,153,230,245,86,193,46,147,127,222,170,111,113,134,189,213,140,157,57,245,86,246,226,49,79,188,85,116,67,153,151,222,74,94,203,235,131,183,226,130,236,155,240,86,125,139,51,236,173,102,236,204,169,183,250,177,203,212,83,233,155,241,214,249,119,153,26,69,190,13,111,157,119,151,169,163,136,111,222,202,94,122,174,113,121,196,167,159,159,15,248,195,233,52,119,61,157,124,121,196,184,122,166,109,239,84,233,242,136,33,253,64,189,47,102,21,49,0,26,42,101,30,50,149,203,35,6,180,251,130,35,106,86,145,233,144,17,165,140,147,235,169,214,229,17,115,120,171,194,195,17,243,123,235,240,67,56,14,189,85,254,33,156,153,189,85,223,226,12,123,171,25,59,115,234,173,35,169,37,115,120,171,66,146,201,252,222,58,156,204,228,208,91,229,147,153,102,246,86,125,139,51,236,173,102,236,204,169,183,142,44,35,230,240,86,133,5,197,252,222,58,188,112,117,232,173,242,11,215,153,189,85,223,226,12,123,171,25,59,179,237,173,42,151,71,56,242,86,221,203,35,102,244,86,169,203,35,92,120,171,242,229,17,115,120,171,252,229,17,150,189,85,239,242,8,95,188,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,194,23,111,245,99,221,170,123,121,196,252,222,58,255,186,85,249,242,136,153,189,117,222,117,171,222,229,17,51,122,171,202,229,17,142,188,85,247,242,136,25,189,85,234,242,8,23,222,170,124,121,196,28,222,42,127,121,132,101,111,213,187,60,194,23,111,29,121,148,127,14,111,85,120,168,127,126,111,29,190,60,194,161,183,202,95,30,49,179,183,234,91,156,97,111,53,99,103,78,189,213,143,117,171,238,229,17,243,123,235,252,235,86,229,203,35,102,246,214,121,215,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,98,70,111,85,185,60,194,145,183,234,94,30,49,163,183,74,93,30,225,194,91,149,47,143,152,195,91,229,47,143,176,236,173,122,151,71,204,232,173,42,151,71,56,242,86,221,203,35,102,244,86,169,203,35,92,120,171,242,229,17,115,120,171,252,229,17,150,189,85,239,242,8,95,188,117,228,81,254,57,188,85,225,161,254,249,189,117,248,242,8,135,222,42,127,121,196,204,222,170,111,113,134,189,213,140,157,57,245,214,145,71,249,231,240,86,133,135,250,231,247,214,225,203,35,28,122,171,252,229,17,51,123,171,190,197,25,246,86,51,118,230,212,91,71,30,229,159,195,91,21,30,234,159,223,91,135,47,143,112,232,173,242,151,71,204,236,173,250,22,103,216,91,205,216,153,83,111,245,99,151,73,247,242,136,249,189,117,254,93,38,229,203,35,102,246,214,121,119,153,244,46,143,112,230,173,181,174,127,214,186,60,226,237,207,111,6,252,225,207,211,220,245,207,147,47,143,24,87,207,180,237,253,89,233,242,136,33,253,64,189,47,102,21,49,0,26,42,101,30,50,149,203,35,6,180,251,130,35,106,86,145,233,144,17,165,140,147,235,159,181,46,143,152,195,91,21,30,142,152,223,91,135,31,194,113,232,173,242,15,225,204,236,173,250,22,103,216,91,205,216,153,83,111,29,73,45,153,195,91,21,146,76,230,247,214,225,100,38,135,222,42,159,204,52,179,183,234,91,156,97,111,53,99,103,78,189,117,100,25,49,135,183,42,44,40,230,247,214,225,133,171,67,111,149,95,184,206,236,173,250,22,103,216,91,205,216,153,109,111,85,185,60,194,145,183,234,94,30,49,163,183,74,93,30,225,194,91,149,47,143,152,195,91,229,47,143,176,236,173,122,151,71,248,226,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,194,23,111,245,99,221,170,123,121,196,252,222,58,255,186,85,249,242,136,153,189,117,222,117,171,222,229,17,190,120,171,31,235,86,221,203,35,230,247,214,249,215,173,202,151,71,204,236,173,243,174,91,245,46,143,152,209,91,85,46,143,112,228,173,186,151,71,204,232,173,82,151,71,184,240,86,229,203,35,230,240,86,249,203,35,44,123,171,222,229,17,190,120,
+235,200,163,252,115,120,171,194,67,253,243,123,235,240,229,17,14,189,85,254,242,136,153,189,85,223,226,12,123,171,25,59,115,234,173,126,172,91,117,47,143,152,223,91,231,95,183,42,95,30,49,179,183,206,187,110,213,187,60,194,23,111,245,99,221,170,123,121,196,252,222,58,255,186,85,249,242,136,153,189,117,222,117,171,222,229,17,51,122,171,202,229,17,142,188,85,247,242,136,25,189,85,234,242,8,23,222,170,124,121,196,28,222,42,127,121,132,101,111,213,187,60,98,70,111,85,185,60,194,145,183,234,94,30,49,163,183,74,93,30,225,194,91,149,47,143,152,195,91,229,47,143,176,236,173,122,151,71,248,226,173,35,143,242,207,225,173,10,15,245,207,239,173,195,151,71,56,244,86,249,203,35,102,246,86,125,139,51,236,173,102,236,204,169,183,142,60,202,63,135,183,42,60,212,63,191,183,14,95,30,225,208,91,229,47,143,152,217,91,245,45,206,176,183,154,177,51,167,222,58,242,40,255,28,222,170,240,80,255,252,222,58,124,121,132,67,111,149,191,60,98,102,111,213,183,56,195,222,106,198,206,156,122,171,31,187,76,186,151,71,204,239,173,243,239,50,41,95,30,49,179,183,206,187,203,164,119,121,132,51,111,173,117,253,110,252,242,8,252,187,163,231,179,151,47,243,248,38,9,183,60,119,248,142,120,43,253,61,136,178,44,205,130,52,169,213,98,112,250,78,237,150,8,29,61,4,128,73,40,7,130,174,146,148,148,208,133,72,12,78,61,70,235,240,144,131,86,239,94,191,9,238,194,237,33,82,85,64,30,39,69,132,100,52,252,78,124,99,134,218,88,129,34,95,100,45,70,230,106,12,117,233,134,236,68,13,14,17,16,202,214,161,143,137,18,26,114,54,33,188,18,68,105,84,190,160,113,74,218,132,212,221,31,234,210,205,216,132,34,28,34,32,84,109,98,2,38,74,104,12,233,53,22,232,217,189,42,206,213,44,86,73,70,180,61,165,163,135,69,146,25,135,200,50,201,168,225,228,128,100,152,45,97,181,177,210,38,25,193,222,175,186,116,27,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,183,88,57,79,102,90,37,25,209,174,170,142,30,22,73,102,28,34,203,36,163,134,147,3,146,97,78,50,212,198,74,155,100,4,71,22,234,210,109,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,61,25,224,36,102,91,37,25,209,97,128,142,30,22,73,102,28,34,203,36,163,134,147,3,146,97,14,224,212,198,74,155,100,4,39,109,234,210,109,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,61,208,194,191,93,146,140,232,12,75,71,15,139,36,51,14,145,101,146,81,195,201,1,201,48,231,198,106,99,165,77,50,130,3,98,117,233,54,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,131,73,9,3,9,10,86,73,6,229,73,38,74,204,73,50,227,16,89,38,25,53,156,28,144,12,8,214,27,43,109,146,1,49,211,45,197,22,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,144,100,132,87,60,59,56,248,151,186,203,121,254,131,127,69,136,204,147,204,4,156,108,146,76,255,94,107,219,7,255,195,23,88,207,124,240,47,11,135,97,146,209,193,196,10,201,8,46,238,182,120,240,47,113,67,247,124,7,255,74,112,152,35,25,109,76,156,145,140,227,236,50,169,43,200,61,35,153,57,178,203,38,224,228,128,100,28,102,151,13,223,187,238,7,201,184,206,46,211,193,196,54,201,56,202,46,147,184,88,222,11,146,113,153,93,166,141,137,51,146,113,156,93,38,117,115,254,252,217,101,138,16,89,38,25,127,178,203,250,111,17,176,157,93,54,252,186,128,153,179,203,100,225,176,67,50,243,103,151,9,94,147,96,49,187,76,226,125,8,243,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,
+35,209,175,236,50,37,56,172,144,140,63,217,101,194,151,13,57,200,46,147,122,171,208,252,217,101,138,16,89,38,25,127,178,203,250,111,88,178,157,93,54,252,42,165,153,179,203,100,225,176,67,50,243,103,151,9,94,33,101,49,187,76,226,93,81,243,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,194,23,49,58,56,147,145,122,227,226,252,103,50,138,16,153,39,153,9,56,217,36,153,254,219,39,109,159,201,12,191,102,114,230,51,25,89,56,12,147,140,14,38,86,72,70,240,122,77,139,103,50,18,239,209,156,239,76,70,9,14,115,36,163,141,137,51,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,142,179,203,164,222,111,235,25,201,204,145,93,54,1,39,7,36,227,48,187,108,248,165,190,126,144,140,235,236,50,29,76,108,147,140,163,236,50,137,183,22,123,65,50,46,179,203,180,49,113,70,50,142,179,203,122,178,253,204,46,83,132,200,50,201,248,147,93,86,134,55,135,217,101,141,68,15,179,203,100,225,176,67,50,243,103,151,49,225,205,81,118,89,71,162,95,217,101,74,112,88,33,25,127,178,203,90,1,204,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,35,107,42,94,234,148,131,237,178,158,108,63,183,203,20,33,50,79,50,19,112,178,73,50,68,173,86,58,149,237,237,178,70,162,135,219,101,178,112,24,38,25,29,76,172,144,12,110,216,173,38,198,17,53,146,233,72,244,107,187,76,9,14,115,36,163,141,137,51,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,198,113,118,89,79,246,55,64,50,115,100,151,77,192,201,1,201,56,204,46,107,36,250,75,50,174,179,203,116,48,177,77,50,142,178,203,58,18,189,37,25,151,217,101,218,152,56,35,25,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,140,208,29,47,117,202,193,74,166,39,219,207,149,140,34,68,230,73,102,2,78,54,73,134,168,213,74,167,178,189,146,105,36,122,184,146,145,133,195,48,201,232,96,98,133,100,112,45,181,154,24,71,212,72,166,35,209,175,149,140,18,28,230,72,70,27,19,103,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,
+9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,113,156,93,214,147,253,13,144,204,28,217,101,19,112,114,64,50,14,179,203,26,137,254,146,140,235,236,50,29,76,108,147,140,163,236,178,142,68,111,73,198,101,118,153,54,38,206,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,25,209,132,151,58,229,128,100,122,178,253,36,25,69,136,204,147,204,4,156,108,146,12,81,171,149,78,101,155,100,26,137,30,146,140,44,28,134,73,70,7,19,43,36,131,52,183,154,24,71,212,72,166,35,209,47,146,81,130,195,28,201,104,99,226,140,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,198,113,118,89,79,246,55,64,50,115,100,151,77,192,201,1,201,56,204,46,107,36,250,75,50,174,179,203,116,48,177,77,50,142,178,203,58,18,189,37,25,151,217,101,218,152,152,35,153,90,179,211,58,130,145,28,4,94,238,20,254,221,209,229,211,207,207,197,209,253,84,150,101,6,100,243,48,209,209,67,223,82,242,195,170,23,228,21,33,18,131,35,99,51,82,10,200,227,164,136,144,140,134,167,11,54,125,165,149,79,165,54,86,160,200,23,89,139,233,74,156,110,41,40,221,144,157,168,193,33,2,66,217,58,244,49,81,66,67,206,38,168,6,171,137,113,228,11,26,167,164,77,244,36,78,182,9,34,221,140,77,40,194,33,2,66,213,38,38,96,162,132,134,212,82,70,16,232,217,60,8,252,219,37,201,136,146,33,116,244,176,72,50,227,16,89,38,25,53,156,28,144,12,147,79,165,54,86,218,36,35,72,165,82,151,110,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,30,4,254,237,146,100,68,201,16,58,122,88,36,153,113,136,44,147,140,26,78,14,72,134,201,167,82,27,43,109,146,17,164,82,169,75,183,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,153,145,119,184,89,37,25,133,23,185,205,73,50,227,16,89,38,25,53,156,28,144,204,240,187,32,109,144,140,252,107,32,103,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,204,200,45,59,86,73,70,225,170,157,57,73,102,28,34,203,36,163,134,147,3,146,25,190,173,203,6,201,200,95,212,53,3,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,70,242,32,172,146,140,66,50,196,156,36,51,14,145,101,146,81,195,201,1,201,12,231,83,217,32,25,249,84,170,25,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,131,36,67,78,135,120,169,83,14,14,254,123,178,253,60,248,87,132,200,60,201,76,192,201,38,
+201,16,181,90,233,84,182,15,254,27,137,30,30,252,203,194,97,152,100,116,48,177,66,50,152,122,176,154,24,71,212,72,166,35,209,175,131,127,37,56,204,145,140,54,38,206,72,198,113,118,89,79,246,55,64,50,115,100,151,77,192,201,1,201,56,204,46,107,36,250,75,50,174,179,203,116,48,177,77,50,142,178,203,58,18,189,37,25,151,217,101,218,152,56,35,25,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,181,2,152,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,50,178,113,199,75,157,114,112,38,211,147,237,231,153,140,34,68,230,73,102,2,78,54,73,134,168,213,74,167,178,125,38,211,72,244,240,76,70,22,14,195,36,163,131,137,21,146,193,83,161,213,196,56,162,70,50,29,137,126,157,201,40,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,198,113,118,89,79,246,55,64,50,115,100,151,77,192,201,1,201,56,204,46,107,36,250,75,50,174,179,203,116,48,177,77,50,142,178,203,58,18,189,37,25,151,217,101,218,152,56,35,25,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,145,53,21,47,117,202,193,118,89,79,182,159,219,101,138,16,153,39,153,9,56,217,36,25,162,86,43,157,202,246,118,89,35,209,195,237,50,89,56,12,147,140,14,38,86,72,6,55,236,86,19,227,136,26,201,116,36,250,181,93,166,4,135,57,146,209,198,196,25,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,227,56,187,172,39,251,27,32,153,57,178,203,38,224,228,128,100,28,102,151,53,18,253,37,25,215,217,101,58,152,216,38,25,71,217,101,29,137,222,146,140,203,236,50,109,76,156,145,140,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,178,86,0,115,156,93,214,147,237,103,118,153,34,68,150,73,198,159,236,178,50,188,57,204,46,107,36,122,152,93,38,11,135,29,146,153,63,187,140,9,111,142,178,203,58,18,253,202,46,83,130,195,10,201,248,147,93,70,232,
+142,151,58,229,96,37,211,147,237,231,74,70,17,34,243,36,51,1,39,155,36,67,212,106,165,83,217,94,201,52,18,61,92,201,200,194,97,152,100,116,48,177,66,50,184,150,90,77,140,35,106,36,211,145,232,215,74,70,9,14,115,36,163,141,137,51,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,56,206,46,235,201,254,6,72,102,142,236,178,9,56,57,32,25,135,217,101,141,68,127,73,198,117,118,153,14,38,182,73,198,81,118,89,71,162,183,36,227,50,187,76,27,19,103,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,140,104,194,75,157,114,64,50,61,217,126,146,140,34,68,230,73,102,2,78,54,73,134,168,213,74,167,178,77,50,141,68,15,73,70,22,14,195,36,163,131,137,21,146,65,154,91,77,140,35,106,36,211,145,232,23,201,40,193,97,142,100,180,49,113,70,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,227,56,187,172,39,251,27,32,153,57,178,203,38,224,228,128,100,28,102,151,53,18,253,37,25,215,217,101,58,152,216,38,25,71,217,101,29,137,222,146,140,203,236,50,109,76,204,145,76,173,217,159,235,8,70,114,16,120,185,83,248,119,71,151,183,63,191,17,71,247,63,203,178,204,128,108,30,38,58,122,232,91,202,238,176,237,5,121,69,136,196,224,200,216,140,148,2,242,56,41,34,36,163,225,159,23,108,250,74,43,159,74,109,172,64,145,47,178,22,211,149,56,221,82,80,186,33,59,81,131,67,4,132,178,117,232,99,162,132,134,156,77,80,13,86,19,227,200,23,52,78,73,155,232,73,156,108,19,68,186,25,155,80,132,67,4,132,170,77,76,192,68,9,13,169,165,140,32,208,179,121,16,248,183,75,146,17,37,67,232,232,97,145,100,198,33,178,76,50,106,56,57,32,25,38,159,74,109,172,180,73,70,144,74,165,46,221,6,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,60,8,252,219,37,201,136,146,33,116,244,176,72,50,227,16,89,38,25,53,156,28,144,12,147,79,165,54,86,218,36,35,72,165,82,151,110,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,35,239,112,179,74,50,10,47,114,155,147,100,198,33,178,76,50,106,56,57,32,153,225,119,65,218,32,25,249,
+215,64,206,64,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,153,145,91,118,172,146,140,194,85,59,115,146,204,56,68,150,73,70,13,39,7,36,51,124,91,151,13,146,145,191,168,107,6,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,140,228,65,88,37,25,133,100,136,57,73,102,28,34,203,36,163,134,147,3,146,25,206,167,178,65,50,242,169,84,51,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,6,73,134,156,14,241,82,167,28,28,252,247,100,251,121,240,175,8,145,121,146,153,128,147,77,146,33,106,181,210,169,108,31,252,55,18,61,60,248,151,133,195,48,201,232,96,98,133,100,48,245,96,53,49,142,168,145,76,71,162,95,7,255,74,112,152,35,25,109,76,156,145,140,227,236,178,158,236,111,128,100,230,200,46,155,128,147,3,146,113,152,93,214,72,244,151,100,92,103,151,233,96,98,155,100,28,101,151,117,36,122,75,50,46,179,203,180,49,113,70,50,142,179,203,122,178,253,204,46,83,132,200,50,201,248,147,93,86,134,55,135,217,101,141,68,15,179,203,100,225,176,67,50,243,103,151,49,225,205,81,118,89,71,162,95,217,101,74,112,88,33,25,127,178,203,90,1,204,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,107,5,48,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,100,227,142,151,58,229,224,76,166,39,219,207,51,25,69,136,204,147,204,4,156,108,146,12,81,171,149,78,101,251,76,166,145,232,225,153,140,44,28,134,73,70,7,19,43,36,131,167,66,171,137,113,68,141,100,58,18,253,58,147,81,130,195,28,201,104,99,226,140,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,140,227,236,178,158,236,111,128,100,230,200,46,155,128,147,3,146,113,152,93,214,72,244,151,100,92,103,151,233,96,98,155,100,28,101,151,117,36,122,75,50,46,179,203,180,49,113,70,50,142,179,203,122,178,253,204,46,83,132,200,50,201,248,147,93,86,134,55,135,217,101,141,68,15,179,203,100,225,176,67,50,243,103,151,49,225,205,81,118,89,71,162,95,217,101,74,112,88,33,25,127,178,203,90,1,204,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,35,107,42,94,234,148,131,237,178,158,108,63,183,203,20,33,50,79,50,19,112,178,73,50,68,173,86,58,149,237,237,178,70,162,135,219,101,178,112,24,38,25,29,76,172,144,12,110,216,173,38,198,17,53,146,233,72,244,107,187,76,9,14,115,36,163,141,137,51,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,
+9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,198,113,118,89,79,246,55,64,50,115,100,151,77,192,201,1,201,56,204,46,107,36,250,75,50,174,179,203,116,48,177,77,50,142,178,203,58,18,189,37,25,151,217,101,218,152,56,35,25,199,217,101,61,217,126,102,151,41,66,100,153,100,252,201,46,43,195,155,195,236,178,70,162,135,217,101,178,112,216,33,153,249,179,203,152,240,230,40,187,172,35,209,175,236,50,37,56,172,144,140,63,217,101,173,0,230,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,140,208,29,47,117,202,193,74,166,39,219,207,149,140,34,68,230,73,102,2,78,54,73,134,168,213,74,167,178,189,146,105,36,122,184,146,145,133,195,48,201,232,96,98,133,100,112,45,181,154,24,71,212,72,166,35,209,175,149,140,18,28,230,72,70,27,19,103,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,113,156,93,214,147,253,13,144,204,28,217,101,19,112,114,64,50,14,179,203,26,137,254,146,140,235,236,50,29,76,108,147,140,163,236,178,142,68,111,73,198,101,118,153,54,38,206,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,25,209,132,151,58,229,128,100,122,178,253,36,25,69,136,204,147,204,4,156,108,146,12,81,171,149,78,101,155,100,26,137,30,146,140,44,28,134,73,70,7,19,43,36,131,52,183,154,24,71,212,72,166,35,209,47,146,81,130,195,28,201,104,99,226,140,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,198,113,118,89,79,246,55,64,50,115,100,151,77,192,201,1,201,56,204,46,107,36,250,75,50,174,179,203,116,48,177,77,50,142,178,203,58,18,189,37,25,151,217,101,218,152,152,35,153,90,179,239,234,8,150,23,25,115,170,12,31,42,93,240,239,142,46,207,94,190,236,233,178,78,147,53,136,79,194,34,70,236,175,49,140,129,78,16,200,24,32,6,196,241,96,152,44,154,139,77,91,31,70,131,59,252,207,100,217,68,244,151,97,33,70,59,75,5,142,119,149,74,94,153,27,225,47,20,229,97,33,38,187,90,10,20,117,181,86,227,47,181,153,145,204,26,94,70,32,254,221,81,225,229,235,47,226,57,203,95,100,231,78,3,
+178,121,80,232,232,161,31,255,54,241,93,111,234,162,8,145,24,28,153,72,40,165,128,60,78,138,8,201,104,248,151,5,155,148,213,202,18,84,27,43,80,228,139,172,197,116,37,78,183,20,148,110,200,78,212,224,16,1,161,108,29,250,152,40,161,33,103,19,84,131,213,196,56,242,5,141,83,210,38,122,18,39,219,4,145,110,198,38,20,225,16,1,161,106,19,19,48,81,66,67,106,129,46,8,244,108,118,143,107,146,17,165,248,120,70,50,227,16,89,38,25,53,156,28,144,12,147,37,232,136,100,4,9,130,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,134,205,238,113,77,50,162,20,31,207,72,102,28,34,203,36,163,134,147,3,146,97,178,4,29,145,140,32,65,208,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,217,61,174,73,70,148,226,227,25,201,140,67,100,153,100,212,112,114,64,50,76,150,160,35,146,17,36,8,250,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,153,145,187,163,172,146,140,194,5,82,115,146,204,56,68,150,73,70,13,39,7,36,51,124,7,157,13,146,145,191,126,110,6,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,140,100,247,88,37,25,133,20,159,57,73,102,28,34,203,36,163,134,147,3,146,25,206,18,180,65,50,242,9,130,51,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,6,73,134,156,14,241,82,167,240,7,203,36,211,147,205,77,180,187,157,123,37,163,8,145,121,146,153,128,147,77,146,33,106,181,210,169,212,198,74,157,100,26,137,211,45,197,56,201,200,194,97,152,100,116,48,177,66,50,152,122,176,154,24,71,212,72,166,35,113,178,77,24,37,25,37,56,204,145,140,54,38,206,72,134,77,131,112,77,50,162,92,8,207,72,102,28,34,203,36,163,134,147,3,146,97,210,169,28,145,140,32,147,202,15,146,25,133,195,14,201,40,97,98,155,100,180,227,136,54,201,24,137,30,182,72,70,35,102,152,32,153,137,145,194,22,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,227,56,187,172,39,219,207,236,50,69,136,44,147,140,63,217,101,101,120,115,152,93,214,72,244,48,187,76,22,14,59,36,51,127,118,25,19,222,28,101,151,117,36,250,149,93,166,4,135,21,146,241,39,187,172,21,192,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,145,141,59,94,234,20,254,96,153,100,122,178,121,144,232,232,97,150,100,20,33,50,79,50,19,112,178,73,50,68,173,86,58,149,218,88,169,147,76,35,113,186,165,24,39,25,89,56,12,147,140,14,38,86,72,6,79,133,86,19,227,136,26,201,116,36,78,182,9,163,36,163,4,135,57,146,209,198,196,25,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,
+201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,28,103,151,245,100,251,153,93,166,8,145,101,146,241,39,187,172,12,111,14,179,203,26,137,30,102,151,201,194,97,135,100,230,207,46,99,194,155,163,236,178,142,68,191,178,203,148,224,176,66,50,254,100,151,181,2,152,227,236,178,158,108,63,179,203,20,33,178,76,50,254,100,151,149,225,205,97,118,89,35,209,195,236,50,89,56,236,144,204,252,217,101,76,120,115,148,93,214,145,232,87,118,153,18,28,86,72,198,159,236,50,178,166,226,165,78,225,15,150,73,166,39,155,7,137,142,30,102,73,70,17,34,243,36,51,1,39,155,36,67,212,106,165,83,169,141,149,58,201,52,18,167,91,138,113,146,145,133,195,48,201,232,96,98,133,100,112,195,110,53,49,142,168,145,76,71,226,100,155,48,74,50,74,112,152,35,25,109,76,156,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,48,65,50,19,35,133,45,146,97,211,32,92,147,140,40,23,194,51,146,25,135,200,50,201,168,225,228,128,100,152,116,42,71,36,35,200,164,242,131,100,70,225,176,67,50,74,152,216,38,25,237,56,162,77,50,70,162,135,45,146,209,136,25,38,72,102,98,164,176,69,50,108,26,132,107,146,17,229,66,120,70,50,227,16,89,38,25,53,156,28,144,12,147,78,229,136,100,4,153,84,126,144,204,40,28,118,72,70,9,19,219,36,163,29,71,180,73,198,72,244,176,69,50,26,49,195,4,201,76,140,20,182,72,198,113,118,89,79,182,159,217,101,138,16,89,38,25,127,178,203,202,240,230,48,187,172,145,232,97,118,153,44,28,118,72,102,254,236,50,38,188,57,202,46,235,72,244,43,187,76,9,14,43,36,227,79,118,89,43,128,57,206,46,235,201,246,51,187,76,17,34,203,36,227,79,118,89,25,222,28,102,151,53,18,61,204,46,147,133,195,14,201,204,159,93,198,132,55,71,217,101,29,137,126,101,151,41,193,97,133,100,252,201,46,35,116,199,75,157,114,176,146,233,201,246,115,37,163,8,145,121,146,153,128,147,77,146,33,106,181,210,169,108,175,100,26,137,30,174,100,100,225,48,76,50,58,152,88,33,25,92,75,173,38,198,17,53,146,233,72,244,107,37,163,4,135,57,146,209,198,196,25,201,176,105,16,174,73,70,148,11,225,25,201,140,67,100,153,100,212,112,114,64,50,76,58,149,35,146,17,100,82,249,65,50,163,112,216,33,25,37,76,108,147,140,118,28,209,38,25,35,209,195,22,201,104,196,12,19,36,51,49,82,216,34,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,28,103,151,245,100,127,3,36,51,71,118,217,4,156,28,144,140,195,236,178,70,162,191,36,227,58,187,76,7,19,219,36,227,40,187,172,35,209,91,146,113,153,93,166,141,137,51,146,113,156,93,214,147,237,103,118,153,34,68,150,73,198,159,236,178,50,188,57,204,46,107,36,122,152,93,38,11,135,29,146,153,63,187,140,9,111,142,178,203,58,18,253,202,46,83,130,195,10,201,248,147,93,70,52,225,165,78,57,32,153,158,108,63,73,70,17,34,243,36,51,1,39,155,36,67,212,106,165,83,217,38,153,70,162,135,36,35,11,135,97,146,209,193,196,10,201,32,205,173,38,198,17,53,146,233,72,244,139,100,148,224,48,71,50,218,152,56,35,25,54,13,194,53,201,136,114,33,60,35,153,113,136,44,147,140,26,78,14,72,134,73,167,114,68,50,130,76,42,63,72,102,20,14,59,36,163,132,137,109,146,209,142,35,218,36,99,36,122,216,34,25,141,152,97,130,100,38,70,10,91,36,195,
+166,65,184,38,25,81,46,132,103,36,51,14,145,101,146,81,195,201,1,201,48,233,84,142,72,70,144,73,229,7,201,140,194,97,135,100,148,48,177,77,50,218,113,68,155,100,140,68,15,91,36,163,17,51,76,144,204,196,72,97,139,100,216,52,8,215,36,35,202,133,240,140,100,198,33,178,76,50,106,56,57,32,25,38,157,202,17,201,8,50,169,252,32,153,81,56,236,144,140,18,38,182,73,70,59,142,104,147,140,145,232,97,139,100,52,98,134,9,146,153,24,41,108,145,12,155,6,225,154,100,68,185,16,158,145,204,56,68,150,73,70,13,39,7,36,195,164,83,57,34,25,65,38,149,31,36,51,10,135,29,146,81,194,196,54,201,104,199,17,109,146,49,18,61,108,145,140,70,204,248,127,219,123,219,38,185,109,36,93,244,179,253,43,232,137,152,152,214,110,91,182,180,247,211,216,82,132,95,116,61,142,163,177,103,109,143,206,236,57,49,209,81,93,197,110,213,186,186,170,93,197,110,73,243,235,47,64,178,72,144,4,144,200,196,3,144,190,177,19,49,86,87,21,153,153,200,124,144,137,76,130,9,68,144,137,244,20,169,130,76,230,221,101,19,222,191,131,32,51,199,238,178,8,61,101,8,50,25,119,151,245,28,151,27,100,114,239,46,147,232,36,117,144,201,180,187,108,196,113,177,65,38,231,238,50,177,78,112,65,166,147,236,143,157,7,171,247,32,216,246,78,233,191,71,178,252,245,199,111,221,222,253,143,214,40,163,84,176,221,148,197,245,135,226,95,229,241,96,232,198,35,129,77,51,18,105,2,241,226,20,241,238,176,153,56,124,166,186,220,138,26,114,245,161,40,72,140,112,157,49,181,21,46,231,31,47,204,109,45,131,125,86,60,235,41,113,222,240,144,52,230,27,143,32,45,3,20,63,60,213,184,148,34,68,141,92,63,44,205,112,176,210,200,113,29,233,119,222,104,232,178,176,50,225,27,141,149,90,6,36,86,152,170,113,41,69,134,149,8,253,176,52,67,75,71,133,10,115,63,197,60,193,202,181,181,98,145,193,138,86,87,150,96,197,211,89,182,96,101,236,215,202,26,172,28,27,182,150,20,172,72,213,164,12,86,44,253,228,9,86,98,191,19,25,172,32,222,38,109,176,18,248,24,92,176,138,244,44,105,131,149,185,47,99,158,96,229,218,162,177,200,96,69,171,43,75,176,226,233,44,91,176,50,246,125,101,13,86,142,141,95,75,10,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,223,49,79,176,114,109,245,88,100,176,162,213,149,37,88,241,116,150,45,88,25,251,199,178,6,43,199,6,178,37,5,43,82,53,41,131,21,75,63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,69,116,33,202,16,172,24,13,137,230,15,86,180,186,178,4,43,158,206,178,5,43,127,151,179,116,193,42,188,205,217,108,193,138,84,77,202,96,197,210,79,158,96,37,246,59,145,193,10,226,109,210,6,43,129,143,193,5,171,72,207,146,54,88,17,251,77,50,4,43,198,214,147,249,131,21,173,174,44,193,138,167,179,108,193,202,191,159,45,93,176,10,223,208,54,91,176,34,85,147,50,88,177,244,147,39,88,137,253,78,100,176,130,120,155,180,193,74,224,99,112,193,42,210,179,192,131,85,253,12,109,214,221,128,19,9,150,92,6,100,170,43,85,176,138,208,89,250,96,85,11,55,195,110,192,158,239,98,203,128,161,170,73,18,172,36,250,73,24,172,244,70,143,57,118,3,142,248,46,177,12,200,82,13,58,88,137,245,147,57,88,153,91,79,244,223,249,131,149,107,255,137,68,154,228,193,138,86,87,150,96,197,211,89,182,96,101,108,121,227,89,47,50,88,57,118,187,241,101,72,23,172,72,213,164,12,86,44,253,228,9,86,98,191,19,25,172,32,222,38,109,176,18,248,24,92,176,138,244,44,105,131,149,185,245,100,158,96,229,218,127,178,200,96,69,171,43,75,176,226,233,44,91,176,50,182,188,101,13,86,142,221,110,75,10,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,122,50,79,176,114,237,63,89,100,176,162,213,149,37,88,241,116,150,45,88,25,91,222,178,6,43,199,110,183,37,5,43,82,53,41,131,21,75,
+63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,53,203,110,192,137,4,75,222,13,200,84,87,150,96,181,180,221,128,173,83,204,190,27,176,231,187,216,221,128,161,170,73,25,172,150,178,27,208,112,138,89,119,3,142,248,46,113,55,32,75,53,9,131,213,210,118,3,14,220,222,44,187,1,39,18,44,121,55,32,83,93,89,130,213,210,118,3,182,78,49,251,110,192,158,239,98,119,3,134,170,38,101,176,90,202,110,64,195,41,102,221,13,56,226,187,196,221,128,44,213,36,12,86,75,219,13,88,151,37,103,221,13,56,145,96,201,187,1,153,234,74,21,172,34,116,150,62,88,213,194,205,176,27,176,231,187,216,221,128,161,170,73,18,172,36,250,73,24,172,244,179,179,57,118,3,142,248,46,113,55,32,75,53,232,96,37,214,79,230,96,53,203,110,192,137,4,75,126,102,197,84,87,150,96,181,180,221,128,173,83,204,190,27,176,231,187,216,103,86,161,170,73,25,172,150,178,27,208,112,138,89,119,3,142,248,46,241,153,21,75,53,9,131,213,210,118,3,14,220,158,185,245,68,255,157,63,88,185,246,159,72,164,73,30,172,104,117,101,9,86,60,157,101,11,86,198,150,55,158,245,34,131,149,99,183,27,95,134,116,193,138,84,77,202,96,197,210,79,158,96,37,246,59,145,193,10,226,109,210,6,43,129,143,193,5,171,72,207,146,54,88,153,91,79,230,9,86,174,253,39,139,12,86,180,186,178,4,43,158,206,178,5,43,99,203,91,214,96,229,216,237,182,164,96,69,170,38,101,176,98,233,39,79,176,18,251,157,200,96,5,241,54,105,131,149,192,199,224,130,85,164,103,73,27,172,102,217,13,56,145,96,201,187,1,153,234,202,18,172,150,182,27,176,117,138,217,119,3,246,124,23,187,27,48,84,53,41,131,213,82,118,3,26,78,49,235,110,192,17,223,37,238,6,100,169,38,97,176,90,218,110,192,129,219,155,101,55,224,68,130,37,239,6,100,170,43,75,176,90,218,110,192,214,41,102,223,13,216,243,93,236,110,192,80,213,164,12,86,75,217,13,104,56,197,172,187,1,71,124,151,184,27,144,165,154,132,193,106,105,187,1,235,76,111,214,221,128,19,9,150,188,27,144,169,174,84,193,42,66,103,233,131,85,45,220,12,187,1,123,190,139,221,13,24,170,154,36,193,74,162,159,132,193,74,151,35,231,216,13,56,226,187,196,221,128,44,213,160,131,149,88,63,153,131,213,44,187,1,39,18,44,121,55,32,83,93,89,130,213,210,118,3,182,78,49,251,110,192,158,239,98,119,3,134,170,38,101,176,90,202,110,64,195,41,102,221,13,56,226,187,196,221,128,44,213,36,12,86,75,219,13,56,112,123,179,236,6,156,72,176,228,13,22,76,117,101,9,86,75,219,13,216,58,197,236,187,1,123,190,139,221,96,17,170,154,148,193,106,41,187,1,13,167,152,117,55,224,136,239,18,55,88,176,84,147,48,88,45,109,55,224,192,237,153,91,79,244,223,249,131,149,107,255,137,68,154,228,193,138,86,87,150,96,197,211,89,182,96,101,108,121,227,89,47,50,88,57,118,187,241,101,72,23,172,72,213,164,12,86,44,253,228,9,86,98,191,19,25,172,32,222,38,109,176,18,248,24,92,176,138,244,44,105,131,213,44,187,1,39,18,44,121,55,32,83,93,89,130,213,210,118,3,182,78,49,251,110,192,158,239,98,119,3,134,170,38,101,176,90,202,110,64,195,41,102,221,13,56,226,187,196,221,128,44,213,36,12,86,75,219,13,56,112,123,179,236,6,156,72,176,228,221,128,76,117,101,9,86,75,219,13,216,58,197,236,187,1,123,190,139,221,13,24,170,154,148,193,106,41,187,1,13,167,152,117,55,224,136,239,18,119,3,178,84,147,48,88,45,109,55,96,29,60,109,219,219,178,101,86,19,9,150,156,89,49,213,149,42,88,69,232,44,125,176,170,133,27,108,121,203,147,89,245,124,23,155,89,133,170,38,73,176,146,232,39,97,176,210,25,222,117,164,223,145,4,171,17,223,37,102,86,44,213,160,131,149,88,63,153,131,149,185,245,100,158,96,229,218,127,178,200,96,69,171,43,75,176,226,233,44,91,176,50,182,188,101,13,86,142,221,110,75,10,86,164,106,82,6,43,150,126,242,4,43,177,223,137,12,86,16,111,147,54,88,9,124,12,46,88,69,122,150,180,193,202,220,122,50,79,176,
+114,237,63,89,100,176,162,213,149,37,88,241,116,150,45,88,25,91,222,178,6,43,199,110,183,37,5,43,82,53,41,131,21,75,63,121,130,149,216,239,68,6,43,136,183,73,27,172,4,62,6,23,172,34,61,75,218,96,101,110,61,153,39,88,185,246,159,44,50,88,209,234,202,18,172,120,58,203,22,172,140,45,111,89,131,149,99,183,219,146,130,21,169,154,148,193,138,165,159,60,193,74,236,119,34,131,21,196,219,164,13,86,2,31,131,11,86,145,158,37,109,176,154,101,55,224,68,130,223,77,176,154,111,55,96,132,206,178,5,171,236,187,1,123,190,75,15,86,243,236,6,148,232,39,79,176,202,186,27,112,196,119,225,193,42,255,110,64,177,126,50,7,171,89,118,3,78,36,88,242,110,64,166,186,178,4,171,165,237,6,108,157,98,246,221,128,61,223,197,238,6,12,85,77,202,96,181,148,221,128,134,83,204,186,27,112,196,119,137,187,1,89,170,73,24,172,150,182,27,176,150,199,182,189,45,91,176,154,72,176,228,96,197,84,87,170,96,21,161,179,244,193,170,22,110,176,229,45,79,176,234,249,46,54,88,133,170,38,73,176,146,232,39,97,176,210,65,243,58,210,239,72,130,213,136,239,18,131,21,75,53,232,96,37,214,79,230,96,101,110,61,153,39,88,185,246,159,44,50,88,209,234,202,18,172,120,58,203,22,172,140,45,111,89,131,149,99,183,219,146,130,21,169,154,148,193,138,165,159,60,193,74,236,119,34,131,21,196,219,164,13,86,2,31,131,11,86,145,158,37,109,176,50,183,158,204,19,172,92,251,79,22,25,172,104,117,101,9,86,60,157,101,11,86,198,150,183,172,193,202,177,219,109,73,193,138,84,77,202,96,197,210,79,158,96,37,246,59,145,193,10,226,109,210,6,43,129,143,193,5,171,72,207,146,54,88,153,91,79,230,9,86,174,253,39,139,12,86,180,186,178,4,43,158,206,178,5,43,99,203,91,214,96,229,216,237,182,164,96,69,170,38,101,176,98,233,39,79,176,18,251,157,200,96,5,241,54,105,131,149,192,199,224,130,85,164,103,73,27,172,204,173,39,243,4,43,215,254,147,69,6,43,90,93,89,130,21,79,103,217,130,149,177,229,45,107,176,114,236,118,91,82,176,34,85,147,50,88,177,244,147,39,88,137,253,78,100,176,130,120,155,180,193,74,224,99,112,193,42,210,179,164,13,86,179,236,6,156,72,240,187,9,86,243,237,6,140,208,89,182,96,149,125,55,96,207,119,233,193,106,158,221,128,18,253,228,9,86,89,119,3,142,248,46,60,88,229,223,13,40,214,15,58,88,117,242,169,123,59,207,119,189,53,27,205,109,251,72,174,255,30,201,244,213,15,86,111,167,190,86,254,206,24,191,151,190,245,240,73,38,47,171,14,198,2,24,44,31,245,63,92,102,53,175,55,20,213,152,225,52,28,66,6,211,176,186,22,91,233,77,163,56,138,106,196,96,90,14,174,193,216,177,161,247,27,5,158,188,44,194,222,152,126,224,193,167,48,236,105,150,212,209,192,124,236,117,84,99,134,195,194,158,98,117,45,182,146,19,123,67,170,17,131,145,96,175,222,62,16,120,144,170,4,123,19,250,129,231,24,162,176,87,179,164,78,250,100,99,175,167,26,51,28,14,246,52,171,107,177,149,92,216,27,81,141,24,140,4,123,245,211,192,192,115,17,37,216,155,208,15,60,150,12,133,189,154,37,117,112,31,27,123,61,213,152,225,112,176,167,89,93,139,173,228,194,222,136,106,196,96,36,216,227,28,115,38,193,158,244,252,50,20,246,130,206,225,98,99,143,125,192,86,52,246,194,15,138,226,96,79,118,2,148,4,123,29,99,163,202,194,201,53,126,252,201,6,135,31,127,26,34,207,71,60,112,49,235,97,68,89,170,47,5,4,101,25,54,78,154,209,27,130,100,196,64,106,242,1,195,224,228,23,22,62,111,106,125,17,36,229,195,104,200,147,110,206,4,3,35,179,224,35,77,152,86,96,144,22,146,83,48,145,198,77,40,34,145,22,156,77,132,35,77,148,74,64,144,198,201,35,216,72,147,38,17,16,164,5,101,16,60,164,177,211,135,56,164,133,231,14,193,72,147,37,14,16,164,113,178,6,54,210,164,41,3,4,105,65,249,2,15,105,236,100,33,14,105,225,153,66,48,210,100,105,2,4,105,156,28,129,141,52,105,130,0,65,90,80,118,192,67,26,59,53,136,67,90,120,94,16,140,52,89,82,
+192,71,90,199,245,189,48,39,248,135,29,3,255,24,163,237,61,32,45,240,242,162,44,245,158,153,25,88,153,213,188,222,80,84,99,134,211,112,8,25,12,39,63,248,135,21,25,255,24,33,239,125,68,138,224,225,64,186,185,247,194,44,65,132,61,97,162,0,195,94,72,174,192,199,30,55,93,136,199,94,112,198,192,194,158,40,105,64,97,143,147,55,72,176,39,77,29,80,216,11,202,30,216,216,99,39,16,209,216,11,207,33,56,216,147,165,17,40,236,113,50,9,9,246,164,201,4,10,123,65,249,4,27,123,236,148,34,26,123,225,89,5,7,123,178,196,2,133,61,78,110,33,193,158,52,189,64,97,47,40,195,96,99,143,157,100,68,99,47,60,207,224,96,79,150,106,72,176,215,49,254,242,75,209,122,239,245,207,127,113,239,134,253,242,203,122,207,233,113,181,61,149,253,102,180,195,67,85,28,110,212,183,251,219,178,56,149,235,195,126,83,28,238,75,245,121,99,40,194,39,79,224,26,132,150,205,177,73,76,36,240,238,244,118,178,95,150,169,73,143,14,61,50,248,182,216,5,9,21,174,78,174,34,133,82,107,219,51,150,230,30,59,107,233,222,68,32,80,184,148,167,36,74,134,59,158,214,156,250,66,160,77,174,58,158,210,228,24,227,100,76,110,139,190,169,103,128,28,99,210,12,139,146,40,21,198,152,90,115,234,11,128,177,8,213,241,148,198,148,149,12,98,102,138,180,132,160,234,74,174,150,31,84,105,77,206,16,84,121,234,156,43,168,26,53,135,25,131,170,163,70,177,216,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,53,107,63,75,8,170,174,170,209,242,131,42,173,201,25,130,42,79,157,115,5,85,163,152,58,99,80,117,20,95,23,27,84,73,173,229,11,170,44,213,205,18,84,197,126,14,26,84,33,222,45,99,80,21,248,180,84,65,53,210,147,101,13,170,102,81,123,9,65,213,85,14,95,126,80,165,53,57,67,80,229,169,115,174,160,106,60,37,154,49,168,58,158,42,45,54,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,75,29,84,7,251,140,204,170,185,101,255,74,142,160,58,145,39,112,111,205,252,65,149,169,201,60,65,53,66,157,217,131,106,187,57,204,120,58,200,179,51,38,168,246,82,196,35,47,71,80,13,213,90,134,160,42,81,93,190,160,106,236,217,19,251,185,248,160,58,146,34,26,99,169,131,42,75,107,105,131,170,88,117,243,6,85,98,219,105,246,160,202,216,176,186,176,160,74,107,114,134,160,202,83,231,92,65,213,191,143,59,87,80,13,223,247,189,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,53,171,230,75,8,170,174,210,249,242,131,42,173,201,25,130,42,79,157,115,5,85,227,233,224,140,65,213,241,96,112,177,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,106,86,205,151,16,84,93,165,243,229,7,85,90,147,51,4,85,158,58,231,10,170,198,211,193,25,131,170,227,193,224,98,131,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,212,65,117,240,254,188,89,53,183,188,151,157,35,168,78,228,9,124,103,124,254,160,202,212,100,158,160,26,161,206,236,65,181,109,122,96,60,29,228,217,25,19,84,123,41,226,145,151,35,168,134,106,45,67,80,149,168,46,95,80,53,122,81,136,253,92,124,80,29,73,17,141,177,212,65,149,165,181,180,65,85,172,186,121,131,170,89,53,95,66,80,117,149,206,151,31,84,105,77,206,16,84,121,234,156,43,168,26,79,7,103,12,170,142,7,131,139,13,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,162,71,89,246,160,202,232,110,182,176,160,74,107,114,134,160,202,83,231,92,65,213,223,244,47,87,80,13,111,18,184,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,53,171,230,75,8,170,174,210,249,242,131,42,173,201,
+25,130,42,79,157,115,5,85,227,233,224,140,65,213,241,96,112,177,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,234,160,58,232,11,109,86,205,45,253,134,115,4,213,137,60,129,189,144,231,15,170,76,77,230,9,170,17,234,204,30,84,219,102,222,198,211,65,158,157,49,65,181,151,34,30,121,57,130,106,168,214,50,4,85,137,234,242,5,85,163,199,186,216,207,197,7,213,145,20,209,24,75,29,84,89,90,75,27,84,197,170,155,55,168,154,85,243,37,4,85,87,233,124,249,65,149,214,228,12,65,149,167,206,185,130,170,241,116,112,198,160,234,120,48,184,216,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,53,171,230,75,8,170,174,210,249,242,131,42,173,201,25,130,42,79,157,115,5,85,227,233,224,140,65,213,241,96,112,177,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,89,214,160,74,28,104,151,61,168,50,142,194,91,88,80,165,53,57,67,80,229,169,115,174,160,234,63,33,50,87,80,13,63,81,114,25,65,149,212,90,190,160,202,82,221,44,65,85,236,231,160,65,21,226,221,50,6,85,129,79,75,21,84,35,61,25,52,168,118,210,190,124,41,58,6,244,39,95,228,122,249,82,30,85,125,242,4,54,78,166,101,67,34,239,24,121,160,234,79,246,160,213,234,80,136,193,35,240,64,85,159,128,88,143,167,109,207,56,26,212,99,103,45,221,155,8,4,10,79,5,165,36,74,134,59,158,214,156,250,66,160,77,174,58,158,210,228,24,227,28,13,250,147,39,134,233,25,32,199,152,244,84,80,74,162,84,24,99,106,205,169,47,0,198,34,84,199,83,154,52,85,117,5,49,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,178,6,85,226,200,188,236,65,149,113,110,222,194,130,42,173,201,25,130,42,79,157,115,5,85,255,209,160,185,130,106,248,169,160,203,8,170,164,214,242,5,85,150,234,102,9,170,98,63,7,13,170,16,239,150,49,168,10,124,90,170,160,26,233,201,82,7,85,206,49,160,57,130,170,244,4,208,249,131,42,83,147,121,130,106,132,58,179,7,213,160,163,65,147,7,85,246,169,160,51,7,213,80,173,101,8,170,18,213,229,11,170,225,71,131,166,12,170,178,83,65,231,11,170,44,173,165,13,170,98,213,205,27,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,203,26,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,203,26,84,137,35,243,178,7,85,198,185,121,11,11,170,180,38,103,8,170,60,117,206,21,84,253,71,131,230,10,170,225,167,130,46,35,168,146,90,203,23,84,89,170,155,37,168,138,253,28,52,168,66,188,91,198,160,42,240,105,169,130,106,164,39,75,29,84,57,199,128,230,8,170,210,19,64,231,15,170,76,77,230,9,170,17,234,204,30,84,131,142,6,77,30,84,217,167,130,206,28,84,67,181,150,33,168,74,84,151,47,168,134,31,13,154,50,168,202,78,5,157,47,168,178,180,150,54,168,138,85,55,111,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,
+145,158,44,107,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,107,80,37,142,204,203,30,84,25,231,230,45,44,168,210,154,156,33,168,242,212,57,87,80,245,31,13,154,43,168,134,159,10,186,140,160,74,106,45,95,80,101,169,110,150,160,42,246,115,208,160,10,241,110,25,131,170,192,167,165,10,170,145,158,44,117,80,229,28,3,154,35,168,74,79,0,157,63,168,50,53,153,39,168,70,168,51,123,80,13,58,26,52,121,80,101,159,10,58,115,80,13,213,90,134,160,42,81,93,190,160,26,126,52,104,202,160,42,59,21,116,190,160,202,210,90,218,160,42,86,221,188,65,149,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,149,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,178,172,65,149,56,50,47,123,80,101,156,155,183,176,160,74,107,114,134,160,202,83,231,92,65,213,127,52,104,174,160,26,126,42,232,50,130,42,169,181,124,65,149,165,186,89,130,170,216,207,65,131,42,196,187,101,12,170,2,159,150,42,168,70,122,50,104,80,237,15,204,237,59,174,111,205,23,25,183,198,57,4,219,201,51,223,215,191,88,79,174,86,126,214,60,139,215,77,218,218,2,153,195,198,170,134,33,111,131,219,163,254,135,201,71,177,121,227,39,24,49,136,194,117,252,242,128,99,195,229,90,106,145,55,90,83,126,130,242,33,212,196,93,67,176,64,224,84,29,141,234,179,250,128,67,215,132,116,62,116,213,220,30,245,63,32,116,245,4,51,160,75,115,185,150,90,196,134,174,17,193,124,232,210,28,58,8,136,205,110,69,215,132,116,62,116,213,220,30,245,63,32,116,245,4,51,160,75,115,185,142,2,128,159,96,62,116,185,207,199,142,143,140,65,167,92,167,137,140,211,227,151,35,35,163,255,16,101,112,100,116,156,238,43,143,140,1,103,244,166,71,215,224,80,69,44,186,156,135,36,166,68,151,121,14,41,4,93,174,211,68,147,161,139,111,17,2,93,113,118,136,66,215,224,116,49,44,186,156,167,133,165,68,151,121,32,31,4,93,174,99,245,146,161,139,111,17,2,93,113,118,136,66,215,224,152,29,44,186,156,199,230,164,68,151,121,50,21,4,93,174,243,165,146,161,139,111,17,2,93,113,118,136,66,215,205,46,153,239,210,164,179,163,75,49,197,162,75,17,204,139,46,190,69,8,116,197,217,33,10,93,155,235,93,42,116,105,210,217,209,165,152,98,209,165,8,230,69,23,223,34,4,186,226,236,192,174,119,185,206,255,2,212,187,66,78,241,74,84,239,154,28,47,21,91,239,242,30,18,133,174,119,217,79,47,138,168,119,209,103,16,101,64,23,54,103,12,58,206,38,41,186,112,57,163,255,180,148,116,232,194,228,140,1,135,113,100,64,23,54,103,12,58,215,33,41,186,112,57,163,255,216,128,116,232,194,228,140,1,93,233,51,160,11,155,51,6,53,56,79,138,46,92,206,232,239,159,157,14,93,152,156,49,160,61,115,6,116,97,115,198,9,233,236,232,194,229,140,61,193,188,232,194,228,140,35,130,51,161,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,204,135,46,103,127,243,120,116,5,117,41,79,131,174,105,251,236,72,116,249,155,96,131,209,229,232,206,44,71,87,64,143,229,12,232,194,230,140,65,237,122,147,162,11,151,51,250,187,193,166,67,23,38,103,12,104,54,154,1,93,216,156,49,168,111,101,82,116,225,114,70,127,91,196,116,232,194,228,140,1,93,247,50,160,11,155,51,6,53,112,75,138,46,92,206,232,239,15,150,14,93,152,156,49,160,253,84,6,116,97,115,198,9,233,236,232,194,229,140,61,193,188,232,194,228,140,35,130,51,161,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,
+17,204,135,46,103,255,182,120,116,5,117,97,75,131,174,105,123,176,72,116,249,155,124,129,209,229,232,62,37,71,87,64,15,169,12,232,194,230,140,65,237,136,146,162,11,151,51,250,187,221,164,67,23,38,103,12,104,166,146,1,93,216,156,49,168,47,71,82,116,225,114,70,127,219,135,116,232,194,228,140,1,93,5,50,160,11,155,51,6,189,160,158,20,93,184,156,209,255,254,115,58,116,97,114,198,128,215,107,51,160,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,96,62,116,213,88,78,147,51,78,72,231,67,87,205,26,153,51,246,4,51,160,75,123,72,104,206,56,34,56,19,186,176,57,227,132,116,118,116,225,114,198,158,96,94,116,97,114,198,17,193,153,208,133,205,25,39,164,179,163,11,151,51,246,4,243,162,11,147,51,142,8,206,132,46,108,206,56,33,157,29,93,184,156,177,39,152,23,93,152,156,113,68,112,38,116,97,115,198,9,233,236,232,194,229,140,61,193,188,232,194,228,140,35,130,51,161,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,204,135,174,154,91,154,156,113,66,58,31,186,106,214,200,156,177,39,152,1,93,26,195,208,156,113,68,112,38,116,97,115,198,9,233,236,232,194,229,140,61,193,188,232,194,228,140,35,130,51,161,11,155,51,78,72,103,71,23,46,103,236,9,230,69,23,38,103,28,17,156,9,93,216,156,113,66,58,59,186,112,57,99,79,48,47,186,48,57,227,136,224,76,232,194,230,140,19,210,217,209,133,203,25,123,130,121,209,133,201,25,71,4,103,66,23,54,103,156,144,206,142,46,92,206,216,19,204,139,46,76,206,56,34,152,10,93,61,207,23,178,158,226,175,172,134,127,49,2,216,139,248,174,226,110,70,164,125,94,240,250,138,191,178,193,224,197,16,100,47,228,157,197,93,228,3,134,193,234,45,254,202,6,133,23,67,160,189,144,119,23,119,145,167,29,217,11,89,127,113,46,210,196,29,198,17,72,11,235,49,206,66,26,191,203,120,20,210,24,125,198,67,145,38,236,52,142,64,26,171,215,56,23,105,226,110,227,8,164,133,245,27,103,33,141,223,113,60,10,105,140,158,227,161,72,19,118,29,71,32,141,213,119,156,29,61,165,157,199,33,209,51,168,247,56,47,122,178,187,143,199,69,207,240,254,227,193,209,83,214,129,28,142,52,170,218,23,133,52,78,229,15,136,52,162,6,43,65,26,163,10,139,66,26,223,50,36,210,226,236,17,137,52,170,242,23,133,52,78,21,16,136,52,162,30,43,65,26,163,34,139,66,26,223,50,36,210,226,236,17,137,52,170,10,24,133,52,78,69,16,136,52,162,54,43,65,26,163,58,139,66,26,223,50,36,210,226,236,17,137,52,170,34,24,133,52,78,117,16,136,52,162,78,43,65,26,163,82,139,66,26,223,50,36,210,226,236,17,137,52,170,58,24,133,52,78,165,16,136,52,162,102,43,65,26,163,106,139,66,26,223,50,36,210,226,236,33,168,167,113,250,151,179,235,105,210,14,230,144,122,90,80,15,115,94,61,141,221,197,60,174,158,22,222,199,60,184,158,38,235,100,14,71,26,58,247,20,119,51,7,34,13,153,123,242,59,154,163,144,134,202,61,133,93,205,225,72,67,231,158,226,206,230,64,164,33,115,79,126,119,115,20,210,80,185,167,176,195,57,28,105,232,220,83,220,229,28,136,52,100,238,201,239,116,142,66,26,42,247,20,118,59,135,35,13,157,123,138,59,158,3,145,134,204,61,249,93,207,81,72,67,229,158,194,206,231,112,164,161,115,79,113,247,115,32,210,144,185,39,191,3,58,10,105,168,220,83,216,5,29,129,52,86,31,116,46,210,196,157,208,17,72,11,235,133,206,66,26,191,27,122,20,210,24,253,208,67,145,38,236,136,14,71,26,58,247,20,119,69,7,34,13,153,123,242,59,163,163,144,134,202,61,133,221,209,225,72,67,231,158,226,14,233,64,164,33,115,79,126,151,116,20,210,80,185,167,176,83,58,28,105,232,220,83,220,45,29,136,52,100,238,201,239,152,142,66,26,42,247,20,118,77,135,35,13,157,123,138,59,167,3,145,134,204,61,249,221,211,81,72,67,229,158,194,14,234,112,164,161,115,79,113,23,117,32,210,144,185,39,191,147,58,10,105,168,220,83,216,77,
+29,129,52,86,63,117,46,210,196,29,213,17,72,11,235,169,206,66,26,191,171,122,20,210,24,125,213,67,145,38,236,172,14,71,26,58,247,20,119,87,7,34,13,153,123,242,59,172,163,144,134,202,61,133,93,214,225,72,67,231,158,226,78,235,64,164,33,115,79,126,183,117,20,210,80,185,167,176,227,58,28,105,232,220,83,220,117,29,136,52,100,238,201,239,188,142,66,26,42,247,20,118,95,135,35,13,157,123,138,59,176,3,145,134,204,61,249,93,216,81,72,67,229,158,194,78,236,112,164,161,115,79,113,55,118,32,210,144,185,39,191,35,59,10,105,168,220,83,216,149,29,129,52,86,95,118,46,210,196,157,217,17,72,11,235,205,206,66,26,191,59,123,20,210,24,253,217,67,145,38,236,208,14,71,26,58,247,20,119,105,7,34,13,153,123,242,59,181,163,144,134,202,61,133,221,218,225,72,67,231,158,226,142,237,64,164,33,115,79,126,215,118,20,210,80,185,167,176,115,59,28,105,232,220,83,220,189,29,136,52,100,238,201,239,224,142,66,26,42,247,20,118,113,135,35,13,157,123,138,59,185,3,145,134,204,61,249,221,220,81,72,67,229,158,194,142,238,112,164,161,115,79,113,87,119,32,210,144,185,39,191,179,59,10,105,168,220,83,216,221,29,129,52,86,127,119,46,210,196,29,222,17,72,11,235,241,206,66,26,191,203,123,20,210,24,125,222,67,145,38,236,244,14,71,26,58,247,20,119,123,7,34,13,153,123,242,59,190,163,144,134,202,61,133,93,223,225,72,67,231,158,226,206,239,64,164,33,115,79,126,247,119,20,210,80,185,167,176,3,60,28,105,232,220,83,220,5,30,136,52,100,238,201,239,4,143,66,26,42,247,20,118,131,135,35,13,157,123,138,59,194,3,145,134,204,61,249,93,225,81,72,67,229,158,194,206,240,112,164,161,115,79,113,119,120,32,210,144,185,39,191,67,60,10,105,168,220,83,216,37,158,141,180,142,235,75,81,151,248,239,172,199,3,188,28,2,237,101,116,143,120,55,27,202,62,47,89,29,226,109,124,20,155,55,126,130,17,131,208,196,233,33,112,186,195,127,103,59,40,224,229,0,96,47,197,189,225,93,196,73,71,246,82,212,25,158,137,46,105,95,120,0,186,130,186,194,115,208,197,238,9,31,131,174,240,142,240,129,232,146,245,131,7,160,139,211,13,158,137,46,105,47,120,0,186,130,58,193,115,208,197,238,3,31,131,174,240,46,240,129,232,146,245,128,7,160,139,211,1,158,27,25,133,253,223,17,145,49,164,251,59,43,50,114,123,191,71,69,198,224,206,239,161,145,81,212,247,29,141,46,162,222,23,131,46,70,221,15,135,46,127,21,86,128,174,240,26,44,8,93,124,139,16,232,138,179,67,20,186,136,26,95,12,186,24,181,62,28,186,252,149,87,1,186,194,235,174,32,116,241,45,66,160,43,206,14,81,232,34,234,122,49,232,98,212,247,112,232,242,87,91,5,232,10,175,181,130,208,197,183,8,129,174,56,59,68,161,139,168,229,197,160,139,81,211,195,161,203,95,97,21,160,43,188,190,10,66,23,223,34,4,186,226,236,16,133,46,162,126,23,131,46,70,29,15,135,46,127,85,85,128,174,240,154,42,8,93,124,139,16,232,138,179,3,187,222,197,232,220,206,173,119,9,251,182,35,234,93,33,93,219,89,245,46,110,207,246,168,122,87,112,199,246,208,122,151,168,95,59,26,93,216,156,81,218,171,29,135,46,92,206,200,238,211,14,66,23,38,103,148,245,104,71,163,11,155,51,74,251,179,227,208,133,203,25,217,189,217,65,232,194,228,140,178,190,236,104,116,97,115,70,105,79,118,28,186,112,57,35,187,31,59,8,93,152,156,81,214,139,29,141,46,108,206,40,237,195,142,67,23,46,103,100,247,96,7,161,11,147,51,202,250,175,163,209,133,205,25,165,189,215,113,232,194,229,140,236,190,235,32,116,97,114,70,89,207,117,0,186,56,29,215,153,232,146,246,91,7,160,43,168,219,58,7,93,236,94,235,49,232,10,239,180,30,136,46,89,159,117,52,186,176,57,163,180,199,58,14,93,184,156,145,221,95,29,132,46,76,206,40,235,173,142,70,23,54,103,148,246,85,199,161,11,151,51,178,123,170,131,208,133,201,25,101,253,212,209,232,194,230,140,210,94,234,56,116,225,114,70,118,31,117,16,186,48,57,163,172,135,58,26,93,216,156,81,218,63,29,135,46,92,206,200,238,
+157,14,66,23,38,103,148,245,77,71,163,11,155,51,74,123,166,227,208,133,203,25,217,253,210,65,232,194,228,140,178,94,233,0,116,113,58,165,51,209,37,237,147,14,64,87,80,151,116,14,186,216,61,210,99,208,21,222,33,61,16,93,178,254,232,104,116,97,115,70,105,111,116,28,186,112,57,35,187,47,58,8,93,152,156,81,214,19,29,141,46,108,206,40,237,135,142,67,23,46,103,100,247,66,7,161,11,147,51,202,250,160,163,209,133,205,25,165,61,208,113,232,194,229,140,236,254,231,32,116,97,114,70,89,239,115,52,186,176,57,163,180,239,57,14,93,184,156,145,221,243,28,132,46,76,206,40,235,119,142,70,23,54,103,148,246,58,199,161,11,151,51,178,251,156,131,208,133,201,25,101,61,206,1,232,226,116,56,103,162,75,218,223,28,128,174,160,238,230,28,116,177,123,155,199,160,43,188,179,121,32,186,100,125,205,209,232,194,230,140,210,158,230,56,116,225,114,70,118,63,115,16,186,48,57,163,172,151,57,26,93,216,156,81,218,199,28,135,46,92,206,200,238,97,14,66,23,38,103,148,245,47,71,163,11,155,51,74,123,151,227,208,133,203,25,217,125,203,65,232,194,228,140,178,158,229,104,116,97,115,70,105,191,114,28,186,112,57,35,187,87,57,8,93,152,156,81,214,167,28,141,46,108,206,40,237,81,142,67,23,46,103,100,247,39,7,161,11,147,51,202,122,147,3,208,197,233,76,206,68,151,180,47,57,0,93,65,93,201,57,232,98,247,36,143,65,87,120,71,242,64,116,201,250,145,163,209,133,205,25,165,189,200,113,232,194,229,140,236,62,228,32,116,97,114,70,89,15,114,52,186,176,57,163,180,255,56,14,93,184,156,145,221,123,28,132,46,76,206,40,235,59,142,70,23,54,103,148,246,28,199,161,11,151,51,178,251,141,131,208,133,201,25,101,189,198,209,232,194,230,140,210,62,227,56,116,225,114,70,118,143,113,16,186,48,57,163,172,191,56,26,93,216,156,81,218,91,28,135,46,92,206,200,238,43,14,66,23,38,103,148,245,20,103,163,171,231,249,66,214,83,220,218,84,254,229,168,123,189,143,120,232,200,220,140,72,251,188,224,245,21,183,181,151,127,57,236,94,111,35,25,49,144,154,124,192,48,88,189,197,109,237,229,95,14,187,215,219,72,202,135,209,144,167,29,217,11,89,127,113,46,210,196,29,198,17,72,11,235,49,206,66,26,191,203,120,20,210,24,125,198,67,145,38,236,52,142,64,26,171,215,56,23,105,226,110,227,8,164,133,245,27,103,33,141,223,113,60,10,105,140,158,227,161,72,19,118,29,71,32,141,213,119,156,29,61,165,157,199,33,209,51,168,247,56,47,122,178,187,143,199,69,207,240,254,227,193,209,83,214,129,28,142,52,170,218,23,133,52,78,229,15,136,52,162,6,43,65,26,163,10,139,66,26,223,50,36,210,226,236,17,137,52,170,242,23,133,52,78,21,16,136,52,162,30,43,65,26,163,34,139,66,26,223,50,36,210,226,236,17,137,52,170,10,24,133,52,78,69,16,136,52,162,54,43,65,26,163,58,139,66,26,223,50,36,210,226,236,17,137,52,170,34,24,133,52,78,117,16,136,52,162,78,43,65,26,163,82,139,66,26,223,50,36,210,226,236,17,137,52,170,58,24,133,52,78,165,16,136,52,162,102,43,65,26,163,106,139,66,26,223,50,36,210,226,236,33,168,167,113,250,151,179,235,105,210,14,230,144,122,90,80,15,115,94,61,141,221,197,60,174,158,22,222,199,60,184,158,38,235,100,14,71,26,58,247,20,119,51,7,34,13,153,123,242,59,154,163,144,134,202,61,133,93,205,225,72,67,231,158,226,206,230,64,164,33,115,79,126,119,115,20,210,80,185,167,176,195,57,28,105,232,220,83,220,229,28,136,52,100,238,201,239,116,142,66,26,42,247,20,118,59,135,35,13,157,123,138,59,158,3,145,134,204,61,249,93,207,81,72,67,229,158,194,206,231,112,164,161,115,79,113,247,115,32,210,144,185,39,191,3,58,10,105,168,220,83,216,5,29,129,52,86,31,116,46,210,196,157,208,17,72,11,235,133,206,66,26,191,27,122,20,210,24,253,208,67,145,38,236,136,14,71,26,58,247,20,119,69,7,34,13,153,123,242,59,163,163,144,134,202,61,133,221,209,225,72,67,231,158,226,14,233,64,164,33,115,79,126,151,116,20,210,80,185,167,176,83,58,28,105,232,220,83,
+220,45,29,136,52,100,238,201,239,152,142,66,26,42,247,20,118,77,135,35,13,157,123,138,59,167,3,145,134,204,61,249,221,211,81,72,67,229,158,194,14,234,112,164,161,115,79,113,23,117,32,210,144,185,39,191,147,58,10,105,168,220,83,216,77,29,129,52,86,63,117,46,210,196,29,213,17,72,11,235,169,206,66,26,191,171,122,20,210,24,125,213,67,145,38,236,172,14,71,26,58,247,20,119,87,7,34,13,153,123,242,59,172,163,144,134,202,61,133,93,214,225,72,67,231,158,226,78,235,64,164,33,115,79,126,183,117,20,210,80,185,167,176,227,58,28,105,232,220,83,220,117,29,136,52,100,238,201,239,188,142,66,26,42,247,20,118,95,135,35,13,157,123,138,59,176,3,145,134,204,61,249,93,216,81,72,67,229,158,194,78,236,112,164,161,115,79,113,55,118,32,210,144,185,39,191,35,59,10,105,168,220,83,216,149,29,129,52,86,95,118,46,210,196,157,217,17,72,11,235,205,206,66,26,191,59,123,20,210,24,253,217,67,145,38,236,208,14,71,26,58,247,20,119,105,7,34,13,153,123,242,59,181,163,144,134,202,61,133,221,218,225,72,67,231,158,226,142,237,64,164,33,115,79,126,215,118,20,210,80,185,167,176,115,59,28,105,232,220,83,220,189,29,136,52,100,238,201,239,224,142,66,26,42,247,20,118,113,135,35,13,157,123,138,59,185,3,145,134,204,61,249,221,220,81,72,67,229,158,194,142,238,112,164,161,115,79,113,87,119,32,210,144,185,39,191,179,59,10,105,168,220,83,216,221,29,129,52,86,127,119,46,210,196,29,222,17,72,11,235,241,206,66,26,191,203,123,20,210,24,125,222,67,145,38,236,244,14,71,26,58,247,20,119,123,7,34,13,153,123,242,59,190,163,144,134,202,61,133,93,223,225,72,67,231,158,226,206,239,64,164,33,115,79,126,247,119,20,210,80,185,167,176,3,60,28,105,232,220,83,220,5,30,136,52,100,238,201,239,4,143,66,26,42,247,20,118,131,135,35,13,157,123,138,59,194,3,145,134,204,61,249,93,225,81,72,67,229,158,194,206,240,112,164,161,115,79,113,119,120,32,210,144,185,39,191,67,60,10,105,168,220,83,216,37,158,141,180,142,235,11,89,155,248,87,255,105,67,192,139,17,212,94,196,183,137,247,48,162,108,244,130,215,38,222,198,73,51,122,67,144,140,24,72,77,62,96,24,156,54,241,22,62,111,106,125,17,36,229,195,104,200,147,78,237,133,172,77,60,27,105,210,54,241,16,164,5,181,137,231,33,141,221,38,62,14,105,225,109,226,131,145,38,107,19,15,65,26,167,77,60,27,105,210,54,241,16,164,5,181,137,231,33,141,221,38,62,14,105,225,109,226,131,145,38,107,19,15,65,26,167,77,60,63,122,10,219,196,99,162,103,72,155,120,102,244,228,182,137,143,140,158,193,109,226,195,163,167,168,77,60,30,105,68,129,48,14,105,140,82,33,18,105,254,210,173,8,105,225,165,91,24,210,248,150,33,145,22,103,143,72,164,17,5,194,56,164,49,74,133,72,164,249,75,183,34,164,133,151,110,97,72,227,91,134,68,90,156,61,34,145,70,20,8,227,144,198,40,21,34,145,230,47,221,138,144,22,94,186,133,33,141,111,25,18,105,113,246,136,68,26,81,32,140,67,26,163,84,136,68,154,191,116,43,66,90,120,233,22,134,52,190,101,72,164,197,217,35,18,105,68,129,48,14,105,140,82,33,18,105,254,210,173,8,105,225,165,91,24,210,248,150,33,145,22,103,15,65,61,141,209,38,158,95,79,19,182,137,199,212,211,66,218,196,51,235,105,220,54,241,145,245,180,224,54,241,225,245,52,81,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,16,164,113,218,196,179,145,38,109,19,15,65,90,80,155,120,30,210,216,109,226,227,144,22,222,38,62,24,105,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,
+38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,33,72,227,180,137,103,35,77,218,38,30,130,180,160,54,241,60,164,177,219,196,199,33,45,188,77,124,48,210,100,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,67,144,198,105,19,207,70,154,180,77,60,4,105,65,109,226,121,72,99,183,137,143,67,90,120,155,248,96,164,201,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,135,32,141,211,38,158,141,52,105,155,120,8,210,130,218,196,243,144,198,110,19,31,135,180,240,54,241,193,72,147,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,207,71,90,199,245,19,89,155,248,31,172,7,5,124,50,130,218,39,241,109,226,61,140,40,27,125,194,107,19,111,227,164,25,189,33,72,70,12,164,38,31,48,12,78,155,248,31,108,71,6,124,50,132,218,39,242,54,241,78,242,164,83,251,68,214,38,158,141,52,105,155,120,8,210,130,218,196,243,144,198,110,19,31,135,180,240,54,241,193,72,147,181,137,135,32,141,211,38,158,141,52,105,155,120,8,210,130,218,196,243,144,198,110,19,31,135,180,240,54,241,193,72,147,181,137,135,32,141,211,38,158,31,61,133,109,226,49,209,51,164,77,60,51,122,114,219,196,71,70,207,224,54,241,225,209,83,212,38,30,143,52,162,64,24,135,52,70,169,16,137,52,127,233,86,132,180,240,210,45,12,105,124,203,144,72,139,179,71,36,210,136,2,97,28,210,24,165,66,36,210,252,165,91,17,210,194,75,183,48,164,241,45,67,34,45,206,30,145,72,35,10,132,113,72,99,148,10,145,72,243,151,110,69,72,11,47,221,194,144,198,183,12,137,180,56,123,68,34,141,40,16,198,33,141,81,42,68,34,205,95,186,21,33,45,188,116,11,67,26,223,50,36,210,226,236,17,137,52,162,64,24,135,52,70,169,16,137,52,127,233,86,132,180,240,210,45,12,105,124,203,144,72,139,179,135,160,158,198,104,19,207,175,167,9,219,196,99,234,105,33,109,226,153,245,52,110,155,248,200,122,90,112,155,248,240,122,154,168,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,8,210,56,109,226,217,72,147,182,137,135,32,45,168,77,60,15,105,236,54,
+241,113,72,11,111,19,31,140,52,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,16,164,113,218,196,179,145,38,109,19,15,65,90,80,155,120,30,210,216,109,226,227,144,22,222,38,62,24,105,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,33,72,227,180,137,103,35,77,218,38,30,130,180,160,54,241,60,164,177,219,196,199,33,45,188,77,124,48,210,100,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,67,144,198,105,19,207,70,154,180,77,60,4,105,65,109,226,121,72,99,183,137,143,67,90,120,155,248,96,164,201,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,231,35,173,227,186,190,187,15,232,19,175,146,147,17,203,111,254,250,183,9,207,79,159,125,246,249,103,207,138,237,141,70,195,151,159,189,120,241,217,203,33,244,188,204,172,99,141,97,76,217,176,150,198,217,71,158,205,249,204,248,205,136,133,187,199,59,151,197,155,110,108,212,40,48,186,236,70,20,162,201,176,190,243,242,33,147,78,211,4,151,187,15,125,2,36,135,245,165,207,132,100,75,159,122,32,146,93,61,228,209,72,38,90,227,167,70,114,72,95,251,76,72,118,247,185,79,128,228,176,190,247,153,144,108,233,131,15,68,178,171,71,61,26,201,68,235,253,212,72,14,233,155,159,9,201,238,62,250,41,86,23,65,125,245,115,173,46,166,125,246,145,171,11,71,15,124,248,234,194,223,218,63,249,234,34,160,47,255,28,72,30,84,104,83,35,217,89,187,205,139,100,179,182,158,6,201,81,90,13,68,178,171,156,159,17,201,48,123,34,144,60,168,0,167,70,178,179,54,156,23,201,102,237,62,13,146,163,180,26,136,100,215,227,130,140,72,134,217,19,129,228,65,133,57,53,146,157,181,231,188,72,54,159,13,164,65,114,148,86,3,145,236,122,28,145,17,201,48,123,34,144,60,168,96,167,70,178,179,182,157,23,201,230,179,135,52,72,142,210,106,32,146,93,143,59,50,34,25,102,79,4,146,7,21,242,212,72,118,214,206,243,34,217,124,182,145,6,201,81,90,13,68,178,235,113,74,70,36,195,236,41,173,39,59,207,97,72,81,79,14,58,151,33,87,61,121,122,78,3,178,158,236,56,67,1,94,79,246,31,13,145,188,158,28,112,174,195,28,72,78,93,187,8,59,247,33,47,146,19,213,46,92,103,52,36,66,242,92,181,139,144,115,35,230,64,114,234,218,69,216,185,18,121,145,156,168,118,225,58,3,34,17,146,231,170,93,132,156,75,49,7,146,83,215,46,194,206,173,200,139,228,68,181,11,
+215,25,19,137,144,60,87,237,34,228,220,139,57,144,156,186,118,17,118,46,70,94,36,39,170,93,184,206,176,72,132,228,185,106,23,33,231,106,204,129,228,212,181,139,176,115,55,242,34,57,81,237,194,117,70,70,34,36,207,85,187,8,57,183,35,19,146,221,231,120,36,64,114,216,185,30,153,144,108,57,231,3,136,100,215,25,28,104,36,19,71,139,164,70,114,200,185,32,115,32,57,117,237,34,236,220,144,188,72,78,84,187,112,157,241,145,8,201,115,213,46,66,206,29,153,3,201,169,107,23,97,231,146,228,69,114,162,218,133,235,12,145,68,72,158,171,118,17,114,174,201,28,72,78,93,187,8,59,247,36,47,146,19,213,46,92,103,148,36,66,242,92,181,139,144,115,83,230,64,114,234,218,69,216,185,42,121,145,156,168,118,225,58,3,37,17,146,231,170,93,132,156,203,50,7,146,83,215,46,194,206,109,201,139,228,68,181,11,215,25,43,137,144,60,87,237,34,228,220,151,76,72,118,159,3,147,0,201,97,231,194,100,66,178,229,156,24,32,146,93,103,184,160,145,76,28,77,147,26,201,33,231,202,204,129,228,212,181,139,176,115,103,242,34,57,81,237,194,117,70,76,34,36,207,85,187,8,57,183,102,14,36,167,174,93,132,157,107,147,23,201,137,106,23,174,51,104,18,33,121,174,218,69,200,185,56,115,32,57,117,237,34,236,220,156,188,72,78,84,187,112,157,113,147,8,201,115,213,46,66,206,221,153,3,201,169,107,23,97,231,242,228,69,114,162,218,133,235,12,157,68,72,158,171,118,17,114,174,207,28,72,78,93,187,8,59,247,39,47,146,19,213,46,92,103,244,36,66,242,92,181,139,144,115,131,50,33,217,125,142,80,2,36,135,157,43,148,9,201,150,115,134,128,72,118,157,1,132,70,50,113,180,81,106,36,135,156,75,52,7,146,83,215,46,194,206,45,202,139,228,68,181,11,215,25,67,137,144,60,87,237,34,228,220,163,57,144,156,186,118,17,118,46,82,94,36,39,170,93,184,206,48,74,132,228,185,106,23,33,231,42,205,129,228,212,181,139,176,115,151,242,34,57,81,237,194,117,70,82,34,36,207,85,187,8,57,183,105,14,36,167,174,93,132,157,235,148,23,201,137,106,23,174,51,152,18,33,121,174,218,69,200,185,80,115,32,57,117,237,34,236,220,168,188,72,78,84,187,112,157,241,148,8,201,115,213,46,66,206,157,202,132,100,247,57,84,9,144,28,118,46,85,38,36,91,206,169,2,34,217,117,134,20,26,201,196,209,88,169,145,28,114,174,213,28,72,78,93,187,8,59,247,42,47,146,19,213,46,92,103,84,37,66,242,92,181,139,144,115,179,230,64,114,234,218,69,216,185,90,121,145,156,168,118,225,58,3,43,17,146,231,170,93,132,156,203,53,7,146,83,215,46,194,206,237,202,139,228,68,181,11,215,25,91,137,144,60,87,237,34,228,220,175,57,144,156,186,118,17,118,46,88,94,36,39,170,93,184,206,240,74,132,228,185,106,23,33,231,138,205,129,228,212,181,139,176,115,199,242,34,57,81,237,194,117,70,88,34,36,207,85,187,8,57,183,44,1,146,59,41,174,203,234,93,89,238,207,218,88,237,63,92,61,251,231,229,238,48,248,248,118,107,126,244,156,167,246,245,171,95,254,247,171,87,63,244,178,125,125,102,80,188,254,177,80,98,20,127,249,190,216,238,215,187,135,211,246,177,52,148,33,16,35,240,136,55,158,72,148,209,66,229,172,255,154,83,81,245,95,203,82,81,35,210,140,88,178,9,176,80,21,229,199,207,144,117,86,181,140,133,187,58,125,80,228,170,227,118,61,18,243,241,217,240,227,115,30,148,58,178,54,121,223,60,171,229,125,243,188,184,56,28,139,199,237,186,44,30,203,227,105,245,196,167,70,153,164,60,229,198,74,29,8,70,198,80,2,193,57,171,186,5,40,94,128,162,27,169,151,141,107,155,140,191,95,69,47,18,203,67,233,150,161,220,222,75,175,30,111,47,134,207,98,212,202,213,20,102,189,218,173,213,69,189,0,43,197,100,117,91,22,135,155,98,127,216,127,186,223,238,138,199,213,238,65,17,63,220,184,23,169,14,126,35,117,196,241,118,179,121,82,92,212,139,243,162,46,58,5,177,208,170,221,63,220,93,151,71,54,183,225,160,240,156,201,208,107,200,211,62,150,200,102,84,203,243,129,20,70,109,134,149,203,168,211,65,205,107,212,182,66,159,205,168,
+150,82,121,10,163,54,195,202,101,212,233,160,230,53,106,91,172,206,102,84,75,213,56,133,81,155,97,229,50,234,116,80,243,26,181,173,219,102,51,170,165,128,154,194,168,205,176,114,25,117,58,168,121,141,218,150,48,179,25,213,82,75,76,97,212,102,88,185,140,58,29,212,12,70,85,43,239,110,225,182,173,156,11,242,245,97,175,88,86,167,237,237,126,181,187,82,191,246,178,172,87,167,170,184,57,30,238,52,173,162,58,232,127,46,139,230,202,162,60,30,213,202,252,176,47,14,234,246,155,221,225,157,153,57,12,89,135,228,5,76,49,172,163,15,149,237,106,127,168,175,96,168,135,150,136,102,193,80,131,80,1,46,243,155,27,209,68,122,175,74,169,249,93,155,195,226,196,192,154,159,86,15,45,17,205,2,97,126,191,2,28,230,31,236,222,146,232,93,17,16,154,223,185,163,42,78,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,131,45,79,18,189,43,2,66,243,59,183,33,197,137,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,127,176,79,72,162,119,69,64,104,126,231,222,157,56,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,15,54,215,72,244,174,8,8,205,239,220,240,18,39,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,254,193,142,20,137,222,21,1,161,249,157,187,68,226,196,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,31,173,119,69,64,104,126,205,26,102,254,94,12,168,249,35,236,209,75,68,179,0,152,159,80,128,107,229,95,29,35,151,220,213,81,186,242,87,172,113,43,255,78,12,236,202,159,86,15,45,17,205,2,177,242,247,43,96,96,254,170,180,214,53,70,123,243,70,122,175,74,95,185,161,42,195,84,60,100,29,178,69,144,41,70,132,249,171,210,91,246,177,203,69,75,68,179,96,168,65,168,0,151,249,61,239,31,134,233,189,45,55,8,204,31,248,78,32,83,12,172,249,105,245,208,18,209,44,16,230,247,43,192,97,126,223,75,123,65,122,63,151,27,248,230,15,125,145,142,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,223,155,110,65,122,63,151,27,248,230,15,125,251,140,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,223,235,97,65,122,63,151,27,248,230,15,125,101,139,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,223,59,85,65,122,63,151,27,248,230,15,125,207,137,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,223,139,72,65,122,63,151,27,248,230,15,125,57,136,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,254,104,189,159,203,13,124,243,59,235,29,113,98,64,205,31,97,143,94,34,154,5,192,252,132,2,92,43,127,179,174,33,90,114,183,229,6,193,202,223,85,239,136,19,3,187,242,167,213,67,75,68,179,64,172,252,253,10,48,205,175,146,4,91,93,67,167,32,110,189,171,95,61,229,6,221,145,37,68,197,35,214,182,113,71,138,33,55,191,186,217,87,246,113,200,69,75,68,179,96,168,65,168,0,151,249,141,186,134,76,239,77,185,65,98,126,71,189,35,82,12,172,249,105,245,208,18,209,44,16,230,247,43,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,71,235,189,45,55,8,204,239,170,119,68,138,1,53,127,132,61,122,137,104,22,0,243,19,10,112,173,252,141,186,134,108,201,221,148,27,36,43,127,71,189,35,82,12,236,202,159,86,15,45,17,205,2,177,242,247,43,192,52,191,90,37,218,234,26,122,13,234,214,187,250,213,83,110,208,237,75,67,84,60,98,109,27,119,164,24,114,243,171,155,125,101,31,135,92,180,68,52,11,134,26,132,10,112,153,223,168,107,200,244,
+222,148,27,36,230,119,212,59,34,197,192,154,159,86,15,45,17,205,2,97,126,191,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,127,180,222,219,114,131,192,252,174,122,71,164,24,80,243,71,216,163,151,136,102,1,48,63,161,0,215,202,223,168,107,200,150,220,77,185,65,178,242,119,212,59,34,197,192,174,252,105,245,208,18,209,44,16,43,127,191,2,76,243,171,101,130,173,174,161,23,33,110,189,171,95,61,229,6,125,214,71,136,138,71,172,109,227,142,20,67,110,126,117,179,175,236,227,144,139,150,136,102,193,80,131,80,1,46,243,27,117,13,153,222,155,114,131,196,252,142,122,71,164,24,88,243,211,234,161,37,162,89,32,204,239,87,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,143,214,123,91,110,16,152,223,85,239,136,20,3,106,254,8,123,244,18,209,44,0,230,39,20,224,90,249,27,117,13,217,146,187,41,55,72,86,254,142,122,71,164,24,216,149,63,173,30,90,34,154,5,98,229,239,87,128,105,126,21,39,108,117,13,29,133,220,122,87,191,122,202,13,250,96,204,16,21,143,88,219,198,29,41,134,220,252,234,102,95,217,199,33,23,45,17,205,130,161,6,161,2,92,230,55,234,26,50,189,55,229,6,137,249,29,245,142,72,49,176,230,167,213,67,75,68,179,64,152,223,175,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,39,20,224,48,191,89,215,16,233,189,45,55,8,204,239,170,119,68,138,1,53,127,128,122,104,137,104,22,0,243,19,10,112,152,223,172,107,136,244,222,150,27,4,230,119,213,59,34,197,128,154,63,64,61,180,68,52,11,128,249,9,5,56,204,31,173,247,182,220,32,48,191,171,222,17,41,6,212,252,17,246,232,37,162,89,0,204,79,40,192,181,242,55,234,26,178,37,119,83,110,144,172,252,29,245,142,72,49,176,43,127,90,61,180,68,52,11,196,202,223,175,0,211,252,202,81,216,234,26,218,13,185,245,174,79,81,115,151,27,234,211,200,2,84,60,98,109,27,119,164,24,114,243,171,155,125,101,31,135,92,180,68,52,11,134,26,132,10,112,153,223,168,107,200,244,222,148,27,36,230,119,212,59,34,197,192,154,159,86,15,45,17,205,2,97,126,191,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,126,179,174,33,210,123,91,110,16,152,223,85,239,136,20,3,106,254,0,245,208,18,209,44,0,230,
+39,20,224,48,127,180,222,219,114,131,192,252,174,122,71,164,24,80,243,71,216,163,151,136,102,1,48,63,161,0,215,202,223,168,107,200,150,220,77,185,65,178,242,119,212,59,34,197,192,174,252,105,245,208,18,209,44,16,43,127,191,2,76,243,43,46,182,186,134,102,238,214,187,250,213,83,110,80,191,6,169,120,196,218,54,238,72,49,228,230,87,55,251,202,62,14,185,104,137,104,22,12,53,8,21,224,50,191,81,215,144,233,189,41,55,72,204,239,168,119,68,138,129,53,63,173,30,90,34,154,5,194,252,126,5,56,204,111,214,53,68,122,111,203,13,2,243,187,234,29,145,98,64,205,31,160,30,90,34,154,5,192,252,132,2,28,230,55,235,26,34,189,183,229,6,129,249,93,245,142,72,49,160,230,15,80,15,45,17,205,2,96,126,66,1,14,243,155,117,13,145,222,219,114,131,192,252,174,122,71,164,24,80,243,7,168,135,150,136,102,1,48,63,161,0,135,249,205,186,134,72,239,109,185,65,96,126,87,189,35,82,12,168,249,3,212,67,75,68,179,0,152,159,80,128,195,252,102,93,67,164,247,182,220,32,48,191,171,222,17,41,6,212,252,1,234,161,37,162,89,0,204,79,40,192,97,254,104,189,183,229,6,129,249,93,245,142,72,49,160,230,143,176,71,47,17,205,2,96,126,66,1,174,149,191,81,215,144,45,185,155,114,131,100,229,239,168,119,68,138,129,93,249,211,234,161,37,162,89,32,86,254,126,5,12,58,122,87,29,243,213,254,67,223,67,90,9,226,105,165,93,29,109,108,21,129,186,147,116,117,12,235,154,61,100,109,109,101,29,39,70,68,71,239,234,56,182,77,128,122,104,137,104,22,12,53,8,21,48,232,236,117,83,189,45,247,229,238,84,94,60,234,170,211,101,113,253,172,147,229,234,217,63,213,231,231,230,231,179,68,205,39,83,166,134,82,47,206,247,55,159,234,47,62,213,180,139,195,125,121,92,85,91,165,107,37,215,234,116,42,239,174,119,101,177,42,212,64,54,91,253,189,50,135,34,244,176,35,132,123,124,214,112,94,152,88,99,157,61,62,111,254,156,75,44,179,138,104,232,108,81,98,253,78,116,182,12,156,121,53,55,131,136,221,255,238,14,155,7,117,221,122,181,91,155,146,159,254,85,30,15,122,118,84,165,150,103,91,153,114,60,174,142,223,255,252,127,94,253,244,99,47,202,223,247,171,227,135,98,253,182,92,255,90,220,40,167,172,111,47,14,55,197,155,63,216,168,158,222,86,9,168,110,247,41,168,170,52,60,1,85,149,221,37,160,170,146,134,120,170,6,217,253,118,167,168,42,32,58,168,254,240,253,107,55,81,117,179,149,230,161,34,201,254,248,139,159,114,77,98,74,92,125,223,56,116,43,93,69,181,39,249,83,89,61,168,59,212,244,41,190,62,28,118,229,74,119,106,84,33,249,84,154,138,109,9,54,115,160,42,125,4,27,25,21,215,119,91,53,25,213,141,19,43,53,196,26,232,235,147,60,0,196,26,196,235,254,144,0,98,13,208,117,215,1,17,177,126,89,164,22,103,30,173,253,252,253,119,63,140,233,233,91,138,139,79,159,93,126,126,169,194,199,88,188,150,96,235,52,112,4,91,127,129,35,216,186,10,28,193,214,75,224,8,182,14,34,130,96,71,113,117,125,242,88,249,171,175,127,30,211,83,55,28,118,15,85,89,60,174,118,15,229,68,194,134,158,107,122,72,233,185,102,136,148,158,107,146,72,233,53,22,214,239,124,96,232,53,6,214,155,9,164,244,58,130,159,250,92,223,171,239,198,228,246,229,109,179,252,24,11,246,169,207,235,49,233,56,29,30,147,142,211,215,49,233,184,204,199,165,227,50,91,8,157,142,208,191,255,187,199,98,223,255,240,205,79,77,218,60,38,248,166,248,247,226,153,41,80,77,199,101,49,46,29,151,197,184,116,92,22,227,210,113,89,140,75,199,101,177,0,58,189,229,125,83,236,219,87,110,66,159,14,5,250,212,55,197,184,116,92,6,227,210,113,25,140,75,199,101,48,46,29,151,193,2,232,244,150,191,80,121,165,50,213,165,202,117,27,187,89,34,213,183,223,142,201,181,139,205,55,207,20,2,222,60,191,44,110,31,86,199,213,190,42,245,2,170,171,93,21,215,31,84,126,166,47,220,238,111,139,221,234,120,91,30,139,234,195,253,96,65,106,10,208,24,220,18,218,114,9,208,32,197,18,11,115,9,208,64,195,18,236,146,
+11,160,207,60,236,48,48,135,9,90,1,230,195,64,43,192,124,24,104,5,152,15,3,250,0,132,14,3,115,104,160,21,160,193,192,140,2,204,135,129,86,128,249,48,160,187,33,206,42,128,126,47,191,3,225,140,2,52,32,156,81,128,6,132,51,10,208,172,119,102,20,32,43,8,205,236,133,92,18,253,252,247,175,221,18,124,26,169,130,79,3,150,68,217,4,112,185,194,108,2,184,64,144,94,0,98,73,148,77,128,249,48,64,44,137,178,9,48,31,6,136,37,81,54,1,92,75,162,108,2,204,135,1,98,73,148,94,0,98,73,148,94,0,98,73,148,77,0,215,146,40,155,0,174,37,81,54,1,92,75,162,108,2,100,5,97,39,193,191,5,44,137,254,250,247,215,110,9,254,45,82,5,255,22,176,36,202,38,128,203,21,102,19,192,5,130,244,2,16,75,162,108,2,204,135,1,98,73,148,77,128,249,48,64,44,137,178,9,224,90,18,101,19,96,62,12,16,75,162,244,2,16,75,162,244,2,16,75,162,108,2,184,150,68,217,4,112,45,137,178,9,224,90,18,101,19,32,43,8,61,15,206,44,91,70,232,58,85,192,190,111,69,179,219,148,29,196,211,205,173,27,226,122,245,112,42,79,197,15,223,191,110,246,74,248,159,200,137,30,9,138,71,230,225,9,28,153,115,27,77,194,145,121,120,2,71,230,220,208,147,112,100,30,158,192,145,57,183,22,37,28,153,135,39,112,100,206,77,78,9,71,230,225,137,24,217,32,85,200,228,65,104,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,108,144,66,103,154,103,52,79,224,200,34,118,241,136,71,230,225,9,28,89,86,223,72,243,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,136,145,181,165,165,136,77,104,252,145,209,60,129,35,139,216,221,38,30,153,135,39,112,100,17,219,230,196,35,243,240,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,136,145,13,170,222,153,108,70,243,4,142,172,241,83,121,71,230,225,9,28,89,227,167,242,142,204,195,19,56,178,198,79,229,29,153,135,39,112,100,89,125,35,205,19,56,178,172,190,145,230,137,24,153,110,236,29,183,111,156,63,50,154,39,112,100,17,27,210,197,35,243,240,4,142,44,98,167,187,120,100,30,158,192,145,69,108,161,23,143,204,195,19,56,178,136,189,249,226,145,121,120,2,71,150,213,55,210,60,133,35,243,188,206,96,105,150,64,239,30,12,105,80,246,112,205,120,80,173,120,186,185,5,25,237,211,128,135,198,41,71,230,225,9,28,153,171,248,151,114,100,30,158,192,145,185,18,220,148,35,243,240,4,142,204,181,136,75,57,50,15,79,224,200,92,142,42,229,200,60,60,17,35,35,30,26,39,25,25,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,136,145,17,15,141,147,140,140,230,9,28,89,196,187,149,226,145,121,120,2,71,150,213,55,210,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,98,100,196,67,227,36,35,163,121,2,71,22,241,206,177,120,100,30,158,192,145,69,188,204,44,30,153,135,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,68,140,140,120,104,156,100,100,52,79,224,200,92,15,141,83,142,204,195,19,56,50,215,67,227,148,35,243,240,4,142,204,245,208,56,229,200,60,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,196,200,136,135,198,73,70,70,243,4,142,44,162,77,136,120,100,30,158,192,145,69,244,31,17,143,204,195,19,56,178,136,198,38,226,145,121,120,2,71,22,209,49,69,60,50,15,79,224,200,178,250,70,154,167,112,100,158,38,51,211,135,198,1,239,116,7,12,237,238,97,199,120,80,173,120,186,185,5,25,237,223,2,30,26,167,28,153,135,39,112,100,174,226,95,202,145,121,120,2,71,230,74,112,83,142,204,195,19,56,50,215,34,46,229,200,60,60,129,35,115,57,170,148,35,243,240,68,140,140,120,104,156,100,100,52,79,224,200,178,250,70,154,39,112,100,89,125,35,205,19,56,178,172,190,145,230,9,28,89,86,223,72,243,4,
+142,44,171,111,164,121,34,70,70,60,52,78,50,50,154,39,112,100,17,29,239,196,35,243,240,4,142,44,171,111,164,121,2,71,150,213,55,210,60,129,35,203,234,27,105,158,192,145,101,245,141,52,79,196,200,136,135,198,73,70,70,243,4,142,44,162,19,164,120,100,30,158,192,145,69,180,152,20,143,204,195,19,56,178,172,190,145,230,9,28,89,86,223,72,243,4,142,44,171,111,164,121,34,70,70,60,52,78,50,50,154,39,112,100,174,135,198,41,71,230,225,9,28,153,235,161,113,202,145,121,120,2,71,230,122,104,156,114,100,30,158,192,145,101,245,141,52,79,224,200,178,250,70,154,39,98,100,196,67,227,36,35,163,121,2,71,22,209,188,89,60,50,15,79,224,200,34,186,66,139,71,230,225,9,28,89,68,187,105,241,200,60,60,129,35,139,232,99,45,30,153,135,39,112,100,89,125,35,205,83,56,178,250,182,213,126,211,54,167,172,142,245,116,174,142,250,241,65,117,180,188,44,174,190,236,56,125,115,216,175,87,85,185,87,255,47,94,191,250,127,127,41,52,161,159,190,255,238,47,191,40,210,19,194,219,118,50,185,232,234,194,149,159,116,125,209,109,113,44,239,213,205,234,178,238,128,237,51,207,78,125,159,77,30,129,91,78,38,254,254,141,219,80,159,133,26,106,202,201,114,118,113,34,78,150,211,168,33,156,54,219,71,198,86,2,197,211,205,45,104,90,125,54,121,172,159,195,90,174,160,149,138,83,94,107,121,120,2,173,229,74,29,240,58,116,5,226,84,156,242,90,203,195,19,104,45,87,58,132,215,161,107,113,145,138,83,94,107,121,120,2,173,229,90,198,224,117,232,74,38,83,234,208,195,19,168,67,215,130,41,229,200,60,60,17,35,27,108,94,73,58,151,7,156,146,226,144,216,144,147,196,90,52,79,160,181,50,172,106,6,156,114,88,203,181,201,40,165,181,60,60,129,214,202,176,170,25,112,202,97,173,54,247,202,106,45,15,79,160,181,50,172,106,6,156,114,88,171,225,148,215,90,30,158,64,107,101,88,213,16,219,206,82,234,48,241,170,134,216,118,150,114,100,137,87,53,131,109,103,73,231,242,128,83,82,28,18,91,233,146,88,139,230,9,180,86,134,85,205,128,83,14,107,185,182,7,166,180,150,135,39,208,90,25,86,53,3,78,57,172,229,218,242,152,210,90,30,158,64,107,101,88,213,12,56,229,176,86,195,41,175,181,60,60,129,214,202,176,170,33,54,140,166,212,97,226,85,13,177,97,52,229,200,18,175,106,6,27,70,147,206,229,1,167,164,56,36,54,193,38,177,22,205,19,104,173,12,171,154,1,167,28,214,114,109,236,77,105,45,15,79,160,181,50,172,106,6,156,114,88,203,181,89,57,165,181,60,60,129,214,202,176,170,25,112,202,97,45,215,6,236,148,214,242,240,4,90,43,195,170,134,216,234,157,82,135,137,87,53,196,86,239,148,35,75,188,170,25,108,245,78,138,14,98,83,121,18,29,210,60,129,58,204,176,2,32,182,175,167,212,161,135,39,80,135,25,226,50,177,81,62,165,14,61,60,129,58,204,16,45,137,45,249,41,117,232,225,9,212,97,134,104,73,108,254,79,169,195,196,209,146,216,252,159,114,100,137,163,37,177,249,63,201,200,104,158,192,145,165,141,97,246,145,121,120,2,71,150,54,178,216,71,230,225,9,28,89,90,127,111,31,153,135,39,112,100,105,189,176,125,100,30,158,192,145,101,245,141,52,79,225,200,58,134,127,12,233,82,247,163,231,116,186,63,90,135,166,198,177,221,148,197,245,135,226,95,229,241,96,190,81,113,216,112,250,227,253,248,173,155,231,144,135,215,128,127,12,216,146,157,126,148,30,206,240,81,186,182,50,167,31,165,135,51,124,148,174,45,192,233,71,233,225,12,31,165,243,45,211,228,163,244,112,134,143,210,249,86,85,242,81,122,56,227,70,57,216,232,154,21,177,52,103,248,40,157,157,239,146,143,210,195,25,62,74,215,198,202,244,163,244,112,134,143,210,181,33,49,253,40,61,156,225,163,156,193,199,210,156,225,163,156,193,199,210,156,113,163,28,108,187,203,234,99,105,206,240,81,206,224,99,105,206,240,81,58,187,233,37,31,165,135,51,124,148,174,237,81,233,71,233,225,12,31,229,12,62,150,230,12,31,229,12,62,150,230,140,27,229,96,19,80,86,31,75,115,134,143,114,6,31,75,115,134,143,114,6,31,75,115,134,143,210,217,
+161,47,249,40,61,156,225,163,156,193,199,210,156,225,163,156,193,199,210,156,113,163,164,186,248,165,27,37,205,25,62,74,103,71,191,228,163,244,112,134,143,210,217,221,47,249,40,61,156,225,163,116,118,250,75,62,74,15,103,248,40,103,240,177,52,103,248,40,103,240,177,52,103,220,40,169,110,128,233,70,73,115,134,143,210,217,25,48,249,40,61,156,225,163,116,118,9,76,62,74,15,103,248,40,157,29,3,147,143,210,195,25,62,74,103,247,192,228,163,244,112,134,143,114,6,31,75,115,142,26,101,199,118,181,223,212,143,216,182,205,130,114,91,63,20,222,142,3,215,87,63,88,217,169,175,21,67,83,107,103,114,254,253,2,92,114,196,67,35,46,57,162,114,200,37,71,164,143,36,185,142,94,251,180,211,111,138,31,127,178,81,251,241,167,145,108,65,251,54,88,180,8,35,176,104,17,22,96,209,34,212,79,208,234,136,189,15,210,254,63,236,228,254,49,145,237,125,144,1,184,228,8,27,112,201,17,102,224,146,35,44,65,146,235,232,125,249,101,128,238,94,255,252,23,183,243,253,242,203,218,19,30,87,219,83,105,236,228,122,168,116,3,212,227,106,127,91,22,167,114,125,216,111,138,195,125,169,62,111,12,79,188,59,189,101,236,125,82,98,120,4,240,112,244,70,159,129,6,92,27,146,50,107,192,35,70,106,13,184,54,43,101,214,128,71,140,212,26,112,109,100,202,172,1,143,24,201,52,64,244,158,203,165,1,90,140,212,26,112,185,253,204,26,240,136,145,90,3,174,13,53,153,53,224,17,35,181,6,92,155,109,50,107,192,35,70,50,13,16,221,154,114,105,128,22,35,181,6,92,29,144,50,107,192,35,70,106,13,184,86,172,153,53,224,17,35,181,6,92,27,66,50,107,192,35,70,50,13,16,253,77,114,105,128,22,35,181,6,92,61,67,50,107,192,35,70,106,13,184,250,112,100,214,128,71,140,212,26,112,37,219,153,53,224,17,3,168,129,78,136,151,47,3,50,243,159,124,42,120,249,82,174,130,35,171,64,240,147,93,5,173,0,82,16,12,52,224,202,204,51,107,192,35,70,106,13,184,50,243,204,26,240,136,145,90,3,174,204,60,179,6,60,98,36,211,0,145,153,231,210,0,45,70,106,13,184,50,243,204,26,240,136,145,90,3,174,204,60,179,6,60,98,164,214,128,43,51,207,172,1,143,24,201,52,64,100,230,185,52,64,139,145,90,3,174,204,60,179,6,60,98,164,214,128,43,51,207,172,1,143,24,169,53,224,202,204,51,107,192,35,70,50,13,16,153,121,46,13,208,98,164,214,128,43,51,207,172,1,143,24,169,53,224,202,204,51,107,192,35,70,106,13,184,50,243,204,26,240,136,1,212,64,95,35,9,216,203,241,250,23,107,105,98,180,183,225,203,201,81,175,81,148,14,219,141,166,164,254,137,165,52,44,59,0,40,181,233,59,128,82,155,6,3,40,181,233,36,128,82,179,95,16,65,169,217,147,23,135,167,65,175,7,0,37,128,237,6,169,11,130,18,192,118,131,119,239,17,148,0,182,27,190,67,14,160,4,176,221,96,185,137,160,4,176,221,224,157,94,4,37,128,237,134,239,166,2,40,1,108,55,88,34,32,40,1,108,55,120,87,16,65,9,96,187,193,59,111,8,74,0,219,13,222,221,66,80,2,216,110,240,14,18,130,18,192,118,131,119,105,16,148,0,182,27,188,19,130,160,4,176,221,224,221,6,4,37,153,237,122,82,47,66,214,209,175,172,180,94,140,197,122,17,178,146,230,208,162,214,210,28,90,212,106,90,64,203,137,81,1,45,39,74,5,180,156,56,21,208,114,34,85,64,203,137,85,22,190,136,149,181,128,22,196,142,212,234,90,64,11,98,71,106,133,45,160,5,177,35,181,202,22,208,130,216,145,90,105,11,104,65,236,72,173,182,5,180,32,118,164,86,220,2,90,16,59,82,171,110,1,45,136,29,169,149,183,128,22,196,142,212,234,91,64,11,98,71,106,5,46,160,5,177,35,181,10,23,208,130,216,145,90,137,11,104,65,236,72,173,198,5,180,32,118,164,86,228,2,90,66,59,246,229,253,128,53,249,119,214,245,253,203,145,88,47,3,86,228,12,74,196,122,156,65,137,88,141,243,41,185,48,202,167,228,66,40,159,146,11,159,124,74,46,116,242,41,185,176,201,193,147,127,5,206,167,4,176,29,177,250,230,83,2,216,142,88,121,243,41,1,108,71,172,186,249,
+148,0,182,35,86,220,124,74,0,219,17,171,109,62,37,128,237,136,149,54,159,18,192,118,196,42,155,79,9,96,59,98,133,205,167,4,176,29,177,186,230,83,2,216,142,88,89,243,41,1,108,71,172,170,249,148,0,182,35,86,212,124,74,0,219,17,171,105,62,37,128,237,136,149,52,159,146,204,118,61,169,144,218,246,119,214,53,249,203,241,250,254,101,72,109,155,69,139,90,75,115,104,81,171,105,1,45,39,70,5,180,156,40,21,208,114,226,84,64,203,137,84,1,45,39,86,89,248,34,86,214,2,90,16,59,82,171,107,1,45,136,29,169,21,182,128,22,196,142,212,42,91,64,11,98,71,106,165,45,160,5,177,35,181,218,22,208,130,216,145,90,113,11,104,65,236,72,173,186,5,180,32,118,164,86,222,2,90,16,59,82,171,111,1,45,136,29,169,21,184,128,22,196,142,212,42,92,64,11,98,71,106,37,46,160,5,177,35,181,26,23,208,130,216,145,90,145,11,104,9,237,216,17,123,17,178,40,127,245,159,54,98,47,198,130,189,8,89,148,179,104,17,139,114,22,45,98,81,46,161,229,2,171,132,150,11,172,18,90,46,176,74,104,185,192,42,161,229,2,43,15,95,254,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,66,59,118,196,62,9,89,148,255,96,93,225,127,50,22,236,147,144,69,57,139,22,177,40,103,209,34,22,229,18,90,46,176,74,104,185,192,42,161,229,2,171,132,150,11,172,18,90,46,176,242,240,229,95,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,5,177,35,177,40,151,208,130,216,145,88,148,75,104,65,236,72,44,202,37,180,32,118,36,22,229,18,90,16,59,18,139,114,9,45,136,29,137,69,185,132,22,196,142,196,162,92,66,11,98,71,98,81,46,161,37,180,99,71,108,125,119,63,93,149,79,218,46,126,243,215,191,77,200,125,250,236,179,207,63,123,86,108,111,234,237,229,159,189,120,241,217,120,151,77,75,123,184,74,199,210,30,174,218,177,180,137,134,172,8,218,174,86,167,8,218,174,38,162,8,218,174,246,156,8,218,237,236,72,66,187,157,45,96,124,15,178,132,36,180,147,224,100,152,69,36,161,157,4,39,195,44,35,9,237,36,56,25,102,33,73,104,39,193,201,48,75,73,66,59,9,78,134,89,76,18,218,73,112,50,204,114,146,208,78,130,147,97,22,148,132,118,18,156,12,179,164,36,180,147,224,100,152,69,37,161,157,4,39,195,44,43,9,237,36,56,25,102,97,73,104,39,193,201,48,75,75,66,59,9,78,134,89,92,18,218,73,112,50,204,242,146,208,198,224,164,35,126,93,86,239,202,114,127,113,253,231,213,254,195,213,179,203,221,161,253,227,237,182,249,195,154,98,126,253,234,151,255,253,234,213,15,61,195,175,207,132,138,215,63,234,83,109,139,191,124,95,108,247,235,221,195,105,251,56,232,44,218,94,118,117,250,160,238,172,142,219,117,199,89,13,177,253,227,57,205,185,187,221,38,130,26,172,22,225,205,243,226,226,112,44,30,183,235,178,120,44,143,167,213,19,187,72,143,42,133,188,120,252,243,99,147,73,234,127,198,170,253,241,135,55,175,126,50,222,9,249,102,117,170,138,55,95,189,254,251,171,162,58,212,247,91,232,53,9,53,142,92,61,135,97,228,154,105,11,35,215,204,84,24,185,102,114,194,200,53,243,17,70,174,153,130,48,114,96,220,53,197,22,57,185,126,170,110,171,126,90,76,103,34,65,78,221,48,152,247,53,49,215,163,95,17,45,71,233,81,66,203,85,122,148,208,114,149,30,37,180,92,165,71,9,45,87,233,81,66,203,85,122,148,208,66,226,203,181,29,32,140,86,79,172,42,13,228,79,67,45,65,173,26,70,188,154,152,179,188,42,161,229,90,206,9,104,57,151,111,2,90,206,229,154,128,150,115,121,38,160,229,92,142,9,104,57,151,95,2,90,72,124,57,75,236,65,
+180,58,98,10,14,61,242,167,103,175,16,212,212,13,166,100,13,177,6,249,32,90,142,147,145,36,180,92,103,12,73,104,185,78,235,145,208,114,157,123,35,161,213,32,31,67,171,65,62,134,22,18,95,13,242,165,180,58,98,202,132,61,242,167,167,141,16,212,212,13,166,100,13,177,6,249,32,90,142,179,128,36,180,92,167,234,72,104,185,206,167,145,208,114,157,244,34,161,213,32,31,67,171,65,62,134,22,18,95,13,242,165,180,250,243,56,247,183,61,242,167,231,107,16,212,212,13,166,100,13,177,6,249,32,90,142,211,111,36,180,92,231,200,72,104,185,78,100,145,208,114,157,109,34,161,213,32,31,67,171,65,62,134,22,18,95,13,242,165,180,58,98,74,85,61,242,213,7,30,53,117,131,41,89,67,172,65,62,136,86,141,124,12,173,6,249,24,90,13,242,49,180,26,228,99,104,53,200,199,208,106,144,143,161,133,196,87,131,124,41,173,142,152,26,94,143,124,245,129,71,77,221,96,74,214,16,107,144,15,162,85,35,31,67,171,65,62,134,86,131,124,12,173,6,249,24,90,13,242,49,180,26,228,99,104,33,241,213,32,95,74,171,35,54,40,246,179,139,164,163,146,171,89,233,7,209,170,145,143,161,213,32,31,67,171,65,62,134,86,131,124,12,173,6,249,24,90,13,242,49,180,144,248,106,144,47,165,213,167,203,213,81,17,91,237,63,232,116,185,58,50,211,229,234,56,32,118,183,221,95,116,79,236,10,227,145,93,253,111,79,251,171,215,223,168,75,39,79,38,213,119,250,88,190,238,73,157,57,104,245,219,213,254,112,181,223,238,24,28,218,59,72,70,151,197,246,118,127,56,110,247,183,133,186,188,57,247,239,52,224,190,122,31,204,118,245,126,202,111,245,222,61,176,213,123,238,192,186,59,72,70,206,129,233,27,245,37,247,181,249,239,107,44,221,187,204,175,127,112,32,224,190,65,64,151,130,222,84,111,203,125,185,59,149,23,215,245,30,226,170,29,209,77,59,30,203,112,78,239,182,213,250,173,46,207,119,60,190,191,105,57,108,79,69,117,124,40,139,99,51,188,191,126,255,237,183,175,95,21,154,126,241,211,247,223,253,229,23,115,40,187,114,127,91,189,189,56,217,51,96,245,101,115,65,207,229,117,253,89,235,235,231,95,126,250,254,135,239,52,177,187,195,230,97,87,22,171,219,219,163,89,83,122,184,211,227,89,85,255,87,187,226,127,78,107,170,95,127,245,139,186,198,84,210,110,253,176,91,85,13,165,242,86,255,165,46,208,188,190,126,106,28,106,57,34,124,169,140,116,181,189,185,42,239,238,171,15,246,167,3,40,78,167,230,111,229,14,34,135,83,40,243,189,45,214,202,2,219,141,254,126,183,61,85,129,140,193,195,117,73,226,49,227,168,64,152,208,140,137,56,13,205,24,193,4,108,198,4,146,120,204,56,154,235,9,205,152,136,211,208,140,17,76,192,102,76,32,137,199,140,163,210,77,66,51,38,226,52,52,99,4,19,176,25,19,72,226,49,227,40,27,75,104,198,68,156,134,102,140,96,2,54,99,2,73,108,162,40,223,157,38,54,106,194,121,98,99,205,105,142,216,56,102,60,99,108,108,205,136,143,88,46,51,38,226,52,71,108,12,49,99,166,216,216,154,17,31,177,92,102,76,196,105,142,216,24,98,198,76,177,177,53,35,62,98,185,204,152,136,211,28,177,49,196,140,153,98,163,154,244,105,156,170,38,156,199,169,214,156,230,112,170,99,198,51,58,213,214,140,120,87,231,50,99,34,78,115,56,213,16,51,102,114,170,173,25,241,174,206,101,198,68,156,230,112,170,33,102,204,228,84,21,90,210,204,70,77,56,207,108,172,57,205,49,27,199,140,103,156,141,173,25,241,115,196,101,198,68,156,230,152,141,33,102,204,52,27,111,118,181,83,29,237,38,1,40,87,19,182,141,43,17,167,161,25,35,152,48,204,56,102,12,30,174,192,140,248,57,226,50,99,34,78,115,204,198,16,51,102,154,141,138,77,26,51,106,194,121,204,88,115,154,195,140,99,198,185,205,120,127,60,108,200,231,198,250,34,63,63,125,197,195,186,154,168,120,76,62,236,113,42,144,31,245,12,153,199,138,50,172,143,125,138,161,75,204,59,45,237,166,53,111,82,126,84,253,124,94,243,166,146,199,103,222,105,117,34,173,121,147,242,163,74,64,243,154,55,149,60,62,243,78,243,164,180,230,77,202,143,74,70,231,53,111,
+42,121,124,230,157,134,250,180,230,77,202,143,90,79,205,107,222,84,242,88,5,114,62,175,198,168,59,252,169,53,144,223,124,177,87,246,4,59,189,121,83,197,194,240,167,217,201,204,155,51,246,202,158,108,167,55,111,170,88,24,254,148,59,153,121,115,198,94,217,19,239,244,230,77,21,11,195,159,126,39,51,111,206,216,43,123,18,158,208,188,206,231,225,24,117,135,63,21,7,242,155,207,57,203,158,144,167,55,111,42,103,25,254,180,60,153,121,115,58,103,217,147,243,244,230,77,229,44,195,159,162,39,51,111,78,231,44,123,162,158,208,188,206,231,234,24,117,135,63,93,7,242,155,111,246,202,158,180,167,55,111,170,217,20,254,212,61,153,121,115,206,94,217,19,248,132,230,117,62,135,199,168,59,252,105,60,144,31,245,76,62,157,121,101,79,230,211,155,55,213,108,10,127,74,159,204,188,57,103,175,236,137,125,66,243,58,159,219,99,212,29,254,244,30,200,111,62,243,202,158,228,131,204,59,252,95,251,134,184,18,229,244,219,238,139,243,199,250,111,163,169,194,234,88,93,60,169,27,138,20,157,80,63,255,231,235,147,250,119,123,48,58,31,252,92,191,252,94,191,73,127,60,172,245,175,251,91,125,161,38,81,149,250,154,65,31,130,154,240,243,150,178,133,240,115,130,242,253,177,84,23,220,111,119,229,70,139,236,224,178,221,111,43,11,15,253,245,171,253,227,246,120,216,235,91,140,215,245,213,15,219,213,110,251,175,178,168,222,150,69,217,95,83,220,28,142,197,95,191,122,61,104,120,240,184,86,196,205,52,86,209,86,95,246,244,190,43,171,154,208,221,195,174,218,234,38,237,106,100,202,48,213,106,119,184,45,214,135,125,85,190,175,158,22,31,255,80,150,27,53,14,205,98,125,56,170,145,85,253,120,138,77,121,95,238,55,229,126,189,45,79,31,95,108,107,11,61,125,184,215,150,189,44,78,111,15,15,187,77,113,173,160,112,163,100,170,127,187,222,238,55,106,228,154,254,250,65,81,83,52,202,247,229,250,161,82,204,159,104,249,31,246,167,213,141,130,76,59,140,234,184,82,95,172,245,207,23,79,204,161,24,63,152,230,208,150,43,86,251,98,245,80,29,244,183,219,202,36,49,104,237,95,255,58,36,218,124,215,147,251,229,184,189,189,85,146,107,53,181,212,14,247,229,113,165,105,213,26,89,105,181,23,215,187,195,250,87,147,246,234,250,112,28,145,174,191,178,83,174,127,242,19,238,40,151,143,171,221,197,250,110,83,183,95,176,32,255,108,25,99,66,54,72,172,91,85,52,170,86,127,23,26,167,205,132,234,173,105,120,5,147,205,101,113,120,168,238,31,170,218,1,128,89,22,23,250,154,195,189,30,247,106,247,161,56,149,250,99,205,174,80,154,208,218,105,63,41,65,202,213,221,147,225,4,90,239,30,54,229,197,205,126,117,87,58,20,210,94,67,202,54,152,165,103,214,55,234,66,147,161,214,202,87,187,219,242,250,184,50,148,163,132,191,83,147,178,87,79,199,255,167,175,184,202,249,211,177,220,173,26,101,20,171,134,211,159,6,6,234,100,81,174,85,121,206,242,120,161,92,99,35,72,167,134,75,245,227,238,234,84,221,85,205,167,211,246,182,209,142,233,13,12,217,158,79,133,211,163,55,68,49,236,85,147,190,83,145,64,203,127,22,162,80,19,99,117,42,238,212,165,55,15,251,122,170,93,22,74,176,167,181,76,23,74,128,253,170,122,56,150,79,204,78,34,55,187,135,211,219,43,229,108,46,138,113,211,124,101,184,238,215,94,184,250,171,90,52,237,161,246,135,119,131,41,119,58,149,106,206,53,253,80,238,78,183,61,30,6,179,176,190,202,244,129,123,61,235,180,53,148,49,214,101,13,196,226,221,219,114,95,92,191,120,161,155,162,24,147,162,99,161,143,161,34,88,124,191,15,228,242,201,139,207,109,44,244,9,70,4,139,215,251,91,14,139,62,186,149,213,155,213,113,187,186,222,149,23,42,32,212,163,41,30,87,199,30,62,117,3,155,166,135,76,49,68,141,113,175,225,116,219,64,82,223,166,131,188,130,115,19,40,53,217,250,98,147,255,45,193,191,24,183,175,185,181,49,253,46,140,233,40,156,40,224,232,73,125,161,255,227,242,26,74,166,171,246,186,158,221,171,189,166,248,217,102,123,210,255,22,167,213,163,14,244,90,128,161,63,83,193,102,61,108,106,180,87,97,244,170,150,242,162,56,245,
+58,62,149,191,61,168,184,121,30,177,89,210,208,2,244,119,245,50,180,237,121,52,83,253,115,63,244,90,140,150,222,160,61,121,189,122,122,58,149,160,121,202,81,29,255,57,150,163,232,179,244,129,56,234,91,140,72,202,150,124,101,116,55,89,25,159,215,17,78,222,35,12,40,178,245,194,209,37,192,101,179,254,211,82,88,100,105,239,190,82,119,152,210,212,95,14,56,55,11,221,70,168,250,215,65,36,209,43,106,189,22,218,110,222,247,147,224,180,126,91,222,173,26,25,42,141,179,230,79,117,89,249,190,249,115,181,214,107,204,186,35,92,99,169,122,166,140,108,165,174,191,82,116,181,205,222,29,87,247,95,24,7,53,116,191,164,102,106,156,13,164,87,124,90,49,127,106,56,61,173,153,60,173,233,255,169,80,249,67,163,168,134,73,241,171,250,254,207,31,127,244,121,241,169,66,239,169,108,36,250,248,163,103,234,243,118,175,189,222,233,227,143,158,171,15,205,26,243,4,214,233,197,195,118,99,164,63,15,202,122,230,136,159,100,211,115,148,32,191,75,221,95,170,249,169,166,213,254,216,124,216,31,175,244,231,249,160,14,145,231,255,119,150,88,202,4,73,38,227,156,22,35,85,177,62,236,30,238,246,99,93,20,4,30,167,170,79,200,136,212,95,67,122,97,10,228,67,6,168,84,25,243,223,163,162,61,179,54,27,136,35,101,96,169,93,83,222,54,137,216,239,192,0,51,78,130,4,114,229,156,31,231,138,198,166,220,85,171,11,61,198,94,192,255,80,57,214,112,0,197,112,4,250,2,69,216,252,162,120,242,241,71,31,13,190,232,198,248,237,171,215,191,124,165,126,153,244,164,109,134,163,83,190,102,52,181,44,127,58,21,171,251,251,221,182,220,60,29,180,163,61,30,254,187,92,87,173,184,167,114,167,62,152,2,2,6,80,120,196,111,217,71,13,225,244,112,61,214,118,43,187,250,117,32,171,75,244,230,115,39,184,254,216,137,173,63,12,101,86,252,38,242,118,85,59,45,177,202,59,27,69,150,45,14,158,2,144,225,85,163,250,229,249,162,96,16,98,244,231,11,176,186,215,202,207,99,204,220,14,114,34,222,224,195,145,144,68,57,164,93,121,83,77,102,201,107,221,18,250,84,149,247,77,181,75,95,163,139,227,229,177,248,239,195,118,175,160,92,158,249,215,222,110,187,223,183,63,21,23,187,203,227,147,226,240,216,62,111,168,239,220,238,235,170,250,118,83,22,23,74,218,39,127,232,71,161,235,109,205,227,160,139,181,50,193,190,82,202,172,211,30,75,93,166,189,112,162,52,205,71,249,199,85,237,66,207,15,151,20,51,69,236,102,171,228,104,158,113,52,228,7,79,119,149,217,203,65,28,233,139,52,85,255,231,186,255,83,207,96,221,88,125,80,167,212,210,53,148,70,193,224,171,250,75,253,188,174,121,166,83,99,175,38,252,180,166,89,92,220,31,78,167,237,245,238,67,87,216,175,175,62,150,247,187,213,186,108,53,171,195,192,25,14,198,205,79,139,102,244,167,190,8,180,127,184,187,110,135,123,56,110,212,95,221,19,179,114,48,236,38,154,48,134,125,220,110,234,113,95,234,91,237,10,104,104,142,20,240,247,250,203,190,116,122,58,87,204,166,186,224,13,199,246,244,110,189,43,87,199,171,58,130,94,216,70,52,218,203,165,133,54,110,25,73,254,141,254,165,22,181,106,106,176,181,140,141,188,166,42,21,92,47,10,175,34,159,24,46,127,240,76,113,187,177,204,254,86,49,181,115,106,213,182,85,152,120,184,87,50,244,136,62,233,218,253,97,189,93,105,207,208,93,107,149,52,92,208,128,197,106,208,32,58,81,78,154,105,59,162,167,22,131,41,151,86,210,48,188,182,227,173,185,121,100,181,111,235,47,149,26,143,135,119,197,205,241,112,167,254,108,22,96,225,232,106,231,202,180,142,251,176,171,126,46,171,139,234,122,215,174,40,171,234,216,74,123,223,202,186,43,247,231,5,233,74,45,66,235,63,203,245,110,117,94,120,234,200,208,156,203,160,149,58,24,143,190,67,97,177,158,38,163,81,253,77,249,131,213,177,60,143,165,149,69,63,30,169,165,175,231,83,237,219,244,144,247,213,167,106,20,244,16,140,170,124,61,16,227,179,30,142,241,81,15,202,216,12,91,143,172,255,172,237,91,251,134,167,79,159,218,198,165,44,113,213,112,142,31,85,230,65,157,215,23,255,116,12,173,241,27,145,131,219,234,
+121,112,179,210,191,126,243,243,27,253,235,221,170,178,12,180,124,127,127,80,179,179,113,111,198,211,215,155,243,131,87,45,114,121,127,126,36,187,238,254,254,77,133,237,230,175,253,195,110,119,60,127,157,19,3,173,236,26,10,108,53,125,243,227,223,254,171,248,254,135,95,126,108,31,202,43,213,252,238,52,67,1,201,28,1,68,67,83,79,171,156,208,177,220,252,82,235,168,232,31,126,90,132,57,95,75,136,115,190,172,145,235,15,95,20,83,166,213,55,181,235,191,56,182,222,207,112,234,134,167,255,112,95,246,159,54,219,219,109,117,26,249,208,241,3,123,139,148,77,144,105,107,4,19,65,142,135,251,111,221,26,152,62,144,213,55,248,245,160,175,8,83,194,152,247,73,49,63,54,49,53,144,245,201,198,187,82,255,223,143,248,159,106,1,76,206,87,122,131,132,90,154,221,30,87,155,242,234,160,50,162,207,159,253,63,23,237,10,123,248,222,209,223,255,246,93,119,135,17,80,107,94,122,119,74,187,211,162,95,132,108,138,235,15,234,147,178,101,191,103,75,95,249,99,195,165,104,185,14,118,65,41,120,170,152,109,21,170,15,254,55,150,211,94,148,116,198,205,198,50,173,254,114,40,225,166,60,173,143,219,235,70,192,27,129,124,143,219,242,157,71,190,71,175,124,250,102,171,124,250,7,129,108,86,103,247,227,121,251,214,133,109,110,180,238,164,219,227,53,194,207,171,250,231,179,39,209,57,102,93,169,250,204,216,186,86,168,53,210,113,219,2,106,36,193,234,230,166,206,72,127,58,188,59,245,107,55,133,233,233,169,190,117,98,212,94,174,189,255,24,201,141,160,205,3,253,102,53,166,147,205,246,6,189,134,59,105,53,153,143,221,181,92,31,108,107,255,195,253,135,43,189,224,187,40,42,125,232,209,101,241,241,71,189,207,239,254,58,117,127,237,79,147,125,76,205,16,46,149,12,55,202,189,54,127,235,45,113,229,166,25,226,117,121,170,154,191,110,222,181,24,189,24,186,246,193,192,183,119,78,167,254,125,253,83,231,211,235,133,234,117,227,188,139,83,191,158,255,248,163,219,237,99,185,111,87,255,117,73,162,172,109,122,80,9,192,133,250,251,51,61,50,157,10,125,52,49,82,147,216,234,65,212,49,199,39,104,155,186,234,253,27,35,57,127,121,187,61,233,243,154,116,242,185,62,60,236,171,227,135,79,206,187,103,187,13,62,117,185,226,226,125,93,136,121,110,20,181,159,255,115,220,132,171,190,114,106,187,70,81,173,99,182,231,0,157,149,148,240,197,19,223,96,174,183,123,174,230,207,155,239,148,78,107,62,131,125,99,255,42,143,135,171,195,241,234,176,47,71,21,181,103,255,156,156,228,101,92,220,179,220,222,232,251,234,61,174,43,149,204,171,25,172,230,152,206,248,247,231,253,68,221,246,146,237,233,105,241,253,126,173,171,24,106,34,220,29,84,160,61,174,182,167,209,62,171,250,168,172,246,158,253,182,62,244,112,187,223,109,247,134,11,212,27,113,78,15,215,3,225,175,77,209,47,139,219,123,179,76,116,123,94,212,52,31,155,163,200,206,77,183,250,219,20,210,46,110,47,203,203,183,234,235,23,197,237,241,240,112,255,180,254,239,197,237,253,19,245,227,157,254,90,111,197,126,170,79,87,123,171,191,90,127,174,191,83,161,124,253,116,123,210,39,162,221,53,223,62,235,190,222,31,170,139,245,231,245,183,253,151,47,47,238,46,159,213,46,165,254,190,255,65,25,69,93,253,236,114,253,76,255,162,7,218,110,99,83,23,93,22,127,120,254,236,243,207,63,255,196,24,248,159,213,109,199,205,118,175,242,232,234,131,114,194,135,102,159,97,179,188,80,41,190,242,65,199,118,43,151,250,179,246,60,127,208,148,91,5,27,148,180,8,215,95,124,172,43,58,83,253,26,144,89,237,118,52,84,244,198,186,221,46,47,74,172,48,169,165,253,31,108,132,98,163,48,193,161,116,55,2,133,250,198,64,130,146,254,234,97,191,253,237,161,159,126,231,66,236,214,88,117,247,151,21,61,32,84,76,94,255,90,108,111,218,114,202,118,87,156,148,231,210,11,7,229,140,175,139,205,161,60,237,255,84,21,111,87,143,101,209,222,92,95,213,158,7,88,24,98,156,107,139,199,211,197,217,119,214,185,139,245,207,39,230,78,200,191,109,239,203,111,154,77,250,230,97,149,103,122,109,209,239,52,220,124,222,179,107,202,127,102,189,245,120,
+251,83,185,62,28,55,23,79,6,39,83,234,217,112,254,201,216,117,169,97,95,29,148,28,111,207,219,226,149,126,245,86,72,99,195,221,148,244,234,156,137,162,88,244,177,238,183,221,213,121,191,167,26,116,175,180,126,203,170,121,133,117,3,97,19,120,234,24,63,222,66,58,120,250,186,121,184,187,191,90,175,20,12,148,209,234,101,143,97,174,58,24,27,239,123,119,252,251,187,140,124,65,125,215,22,93,247,149,254,166,173,193,214,68,139,250,226,9,99,101,195,43,189,207,84,35,230,88,190,59,110,171,50,152,125,119,175,69,132,14,27,69,75,181,222,205,186,61,85,219,245,116,244,245,246,86,37,192,199,31,149,106,25,100,48,188,84,211,126,247,171,33,208,199,31,221,175,7,31,171,183,106,49,181,25,220,161,88,252,122,50,222,11,85,179,248,116,250,235,215,131,111,30,239,70,95,104,42,195,155,106,169,135,95,221,109,247,55,187,106,248,213,234,191,199,95,237,31,215,167,119,131,111,234,77,243,150,137,215,15,222,162,193,250,123,135,214,86,250,181,134,127,149,23,74,32,229,99,219,44,122,117,167,86,143,181,183,28,102,10,26,170,237,13,95,4,82,168,31,180,91,118,137,199,144,106,234,45,137,104,54,143,21,189,196,173,15,43,186,135,73,189,158,207,41,190,249,226,214,225,184,186,109,0,218,110,64,24,64,176,222,135,96,126,211,110,71,24,92,244,225,126,120,205,221,97,51,252,66,101,32,117,80,26,81,234,38,96,139,37,149,20,220,189,219,110,170,183,195,89,82,115,60,213,47,140,24,23,191,45,87,247,195,47,86,167,183,35,80,223,235,239,218,238,112,219,154,152,90,86,31,21,221,225,101,77,80,26,92,119,44,31,45,223,254,90,126,24,124,174,107,238,219,205,123,227,189,247,129,121,90,237,78,124,232,106,224,65,155,139,10,53,1,235,186,169,246,166,54,19,117,89,197,255,216,106,81,182,106,30,204,214,59,151,244,123,156,199,182,20,225,183,161,249,108,237,127,204,185,104,115,58,125,38,241,196,249,127,236,186,108,187,54,74,152,150,78,27,9,244,166,229,139,115,40,62,71,226,115,32,30,72,52,190,203,124,255,88,133,222,125,181,61,71,228,230,17,109,125,145,126,97,114,101,17,65,151,175,185,2,12,239,177,212,189,61,124,207,233,85,147,191,214,101,241,234,195,69,91,7,43,254,60,121,57,180,189,98,252,188,252,164,136,182,9,156,126,106,221,94,166,159,242,15,118,251,40,155,14,25,93,155,165,54,115,111,79,97,110,238,241,50,214,3,180,179,62,61,29,189,218,229,225,173,150,93,245,96,159,232,247,53,79,215,230,27,253,245,15,189,198,255,22,43,208,199,131,122,239,177,212,251,143,84,138,162,24,31,222,157,55,97,213,179,168,184,217,109,182,230,250,191,208,239,55,26,143,237,182,251,123,219,210,91,63,75,107,201,126,97,101,214,108,25,185,176,222,209,252,102,78,10,173,52,61,233,47,138,71,221,99,183,104,182,160,20,231,123,255,250,191,94,253,151,254,249,139,98,98,230,230,46,163,61,239,224,117,185,1,5,245,109,77,196,206,246,244,182,146,178,213,157,9,165,108,219,7,92,18,182,218,94,82,182,245,107,116,50,182,53,39,33,219,6,254,34,182,131,173,160,191,143,209,170,204,86,202,86,247,116,145,178,221,92,239,164,108,117,175,17,41,91,229,228,164,108,155,194,40,151,241,241,160,95,240,189,122,127,56,94,213,212,222,54,185,237,254,186,123,50,254,216,80,182,72,53,186,247,139,137,124,83,226,134,211,52,88,92,143,170,215,253,204,28,12,224,97,247,235,213,132,103,191,131,246,183,221,211,77,169,247,0,61,236,55,173,15,172,183,164,54,174,80,255,211,249,81,245,225,170,187,118,244,212,166,254,78,63,151,51,94,194,126,212,27,37,247,202,223,150,167,234,212,180,21,209,79,201,14,55,197,241,15,131,97,79,133,232,58,158,27,162,116,110,118,32,144,126,81,11,39,212,64,47,67,157,180,143,24,91,229,215,98,141,142,59,209,226,208,98,40,97,183,186,49,194,227,197,230,242,244,164,222,75,218,238,169,40,174,203,183,231,119,19,54,135,170,184,216,42,161,138,47,139,207,245,131,205,27,253,16,161,253,229,201,84,125,54,213,57,36,62,95,48,81,99,54,217,135,235,178,83,185,62,232,151,238,246,106,126,233,54,35,42,195,60,207,161,90,241,229,175,237,56,
+126,53,66,214,24,148,207,71,84,140,42,189,222,38,173,49,116,22,94,73,173,123,3,12,46,255,131,111,74,168,32,171,213,215,134,105,253,79,191,64,125,91,229,156,18,117,35,226,94,148,126,9,48,16,40,199,148,168,117,98,7,152,217,166,94,139,179,140,41,209,168,206,51,37,244,5,19,53,46,111,74,212,138,247,79,137,22,148,196,148,208,24,18,79,137,86,125,45,243,193,6,53,245,33,231,148,104,82,135,78,148,62,8,14,4,202,49,37,106,157,216,1,102,238,184,209,226,44,99,74,52,170,243,76,9,125,193,68,141,203,155,18,205,30,110,239,148,104,65,73,76,137,237,62,98,74,212,43,192,163,185,224,239,184,171,15,57,167,68,179,82,236,68,233,23,182,3,129,114,76,137,90,39,118,128,153,214,209,226,44,99,74,52,170,243,76,137,65,39,156,179,26,151,55,37,106,197,251,167,68,11,74,98,74,104,12,137,167,132,74,37,181,250,218,100,84,255,211,113,87,31,82,160,207,57,39,234,78,165,189,44,125,166,59,144,40,199,156,104,149,210,96,202,236,125,171,5,160,25,223,236,14,171,170,110,42,121,208,70,125,140,199,146,117,34,156,245,101,64,95,127,53,209,214,28,2,107,105,239,78,87,213,241,97,191,54,52,218,108,152,30,107,180,190,106,36,96,253,93,183,41,57,137,124,3,4,110,174,119,90,192,182,58,162,255,233,55,18,92,239,178,206,131,186,165,107,47,75,95,122,25,72,148,99,30,180,74,105,0,102,118,145,213,2,44,102,30,156,245,101,204,3,253,213,68,91,75,152,7,173,70,155,121,48,214,232,76,243,96,181,187,127,187,186,80,88,106,164,83,151,85,43,253,231,72,66,221,107,245,84,93,213,87,95,169,191,6,219,129,119,117,43,189,230,57,151,222,125,126,170,142,135,253,225,238,67,81,95,222,237,149,252,179,222,1,168,248,54,207,40,142,171,205,246,225,212,48,108,223,27,212,131,107,59,121,234,183,50,182,251,213,185,7,236,8,2,189,208,6,6,76,209,167,56,80,3,208,48,176,12,64,247,147,216,6,15,194,43,141,161,66,179,219,181,85,154,94,157,131,238,16,114,105,234,37,135,154,6,26,105,122,167,142,249,38,208,164,84,168,27,69,63,223,63,220,93,233,250,216,112,69,161,96,117,93,53,123,229,155,13,148,245,235,157,143,229,81,1,240,157,177,62,243,241,51,222,60,178,179,214,206,203,202,90,253,112,81,207,101,146,255,185,28,219,138,96,108,175,29,141,219,82,151,92,85,0,5,132,8,48,86,132,91,150,8,141,88,77,50,122,23,108,98,6,245,59,18,1,238,87,207,236,156,19,1,160,121,50,25,2,0,192,248,67,4,8,2,64,172,70,70,105,199,219,202,229,3,6,181,209,110,10,232,130,224,132,171,190,52,12,1,14,126,163,145,79,89,235,1,91,89,235,1,171,31,24,16,104,69,240,251,128,97,33,214,244,1,114,5,132,8,96,131,128,93,150,8,141,88,77,98,241,1,195,234,248,121,14,96,16,224,247,1,83,206,137,0,224,244,1,19,165,3,198,31,34,64,16,0,98,53,50,218,75,179,119,250,128,65,49,184,155,2,219,189,133,171,190,52,12,1,14,126,163,145,79,89,235,1,91,89,235,1,215,11,229,96,11,180,34,248,125,192,176,242,108,250,0,185,2,66,4,176,65,192,46,75,132,70,172,38,177,248,128,129,25,186,57,128,65,128,223,7,76,57,39,2,128,211,7,76,148,14,24,127,136,0,65,0,136,213,200,208,34,187,253,173,203,7,12,170,223,221,20,216,153,13,234,207,92,235,237,17,65,8,112,240,27,141,124,202,90,15,216,202,90,15,184,126,35,58,216,2,173,8,126,31,48,44,181,155,62,64,174,128,16,1,108,16,176,203,18,161,17,171,73,44,62,96,96,134,110,14,96,16,224,247,1,83,206,137,0,224,244,1,19,165,3,198,31,34,64,16,0,98,53,50,180,72,181,189,211,173,238,239,238,207,51,83,51,238,190,28,77,196,171,238,7,243,120,168,134,113,247,211,216,230,19,14,99,149,187,184,233,239,109,28,215,99,142,1,99,61,107,127,32,204,116,111,96,247,179,101,206,113,7,239,103,105,197,157,143,61,82,27,83,185,218,54,45,22,83,212,112,139,55,188,197,195,184,152,1,70,26,44,199,101,241,118,117,186,170,254,197,147,169,250,23,88,170,238,67,128,142,186,175,40,77,117,183,194,230,138,246,
+87,20,88,69,120,241,179,228,204,21,52,130,194,37,27,67,137,41,101,36,166,220,114,246,34,112,244,152,28,101,181,180,155,213,7,125,143,25,123,218,175,198,145,167,253,122,10,167,246,135,241,244,26,81,30,15,221,206,165,30,233,132,211,122,200,137,49,131,12,33,166,177,166,253,209,22,105,24,131,245,177,178,218,219,205,22,53,250,177,60,109,108,153,168,188,241,20,17,134,181,196,20,59,147,200,145,5,242,31,59,0,90,22,219,156,23,75,211,254,73,106,164,253,194,171,149,243,77,16,212,15,162,134,21,126,108,36,248,88,133,163,30,137,141,80,137,172,81,34,76,186,40,180,184,228,59,179,14,215,26,28,63,221,139,25,77,255,177,58,212,92,244,200,29,60,19,109,47,153,112,61,31,30,215,52,252,60,117,189,204,122,232,88,217,52,145,210,92,103,217,184,89,98,159,139,159,185,184,25,207,212,106,20,231,42,75,144,179,62,222,81,223,90,45,89,57,35,75,229,8,43,30,242,118,105,59,223,93,89,28,183,84,216,145,67,168,28,222,32,128,124,83,89,175,142,141,255,107,94,51,209,34,155,86,172,91,102,63,191,210,125,106,198,32,173,106,132,170,95,166,207,71,126,219,93,239,14,215,134,10,218,111,198,90,104,191,182,60,28,104,126,176,61,9,232,105,79,213,209,254,104,211,8,131,149,169,151,179,224,22,213,180,63,89,181,115,190,173,87,208,224,5,170,154,184,217,118,121,243,172,173,96,60,27,187,185,238,93,170,201,163,166,177,56,106,152,154,183,101,132,213,113,235,43,178,76,222,162,101,138,55,232,204,101,123,48,164,77,52,218,42,18,33,237,208,76,15,215,205,13,23,77,187,196,182,53,98,221,159,127,208,92,233,151,159,186,75,127,89,109,119,95,132,146,105,91,9,121,9,142,133,186,59,236,171,183,198,198,212,118,177,51,221,144,58,104,69,57,184,201,134,41,101,240,122,15,234,240,202,96,77,141,183,203,58,165,26,188,76,49,188,203,39,214,232,210,144,152,101,87,150,227,181,39,183,178,44,111,59,241,20,53,156,156,83,69,5,188,136,69,191,128,133,85,146,227,69,152,96,37,233,199,175,88,37,133,188,154,67,190,146,131,85,146,227,213,136,96,37,233,235,177,74,10,120,89,131,126,73,3,171,36,199,102,249,96,37,233,2,62,86,73,1,219,247,233,109,251,49,74,170,155,53,92,116,129,215,122,120,87,211,64,99,208,171,163,190,205,125,26,112,253,243,160,215,204,91,21,61,126,189,152,244,25,27,132,245,250,26,243,72,242,253,233,176,219,246,141,192,244,129,18,122,31,99,211,33,165,62,213,70,119,125,108,187,192,20,15,167,186,87,96,77,69,253,53,60,51,253,225,84,250,185,215,151,200,153,235,219,183,245,43,20,250,212,139,77,113,218,29,170,65,63,184,199,213,250,225,225,206,47,67,115,141,33,196,219,195,161,233,37,186,186,191,63,30,86,235,183,218,214,107,135,104,167,113,3,150,230,173,114,47,199,238,178,81,187,21,253,149,238,180,178,93,151,167,174,35,118,219,1,249,220,71,168,63,251,168,220,61,108,202,97,227,201,246,75,227,178,242,126,187,59,220,62,140,174,59,127,27,16,195,187,194,5,47,142,147,153,39,103,238,184,138,42,253,251,79,150,132,116,44,209,115,135,76,99,49,106,217,228,245,52,243,97,129,67,50,163,122,235,170,109,152,117,91,182,52,131,42,179,6,108,47,202,52,147,110,19,48,87,5,249,156,134,173,248,229,227,166,9,81,187,10,124,56,183,203,53,83,85,181,198,173,47,26,110,156,52,14,209,105,150,201,250,172,31,61,29,155,30,68,215,205,225,32,211,221,27,13,55,163,174,243,96,182,232,29,238,218,212,109,120,0,204,221,227,28,108,151,235,88,13,54,135,165,25,231,112,103,154,57,206,8,230,238,113,14,182,4,117,172,6,27,96,210,140,115,184,251,198,28,103,4,243,115,118,170,98,202,233,226,124,202,193,48,17,86,105,89,243,187,149,71,251,155,109,64,61,217,190,235,146,53,129,109,198,18,200,101,120,160,89,123,92,198,197,147,209,185,26,63,255,215,207,131,11,204,227,76,14,235,114,243,160,95,49,57,110,111,111,75,125,148,198,225,76,238,220,39,247,244,225,244,244,234,124,160,213,184,161,93,75,184,89,195,248,88,183,87,8,120,183,119,246,188,207,255,155,108,101,111,223,86,115,29,162,98,182,19,209,111,175,237,
+31,238,28,27,183,219,211,24,154,61,27,250,245,204,208,61,220,230,174,242,193,203,126,78,153,166,13,67,86,85,34,225,12,201,234,151,93,66,244,164,223,110,202,163,167,230,69,32,150,158,18,9,215,237,9,38,240,100,246,226,48,77,54,221,4,60,21,37,112,63,176,185,67,57,28,79,131,110,27,35,60,1,133,51,36,243,226,201,212,147,105,178,180,122,10,192,211,88,79,137,132,235,246,151,18,120,50,115,98,211,100,211,13,165,83,81,2,247,150,154,187,93,195,241,52,104,85,49,194,19,80,56,67,50,47,158,76,61,153,38,75,171,167,0,60,141,245,148,72,56,115,175,162,27,80,227,28,205,52,218,116,123,226,84,152,192,157,138,230,222,201,112,68,13,58,61,140,16,5,20,206,144,204,139,40,83,79,166,209,210,234,41,0,81,99,61,37,18,206,140,197,85,25,182,50,208,189,193,242,172,12,218,134,107,156,149,65,34,225,58,201,206,143,170,30,29,157,234,116,239,15,11,227,1,59,246,155,154,3,166,74,33,207,91,101,60,119,88,71,11,97,87,192,88,142,8,27,25,66,157,13,225,51,10,82,49,132,24,54,13,249,196,74,162,42,3,203,77,87,183,128,153,165,91,140,229,153,89,109,223,54,206,204,74,36,156,197,144,245,234,106,162,24,2,64,245,77,17,51,171,49,146,111,102,157,133,240,195,229,44,7,110,102,105,91,249,140,130,84,12,33,70,232,204,74,170,42,3,203,205,46,130,128,153,165,59,149,229,153,89,109,251,55,206,204,74,36,156,197,144,118,197,16,0,170,111,138,152,89,141,145,124,51,235,44,132,31,46,103,57,112,51,171,62,195,201,99,20,164,98,8,49,66,103,86,82,85,153,125,17,154,135,44,158,214,16,131,150,103,121,230,86,219,71,142,51,183,18,9,103,49,101,115,10,236,88,49,4,132,234,155,34,230,86,99,37,223,220,58,11,225,7,204,89,14,220,220,170,79,225,240,24,5,169,24,66,140,208,185,149,84,85,102,149,202,151,105,153,53,51,51,153,73,91,51,11,200,180,198,53,179,68,194,117,146,141,51,173,177,98,106,0,77,25,143,151,237,188,126,24,84,166,101,19,194,174,0,87,250,32,176,145,39,211,178,25,5,169,24,66,12,215,204,114,137,149,68,85,6,150,189,153,214,184,131,118,158,153,21,144,105,141,181,149,72,56,139,33,155,76,107,172,24,2,64,231,101,187,116,102,217,51,45,155,16,126,184,140,211,135,248,153,101,102,90,54,163,32,21,67,136,17,58,179,146,170,202,192,178,55,211,50,109,103,38,51,105,103,86,64,166,53,214,86,34,225,44,134,180,43,134,0,208,121,217,46,157,89,246,76,203,38,132,31,46,227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,50,187,79,249,51,45,211,122,102,50,147,118,110,5,100,90,99,125,37,18,206,98,202,38,211,26,43,134,128,208,121,217,46,157,91,246,76,203,38,132,31,48,227,244,33,126,110,153,153,150,205,40,72,197,16,98,132,206,173,164,170,50,159,223,250,50,45,243,105,178,153,204,164,125,154,28,144,105,141,159,38,39,18,174,147,108,156,105,141,21,83,3,104,202,120,188,108,231,117,29,163,50,45,155,16,118,5,184,210,7,129,141,60,153,150,205,40,72,197,16,98,184,102,150,75,172,36,170,50,176,236,205,180,76,219,153,201,76,218,153,21,144,105,141,181,149,72,56,139,33,155,76,107,172,24,2,64,231,101,187,116,102,217,51,45,155,16,126,184,140,211,135,248,153,101,102,90,54,163,32,21,67,136,17,58,179,146,170,202,192,178,55,211,26,31,121,148,103,102,5,100,90,99,109,37,18,206,98,72,187,98,8,0,157,151,237,210,153,101,207,180,108,66,248,225,50,78,31,226,103,150,153,105,217,140,130,84,12,33,70,232,204,74,170,42,179,199,167,63,211,50,173,103,38,51,105,231,86,64,166,53,214,87,34,225,44,166,108,50,173,177,98,8,8,157,151,237,210,185,101,207,180,108,66,248,1,51,78,31,226,231,150,153,105,217,140,130,84,12,33,70,232,220,74,170,170,65,239,76,103,170,101,59,91,52,207,62,203,128,92,107,188,207,50,145,112,157,100,227,92,203,118,232,170,133,241,120,225,206,235,238,74,229,90,54,33,236,10,112,37,16,2,27,121,114,45,155,81,144,138,33,196,112,205,45,151,88,73,84,101,96,217,155,107,141,143,40,205,51,179,
+2,114,173,177,182,18,9,103,49,100,147,107,217,206,110,245,152,233,188,112,151,206,44,123,174,101,19,194,15,151,113,2,17,63,179,204,92,203,102,20,164,98,8,49,66,103,86,82,85,25,88,246,230,90,227,147,78,243,204,172,128,92,107,172,173,68,194,89,12,105,87,12,1,160,243,194,93,58,179,236,185,150,77,8,63,92,198,9,68,252,204,50,115,45,155,81,144,138,33,196,8,157,89,73,85,101,174,7,253,185,214,248,200,212,60,115,43,32,215,26,235,43,145,112,22,83,54,185,150,237,44,89,143,161,206,11,119,233,220,178,231,90,54,33,252,128,25,39,16,241,115,203,204,181,108,70,65,42,134,16,35,116,110,37,85,85,45,224,205,142,124,170,101,158,212,106,38,51,250,123,10,188,234,26,142,213,90,105,2,51,173,193,65,183,163,76,11,40,92,39,217,56,211,26,43,166,6,208,148,241,120,217,174,143,54,14,155,89,19,166,22,220,216,132,176,43,192,149,62,8,108,228,201,180,108,70,65,42,134,16,195,53,179,92,98,37,81,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,68,194,89,12,217,100,90,99,197,16,0,58,47,219,165,51,203,158,105,217,132,240,195,101,156,62,196,207,44,51,211,178,25,5,169,24,66,140,208,153,149,84,85,6,150,189,153,150,105,59,51,153,73,59,179,2,50,173,177,182,18,9,103,49,164,93,49,4,128,206,203,118,233,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,85,39,32,153,105,153,214,51,147,153,180,115,43,32,211,26,235,43,145,112,22,83,54,153,214,88,49,4,132,206,203,118,233,220,178,103,90,54,33,252,128,25,167,15,241,115,203,204,180,108,70,65,42,134,16,35,116,110,37,85,85,211,218,241,122,71,101,90,234,18,107,166,165,191,167,192,91,31,120,207,56,189,163,145,38,48,211,26,28,90,63,202,180,128,194,117,146,141,51,173,177,98,106,0,77,25,79,150,237,215,187,208,3,86,198,76,45,184,177,9,97,87,128,43,125,16,216,200,147,105,217,140,130,84,12,33,134,107,102,185,196,74,162,42,3,203,222,76,203,180,157,153,204,164,157,89,1,153,214,88,91,137,132,179,24,178,201,180,198,138,33,0,212,45,219,133,51,203,158,105,217,132,240,195,101,156,62,196,207,44,51,211,178,25,5,169,24,66,140,208,153,149,84,85,6,150,189,153,150,105,59,51,153,73,59,179,2,50,173,177,182,18,9,103,49,164,93,49,4,128,186,101,187,112,102,217,51,45,155,16,126,184,140,211,135,248,153,101,102,90,54,163,32,21,67,136,17,58,179,146,170,170,19,144,204,180,76,235,153,201,76,218,185,21,144,105,141,245,149,72,56,139,41,155,76,107,172,24,2,66,221,178,93,56,183,236,153,150,77,8,63,96,198,233,67,252,220,50,51,45,155,81,144,138,33,196,8,157,91,73,84,117,254,223,221,97,243,176,43,245,25,23,230,233,21,191,237,158,110,182,55,55,23,215,205,57,25,90,178,109,53,56,71,65,253,58,61,14,227,248,80,22,219,27,125,232,91,241,201,11,125,78,194,163,62,25,99,116,14,149,65,220,56,94,170,107,8,178,53,210,204,8,70,29,151,123,77,242,178,72,58,146,251,94,118,205,41,193,176,6,227,82,223,93,53,46,226,108,160,203,162,29,230,193,218,28,254,63,95,247,183,88,15,49,105,127,46,143,159,150,155,226,246,120,120,184,63,89,198,58,224,59,56,26,236,190,254,235,185,230,175,255,248,15,123,171,248,104,57,106,33,86,251,95,195,135,189,50,15,88,49,25,169,31,188,67,109,184,8,7,201,230,90,35,169,220,159,202,43,214,240,250,91,172,236,234,159,119,31,200,193,14,56,203,134,44,149,228,236,42,87,183,183,199,167,229,251,237,169,50,69,120,174,68,120,219,78,92,173,130,158,229,87,175,191,171,175,14,32,241,100,60,227,207,55,158,181,96,220,216,156,11,244,220,126,203,213,227,106,103,120,206,155,135,253,186,62,33,167,190,127,125,120,92,29,47,202,103,102,186,95,62,55,106,16,250,191,95,124,252,81,249,185,113,40,198,159,95,116,49,226,223,212,189,151,229,243,39,234,146,211,231,245,89,29,234,199,154,242,233,225,238,162,252,188,254,225,217,244,135,103,245,15,207,167,63,212,164,30,187,31,90,38,167,103,151,167,250,151,
+117,119,117,125,10,94,75,104,63,184,92,247,114,90,215,100,254,99,240,253,103,23,143,207,47,247,245,15,207,6,63,124,122,113,250,252,242,241,63,234,95,198,119,60,107,238,104,65,241,248,197,199,229,217,102,181,234,190,152,42,244,24,162,207,245,227,96,232,103,51,156,85,185,121,214,107,165,218,148,143,103,133,109,158,143,191,111,175,55,117,181,81,202,218,212,223,31,141,145,172,31,213,183,205,80,78,3,85,29,141,241,169,223,6,35,60,78,7,120,122,184,166,64,115,89,220,154,167,86,151,195,153,113,83,123,133,254,234,112,116,153,151,156,101,105,96,118,121,123,89,94,222,92,234,72,116,70,156,243,226,103,227,139,159,123,46,126,62,186,248,241,185,75,82,11,68,107,85,53,40,109,200,180,88,181,17,24,128,214,118,193,16,189,182,43,134,48,118,208,112,227,249,108,88,187,197,143,225,6,167,237,189,126,180,171,220,152,6,189,194,6,147,65,31,112,169,112,127,111,49,163,57,55,250,203,158,79,46,27,153,173,159,45,167,205,222,252,237,197,11,245,227,101,237,212,154,95,79,230,175,219,27,21,32,246,229,78,159,87,182,217,95,62,171,155,133,183,19,108,168,242,122,226,157,140,153,103,154,220,61,249,90,173,127,17,228,184,155,106,210,217,36,117,137,75,255,215,152,90,245,41,63,206,169,165,59,56,88,29,247,228,135,179,227,158,252,112,118,220,237,15,161,142,219,188,92,183,134,56,207,1,243,251,1,244,205,31,6,136,31,221,17,229,184,221,250,92,63,14,134,62,151,227,214,170,138,117,220,211,65,134,59,110,125,117,48,186,6,151,4,57,110,235,197,46,199,109,189,216,229,184,167,146,50,29,247,152,128,9,90,235,5,83,199,61,190,98,234,184,45,52,0,142,155,50,56,109,239,245,163,93,229,139,116,220,186,32,158,196,113,251,39,31,203,113,55,197,202,179,73,234,10,170,254,175,49,181,234,156,197,57,181,116,106,101,117,220,147,31,206,142,123,242,195,217,113,183,63,132,58,110,243,114,253,166,233,121,14,152,223,15,160,111,254,48,64,252,232,142,40,199,237,214,231,250,113,48,244,185,28,183,86,85,172,227,158,14,50,220,113,235,171,131,209,53,184,36,200,113,91,47,118,57,110,235,197,46,199,61,149,148,233,184,199,4,76,208,90,47,152,58,238,241,21,83,199,109,161,1,112,220,148,193,105,123,175,31,237,42,95,164,227,214,69,229,36,142,219,63,249,88,142,187,169,132,159,77,82,151,231,245,127,141,169,165,191,115,79,45,253,118,137,213,113,79,126,56,59,238,201,15,103,199,221,254,16,234,184,205,203,245,107,43,231,57,96,126,63,128,190,249,195,0,241,163,59,162,28,183,91,159,235,199,193,208,231,114,220,90,85,177,142,123,58,200,112,199,173,175,14,70,215,224,146,32,199,109,189,216,229,184,173,23,187,28,247,84,82,166,227,30,19,48,65,107,189,96,234,184,199,87,76,29,183,133,6,192,113,83,6,167,237,189,126,180,171,124,145,142,91,63,204,75,226,184,253,147,143,229,184,155,147,230,206,38,209,159,158,232,255,26,83,75,127,231,158,90,122,179,170,213,113,79,126,56,59,238,201,15,103,199,221,254,16,234,184,205,203,245,46,216,243,28,48,191,31,64,223,252,97,128,248,209,29,81,142,219,173,207,245,227,96,232,115,57,110,173,170,88,199,61,29,100,184,227,214,87,7,163,107,112,73,144,227,182,94,236,114,220,214,139,93,142,123,42,41,211,113,143,9,152,160,181,94,48,117,220,227,43,166,142,219,66,3,224,184,41,131,211,246,94,63,218,85,190,72,199,173,247,183,39,113,220,254,201,199,114,220,205,209,151,103,147,232,79,79,244,127,141,169,165,191,115,79,45,189,247,197,234,184,39,63,156,29,247,228,135,179,227,110,127,8,117,220,230,229,122,83,205,121,14,152,223,15,160,111,254,48,64,252,232,142,40,199,237,214,231,250,113,48,244,185,28,183,86,85,172,227,158,14,50,220,113,235,171,131,209,53,184,36,200,113,91,47,118,57,110,235,197,46,199,61,149,148,233,184,199,4,76,208,90,47,152,58,238,241,21,83,199,109,161,1,112,220,148,193,105,123,175,31,237,42,95,164,227,214,219,229,146,56,110,255,228,155,56,238,110,59,203,233,183,221,85,185,127,220,30,15,123,189,157,230,226,73,113,177,95,221,181,90,63,85,199,127,94,62,174,118,15,198,231,39,221,134,
+149,239,127,248,249,111,175,190,249,229,182,172,94,245,4,250,125,57,223,28,118,187,114,93,213,27,115,12,14,133,178,202,118,117,189,43,79,79,235,29,103,122,103,208,253,177,220,61,108,202,139,39,214,29,131,235,85,181,218,29,110,141,173,52,235,99,185,170,202,171,83,249,219,69,113,170,197,85,146,93,22,234,243,224,195,159,239,245,31,171,26,125,117,145,202,220,107,211,211,40,12,153,27,86,197,225,190,60,174,106,208,246,151,153,59,154,86,59,245,79,32,127,165,191,102,119,172,201,189,35,224,101,222,93,101,242,222,28,15,247,19,214,251,243,31,198,104,135,59,167,218,187,188,252,206,23,253,193,162,235,245,219,242,110,117,97,176,92,61,84,111,253,60,7,183,6,105,185,190,114,58,216,134,247,64,213,99,206,151,197,246,166,222,62,117,114,141,157,150,194,184,78,36,3,148,107,171,146,74,79,21,83,237,149,241,231,245,174,129,88,85,222,221,59,213,95,83,8,209,126,125,161,69,132,199,109,249,206,148,224,145,43,129,38,16,34,128,190,110,162,248,70,1,3,172,175,166,96,47,70,246,159,24,130,214,66,127,153,84,6,48,215,90,239,20,83,18,247,164,242,187,171,100,2,96,89,174,15,123,69,127,85,119,113,230,51,238,239,166,217,247,215,78,29,251,212,222,182,89,231,18,197,160,17,224,221,93,179,174,250,112,95,218,93,252,246,238,126,167,255,178,207,118,117,91,208,100,87,215,77,113,238,228,233,85,59,201,179,187,202,228,120,123,92,237,171,171,227,65,173,4,6,60,251,184,82,95,113,56,54,48,95,109,238,182,22,1,12,42,94,17,140,235,76,33,142,229,227,225,215,50,90,10,147,140,87,12,243,194,137,50,134,136,187,222,25,252,203,246,219,251,227,246,177,125,249,103,221,95,123,219,74,103,136,106,209,18,173,159,169,102,10,169,76,245,21,132,84,45,11,90,95,83,216,156,147,138,129,120,55,235,253,118,99,240,180,8,24,34,214,144,67,0,170,206,151,90,128,149,82,206,17,139,16,220,217,36,109,29,194,195,169,60,14,164,188,95,157,78,239,142,155,230,67,185,95,159,95,57,211,11,149,118,28,15,187,221,249,122,171,51,210,52,67,156,145,190,110,226,140,106,129,78,129,158,159,228,212,93,69,243,33,215,181,2,142,163,0,35,80,246,97,183,49,46,178,69,28,82,162,254,178,33,82,181,24,83,145,246,229,59,210,253,27,247,18,240,235,174,179,64,79,123,67,195,2,250,227,217,135,88,129,111,220,22,130,46,125,221,196,234,53,79,195,214,29,83,191,213,73,158,221,85,138,163,133,97,10,54,67,62,219,253,166,124,63,48,228,54,112,14,213,119,210,92,235,203,38,108,237,142,206,248,243,236,241,244,50,160,141,165,62,97,130,188,218,224,74,11,176,72,161,214,123,189,148,179,162,43,72,128,209,181,182,101,220,113,123,123,59,154,89,230,98,178,249,217,248,98,123,215,170,231,112,220,42,174,171,126,161,95,62,150,231,152,160,156,65,55,73,155,63,212,114,182,253,234,183,227,7,247,234,176,97,23,180,64,108,46,157,174,17,219,1,245,227,105,189,68,97,91,25,6,240,51,47,156,46,197,21,69,203,114,252,174,234,92,211,253,169,255,179,34,29,214,136,104,128,187,236,174,157,202,182,41,119,120,217,58,162,1,178,117,215,218,106,83,149,53,141,233,133,88,43,182,46,33,186,187,131,202,83,85,47,132,247,125,95,149,110,237,79,205,232,175,142,229,174,92,157,202,139,245,219,85,179,160,190,236,86,18,127,126,60,108,55,166,76,150,251,122,177,190,50,201,22,39,53,97,202,250,135,139,58,43,89,175,246,197,181,250,71,93,189,173,46,219,155,117,132,217,93,175,214,191,170,57,166,239,56,86,79,254,224,16,179,185,145,45,101,115,91,46,33,207,87,242,149,217,222,152,75,208,235,242,118,187,103,75,89,223,149,66,196,7,69,229,166,44,44,146,94,60,113,8,243,188,151,227,103,77,167,80,236,212,34,226,208,240,51,73,116,179,225,255,3,9,140,105,204,
 0};
+unsigned long mal_init_inline_len = 970430;
 unsigned char* mal_init_inline = 0;
 
 unsigned char createdb_inline_arr[] = 
-{120,218,237,125,107,115,219,184,178,224,103,249,87,160,180,31,34,207,42,138,237,204,59,39,183,74,150,233,68,39,122,120,36,57,137,239,214,150,138,38,33,155,99,137,84,248,144,227,243,235,183,187,241,36,69,73,148,199,206,222,15,158,170,137,9,160,209,104,52,250,5,8,143,215,175,217,228,54,72,216,56,202,98,143,179,78,228,115,118,30,197,11,6,121,73,118,253,55,247,82,150,70,44,189,229,44,229,241,34,97,209,140,18,253,232,63,193,124,238,178,139,236,122,30,120,7,175,95,179,94,224,241,48,225,77,182,106,177,147,214,81,139,177,238,140,185,204,139,150,15,186,210,69,143,221,187,9,11,163,148,249,65,146,198,193,117,150,114,159,221,7,233,45,0,4,9,226,153,5,115,64,114,21,101,204,115,67,22,93,167,110,0,127,66,206,220,148,221,166,233,242,207,55,111,22,162,241,86,20,223,188,1,156,111,160,185,55,45,168,139,213,59,208,94,28,220,220,166,236,248,143,63,126,99,175,217,191,179,249,3,59,57,58,250,157,117,190,116,155,172,157,221,100,73,42,50,94,195,159,227,223,160,47,33,79,207,78,217,105,235,115,235,224,192,139,185,155,114,36,3,58,204,102,89,232,165,65,20,178,250,60,184,227,245,198,202,157,51,36,60,188,105,178,37,80,164,190,121,226,201,239,67,198,191,67,205,16,0,67,119,1,100,207,111,248,117,236,182,4,130,119,27,241,7,255,184,129,96,71,11,219,26,120,22,170,119,82,122,112,19,187,97,10,80,220,3,65,128,81,222,64,52,107,40,228,249,191,135,40,155,75,18,193,119,21,112,5,79,137,172,20,215,147,16,148,67,130,50,253,162,161,57,13,237,140,156,246,196,97,231,151,131,206,164,59,28,48,159,223,196,156,39,141,152,249,17,116,150,31,30,140,156,201,229,104,48,150,233,131,154,72,179,248,167,227,223,143,222,44,131,198,225,187,117,44,177,235,7,110,152,52,252,93,88,252,159,16,195,27,64,85,42,192,106,112,37,85,219,5,66,1,203,198,95,6,126,235,192,3,142,139,56,90,5,192,8,151,37,193,98,57,231,140,127,203,2,176,62,28,24,59,139,98,234,203,229,160,251,149,165,193,2,152,239,69,139,133,27,250,88,83,100,28,49,96,84,150,128,22,210,87,242,144,164,124,33,190,143,24,216,56,31,255,222,199,65,202,19,237,10,150,113,228,113,63,139,185,192,209,56,60,200,155,181,228,219,188,69,37,101,242,80,168,252,50,194,149,156,175,210,11,32,115,154,70,83,31,50,27,137,182,215,48,208,11,203,201,196,60,205,98,80,30,132,58,168,229,199,102,129,92,111,213,45,60,232,118,138,205,96,62,150,3,24,234,63,164,54,54,34,210,27,154,177,240,148,53,35,169,64,216,221,189,65,168,237,189,193,68,89,51,152,111,122,131,169,199,245,198,194,179,163,55,73,234,46,150,213,186,68,160,187,251,69,96,155,58,71,133,249,30,82,214,227,187,105,99,172,111,53,235,150,36,85,51,237,150,76,84,171,96,113,161,90,5,107,156,246,110,129,58,94,189,25,155,79,47,166,108,151,179,250,235,210,25,93,177,143,221,241,100,56,186,18,44,226,236,91,198,227,7,6,68,166,17,252,93,112,239,214,13,131,100,129,125,147,8,222,140,255,234,129,232,206,3,112,23,192,119,151,205,248,61,187,141,162,187,164,165,144,44,34,104,27,28,96,20,167,56,92,216,45,96,180,203,110,230,209,53,134,226,194,173,173,220,56,112,33,116,97,247,183,129,119,11,44,12,211,56,154,19,119,0,67,24,0,5,160,22,216,178,59,135,74,60,73,96,156,147,50,51,252,144,180,136,238,121,116,51,245,220,212,133,191,224,6,181,94,99,35,141,131,90,224,179,40,240,155,7,181,232,62,4,15,43,173,193,65,205,231,179,32,228,182,162,30,212,4,27,52,200,50,88,114,147,170,47,231,110,88,87,233,90,13,8,30,160,198,34,143,218,61,134,165,7,181,5,116,52,8,83,81,156,4,255,41,20,71,75,104,14,115,175,131,27,0,171,201,16,0,170,160,255,247,14,202,188,120,177,143,66,176,29,23,152,39,232,245,144,81,40,210,192,58,232,16,224,34,137,38,38,99,25,241,182,157,194,232,221,100,115,55,70,250,120,12,225,73,66,112,249,161,23,181,146,219,40,155,251,236,26,234,207,185,11,92,106,105,93,66,185,133,124,31,71,23,162,152,12,240,63,160,64,32,
-42,20,17,24,207,36,66,33,135,184,231,154,83,91,160,189,160,8,136,65,146,118,199,249,242,47,106,22,194,32,74,117,176,11,217,18,240,132,92,183,6,65,142,27,3,23,128,90,16,35,8,86,110,184,139,29,4,93,201,66,31,50,65,204,124,148,21,196,25,243,68,104,185,55,119,131,69,34,49,60,64,254,108,78,122,14,48,124,54,195,79,169,176,105,4,236,100,247,81,124,55,143,92,159,45,130,239,12,66,34,196,39,12,13,200,152,38,228,149,183,204,94,177,155,96,197,5,211,220,21,143,221,27,104,108,153,49,170,189,228,208,118,152,98,94,4,101,36,187,30,12,71,34,121,131,136,32,192,195,162,98,35,108,121,235,38,188,37,248,131,66,158,96,177,198,28,64,31,97,228,1,211,53,79,113,166,6,130,130,93,88,100,243,52,120,77,109,24,50,131,232,149,174,192,186,195,68,53,6,33,39,196,165,169,26,237,56,179,186,150,44,93,143,191,66,1,50,92,113,23,81,22,18,167,72,88,22,28,102,2,72,130,208,65,146,177,254,41,161,24,65,28,233,169,65,32,84,212,24,136,71,72,198,0,66,99,168,7,236,33,47,24,122,252,13,73,35,176,7,53,1,234,73,209,39,81,32,141,7,57,68,54,66,254,245,67,202,43,104,62,72,248,102,189,175,213,24,180,7,82,192,99,14,173,39,146,3,66,29,193,185,187,113,90,183,108,128,214,72,234,78,10,205,46,176,35,104,216,9,22,228,24,107,69,203,138,149,20,227,65,73,192,220,4,201,45,34,112,227,155,12,33,116,108,130,8,92,47,5,101,18,202,12,217,25,36,99,136,181,210,12,234,39,210,94,8,179,18,102,139,107,144,3,20,99,81,40,213,10,36,1,100,2,196,44,61,168,193,8,231,234,16,121,201,18,201,106,72,142,31,50,80,163,52,152,219,117,249,119,180,222,7,181,228,54,88,86,168,15,206,147,32,139,173,163,240,234,170,219,116,165,168,11,48,108,17,214,172,81,77,11,144,218,191,119,131,20,193,113,78,213,29,98,235,130,167,187,204,38,8,136,48,154,82,144,132,145,91,5,252,62,33,92,96,179,86,60,12,80,62,148,172,97,97,169,135,97,40,9,156,76,202,79,108,22,71,139,13,126,232,221,54,76,64,208,78,60,36,213,91,176,40,139,237,38,7,18,207,55,191,245,83,147,65,215,165,88,55,197,39,200,42,229,106,169,163,148,16,29,250,4,89,161,191,56,148,244,1,35,69,127,131,232,96,75,15,161,189,102,41,209,80,245,224,254,22,244,13,41,2,53,124,79,184,124,210,112,200,17,126,248,61,77,120,197,176,128,232,240,84,187,32,28,17,23,77,127,26,120,228,175,16,112,125,218,155,107,153,47,150,233,67,99,171,24,16,136,104,15,236,80,176,4,212,41,183,60,32,192,220,236,110,39,36,235,178,189,33,130,121,87,13,83,122,11,157,191,141,192,217,38,16,58,204,65,244,43,224,158,234,90,187,90,129,64,116,55,193,18,232,37,96,46,15,152,23,238,157,144,147,104,54,131,1,130,239,216,21,30,143,204,136,187,114,131,57,125,161,224,6,33,24,73,242,82,165,94,11,171,114,17,167,214,114,14,139,129,199,170,241,21,57,77,12,153,120,44,140,167,200,242,208,27,131,112,214,106,222,252,14,35,104,136,207,227,198,201,209,33,121,142,123,16,28,111,30,121,119,77,224,165,152,64,162,75,184,131,241,230,115,168,179,244,116,149,95,100,149,69,228,103,115,222,82,180,253,159,48,254,191,0,136,98,69,17,135,50,250,50,237,3,13,193,44,32,2,64,41,239,146,117,215,0,237,45,2,47,142,192,47,68,161,159,0,96,28,39,253,211,28,32,200,44,161,130,249,197,2,21,157,130,8,128,92,45,10,128,171,32,38,95,72,241,179,130,18,235,96,229,126,240,26,123,159,208,82,25,64,138,149,178,237,160,8,147,114,240,55,53,8,66,102,224,183,108,104,200,130,161,92,162,223,153,185,224,212,176,59,11,247,239,53,48,247,239,53,176,112,229,37,247,249,166,163,240,245,42,130,112,3,108,242,3,186,26,208,68,150,128,144,123,183,0,159,164,11,181,50,80,179,162,0,19,68,200,73,47,244,235,176,184,84,128,74,236,103,56,245,69,169,50,203,18,218,87,40,105,43,247,53,70,22,95,52,191,92,243,221,36,201,112,73,6,26,9,164,96,195,172,149,135,34,96,192,96,16,121,50,233,246,157,241,164,221,
-191,40,213,248,58,95,70,222,109,189,129,33,238,105,247,67,119,48,49,43,64,166,102,97,100,117,104,169,170,191,59,216,137,252,121,48,167,22,46,131,30,218,122,74,196,236,75,119,242,145,146,236,191,135,3,103,239,118,182,44,42,153,22,89,67,177,191,218,114,148,93,243,145,213,44,206,253,131,202,107,220,121,89,226,218,161,183,206,119,152,57,4,104,62,65,106,96,18,136,83,98,254,253,160,60,86,18,153,81,236,67,21,4,107,64,166,94,51,6,223,172,191,189,72,253,156,92,106,137,139,120,222,109,104,207,143,163,229,63,111,45,143,5,218,122,17,133,82,81,248,236,122,89,182,0,226,99,14,241,62,40,25,48,177,184,198,69,107,89,68,184,231,198,98,33,6,248,214,20,49,95,224,191,18,139,79,48,11,161,117,143,191,163,32,124,77,107,44,180,54,97,218,64,206,32,230,4,2,131,7,181,244,129,243,84,107,241,131,230,64,192,175,59,8,22,163,116,9,163,151,234,133,24,128,225,193,13,198,109,20,38,0,79,129,93,184,70,96,8,133,65,95,114,252,68,88,242,80,128,46,230,175,209,34,194,224,225,234,2,115,103,184,72,132,180,123,115,96,15,70,61,64,128,43,150,179,74,68,242,22,136,184,219,32,134,165,162,39,106,148,137,119,204,129,73,251,160,162,10,101,152,86,196,210,125,80,137,26,239,94,244,160,84,15,198,222,45,95,184,44,97,183,46,174,200,251,124,201,193,110,132,30,45,221,210,47,207,89,201,14,6,9,20,240,100,154,16,130,100,26,133,83,4,199,5,55,181,19,97,210,62,237,57,172,1,16,122,154,113,124,4,243,12,192,27,23,114,0,229,52,125,88,114,157,253,246,228,80,33,82,120,198,78,207,233,76,88,210,194,161,5,36,242,239,171,51,231,98,122,57,118,70,175,100,4,43,8,162,208,182,73,93,72,88,198,196,178,67,214,242,57,69,228,146,108,246,30,208,5,190,136,115,47,177,183,13,90,132,56,92,103,7,12,140,172,147,108,103,8,33,32,126,72,74,158,157,35,174,228,68,98,115,100,220,249,232,244,219,165,60,113,179,244,22,123,39,120,146,232,117,23,87,178,2,120,49,33,75,152,150,74,5,205,34,86,219,153,32,236,29,50,129,22,211,158,157,5,169,236,250,202,102,193,231,174,243,69,50,64,218,95,232,77,218,180,18,171,102,142,108,204,130,180,100,76,42,150,168,32,3,63,218,131,51,192,174,115,68,181,169,44,176,114,136,224,247,236,23,89,65,38,143,133,136,109,99,43,249,107,198,130,170,140,37,120,254,227,88,27,216,172,237,14,206,156,175,101,188,13,252,239,244,25,72,38,6,45,42,158,18,227,82,181,216,39,112,145,109,4,189,106,200,41,40,229,17,74,240,116,201,33,65,166,138,131,71,187,57,8,54,22,87,234,240,239,65,85,46,202,58,207,200,198,34,31,161,69,155,147,147,81,247,195,7,109,188,242,114,42,105,163,100,172,56,138,245,11,60,61,196,77,68,208,199,253,154,82,216,225,67,235,68,90,80,8,163,13,82,13,228,32,22,132,30,11,176,177,141,234,240,251,225,238,225,179,195,156,187,170,227,39,43,125,2,129,249,97,154,48,187,179,185,122,254,201,185,42,27,61,148,97,252,188,51,159,179,59,201,76,192,16,99,55,223,179,59,165,18,119,107,131,186,155,97,106,122,56,171,204,45,89,227,7,242,42,199,42,32,79,178,74,83,66,124,105,230,89,183,143,77,158,85,183,201,191,81,126,222,162,0,139,59,209,60,91,132,204,123,180,179,243,8,193,15,244,118,222,14,111,39,9,66,214,121,149,221,157,247,244,238,110,43,103,43,168,185,197,216,187,31,161,224,138,175,57,253,54,234,157,103,107,68,19,6,161,226,158,165,238,146,157,119,94,171,142,88,234,192,14,129,151,88,116,39,217,124,167,152,156,211,123,207,36,68,153,180,18,175,171,48,84,4,16,65,101,150,254,168,0,194,219,21,64,108,229,107,49,160,216,193,87,237,131,60,155,175,65,158,175,149,194,143,10,28,175,106,128,45,166,255,56,11,236,237,105,129,243,163,176,143,157,216,199,4,87,224,170,29,198,85,101,235,243,135,113,5,174,110,13,173,10,246,55,31,198,109,227,173,14,178,188,199,5,89,194,161,125,38,159,245,143,36,150,252,216,143,149,215,213,163,35,134,173,110,109,245,207,35,134,162,91,219,194,223,202,178,171,25,252,195,36,119,181,223,
-252,99,245,56,193,93,61,74,112,75,216,12,124,62,215,194,122,188,67,152,79,182,51,91,139,206,143,149,232,217,177,18,233,147,74,50,125,220,44,100,156,108,99,57,96,95,147,236,147,189,45,241,46,30,87,22,104,139,199,201,143,19,234,89,21,161,94,179,28,143,144,235,217,63,49,200,159,48,212,221,57,231,157,237,136,134,49,42,249,209,83,222,187,93,83,222,234,179,92,226,197,203,34,124,133,83,68,15,73,107,233,38,201,125,20,251,83,16,154,91,214,192,85,108,241,131,134,250,157,99,251,89,17,252,221,67,161,216,240,115,187,218,63,191,182,65,182,142,141,233,221,236,172,62,143,110,130,208,222,212,202,234,178,46,102,69,89,90,87,187,90,0,214,77,82,121,136,45,95,131,182,148,173,195,187,64,207,10,66,249,235,40,154,151,237,68,83,68,174,239,118,84,37,229,59,88,76,231,54,253,216,154,220,102,169,31,221,135,13,159,207,221,7,160,53,124,216,176,197,78,65,238,135,137,14,247,128,124,111,236,153,193,138,219,79,197,89,7,107,211,33,46,9,201,94,136,125,84,192,184,13,237,243,84,50,182,33,216,172,248,187,246,107,152,55,15,112,151,167,85,227,221,158,40,205,216,63,73,35,18,87,163,94,144,140,109,72,101,157,151,29,14,229,63,107,39,183,209,189,248,125,90,30,40,137,105,203,24,80,28,120,248,251,51,112,215,165,211,45,215,15,250,100,6,168,77,152,130,159,41,181,19,26,207,20,241,36,37,251,19,1,194,178,77,77,177,39,145,246,10,170,157,252,27,70,85,110,137,44,54,33,127,170,69,202,196,145,164,78,187,243,209,81,63,134,99,182,58,221,226,209,238,114,65,140,43,201,145,3,194,173,237,252,224,157,248,50,221,114,90,160,131,152,74,122,150,59,245,99,250,181,121,191,29,145,36,69,19,55,209,105,22,7,225,114,147,254,170,221,182,13,148,158,188,145,95,111,5,224,16,76,52,209,31,14,156,9,12,254,39,103,52,112,122,108,236,80,208,128,37,102,240,233,164,146,220,153,189,125,124,19,86,194,129,220,192,250,124,102,93,66,224,166,89,178,141,84,131,120,221,122,91,141,150,218,111,83,110,246,32,114,198,195,85,0,162,74,187,31,137,190,210,14,89,80,37,29,146,107,71,170,27,43,119,158,109,101,56,252,63,181,48,174,119,197,38,170,180,47,57,122,222,29,124,24,181,7,19,230,124,117,58,151,16,233,65,140,167,131,189,53,96,54,25,178,139,203,211,94,183,163,170,201,168,108,29,216,6,85,236,58,109,79,216,117,54,155,161,20,128,23,162,227,71,72,118,41,215,174,175,151,101,227,31,136,77,191,204,150,3,220,235,75,225,99,94,49,196,38,186,38,158,168,241,148,254,207,173,4,84,155,71,158,171,142,116,82,205,91,32,68,64,250,65,156,90,7,236,106,57,249,130,216,50,64,127,88,62,76,64,122,235,134,167,27,226,156,133,59,183,103,124,181,66,176,35,246,59,91,225,142,2,182,178,18,136,182,93,60,116,99,229,185,190,31,131,39,178,114,48,238,129,145,168,111,34,179,46,14,197,213,91,186,137,164,190,41,166,224,32,151,109,113,253,72,131,197,238,212,218,12,220,68,229,150,97,69,137,188,214,173,170,117,33,11,60,4,19,147,225,37,4,179,121,6,209,36,88,130,38,11,56,73,107,132,39,54,209,171,225,222,245,48,113,213,60,9,232,16,177,25,185,53,170,134,166,140,182,12,195,72,208,225,191,76,28,239,161,237,79,242,108,86,121,111,168,254,20,235,54,202,105,214,0,155,246,134,250,252,58,187,105,208,191,100,128,181,213,151,91,226,215,206,74,251,215,45,136,84,210,51,172,81,127,137,21,202,99,133,177,56,119,107,206,214,154,8,66,170,159,60,107,43,68,65,187,222,0,247,183,109,112,166,25,47,57,113,247,45,117,85,16,128,199,101,115,19,140,131,154,60,62,151,59,111,11,31,193,130,142,225,88,153,32,85,55,168,116,210,156,228,77,196,65,13,27,17,7,122,109,191,93,122,4,12,136,133,94,79,137,222,146,237,241,82,95,54,156,195,194,46,10,145,210,251,231,232,162,140,194,225,33,218,169,143,28,188,117,87,145,167,24,87,174,33,75,23,247,199,97,7,54,77,66,4,193,4,183,33,158,198,99,118,139,42,72,4,224,166,168,60,141,150,21,112,32,216,38,227,101,58,163,226,190,127,218,159,157,120,170,117,105,39,26,
-217,171,23,99,81,98,44,58,195,139,43,20,138,8,108,47,113,0,196,29,44,62,186,188,114,155,45,192,202,14,224,198,209,61,196,21,218,30,204,230,190,12,51,192,54,128,182,39,128,214,50,15,117,138,157,235,219,212,25,249,57,149,237,109,221,245,47,97,114,27,229,139,202,175,96,74,213,95,119,106,131,172,161,99,140,77,207,183,147,58,37,232,23,129,219,188,38,230,222,128,193,191,193,175,36,245,125,190,154,38,120,115,11,94,223,54,233,14,174,114,7,91,206,134,16,254,58,107,65,23,98,168,227,97,87,168,93,47,137,190,219,31,62,140,156,15,184,232,106,183,160,177,91,97,245,78,146,198,253,118,175,247,124,52,25,244,251,16,5,21,156,15,206,232,153,104,210,216,247,33,169,120,216,233,73,41,82,200,247,33,104,228,180,123,207,68,142,64,189,15,49,162,249,103,34,71,33,183,103,139,187,41,2,44,207,69,15,161,222,135,61,120,218,233,217,148,190,255,8,98,10,7,224,158,156,34,137,191,202,136,45,163,199,219,198,101,37,170,176,133,125,108,163,162,232,81,166,177,58,73,123,153,70,69,211,99,44,99,117,146,246,177,140,138,162,71,24,198,234,4,237,97,24,21,61,123,219,197,234,212,84,182,139,138,150,71,152,197,234,212,236,99,22,53,65,251,90,197,61,200,169,106,21,141,194,247,157,103,211,246,254,254,180,236,111,19,247,35,168,138,77,92,185,241,163,163,69,186,137,44,244,248,118,162,116,11,149,44,98,142,158,125,237,225,158,4,85,179,135,57,138,246,180,134,123,18,84,201,26,230,232,217,207,22,238,73,78,21,91,152,163,102,31,75,184,39,45,187,45,97,142,146,253,236,224,158,180,84,178,131,121,114,246,176,130,251,18,179,211,10,22,84,188,239,60,155,126,247,247,165,100,47,11,248,8,114,170,90,192,71,134,132,138,162,229,110,146,42,135,132,54,57,143,181,127,21,233,169,110,255,30,25,12,238,73,79,101,243,247,184,72,112,79,106,170,90,191,199,132,129,123,146,82,205,248,61,46,6,220,147,148,202,182,239,49,1,224,190,180,84,50,125,143,137,254,246,86,236,254,158,132,60,202,240,237,65,77,21,195,71,151,82,134,229,118,79,102,108,162,72,84,221,78,142,68,95,201,232,89,164,172,219,60,149,243,4,196,84,179,120,22,53,107,6,79,102,60,1,45,149,172,157,69,74,209,216,137,244,19,16,82,197,208,89,116,156,57,157,110,63,103,234,68,198,19,80,162,81,87,36,37,111,114,49,245,4,68,236,54,182,54,51,246,178,181,251,176,162,138,157,181,9,201,155,89,72,61,5,17,59,13,108,206,134,216,246,21,83,79,98,61,250,251,81,80,48,172,27,239,241,122,36,45,85,236,234,183,204,197,107,97,185,109,89,155,236,219,154,172,236,176,177,10,205,118,218,116,99,186,161,18,201,217,78,162,50,138,101,52,238,178,189,123,18,105,154,218,155,74,105,46,203,136,220,97,147,247,164,81,55,180,55,137,106,107,215,58,133,219,109,245,158,4,170,102,246,166,79,154,215,50,2,119,216,240,61,41,212,13,237,77,34,26,223,50,250,182,217,246,61,137,19,77,236,207,60,170,80,202,187,173,54,127,95,214,201,102,202,236,255,46,10,1,81,41,125,91,156,193,190,212,81,19,123,243,14,45,103,185,5,236,59,79,102,254,250,143,165,140,108,250,38,242,182,58,143,71,208,40,27,171,228,222,189,40,142,27,252,216,248,16,126,178,119,164,142,56,182,147,71,173,232,38,42,133,235,138,48,99,206,129,178,253,3,247,138,180,153,86,170,133,239,138,58,109,200,129,184,125,227,248,138,164,233,38,42,5,243,138,48,101,192,129,174,253,130,250,138,84,41,252,85,2,123,69,147,176,138,64,81,245,152,186,34,53,2,243,238,168,90,81,162,44,32,208,178,159,165,173,72,207,54,11,251,178,195,168,100,75,91,195,139,14,89,59,254,155,227,243,119,108,20,252,125,199,55,236,33,247,127,105,172,244,190,238,252,209,59,86,126,82,9,170,36,116,235,224,230,205,104,0,242,114,99,235,174,49,82,218,228,251,129,125,73,39,61,109,81,135,177,169,171,91,249,112,91,58,208,75,103,232,22,162,27,116,240,201,163,195,117,180,75,81,158,174,21,39,92,113,92,239,248,3,158,144,76,88,227,128,193,127,50,201,62,183,71,157,143,237,81,227,231,163,67,54,24,78,216,224,178,215,99,23,35,
-136,252,70,87,236,147,115,133,187,127,187,131,177,51,154,160,121,28,22,80,201,175,67,64,211,187,116,198,128,185,241,170,125,118,246,234,176,41,63,251,221,129,78,156,79,156,145,78,40,117,214,25,189,158,249,180,1,123,95,218,87,99,157,26,24,220,131,43,253,57,238,152,207,171,126,223,153,140,186,38,103,50,236,91,169,203,201,112,218,29,0,119,250,206,96,162,114,79,157,243,225,200,49,169,15,134,234,83,112,246,230,123,242,197,113,76,17,89,102,43,5,92,234,182,123,38,99,0,60,212,169,222,240,84,127,235,220,142,213,237,14,116,163,125,230,88,73,251,91,183,3,163,101,168,195,161,179,191,219,29,139,117,157,143,78,231,147,78,88,237,119,134,237,158,51,238,24,244,195,126,191,59,201,167,38,206,153,201,24,140,39,163,182,213,87,200,249,12,18,97,146,23,166,71,195,209,200,25,95,12,7,103,221,193,7,157,73,194,104,82,195,177,30,209,206,37,192,91,152,69,114,122,102,195,203,188,209,176,183,150,135,209,88,89,30,69,104,197,2,186,56,83,230,157,181,53,201,48,209,177,62,113,206,99,37,123,109,35,24,103,206,121,251,178,55,49,201,158,51,177,10,123,93,224,155,51,26,155,28,35,151,103,67,243,133,30,75,167,70,67,77,166,211,238,124,212,223,231,32,145,186,37,167,103,100,1,191,187,231,58,5,162,124,117,97,13,150,99,52,4,154,111,95,152,122,48,98,186,203,206,215,142,115,49,177,82,189,75,35,121,206,215,238,120,50,54,41,232,211,192,240,4,210,40,102,42,121,222,182,104,59,239,13,219,166,100,216,235,13,191,88,82,0,61,178,62,157,238,7,45,198,231,163,97,95,127,95,26,149,80,199,197,84,250,131,51,112,70,109,171,183,31,64,170,13,105,20,52,152,196,240,82,179,246,99,251,179,69,200,199,225,165,166,228,227,229,7,199,146,236,238,25,8,74,119,162,25,101,56,221,237,117,63,233,142,26,13,20,119,59,233,196,192,72,152,176,154,38,101,127,98,152,105,39,71,120,158,209,202,208,210,210,29,155,175,97,175,109,51,227,223,67,67,69,207,57,215,213,109,58,73,36,117,98,216,49,188,162,132,173,61,58,35,167,58,144,251,201,176,187,239,156,117,47,251,86,87,250,206,232,131,198,0,5,151,70,31,250,195,193,68,139,243,160,61,185,28,153,198,7,206,23,243,249,85,99,27,12,59,87,29,163,27,131,97,191,253,149,28,139,149,211,29,20,114,172,218,6,169,37,67,248,109,70,113,112,9,36,27,119,48,60,55,95,231,99,71,227,26,246,116,159,13,195,135,131,158,150,139,225,133,61,20,70,176,135,163,51,51,178,195,201,71,203,28,12,47,45,219,60,252,108,190,47,218,163,137,229,55,40,105,99,191,24,142,243,233,145,211,113,108,243,10,25,32,106,159,29,147,38,247,109,37,63,119,123,32,114,99,147,51,4,12,151,198,178,137,216,89,165,64,141,204,168,130,233,62,179,190,123,230,27,76,253,217,216,36,207,29,48,178,29,103,45,199,34,20,188,238,112,98,97,30,180,251,86,234,2,156,68,219,178,141,144,3,68,181,77,18,36,211,40,20,38,97,36,173,52,94,233,145,79,89,180,124,30,26,173,24,117,63,124,52,245,192,76,157,182,141,163,28,13,191,232,106,99,208,4,67,207,184,253,217,185,24,90,210,15,74,59,52,230,86,156,87,53,169,191,46,145,29,38,109,199,6,34,213,253,111,187,187,99,103,60,134,81,206,121,41,75,36,199,221,28,45,114,18,173,211,67,195,201,49,176,109,50,189,176,120,53,158,156,25,91,1,9,16,69,147,26,142,218,102,180,129,167,78,187,111,165,172,209,27,95,158,22,50,138,177,22,200,187,110,102,210,53,162,32,215,35,116,82,155,55,112,37,131,113,59,103,227,213,117,54,58,105,148,253,114,112,58,188,4,123,123,102,50,214,130,149,203,193,154,75,164,251,98,173,196,95,22,198,11,59,208,176,57,127,57,182,58,42,162,91,147,26,217,113,23,36,175,108,216,174,49,110,95,44,126,192,183,209,183,47,31,187,102,44,241,101,11,253,61,28,105,73,252,50,234,26,218,190,246,123,16,51,219,169,9,112,234,20,108,202,216,202,68,118,88,209,20,229,12,58,109,59,227,108,216,185,44,192,128,224,22,114,208,63,143,237,12,212,212,241,69,187,147,107,13,68,108,108,19,120,209,181,18,116,157,129,149,150,119,116,
-155,140,137,101,249,33,9,60,238,138,193,128,25,7,77,1,202,38,47,160,16,184,10,113,198,208,24,151,159,20,215,176,185,85,215,181,249,144,184,36,17,207,118,171,41,145,201,193,219,142,152,94,168,42,157,23,53,139,85,104,70,172,102,83,39,191,88,179,41,33,114,242,24,229,103,60,132,143,199,195,238,96,38,46,142,90,125,155,191,9,66,111,158,249,252,13,158,192,151,23,24,180,96,78,199,241,30,128,108,97,53,147,252,73,15,166,211,129,245,247,236,168,41,142,114,189,103,199,77,182,224,241,13,159,170,162,183,120,109,1,204,39,23,240,253,51,30,84,95,68,41,93,94,218,20,111,205,45,97,250,236,106,232,95,233,253,133,1,128,252,41,174,9,72,216,49,32,63,6,180,39,71,52,221,124,123,68,7,165,147,135,16,230,156,48,211,164,23,79,197,3,13,153,7,147,233,38,82,123,64,207,86,169,119,151,104,238,218,98,103,17,77,188,241,49,221,27,46,102,172,46,189,178,249,96,94,148,184,126,96,195,179,211,142,188,10,131,238,1,78,26,240,53,133,17,152,210,152,77,39,87,23,206,88,220,147,253,111,0,133,238,166,183,17,140,242,13,79,9,126,130,220,105,16,0,162,81,217,120,50,173,56,127,205,13,125,110,212,155,197,17,181,103,182,192,144,87,182,131,2,230,216,218,14,28,23,241,16,179,129,128,247,210,168,230,178,127,129,108,225,13,115,217,191,82,54,185,61,147,143,231,148,55,177,93,189,39,28,93,255,45,222,20,198,183,50,26,174,239,67,209,241,17,75,35,81,59,105,201,139,145,91,242,46,44,188,9,130,30,113,178,203,36,46,124,3,53,206,248,97,139,58,137,189,30,95,141,39,78,190,3,40,26,42,95,49,97,43,161,128,121,25,197,248,250,87,145,78,144,176,40,70,1,219,74,173,184,30,140,30,69,14,149,140,226,250,142,70,43,7,30,175,38,8,210,169,56,221,47,250,112,130,125,16,83,5,6,244,94,128,199,3,37,182,123,243,22,33,40,2,94,7,40,49,71,182,0,85,176,72,54,248,118,163,100,46,76,203,89,166,66,118,101,243,84,172,151,179,81,199,79,98,163,80,237,255,100,255,75,188,35,205,132,145,159,158,65,44,7,126,122,208,185,66,195,36,244,215,202,59,105,178,86,171,5,5,160,210,57,216,95,90,107,186,186,206,145,117,102,52,75,59,106,171,46,9,171,237,128,78,10,186,140,202,219,25,246,46,251,3,75,111,241,230,55,163,174,150,170,163,154,90,193,194,111,144,44,76,85,127,71,252,185,72,230,15,200,25,126,49,243,67,82,44,123,246,72,26,117,110,218,60,70,26,11,97,228,49,210,89,140,222,143,145,214,83,224,228,104,120,113,161,195,158,99,164,25,57,92,42,193,107,108,173,32,198,107,117,182,203,178,90,251,205,73,114,46,179,178,28,231,107,229,164,248,237,209,19,121,90,35,196,231,116,107,37,72,46,189,129,52,69,118,163,200,158,79,113,209,18,29,43,0,116,123,19,116,171,231,83,241,24,193,47,84,60,104,247,174,38,221,14,251,21,83,189,97,27,166,130,236,183,117,145,46,50,166,200,147,102,73,127,215,132,25,12,172,27,107,64,75,170,47,212,25,109,75,178,219,250,247,153,66,5,148,156,243,96,142,239,35,21,74,80,122,206,205,81,114,252,21,0,109,175,188,121,202,210,131,118,232,206,31,112,233,185,128,0,149,162,23,185,126,14,117,137,36,22,184,81,65,14,11,53,42,74,225,28,194,143,204,189,209,146,168,210,149,133,80,87,200,71,122,79,46,127,36,117,32,128,211,30,76,195,167,72,19,88,10,147,1,132,162,81,53,25,120,83,201,137,157,129,50,154,71,114,113,69,50,105,225,184,192,188,223,154,57,152,19,246,123,161,158,128,59,97,127,228,1,223,82,112,88,4,131,220,227,45,194,110,241,223,98,125,51,207,214,98,184,213,13,229,239,77,29,43,230,50,11,180,100,33,255,234,89,146,62,178,36,243,226,1,34,68,91,28,69,6,235,187,248,126,152,101,168,69,254,137,101,168,101,78,30,148,44,182,40,121,107,219,108,153,165,129,183,9,185,225,194,62,130,110,106,109,23,118,152,250,228,172,173,74,87,150,113,93,225,25,34,5,156,205,32,110,188,89,13,103,53,88,95,181,247,39,91,194,103,147,101,244,239,12,254,109,149,253,234,164,58,103,245,171,153,167,185,40,64,23,113,176,192,224,240,19,
-127,176,36,232,50,12,190,65,72,105,50,81,144,206,229,245,180,148,91,62,7,173,110,163,12,240,246,17,163,119,9,114,99,102,114,42,143,154,85,229,153,102,161,197,113,11,252,239,114,220,240,206,86,32,244,123,147,158,4,20,95,209,82,102,133,145,248,139,207,0,226,43,126,148,162,203,132,240,209,70,142,183,10,127,95,31,232,28,79,114,236,104,22,187,90,28,238,143,64,141,53,206,255,6,146,172,17,30,98,171,108,137,15,173,199,43,244,102,183,6,28,141,199,32,122,77,248,45,231,216,21,148,91,78,113,40,72,47,21,17,155,242,10,66,98,131,111,23,19,32,98,21,204,57,88,73,47,242,181,168,228,115,133,184,108,151,148,66,141,103,142,164,176,46,46,62,79,101,183,97,72,40,41,86,221,208,105,81,82,142,255,207,50,41,126,86,147,190,136,114,212,54,144,227,95,37,136,96,230,219,147,53,209,89,227,211,26,139,154,101,60,88,139,174,236,165,92,148,156,220,58,33,201,133,253,227,206,239,116,85,180,245,99,32,18,250,74,82,173,228,11,209,232,31,168,240,69,108,124,1,27,23,64,96,194,122,77,183,148,106,194,18,6,158,4,215,103,112,113,38,10,97,34,141,91,33,228,109,245,120,35,157,120,114,65,137,173,160,182,153,163,241,23,147,159,35,245,87,77,123,30,254,183,34,124,190,248,15,83,156,239,232,145,102,78,161,224,184,72,88,161,252,196,16,146,47,120,187,70,73,190,252,231,98,15,10,229,191,108,232,137,6,43,209,219,162,216,84,208,221,98,149,156,254,190,236,110,41,217,221,210,206,32,76,138,89,191,245,137,199,9,190,58,175,184,148,120,113,176,76,217,77,176,226,180,46,200,124,176,38,215,110,130,59,97,22,65,136,93,114,83,168,25,132,9,145,0,148,35,148,120,36,158,58,167,94,145,85,44,89,66,11,1,182,145,218,106,131,37,11,247,123,176,200,22,120,85,238,195,77,28,101,144,141,11,144,136,133,150,195,228,147,182,164,152,1,222,83,237,103,48,155,98,217,50,162,70,23,180,78,122,250,32,86,51,209,133,136,219,239,232,66,200,5,12,243,156,46,240,146,11,180,126,16,195,72,207,31,196,35,186,134,202,89,20,35,154,7,78,82,112,141,87,77,186,184,16,166,250,157,208,32,93,227,173,124,120,3,52,247,91,250,158,83,209,105,213,98,190,231,80,135,127,199,203,143,129,44,205,66,129,137,124,238,117,254,54,100,65,227,146,186,136,85,204,46,48,129,188,113,136,181,186,41,46,22,163,203,196,21,187,212,38,65,94,249,231,206,102,110,16,39,248,230,17,111,105,202,0,15,190,240,75,13,207,204,35,49,184,113,201,122,6,64,178,187,73,5,203,40,73,2,122,1,78,175,233,209,141,240,250,153,97,241,36,177,220,139,150,176,123,78,46,9,212,1,143,10,99,189,136,249,28,21,10,103,241,64,106,16,51,119,197,137,156,57,15,111,210,219,13,23,208,215,37,209,245,226,253,109,224,103,107,117,177,231,202,190,164,141,202,236,12,209,189,28,8,56,117,59,141,178,97,165,139,151,195,18,142,44,52,215,197,31,212,16,195,125,224,167,183,242,182,56,201,194,224,63,220,192,220,114,119,89,200,1,134,129,252,232,244,146,56,136,55,168,114,55,164,11,230,100,40,102,181,148,68,116,37,165,1,138,249,106,45,175,158,81,204,92,183,178,196,203,219,254,119,137,169,244,182,58,205,218,146,203,231,116,89,249,245,115,214,168,136,48,36,166,160,98,65,130,56,67,57,16,15,189,170,215,113,132,16,161,176,172,2,31,37,84,185,201,237,67,206,146,220,61,212,47,227,255,220,227,95,101,28,96,76,95,70,229,127,248,168,52,153,247,50,70,63,102,140,208,249,23,124,219,154,235,119,227,235,32,37,167,169,124,127,19,61,228,12,92,51,190,168,42,110,183,38,15,73,139,220,65,154,72,3,138,175,119,204,231,209,189,136,12,92,25,3,9,38,171,120,42,198,219,127,211,64,252,228,198,93,239,86,26,87,242,201,109,237,244,41,2,98,118,8,132,118,154,66,36,228,53,132,17,128,153,16,99,216,119,27,221,99,108,2,77,255,169,164,80,84,146,23,217,230,99,170,39,19,40,45,30,117,117,15,107,94,128,106,53,188,71,92,222,201,236,179,48,91,92,243,152,56,145,65,144,145,0,188,79,65,150,103,85,193,37,145,28,215,20,136,85,93,134,45,80,31,162,217,133,
-69,1,214,86,113,138,144,91,3,141,191,140,122,243,232,26,106,129,251,227,49,199,171,83,180,36,97,77,250,253,220,77,114,97,149,6,69,158,145,60,230,235,4,128,31,131,79,241,106,53,93,137,30,114,78,161,153,20,0,254,189,178,48,215,149,52,43,118,80,127,66,181,198,131,215,84,75,140,224,199,81,6,49,230,23,3,173,194,92,255,111,152,61,224,111,196,120,225,238,140,2,1,138,52,195,52,240,130,37,13,3,8,45,104,135,14,107,81,158,116,80,108,139,157,68,137,20,173,176,26,61,244,6,48,94,22,199,56,31,208,24,178,4,111,216,221,116,137,178,37,123,1,62,173,112,205,161,103,7,53,200,224,41,183,222,222,41,74,41,40,107,13,230,41,160,44,226,254,224,82,32,48,28,34,218,249,218,82,34,221,196,111,33,204,244,41,197,88,100,163,0,227,151,150,92,76,144,208,54,241,183,129,92,193,204,157,163,230,127,109,137,161,195,47,61,142,132,77,14,32,126,107,51,84,22,115,177,175,216,151,108,233,211,189,103,155,186,145,26,89,195,167,156,227,12,68,78,62,157,25,133,160,14,13,249,71,247,83,118,242,144,30,17,160,62,30,210,187,164,7,181,154,122,117,82,212,80,127,235,179,59,89,87,190,133,138,239,22,220,9,44,50,231,144,178,64,240,1,163,202,99,135,128,17,247,21,215,232,228,68,171,142,47,118,213,89,123,140,203,96,2,186,142,111,47,212,84,185,124,138,149,64,12,182,28,136,136,51,5,18,77,67,14,66,134,164,10,137,36,28,32,104,247,23,99,54,233,129,143,207,186,74,82,36,242,41,100,34,62,124,98,77,151,216,128,162,135,121,40,205,30,13,168,154,16,37,165,72,241,177,178,58,251,47,249,218,110,133,113,182,172,222,123,166,76,38,106,122,130,215,145,211,213,249,10,66,137,128,52,189,239,217,43,249,248,218,43,52,103,34,247,253,43,52,107,175,222,29,240,208,55,207,120,72,15,97,30,89,88,159,219,123,17,206,245,82,179,74,128,117,181,107,148,83,212,5,189,210,33,236,240,93,178,196,215,105,208,192,73,19,103,45,15,168,183,28,200,100,137,37,130,108,9,229,215,180,52,64,75,2,216,51,61,53,21,239,14,139,77,45,96,46,196,66,129,48,34,126,75,245,66,209,30,243,111,89,16,211,140,133,218,181,77,52,174,150,39,228,6,151,243,32,69,138,193,218,11,179,183,116,99,97,247,240,108,85,121,128,102,66,154,70,104,5,100,129,126,186,202,215,23,192,171,176,76,134,26,210,144,121,200,184,26,245,15,17,192,16,73,131,254,10,73,80,191,248,178,224,93,30,72,12,162,13,113,242,83,17,38,89,0,199,112,205,60,15,7,83,187,34,228,26,208,207,37,64,130,238,60,220,239,37,112,183,217,13,95,3,60,254,181,4,82,63,179,176,5,169,130,213,130,139,144,160,68,130,111,2,6,190,211,6,249,94,201,107,246,175,127,1,150,34,255,182,0,3,121,101,60,218,82,227,237,73,41,195,106,28,172,126,177,35,53,142,107,197,46,62,58,80,90,110,138,133,14,150,9,154,138,147,27,233,178,76,204,238,217,22,25,131,40,131,97,181,127,253,151,197,71,210,50,153,73,22,0,226,117,193,90,73,221,145,164,44,152,189,83,15,216,176,227,163,147,159,143,216,255,134,134,127,98,247,91,201,133,152,157,200,189,214,1,138,166,118,19,153,198,134,133,81,248,26,205,11,233,62,250,11,209,135,107,237,217,242,148,218,124,180,169,61,218,70,161,154,69,32,145,134,143,97,201,60,106,141,153,5,69,5,66,192,166,104,153,166,151,248,242,153,90,19,115,185,107,25,82,195,114,121,74,155,114,153,62,247,32,40,158,23,50,161,139,69,90,148,126,229,178,129,25,197,170,81,134,123,73,138,124,37,193,167,177,62,106,29,159,88,10,160,121,205,42,50,219,118,101,207,183,182,87,156,127,62,110,190,249,140,243,75,29,190,74,158,201,232,179,107,69,159,93,19,125,118,173,232,179,171,163,79,202,197,126,230,58,216,176,1,100,68,10,89,58,84,56,180,186,158,131,53,32,148,50,51,162,67,201,26,85,195,204,122,44,26,16,200,86,36,67,156,106,3,33,186,58,6,238,218,49,112,215,138,129,187,58,6,62,168,109,14,234,89,183,32,100,230,101,78,11,116,195,235,156,57,17,124,39,231,203,217,130,118,37,200,144,70,206,122,75,162,134,128,66,4,119,229,
-6,115,130,113,205,219,127,72,131,142,56,220,236,123,48,15,16,165,24,27,8,136,194,40,149,209,144,250,205,67,196,65,129,120,230,8,109,157,20,37,181,78,138,191,129,68,217,220,167,41,89,118,131,4,168,159,145,92,177,18,223,136,105,15,120,144,102,52,209,61,92,227,135,136,144,173,46,31,24,166,20,167,0,77,160,171,65,195,118,136,253,50,226,5,220,105,24,17,163,66,147,148,229,74,168,168,84,37,84,25,105,150,40,161,79,153,111,52,76,52,168,147,170,77,156,22,138,77,209,130,49,239,197,108,74,120,92,180,246,226,241,55,242,165,71,12,36,130,240,104,222,31,108,24,116,134,63,52,45,113,113,165,200,130,151,131,240,63,250,167,66,185,151,92,245,157,86,107,86,60,38,149,48,135,237,109,204,173,178,253,24,230,153,209,134,118,17,56,205,82,111,180,149,184,9,189,34,41,203,201,67,230,158,252,170,139,159,177,44,251,191,230,90,140,173,215,57,97,48,183,93,6,112,97,69,191,206,201,102,65,201,114,233,221,46,101,227,51,194,46,238,244,4,107,11,77,0,86,38,159,200,205,209,92,182,144,41,171,253,3,172,77,92,169,212,241,209,115,183,208,100,233,245,252,255,75,107,248,186,100,181,150,95,172,70,137,213,160,157,50,242,12,139,126,118,146,101,120,109,19,208,126,191,182,198,12,112,6,204,236,194,14,252,195,131,26,116,183,33,253,86,32,87,17,53,236,161,232,57,26,136,119,242,202,19,9,42,194,206,28,222,146,215,183,128,129,55,55,248,86,49,129,78,197,210,203,84,46,29,49,119,134,187,177,229,122,140,138,99,101,25,46,34,208,234,59,253,248,78,17,2,30,180,65,152,2,26,8,53,216,246,246,212,198,136,146,230,84,89,133,230,82,121,198,10,90,43,14,129,68,98,248,47,27,81,216,113,81,73,130,138,249,213,187,53,20,170,223,107,56,84,193,6,28,120,69,16,13,29,218,66,24,191,243,79,234,230,148,192,79,154,106,237,123,129,131,163,243,81,182,142,88,3,5,222,190,107,229,240,64,238,86,163,240,134,182,234,225,127,184,67,72,175,174,65,219,13,185,120,137,141,141,134,253,220,168,137,181,63,210,98,156,148,61,36,175,14,101,158,141,225,136,225,250,156,201,193,173,120,221,129,141,216,132,23,2,49,24,106,139,54,35,114,255,67,104,195,129,88,224,254,140,4,77,35,202,205,13,79,19,121,62,139,251,7,226,232,46,192,253,63,243,13,233,55,
+{120,218,237,125,91,115,219,184,178,238,179,244,43,80,58,15,145,231,40,138,237,204,61,43,187,74,145,233,68,43,186,120,36,57,137,247,169,83,42,154,130,108,142,37,82,225,69,142,215,175,63,221,141,43,41,74,34,61,113,206,126,240,84,77,76,128,141,198,135,70,119,163,1,129,192,203,151,108,122,235,199,108,18,166,145,199,89,55,156,115,118,30,70,43,6,121,113,122,253,55,247,18,150,132,44,185,229,44,225,209,42,102,225,130,18,131,240,63,254,114,233,178,139,244,122,233,123,245,151,47,89,223,247,120,16,243,22,219,180,217,105,251,184,205,88,111,193,92,230,133,235,7,93,232,162,207,238,221,152,5,97,194,230,126,156,68,254,117,154,240,57,187,247,147,91,32,240,99,228,179,240,151,192,228,42,76,153,231,6,44,188,78,92,31,254,4,156,185,9,187,77,146,245,159,175,94,173,68,229,237,48,186,121,5,60,95,65,117,175,218,80,22,139,119,161,190,200,191,185,77,216,201,31,127,252,198,94,178,127,167,203,7,118,122,124,252,59,235,126,238,181,88,39,189,73,227,68,100,188,132,63,39,191,65,91,2,158,156,189,99,239,218,159,218,245,186,23,113,55,225,8,3,26,204,22,105,224,37,126,24,176,198,210,191,227,141,230,198,93,50,4,30,220,180,216,26,16,169,103,30,123,242,249,136,241,111,80,50,0,194,192,93,1,236,229,13,191,142,220,182,96,240,102,39,127,255,31,87,224,31,168,97,95,5,79,130,250,32,210,250,77,228,6,9,80,113,15,20,1,122,121,7,104,214,84,204,179,127,143,80,55,215,164,130,111,74,240,242,191,39,179,66,94,223,5,80,134,9,234,244,179,133,102,44,180,59,118,58,83,135,157,95,14,187,211,222,104,200,230,252,38,226,60,110,70,108,30,66,99,249,81,125,236,76,47,199,195,137,76,215,107,34,205,162,159,78,126,63,126,181,246,155,71,111,182,185,68,238,220,119,131,184,57,63,196,101,254,19,114,120,5,172,10,21,88,117,174,68,181,95,33,20,177,172,252,185,227,247,118,60,240,184,136,194,141,15,130,112,89,236,175,214,75,206,248,215,212,7,239,195,65,176,139,48,162,182,92,14,123,95,88,226,175,64,248,94,184,90,185,193,28,75,138,140,99,6,130,74,99,176,66,122,138,31,226,132,175,196,243,49,3,31,55,199,191,247,145,159,240,88,15,5,235,40,244,248,60,141,184,224,209,60,170,103,221,90,252,117,217,166,55,69,250,144,43,252,220,195,165,6,95,101,23,0,115,150,132,179,57,100,54,99,237,175,161,163,87,214,32,19,241,36,141,192,120,144,170,94,203,246,205,10,165,222,110,88,124,112,216,201,87,131,249,248,30,200,208,254,33,181,179,18,145,222,81,141,197,167,168,26,137,2,105,15,183,6,169,246,183,6,19,69,213,96,190,105,13,166,30,215,26,139,207,129,214,196,137,187,90,151,107,18,145,30,110,23,145,237,106,28,189,204,182,144,178,30,223,76,155,99,99,175,91,183,52,169,156,107,183,116,162,92,1,75,10,229,10,88,253,84,185,6,106,120,249,106,108,57,61,187,178,67,131,213,95,151,206,248,138,125,232,77,166,163,241,149,16,17,103,95,83,30,61,48,0,153,132,240,119,197,189,91,55,240,227,21,182,77,50,120,53,249,171,15,170,187,244,97,184,0,185,187,108,193,239,217,109,24,222,197,109,197,100,21,66,221,48,0,134,81,130,221,133,205,2,65,187,236,102,25,94,99,40,46,134,181,141,27,249,46,132,46,236,254,214,247,110,65,132,65,18,133,75,146,14,112,8,124,64,0,102,129,53,187,75,40,196,227,24,250,57,46,114,195,15,113,155,112,47,195,155,153,231,38,46,252,133,97,80,219,53,86,210,172,215,252,57,11,253,121,171,94,11,239,3,24,97,165,55,168,215,230,124,225,7,220,54,212,122,77,136,65,147,172,253,53,55,169,198,122,233,6,13,149,174,213,0,240,16,45,22,101,212,233,51,124,91,175,173,160,161,126,144,136,215,177,255,159,220,235,112,13,213,97,238,181,127,3,100,53,25,2,64,17,28,255,189,122,209,40,158,111,163,80,108,199,5,225,9,188,30,10,10,85,26,68,7,13,2,94,164,209,36,100,124,71,178,237,36,208,123,55,233,210,141,16,31,143,32,60,137,137,46,219,245,162,84,124,27,166,203,57,187,134,242,75,238,130,148,218,218,150,80,111,33,127,142,189,11,81,76,10,252,31,
+80,33,144,21,170,8,244,103,28,162,146,67,220,115,205,169,46,176,94,48,4,228,32,161,221,113,190,254,139,170,133,48,136,82,93,108,66,186,6,62,1,215,181,65,144,227,70,32,5,64,11,106,4,193,202,13,119,177,129,96,43,105,48,135,76,80,179,57,234,10,242,140,120,44,172,220,91,186,254,42,150,28,30,32,127,177,36,59,7,26,190,88,224,163,52,216,36,4,113,178,251,48,186,91,134,238,156,173,252,111,12,66,34,228,39,28,13,232,152,6,242,194,91,167,47,216,141,191,225,66,104,238,134,71,238,13,84,182,78,25,149,94,115,168,59,72,48,47,132,119,164,187,30,116,71,44,101,131,140,32,192,195,87,249,74,216,250,214,141,121,91,200,7,149,60,198,215,154,179,15,109,132,158,7,78,215,60,193,153,26,40,10,54,97,149,46,19,255,37,213,97,96,250,225,11,93,128,245,70,177,170,12,66,78,136,75,19,213,219,81,106,53,45,94,187,30,127,129,10,100,164,226,174,194,52,32,73,145,178,172,56,204,4,16,130,176,65,210,177,193,59,98,49,134,56,210,83,157,64,172,168,50,80,143,128,156,1,132,198,80,14,196,67,163,96,224,241,87,164,141,32,30,180,4,40,39,85,159,84,129,44,30,244,16,197,8,249,215,15,9,47,97,249,160,225,187,237,190,86,99,80,31,104,1,143,56,212,30,75,9,8,115,132,193,221,141,146,134,229,3,180,69,82,115,18,168,118,133,13,65,199,78,180,160,199,88,42,92,151,44,164,4,15,70,2,238,198,143,111,145,129,27,221,164,72,161,99,19,100,224,122,9,24,147,48,102,200,78,33,25,65,172,149,164,80,62,150,254,66,184,149,32,93,93,131,30,160,26,139,151,210,172,64,19,64,39,64,205,146,122,13,122,56,83,134,224,197,107,132,213,148,18,63,98,96,70,137,191,180,203,242,111,232,189,235,181,248,214,95,151,40,15,131,39,81,230,107,71,229,213,69,247,217,74,222,22,160,219,66,44,89,163,146,22,33,213,127,239,250,9,146,227,156,170,55,194,218,133,76,15,185,77,80,16,225,52,165,34,9,39,183,241,249,125,76,188,192,103,109,120,224,163,126,40,93,195,151,133,35,12,67,77,224,228,82,126,98,139,40,92,237,24,135,222,236,227,4,128,14,242,33,173,222,195,69,121,108,55,174,75,62,95,231,237,159,90,12,154,46,213,186,37,30,65,87,41,87,107,29,165,132,234,208,35,232,10,253,197,174,164,7,232,41,250,235,135,245,61,45,132,250,90,133,160,161,104,253,254,22,236,13,17,129,25,190,37,94,115,178,112,200,17,227,240,91,154,240,138,110,1,213,225,137,30,130,176,71,92,116,253,137,239,209,120,133,132,219,211,222,76,205,124,181,78,30,154,123,213,128,72,68,125,224,135,252,53,176,78,184,53,2,2,205,205,225,122,2,242,46,251,43,34,154,55,229,56,37,183,208,248,219,16,6,219,24,66,135,37,168,126,9,222,51,93,234,80,45,16,136,30,6,44,137,158,3,230,226,128,121,229,222,9,61,9,23,11,232,32,120,142,92,49,226,145,27,113,55,174,191,164,39,84,92,63,0,39,73,163,84,225,168,133,69,185,136,83,107,153,1,139,193,136,85,227,27,26,52,49,100,226,145,112,158,34,203,195,209,24,148,179,86,243,150,119,24,65,67,124,30,53,79,143,143,104,228,184,7,197,241,150,161,119,215,2,89,138,9,36,14,9,119,208,223,124,9,101,214,158,46,242,139,44,178,10,231,233,146,183,21,182,255,19,68,255,23,8,81,173,40,226,80,78,95,166,231,128,193,95,248,4,0,140,242,46,222,30,26,160,190,149,239,69,33,140,11,97,48,143,129,48,138,226,193,187,12,33,232,44,177,130,249,197,10,13,157,130,8,160,220,172,114,132,27,63,162,177,144,226,103,69,37,214,193,138,199,193,107,108,125,76,75,101,64,41,86,202,246,147,34,77,194,97,188,169,65,16,178,128,113,203,166,134,44,232,202,53,142,59,11,23,6,53,108,206,202,253,123,139,204,253,123,139,44,216,120,241,125,182,234,48,120,185,9,33,220,0,159,252,128,67,13,88,34,139,65,201,189,91,160,143,147,149,90,25,168,89,81,128,9,34,228,164,23,218,117,148,95,42,64,35,158,167,56,245,69,173,50,203,18,122,172,80,218,86,60,214,24,93,124,182,252,98,203,119,227,56,197,37,25,168,196,151,138,13,179,86,30,136,128,1,131,65,148,201,
+180,55,112,38,211,206,224,162,208,226,27,124,29,122,183,141,38,134,184,239,122,239,123,195,169,89,1,50,37,115,61,171,67,75,85,252,77,253,32,243,167,225,156,88,188,12,123,168,235,123,50,102,159,123,211,15,148,100,255,61,26,58,149,235,217,179,168,100,106,100,77,37,254,114,203,81,118,201,71,22,179,36,247,15,10,111,73,231,121,137,235,128,221,58,223,96,230,224,163,251,4,173,129,73,32,78,137,249,183,122,113,172,36,50,195,104,14,69,144,172,9,153,122,205,24,198,102,253,236,133,234,231,228,66,79,156,231,243,102,71,125,243,40,92,255,243,218,178,92,160,174,103,85,40,84,133,79,174,151,166,43,0,31,113,136,247,193,200,64,136,249,53,46,90,203,34,224,158,27,137,133,24,144,91,75,196,124,254,252,133,88,124,130,89,8,173,123,252,29,250,193,75,90,99,161,181,9,83,7,74,6,57,199,16,24,60,168,165,15,156,167,90,139,31,52,7,2,121,221,65,176,24,38,107,232,189,68,47,196,0,13,247,111,48,110,163,48,1,100,10,226,194,53,2,3,20,58,125,205,241,17,105,105,132,2,118,17,127,137,30,17,58,15,87,23,152,187,192,69,34,196,238,45,65,60,24,245,0,0,87,44,103,21,168,228,45,128,184,219,161,134,133,170,39,74,20,169,119,196,65,72,85,88,81,129,34,78,27,18,105,21,86,162,196,155,103,59,40,180,131,137,119,203,87,46,139,217,173,139,43,242,115,190,230,224,55,2,143,150,110,233,151,231,180,96,7,131,36,242,121,60,139,137,65,60,11,131,25,146,227,130,155,218,137,48,237,188,235,59,172,9,20,122,154,113,114,12,243,12,224,27,229,114,128,229,44,121,88,115,157,253,250,244,72,49,82,124,38,78,223,233,78,89,220,198,174,5,38,242,239,139,51,231,98,118,57,113,198,47,100,4,43,0,81,104,219,162,38,196,44,101,98,217,33,109,207,57,69,228,18,54,123,11,236,252,185,136,115,47,177,181,77,90,132,56,218,22,7,116,140,44,19,239,23,8,49,32,121,72,36,79,46,17,87,74,34,182,37,50,233,126,112,6,157,66,153,184,105,114,139,173,19,50,137,245,186,139,43,69,1,178,152,146,39,76,10,181,130,102,17,155,253,66,16,254,14,133,64,139,105,79,46,130,68,54,125,99,139,224,83,207,249,44,5,32,253,47,180,38,105,89,137,77,43,3,27,179,32,45,5,147,136,37,42,200,192,135,206,240,12,184,235,28,81,108,38,95,88,57,4,248,45,251,69,22,144,201,19,161,98,251,196,74,227,53,99,126,89,193,18,61,255,113,162,245,109,209,246,134,103,206,151,34,217,250,243,111,244,232,75,33,250,109,122,61,35,193,37,106,177,79,240,34,223,8,118,213,148,83,80,202,35,150,48,210,197,71,68,153,40,9,30,31,150,32,248,88,92,169,195,191,245,178,82,148,101,158,80,140,121,57,66,141,182,36,167,227,222,251,247,218,121,101,245,84,98,163,100,164,36,138,229,115,50,61,194,77,68,208,198,106,85,41,238,240,160,109,34,201,25,132,177,6,105,6,178,19,115,74,143,47,176,178,157,230,240,251,209,225,238,179,195,156,187,178,253,39,11,125,4,133,249,97,150,176,184,179,165,122,254,209,185,42,234,61,212,97,124,188,51,143,139,59,41,76,224,16,97,51,223,178,59,101,18,119,91,157,122,88,96,106,122,184,40,45,45,89,226,7,202,42,35,42,128,39,69,165,145,144,92,90,89,209,85,241,201,139,242,62,249,55,202,207,122,20,16,113,55,92,166,171,128,121,143,30,236,60,98,240,3,71,59,239,192,104,39,1,161,232,188,210,195,157,247,253,135,187,189,146,45,97,230,150,96,239,126,132,129,43,185,102,236,219,152,119,86,172,33,77,24,132,137,123,150,185,75,113,222,121,237,6,114,105,128,56,4,95,18,209,157,20,243,157,18,114,198,238,61,147,16,239,164,151,120,89,70,160,34,128,240,75,139,244,71,5,16,222,161,0,98,175,92,243,1,197,1,185,234,49,200,179,229,234,103,229,90,42,252,40,33,241,178,14,216,18,250,143,243,192,94,69,15,156,237,133,42,126,162,138,11,46,33,85,59,140,43,43,214,167,15,227,114,82,221,27,90,229,252,111,54,140,219,39,91,29,100,121,143,11,178,196,128,246,137,198,172,127,164,177,52,142,253,88,125,221,60,58,98,216,59,172,109,254,121,196,144,31,214,246,200,183,180,238,106,
+1,255,48,205,221,84,155,127,108,30,167,184,155,71,41,110,129,152,65,206,231,90,89,79,14,40,243,233,126,97,107,213,249,177,26,189,56,81,42,125,90,74,167,79,90,185,140,211,125,34,7,238,91,154,125,90,217,19,31,146,113,105,133,182,100,28,255,56,165,94,148,81,234,45,207,241,8,189,94,252,19,135,252,17,67,221,131,115,222,197,129,104,24,163,146,31,61,229,189,59,52,229,45,63,203,37,89,60,47,194,151,248,138,232,33,110,175,221,56,190,15,163,249,12,148,230,150,53,113,21,91,252,160,161,126,231,216,255,173,8,254,238,161,88,236,248,185,93,237,159,223,218,32,219,192,202,244,110,118,214,88,134,55,126,96,111,106,101,13,89,22,179,194,52,105,168,93,45,64,235,198,137,252,136,45,91,130,182,148,109,211,187,128,103,3,161,252,117,24,46,139,118,162,41,144,219,187,29,213,155,226,29,44,166,113,187,126,108,141,111,211,100,30,222,7,205,57,95,186,15,128,53,120,216,177,197,78,81,86,227,68,31,247,128,126,239,108,153,225,138,219,79,197,183,14,214,166,67,92,18,146,173,16,251,168,64,112,59,234,231,137,20,108,83,136,89,201,119,235,215,48,111,233,227,46,79,171,196,155,138,44,77,223,127,151,74,36,175,102,35,167,25,251,152,202,50,207,59,28,138,127,214,142,111,195,123,241,251,180,252,160,36,162,45,99,128,216,247,240,247,103,144,174,75,95,183,92,63,232,47,51,192,108,130,4,198,153,66,63,161,249,204,144,79,92,176,63,17,40,44,223,212,18,123,18,105,175,160,218,201,191,163,87,229,150,200,124,21,242,167,90,68,38,62,73,234,118,186,31,28,245,99,56,102,171,175,91,60,218,93,46,192,184,18,142,236,16,110,109,231,135,209,137,175,147,61,95,11,116,145,83,65,203,50,95,253,152,118,237,222,111,71,144,164,106,226,38,58,45,98,63,88,239,178,95,181,219,182,137,218,147,117,242,219,181,0,29,146,137,42,6,163,161,51,133,206,255,232,140,135,78,159,77,28,10,26,240,141,233,124,250,82,73,238,204,222,223,191,49,43,144,64,166,99,231,124,97,29,66,224,38,105,188,15,170,97,188,237,189,173,74,11,253,183,121,111,246,32,114,198,131,141,15,170,74,187,31,9,95,97,131,44,170,130,6,201,181,35,213,140,141,187,76,247,10,28,254,159,89,28,183,155,98,131,42,108,75,6,207,155,250,251,113,103,56,101,206,23,167,123,9,145,30,196,120,58,216,219,34,102,211,17,187,184,124,215,239,117,85,49,25,149,109,19,219,164,74,92,239,58,83,118,157,46,22,168,5,48,10,209,231,71,8,187,80,106,215,215,235,162,254,247,197,166,95,102,235,1,238,245,165,240,49,107,24,98,19,93,11,191,168,241,148,253,47,173,4,20,91,134,158,171,62,233,164,146,183,0,68,80,206,253,40,177,62,176,171,101,244,11,98,75,31,199,195,226,110,2,232,237,27,158,236,136,115,86,238,210,158,241,213,114,193,142,216,239,108,133,59,138,216,202,138,33,218,118,241,163,27,43,207,157,207,35,24,137,172,28,140,123,160,39,26,187,96,54,196,71,113,141,182,174,34,110,236,138,41,56,232,101,71,28,63,210,100,145,59,179,54,3,183,208,184,101,88,81,160,175,13,171,104,67,232,2,15,192,197,164,120,8,193,98,153,66,52,9,158,160,197,124,78,218,26,226,23,155,56,170,225,222,245,32,118,213,60,9,112,136,216,140,134,53,42,134,174,140,182,12,67,79,208,199,127,169,248,188,135,182,63,201,111,179,138,91,67,229,103,88,182,89,140,89,19,236,218,27,58,231,215,233,77,147,254,37,7,172,189,190,220,18,191,245,173,244,252,186,13,145,74,114,134,37,26,207,177,66,113,172,48,17,223,221,154,111,107,77,4,33,205,79,126,107,43,84,65,15,189,62,238,111,219,49,152,166,188,224,139,187,175,137,171,130,0,252,92,54,51,193,168,215,228,231,115,153,239,109,225,193,95,209,103,56,86,38,104,213,13,26,157,116,39,89,23,81,175,97,37,226,131,94,123,220,46,252,4,12,192,66,171,103,132,183,96,123,188,180,151,29,223,97,97,19,133,74,233,253,115,116,80,70,238,227,33,218,169,143,18,188,117,55,161,167,4,87,108,33,107,23,247,199,97,3,118,77,66,4,96,162,219,17,79,227,103,118,171,50,76,4,225,174,168,60,9,215,37,120,32,217,46,231,101,26,163,226,
+190,127,218,158,131,124,202,53,233,32,27,217,170,103,103,81,224,44,186,163,139,43,84,138,16,124,47,73,0,212,29,60,62,14,121,197,62,91,144,21,125,128,27,133,247,16,87,104,127,176,88,206,101,152,1,190,1,172,61,6,182,150,123,104,80,236,220,216,103,206,40,207,153,172,111,239,174,127,73,147,217,40,159,55,126,69,83,104,254,186,81,59,116,13,7,198,200,180,124,63,212,25,81,63,43,220,238,53,49,247,6,28,254,13,62,197,201,124,206,55,179,24,79,110,193,227,219,166,189,225,85,230,195,150,179,17,132,191,206,86,208,133,28,26,248,177,43,148,110,20,68,223,157,247,239,199,206,123,92,116,181,107,208,220,173,176,250,32,164,201,160,211,239,63,29,38,195,190,10,40,40,224,188,119,198,79,132,73,115,175,2,41,255,177,211,119,69,164,152,87,1,52,118,58,253,39,130,35,88,87,1,35,170,127,34,56,138,185,61,91,60,140,8,184,60,21,30,98,93,69,60,248,181,211,147,25,253,224,17,96,114,31,192,125,119,68,146,127,153,30,91,135,143,247,141,235,82,168,176,134,42,190,81,33,122,148,107,44,15,169,146,107,84,152,30,227,25,203,67,170,226,25,21,162,71,56,198,242,128,42,56,70,133,167,178,95,44,143,166,180,95,84,88,30,225,22,203,163,169,226,22,53,160,170,94,177,2,156,178,94,209,24,252,192,121,50,107,31,84,199,82,221,39,86,3,84,198,39,110,220,232,209,209,34,157,68,22,120,124,63,40,93,67,41,143,152,193,83,213,31,86,4,84,206,31,102,16,85,244,134,21,1,149,242,134,25,60,213,124,97,69,56,101,124,97,6,77,21,79,88,17,203,97,79,152,65,82,205,15,86,196,82,202,15,102,225,84,240,130,85,193,28,244,130,57,19,31,56,79,102,223,131,170,72,42,121,192,71,192,41,235,1,31,25,18,42,68,235,195,144,74,135,132,54,156,199,250,191,146,120,202,251,191,71,6,131,21,241,148,118,127,143,139,4,43,162,41,235,253,30,19,6,86,132,82,206,249,61,46,6,172,8,165,180,239,123,76,0,88,21,75,41,215,247,152,232,175,178,97,15,42,2,121,148,227,171,128,166,140,227,163,67,41,131,98,191,39,51,118,33,18,69,247,195,145,236,75,57,61,11,202,182,207,83,57,223,1,76,57,143,103,161,217,114,120,50,227,59,96,41,229,237,44,40,121,103,39,210,223,1,72,25,71,103,225,56,115,186,189,65,198,213,137,140,239,128,68,179,46,9,37,235,114,49,245,29,64,28,118,182,182,48,42,249,218,42,162,40,227,103,109,32,89,55,11,169,239,1,226,160,131,205,248,16,219,191,98,234,187,120,143,65,53,4,57,199,186,243,28,175,71,98,41,227,87,191,166,46,30,11,203,109,207,218,98,95,183,116,229,128,143,85,108,246,99,211,149,233,138,10,52,103,63,68,229,20,139,48,30,242,189,21,65,154,170,42,163,148,238,178,8,228,1,159,92,17,163,174,168,50,68,181,181,107,27,225,126,95,93,17,160,170,166,50,62,233,94,139,0,30,240,225,21,17,234,138,42,67,68,231,91,132,111,159,111,175,8,78,84,81,93,120,84,160,80,118,123,125,126,85,209,201,106,138,252,255,33,132,192,168,16,223,158,193,160,42,58,170,162,178,236,208,115,22,123,192,129,243,221,220,223,224,177,200,200,167,239,130,183,119,240,120,4,70,89,89,169,225,221,93,175,163,240,219,108,95,156,190,95,247,50,12,246,131,204,214,85,42,104,223,134,87,117,189,226,209,248,202,197,241,219,0,43,174,95,60,26,95,169,216,126,27,94,181,245,140,71,163,43,19,240,111,131,171,178,190,241,104,104,135,131,239,109,96,213,252,241,163,161,85,49,217,178,33,96,41,168,229,188,76,190,230,74,241,96,17,236,125,97,225,19,226,174,22,34,22,1,223,19,41,62,33,238,74,97,99,17,236,221,209,227,19,162,174,18,75,22,129,222,21,175,61,33,228,242,241,91,17,224,199,134,113,255,8,242,190,160,110,11,181,23,70,81,147,159,24,183,193,79,43,175,207,33,143,253,16,169,22,93,69,169,241,94,1,51,22,10,200,170,47,215,149,196,102,106,41,55,216,43,116,218,14,1,92,213,213,187,146,208,116,21,165,134,121,5,76,153,26,224,170,182,148,87,18,149,226,95,102,116,87,152,132,45,1,162,242,43,105,37,209,8,206,135,135,115,133,68,153,8,96,169,102,152,37,
+241,236,51,193,231,125,197,5,27,217,155,94,120,196,58,209,223,28,47,189,101,99,255,239,59,190,227,203,177,249,47,205,141,254,154,43,251,193,61,43,254,62,25,138,196,116,214,240,238,45,232,64,242,124,78,251,161,62,82,214,52,159,251,246,209,220,116,161,85,3,250,166,161,206,226,197,143,209,0,47,125,57,191,18,205,160,207,157,61,250,164,158,190,77,144,103,106,136,115,45,176,95,239,248,3,158,139,16,179,102,157,193,127,50,201,62,117,198,221,15,157,113,243,231,227,35,54,28,77,217,240,178,223,103,23,227,222,160,51,190,98,31,157,43,252,230,167,55,156,56,227,41,186,199,81,142,149,124,58,2,54,253,75,103,2,156,155,47,58,103,103,47,142,90,242,113,208,27,234,196,249,212,25,235,132,50,103,157,209,239,155,71,155,176,255,185,115,53,209,169,161,225,61,188,210,143,147,174,121,188,26,12,156,233,184,103,114,166,163,129,149,186,156,142,102,189,33,72,103,224,12,167,42,247,157,115,62,26,59,38,245,222,160,126,7,83,124,243,60,253,236,56,230,21,121,102,43,5,82,234,117,250,38,99,8,50,212,169,254,232,157,126,214,185,93,171,217,93,104,70,231,204,177,146,246,179,174,7,122,203,160,195,174,179,159,59,93,75,116,221,15,78,247,163,78,88,245,119,71,157,190,51,233,26,246,163,193,160,55,205,166,166,206,153,201,24,78,166,227,142,213,86,200,249,4,26,97,146,23,166,69,163,241,216,153,92,140,134,103,189,225,123,157,73,202,104,82,163,137,238,209,238,37,208,91,156,69,114,118,102,211,203,188,241,168,191,149,135,107,48,69,121,180,46,147,127,65,199,101,203,188,179,142,134,124,230,116,173,71,92,233,180,146,253,142,81,140,51,231,188,115,217,159,154,100,223,153,90,47,251,61,144,155,51,158,152,28,163,151,103,35,243,132,35,150,78,141,71,26,166,211,233,126,208,207,231,160,145,186,38,167,111,116,1,159,123,231,58,5,170,124,117,97,117,150,99,44,4,170,239,92,152,114,208,99,186,201,206,151,174,115,49,181,82,253,75,163,121,206,151,222,100,58,49,41,104,211,208,200,4,210,168,102,42,121,222,177,176,157,247,71,29,243,102,212,239,143,62,91,90,0,45,178,30,157,222,123,173,198,231,227,209,64,63,95,26,147,80,31,137,171,244,123,103,232,140,59,86,107,223,131,86,27,104,20,52,152,196,232,82,139,246,67,231,147,5,228,195,232,82,35,249,112,249,222,177,52,187,119,6,138,210,155,106,65,25,73,247,250,189,143,186,161,198,2,197,137,142,58,49,52,26,38,188,166,73,217,143,24,102,218,201,49,158,98,96,101,104,109,233,77,204,211,168,223,177,133,241,239,145,65,209,119,206,117,113,27,39,169,164,78,140,186,70,86,148,176,173,71,103,100,76,7,114,63,26,113,15,156,179,222,229,192,106,202,192,25,191,215,28,224,197,165,177,135,193,104,56,213,234,60,236,76,47,199,166,242,161,243,217,60,126,209,220,134,163,238,85,215,216,198,112,52,232,124,161,129,197,202,233,13,115,57,86,105,195,212,210,33,124,54,189,56,188,4,200,102,56,24,157,155,167,243,137,163,121,141,250,186,205,70,224,163,97,95,235,197,232,194,238,10,163,216,163,241,153,233,217,209,244,131,229,14,70,151,150,111,30,125,50,207,23,157,241,212,26,55,40,105,115,191,24,77,178,233,177,211,117,108,247,10,25,160,106,159,28,147,166,225,219,74,126,234,245,65,229,38,38,103,4,28,46,141,103,19,177,179,74,129,25,153,94,5,215,125,102,61,247,205,51,184,250,179,137,73,158,59,224,100,187,206,86,142,5,20,70,221,209,212,226,60,236,12,172,212,5,12,18,29,203,55,66,14,128,234,152,36,104,166,49,40,76,66,79,90,105,60,200,43,155,178,176,124,26,25,171,24,247,222,127,48,229,192,77,189,235,152,129,114,60,250,172,139,77,192,18,12,158,73,231,147,115,49,178,180,31,140,118,100,220,173,56,165,194,164,254,186,68,113,152,180,29,27,136,84,239,191,237,230,78,156,201,4,122,57,51,74,89,42,57,233,101,176,200,73,180,78,143,140,36,39,32,182,233,236,194,146,213,100,122,102,124,5,36,64,21,77,106,52,238,152,222,6,153,58,157,129,149,178,122,111,114,249,46,151,145,143,181,64,223,117,53,211,158,81,5,185,30,161,147,218,189,193,80,50,156,116,50,62,94,29,98,167,147,
+198,216,47,135,239,70,151,224,111,207,76,198,86,176,114,57,220,26,18,233,148,120,43,241,151,197,241,194,14,52,108,201,95,78,172,134,138,232,214,164,198,118,220,5,201,43,155,182,103,156,219,103,75,30,240,108,236,237,243,135,158,233,75,188,207,74,63,143,198,90,19,63,143,123,6,219,151,65,31,98,102,59,53,5,73,189,3,159,50,177,50,81,28,86,52,69,57,195,110,199,206,56,27,117,47,115,52,160,184,185,28,28,159,39,118,6,90,234,228,162,211,205,212,6,42,54,177,1,94,244,172,4,29,98,100,165,229,205,28,38,99,106,121,126,72,130,140,123,162,51,96,198,65,83,128,162,201,11,24,4,174,66,156,49,116,198,197,231,195,104,218,204,111,173,91,243,33,113,52,50,158,232,162,166,68,38,7,207,56,100,122,161,170,112,94,212,202,23,161,25,177,154,77,157,254,98,205,166,132,202,201,195,19,62,225,209,59,248,81,248,29,204,196,197,7,214,95,151,175,252,192,91,166,115,254,10,207,221,145,199,22,181,97,78,199,241,244,159,116,101,85,19,255,137,76,196,49,53,111,217,113,75,124,192,253,150,157,180,216,138,71,55,124,166,94,189,198,195,138,96,62,185,130,231,159,241,120,154,85,152,208,145,229,45,113,195,236,26,166,207,174,166,254,149,110,93,26,2,201,159,226,112,160,152,157,0,243,19,96,123,122,76,211,205,215,199,116,60,74,252,16,192,156,19,102,154,116,207,185,184,150,41,245,96,50,221,66,180,117,186,172,82,221,182,72,115,215,54,59,11,105,226,237,221,186,193,13,23,51,86,151,238,214,126,48,247,72,93,63,176,209,217,187,174,60,0,139,78,255,143,155,240,52,131,30,152,81,159,205,166,87,23,206,68,220,142,241,111,32,133,230,38,183,33,244,242,13,79,136,126,138,210,105,18,1,178,81,217,248,61,122,126,254,154,233,250,76,175,183,242,61,106,207,108,65,32,47,236,1,10,132,99,91,59,72,92,196,67,204,38,2,217,75,167,154,201,254,5,178,197,104,152,201,254,149,178,105,216,51,249,120,58,201,46,177,99,123,240,52,147,240,250,111,38,246,149,38,208,38,119,62,135,87,39,199,44,9,69,233,184,45,175,67,104,203,19,48,241,252,39,186,186,209,126,39,121,225,205,231,81,202,143,218,212,72,108,245,228,106,50,117,178,13,64,213,80,249,74,8,123,129,2,231,117,24,225,157,159,121,156,160,97,97,132,10,182,23,173,56,20,20,23,161,240,126,2,161,163,184,190,163,217,202,142,199,3,137,252,100,38,206,244,17,109,56,197,54,136,169,2,3,188,23,48,226,129,17,219,173,121,141,20,20,1,111,19,20,184,35,91,129,74,120,36,155,124,191,83,50,199,164,102,60,83,46,187,180,123,202,151,203,248,168,147,239,226,163,208,236,255,100,255,107,206,23,120,21,176,112,242,179,51,136,229,96,156,30,118,175,208,49,9,251,181,242,78,91,172,221,110,195,11,48,233,12,237,47,237,45,91,221,150,200,182,48,90,133,13,181,77,151,148,213,30,128,78,115,182,140,198,219,29,245,47,7,67,203,110,241,188,87,99,174,150,169,163,153,90,193,194,111,144,204,77,85,127,71,254,153,72,230,15,200,25,125,54,243,67,50,44,123,246,72,22,117,110,234,60,65,140,185,48,242,4,113,230,163,247,19,196,250,14,36,57,30,93,92,232,176,231,4,49,163,132,11,53,120,75,172,37,212,120,171,204,126,93,86,107,191,25,77,206,100,150,214,227,108,169,140,22,191,62,254,78,35,173,81,226,115,58,171,26,52,151,110,62,156,161,184,81,101,207,103,184,104,137,3,43,16,244,250,83,28,86,207,103,226,10,162,95,232,245,176,211,191,154,246,186,236,87,76,245,71,29,152,10,178,223,182,85,58,47,152,188,76,90,5,237,221,82,102,112,176,110,164,9,45,173,190,80,39,179,88,154,221,209,191,207,228,10,160,230,156,251,75,188,21,49,247,6,181,231,220,28,32,131,191,2,160,239,149,231,77,90,118,208,9,220,229,3,46,61,231,24,160,81,244,67,119,158,97,93,160,137,57,105,148,208,195,92,137,146,90,184,132,240,35,117,111,180,38,170,116,105,37,212,5,178,145,222,119,215,63,210,58,80,192,89,31,166,225,51,196,4,158,194,100,0,80,116,170,38,3,207,39,59,181,51,80,71,179,76,46,174,72,39,45,30,23,152,247,91,43,67,115,202,126,207,149,19,116,167,236,143,
+44,225,107,10,14,243,100,144,123,178,71,217,45,249,91,162,111,101,197,154,15,183,122,129,252,189,169,107,197,92,102,129,150,60,228,95,125,75,211,199,150,102,94,60,64,132,104,171,163,200,96,3,23,111,13,181,28,181,200,63,181,28,181,204,201,146,146,199,22,111,94,219,62,91,102,105,226,125,74,110,164,80,69,209,77,169,253,202,14,83,159,140,183,85,233,210,58,174,11,60,65,164,128,179,25,228,141,231,169,226,172,6,203,171,250,254,100,107,120,108,177,148,254,93,192,191,237,162,95,157,84,227,172,118,181,178,152,243,10,116,17,249,43,12,14,63,242,7,75,131,46,3,255,43,132,148,38,19,21,233,92,30,74,79,185,197,115,208,242,62,202,16,239,239,49,186,141,40,211,103,38,167,116,175,89,69,158,104,22,154,239,55,127,254,77,246,27,158,212,14,64,191,181,232,34,96,241,20,174,101,86,16,138,191,120,249,47,222,221,75,41,58,66,16,175,106,230,120,151,192,183,237,142,206,200,36,35,142,86,190,169,249,238,254,0,104,172,126,254,55,64,178,122,120,132,181,178,117,196,99,60,18,22,70,179,91,67,142,206,99,24,190,36,254,214,224,216,19,200,173,65,113,36,160,23,170,136,141,188,132,146,216,228,251,213,4,64,108,252,37,7,47,233,133,115,173,42,217,92,161,46,251,53,37,87,226,137,35,41,44,139,139,207,51,217,108,232,18,74,138,85,55,28,180,40,41,251,255,103,153,20,63,171,201,177,136,114,212,54,144,147,95,37,137,16,230,235,211,45,213,217,146,211,150,136,90,69,50,216,138,174,236,165,92,212,156,204,58,33,233,133,253,227,206,239,116,65,132,245,99,32,2,125,33,81,43,253,66,54,250,7,42,104,89,192,191,37,180,0,2,19,214,107,58,155,92,3,139,113,199,25,174,207,224,226,76,24,192,68,26,183,66,200,59,106,240,28,90,113,209,146,82,91,129,182,149,193,248,139,201,207,64,253,85,99,207,210,255,150,167,207,190,254,195,188,206,54,244,88,11,39,247,226,36,15,44,247,254,212,0,201,190,120,189,133,36,251,254,231,124,11,114,239,127,217,209,18,77,86,96,183,121,181,41,97,187,249,34,25,251,125,222,221,82,176,187,165,147,66,152,20,177,65,251,35,143,226,132,7,90,74,177,23,249,235,132,221,248,27,78,235,130,108,14,222,228,218,141,113,39,204,202,15,176,73,110,2,37,253,32,38,8,128,28,169,92,47,73,221,37,53,78,221,29,175,68,178,134,26,124,172,35,177,205,6,223,172,220,111,254,42,93,225,1,249,15,55,81,152,66,54,46,64,34,23,90,14,147,23,217,147,97,250,120,59,197,60,133,217,20,75,215,33,85,186,162,117,210,119,15,98,53,19,135,16,113,230,45,29,3,189,130,110,94,210,177,157,114,129,118,238,71,208,211,75,136,104,18,186,207,94,161,92,132,17,178,121,224,164,5,215,120,192,180,139,11,97,170,221,49,117,210,53,158,197,139,247,62,240,121,91,159,110,46,26,173,106,204,182,28,202,240,111,120,229,1,192,210,34,20,156,104,204,189,206,222,129,32,48,174,169,137,88,196,236,2,19,204,155,71,88,170,151,224,98,49,14,153,184,98,151,216,16,228,65,191,238,98,225,250,81,140,55,29,242,182,70,6,124,64,25,239,168,226,133,185,26,14,55,46,89,151,255,72,113,183,232,197,58,140,99,159,238,125,213,107,122,116,15,140,36,34,209,131,21,201,189,104,49,187,231,52,36,129,57,224,1,33,88,46,100,115,142,6,133,179,120,128,234,71,204,221,112,130,179,228,193,77,114,187,227,218,153,134,4,221,200,159,218,10,227,108,173,33,246,92,217,71,179,210,59,59,67,52,47,67,2,131,186,157,70,221,176,210,249,35,225,137,71,26,152,75,98,234,53,228,112,239,207,147,91,121,70,172,20,161,255,31,110,104,110,185,187,206,229,128,192,64,127,116,122,77,18,196,115,211,185,27,208,177,178,50,20,179,106,138,67,58,136,218,16,69,124,179,149,215,72,41,102,110,88,89,20,196,65,4,39,57,21,158,81,171,69,91,112,228,172,126,87,124,232,172,213,43,34,12,137,40,168,88,145,34,46,80,15,196,245,238,234,78,60,161,68,168,44,27,127,142,26,170,134,201,253,93,206,226,204,237,19,207,253,255,212,253,95,166,31,160,79,159,123,229,127,120,175,180,152,247,220,71,63,166,143,112,240,207,141,109,91,67,191,27,93,251,
+9,13,154,106,236,111,225,8,185,128,161,25,239,81,23,119,90,208,8,73,139,220,126,18,75,7,138,119,118,45,151,225,189,136,12,92,25,3,9,33,171,120,42,194,51,255,19,95,252,228,198,93,239,86,58,87,26,147,59,122,208,167,8,136,217,33,16,250,105,10,145,80,214,16,70,0,103,98,140,97,223,109,120,143,177,9,84,253,167,210,66,81,72,30,95,159,141,169,190,155,66,105,245,104,168,211,215,179,10,84,171,225,237,33,242,38,134,57,11,210,213,53,143,72,18,41,4,25,49,208,207,41,200,242,172,34,184,36,146,145,154,34,177,138,203,176,5,202,67,52,187,178,16,96,105,21,167,8,189,53,212,248,203,168,183,12,175,161,20,12,127,60,226,120,96,154,214,36,44,73,191,159,187,113,38,172,210,164,40,51,210,199,108,25,31,248,99,240,73,247,21,250,116,17,74,192,57,133,102,82,1,248,183,210,202,220,80,218,172,196,65,237,9,212,26,15,94,78,33,57,194,56,142,58,136,49,191,232,104,21,230,206,255,134,217,3,254,70,140,199,236,47,40,16,160,72,51,72,124,207,95,83,55,128,210,130,117,232,176,22,245,73,7,197,182,218,73,150,136,104,131,197,232,122,87,160,241,210,40,194,249,128,230,144,198,120,174,254,174,171,19,44,221,243,241,66,165,107,14,45,171,215,32,131,39,220,186,113,47,175,165,96,172,53,152,167,128,177,136,91,3,10,137,192,113,136,104,231,75,91,169,116,11,159,133,50,211,163,84,99,145,141,10,140,79,90,115,49,65,74,219,194,223,6,50,47,22,238,18,45,255,75,91,116,29,62,233,126,36,110,178,3,241,89,187,161,162,152,139,125,193,182,164,235,57,157,118,186,171,25,137,209,53,246,150,182,13,212,107,242,194,236,48,0,115,104,202,63,186,157,178,145,71,116,117,16,181,241,136,110,35,175,215,106,234,174,105,81,66,253,109,44,238,100,89,121,3,58,222,86,116,39,184,200,156,35,202,2,197,7,142,42,143,29,1,71,220,87,92,163,47,39,218,13,188,167,179,193,58,19,92,6,19,212,13,188,113,169,166,222,203,11,216,137,196,112,203,144,136,56,83,48,209,24,50,20,50,36,85,76,36,112,160,160,221,95,140,217,208,253,57,94,230,46,161,72,230,51,200,68,126,120,177,170,126,99,19,138,22,102,169,180,120,52,161,170,66,188,41,100,138,87,148,54,216,127,177,151,116,237,112,137,126,182,188,222,91,166,92,38,90,122,140,151,144,208,133,57,138,66,169,128,116,189,111,217,11,121,229,234,11,116,103,34,247,237,11,116,107,47,222,212,121,48,55,151,119,201,17,194,92,173,180,61,183,247,66,156,235,37,102,149,0,203,234,161,81,78,81,87,116,55,151,240,195,119,241,26,239,164,67,7,39,93,156,181,60,160,110,112,34,151,37,150,8,210,53,188,191,166,165,1,90,18,192,150,233,169,41,57,50,38,54,181,128,187,16,11,5,194,137,204,219,170,21,10,123,196,191,166,126,68,51,22,170,215,118,209,184,90,30,211,48,184,94,250,9,34,6,111,47,220,222,218,141,132,223,195,111,171,138,3,52,19,210,52,3,43,32,243,245,133,149,115,125,237,139,10,203,100,168,33,29,153,135,130,171,81,251,144,1,116,145,116,232,47,16,130,250,197,151,249,111,178,68,162,19,109,138,211,159,242,52,241,10,36,134,107,230,89,58,152,218,229,41,183,136,126,46,32,18,184,179,116,191,23,208,221,166,55,124,139,240,228,215,2,74,125,185,210,30,166,138,86,43,46,82,130,17,9,185,9,26,120,78,154,52,246,74,89,179,127,253,11,184,228,229,183,135,24,224,21,201,104,79,137,215,167,133,2,171,113,240,250,249,134,212,56,174,21,187,120,213,80,225,123,243,90,216,96,145,162,169,56,185,153,172,139,212,236,158,237,209,49,136,50,24,22,251,215,127,89,114,36,43,147,153,228,1,32,94,23,162,149,232,142,37,50,127,241,70,93,91,199,78,142,79,127,62,102,255,27,42,254,137,221,239,133,11,49,59,193,189,214,1,138,70,187,11,166,241,97,65,24,188,68,247,66,182,143,227,133,104,195,181,30,217,178,72,109,57,218,104,143,247,33,84,179,8,4,105,228,24,20,204,163,182,132,153,51,84,0,2,62,69,235,52,221,191,155,205,212,150,152,201,221,202,144,22,150,201,83,214,148,201,156,115,15,130,226,101,46,19,154,152,199,162,236,43,147,13,194,200,23,
+13,83,220,75,146,151,43,41,62,245,245,113,251,228,212,50,0,45,107,86,82,216,246,80,246,116,107,123,249,249,231,227,230,155,79,56,191,212,225,171,148,153,140,62,123,86,244,217,51,209,103,207,138,62,123,58,250,164,92,108,103,166,129,77,155,64,70,164,144,165,67,133,35,171,233,25,90,67,66,41,51,35,58,146,162,81,37,204,172,199,194,128,68,182,33,25,112,170,14,164,232,233,24,184,103,199,192,61,43,6,238,233,24,184,94,219,29,212,179,94,78,201,204,125,220,22,233,142,59,185,51,42,248,70,206,151,211,21,237,74,144,33,141,156,245,22,68,13,62,133,8,238,198,245,151,68,227,154,27,127,17,131,142,56,220,244,155,191,244,145,165,232,27,8,136,130,48,145,209,144,250,205,67,196,65,190,184,220,16,125,157,84,37,181,78,138,191,129,132,233,114,78,83,178,244,6,1,168,159,145,92,177,18,223,140,104,15,184,159,164,52,209,61,218,146,135,136,144,173,38,215,141,80,242,83,128,22,224,106,82,183,29,97,187,140,122,129,116,154,70,197,232,165,73,202,247,74,169,232,173,74,168,119,100,89,226,13,61,202,124,99,97,162,66,157,84,117,226,180,80,108,138,22,130,121,43,102,83,98,196,69,111,47,174,124,165,177,244,152,129,70,16,31,45,251,250,142,78,103,248,67,211,26,23,87,242,34,120,254,16,254,71,255,84,40,247,146,171,182,211,106,205,134,71,100,18,230,99,123,155,115,187,104,63,134,185,92,188,169,135,8,156,102,169,155,89,11,134,9,189,34,41,223,211,8,153,185,232,179,33,126,198,178,252,255,214,208,98,124,189,206,9,252,165,61,100,128,20,54,244,235,156,172,22,140,44,147,62,60,164,28,237,186,225,210,197,157,158,224,109,161,10,224,42,46,48,206,97,46,90,200,148,197,254,1,215,22,174,84,234,248,232,169,107,104,177,228,122,249,255,165,54,188,83,186,92,205,207,94,163,192,107,208,78,25,249,13,139,190,108,154,165,120,102,19,96,191,223,90,99,6,58,67,102,118,97,251,243,163,122,13,154,219,148,227,150,47,87,17,53,237,145,104,57,58,136,55,242,200,19,73,42,194,206,12,223,130,59,55,65,128,55,224,3,36,233,76,44,189,204,228,210,17,115,23,184,27,91,174,199,168,56,86,190,195,69,4,90,125,167,31,223,41,66,192,15,109,144,38,199,6,66,13,182,191,62,181,49,162,160,58,245,174,68,117,137,252,198,10,106,203,119,129,100,98,228,47,43,81,220,113,81,73,146,138,249,213,155,45,22,170,221,91,60,212,139,29,60,240,136,32,234,58,244,133,208,127,231,31,213,201,41,254,60,110,169,181,239,21,118,142,206,71,221,58,102,77,84,120,251,172,149,163,186,220,173,70,225,13,109,213,195,255,112,135,144,94,93,131,186,155,114,241,18,43,27,143,6,153,94,19,107,127,100,197,56,41,123,136,95,28,201,60,155,195,49,195,245,57,147,131,91,241,122,67,155,177,9,47,4,99,112,212,22,54,163,114,255,67,176,97,71,172,112,127,70,140,174,17,245,230,134,39,177,252,62,139,207,235,226,211,93,160,251,127,141,164,127,160,
 0};
+unsigned long createdb_inline_len = 50399;
 unsigned char* createdb_inline = 0;
@@ -489,6 +489,10 @@
 #define FORCEMITOMASK	(1<<29)
 #define FORCEMITODEBUG	if (GDKdebug & FORCEMITOMASK)
 
+/* join with a hash table where a radix join would be used, to compare
+ * the two */
+#define NORADIXMASK	(1<<30)
+
 /*
  * @- GDK session handling
  * @multitable @columnfractions 0.08 0.7
@@ -773,6 +777,7 @@ gdk_export int VALisnil(const ValRecord *v);
  *           Hash   *thash;           // linear chained hash table on tail
  *           Imprints *timprints;     // column imprints index on tail
  *           orderidx torderidx;      // order oid index on tail
+ *           Heap   *tzonemap;        // per-block min/max of tail
  *  } BAT;
  * @end verbatim
  *
@@ -840,6 +845,7 @@ typedef struct {
 	Hash *hash;		/* hash table */
 	Imprints *imprints;	/* column imprints index */
 	Heap *orderidx;		/* order oid index */
+	Heap *zonemap;		/* min/max per block of values */
 
 	PROPrec *props;		/* list of dynamic properties stored in the bat descriptor */
 } COLrec;
@@ -910,6 +916,7 @@ typedef struct BATiter {
 #define tvheap		T.vheap
 #define thash		T.hash
 #define timprints	T.imprints
+#define tzonemap	T.zonemap
 #define tprops		T.props
 
 
@@ -1930,6 +1937,13 @@ gdk_export lng IMPSimprintsize(BAT *b);
 gdk_export gdk_return BATorderidx(BAT *b, int stable);
 gdk_export gdk_return GDKmergeidx(BAT *b, BAT**a, int n_ar);
 
+/* The zone map structure: the smallest and largest value of each
+ * block of consecutive values, kept up to date when values are
+ * appended */
+
+gdk_export gdk_return BATzonemap(BAT *b);
+gdk_export void ZMdestroy(BAT *b);
+
 /*
  * @- Multilevel Storage Modes
  *
@@ -2130,6 +2144,7 @@ gdk_export ThreadRec GDKthreads[THREADS];
 
 gdk_export int THRgettid(void);
 gdk_export Thread THRget(int tid);
+gdk_export Thread THRself(void);
 gdk_export Thread THRnew(const char *name);
 gdk_export void THRdel(Thread t);
 gdk_export void THRsetdata(int, ptr);
@@ -2152,6 +2167,31 @@ gdk_export void *THRdata[THREADDATA];
 #define THRget_errbuf(t)	((char*)t->data[2])
 #define THRset_errbuf(t,b)	(t->data[2] = b)
 
+/*
+ * Long running kernel operations poll the interrupt record of the
+ * query they work for once per morsel, and fail when the query was
+ * interrupted, has passed its deadline, or holds more memory than its
+ * budget allows.  A thread that executes MAL instructions on behalf
+ * of a client keeps the client's record in its thread data.
+ */
+typedef struct {
+	volatile int stop;	/* set from any thread to abort the query */
+	lng deadline;		/* GDKusec() at which to abort, 0 for none */
+	lng maxmem;		/* memory budget in bytes, 0 for none */
+	volatile lng memclaim;	/* footprint of the intermediates held */
+} Interrupt;
+
+#define INTERRUPT_MORSEL	((BUN) 1 << 16)
+#define INTERRUPTED(q)							\
+	((q) != NULL &&							\
+	 ((q)->stop ||							\
+	  ((q)->maxmem && (q)->memclaim > (q)->maxmem) ||		\
+	  ((q)->deadline && GDKusec() > (q)->deadline)))
+
+#define THRgetinterrupt()	((Interrupt*)THRgetdata(3))
+#define THRget_interrupt(t)	((Interrupt*)t->data[3])
+#define THRset_interrupt(t,q)	(t->data[3] = q)
+
 #ifndef GDK_NOLINK
 
 static inline bat
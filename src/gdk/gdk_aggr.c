@@ -184,7 +184,331 @@ exchange(double *x, double *y)
 	*y = t;
 }
 
-/* this function was adapted from https://bugs.python.org/file10357/msum4.py */
+/* Exact floating point summation.
+ *
+ * The sum is kept as a list of non-overlapping partials in increasing
+ * order of magnitude plus a count of overflows (in units of 2**1024),
+ * which together represent the sum of the values added so far
+ * exactly.  The rounded result only depends on that exact sum, not on
+ * the order in which the values were added, so the partials of
+ * separate parts of the input can be merged (BATgroupsumpartials and
+ * BATgroupfsum) into the same result as summing all values at once.
+ *
+ * this was adapted from https://bugs.python.org/file10357/msum4.py */
+struct fsum {
+	int npartials;
+	int maxpartials;
+	int valseen;
+#ifdef INFINITES_ALLOWED
+	float infs;
+#else
+	int infs;
+#endif
+	double *partials;	/* NULL if the result is nil */
+};
+
+static inline double
+fsumtwopow(void)
+{
+	return pow((double) FLT_RADIX, (double) (DBL_MAX_EXP - 1));
+}
+
+static struct fsum *
+fsuminit(BUN ngrp)
+{
+	struct fsum *sums;
+	BUN grp;
+
+	sums = GDKmalloc(ngrp * sizeof(*sums));
+	if (sums == NULL)
+		return NULL;
+	for (grp = 0; grp < ngrp; grp++) {
+		sums[grp].npartials = 0;
+		sums[grp].valseen = 0;
+		sums[grp].maxpartials = 2;
+		sums[grp].infs = 0;
+		sums[grp].partials = GDKmalloc(sums[grp].maxpartials * sizeof(double));
+		if (sums[grp].partials == NULL) {
+			while (grp > 0)
+				GDKfree(sums[--grp].partials);
+			GDKfree(sums);
+			return NULL;
+		}
+	}
+	return sums;
+}
+
+static void
+fsumdestroy(struct fsum *sums, BUN ngrp)
+{
+	BUN grp;
+
+	for (grp = 0; grp < ngrp; grp++)
+		GDKfree(sums[grp].partials);
+	GDKfree(sums);
+}
+
+/* the group gets a nil result */
+static void
+fsumnil(struct fsum *fs)
+{
+	GDKfree(fs->partials);
+	fs->partials = NULL;
+}
+
+static gdk_return
+fsumadd(struct fsum *fs, double x, double twopow)
+{
+	int i, parti;
+	double y;
+	volatile double lo, hi;
+
+	fs->valseen = 1;
+#ifdef INFINITES_ALLOWED
+	if (isinf(x)) {
+		fs->infs += x;
+		return GDK_SUCCEED;
+	}
+#endif
+	i = 0;
+	for (parti = 0; parti < fs->npartials; parti++) {
+		y = fs->partials[parti];
+		if (fabs(x) < fabs(y))
+			exchange(&x, &y);
+		twosum(&hi, &lo, x, y);
+		if (isinf(hi)) {
+			int sign = hi > 0 ? 1 : -1;
+			hi = x - twopow * sign;
+			x = hi - twopow * sign;
+			fs->infs += sign;
+			if (fabs(x) < fabs(y))
+				exchange(&x, &y);
+			twosum(&hi, &lo, x, y);
+		}
+		if (lo != 0)
+			fs->partials[i++] = lo;
+		x = hi;
+	}
+	if (x != 0) {
+		if (i == fs->maxpartials) {
+			double *temp;
+			fs->maxpartials += fs->maxpartials;
+			temp = GDKrealloc(fs->partials, fs->maxpartials * sizeof(double));
+			if (temp == NULL)
+				return GDK_FAIL;
+			fs->partials = temp;
+		}
+		fs->partials[i++] = x;
+	}
+	fs->npartials = i;
+	return GDK_SUCCEED;
+}
+
+/* Copy the exact sum into dst (if not NULL) as values that add up to
+ * it, and return their number.  A group that has seen values gets at
+ * least one, even if they cancelled out. */
+static int
+fsumexport(const struct fsum *fs, double twopow, double *dst)
+{
+	int n, i;
+
+	for (n = 0; n < fs->npartials; n++)
+		if (dst)
+			dst[n] = fs->partials[n];
+#ifdef INFINITES_ALLOWED
+	if (isinf(fs->infs) || isnan(fs->infs)) {
+		if (dst)
+			dst[n] = fs->infs;
+		n++;
+	} else
+#endif
+	/* each overflow is 2**1024, i.e. twice twopow */
+	for (i = 0; i < 2 * abs((int) fs->infs); i++) {
+		if (dst)
+			dst[n] = fs->infs > 0 ? twopow : -twopow;
+		n++;
+	}
+	if (n == 0 && fs->valseen) {
+		if (dst)
+			dst[n] = 0;
+		n++;
+	}
+	return n;
+}
+
+/* Round the exact sum to a double in *res; returns 0 on success, 1
+ * if the result overflows and may be nil, 2 if it overflows, and -1
+ * if we ran out of memory. */
+static int
+fsumresult(struct fsum *fs, double twopow, double *res)
+{
+	double x, y;
+	volatile double lo, hi;
+
+#ifdef INFINITES_ALLOWED
+	if (isinf(fs->infs) || isnan(fs->infs))
+		return 1;
+#endif
+
+	if ((fs->infs == 1 || fs->infs == -1) &&
+	    fs->npartials > 0 &&
+	    !samesign(fs->infs, fs->partials[fs->npartials - 1])) {
+		twosum(&hi, &lo, fs->infs * twopow, fs->partials[fs->npartials - 1] / 2);
+		if (isinf(2 * hi)) {
+			y = 2 * lo;
+			x = hi + y;
+			x -= hi;
+			if (x == y &&
+			    fs->npartials > 1 &&
+			    samesign(lo, fs->partials[fs->npartials - 2])) {
+				*res = 2 * (hi + y);
+				return 0;
+			}
+		} else {
+			if (lo) {
+				if (fs->npartials == fs->maxpartials) {
+					double *temp;
+					/* we need space for one more */
+					fs->maxpartials++;
+					temp = GDKrealloc(fs->partials, fs->maxpartials * sizeof(double));
+					if (temp == NULL)
+						return -1;
+					fs->partials = temp;
+				}
+				fs->partials[fs->npartials - 1] = 2 * lo;
+				fs->partials[fs->npartials++] = 2 * hi;
+			} else {
+				fs->partials[fs->npartials - 1] = 2 * hi;
+			}
+			fs->infs = 0;
+		}
+	}
+
+	if (fs->infs != 0)
+		return 2;
+
+	if (fs->npartials == 0) {
+		*res = 0;
+		return 0;
+	}
+
+	/* accumulate into hi */
+	hi = fs->partials[--fs->npartials];
+	while (fs->npartials > 0) {
+		twosum(&hi, &lo, hi, fs->partials[--fs->npartials]);
+		if (lo) {
+			fs->partials[fs->npartials++] = lo;
+			break;
+		}
+	}
+
+	if (fs->npartials >= 2 &&
+	    samesign(fs->partials[fs->npartials - 1], fs->partials[fs->npartials - 2]) &&
+	    hi + 2 * fs->partials[fs->npartials - 1] - hi == 2 * fs->partials[fs->npartials - 1]) {
+		hi += 2 * fs->partials[fs->npartials - 1];
+		fs->partials[fs->npartials - 1] = -fs->partials[fs->npartials - 1];
+	}
+	*res = hi;
+	return 0;
+}
+
+/* The average of an exact sum that overflows may still fit: divide
+ * the sum scaled down by 2**FSUMSCALE (exact but for partials that
+ * underflow, which do not matter next to a sum that large) by cnt,
+ * and scale the result back up.  Returns as fsumresult. */
+#define FSUMSCALE 64		/* cnt < 2**63, so the average fits */
+static int
+fsumavg(struct fsum *fs, double twopow, lng cnt, double *res)
+{
+	struct fsum *scaled;
+	double *vals;
+	int i, n, r = -1;
+
+	n = fsumexport(fs, twopow, NULL);
+	vals = GDKmalloc(n * sizeof(double));
+	scaled = fsuminit(1);
+	if (vals == NULL || scaled == NULL)
+		goto bailout;
+	fsumexport(fs, twopow, vals);
+	for (i = 0; i < n; i++)
+		if (fsumadd(scaled, ldexp(vals[i], -FSUMSCALE), twopow) != GDK_SUCCEED)
+			goto bailout;
+	r = fsumresult(scaled, twopow, res);
+	if (r == 0) {
+		*res = ldexp(*res / cnt, FSUMSCALE);
+		if (isinf(*res))
+			r = 2;
+	}
+  bailout:
+	GDKfree(vals);
+	if (scaled)
+		fsumdestroy(scaled, 1);
+	return r;
+}
+
+/* Store the rounded sum of a group, divided by cnt if that is not
+ * zero, in results[grp] of type tp (flt or dbl) and release its
+ * partials.  Returns the number of nils produced (0 or 1), or
+ * BUN_NONE on error. */
+static BUN
+fsumfinal(struct fsum *fs, double twopow, lng cnt, void *restrict results,
+	  BUN grp, int tp, int nil_if_empty, int abort_on_error)
+{
+	double x = 0;
+	int r;
+
+	if (fs->partials == NULL) {
+		/* a nil was seen */
+		goto isnil;
+	}
+	if (!fs->valseen) {
+		fsumnil(fs);
+		if (nil_if_empty)
+			goto isnil;
+	} else {
+		r = fsumresult(fs, twopow, &x);
+		if (r == 0 && cnt > 0)
+			x /= cnt;
+		else if (r == 2 && cnt > 1)
+			/* the sum overflows, but the average may not */
+			r = fsumavg(fs, twopow, cnt, &x);
+		fsumnil(fs);
+		if (r < 0)
+			return BUN_NONE;
+		if (r == 1 && !abort_on_error)
+			goto isnil;
+		if (r > 0)
+			goto overflow;
+	}
+	if (tp == TYPE_flt) {
+		if (x > GDK_flt_max || x <= GDK_flt_min) {
+			if (abort_on_error)
+				goto overflow;
+			goto isnil;
+		}
+		((flt *) results)[grp] = (flt) x;
+	} else {
+		if (x == GDK_dbl_min) {
+			if (abort_on_error)
+				goto overflow;
+			goto isnil;
+		}
+		((dbl *) results)[grp] = x;
+	}
+	return 0;
+
+  isnil:
+	if (tp == TYPE_flt)
+		((flt *) results)[grp] = flt_nil;
+	else
+		((dbl *) results)[grp] = dbl_nil;
+	return 1;
+
+  overflow:
+	GDKerror("22003!overflow in calculation.\n");
+	return BUN_NONE;
+}
+
 static BUN
 dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
        void *restrict results, BUN ngrp, int tp1, int tp2,
@@ -192,25 +516,12 @@ dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
        oid min, oid max, int skip_nils, int abort_on_error,
        int nil_if_empty, const char *func)
 {
-	struct pergroup {
-		int npartials;
-		int maxpartials;
-		int valseen;
-#ifdef INFINITES_ALLOWED
-		float infs;
-#else
-		int infs;
-#endif
-		double *partials;
-	} *pergroup;
+	struct fsum *pergroup;
 	BUN listi;
-	int parti;
-	int i;
 	BUN grp;
-	double x, y;
-	volatile double lo, hi;
-	double twopow = pow((double) FLT_RADIX, (double) (DBL_MAX_EXP - 1));
-	BUN nils = 0;
+	double x;
+	double twopow = fsumtwopow();
+	BUN nils = 0, n;
 
 	ALGODEBUG fprintf(stderr, "#%s: floating point summation\n", func);
 	/* we only deal with the two floating point types */
@@ -225,22 +536,9 @@ dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
 		ngrp = 1;
 		gids = NULL;
 	}
-	pergroup = GDKmalloc(ngrp * sizeof(*pergroup));
+	pergroup = fsuminit(ngrp);
 	if (pergroup == NULL)
 		return BUN_NONE;
-	for (grp = 0; grp < ngrp; grp++) {
-		pergroup[grp].npartials = 0;
-		pergroup[grp].valseen = 0;
-		pergroup[grp].maxpartials = 2;
-		pergroup[grp].infs = 0;
-		pergroup[grp].partials = GDKmalloc(pergroup[grp].maxpartials * sizeof(double));
-		if (pergroup[grp].partials == NULL) {
-			while (grp > 0)
-				GDKfree(pergroup[--grp].partials);
-			GDKfree(pergroup);
-			return BUN_NONE;
-		}
-	}
 	for (;;) {
 		if (cand) {
 			if (cand >= candend)
@@ -263,195 +561,29 @@ dofsum(const void *restrict values, oid seqb, BUN start, BUN end,
 		else {
 			/* it's a nil */
 			if (!skip_nils) {
-				if (tp2 == TYPE_flt)
-					((flt *) results)[grp] = flt_nil;
-				else
-					((dbl *) results)[grp] = dbl_nil;
-				GDKfree(pergroup[grp].partials);
-				pergroup[grp].partials = NULL;
+				fsumnil(&pergroup[grp]);
 				if (++nils == ngrp)
 					break;
 			}
 			continue;
 		}
-		pergroup[grp].valseen = 1;
-#ifdef INFINITES_ALLOWED
-		if (isinf(x)) {
-			pergroup[grp].infs += x;
-			continue;
-		}
-#endif
-		i = 0;
-		for (parti = 0; parti < pergroup[grp].npartials; parti++) {
-			y = pergroup[grp].partials[parti];
-			if (fabs(x) < fabs(y))
-				exchange(&x, &y);
-			twosum(&hi, &lo, x, y);
-			if (isinf(hi)) {
-				int sign = hi > 0 ? 1 : -1;
-				hi = x - twopow * sign;
-				x = hi - twopow * sign;
-				pergroup[grp].infs += sign;
-				if (fabs(x) < fabs(y))
-					exchange(&x, &y);
-				twosum(&hi, &lo, x, y);
-			}
-			if (lo != 0)
-				pergroup[grp].partials[i++] = lo;
-			x = hi;
-		}
-		if (x != 0) {
-			if (i == pergroup[grp].maxpartials) {
-				double *temp;
-				pergroup[grp].maxpartials += pergroup[grp].maxpartials;
-				temp = GDKrealloc(pergroup[grp].partials, pergroup[grp].maxpartials * sizeof(double));
-				if (temp == NULL)
-					goto bailout;
-				pergroup[grp].partials = temp;
-			}
-			pergroup[grp].partials[i++] = x;
-		}
-		pergroup[grp].npartials = i;
+		if (fsumadd(&pergroup[grp], x, twopow) != GDK_SUCCEED)
+			goto bailout;
 	}
 
+	nils = 0;
 	for (grp = 0; grp < ngrp; grp++) {
-		if (pergroup[grp].partials == NULL)
-			continue;
-		if (!pergroup[grp].valseen) {
-			if (tp2 == TYPE_flt)
-				((flt *) results)[grp] = nil_if_empty ? flt_nil : 0;
-			else
-				((dbl *) results)[grp] = nil_if_empty ? dbl_nil : 0;
-			nils += nil_if_empty;
-			GDKfree(pergroup[grp].partials);
-			pergroup[grp].partials = NULL;
-			continue;
-		}
-#ifdef INFINITES_ALLOWED
-		if (isinf(pergroup[grp].infs) || isnan(pergroup[grp].infs)) {
-			if (abort_on_error) {
-				goto overflow;
-			}
-			if (tp2 == TYPE_flt)
-				((flt *) results)[grp] = flt_nil;
-			else
-				((dbl *) results)[grp] = dbl_nil;
-			nils++;
-			GDKfree(pergroup[grp].partials);
-			pergroup[grp].partials = NULL;
-			continue;
-		}
-#endif
-
-		if ((pergroup[grp].infs == 1 || pergroup[grp].infs == -1) &&
-		    pergroup[grp].npartials > 0 &&
-		    !samesign(pergroup[grp].infs, pergroup[grp].partials[pergroup[grp].npartials - 1])) {
-			twosum(&hi, &lo, pergroup[grp].infs * twopow, pergroup[grp].partials[pergroup[grp].npartials - 1] / 2);
-			if (isinf(2 * hi)) {
-				y = 2 * lo;
-				x = hi + y;
-				x -= hi;
-				if (x == y &&
-				    pergroup[grp].npartials > 1 &&
-				    samesign(lo, pergroup[grp].partials[pergroup[grp].npartials - 2])) {
-					GDKfree(pergroup[grp].partials);
-					pergroup[grp].partials = NULL;
-					x = 2 * (hi + y);
-					if (tp2 == TYPE_flt) {
-						if (x > GDK_flt_max ||
-						    x <= GDK_flt_min) {
-							if (abort_on_error)
-								goto overflow;
-							((flt *) results)[grp] = flt_nil;
-							nils++;
-						} else
-							((flt *) results)[grp] = (flt) x;
-					} else if (x == GDK_dbl_min) {
-						if (abort_on_error)
-							goto overflow;
-						((dbl *) results)[grp] = dbl_nil;
-						nils++;
-					} else
-						((dbl *) results)[grp] = x;
-					continue;
-				}
-			} else {
-				if (lo) {
-					if (pergroup[grp].npartials == pergroup[grp].maxpartials) {
-						double *temp;
-						/* we need space for one more */
-						pergroup[grp].maxpartials++;
-						temp = GDKrealloc(pergroup[grp].partials, pergroup[grp].maxpartials * sizeof(double));
-						if (temp == NULL)
-							goto bailout;
-						pergroup[grp].partials = temp;
-					}
-					pergroup[grp].partials[pergroup[grp].npartials - 1] = 2 * lo;
-					pergroup[grp].partials[pergroup[grp].npartials++] = 2 * hi;
-				} else {
-					pergroup[grp].partials[pergroup[grp].npartials - 1] = 2 * hi;
-				}
-				pergroup[grp].infs = 0;
-			}
-		}
-
-		if (pergroup[grp].infs != 0)
-			goto overflow;
-
-		if (pergroup[grp].npartials == 0) {
-			GDKfree(pergroup[grp].partials);
-			pergroup[grp].partials = NULL;
-			if (tp2 == TYPE_flt)
-				((flt *) results)[grp] = 0;
-			else
-				((dbl *) results)[grp] = 0;
-			continue;
-		}
-
-		/* accumulate into hi */
-		hi = pergroup[grp].partials[--pergroup[grp].npartials];
-		while (pergroup[grp].npartials > 0) {
-			twosum(&hi, &lo, hi, pergroup[grp].partials[--pergroup[grp].npartials]);
-			if (lo) {
-				pergroup[grp].partials[pergroup[grp].npartials++] = lo;
-				break;
-			}
-		}
-
-		if (pergroup[grp].npartials >= 2 &&
-		    samesign(pergroup[grp].partials[pergroup[grp].npartials - 1], pergroup[grp].partials[pergroup[grp].npartials - 2]) &&
-		    hi + 2 * pergroup[grp].partials[pergroup[grp].npartials - 1] - hi == 2 * pergroup[grp].partials[pergroup[grp].npartials - 1]) {
-			hi += 2 * pergroup[grp].partials[pergroup[grp].npartials - 1];
-			pergroup[grp].partials[pergroup[grp].npartials - 1] = -pergroup[grp].partials[pergroup[grp].npartials - 1];
-		}
-
-		GDKfree(pergroup[grp].partials);
-		pergroup[grp].partials = NULL;
-		if (tp2 == TYPE_flt) {
-			if (hi > GDK_flt_max || hi <= GDK_flt_min) {
-				if (abort_on_error)
-					goto overflow;
-				((flt *) results)[grp] = flt_nil;
-				nils++;
-			} else
-				((flt *) results)[grp] = (flt) hi;
-		} else if (hi == GDK_dbl_min) {
-			if (abort_on_error)
-				goto overflow;
-			((dbl *) results)[grp] = dbl_nil;
-			nils++;
-		} else
-			((dbl *) results)[grp] = hi;
+		n = fsumfinal(&pergroup[grp], twopow, 0, results, grp, tp2,
+			      nil_if_empty, abort_on_error);
+		if (n == BUN_NONE)
+			goto bailout;
+		nils += n;
 	}
 	GDKfree(pergroup);
 	return nils;
 
-  overflow:
-	GDKerror("22003!overflow in calculation.\n");
   bailout:
-	for (grp = 0; grp < ngrp; grp++)
-		GDKfree(pergroup[grp].partials);
-	GDKfree(pergroup);
+	fsumdestroy(pergroup, ngrp);
 	return BUN_NONE;
 }
 
@@ -830,6 +962,230 @@ BATgroupsum(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_
 	return bn;
 }
 
+/* The exact sums of floating point values per group in a form that
+ * can be merged: *pp gets the partials of all groups one after the
+ * other, *cp the number of partials of each group (nil for a group
+ * with a nil value if skip_nils is not set) and *np the number of
+ * values each group summed.  BATgroupfsum merges any number of them
+ * into the same sums (or averages) that BATgroupsum (BATgroupavg)
+ * calculates from all values at once, bit for bit. */
+gdk_return
+BATgroupsumpartials(BAT **pp, BAT **cp, BAT **np, BAT *b, BAT *g, BAT *e, BAT *s, int skip_nils)
+{
+	const oid *restrict gids;
+	oid min, max;
+	BUN ngrp, grp, i, total = 0;
+	BUN start, end;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+	struct fsum *sums;
+	double twopow = fsumtwopow(), x;
+	BAT *pn = NULL, *cn = NULL, *nn = NULL;
+	lng *restrict cnts, *restrict vals;
+	dbl *restrict parts;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("BATgroupsumpartials: %s\n", err);
+		return GDK_FAIL;
+	}
+	if (b->ttype != TYPE_flt && b->ttype != TYPE_dbl) {
+		GDKerror("BATgroupsumpartials: type (%s) not supported.\n",
+			 ATOMname(b->ttype));
+		return GDK_FAIL;
+	}
+
+	if ((sums = fsuminit(ngrp)) == NULL)
+		return GDK_FAIL;
+	if ((cn = COLnew(min, TYPE_lng, ngrp, TRANSIENT)) == NULL ||
+	    (nn = COLnew(min, TYPE_lng, ngrp, TRANSIENT)) == NULL)
+		goto bailout;
+	cnts = (lng *) Tloc(cn, 0);
+	vals = (lng *) Tloc(nn, 0);
+	memset(cnts, 0, ngrp * sizeof(lng));
+	memset(vals, 0, ngrp * sizeof(lng));
+	gids = g == NULL || BATtdense(g) ? NULL : (const oid *) Tloc(g, 0);
+
+	for (;;) {
+		if (cand) {
+			if (cand >= candend)
+				break;
+			i = *cand++ - b->hseqbase;
+		} else {
+			if (start >= end)
+				break;
+			i = start++;
+		}
+		if (g == NULL)
+			grp = 0;
+		else if (gids == NULL)
+			grp = g->tseqbase + i - min;
+		else if (gids[i] >= min && gids[i] <= max)
+			grp = gids[i] - min;
+		else
+			continue;
+		if (sums[grp].partials == NULL)
+			continue;
+		if (b->ttype == TYPE_flt && ((const flt *) Tloc(b, 0))[i] != flt_nil)
+			x = ((const flt *) Tloc(b, 0))[i];
+		else if (b->ttype == TYPE_dbl && ((const dbl *) Tloc(b, 0))[i] != dbl_nil)
+			x = ((const dbl *) Tloc(b, 0))[i];
+		else {
+			if (!skip_nils)
+				fsumnil(&sums[grp]);
+			continue;
+		}
+		vals[grp]++;
+		if (fsumadd(&sums[grp], x, twopow) != GDK_SUCCEED)
+			goto bailout;
+	}
+
+	for (grp = 0; grp < ngrp; grp++) {
+		if (sums[grp].partials == NULL) {
+			cnts[grp] = lng_nil;
+		} else {
+			cnts[grp] = fsumexport(&sums[grp], twopow, NULL);
+			total += cnts[grp];
+		}
+	}
+	if ((pn = COLnew(0, TYPE_dbl, total, TRANSIENT)) == NULL)
+		goto bailout;
+	parts = (dbl *) Tloc(pn, 0);
+	for (grp = 0; grp < ngrp; grp++)
+		if (sums[grp].partials)
+			parts += fsumexport(&sums[grp], twopow, parts);
+	fsumdestroy(sums, ngrp);
+
+	BATsetcount(pn, total);
+	pn->tkey = 0;
+	pn->tsorted = pn->trevsorted = total <= 1;
+	pn->tnil = 0;
+	pn->tnonil = 1;
+	BATsetcount(cn, ngrp);
+	cn->tkey = 0;
+	cn->tsorted = cn->trevsorted = ngrp <= 1;
+	cn->tnil = !skip_nils;
+	cn->tnonil = skip_nils;
+	BATsetcount(nn, ngrp);
+	nn->tkey = 0;
+	nn->tsorted = nn->trevsorted = ngrp <= 1;
+	nn->tnil = 0;
+	nn->tnonil = 1;
+	*pp = pn;
+	*cp = cn;
+	*np = nn;
+	return GDK_SUCCEED;
+
+  bailout:
+	fsumdestroy(sums, ngrp);
+	if (cn)
+		BBPreclaim(cn);
+	if (nn)
+		BBPreclaim(nn);
+	return GDK_FAIL;
+}
+
+/* Merge the partials p of BATgroupsumpartials, c the number of
+ * partials in p of each of the groups they were calculated for, into
+ * the sums of the groups g (aligned with c) with extents e.  If n is
+ * given, the number of values summed aligned with c, the result is
+ * the average instead. */
+BAT *
+BATgroupfsum(BAT *p, BAT *c, BAT *n, BAT *g, BAT *e, int tp, int skip_nils, int abort_on_error)
+{
+	const oid *restrict gids;
+	oid min, max;
+	BUN ngrp, grp, i, pos = 0, nils = 0, r;
+	BUN start, end;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+	struct fsum *sums;
+	double twopow = fsumtwopow();
+	const lng *restrict cnts, *restrict vals;
+	const dbl *restrict parts;
+	lng *restrict nvals = NULL, k;
+	BAT *bn;
+
+	if ((err = BATgroupaggrinit(c, g, e, NULL, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("BATgroupfsum: %s\n", err);
+		return NULL;
+	}
+	if (p->ttype != TYPE_dbl || c->ttype != TYPE_lng ||
+	    (n != NULL && (n->ttype != TYPE_lng || BATcount(n) != BATcount(c))) ||
+	    (tp != TYPE_dbl && (tp != TYPE_flt || n != NULL))) {
+		GDKerror("BATgroupfsum: type combination not supported.\n");
+		return NULL;
+	}
+
+	if ((sums = fsuminit(ngrp)) == NULL)
+		return NULL;
+	if (n != NULL && (nvals = GDKzalloc(ngrp * sizeof(lng))) == NULL) {
+		fsumdestroy(sums, ngrp);
+		return NULL;
+	}
+	if ((bn = COLnew(min, tp, ngrp, TRANSIENT)) == NULL)
+		goto bailout;
+	gids = g == NULL || BATtdense(g) ? NULL : (const oid *) Tloc(g, 0);
+	cnts = (const lng *) Tloc(c, 0);
+	vals = n ? (const lng *) Tloc(n, 0) : NULL;
+	parts = (const dbl *) Tloc(p, 0);
+
+	for (i = 0; i < BATcount(c); i++) {
+		k = cnts[i];
+		if (g == NULL)
+			grp = 0;
+		else if (gids == NULL)
+			grp = g->tseqbase + i - min;
+		else if (gids[i] >= min && gids[i] <= max)
+			grp = gids[i] - min;
+		else
+			grp = BUN_NONE;
+		if (k == lng_nil) {
+			if (!skip_nils && grp != BUN_NONE)
+				fsumnil(&sums[grp]);
+			continue;
+		}
+		if (pos + k > BATcount(p)) {
+			GDKerror("BATgroupfsum: partials and counts do not match.\n");
+			goto bailout;
+		}
+		if (grp != BUN_NONE && sums[grp].partials != NULL) {
+			for (r = 0; r < (BUN) k; r++)
+				if (fsumadd(&sums[grp], parts[pos + r], twopow) != GDK_SUCCEED)
+					goto bailout;
+			if (nvals)
+				nvals[grp] += vals[i];
+		}
+		pos += k;
+	}
+
+	for (grp = 0; grp < ngrp; grp++) {
+		r = fsumfinal(&sums[grp], twopow, nvals ? nvals[grp] : 0,
+			      Tloc(bn, 0), grp, tp, 1, abort_on_error);
+		if (r == BUN_NONE)
+			goto bailout;
+		nils += r;
+	}
+	GDKfree(sums);
+	GDKfree(nvals);
+
+	BATsetcount(bn, ngrp);
+	bn->tkey = BATcount(bn) <= 1;
+	bn->tsorted = BATcount(bn) <= 1;
+	bn->trevsorted = BATcount(bn) <= 1;
+	bn->tnil = nils != 0;
+	bn->tnonil = nils == 0;
+	return bn;
+
+  bailout:
+	fsumdestroy(sums, ngrp);
+	GDKfree(nvals);
+	if (bn)
+		BBPreclaim(bn);
+	return NULL;
+}
+
 gdk_return
 BATsum(void *res, int tp, BAT *b, BAT *s, int skip_nils, int abort_on_error, int nil_if_empty)
 {
@@ -1595,11 +1951,15 @@ BATprod(void *res, int tp, BAT *b, BAT *s, int skip_nils, int abort_on_error, in
 		GDKfree(avgs);						\
 	} while (0)
 
+/* floating point averages are the exactly calculated sums divided by
+ * the counts, so that they can be merged (see BATgroupfsum) */
 #define AGGR_AVG_FLOAT(TYPE)						\
 	do {								\
 		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
-		for (i = 0; i < ngrp; i++)				\
-			dbls[i] = 0;					\
+		double twopow = fsumtwopow();				\
+		BUN r;							\
+		if ((sums = fsuminit(ngrp)) == NULL)			\
+			goto alloc_fail;				\
 		for (;;) {						\
 			if (cand) {					\
 				if (cand == candend)			\
@@ -1622,9 +1982,9 @@ BATprod(void *res, int tp, BAT *b, BAT *s, int skip_nils, int abort_on_error, in
 					if (!skip_nils)			\
 						cnts[gid] = lng_nil;	\
 				} else if (cnts[gid] != lng_nil) {	\
-					AVERAGE_ITER_FLOAT(TYPE, vals[i], \
-							   dbls[gid],	\
-							   cnts[gid]);	\
+					cnts[gid]++;			\
+					if (fsumadd(&sums[gid], vals[i], twopow) != GDK_SUCCEED) \
+						goto alloc_fail;	\
 				}					\
 			}						\
 		}							\
@@ -1633,8 +1993,18 @@ BATprod(void *res, int tp, BAT *b, BAT *s, int skip_nils, int abort_on_error, in
 				dbls[i] = dbl_nil;			\
 				cnts[i] = 0;				\
 				nils++;					\
+				fsumnil(&sums[i]);			\
+			} else {					\
+				r = fsumfinal(&sums[i], twopow, cnts[i], \
+					      dbls, i, TYPE_dbl, 1,	\
+					      abort_on_error);		\
+				if (r == BUN_NONE)			\
+					goto bailout;			\
+				nils += r;				\
 			}						\
 		}							\
+		GDKfree(sums);						\
+		sums = NULL;						\
 	} while (0)
 
 /* calculate group averages with optional candidates list */
@@ -1649,6 +2019,7 @@ BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int
 	BUN *restrict rems = NULL;
 	lng *restrict cnts = NULL;
 	dbl *restrict dbls;
+	struct fsum *sums = NULL;
 	BAT *bn = NULL, *cn = NULL;
 	BUN start, end;
 	const oid *cand = NULL, *candend = NULL;
@@ -1803,16 +2174,17 @@ BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int
 	return GDK_SUCCEED;
 
   alloc_fail:
+	GDKerror("BATgroupavg: cannot allocate enough memory.\n");
+  bailout:
+	if (sums)
+		fsumdestroy(sums, ngrp);
 	if (bn)
 		BBPunfix(bn->batCacheid);
 	GDKfree(rems);
-	if (cntsp) {
-		BBPreclaim(*cntsp);
-		*cntsp = NULL;
-	} else if (cnts) {
+	if (cn)
+		BBPreclaim(cn);
+	else
 		GDKfree(cnts);
-	}
-	GDKerror("BATgroupavg: cannot allocate enough memory.\n");
 	return GDK_FAIL;
 }
 
@@ -1903,8 +2275,11 @@ BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int
 
 #define AVERAGE_FLOATTYPE(TYPE)					\
 	do {							\
-		double a = 0;					\
+		struct fsum *a;					\
+		double twopow = fsumtwopow();			\
 		TYPE x;						\
+		if ((a = fsuminit(1)) == NULL)			\
+			return GDK_FAIL;			\
 		for (;;) {					\
 			if (cand) {				\
 				if (cand == candend)		\
@@ -1920,9 +2295,17 @@ BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int
 			x = ((const TYPE *) src)[i];		\
 			if (x == TYPE##_nil)			\
 				continue;			\
-			AVERAGE_ITER_FLOAT(TYPE, x, a, n);	\
+			n++;					\
+			if (fsumadd(a, x, twopow) != GDK_SUCCEED) { \
+				fsumdestroy(a, 1);		\
+				return GDK_FAIL;		\
+			}					\
 		}						\
-		*avg = n > 0 ? a : dbl_nil;			\
+		r = fsumfinal(a, twopow, (lng) n, avg, 0,	\
+			      TYPE_dbl, 1, abort_on_error);	\
+		GDKfree(a);					\
+		if (r == BUN_NONE)				\
+			return GDK_FAIL;			\
 	} while (0)
 
 gdk_return
@@ -2126,81 +2509,438 @@ BATgroupcount(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_o
 	return bn;
 }
 
-/* calculate group sizes (number of TRUE values) with optional
- * candidates list */
+/* calculate group sizes (number of TRUE values) with optional
+ * candidates list */
+BAT *
+BATgroupsize(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error)
+{
+	const oid *restrict gids;
+	oid min, max;
+	BUN i, ngrp;
+	const bit *restrict bits;
+	lng *restrict cnts;
+	BAT *bn = NULL;
+	BUN start, end;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+
+	assert(tp == TYPE_lng);
+	assert(b->ttype == TYPE_bit);
+	/* compatibility arguments */
+	(void) tp;
+	(void) abort_on_error;
+	(void) skip_nils;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("BATgroupsize: %s\n", err);
+		return NULL;
+	}
+	if (g == NULL) {
+		GDKerror("BATgroupsize: b and g must be aligned\n");
+		return NULL;
+	}
+
+	if (BATcount(b) == 0 || ngrp == 0) {
+		/* trivial: no products, so return bat aligned with g
+		 * with zero in the tail */
+		lng zero = 0;
+		return BATconstant(ngrp == 0 ? 0 : min, TYPE_lng, &zero, ngrp, TRANSIENT);
+	}
+
+	bn = COLnew(min, TYPE_lng, ngrp, TRANSIENT);
+	if (bn == NULL)
+		return NULL;
+	cnts = (lng *) Tloc(bn, 0);
+	memset(cnts, 0, ngrp * sizeof(lng));
+
+	if (BATtdense(g))
+		gids = NULL;
+	else
+		gids = (const oid *) Tloc(g, start);
+
+	bits = (const bit *) Tloc(b, 0);
+
+	for (;;) {
+		if (cand) {
+			if (cand == candend)
+				break;
+			i = *cand++ - b->hseqbase;
+			if (i >= end)
+				break;
+		} else {
+			i = start++;
+			if (i == end)
+				break;
+		}
+		if (bits[i] == 1 &&
+		    (gids == NULL || (gids[i] >= min && gids[i] <= max))) {
+			cnts[gids ? gids[i] - min : (oid) i]++;
+		}
+	}
+	BATsetcount(bn, ngrp);
+	bn->tkey = BATcount(bn) <= 1;
+	bn->tsorted = BATcount(bn) <= 1;
+	bn->trevsorted = BATcount(bn) <= 1;
+	bn->tnil = 0;
+	bn->tnonil = 1;
+	return bn;
+}
+
+/* ---------------------------------------------------------------------- */
+/* approximate distinct count */
+
+/* The number of distinct values per group is estimated with a
+ * HyperLogLog sketch: a fixed array of HLL_REGISTERS small registers
+ * per group.  Each value is hashed; the first HLL_PRECISION bits of
+ * the hash select a register, which keeps the largest number of
+ * leading zeros (plus one) seen in the rest of the hash.  The
+ * estimate is derived from the harmonic mean of 2^register, with
+ * linear counting of the empty registers for small cardinalities.
+ * The standard error is about 1.04/sqrt(HLL_REGISTERS), 2.3% here.
+ *
+ * Sketches merge by taking the maximum of each register, so the
+ * registers of separate parts of the input combine into the sketch
+ * of all of it: BATgrouphllsketch exports the registers of each
+ * group, and BATgrouphllmerge merges them and gives the estimates.
+ * Nil values are never counted. */
+
+#define HLL_PRECISION	11
+#define HLL_REGISTERS	(1 << HLL_PRECISION)
+
+/* the finalizer of MurmurHash3, to spread the bits of a value over the
+ * whole hash */
+static inline ulng
+hllmix(ulng h)
+{
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+/* FNV-1a over the bytes of a value that does not fit in 64 bits */
+static ulng
+hllbytes(const void *v, size_t len)
+{
+	const unsigned char *p = v;
+	ulng h = 0xcbf29ce484222325ULL;
+
+	while (len-- > 0) {
+		h ^= *p++;
+		h *= 0x100000001b3ULL;
+	}
+	return hllmix(h);
+}
+
+static inline void
+hlladd(bte *restrict regs, ulng h)
+{
+	BUN idx = (BUN) (h >> (64 - HLL_PRECISION));
+	bte rank = 1;
+
+	/* a stop bit bounds the count of leading zeros */
+	h = (h << HLL_PRECISION) | ((ulng) 1 << (HLL_PRECISION - 1));
+	while ((h & ((ulng) 1 << 63)) == 0) {
+		rank++;
+		h <<= 1;
+	}
+	if (regs[idx] < rank)
+		regs[idx] = rank;
+}
+
+static lng
+hllestimate(const bte *regs)
+{
+	double sum = 0, est;
+	BUN i, zeros = 0;
+
+	for (i = 0; i < HLL_REGISTERS; i++) {
+		sum += ldexp(1.0, -regs[i]);
+		zeros += regs[i] == 0;
+	}
+	est = 0.7213 / (1 + 1.079 / HLL_REGISTERS) *
+		HLL_REGISTERS * (double) HLL_REGISTERS / sum;
+	if (est <= 2.5 * HLL_REGISTERS && zeros > 0)
+		est = HLL_REGISTERS * log((double) HLL_REGISTERS / zeros);
+	return (lng) (est + 0.5);
+}
+
+#define AGGR_HLL(TYPE, HASH)						\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
+		for (;;) {						\
+			if (cand) {					\
+				if (cand >= candend)			\
+					break;				\
+				i = *cand++ - b->hseqbase;		\
+				if (i >= end)				\
+					break;				\
+			} else {					\
+				if (start >= end)			\
+					break;				\
+				i = start++;				\
+			}						\
+			if (g == NULL)					\
+				grp = 0;				\
+			else if (gids == NULL)				\
+				grp = g->tseqbase + i - min;		\
+			else if (gids[i] >= min && gids[i] <= max)	\
+				grp = gids[i] - min;			\
+			else						\
+				continue;				\
+			if (vals[i] != TYPE##_nil)			\
+				hlladd(regs + grp * HLL_REGISTERS, HASH(vals[i])); \
+		}							\
+	} while (0)
+
+#define HLLHASH_INT(v)	hllmix((ulng) (lng) (v))
+/* equal floating point values (0 and -0) must hash the same */
+#define HLLHASH_FLT(v)	hllflt(v)
+#define HLLHASH_DBL(v)	hlldbl(v)
+#define HLLHASH_HGE(v)	hllmix((ulng) (v) ^ hllmix((ulng) ((v) >> 64)))
+
+static inline ulng
+hllflt(flt v)
+{
+	unsigned int u;
+
+	if (v == 0)
+		v = 0;
+	memcpy(&u, &v, sizeof(u));
+	return hllmix(u);
+}
+
+static inline ulng
+hlldbl(dbl v)
+{
+	ulng u;
+
+	if (v == 0)
+		v = 0;
+	memcpy(&u, &v, sizeof(u));
+	return hllmix(u);
+}
+
+/* the registers of the sketches of b per group, HLL_REGISTERS per
+ * group one after the other */
+static bte *
+dogrouphll(BAT *b, BAT *g, BAT *e, BAT *s, oid *minp, BUN *ngrpp,
+	   const char *func)
+{
+	const oid *restrict gids;
+	oid min, max;
+	BUN ngrp, grp, i;
+	BUN start, end;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+	bte *restrict regs;
+	int t;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("%s: %s\n", func, err);
+		return NULL;
+	}
+	if ((regs = GDKzalloc((ngrp == 0 ? 1 : ngrp) * HLL_REGISTERS)) == NULL)
+		return NULL;
+	gids = g == NULL || BATtdense(g) ? NULL : (const oid *) Tloc(g, 0);
+
+	t = ATOMbasetype(b->ttype);
+	switch (t) {
+	case TYPE_bte:
+		AGGR_HLL(bte, HLLHASH_INT);
+		break;
+	case TYPE_sht:
+		AGGR_HLL(sht, HLLHASH_INT);
+		break;
+	case TYPE_int:
+		AGGR_HLL(int, HLLHASH_INT);
+		break;
+	case TYPE_lng:
+		AGGR_HLL(lng, HLLHASH_INT);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		AGGR_HLL(hge, HLLHASH_HGE);
+		break;
+#endif
+	case TYPE_flt:
+		AGGR_HLL(flt, HLLHASH_FLT);
+		break;
+	case TYPE_dbl:
+		AGGR_HLL(dbl, HLLHASH_DBL);
+		break;
+	default: {
+		BATiter bi = bat_iterator(b);
+		const void *nil = ATOMnilptr(b->ttype);
+		int (*atomcmp)(const void *, const void *) = ATOMcompare(b->ttype);
+		const void *v;
+
+		for (;;) {
+			if (cand) {
+				if (cand >= candend)
+					break;
+				i = *cand++ - b->hseqbase;
+				if (i >= end)
+					break;
+			} else {
+				if (start >= end)
+					break;
+				i = start++;
+			}
+			if (g == NULL)
+				grp = 0;
+			else if (gids == NULL)
+				grp = g->tseqbase + i - min;
+			else if (gids[i] >= min && gids[i] <= max)
+				grp = gids[i] - min;
+			else
+				continue;
+			v = BUNtail(bi, i);
+			if ((*atomcmp)(v, nil) == 0)
+				continue;
+			hlladd(regs + grp * HLL_REGISTERS,
+			       t == TYPE_str ? hllbytes(v, strlen(v)) :
+			       hllbytes(v, ATOMlen(b->ttype, v)));
+		}
+		break;
+	}
+	}
+	*minp = min;
+	*ngrpp = ngrp;
+	return regs;
+}
+
+static BAT *
+hllresult(const bte *regs, oid min, BUN ngrp)
+{
+	BUN grp;
+	lng *restrict cnts;
+	BAT *bn;
+
+	if ((bn = COLnew(min, TYPE_lng, ngrp, TRANSIENT)) == NULL)
+		return NULL;
+	cnts = (lng *) Tloc(bn, 0);
+	for (grp = 0; grp < ngrp; grp++)
+		cnts[grp] = hllestimate(regs + grp * HLL_REGISTERS);
+	BATsetcount(bn, ngrp);
+	bn->tkey = BATcount(bn) <= 1;
+	bn->tsorted = BATcount(bn) <= 1;
+	bn->trevsorted = BATcount(bn) <= 1;
+	bn->tnil = 0;
+	bn->tnonil = 1;
+	return bn;
+}
+
+/* calculate the approximate number of distinct values per group with
+ * optional candidates list */
+BAT *
+BATgroupapproxcountdistinct(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error)
+{
+	bte *regs;
+	oid min;
+	BUN ngrp;
+	BAT *bn;
+
+	assert(tp == TYPE_lng);
+	(void) tp;		/* compatibility (with other BATgroup* */
+	(void) skip_nils;	/* functions) argument; nils never count */
+	(void) abort_on_error;
+
+	if ((regs = dogrouphll(b, g, e, s, &min, &ngrp,
+			       "BATgroupapproxcountdistinct")) == NULL)
+		return NULL;
+	bn = hllresult(regs, min, ngrp);
+	GDKfree(regs);
+	return bn;
+}
+
+/* The sketches of the values of b per group in a form that can be
+ * merged: a bte BAT with the HLL_REGISTERS registers of every group
+ * one after the other.  BATgrouphllmerge merges any number of them. */
+BAT *
+BATgrouphllsketch(BAT *b, BAT *g, BAT *e, BAT *s)
+{
+	bte *regs;
+	oid min;
+	BUN ngrp;
+	BAT *bn;
+
+	if ((regs = dogrouphll(b, g, e, s, &min, &ngrp,
+			       "BATgrouphllsketch")) == NULL)
+		return NULL;
+	if ((bn = COLnew(0, TYPE_bte, ngrp * HLL_REGISTERS, TRANSIENT)) == NULL) {
+		GDKfree(regs);
+		return NULL;
+	}
+	memcpy(Tloc(bn, 0), regs, ngrp * HLL_REGISTERS);
+	GDKfree(regs);
+	BATsetcount(bn, ngrp * HLL_REGISTERS);
+	bn->tkey = 0;
+	bn->tsorted = bn->trevsorted = 0;
+	bn->tnil = 0;
+	bn->tnonil = 1;
+	return bn;
+}
+
+/* Merge the sketches r of BATgrouphllsketch into the approximate
+ * distinct counts of the groups g with extents e.  g is aligned with
+ * the groups the sketches were made for, r holds HLL_REGISTERS
+ * registers for each of them; without g all sketches are merged into
+ * a single count. */
 BAT *
-BATgroupsize(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error)
+BATgrouphllmerge(BAT *r, BAT *g, BAT *e)
 {
 	const oid *restrict gids;
 	oid min, max;
-	BUN i, ngrp;
-	const bit *restrict bits;
-	lng *restrict cnts;
-	BAT *bn = NULL;
+	BUN ngrp, grp, i, j, nsketch;
 	BUN start, end;
 	const oid *cand = NULL, *candend = NULL;
 	const char *err;
+	const bte *restrict vals;
+	bte *restrict regs, *restrict dst;
+	BAT *bn;
 
-	assert(tp == TYPE_lng);
-	assert(b->ttype == TYPE_bit);
-	/* compatibility arguments */
-	(void) tp;
-	(void) abort_on_error;
-	(void) skip_nils;
-
-	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
-				    &cand, &candend)) != NULL) {
-		GDKerror("BATgroupsize: %s\n", err);
+	if (r->ttype != TYPE_bte || BATcount(r) % HLL_REGISTERS != 0) {
+		GDKerror("BATgrouphllmerge: not a list of sketches.\n");
 		return NULL;
 	}
-	if (g == NULL) {
-		GDKerror("BATgroupsize: b and g must be aligned\n");
+	nsketch = BATcount(r) / HLL_REGISTERS;
+	if (g && BATcount(g) != nsketch) {
+		GDKerror("BATgrouphllmerge: sketches and groups do not match.\n");
 		return NULL;
 	}
-
-	if (BATcount(b) == 0 || ngrp == 0) {
-		/* trivial: no products, so return bat aligned with g
-		 * with zero in the tail */
-		lng zero = 0;
-		return BATconstant(ngrp == 0 ? 0 : min, TYPE_lng, &zero, ngrp, TRANSIENT);
+	/* g is aligned with the sketches, which is all the
+	 * initialization needs to know about them */
+	if ((err = BATgroupaggrinit(g ? g : r, g, e, NULL, &min, &max, &ngrp,
+				    &start, &end, &cand, &candend)) != NULL) {
+		GDKerror("BATgrouphllmerge: %s\n", err);
+		return NULL;
 	}
-
-	bn = COLnew(min, TYPE_lng, ngrp, TRANSIENT);
-	if (bn == NULL)
+	if ((regs = GDKzalloc((ngrp == 0 ? 1 : ngrp) * HLL_REGISTERS)) == NULL)
 		return NULL;
-	cnts = (lng *) Tloc(bn, 0);
-	memset(cnts, 0, ngrp * sizeof(lng));
-
-	if (BATtdense(g))
-		gids = NULL;
-	else
-		gids = (const oid *) Tloc(g, start);
-
-	bits = (const bit *) Tloc(b, 0);
-
-	for (;;) {
-		if (cand) {
-			if (cand == candend)
-				break;
-			i = *cand++ - b->hseqbase;
-			if (i >= end)
-				break;
-		} else {
-			i = start++;
-			if (i == end)
-				break;
-		}
-		if (bits[i] == 1 &&
-		    (gids == NULL || (gids[i] >= min && gids[i] <= max))) {
-			cnts[gids ? gids[i] - min : (oid) i]++;
-		}
+	gids = g == NULL || BATtdense(g) ? NULL : (const oid *) Tloc(g, 0);
+	vals = (const bte *) Tloc(r, 0);
+
+	for (i = 0; i < nsketch; i++, vals += HLL_REGISTERS) {
+		if (g == NULL)
+			grp = 0;
+		else if (gids == NULL)
+			grp = g->tseqbase + i - min;
+		else if (gids[i] >= min && gids[i] <= max)
+			grp = gids[i] - min;
+		else
+			continue;
+		dst = regs + grp * HLL_REGISTERS;
+		for (j = 0; j < HLL_REGISTERS; j++)
+			if (dst[j] < vals[j])
+				dst[j] = vals[j];
 	}
-	BATsetcount(bn, ngrp);
-	bn->tkey = BATcount(bn) <= 1;
-	bn->tsorted = BATcount(bn) <= 1;
-	bn->trevsorted = BATcount(bn) <= 1;
-	bn->tnil = 0;
-	bn->tnonil = 1;
+	bn = hllresult(regs, min, ngrp);
+	GDKfree(regs);
 	return bn;
 }
 
@@ -2589,7 +3329,18 @@ BATminmax(BAT *b, void *aggr,
 	const void *res;
 	int s;
 	BATiter bi;
-
+	ValRecord zm;
+
+	if (ZMminmax(b, minmax == do_groupmax, &zm.val)) {
+		/* the zone map knows the smallest and largest value
+		 * of each block */
+		res = &zm.val;
+		if (aggr == NULL)
+			aggr = GDKmalloc(ATOMsize(b->ttype));
+		if (aggr != NULL)	/* else: malloc error */
+			memcpy(aggr, res, ATOMsize(b->ttype));
+		return aggr;
+	}
 	if ((VIEWtparent(b) == 0 ||
 	     BATcount(b) == BATcount(BBPdescriptor(VIEWtparent(b)))) &&
 	    BATcheckimprints(b)) {
@@ -2896,6 +3647,462 @@ BATgroupquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile,
 	return NULL;
 }
 
+/* ---------------------------------------------------------------------- */
+/* approximate quantiles/median */
+
+/* Approximate quantiles are calculated from a t-digest per group: a
+ * list of centroids (a mean and the number of values it stands for)
+ * that summarizes the values of the group.  Values are collected in
+ * the list until it is full, then the list is sorted and adjacent
+ * centroids are merged as long as the merged centroid stays within
+ * the size the scale function allows at its position.  The scale
+ * function keeps centroids near the extremes small, so that the tail
+ * quantiles are as accurate as the median.  The list of a group never
+ * grows beyond TDIGEST_BUFFER entries, whatever the number of values.
+ *
+ * Digests of separate parts of the input can be merged into the
+ * digest of all of it, which is how mitosis splits these aggregates:
+ * BATgroupquantilesketch exports the (compressed) digests and
+ * BATgroupsketchquantile merges them and calculates the quantiles. */
+
+/* the compression parameter: about the number of centroids kept */
+#define TDIGEST_COMPRESSION	100
+/* the maximum number of centroids and unmerged values of a group */
+#define TDIGEST_BUFFER		(10 * TDIGEST_COMPRESSION)
+
+struct tdigest {
+	dbl *mean;
+	lng *weight;
+	BUN n;			/* number of entries in use */
+	BUN size;		/* number of entries allocated */
+	int nil;		/* saw a nil value (and did not skip it) */
+};
+
+static struct tdigest *
+tdigestinit(BUN ngrp)
+{
+	return GDKzalloc(ngrp * sizeof(struct tdigest));
+}
+
+static void
+tdigestdestroy(struct tdigest *td, BUN ngrp)
+{
+	BUN grp;
+
+	if (td == NULL)
+		return;
+	for (grp = 0; grp < ngrp; grp++) {
+		GDKfree(td[grp].mean);
+		GDKfree(td[grp].weight);
+	}
+	GDKfree(td);
+}
+
+/* the largest cumulative weight the centroid that starts after cum
+ * of total weight may reach (the k1 scale function of the t-digest
+ * paper, k(q) = d/(2pi) * asin(2q - 1), increased by one) */
+static double
+tdigestlimit(lng cum, lng total)
+{
+	double k = asin(2.0 * cum / total - 1) + 2 * M_PI / TDIGEST_COMPRESSION;
+
+	if (k >= M_PI / 2)
+		return (double) total;
+	return (sin(k) + 1) / 2 * total;
+}
+
+/* sort the entries and merge them into as few centroids as the scale
+ * function allows; the first and the last entry, the smallest and the
+ * largest value, are kept on their own so that the extreme quantiles
+ * stay exact */
+static void
+tdigestcompress(struct tdigest *td)
+{
+	BUN i, j;
+	lng cum = 0, total = 0;
+	double limit;
+
+	if (td->n <= 2)
+		return;
+	GDKqsort(td->mean, td->weight, NULL, td->n, sizeof(dbl), sizeof(lng), TYPE_dbl);
+	for (i = 0; i < td->n; i++)
+		total += td->weight[i];
+	limit = 0;
+	for (i = 0, j = 1; j < td->n; j++) {
+		if (j < td->n - 1 &&
+		    cum + td->weight[i] + td->weight[j] <= limit) {
+			td->weight[i] += td->weight[j];
+			td->mean[i] += (td->mean[j] - td->mean[i]) * td->weight[j] / td->weight[i];
+		} else {
+			cum += td->weight[i];
+			limit = tdigestlimit(cum, total);
+			i++;
+			td->mean[i] = td->mean[j];
+			td->weight[i] = td->weight[j];
+		}
+	}
+	td->n = i + 1;
+}
+
+static gdk_return
+tdigestadd(struct tdigest *td, dbl mean, lng weight)
+{
+	if (td->n == td->size) {
+		if (td->size >= TDIGEST_BUFFER) {
+			tdigestcompress(td);
+		} else {
+			BUN size = td->size == 0 ? 8 : td->size * 2;
+			dbl *m;
+			lng *w;
+
+			if (size > TDIGEST_BUFFER)
+				size = TDIGEST_BUFFER;
+			if ((m = GDKrealloc(td->mean, size * sizeof(dbl))) == NULL)
+				return GDK_FAIL;
+			td->mean = m;
+			if ((w = GDKrealloc(td->weight, size * sizeof(lng))) == NULL)
+				return GDK_FAIL;
+			td->weight = w;
+			td->size = size;
+		}
+	}
+	td->mean[td->n] = mean;
+	td->weight[td->n] = weight;
+	td->n++;
+	return GDK_SUCCEED;
+}
+
+/* The quantile of a compressed digest.  The value at rank r (from 0)
+ * is interpolated between the means of the centroids around it, where
+ * a centroid of weight w that starts at rank c has its mean at rank
+ * c + (w - 1) / 2.  If all centroids are single values, this is the
+ * exact quantile, interpolated between the two nearest values. */
+static dbl
+tdigestquantile(const struct tdigest *td, double quantile)
+{
+	BUN i;
+	lng total = 0;
+	double rank, cum = 0, lo, hi;
+
+	if (td->nil || td->n == 0)
+		return dbl_nil;
+	for (i = 0; i < td->n; i++)
+		total += td->weight[i];
+	rank = quantile * (total - 1);
+	for (i = 0; i < td->n; i++) {
+		hi = cum + (td->weight[i] - 1) / 2.0;
+		if (rank <= hi) {
+			if (i == 0)
+				return td->mean[0];
+			lo = cum - td->weight[i - 1] + (td->weight[i - 1] - 1) / 2.0;
+			return td->mean[i - 1] + (td->mean[i] - td->mean[i - 1]) * (rank - lo) / (hi - lo);
+		}
+		cum += td->weight[i];
+	}
+	return td->mean[td->n - 1];
+}
+
+#define AGGR_TDIGEST(TYPE)						\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
+		for (;;) {						\
+			if (cand) {					\
+				if (cand >= candend)			\
+					break;				\
+				i = *cand++ - b->hseqbase;		\
+			} else {					\
+				if (start >= end)			\
+					break;				\
+				i = start++;				\
+			}						\
+			if (g == NULL)					\
+				grp = 0;				\
+			else if (gids == NULL)				\
+				grp = g->tseqbase + i - min;		\
+			else if (gids[i] >= min && gids[i] <= max)	\
+				grp = gids[i] - min;			\
+			else						\
+				continue;				\
+			if (vals[i] == TYPE##_nil) {			\
+				if (!skip_nils)				\
+					td[grp].nil = 1;		\
+			} else if (!td[grp].nil &&			\
+				   tdigestadd(&td[grp], (dbl) vals[i], 1) != GDK_SUCCEED) \
+				goto bailout;				\
+		}							\
+	} while (0)
+
+/* the digests of the values of b per group */
+static struct tdigest *
+dogrouptdigest(BAT *b, BAT *g, BAT *e, BAT *s, int skip_nils, oid *minp,
+	       BUN *ngrpp, const char *func)
+{
+	const oid *restrict gids;
+	oid min, max;
+	BUN ngrp, grp, i;
+	BUN start, end;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+	struct tdigest *td;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("%s: %s\n", func, err);
+		return NULL;
+	}
+	if ((td = tdigestinit(ngrp == 0 ? 1 : ngrp)) == NULL)
+		return NULL;
+	gids = g == NULL || BATtdense(g) ? NULL : (const oid *) Tloc(g, 0);
+
+	switch (b->ttype) {
+	case TYPE_bte:
+		AGGR_TDIGEST(bte);
+		break;
+	case TYPE_sht:
+		AGGR_TDIGEST(sht);
+		break;
+	case TYPE_int:
+		AGGR_TDIGEST(int);
+		break;
+	case TYPE_lng:
+		AGGR_TDIGEST(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		AGGR_TDIGEST(hge);
+		break;
+#endif
+	case TYPE_flt:
+		AGGR_TDIGEST(flt);
+		break;
+	case TYPE_dbl:
+		AGGR_TDIGEST(dbl);
+		break;
+	default:
+		GDKerror("%s: type (%s) not supported.\n",
+			 func, ATOMname(b->ttype));
+		goto bailout;
+	}
+	for (grp = 0; grp < ngrp; grp++)
+		tdigestcompress(&td[grp]);
+	*minp = min;
+	*ngrpp = ngrp;
+	return td;
+
+  bailout:
+	tdigestdestroy(td, ngrp == 0 ? 1 : ngrp);
+	return NULL;
+}
+
+static BAT *
+tdigestresult(struct tdigest *td, oid min, BUN ngrp, double quantile)
+{
+	BUN grp, nils = 0;
+	dbl *restrict dbls;
+	BAT *bn;
+
+	if ((bn = COLnew(min, TYPE_dbl, ngrp, TRANSIENT)) == NULL)
+		return NULL;
+	dbls = (dbl *) Tloc(bn, 0);
+	for (grp = 0; grp < ngrp; grp++) {
+		dbls[grp] = tdigestquantile(&td[grp], quantile);
+		nils += dbls[grp] == dbl_nil;
+	}
+	BATsetcount(bn, ngrp);
+	bn->tkey = ngrp <= 1;
+	bn->tsorted = ngrp <= 1;
+	bn->trevsorted = ngrp <= 1;
+	bn->tnil = nils != 0;
+	bn->tnonil = nils == 0;
+	return bn;
+}
+
+/* The approximate quantile of the values of each group, as dbl,
+ * whatever the (numeric) type of b.  Arguments as for
+ * BATgroupquantile. */
+BAT *
+BATgroupapproxquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile,
+		       int skip_nils, int abort_on_error)
+{
+	struct tdigest *td;
+	oid min;
+	BUN ngrp;
+	BAT *bn;
+
+	assert(tp == TYPE_dbl);
+	(void) tp;		/* compatibility (with other BATgroup* */
+	(void) abort_on_error;	/* functions) argument */
+
+	if (quantile < 0 || quantile > 1) {
+		GDKerror("BATgroupapproxquantile: cannot determine quantile for "
+			 "p=%f (p has to be in [0,1])\n", quantile);
+		return NULL;
+	}
+	if ((td = dogrouptdigest(b, g, e, s, skip_nils, &min, &ngrp,
+				 "BATgroupapproxquantile")) == NULL)
+		return NULL;
+	bn = tdigestresult(td, min, ngrp, quantile);
+	tdigestdestroy(td, ngrp == 0 ? 1 : ngrp);
+	return bn;
+}
+
+BAT *
+BATgroupapproxmedian(BAT *b, BAT *g, BAT *e, BAT *s, int tp,
+		     int skip_nils, int abort_on_error)
+{
+	return BATgroupapproxquantile(b, g, e, s, tp, 0.5, skip_nils, abort_on_error);
+}
+
+/* The digests of the values of b per group in a form that can be
+ * merged: *mp and *wp get the means and weights of the centroids of
+ * all groups one after the other, *cp the number of centroids of each
+ * group (nil for a group with a nil value if skip_nils is not set).
+ * BATgroupsketchquantile merges any number of them. */
+gdk_return
+BATgroupquantilesketch(BAT **mp, BAT **wp, BAT **cp, BAT *b, BAT *g, BAT *e, BAT *s, int skip_nils)
+{
+	struct tdigest *td;
+	oid min;
+	BUN ngrp, grp, total = 0;
+	BAT *mn = NULL, *wn = NULL, *cn = NULL;
+	dbl *restrict means;
+	lng *restrict weights, *restrict cnts;
+
+	if ((td = dogrouptdigest(b, g, e, s, skip_nils, &min, &ngrp,
+				 "BATgroupquantilesketch")) == NULL)
+		return GDK_FAIL;
+	for (grp = 0; grp < ngrp; grp++)
+		if (!td[grp].nil)
+			total += td[grp].n;
+	if ((mn = COLnew(0, TYPE_dbl, total, TRANSIENT)) == NULL ||
+	    (wn = COLnew(0, TYPE_lng, total, TRANSIENT)) == NULL ||
+	    (cn = COLnew(min, TYPE_lng, ngrp, TRANSIENT)) == NULL) {
+		tdigestdestroy(td, ngrp == 0 ? 1 : ngrp);
+		if (mn)
+			BBPreclaim(mn);
+		if (wn)
+			BBPreclaim(wn);
+		return GDK_FAIL;
+	}
+	means = (dbl *) Tloc(mn, 0);
+	weights = (lng *) Tloc(wn, 0);
+	cnts = (lng *) Tloc(cn, 0);
+	for (grp = 0; grp < ngrp; grp++) {
+		if (td[grp].nil) {
+			cnts[grp] = lng_nil;
+			continue;
+		}
+		cnts[grp] = (lng) td[grp].n;
+		if (td[grp].n > 0) {
+			memcpy(means, td[grp].mean, td[grp].n * sizeof(dbl));
+			memcpy(weights, td[grp].weight, td[grp].n * sizeof(lng));
+			means += td[grp].n;
+			weights += td[grp].n;
+		}
+	}
+	tdigestdestroy(td, ngrp == 0 ? 1 : ngrp);
+
+	BATsetcount(mn, total);
+	mn->tkey = 0;
+	mn->tsorted = mn->trevsorted = total <= 1;
+	mn->tnil = 0;
+	mn->tnonil = 1;
+	BATsetcount(wn, total);
+	wn->tkey = 0;
+	wn->tsorted = wn->trevsorted = total <= 1;
+	wn->tnil = 0;
+	wn->tnonil = 1;
+	BATsetcount(cn, ngrp);
+	cn->tkey = 0;
+	cn->tsorted = cn->trevsorted = ngrp <= 1;
+	cn->tnil = !skip_nils;
+	cn->tnonil = skip_nils;
+	*mp = mn;
+	*wp = wn;
+	*cp = cn;
+	return GDK_SUCCEED;
+}
+
+/* Merge the digests m and w of BATgroupquantilesketch, c the number
+ * of centroids in m and w of each of the groups they were calculated
+ * for, into the approximate quantiles of the groups g (aligned with
+ * c) with extents e. */
+BAT *
+BATgroupsketchquantile(BAT *m, BAT *w, BAT *c, BAT *g, BAT *e, double quantile, int skip_nils)
+{
+	const oid *restrict gids;
+	oid min, max;
+	BUN ngrp, grp, i, r, pos = 0;
+	BUN start, end;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+	struct tdigest *td;
+	const dbl *restrict means;
+	const lng *restrict weights, *restrict cnts;
+	lng k;
+	BAT *bn;
+
+	if ((err = BATgroupaggrinit(c, g, e, NULL, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("BATgroupsketchquantile: %s\n", err);
+		return NULL;
+	}
+	if (m->ttype != TYPE_dbl || w->ttype != TYPE_lng || c->ttype != TYPE_lng ||
+	    BATcount(m) != BATcount(w)) {
+		GDKerror("BATgroupsketchquantile: type combination not supported.\n");
+		return NULL;
+	}
+	if (quantile < 0 || quantile > 1) {
+		GDKerror("BATgroupsketchquantile: cannot determine quantile for "
+			 "p=%f (p has to be in [0,1])\n", quantile);
+		return NULL;
+	}
+
+	if ((td = tdigestinit(ngrp == 0 ? 1 : ngrp)) == NULL)
+		return NULL;
+	gids = g == NULL || BATtdense(g) ? NULL : (const oid *) Tloc(g, 0);
+	cnts = (const lng *) Tloc(c, 0);
+	means = (const dbl *) Tloc(m, 0);
+	weights = (const lng *) Tloc(w, 0);
+
+	for (i = 0; i < BATcount(c); i++) {
+		k = cnts[i];
+		if (g == NULL)
+			grp = 0;
+		else if (gids == NULL)
+			grp = g->tseqbase + i - min;
+		else if (gids[i] >= min && gids[i] <= max)
+			grp = gids[i] - min;
+		else
+			grp = BUN_NONE;
+		if (k == lng_nil) {
+			if (!skip_nils && grp != BUN_NONE)
+				td[grp].nil = 1;
+			continue;
+		}
+		if (pos + k > BATcount(m)) {
+			GDKerror("BATgroupsketchquantile: centroids and counts do not match.\n");
+			goto bailout;
+		}
+		if (grp != BUN_NONE && !td[grp].nil) {
+			for (r = 0; r < (BUN) k; r++)
+				if (tdigestadd(&td[grp], means[pos + r], weights[pos + r]) != GDK_SUCCEED)
+					goto bailout;
+		}
+		pos += k;
+	}
+	for (grp = 0; grp < ngrp; grp++)
+		tdigestcompress(&td[grp]);
+
+	bn = tdigestresult(td, min, ngrp, quantile);
+	tdigestdestroy(td, ngrp == 0 ? 1 : ngrp);
+	return bn;
+
+  bailout:
+	tdigestdestroy(td, ngrp == 0 ? 1 : ngrp);
+	return NULL;
+}
+
 /* ---------------------------------------------------------------------- */
 /* standard deviation (both biased and non-biased) */
 
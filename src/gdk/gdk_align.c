@@ -183,6 +183,8 @@ VIEWcreate_(oid seq, BAT *b, int slice_view)
 	bn->timprints = NULL;
 	/* Order OID index */
 	bn->torderidx = NULL;
+	/* views use the zone map of their parent */
+	bn->tzonemap = NULL;
 	if (BBPcacheit(bn, 1) != GDK_SUCCEED) {	/* enter in BBP */
 		if (tp)
 			BBPunshare(tp);
@@ -23,6 +23,8 @@
  * ATOMIC_SUB -- subtract a value from a variable, return original value;
  * ATOMIC_INC -- increment a variable's value, return new value;
  * ATOMIC_DEC -- decrement a variable's value, return new value;
+ * ATOMIC_CAS -- compare-and-swap: if the variable has the expected
+ *               value, replace it, return whether it was replaced;
  * These interfaces work on variables of type ATOMIC_TYPE
  * (int or lng depending on architecture).
  *
@@ -53,6 +55,7 @@
 #define ATOMIC_SUB(var, val, lck)	AO_fetch_and_add(&var, -(val))
 #define ATOMIC_INC(var, lck)		(AO_fetch_and_add1(&var) + 1)
 #define ATOMIC_DEC(var, lck)		(AO_fetch_and_sub1(&var) - 1)
+#define ATOMIC_CAS(var, old, new, lck)	AO_compare_and_swap_full(&var, (old), (new))
 
 #define ATOMIC_INIT(lck)		((void) 0)
 
@@ -77,6 +80,7 @@
 #define ATOMIC_SUB(var, val, lck)	_InterlockedExchangeAdd64(&var, -(val))
 #define ATOMIC_INC(var, lck)		_InterlockedIncrement64(&var)
 #define ATOMIC_DEC(var, lck)		_InterlockedDecrement64(&var)
+#define ATOMIC_CAS(var, old, new, lck)	(_InterlockedCompareExchange64(&var, (new), (old)) == (old))
 
 #pragma intrinsic(_InterlockedExchange64)
 #pragma intrinsic(_InterlockedExchangeAdd64)
@@ -94,6 +98,7 @@
 #define ATOMIC_SUB(var, val, lck)	_InterlockedExchangeAdd(&var, -(val))
 #define ATOMIC_INC(var, lck)		_InterlockedIncrement(&var)
 #define ATOMIC_DEC(var, lck)		_InterlockedDecrement(&var)
+#define ATOMIC_CAS(var, old, new, lck)	(_InterlockedCompareExchange(&var, (new), (old)) == (old))
 
 #pragma intrinsic(_InterlockedExchange)
 #pragma intrinsic(_InterlockedExchangeAdd)
@@ -127,6 +132,7 @@
 #define ATOMIC_SUB(var, val, lck)	__atomic_fetch_sub(&var, (val), __ATOMIC_SEQ_CST)
 #define ATOMIC_INC(var, lck)		__atomic_add_fetch(&var, 1, __ATOMIC_SEQ_CST)
 #define ATOMIC_DEC(var, lck)		__atomic_sub_fetch(&var, 1, __ATOMIC_SEQ_CST)
+#define ATOMIC_CAS(var, old, new, lck)	__sync_bool_compare_and_swap(&var, (old), (new))
 
 #define ATOMIC_FLAG			char
 #define ATOMIC_FLAG_INIT		{ 0 }
@@ -142,6 +148,7 @@
 #define ATOMIC_SUB(var, val, lck)	__sync_fetch_and_sub(&var, (val))
 #define ATOMIC_INC(var, lck)		__sync_add_and_fetch(&var, 1)
 #define ATOMIC_DEC(var, lck)		__sync_sub_and_fetch(&var, 1)
+#define ATOMIC_CAS(var, old, new, lck)	__sync_bool_compare_and_swap(&var, (old), (new))
 
 #define ATOMIC_FLAG			int
 #define ATOMIC_FLAG_INIT		{ 0 }
@@ -229,6 +236,18 @@ __ATOMIC_DEC(volatile ATOMIC_TYPE *var, pthread_mutex_t *lck)
 }
 #define ATOMIC_DEC(var, lck)		__ATOMIC_DEC(&var, &(lck).lock)
 
+static inline int
+__ATOMIC_CAS(volatile ATOMIC_TYPE *var, ATOMIC_TYPE old, ATOMIC_TYPE new, pthread_mutex_t *lck)
+{
+	int swapped;
+	pthread_mutex_lock(lck);
+	if ((swapped = *var == old) != 0)
+		*var = new;
+	pthread_mutex_unlock(lck);
+	return swapped;
+}
+#define ATOMIC_CAS(var, old, new, lck)	__ATOMIC_CAS(&var, (old), (new), &(lck).lock)
+
 #define USE_PTHREAD_LOCKS		/* must use pthread locks */
 #define ATOMIC_LOCK			/* must use locks for atomic access */
 #define ATOMIC_INIT(lck)		MT_lock_init(&(lck), #lck)
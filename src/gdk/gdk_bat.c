@@ -509,6 +509,7 @@ BATclear(BAT *b, int force)
 	HASHdestroy(b);
 	IMPSdestroy(b);
 	OIDXdestroy(b);
+	ZMdestroy(b);
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
 
@@ -575,6 +576,7 @@ BATfree(BAT *b)
 	HASHfree(b);
 	IMPSfree(b);
 	OIDXfree(b);
+	ZMfree(b);
 	if (b->ttype)
 		HEAPfree(&b->theap, 0);
 	else
@@ -1061,6 +1063,7 @@ BUNappend(BAT *b, const void *t, bit force)
 
 	IMPSdestroy(b); /* no support for inserts in imprints yet */
 	OIDXdestroy(b);
+	ZMappend(b, 1);
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
 	if (b->thash == (Hash *) 1) {
@@ -1125,6 +1128,7 @@ BUNdelete(BAT *b, oid o)
 	}
 	IMPSdestroy(b);
 	OIDXdestroy(b);
+	ZMdestroy(b);
 	HASHdestroy(b);
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
@@ -1169,6 +1173,7 @@ BUNinplace(BAT *b, BUN p, const void *t, bit force)
 	b->tprops = NULL;
 	OIDXdestroy(b);
 	IMPSdestroy(b);
+	ZMdestroy(b);
 	Treplacevalue(b, BUNtloc(bi, p), t);
 
 	tt = b->ttype;
@@ -751,6 +751,7 @@ BATappend(BAT *b, BAT *n, BAT *s, bit force)
 			}
 		}
 	}
+	ZMappend(b, cnt);	/* extend the zone map with the new values */
 	if (b->tunique)
 		BBPunfix(s->batCacheid);
 	return GDK_SUCCEED;
@@ -870,6 +871,7 @@ BATdel(BAT *b, BAT *d)
 	b->tnokey[0] = b->tnokey[1] = 0;
 	PROPdestroy(b->tprops);
 	b->tprops = NULL;
+	ZMdestroy(b);
 
 	return GDK_SUCCEED;
 }
@@ -1304,6 +1306,9 @@ BATordered_rev(BAT *b)
 	return b->trevsorted;
 }
 
+/* inputs at least this large are sorted by GDKpsort */
+#define PSORT_MIN	((size_t) 1 << 18)
+
 /* figure out which sort function is to be called
  * stable sort can produce an error (not enough memory available),
  * "quick" sort does not produce errors */
@@ -1313,6 +1318,8 @@ do_sort(void *h, void *t, const void *base, size_t n, int hs, int ts, int tpe,
 {
 	if (n <= 1)		/* trivially sorted */
 		return GDK_SUCCEED;
+	if (n >= PSORT_MIN)
+		return GDKpsort(h, t, base, n, hs, ts, tpe, reverse, stable);
 	if (reverse) {
 		if (stable) {
 			return GDKssort_rev(h, t, base, n, hs, ts, tpe);
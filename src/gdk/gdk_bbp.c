@@ -3757,6 +3757,11 @@ BBPdiskscan(const char *parent, size_t baseoff)
 #else
 				delete = TRUE;
 #endif
+			} else if (strncmp(p + 1, "tzonemap", 8) == 0) {
+				BAT *b = getdesc(bid);
+				delete = b == NULL;
+				if (!delete)
+					b->tzonemap = (Heap *) 1;
 			} else if (strncmp(p + 1, "priv", 4) != 0 &&
 				   strncmp(p + 1, "new", 3) != 0 &&
 				   strncmp(p + 1, "head", 4) != 0 &&
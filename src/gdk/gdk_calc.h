@@ -121,14 +121,23 @@ gdk_export gdk_return VARconvert(ValPtr ret, const ValRecord *v, int abort_on_er
 gdk_export gdk_return BATcalcavg(BAT *b, BAT *s, dbl *avg, BUN *vals);
 
 gdk_export BAT *BATgroupsum(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
+gdk_export gdk_return BATgroupsumpartials(BAT **pp, BAT **cp, BAT **np, BAT *b, BAT *g, BAT *e, BAT *s, int skip_nils);
+gdk_export BAT *BATgroupfsum(BAT *p, BAT *c, BAT *n, BAT *g, BAT *e, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupprod(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export gdk_return BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupcount(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupsize(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
+gdk_export BAT *BATgroupapproxcountdistinct(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
+gdk_export BAT *BATgrouphllsketch(BAT *b, BAT *g, BAT *e, BAT *s);
+gdk_export BAT *BATgrouphllmerge(BAT *r, BAT *g, BAT *e);
 gdk_export BAT *BATgroupmin(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupmax(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupmedian(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile, int skip_nils, int abort_on_error);
+gdk_export BAT *BATgroupapproxmedian(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
+gdk_export BAT *BATgroupapproxquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile, int skip_nils, int abort_on_error);
+gdk_export gdk_return BATgroupquantilesketch(BAT **mp, BAT **wp, BAT **cp, BAT *b, BAT *g, BAT *e, BAT *s, int skip_nils);
+gdk_export BAT *BATgroupsketchquantile(BAT *m, BAT *w, BAT *c, BAT *g, BAT *e, double quantile, int skip_nils);
 
 /* helper function for grouped aggregates */
 gdk_export const char *BATgroupaggrinit(
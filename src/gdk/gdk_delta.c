@@ -100,6 +100,7 @@ BATundo(BAT *b)
 		int (*tunfix) (const void *) = BATatoms[b->ttype].atomUnfix;
 		void (*tatmdel) (Heap *, var_t *) = BATatoms[b->ttype].atomDel;
 
+		ZMdestroy(b);
 		if (tunfix || tatmdel || b->thash) {
 			HASHdestroy(b);
 			for (p = bunfirst; p <= bunlast; p++, i++) {
@@ -265,6 +265,7 @@
 		INIT_0;							\
 		if (grps) {						\
 			for (r = 0; r < cnt; r++) {			\
+				INTERRUPTcheck(qry, r, goto error);	\
 				if (cand) {				\
 					p = cand[r] - hseqb + lo;	\
 				} else {				\
@@ -313,6 +314,7 @@
 			}						\
 		} else {						\
 			for (r = 0; r < cnt; r++) {			\
+				INTERRUPTcheck(qry, r, goto error);	\
 				if (cand) {				\
 					p = cand[r] - hseqb + lo;	\
 				} else {				\
@@ -418,6 +420,7 @@ pop(oid x)
 	do {								\
 		if (cand) {						\
 			for (r = 0; r < cnt; r++) {			\
+				INTERRUPTcheck(qry, r, goto error);	\
 				p = cand[r] - b->hseqbase;		\
 				assert(p < end);			\
 				INIT_1;					\
@@ -452,6 +455,7 @@ pop(oid x)
 			}						\
 		} else {						\
 			for (r = 0; r < cnt; r++) {			\
+				INTERRUPTcheck(qry, r, goto error);	\
 				p = start + r;				\
 				assert(p < end);			\
 				INIT_1;					\
@@ -515,6 +519,412 @@ pop(oid x)
 	)
 
 
+/* Large inputs without a usable hash table are grouped in parallel.
+ * The rows are scattered over partitions by the hash of their value
+ * (and old group), so that equal values end up in the same partition,
+ * and each partition is grouped on its own by a separate thread.  The
+ * groups are then numbered in the order of their first occurrence,
+ * which gives the same result as the sequential scan. */
+#define GRP_PARALLEL_MIN	((BUN) 1 << 20)
+#define GRP_MAXPARTS		256
+#define GRP_BITS		(8 * SIZEOF_OID)
+#if SIZEOF_BUN == 8
+#define GRP_MULT		((BUN) 0x9E3779B97F4A7C15)
+#else
+#define GRP_MULT		((BUN) 0x9E3779B9)
+#endif
+
+typedef struct {
+	BAT *b;
+	BATiter bi;
+	int t;			/* storage type used for comparing */
+	int (*cmp)(const void *, const void *);
+	const oid *grps;	/* old groups, if subgrouping */
+	BUN start;		/* first row in b */
+	BUN cnt;		/* number of rows */
+	int nthreads;
+	int nparts;		/* a power of two */
+	int pshift;		/* partition is top bits of hash*GRP_MULT */
+	int phase;
+	BUN *hashes;		/* per row hash value */
+	BUN *rows;		/* rows ordered by partition */
+	BUN pstart[GRP_MAXPARTS + 1];
+	BUN nlgrp[GRP_MAXPARTS]; /* number of groups per partition */
+	BUN *firsts;		/* first row of each group, at pstart */
+	lng *lcnts;		/* size of each group, at pstart */
+	oid *bits;		/* rows that start a group */
+	BUN *ranks;		/* set bits before each word of bits */
+	oid *ngrps;		/* output groups */
+	oid *exts;
+	lng *cnts;
+	oid hseqb;
+	Interrupt *qry;
+} grp_parallel_t;
+
+typedef struct {
+	grp_parallel_t *gp;
+	int id;
+	int failed;
+	int unsorted;
+	BUN hist[GRP_MAXPARTS];	/* rows per partition, then scatter position */
+} grp_worker_t;
+
+#define GRPpar_part(gp, hv)	((int) (((hv) * GRP_MULT) >> (gp)->pshift))
+
+#define GRPpar_hash_rows(HASH)						\
+	do {								\
+		for (r = lo; r < hi; r++) {				\
+			if (((r - lo) & (INTERRUPT_MORSEL - 1)) == 0 &&	\
+			    INTERRUPTED(gp->qry)) {			\
+				w->failed = 1;				\
+				return;					\
+			}						\
+			p = gp->start + r;				\
+			hv = (BUN) (HASH);				\
+			if (gp->grps)					\
+				hv += gp->grps[r] * GRP_MULT;		\
+			gp->hashes[r] = hv;				\
+			w->hist[GRPpar_part(gp, hv)]++;			\
+		}							\
+	} while (0)
+
+static void
+GRPpar_hash(grp_parallel_t *gp, grp_worker_t *w)
+{
+	BUN lo = gp->cnt * w->id / gp->nthreads;
+	BUN hi = gp->cnt * (w->id + 1) / gp->nthreads;
+	BUN r, p, hv;
+	const void *vals = Tloc(gp->b, 0);
+
+	switch (gp->t) {
+	case TYPE_bte:
+		GRPpar_hash_rows(mix_int(((const unsigned char *) vals)[p]));
+		break;
+	case TYPE_sht:
+		GRPpar_hash_rows(mix_int(((const unsigned short *) vals)[p]));
+		break;
+	case TYPE_int:
+		GRPpar_hash_rows(mix_int(((const unsigned int *) vals)[p]));
+		break;
+	case TYPE_lng:
+		GRPpar_hash_rows(mix_lng(((const ulng *) vals)[p]));
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		GRPpar_hash_rows(mix_hge(((const uhge *) vals)[p]));
+		break;
+#endif
+	case TYPE_flt:
+		GRPpar_hash_rows(mix_int(((const unsigned int *) vals)[p]));
+		break;
+	case TYPE_dbl:
+		GRPpar_hash_rows(mix_lng(((const ulng *) vals)[p]));
+		break;
+	default:
+		GRPpar_hash_rows(ATOMhash(gp->b->ttype, BUNtail(gp->bi, p)));
+		break;
+	}
+}
+
+static void
+GRPpar_scatter(grp_parallel_t *gp, grp_worker_t *w)
+{
+	BUN lo = gp->cnt * w->id / gp->nthreads;
+	BUN hi = gp->cnt * (w->id + 1) / gp->nthreads;
+	BUN r;
+
+	for (r = lo; r < hi; r++)
+		gp->rows[w->hist[GRPpar_part(gp, gp->hashes[r])]++] = r;
+}
+
+#define GRPpar_build_rows(EQ)						\
+	do {								\
+		for (i = gp->pstart[k]; i < gp->pstart[k + 1]; i++) {	\
+			r = gp->rows[i];				\
+			hv = gp->hashes[r];				\
+			for (lg = heads[hv & mask];			\
+			     lg != BUN_NONE;				\
+			     lg = next[lg]) {				\
+				q = firsts[lg];				\
+				if (gp->hashes[q] == hv &&		\
+				    (gp->grps == NULL ||		\
+				     gp->grps[q] == gp->grps[r]) &&	\
+				    (EQ))				\
+					break;				\
+			}						\
+			if (lg == BUN_NONE) {				\
+				/* enter new group into hash table */	\
+				lg = ng++;				\
+				firsts[lg] = r;				\
+				lcnts[lg] = 0;				\
+				next[lg] = heads[hv & mask];		\
+				heads[hv & mask] = lg;			\
+			}						\
+			lcnts[lg]++;					\
+			gp->ngrps[r] = lg;				\
+		}							\
+	} while (0)
+
+#define GRPpar_build_tpe(TYPE)						\
+	do {								\
+		const TYPE *v = (const TYPE *) Tloc(gp->b, 0) + gp->start; \
+		GRPpar_build_rows(v[q] == v[r]);			\
+	} while (0)
+
+static void
+GRPpar_build(grp_parallel_t *gp, grp_worker_t *w)
+{
+	int k;
+
+	for (k = w->id; k < gp->nparts; k += gp->nthreads) {
+		BUN n = gp->pstart[k + 1] - gp->pstart[k];
+		BUN *firsts = gp->firsts + gp->pstart[k];
+		lng *lcnts = gp->lcnts + gp->pstart[k];
+		BUN *heads, *next, mask = 63, ng = 0, i, r, q, lg, hv;
+
+		if (INTERRUPTED(gp->qry)) {
+			w->failed = 1;
+			return;
+		}
+		gp->nlgrp[k] = 0;
+		if (n == 0)
+			continue;
+		while (mask < n)
+			mask = (mask << 1) | 1;
+		heads = GDKmalloc((mask + 1) * sizeof(BUN));
+		next = GDKmalloc(n * sizeof(BUN));
+		if (heads == NULL || next == NULL) {
+			GDKfree(heads);
+			GDKfree(next);
+			w->failed = 1;
+			return;
+		}
+		for (i = 0; i <= mask; i++)
+			heads[i] = BUN_NONE;
+
+		switch (gp->t) {
+		case TYPE_bte:
+			GRPpar_build_tpe(bte);
+			break;
+		case TYPE_sht:
+			GRPpar_build_tpe(sht);
+			break;
+		case TYPE_int:
+			GRPpar_build_tpe(int);
+			break;
+		case TYPE_lng:
+			GRPpar_build_tpe(lng);
+			break;
+#ifdef HAVE_HGE
+		case TYPE_hge:
+			GRPpar_build_tpe(hge);
+			break;
+#endif
+		case TYPE_flt:
+			GRPpar_build_tpe(flt);
+			break;
+		case TYPE_dbl:
+			GRPpar_build_tpe(dbl);
+			break;
+		default:
+			GRPpar_build_rows((*gp->cmp)(BUNtail(gp->bi, gp->start + q), BUNtail(gp->bi, gp->start + r)) == 0);
+			break;
+		}
+		gp->nlgrp[k] = ng;
+		GDKfree(heads);
+		GDKfree(next);
+	}
+}
+
+static void
+GRPpar_renumber(grp_parallel_t *gp, grp_worker_t *w)
+{
+	int k;
+
+	for (k = w->id; k < gp->nparts; k += gp->nthreads) {
+		BUN *firsts = gp->firsts + gp->pstart[k];
+		lng *lcnts = gp->lcnts + gp->pstart[k];
+		BUN lg, i, r;
+		oid grp;
+
+		for (lg = 0; lg < gp->nlgrp[k]; lg++) {
+			r = firsts[lg];
+			grp = (oid) gp->ranks[r / GRP_BITS] +
+				(oid) pop(gp->bits[r / GRP_BITS] & (((oid) 1 << (r % GRP_BITS)) - 1));
+			if (gp->exts)
+				gp->exts[grp] = gp->hseqb + gp->start + r;
+			if (gp->cnts)
+				gp->cnts[grp] = lcnts[lg];
+			firsts[lg] = grp;
+		}
+		for (i = gp->pstart[k]; i < gp->pstart[k + 1]; i++) {
+			r = gp->rows[i];
+			gp->ngrps[r] = firsts[gp->ngrps[r]];
+		}
+	}
+}
+
+static void
+GRPpar_checksorted(grp_parallel_t *gp, grp_worker_t *w)
+{
+	BUN lo = gp->cnt * w->id / gp->nthreads;
+	BUN hi = gp->cnt * (w->id + 1) / gp->nthreads;
+	BUN r;
+
+	for (r = lo > 0 ? lo : 1; r < hi; r++) {
+		if (gp->ngrps[r] < gp->ngrps[r - 1]) {
+			w->unsorted = 1;
+			break;
+		}
+	}
+}
+
+static void
+GRPpar_worker(void *arg)
+{
+	grp_worker_t *w = arg;
+
+	switch (w->gp->phase) {
+	case 0:
+		GRPpar_hash(w->gp, w);
+		break;
+	case 1:
+		GRPpar_scatter(w->gp, w);
+		break;
+	case 2:
+		GRPpar_build(w->gp, w);
+		break;
+	case 3:
+		GRPpar_renumber(w->gp, w);
+		break;
+	case 4:
+		GRPpar_checksorted(w->gp, w);
+		break;
+	}
+}
+
+/* run one phase on all workers */
+static int
+GRPpar_run(grp_parallel_t *gp, grp_worker_t *ws, int phase)
+{
+	int i, failed = 0;
+
+	gp->phase = phase;
+	GDKparallel(gp->nthreads, GRPpar_worker, ws, sizeof(grp_worker_t));
+	for (i = 0; i < gp->nthreads; i++)
+		failed |= ws[i].failed;
+	return failed;
+}
+
+static gdk_return
+GRPparallel(BAT *b, BATiter bi, int t, int (*cmp)(const void *, const void *),
+	    const oid *grps, BUN start, BUN cnt, oid *ngrps,
+	    BAT *en, BAT *hn, BUN maxgrps, oid *ngrpp, int *sortedp)
+{
+	grp_parallel_t gp;
+	grp_worker_t *ws = NULL;
+	BUN nwords, ngrp, i, pos;
+	int k, j, nthreads = GDKparallel_threads();
+	gdk_return ret = GDK_FAIL;
+
+	memset(&gp, 0, sizeof(gp));
+	gp.b = b;
+	gp.bi = bi;
+	gp.t = t;
+	gp.cmp = cmp;
+	gp.grps = grps;
+	gp.start = start;
+	gp.cnt = cnt;
+	gp.ngrps = ngrps;
+	gp.hseqb = b->hseqbase;
+	gp.qry = THRgetinterrupt();
+	gp.nthreads = nthreads;
+	/* a few partitions per thread to balance the load */
+	for (gp.nparts = 1, k = 0; gp.nparts < 4 * nthreads; gp.nparts <<= 1, k++)
+		;
+	gp.pshift = 8 * SIZEOF_BUN - k;
+	nwords = cnt / GRP_BITS + 1;
+
+	ws = GDKzalloc(nthreads * sizeof(grp_worker_t));
+	gp.hashes = GDKmalloc(cnt * sizeof(BUN));
+	gp.rows = GDKmalloc(cnt * sizeof(BUN));
+	gp.firsts = GDKmalloc(cnt * sizeof(BUN));
+	gp.lcnts = GDKmalloc(cnt * sizeof(lng));
+	gp.bits = GDKzalloc(nwords * sizeof(oid));
+	gp.ranks = GDKmalloc(nwords * sizeof(BUN));
+	if (ws == NULL || gp.hashes == NULL || gp.rows == NULL ||
+	    gp.firsts == NULL || gp.lcnts == NULL || gp.bits == NULL || gp.ranks == NULL)
+		goto bailout;
+	for (j = 0; j < nthreads; j++) {
+		ws[j].gp = &gp;
+		ws[j].id = j;
+	}
+
+	/* hash all rows and count the rows per partition */
+	if (GRPpar_run(&gp, ws, 0))
+		goto bailout;
+	/* each worker scatters its rows behind those of the workers
+	 * before it, so the rows of a partition stay in order */
+	pos = 0;
+	for (k = 0; k < gp.nparts; k++) {
+		gp.pstart[k] = pos;
+		for (j = 0; j < nthreads; j++) {
+			BUN n = ws[j].hist[k];
+			ws[j].hist[k] = pos;
+			pos += n;
+		}
+	}
+	gp.pstart[gp.nparts] = pos;
+	assert(pos == cnt);
+	if (GRPpar_run(&gp, ws, 1) ||
+	    GRPpar_run(&gp, ws, 2))
+		goto bailout;
+
+	/* number the groups in the order of their first row */
+	ngrp = 0;
+	for (k = 0; k < gp.nparts; k++) {
+		for (i = 0; i < gp.nlgrp[k]; i++) {
+			BUN r = gp.firsts[gp.pstart[k] + i];
+			gp.bits[r / GRP_BITS] |= (oid) 1 << (r % GRP_BITS);
+		}
+		ngrp += gp.nlgrp[k];
+	}
+	pos = 0;
+	for (i = 0; i < nwords; i++) {
+		gp.ranks[i] = pos;
+		pos += pop(gp.bits[i]);
+	}
+	assert(pos == ngrp);
+	if (ngrp > maxgrps) {
+		if ((en && BATextend(en, ngrp) != GDK_SUCCEED) ||
+		    (hn && BATextend(hn, ngrp) != GDK_SUCCEED))
+			goto bailout;
+	}
+	gp.exts = en ? (oid *) Tloc(en, 0) : NULL;
+	gp.cnts = hn ? (lng *) Tloc(hn, 0) : NULL;
+	if (GRPpar_run(&gp, ws, 3) ||
+	    GRPpar_run(&gp, ws, 4))
+		goto bailout;
+
+	*ngrpp = (oid) ngrp;
+	*sortedp = 1;
+	for (j = 0; j < nthreads; j++)
+		if (ws[j].unsorted)
+			*sortedp = 0;
+	ret = GDK_SUCCEED;
+  bailout:
+	if (ret != GDK_SUCCEED && INTERRUPTED(gp.qry))
+		GDKerror("BATgroup: query interrupted.\n");
+	GDKfree(ws);
+	GDKfree(gp.hashes);
+	GDKfree(gp.rows);
+	GDKfree(gp.firsts);
+	GDKfree(gp.lcnts);
+	GDKfree(gp.bits);
+	GDKfree(gp.ranks);
+	return ret;
+}
+
 gdk_return
 BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 		  BAT *b, BAT *s, BAT *g, BAT *e, BAT *h, int subsorted)
@@ -540,6 +950,7 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 	const oid *restrict cand, *candend;
 	oid maxgrp = oid_nil;	/* maximum value of g BAT (if subgrouping) */
 	PROPrec *prop;
+	Interrupt *qry = THRgetinterrupt();
 
 	if (b == NULL) {
 		GDKerror("BATgroup: b must exist\n");
@@ -1062,6 +1473,28 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 			GRP_use_existing_hash_table_any();
 			break;
 		}
+	} else if (s == NULL && cnt >= GRP_PARALLEL_MIN && GDKparallel_threads() > 1) {
+		int sorted;
+
+		/* large input without a hash table: partition the
+		 * rows on the hash of their value and group the
+		 * partitions in parallel */
+		ALGODEBUG fprintf(stderr, "#BATgroup(b=%s#" BUNFMT "[%s],"
+				  "s=%s#" BUNFMT ","
+				  "g=%s#" BUNFMT ","
+				  "e=%s#" BUNFMT ","
+				  "h=%s#" BUNFMT ",subsorted=%d): "
+				  "create partitioned hash tables in parallel\n",
+				  BATgetId(b), BATcount(b), ATOMname(b->ttype),
+				  s ? BATgetId(s) : "NULL", s ? BATcount(s) : 0,
+				  g ? BATgetId(g) : "NULL", g ? BATcount(g) : 0,
+				  e ? BATgetId(e) : "NULL", e ? BATcount(e) : 0,
+				  h ? BATgetId(h) : "NULL", h ? BATcount(h) : 0,
+				  subsorted);
+		if (GRPparallel(b, bi, t, cmp, grps, start, cnt, ngrps,
+				en, hn, maxgrps, &ngrp, &sorted) != GDK_SUCCEED)
+			goto error;
+		gn->tsorted = sorted;
 	} else {
 		bit gc = g && (BATordered(g) || BATordered_rev(g));
 		const char *nme;
@@ -1204,6 +1637,8 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 		GDKfree(hp);
 		GDKfree(hs);
 		GDKfree(ext);
+		hs = NULL;
+		ext = NULL;
 	}
 	if (extents) {
 		BATsetcount(en, (BUN) ngrp);
@@ -1238,6 +1673,13 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 	*groups = gn;
 	return GDK_SUCCEED;
   error:
+	if (ext) {
+		/* abandoned partial hash table */
+		HEAPfree(hs->heap, 1);
+		GDKfree(hs->heap);
+		GDKfree(hs);
+		GDKfree(ext);
+	}
 	if (gn)
 		BBPunfix(gn->batCacheid);
 	if (en)
@@ -157,6 +157,175 @@ HASHnew(Heap *hp, int tpe, BUN size, BUN mask, BUN count)
 		}						\
 	} while (0)
 
+/* Build the rest of a large hash table on several threads.  First
+ * each thread hashes its slice of the rows once, and counts its rows
+ * per range of buckets.  Then it scatters the rows of its slice to
+ * their range, behind those of the slices before it, so the rows of a
+ * range stay in ascending order.  Finally each range is linked in by
+ * a single thread.  The rows of a bucket are thus inserted in
+ * ascending order, the resulting Hash and Link arrays are exactly the
+ * ones the sequential loop produces, and no locking is needed. */
+#define HASH_PARALLEL_MIN	((BUN) 1 << 19)
+#define HASH_MAXRANGES		(4 * GDK_MAXPARALLEL)
+
+typedef struct {
+	BAT *b;
+	Hash *h;
+	int tpe;
+	int nthreads;
+	int phase;
+	BUN p, q;		/* range of rows to insert */
+	int rshift;		/* bucket range is bucket >> rshift */
+	int nranges;
+	BUN *buckets;		/* bucket of each row, from p */
+	BUN *rows;		/* rows ordered by bucket range */
+	BUN rstart[HASH_MAXRANGES + 1];
+} hashbuild_t;
+
+typedef struct {
+	hashbuild_t *hb;
+	int id;
+	BUN hist[HASH_MAXRANGES]; /* rows per range, then scatter position */
+} hashworker_t;
+
+#define parthash(TYPE)						\
+	do {							\
+		const TYPE *v = (const TYPE *) Tloc(hb->b, 0);	\
+		for (r = lo; r < hi; r++) {			\
+			c = (BUN) hash_##TYPE(h, v + r);	\
+			hb->buckets[r - hb->p] = c;		\
+			w->hist[c >> hb->rshift]++;		\
+		}						\
+	} while (0)
+
+static void
+HASHpar_worker(void *arg)
+{
+	hashworker_t *w = arg;
+	hashbuild_t *hb = w->hb;
+	Hash *h = hb->h;
+	BUN lo = hb->p + (hb->q - hb->p) * w->id / hb->nthreads;
+	BUN hi = hb->p + (hb->q - hb->p) * (w->id + 1) / hb->nthreads;
+	BUN r, c, i;
+	int k;
+
+	switch (hb->phase) {
+	case 0:
+		switch (hb->tpe) {
+		case TYPE_int:
+			parthash(int);
+			break;
+		case TYPE_flt:
+			parthash(flt);
+			break;
+		case TYPE_lng:
+			parthash(lng);
+			break;
+		case TYPE_dbl:
+			parthash(dbl);
+			break;
+#ifdef HAVE_HGE
+		case TYPE_hge:
+			parthash(hge);
+			break;
+#endif
+		default:
+			assert(0);
+		}
+		break;
+	case 1:
+		for (r = lo; r < hi; r++)
+			hb->rows[w->hist[hb->buckets[r - hb->p] >> hb->rshift]++] = r;
+		break;
+	case 2:
+		for (k = w->id; k < hb->nranges; k += hb->nthreads) {
+			for (i = hb->rstart[k]; i < hb->rstart[k + 1]; i++) {
+				r = hb->rows[i];
+				c = hb->buckets[r - hb->p];
+				HASHputlink(h, r, HASHget(h, c));
+				HASHput(h, c, r);
+			}
+		}
+		break;
+	}
+}
+
+/* Insert rows p up to q of b into h in parallel; return 0 if the
+ * caller should do it sequentially instead. */
+static int
+HASHparallel(BAT *b, Hash *h, int tpe, BUN p, BUN q)
+{
+	hashbuild_t hb;
+	hashworker_t *ws;
+	int j, k, nthreads = GDKparallel_threads();
+	BUN nbuckets = h->mask + 1, pos, n;
+
+	switch (tpe) {
+	case TYPE_int:
+	case TYPE_flt:
+	case TYPE_lng:
+	case TYPE_dbl:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+		break;
+	default:
+		return 0;
+	}
+	if ((BUN) nthreads > nbuckets)
+		nthreads = (int) nbuckets;
+	if (nthreads <= 1 || q - p < HASH_PARALLEL_MIN)
+		return 0;
+	hb.b = b;
+	hb.h = h;
+	hb.tpe = tpe;
+	hb.nthreads = nthreads;
+	hb.p = p;
+	hb.q = q;
+	/* a few ranges per thread to balance the load */
+	for (hb.rshift = 0;
+	     ((nbuckets - 1) >> hb.rshift) >= (BUN) (4 * nthreads);
+	     hb.rshift++)
+		;
+	hb.nranges = (int) ((nbuckets - 1) >> hb.rshift) + 1;
+	ws = GDKzalloc(nthreads * sizeof(hashworker_t));
+	hb.buckets = GDKmalloc((q - p) * sizeof(BUN));
+	hb.rows = GDKmalloc((q - p) * sizeof(BUN));
+	if (ws == NULL || hb.buckets == NULL || hb.rows == NULL) {
+		/* the sequential loop needs no extra memory */
+		GDKfree(ws);
+		GDKfree(hb.buckets);
+		GDKfree(hb.rows);
+		GDKclrerr();
+		return 0;
+	}
+	for (j = 0; j < nthreads; j++) {
+		ws[j].hb = &hb;
+		ws[j].id = j;
+	}
+	ALGODEBUG fprintf(stderr, "#BAThash: insert " BUNFMT " rows on %d threads\n", q - p, nthreads);
+	hb.phase = 0;
+	GDKparallel(nthreads, HASHpar_worker, ws, sizeof(hashworker_t));
+	for (pos = 0, k = 0; k < hb.nranges; k++) {
+		hb.rstart[k] = pos;
+		for (j = 0; j < nthreads; j++) {
+			n = ws[j].hist[k];
+			ws[j].hist[k] = pos;
+			pos += n;
+		}
+	}
+	hb.rstart[hb.nranges] = pos;
+	assert(pos == q - p);
+	hb.phase = 1;
+	GDKparallel(nthreads, HASHpar_worker, ws, sizeof(hashworker_t));
+	hb.phase = 2;
+	GDKparallel(nthreads, HASHpar_worker, ws, sizeof(hashworker_t));
+	GDKfree(ws);
+	GDKfree(hb.buckets);
+	GDKfree(hb.rows);
+	return 1;
+}
+
 /* collect HASH statistics for analysis */
 static void
 HASHcollisions(BAT *b, Hash *h)
@@ -462,6 +631,8 @@ BAThash(BAT *b, BUN masksize)
 
 		/* finish the hashtable with the current mask */
 		p = r;
+		if (HASHparallel(b, h, tpe, p, q))
+			p = q;
 		switch (tpe) {
 		case TYPE_bte:
 			finishhash(bte);
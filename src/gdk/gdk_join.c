@@ -2395,6 +2395,7 @@ binsearchcand(const oid *cand, BUN lo, BUN hi, oid v)
 		for (lo = lstart + l->hseqbase;				\
 		     lstart < lend;					\
 		     lo++) {						\
+			INTERRUPTcheck(qry, lstart, goto bailout);	\
 			v = FVALUE(l, lstart);				\
 			lstart++;					\
 			nr = 0;						\
@@ -2449,6 +2450,7 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	int lskipped = 0;	/* whether we skipped values in l */
 	const Hash *restrict hsh;
 	int t;
+	Interrupt *qry = THRgetinterrupt();
 
 	ALGODEBUG fprintf(stderr, "#hashjoin(l=%s#" BUNFMT "[%s]%s%s%s,"
 			  "r=%s#" BUNFMT "[%s]%s%s%s,sl=%s#" BUNFMT "%s%s%s,"
@@ -2590,6 +2592,7 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 		}
 	} else if (lcand) {
 		while (lcand < lcandend) {
+			INTERRUPTcheck(qry, (BUN) (lcandend - lcand), goto bailout);
 			lo = *lcand++;
 			if (BATtvoid(l)) {
 				if (l->tseqbase != oid_nil)
@@ -2681,6 +2684,7 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 		}
 	} else {
 		for (lo = lstart + l->hseqbase; lstart < lend; lo++) {
+			INTERRUPTcheck(qry, lstart, goto bailout);
 			if (BATtvoid(l)) {
 				if (l->tseqbase != oid_nil)
 					lval = lo - l->hseqbase + l->tseqbase;
@@ -2866,6 +2870,425 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	return GDK_FAIL;
 }
 
+/* Radix-partitioned hash join.  When the inner side of a join is
+ * much larger than the CPU caches, probing a hash table over all of
+ * it misses the cache on every lookup.  Instead, both sides are
+ * scattered in parallel over partitions on (the top bits of) the hash
+ * of their values, so that each partition of the inner side fits in
+ * the cache, and the partitions are then built and probed
+ * independently by a number of threads.  The result is produced in
+ * the order of the outer side, like hashjoin does. */
+#define RADIX_MINSIZE	((size_t) 1 << 22) /* bytes of inner values */
+#define RADIX_PARTSIZE	((BUN) 1 << 14)	/* inner rows per partition */
+#define RADIX_MAXBITS	12
+#if SIZEOF_BUN == 8
+#define RADIX_MULT	((BUN) 0x9E3779B97F4A7C15)
+#else
+#define RADIX_MULT	((BUN) 0x9E3779B9)
+#endif
+
+#define RADIXhash_int(v)	((BUN) (unsigned int) (v) * RADIX_MULT)
+#define RADIXhash_lng(v)	((BUN) ((ulng) (v) ^ ((ulng) (v) >> 32)) * RADIX_MULT)
+#ifdef HAVE_HGE
+#define RADIXhash_hge(v)	RADIXhash_lng((ulng) ((uhge) (v) ^ ((uhge) (v) >> 64)))
+#endif
+
+typedef struct {
+	int t;
+	int nil_matches;
+	const void *lvals;	/* outer values */
+	const void *rvals;	/* inner values */
+	BUN lcnt, rcnt;
+	oid lseq, rseq;
+	int nthreads;
+	int phase;
+	BUN nparts;		/* a power of two */
+	int pshift;		/* partition is top bits of hash */
+	BUN *lhist, *rhist;	/* per worker and partition: rows, then
+				 * scatter position */
+	BUN *lpstart, *rpstart;	/* start of each partition */
+	BUN *hstart;		/* start of the heads of each partition */
+	void *lpvals, *rpvals;	/* values in partition order */
+	BUN *lprows, *rprows;	/* rows in partition order */
+	BUN *heads, *next;	/* per partition hash tables */
+	BUN *matches;		/* per outer row: number of matches, then
+				 * first output position */
+	oid *o1, *o2;
+	Interrupt *qry;
+} radixjoin_t;
+
+typedef struct {
+	radixjoin_t *rj;
+	int id;
+	int failed;
+	BUN nmatch, maxmatch, offset;
+} radixworker_t;
+
+#define RADIXpart(rj, hv)	((hv) >> (rj)->pshift)
+
+#define RADIX_HIST(TYPE, S)						\
+	do {								\
+		const TYPE *vals = rj->S##vals;				\
+		BUN *hist = rj->S##hist + w->id * rj->nparts;		\
+		for (i = lo; i < hi; i++) {				\
+			if (((i - lo) & (INTERRUPT_MORSEL - 1)) == 0 &&	\
+			    INTERRUPTED(rj->qry)) {			\
+				w->failed = 1;				\
+				return;					\
+			}						\
+			if (!rj->nil_matches && vals[i] == TYPE##_nil)	\
+				continue;				\
+			hist[RADIXpart(rj, RADIXhash_##TYPE(vals[i]))]++; \
+		}							\
+	} while (0)
+
+#define RADIX_SCATTER(TYPE, S)						\
+	do {								\
+		const TYPE *vals = rj->S##vals;				\
+		TYPE *pvals = rj->S##pvals;				\
+		BUN *hist = rj->S##hist + w->id * rj->nparts;		\
+		for (i = lo; i < hi; i++) {				\
+			if (!rj->nil_matches && vals[i] == TYPE##_nil)	\
+				continue;				\
+			p = hist[RADIXpart(rj, RADIXhash_##TYPE(vals[i]))]++; \
+			pvals[p] = vals[i];				\
+			rj->S##prows[p] = i;				\
+		}							\
+	} while (0)
+
+/* bucket within a partition: the hash bits below the partition bits */
+#define RADIXbucket(rj, hv)	(((hv) << (8 * SIZEOF_BUN - (rj)->pshift)) >> bshift)
+
+/* build the hash table of one inner partition, the chains are in
+ * ascending row order */
+#define RADIX_BUILD(TYPE)						\
+	do {								\
+		const TYPE *rpvals = rj->rpvals;			\
+		for (i = rj->rpstart[k + 1]; i > rj->rpstart[k]; ) {	\
+			i--;						\
+			b = RADIXbucket(rj, RADIXhash_##TYPE(rpvals[i])); \
+			rj->next[i] = heads[b];				\
+			heads[b] = i;					\
+		}							\
+	} while (0)
+
+#define RADIX_PROBE(TYPE, MATCH)					\
+	do {								\
+		const TYPE *rpvals = rj->rpvals;			\
+		const TYPE *lpvals = rj->lpvals;			\
+		for (j = rj->lpstart[k]; j < rj->lpstart[k + 1]; j++) {	\
+			b = RADIXbucket(rj, RADIXhash_##TYPE(lpvals[j])); \
+			r = rj->lprows[j];				\
+			for (i = heads[b]; i != BUN_NONE; i = rj->next[i]) \
+				if (rpvals[i] == lpvals[j]) {		\
+					MATCH;				\
+				}					\
+		}							\
+	} while (0)
+
+#define RADIX_TYPES(MACRO, ...)				\
+	do {						\
+		switch (rj->t) {			\
+		case TYPE_int:				\
+			MACRO(int, ##__VA_ARGS__);	\
+			break;				\
+		case TYPE_lng:				\
+			MACRO(lng, ##__VA_ARGS__);	\
+			break;				\
+		RADIX_TYPES_hge(MACRO, ##__VA_ARGS__)	\
+		}					\
+	} while (0)
+#ifdef HAVE_HGE
+#define RADIX_TYPES_hge(MACRO, ...)			\
+		case TYPE_hge:				\
+			MACRO(hge, ##__VA_ARGS__);	\
+			break;
+#else
+#define RADIX_TYPES_hge(MACRO, ...)
+#endif
+
+static void
+RADIXworker(void *arg)
+{
+	radixworker_t *w = arg;
+	radixjoin_t *rj = w->rj;
+	BUN lo, hi, i, j, p, b, r, bshift;
+	BUN *heads;
+	BUN k;
+
+	switch (rj->phase) {
+	case 0:			/* count rows per partition */
+	case 1:			/* scatter rows over the partitions */
+		lo = rj->rcnt * w->id / rj->nthreads;
+		hi = rj->rcnt * (w->id + 1) / rj->nthreads;
+		if (rj->phase == 0)
+			RADIX_TYPES(RADIX_HIST, r);
+		else
+			RADIX_TYPES(RADIX_SCATTER, r);
+		lo = rj->lcnt * w->id / rj->nthreads;
+		hi = rj->lcnt * (w->id + 1) / rj->nthreads;
+		if (rj->phase == 0)
+			RADIX_TYPES(RADIX_HIST, l);
+		else
+			RADIX_TYPES(RADIX_SCATTER, l);
+		break;
+	case 2:			/* build and count matches */
+	case 4:			/* probe again and produce the output */
+		for (k = (BUN) w->id; k < rj->nparts; k += rj->nthreads) {
+			if (INTERRUPTED(rj->qry)) {
+				w->failed = 1;
+				return;
+			}
+			heads = rj->heads + rj->hstart[k];
+			/* the number of heads is a power of two */
+			bshift = 8 * SIZEOF_BUN;
+			for (b = rj->hstart[k + 1] - rj->hstart[k]; b > 1; b >>= 1)
+				bshift--;
+			if (rj->phase == 2) {
+				for (b = rj->hstart[k]; b < rj->hstart[k + 1]; b++)
+					rj->heads[b] = BUN_NONE;
+				RADIX_TYPES(RADIX_BUILD);
+				RADIX_TYPES(RADIX_PROBE, rj->matches[r]++);
+			} else {
+				RADIX_TYPES(RADIX_PROBE,
+					    p = rj->matches[r]++;
+					    rj->o1[p] = rj->lseq + r;
+					    rj->o2[p] = rj->rseq + rj->rprows[i]);
+			}
+		}
+		break;
+	case 3:			/* total matches, then output positions */
+		lo = rj->lcnt * w->id / rj->nthreads;
+		hi = rj->lcnt * (w->id + 1) / rj->nthreads;
+		if (w->offset == BUN_NONE) {
+			w->nmatch = w->maxmatch = 0;
+			for (i = lo; i < hi; i++) {
+				w->nmatch += rj->matches[i];
+				if (rj->matches[i] > w->maxmatch)
+					w->maxmatch = rj->matches[i];
+			}
+		} else {
+			p = w->offset;
+			for (i = lo; i < hi; i++) {
+				r = rj->matches[i];
+				rj->matches[i] = p;
+				p += r;
+			}
+		}
+		break;
+	}
+}
+
+static int
+RADIXrun(radixjoin_t *rj, radixworker_t *ws, int phase)
+{
+	int i, failed = 0;
+
+	rj->phase = phase;
+	GDKparallel(rj->nthreads, RADIXworker, ws, sizeof(radixworker_t));
+	for (i = 0; i < rj->nthreads; i++)
+		failed |= ws[i].failed;
+	return failed;
+}
+
+/* set the scatter positions of each worker and return the number of
+ * rows in all partitions */
+static BUN
+RADIXpositions(BUN *hist, BUN *pstart, BUN nparts, int nthreads)
+{
+	BUN k, n, pos = 0;
+	int j;
+
+	for (k = 0; k < nparts; k++) {
+		pstart[k] = pos;
+		for (j = 0; j < nthreads; j++) {
+			n = hist[j * nparts + k];
+			hist[j * nparts + k] = pos;
+			pos += n;
+		}
+	}
+	pstart[nparts] = pos;
+	return pos;
+}
+
+static gdk_return
+radixjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, int nil_matches, lng t0,
+	  int swapped, const char *reason)
+{
+	radixjoin_t rj;
+	radixworker_t *ws = NULL;
+	BUN k, n, h, nl, nr, total, maxmatch;
+	int j, bits, nthreads = GDKparallel_threads();
+	size_t width = Tsize(r);
+
+	memset(&rj, 0, sizeof(rj));
+	rj.t = ATOMbasetype(r->ttype);
+	rj.nil_matches = nil_matches;
+	rj.lvals = Tloc(l, 0);
+	rj.rvals = Tloc(r, 0);
+	rj.lcnt = BATcount(l);
+	rj.rcnt = BATcount(r);
+	rj.lseq = l->hseqbase;
+	rj.rseq = r->hseqbase;
+	rj.qry = THRgetinterrupt();
+	rj.nthreads = nthreads;
+	/* enough partitions for each to fit in the cache, and a few
+	 * per thread to balance the load */
+	for (bits = 0, rj.nparts = 1;
+	     bits < RADIX_MAXBITS &&
+		     (rj.nparts * RADIX_PARTSIZE < rj.rcnt ||
+		      rj.nparts < 4 * (BUN) nthreads);
+	     bits++)
+		rj.nparts <<= 1;
+	rj.pshift = 8 * SIZEOF_BUN - bits;
+
+	ALGODEBUG fprintf(stderr, "#radixjoin(l=%s#" BUNFMT "[%s]%s%s%s,"
+			  "r=%s#" BUNFMT "[%s]%s%s%s,nil_matches=%d,"
+			  "partitions=" BUNFMT ")%s%s%s\n",
+			  BATgetId(l), BATcount(l), ATOMname(l->ttype),
+			  l->tsorted ? "-sorted" : "",
+			  l->trevsorted ? "-revsorted" : "",
+			  l->tkey ? "-key" : "",
+			  BATgetId(r), BATcount(r), ATOMname(r->ttype),
+			  r->tsorted ? "-sorted" : "",
+			  r->trevsorted ? "-revsorted" : "",
+			  r->tkey ? "-key" : "",
+			  nil_matches, rj.nparts,
+			  swapped ? " swapped" : "",
+			  *reason ? " " : "", reason);
+
+	assert(ATOMtype(l->ttype) == ATOMtype(r->ttype));
+	assert(bits > 0);
+
+	ws = GDKzalloc(nthreads * sizeof(radixworker_t));
+	rj.lhist = GDKzalloc(nthreads * rj.nparts * sizeof(BUN));
+	rj.rhist = GDKzalloc(nthreads * rj.nparts * sizeof(BUN));
+	rj.lpstart = GDKmalloc((rj.nparts + 1) * sizeof(BUN));
+	rj.rpstart = GDKmalloc((rj.nparts + 1) * sizeof(BUN));
+	rj.hstart = GDKmalloc((rj.nparts + 1) * sizeof(BUN));
+	rj.matches = GDKzalloc(rj.lcnt * sizeof(BUN));
+	if (ws == NULL || rj.lhist == NULL || rj.rhist == NULL ||
+	    rj.lpstart == NULL || rj.rpstart == NULL || rj.hstart == NULL ||
+	    rj.matches == NULL)
+		goto bailout;
+	for (j = 0; j < nthreads; j++) {
+		ws[j].rj = &rj;
+		ws[j].id = j;
+		ws[j].offset = BUN_NONE;
+	}
+
+	if (RADIXrun(&rj, ws, 0))
+		goto bailout;
+	nl = RADIXpositions(rj.lhist, rj.lpstart, rj.nparts, nthreads);
+	nr = RADIXpositions(rj.rhist, rj.rpstart, rj.nparts, nthreads);
+	/* a power of two number of heads per partition, at least as
+	 * many as there are rows in it, and at least two */
+	rj.hstart[0] = 0;
+	for (k = 0; k < rj.nparts; k++) {
+		n = rj.rpstart[k + 1] - rj.rpstart[k];
+		for (h = 2; h < n; h <<= 1)
+			;
+		rj.hstart[k + 1] = rj.hstart[k] + h;
+	}
+	rj.lpvals = GDKmalloc(nl * width + 1);
+	rj.rpvals = GDKmalloc(nr * width + 1);
+	rj.lprows = GDKmalloc(nl * sizeof(BUN) + 1);
+	rj.rprows = GDKmalloc(nr * sizeof(BUN) + 1);
+	rj.next = GDKmalloc(nr * sizeof(BUN) + 1);
+	rj.heads = GDKmalloc(rj.hstart[rj.nparts] * sizeof(BUN));
+	if (rj.lpvals == NULL || rj.rpvals == NULL ||
+	    rj.lprows == NULL || rj.rprows == NULL ||
+	    rj.next == NULL || rj.heads == NULL)
+		goto bailout;
+	if (RADIXrun(&rj, ws, 1) ||
+	    RADIXrun(&rj, ws, 2) ||
+	    RADIXrun(&rj, ws, 3))
+		goto bailout;
+
+	total = maxmatch = 0;
+	for (j = 0; j < nthreads; j++) {
+		ws[j].offset = total;
+		total += ws[j].nmatch;
+		if (ws[j].maxmatch > maxmatch)
+			maxmatch = ws[j].maxmatch;
+	}
+	if (total > BATcapacity(r1) &&
+	    (BATextend(r1, total) != GDK_SUCCEED ||
+	     BATextend(r2, total) != GDK_SUCCEED))
+		goto bailout;
+	rj.o1 = (oid *) Tloc(r1, 0);
+	rj.o2 = (oid *) Tloc(r2, 0);
+	if (RADIXrun(&rj, ws, 3) ||
+	    RADIXrun(&rj, ws, 4))
+		goto bailout;
+
+	GDKfree(ws);
+	GDKfree(rj.lhist);
+	GDKfree(rj.rhist);
+	GDKfree(rj.lpstart);
+	GDKfree(rj.rpstart);
+	GDKfree(rj.hstart);
+	GDKfree(rj.matches);
+	GDKfree(rj.lpvals);
+	GDKfree(rj.rpvals);
+	GDKfree(rj.lprows);
+	GDKfree(rj.rprows);
+	GDKfree(rj.next);
+	GDKfree(rj.heads);
+
+	BATsetcount(r1, total);
+	BATsetcount(r2, total);
+	/* the output is in the order of l */
+	r1->tsorted = 1;
+	r1->trevsorted = total <= 1;
+	r1->tkey = maxmatch <= 1;
+	r1->tdense = total == rj.lcnt && maxmatch == 1;
+	r2->tkey = l->tkey || total <= 1;
+	r2->tsorted = total <= 1;
+	r2->trevsorted = total <= 1;
+	r2->tdense = total <= 1;
+	if (total > 0) {
+		if (r1->tdense)
+			r1->tseqbase = ((oid *) r1->theap.base)[0];
+		if (r2->tdense)
+			r2->tseqbase = ((oid *) r2->theap.base)[0];
+	}
+	ALGODEBUG fprintf(stderr, "#radixjoin(l=%s,r=%s)=(%s#"BUNFMT"%s%s%s%s,%s#"BUNFMT"%s%s%s%s) " LLFMT "us\n",
+			  BATgetId(l), BATgetId(r),
+			  BATgetId(r1), BATcount(r1),
+			  r1->tsorted ? "-sorted" : "",
+			  r1->trevsorted ? "-revsorted" : "",
+			  r1->tdense ? "-dense" : "",
+			  r1->tkey ? "-key" : "",
+			  BATgetId(r2), BATcount(r2),
+			  r2->tsorted ? "-sorted" : "",
+			  r2->trevsorted ? "-revsorted" : "",
+			  r2->tdense ? "-dense" : "",
+			  r2->tkey ? "-key" : "",
+			  GDKusec() - t0);
+	return GDK_SUCCEED;
+
+  bailout:
+	if (INTERRUPTED(rj.qry))
+		GDKerror("radixjoin: query interrupted.\n");
+	GDKfree(ws);
+	GDKfree(rj.lhist);
+	GDKfree(rj.rhist);
+	GDKfree(rj.lpstart);
+	GDKfree(rj.rpstart);
+	GDKfree(rj.hstart);
+	GDKfree(rj.matches);
+	GDKfree(rj.lpvals);
+	GDKfree(rj.rpvals);
+	GDKfree(rj.lprows);
+	GDKfree(rj.rprows);
+	GDKfree(rj.next);
+	GDKfree(rj.heads);
+	BBPreclaim(r1);
+	BBPreclaim(r2);
+	return GDK_FAIL;
+}
+
 #define MASK_EQ		1
 #define MASK_LT		2
 #define MASK_GT		4
@@ -2895,6 +3318,7 @@ thetajoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int opcode, BUN ma
 	int lskipped = 0;	/* whether we skipped values in l */
 	lng loff = 0, roff = 0;
 	oid lval = oid_nil, rval = oid_nil;
+	Interrupt *qry = THRgetinterrupt();
 
 	ALGODEBUG fprintf(stderr, "#thetajoin(l=%s#" BUNFMT "[%s]%s%s%s,"
 			  "r=%s#" BUNFMT "[%s]%s%s%s,sl=%s#" BUNFMT "%s%s%s,"
@@ -2980,6 +3404,11 @@ thetajoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int opcode, BUN ma
 
 	/* nested loop implementation for theta join */
 	for (;;) {
+		/* every outer iteration scans all of r */
+		if (INTERRUPTED(qry)) {
+			GDKerror("thetajoin: query interrupted.\n");
+			goto bailout;
+		}
 		if (lcand) {
 			if (lcand == lcandend)
 				break;
@@ -3732,10 +4161,11 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	BUN lsize, rsize;
 	BUN maxsize;
 	int lhash, rhash;
+	int lpersistent, rpersistent;
 #ifndef DISABLE_PARENT_HASH
 	bat lparent, rparent;
 #endif
-	int swap;
+	int swap, radix = 0, t;
 	size_t mem_size;
 	lng t0 = 0;
 	const char *reason = "";
@@ -3788,6 +4218,12 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 		lpcount = BATcount(l);
 		lhash = BATcheckhash(l);
 	}
+	lpersistent = l->batPersistence == PERSISTENT
+#ifndef DISABLE_PARENT_HASH
+		|| (lparent != 0 &&
+		    BBPquickdesc(lparent, 0)->batPersistence == PERSISTENT)
+#endif
+		;
 #ifndef DISABLE_PARENT_HASH
 	rparent = VIEWtparent(r);
 	if (rparent) {
@@ -3799,6 +4235,12 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 		rpcount = BATcount(r);
 		rhash = BATcheckhash(r);
 	}
+	rpersistent = r->batPersistence == PERSISTENT
+#ifndef DISABLE_PARENT_HASH
+		|| (rparent != 0 &&
+		    BBPquickdesc(rparent, 0)->batPersistence == PERSISTENT)
+#endif
+		;
 	if (BATtdense(r) && (sr == NULL || BATtdense(sr))) {
 		/* use special implementation for dense right-hand side */
 		return mergejoin_void(r1, r2, l, r, sl, sr, 0, 0, t0);
@@ -3835,43 +4277,41 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 		 * large (i.e. prefer hash over binary search, but
 		 * only if the hash table doesn't cause thrashing) */
 		return mergejoin(r1, r2, l, r, sl, sr, nil_matches, 0, 0, 0, maxsize, t0, 0);
-	} else if ((l->batPersistence == PERSISTENT
-#ifndef DISABLE_PARENT_HASH
-		     || (lparent != 0 &&
-			 BBPquickdesc(lparent, 0)->batPersistence == PERSISTENT)
-#endif
-			   ) &&
-		   !(r->batPersistence == PERSISTENT
-#ifndef DISABLE_PARENT_HASH
-		     || (rparent != 0 &&
-			 BBPquickdesc(rparent, 0)->batPersistence == PERSISTENT)
-#endif
-			   )) {
+	} else if (lpersistent && !rpersistent) {
 		/* l (or its parent) is persistent and r is not,
 		 * create hash on l since it may be reused */
 		swap = 1;
 		reason = "left is persistent";
-	} else if (!(l->batPersistence == PERSISTENT
-#ifndef DISABLE_PARENT_HASH
-		     || (lparent != 0 &&
-			 BBPquickdesc(lparent, 0)->batPersistence == PERSISTENT)
-#endif
-			   ) &&
-		   (r->batPersistence == PERSISTENT
-#ifndef DISABLE_PARENT_HASH
-		    || (rparent != 0 &&
-			BBPquickdesc(rparent, 0)->batPersistence == PERSISTENT)
-#endif
-			   )) {
+	} else if (!lpersistent && rpersistent) {
 		/* l (and its parent) is not persistent but r (or its
 		 * parent) is, create hash on r since it may be
 		 * reused */
 		/* nothing */;
 		reason = "right is persistent";
-	} else if (lpcount < rpcount) {
-		/* no hashes, not sorted, create hash on smallest BAT */
-		swap = 1;
-		reason = "left is smaller";
+	} else {
+		/* no hashes, not sorted, create hash on smallest BAT;
+		 * but if neither is worth keeping a hash on and it
+		 * doesn't fit in the cache, partition both sides
+		 * instead */
+		if (lpcount < rpcount) {
+			swap = 1;
+			reason = "left is smaller";
+		}
+		t = ATOMbasetype(l->ttype);
+		radix = !lpersistent && !rpersistent &&
+			sl == NULL && sr == NULL && GDKparallel_threads() > 1 &&
+			(GDKdebug & NORADIXMASK) == 0 &&
+			(t == TYPE_int || t == TYPE_lng
+#ifdef HAVE_HGE
+			 || t == TYPE_hge
+#endif
+				) &&
+			(swap ? lcount : rcount) * Tsize(l) >= RADIX_MINSIZE;
+	}
+	if (radix) {
+		if (swap)
+			return radixjoin(r2, r1, r, l, nil_matches, t0, 1, reason);
+		return radixjoin(r1, r2, l, r, nil_matches, t0, 0, reason);
 	}
 	if (swap) {
 		return hashjoin(r2, r1, r, l, sr, sl, nil_matches, 0, 0, 0, maxsize, t0, 1, reason);
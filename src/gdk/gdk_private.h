@@ -23,7 +23,8 @@ enum heaptype {
 	varheap,
 	hashheap,
 	imprintsheap,
-	orderidxheap
+	orderidxheap,
+	zonemapheap
 };
 
 __hidden gdk_return ATOMheap(int id, Heap *hp, size_t cap)
@@ -141,6 +142,13 @@ __hidden void *GDKmremap(const char *path, int mode, void *old_address, size_t o
 __hidden gdk_return GDKmunmap(void *addr, size_t len)
 	__attribute__ ((__warn_unused_result__))
 	__attribute__((__visibility__("hidden")));
+__hidden void GDKparallel(int nrecs, void (*func)(void *), void *args, size_t size)
+	__attribute__((__visibility__("hidden")));
+__hidden int GDKparallel_threads(void)
+	__attribute__((__visibility__("hidden")));
+__hidden gdk_return GDKpsort(void *h, void *t, const void *base, size_t n, int hs, int ts, int tpe, int reverse, int stable)
+	__attribute__ ((__warn_unused_result__))
+	__attribute__((__visibility__("hidden")));
 __hidden gdk_return GDKremovedir(int farmid, const char *nme)
 	__attribute__ ((__warn_unused_result__))
 	__attribute__((__visibility__("hidden")));
@@ -221,6 +229,18 @@ __hidden void VIEWdestroy(BAT *b)
 __hidden gdk_return VIEWreset(BAT *b)
 	__attribute__ ((__warn_unused_result__))
 	__attribute__((__visibility__("hidden")));
+__hidden void ZMappend(BAT *b, BUN cnt)
+	__attribute__((__visibility__("hidden")));
+__hidden void ZMfree(BAT *b)
+	__attribute__((__visibility__("hidden")));
+__hidden const Heap *ZMget(BAT *b, BUN *off)
+	__attribute__((__visibility__("hidden")));
+__hidden int ZMminmax(BAT *b, int max, void *res)
+	__attribute__((__visibility__("hidden")));
+__hidden void ZMsave(BAT *b)
+	__attribute__((__visibility__("hidden")));
+__hidden BUN ZMskip(const Heap *zm, int tpe, BUN off, const void *tl, const void *th, BUN *p, BUN e)
+	__attribute__((__visibility__("hidden")));
 __hidden BAT *virtualize(BAT *bn)
 	__attribute__((__visibility__("hidden")));
 __hidden int binsearchcand(const oid *cand, BUN lo, BUN hi, oid v)
@@ -320,6 +340,19 @@ extern MT_Lock MT_system_lock;
 	} while (0)
 #define TYPEerror(t1,t2)	(ATOMstorage(ATOMtype(t1)) != ATOMstorage(ATOMtype(t2)))
 
+/* maximum number of argument records (and threads) of GDKparallel */
+#define GDK_MAXPARALLEL		64
+
+/* poll the interrupt record q once every INTERRUPT_MORSEL iterations */
+#define INTERRUPTcheck(q, i, FAIL)					\
+	do {								\
+		if (((i) & (INTERRUPT_MORSEL - 1)) == 0 &&		\
+		    INTERRUPTED(q)) {					\
+			GDKerror("%s: query interrupted.\n", __func__);	\
+			FAIL;						\
+		}							\
+	} while (0)
+
 #define GDKswapLock(x)  GDKbatLock[(x)&BBP_BATMASK].swap
 #define GDKhashLock(x)  GDKbatLock[(x)&BBP_BATMASK].hash
 #define GDKimprintsLock(x)  GDKbatLock[(x)&BBP_BATMASK].imprints
@@ -0,0 +1,527 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0.  If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Copyright 1997 - July 2008 CWI, August 2008 - 2017 MonetDB B.V.
+ */
+
+/*
+ * Parallel sort
+ *
+ * Large inputs are sorted here instead of with GDKqsort or GDKssort.
+ *
+ * Values of the fixed-width numeric types are sorted with a least
+ * significant digit radix sort on an unsigned key that orders the
+ * same way as the values: integers are offset by their minimum value,
+ * floating point values get their sign bit flipped if they are
+ * positive and all their bits flipped if they are negative.  For a
+ * descending sort all bits of the keys are inverted.  Each pass
+ * distributes the keys, and the oids of the optional tail, on
+ * RSORT_BITS bits of the key.  Every thread counts and then moves a
+ * contiguous slice of the input, and the slices are moved in order,
+ * so each pass is stable, and thus so is the whole sort.  Passes in
+ * which all keys have the same digit are skipped, so small ranges of
+ * values need few passes.  At the end the values are recreated from
+ * the sorted keys.  Since a negative zero would come back as a
+ * positive zero, and a NaN has no place in the order, floating point
+ * inputs with either are sorted the other way.
+ *
+ * Values of the other types are sorted in slices, one per thread, with
+ * the sequential sort functions, after which adjacent sorted slices
+ * are merged pairwise, in parallel for as long as there is more than
+ * one pair.  The left slice wins ties, so a stable sort stays
+ * stable. */
+
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "gdk_private.h"
+#include <math.h>
+
+#define RSORT_BITS	11
+#define RSORT_BUCKETS	(1 << RSORT_BITS)
+#define RSORT_MAXDIGITS	((64 + RSORT_BITS - 1) / RSORT_BITS)
+
+typedef struct psort_t psort_t;
+
+typedef struct {
+	psort_t *ps;
+	size_t lo, hi;		/* slice of the input (radix sort) */
+	size_t mlo, mmid, mhi;	/* runs to merge (merge sort) */
+	size_t *counts;		/* histogram of the slice per digit */
+	size_t *offs;		/* where to move each bucket of this pass */
+	int special;		/* saw a negative zero or NaN */
+	int failed;
+} psortworker_t;
+
+struct psort_t {
+	void *h, *t;		/* values and (optional) oids to sort */
+	const void *base;	/* heap of var-sized values */
+	size_t n;
+	int hs, ts, tpe;
+	int reverse, stable;
+	int nthreads;
+	int phase;
+	/* radix sort */
+	int keywidth;		/* 4 or 8 */
+	void *keys[2];		/* keys, in the order of the last pass and the next */
+	oid *oids[2];
+	int cur;		/* which of the two is current */
+	int shift;		/* the digit of this pass */
+	/* merge sort */
+	int (*cmp)(const void *, const void *);
+	char *mh, *mt;		/* destination of the merge */
+};
+
+/* radix sort phases */
+#define PSORT_KEYS	0	/* create keys, count all digits */
+#define PSORT_COUNT	1	/* count the digit of this pass */
+#define PSORT_MOVE	2	/* move to the bucket of the digit */
+#define PSORT_VALUES	3	/* recreate values from the keys */
+/* merge sort phases */
+#define PSORT_SLICE	4	/* sort the slice sequentially */
+#define PSORT_MERGE	5	/* merge two sorted runs */
+
+/* the unsigned key of a value of each integer type, and back */
+#define KEYbte(V)	((unsigned int) ((int) (V) - GDK_bte_min))
+#define KEYsht(V)	((unsigned int) ((int) (V) - GDK_sht_min))
+#define KEYint(V)	((unsigned int) (V) ^ 0x80000000U)
+#define KEYlng(V)	((ulng) (V) ^ ((ulng) 1 << 63))
+#define VALbte(K)	((bte) ((int) (K) + GDK_bte_min))
+#define VALsht(K)	((sht) ((int) (K) + GDK_sht_min))
+#define VALint(K)	((int) ((K) ^ 0x80000000U))
+#define VALlng(K)	((lng) ((K) ^ ((ulng) 1 << 63)))
+
+#define makekeys(TYPE, KTYPE)						\
+	do {								\
+		const TYPE *restrict v = (const TYPE *) ps->h;		\
+		KTYPE *restrict k = (KTYPE *) ps->keys[0];		\
+		KTYPE inv = ps->reverse ? (KTYPE) ~(KTYPE) 0 : 0;	\
+		for (i = w->lo; i < w->hi; i++) {			\
+			KTYPE key = (KTYPE) KEY##TYPE(v[i]) ^ inv;	\
+			k[i] = key;					\
+			for (d = 0; d < ndigits; d++)			\
+				w->counts[d * RSORT_BUCKETS + ((key >> (d * RSORT_BITS)) & (RSORT_BUCKETS - 1))]++; \
+		}							\
+	} while (0)
+
+#define makefltkeys(TYPE, KTYPE, SIGN)					\
+	do {								\
+		const TYPE *restrict v = (const TYPE *) ps->h;		\
+		KTYPE *restrict k = (KTYPE *) ps->keys[0];		\
+		KTYPE inv = ps->reverse ? (KTYPE) ~(KTYPE) 0 : 0;	\
+		for (i = w->lo; i < w->hi; i++) {			\
+			KTYPE key;					\
+			if (isnan(v[i]) || (v[i] == 0 && signbit(v[i]))) \
+				w->special = 1;				\
+			memcpy(&key, &v[i], sizeof(key));		\
+			key = (key & (SIGN) ? ~key : key | (SIGN)) ^ inv; \
+			k[i] = key;					\
+			for (d = 0; d < ndigits; d++)			\
+				w->counts[d * RSORT_BUCKETS + ((key >> (d * RSORT_BITS)) & (RSORT_BUCKETS - 1))]++; \
+		}							\
+	} while (0)
+
+#define makevalues(TYPE, KTYPE)						\
+	do {								\
+		TYPE *restrict v = (TYPE *) ps->h;			\
+		const KTYPE *restrict k = (const KTYPE *) ps->keys[ps->cur]; \
+		KTYPE inv = ps->reverse ? (KTYPE) ~(KTYPE) 0 : 0;	\
+		for (i = w->lo; i < w->hi; i++)				\
+			v[i] = VAL##TYPE(k[i] ^ inv);			\
+	} while (0)
+
+#define makefltvalues(TYPE, KTYPE, SIGN)				\
+	do {								\
+		TYPE *restrict v = (TYPE *) ps->h;			\
+		const KTYPE *restrict k = (const KTYPE *) ps->keys[ps->cur]; \
+		KTYPE inv = ps->reverse ? (KTYPE) ~(KTYPE) 0 : 0;	\
+		for (i = w->lo; i < w->hi; i++) {			\
+			KTYPE key = k[i] ^ inv;				\
+			key = key & (SIGN) ? key ^ (SIGN) : ~key;	\
+			memcpy(&v[i], &key, sizeof(key));		\
+		}							\
+	} while (0)
+
+#define countdigit(KTYPE)						\
+	do {								\
+		const KTYPE *restrict k = (const KTYPE *) ps->keys[ps->cur]; \
+		for (i = w->lo; i < w->hi; i++)				\
+			w->counts[(k[i] >> ps->shift) & (RSORT_BUCKETS - 1)]++; \
+	} while (0)
+
+#define movedigit(KTYPE)						\
+	do {								\
+		const KTYPE *restrict k = (const KTYPE *) ps->keys[ps->cur]; \
+		KTYPE *restrict kn = (KTYPE *) ps->keys[!ps->cur];	\
+		const oid *restrict o = ps->oids[ps->cur];		\
+		oid *restrict on = ps->oids[!ps->cur];			\
+		if (o) {						\
+			for (i = w->lo; i < w->hi; i++) {		\
+				size_t pos = offs[(k[i] >> ps->shift) & (RSORT_BUCKETS - 1)]++; \
+				kn[pos] = k[i];				\
+				on[pos] = o[i];				\
+			}						\
+		} else {						\
+			for (i = w->lo; i < w->hi; i++) {		\
+				size_t pos = offs[(k[i] >> ps->shift) & (RSORT_BUCKETS - 1)]++; \
+				kn[pos] = k[i];				\
+			}						\
+		}							\
+	} while (0)
+
+/* merge the sorted runs [mlo,mmid) and [mmid,mhi) of the current
+ * values into the destination */
+static void
+PSORTmerge(psort_t *ps, psortworker_t *w)
+{
+	const char *h = ps->h, *t = ps->t;
+	size_t hs = (size_t) ps->hs, ts = t ? (size_t) ps->ts : 0;
+	size_t i = w->mlo, j = w->mmid, k = w->mlo;
+	int sign = ps->reverse ? -1 : 1;
+
+	while (i < w->mmid && j < w->mhi) {
+		const void *l, *r;
+		size_t s;
+
+		if (ps->base) {
+			l = (const char *) ps->base + VarHeapVal(h, i, hs);
+			r = (const char *) ps->base + VarHeapVal(h, j, hs);
+		} else {
+			l = h + i * hs;
+			r = h + j * hs;
+		}
+		/* ties go to the left run */
+		s = sign * (*ps->cmp)(l, r) <= 0 ? i++ : j++;
+		memcpy(ps->mh + k * hs, h + s * hs, hs);
+		if (ts)
+			memcpy(ps->mt + k * ts, t + s * ts, ts);
+		k++;
+	}
+	memcpy(ps->mh + k * hs, h + i * hs, (w->mmid - i) * hs);
+	memcpy(ps->mh + (k + w->mmid - i) * hs, h + j * hs, (w->mhi - j) * hs);
+	if (ts) {
+		memcpy(ps->mt + k * ts, t + i * ts, (w->mmid - i) * ts);
+		memcpy(ps->mt + (k + w->mmid - i) * ts, t + j * ts, (w->mhi - j) * ts);
+	}
+}
+
+static void
+PSORTworker(void *arg)
+{
+	psortworker_t *w = arg;
+	psort_t *ps = w->ps;
+	size_t i, *offs;
+	int d, ndigits = (ps->keywidth * 8 + RSORT_BITS - 1) / RSORT_BITS;
+
+	switch (ps->phase) {
+	case PSORT_KEYS:
+		switch (ATOMbasetype(ps->tpe)) {
+		case TYPE_bte:
+			makekeys(bte, unsigned int);
+			break;
+		case TYPE_sht:
+			makekeys(sht, unsigned int);
+			break;
+		case TYPE_int:
+			makekeys(int, unsigned int);
+			break;
+		case TYPE_lng:
+			makekeys(lng, ulng);
+			break;
+		case TYPE_flt:
+			makefltkeys(flt, unsigned int, 0x80000000U);
+			break;
+		case TYPE_dbl:
+			makefltkeys(dbl, ulng, (ulng) 1 << 63);
+			break;
+		default:
+			assert(0);
+		}
+		if (ps->oids[0])
+			memcpy(ps->oids[0] + w->lo, (const oid *) ps->t + w->lo,
+			       (w->hi - w->lo) * sizeof(oid));
+		break;
+	case PSORT_COUNT:
+		memset(w->counts, 0, RSORT_BUCKETS * sizeof(size_t));
+		if (ps->keywidth == 4)
+			countdigit(unsigned int);
+		else
+			countdigit(ulng);
+		break;
+	case PSORT_MOVE:
+		offs = w->offs;
+		if (ps->keywidth == 4)
+			movedigit(unsigned int);
+		else
+			movedigit(ulng);
+		break;
+	case PSORT_VALUES:
+		switch (ATOMbasetype(ps->tpe)) {
+		case TYPE_bte:
+			makevalues(bte, unsigned int);
+			break;
+		case TYPE_sht:
+			makevalues(sht, unsigned int);
+			break;
+		case TYPE_int:
+			makevalues(int, unsigned int);
+			break;
+		case TYPE_lng:
+			makevalues(lng, ulng);
+			break;
+		case TYPE_flt:
+			makefltvalues(flt, unsigned int, 0x80000000U);
+			break;
+		case TYPE_dbl:
+			makefltvalues(dbl, ulng, (ulng) 1 << 63);
+			break;
+		default:
+			assert(0);
+		}
+		if (ps->oids[ps->cur])
+			memcpy((oid *) ps->t + w->lo, ps->oids[ps->cur] + w->lo,
+			       (w->hi - w->lo) * sizeof(oid));
+		break;
+	case PSORT_SLICE:
+		if (ps->stable) {
+			if ((ps->reverse ? GDKssort_rev : GDKssort)(
+				    (char *) ps->h + w->lo * ps->hs,
+				    ps->t ? (char *) ps->t + w->lo * ps->ts : NULL,
+				    ps->base, w->hi - w->lo, ps->hs, ps->ts,
+				    ps->tpe) != GDK_SUCCEED)
+				w->failed = 1;
+		} else {
+			(ps->reverse ? GDKqsort_rev : GDKqsort)(
+				(char *) ps->h + w->lo * ps->hs,
+				ps->t ? (char *) ps->t + w->lo * ps->ts : NULL,
+				ps->base, w->hi - w->lo, ps->hs, ps->ts,
+				ps->tpe);
+		}
+		break;
+	case PSORT_MERGE:
+		PSORTmerge(ps, w);
+		break;
+	}
+}
+
+static void
+PSORTrun(psort_t *ps, psortworker_t *ws, int nthreads, int phase)
+{
+	ps->phase = phase;
+	GDKparallel(nthreads, PSORTworker, ws, sizeof(psortworker_t));
+}
+
+/* radix sort; sets *special if the input needs to be sorted the
+ * other way */
+static gdk_return
+PSORTradix(psort_t *ps, psortworker_t *ws, int *special)
+{
+	size_t *counts, pos, c, n = ps->n;
+	int j, d, b, ndigits, first = 1;
+	char skip[RSORT_MAXDIGITS];
+	gdk_return ret = GDK_FAIL;
+
+	ps->keywidth = ATOMsize(ATOMbasetype(ps->tpe)) <= 4 ? 4 : 8;
+	ndigits = (ps->keywidth * 8 + RSORT_BITS - 1) / RSORT_BITS;
+	ps->keys[0] = GDKmalloc(n * ps->keywidth);
+	ps->keys[1] = GDKmalloc(n * ps->keywidth);
+	if (ps->t && ps->ts) {
+		ps->oids[0] = GDKmalloc(n * sizeof(oid));
+		ps->oids[1] = GDKmalloc(n * sizeof(oid));
+	}
+	counts = GDKzalloc(ps->nthreads * RSORT_MAXDIGITS * RSORT_BUCKETS * sizeof(size_t));
+	if (ps->keys[0] == NULL || ps->keys[1] == NULL || counts == NULL ||
+	    (ps->t && ps->ts && (ps->oids[0] == NULL || ps->oids[1] == NULL)))
+		goto bailout;
+	for (j = 0; j < ps->nthreads; j++)
+		ws[j].counts = counts + (size_t) j * RSORT_MAXDIGITS * RSORT_BUCKETS;
+
+	PSORTrun(ps, ws, ps->nthreads, PSORT_KEYS);
+	for (j = 0; j < ps->nthreads; j++)
+		if (ws[j].special) {
+			*special = 1;
+			ret = GDK_SUCCEED;
+			goto bailout;
+		}
+	/* a digit that is the same for all keys needs no pass */
+	for (d = 0; d < ndigits; d++) {
+		skip[d] = 0;
+		for (b = 0; b < RSORT_BUCKETS && !skip[d]; b++) {
+			for (c = 0, j = 0; j < ps->nthreads; j++)
+				c += ws[j].counts[d * RSORT_BUCKETS + b];
+			skip[d] = c == n;
+		}
+	}
+
+	ps->cur = 0;
+	for (d = 0; d < ndigits; d++) {
+		if (skip[d])
+			continue;
+		ps->shift = d * RSORT_BITS;
+		if (first) {
+			/* the keys are still in input order, so the
+			 * counts of the first phase apply */
+			for (j = 0; j < ps->nthreads; j++)
+				ws[j].offs = ws[j].counts + d * RSORT_BUCKETS;
+			first = 0;
+		} else {
+			PSORTrun(ps, ws, ps->nthreads, PSORT_COUNT);
+			for (j = 0; j < ps->nthreads; j++)
+				ws[j].offs = ws[j].counts;
+		}
+		/* bucket by bucket, the slices move in order */
+		for (pos = 0, b = 0; b < RSORT_BUCKETS; b++) {
+			for (j = 0; j < ps->nthreads; j++) {
+				c = ws[j].offs[b];
+				ws[j].offs[b] = pos;
+				pos += c;
+			}
+		}
+		PSORTrun(ps, ws, ps->nthreads, PSORT_MOVE);
+		ps->cur = !ps->cur;
+	}
+	PSORTrun(ps, ws, ps->nthreads, PSORT_VALUES);
+	ret = GDK_SUCCEED;
+
+  bailout:
+	GDKfree(ps->keys[0]);
+	GDKfree(ps->keys[1]);
+	GDKfree(ps->oids[0]);
+	GDKfree(ps->oids[1]);
+	GDKfree(counts);
+	return ret;
+}
+
+/* sort slices, then merge them pairwise */
+static gdk_return
+PSORTmergesort(psort_t *ps, psortworker_t *ws)
+{
+	size_t bounds[GDK_MAXPARALLEL + 1];
+	size_t hs = (size_t) ps->hs, ts = ps->t ? (size_t) ps->ts : 0, n = ps->n;
+	char *h = ps->h, *t = ps->t, *mh, *mt = NULL, *tmp;
+	int j, nruns = ps->nthreads, npairs;
+
+	mh = GDKmalloc(n * hs);
+	if (ts)
+		mt = GDKmalloc(n * ts);
+	if (mh == NULL || (ts && mt == NULL)) {
+		GDKfree(mh);
+		GDKfree(mt);
+		return GDK_FAIL;
+	}
+	PSORTrun(ps, ws, ps->nthreads, PSORT_SLICE);
+	for (j = 0; j < ps->nthreads; j++) {
+		if (ws[j].failed) {
+			GDKfree(mh);
+			GDKfree(mt);
+			return GDK_FAIL;
+		}
+		bounds[j] = ws[j].lo;
+	}
+	bounds[nruns] = n;
+	ps->mh = mh;
+	ps->mt = mt;
+	while (nruns > 1) {
+		npairs = nruns / 2;
+		for (j = 0; j < npairs; j++) {
+			ws[j].mlo = bounds[2 * j];
+			ws[j].mmid = bounds[2 * j + 1];
+			ws[j].mhi = bounds[2 * j + 2];
+		}
+		PSORTrun(ps, ws, npairs, PSORT_MERGE);
+		if (nruns & 1) {
+			/* the odd run out is copied as is */
+			size_t lo = bounds[nruns - 1];
+			memcpy(ps->mh + lo * hs, (char *) ps->h + lo * hs, (n - lo) * hs);
+			if (ts)
+				memcpy(ps->mt + lo * ts, (char *) ps->t + lo * ts, (n - lo) * ts);
+		}
+		for (j = 0; j <= npairs; j++)
+			bounds[j] = bounds[2 * j <= nruns ? 2 * j : nruns];
+		bounds[(nruns + 1) / 2] = n;
+		nruns = (nruns + 1) / 2;
+		tmp = ps->h;
+		ps->h = ps->mh;
+		ps->mh = tmp;
+		if (ts) {
+			tmp = ps->t;
+			ps->t = ps->mt;
+			ps->mt = tmp;
+		}
+	}
+	if (ps->h != h) {
+		memcpy(h, ps->h, n * hs);
+		if (ts)
+			memcpy(t, ps->t, n * ts);
+	}
+	GDKfree(mh);
+	GDKfree(mt);
+	return GDK_SUCCEED;
+}
+
+/* Sort n values in h (each hs bytes, in heap base if var-sized),
+ * together with the values in t (each ts bytes) if given, on multiple
+ * threads.  The arguments are those of GDKssort and GDKqsort, plus
+ * whether to sort in descending order and whether the sort must be
+ * stable. */
+gdk_return
+GDKpsort(void *h, void *t, const void *base, size_t n, int hs, int ts,
+	 int tpe, int reverse, int stable)
+{
+	psort_t ps;
+	psortworker_t ws[GDK_MAXPARALLEL];
+	int j, special = 0, nthreads = GDKparallel_threads();
+	gdk_return ret;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+	memset(&ps, 0, sizeof(ps));
+	ps.h = h;
+	ps.t = t;
+	ps.base = base;
+	ps.n = n;
+	ps.hs = hs;
+	ps.ts = ts;
+	ps.tpe = tpe;
+	ps.reverse = reverse;
+	ps.stable = stable;
+	ps.nthreads = nthreads;
+	ps.cmp = ATOMcompare(tpe);
+	memset(ws, 0, sizeof(ws));
+	for (j = 0; j < nthreads; j++) {
+		ws[j].ps = &ps;
+		ws[j].lo = n * j / nthreads;
+		ws[j].hi = n * (j + 1) / nthreads;
+	}
+
+	/* a single thread sorts in place with the sequential sorts, the
+	 * radix sort needs several copies of the input */
+	switch (nthreads > 1 && base == NULL &&
+		(t == NULL || ts == 0 || ts == sizeof(oid)) ?
+		ATOMbasetype(tpe) : TYPE_void) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+	case TYPE_flt:
+	case TYPE_dbl:
+		ret = PSORTradix(&ps, ws, &special);
+		if (ret != GDK_SUCCEED || !special) {
+			ALGODEBUG fprintf(stderr, "#GDKpsort: radix sort " SZFMT " values on %d threads (" LLFMT " usec)\n", n, nthreads, GDKusec() - t0);
+			return ret;
+		}
+		break;
+	default:
+		break;
+	}
+	if (nthreads > 1) {
+		ret = PSORTmergesort(&ps, ws);
+		ALGODEBUG fprintf(stderr, "#GDKpsort: merge sort " SZFMT " values on %d threads (" LLFMT " usec)\n", n, nthreads, GDKusec() - t0);
+		return ret;
+	}
+	if (stable)
+		return (reverse ? GDKssort_rev : GDKssort)(h, t, base, n, hs, ts, tpe);
+	(reverse ? GDKqsort_rev : GDKqsort)(h, t, base, n, hs, ts, tpe);
+	return GDK_SUCCEED;
+}
@@ -412,33 +412,52 @@ do {									\
 /* core scan select loop with & without candidates */
 #define scanloop(NAME,CAND,TEST)					\
 do {									\
+	Interrupt *qry = THRgetinterrupt();				\
+	BUN e;								\
 	ALGODEBUG fprintf(stderr,					\
 			  "#BATselect(b=%s#"BUNFMT",s=%s%s,anti=%d): "	\
 			  "%s %s\n", BATgetId(b), BATcount(b),		\
 			  s ? BATgetId(s) : "NULL",			\
 			  s && BATtdense(s) ? "(dense)" : "",		\
 			  anti, #NAME, #TEST);				\
-	if (BATcapacity(bn) < maximum) {				\
-		while (p < q) {						\
-			CAND;						\
-			v = src[o-off];					\
-			if (TEST) {					\
-				buninsfix(bn, dst, cnt, o,		\
-					  (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r) \
-						 * (dbl) (q-p) * 1.1 + 1024), \
-					  BATcapacity(bn) + q - p, BUN_NONE); \
-				cnt++;					\
-			}						\
-			p++;						\
+	/* the scan proceeds in morsels, between which we check */	\
+	/* whether the query was interrupted */			\
+	while (p < q) {							\
+		e = q - p > INTERRUPT_MORSEL ? p + INTERRUPT_MORSEL : q; \
+		if (INTERRUPTED(qry)) {					\
+			GDKerror("BATselect: query interrupted.\n");	\
+			BBPreclaim(bn);					\
+			return BUN_NONE;				\
 		}							\
-	} else {							\
-		while (p < q) {						\
-			CAND;						\
-			v = src[o-off];					\
-			assert(cnt < BATcapacity(bn));			\
-			dst[cnt] = o;					\
-			cnt += (TEST);					\
-			p++;						\
+		if (zonemap) {						\
+			/* skip the blocks that cannot qualify */	\
+			e = ZMskip(zonemap, b->ttype, zmoff, &vl,	\
+				   equi ? &vl : &vh, &p, e);		\
+			if (p == e)					\
+				continue;				\
+		}							\
+		if (BATcapacity(bn) < maximum) {			\
+			while (p < e) {					\
+				CAND;					\
+				v = src[o-off];				\
+				if (TEST) {				\
+					buninsfix(bn, dst, cnt, o,	\
+						  (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r) \
+							 * (dbl) (q-p) * 1.1 + 1024), \
+						  BATcapacity(bn) + q - p, BUN_NONE); \
+					cnt++;				\
+				}					\
+				p++;					\
+			}						\
+		} else {						\
+			while (p < e) {					\
+				CAND;					\
+				v = src[o-off];				\
+				assert(cnt < BATcapacity(bn));		\
+				dst[cnt] = o;				\
+				cnt += (TEST);				\
+				p++;					\
+			}						\
 		}							\
 	}								\
 } while (0)
@@ -523,6 +542,8 @@ NAME##_##TYPE(BAT *b, BAT *s, BAT *bn, const TYPE *tl, const TYPE *th,	\
 	BUN w, p = r;							\
 	BUN pr_off = 0;							\
 	Imprints *imprints;						\
+	const Heap *zonemap = NULL;					\
+	BUN zmoff = 0;							\
 	(void) candlist;						\
 	(void) li;							\
 	(void) hi;							\
@@ -543,6 +564,10 @@ NAME##_##TYPE(BAT *b, BAT *s, BAT *bn, const TYPE *tl, const TYPE *th,	\
 		imprints = b->timprints;				\
 		basesrc = (const TYPE *) Tloc(b, 0);			\
 	}								\
+	/* without candidate list, a zone map lets us skip blocks */	\
+	if (candlist == NULL && !anti && !use_imprints &&		\
+	    !(equi && vl == nil))					\
+		zonemap = ZMget(b, &zmoff);				\
 	END;								\
 	if (equi) {							\
 		assert(!use_imprints);					\
@@ -576,6 +601,7 @@ candscan_any (BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	oid o;
 	BUN p = r;
 	int c;
+	Interrupt *qry = THRgetinterrupt();
 
 	(void) maximum;
 	(void) use_imprints;
@@ -587,6 +613,7 @@ candscan_any (BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 				  BATgetId(s), BATtdense(s) ? "(dense)" : "",
 				  anti);
 		while (p < q) {
+			INTERRUPTcheck(qry, p - r, BBPreclaim(bn); return BUN_NONE);
 			o = *candlist++;
 			v = BUNtail(bi,(BUN)(o-off));
 			if ((*cmp)(tl, v) == 0) {
@@ -605,6 +632,7 @@ candscan_any (BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 				  BATgetId(s), BATtdense(s) ? "(dense)" : "",
 				  anti);
 		while (p < q) {
+			INTERRUPTcheck(qry, p - r, BBPreclaim(bn); return BUN_NONE);
 			o = *candlist++;
 			v = BUNtail(bi,(BUN)(o-off));
 			if ((nil == NULL || (*cmp)(v, nil) != 0) &&
@@ -629,6 +657,7 @@ candscan_any (BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 				  BATgetId(s), BATtdense(s) ? "(dense)" : "",
 				  anti);
 		while (p < q) {
+			INTERRUPTcheck(qry, p - r, BBPreclaim(bn); return BUN_NONE);
 			o = *candlist++;
 			v = BUNtail(bi,(BUN)(o-off));
 			if ((nil == NULL || (*cmp)(v, nil) != 0) &&
@@ -663,6 +692,7 @@ fullscan_any(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	oid o;
 	BUN p = r;
 	int c;
+	Interrupt *qry = THRgetinterrupt();
 
 	(void) candlist;
 	(void) maximum;
@@ -675,6 +705,7 @@ fullscan_any(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 				  s ? BATgetId(s) : "NULL",
 				  s && BATtdense(s) ? "(dense)" : "", anti);
 		while (p < q) {
+			INTERRUPTcheck(qry, p - r, BBPreclaim(bn); return BUN_NONE);
 			o = (oid)(p + off);
 			v = BUNtail(bi,(BUN)(o-off));
 			if ((*cmp)(tl, v) == 0) {
@@ -693,6 +724,7 @@ fullscan_any(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 				  s ? BATgetId(s) : "NULL",
 				  s && BATtdense(s) ? "(dense)" : "", anti);
 		while (p < q) {
+			INTERRUPTcheck(qry, p - r, BBPreclaim(bn); return BUN_NONE);
 			o = (oid)(p + off);
 			v = BUNtail(bi,(BUN)(o-off));
 			if ((nil == NULL || (*cmp)(v, nil) != 0) &&
@@ -717,6 +749,7 @@ fullscan_any(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 				  s ? BATgetId(s) : "NULL",
 				  s && BATtdense(s) ? "(dense)" : "", anti);
 		while (p < q) {
+			INTERRUPTcheck(qry, p - r, BBPreclaim(bn); return BUN_NONE);
 			o = (oid)(p + off);
 			v = BUNtail(bi,(BUN)(o-off));
 			if ((nil == NULL || (*cmp)(v, nil) != 0) &&
@@ -852,6 +885,305 @@ scan_sel(candscan, o = *candlist++, w = (BUN) ((*(oid *) Tloc(s,q?(q - 1):0)) +
 scan_sel(fullscan, o = (oid) (p+off), w = (BUN) (q+off))
 
 
+/* vectorized range select
+ *
+ * A range select over an int, lng, flt or dbl column without
+ * candidate list compares a whole vector of values with both bounds
+ * at once, and turns the outcome into a bit mask with one bit per
+ * value.  The positions of the set bits are packed and stored in the
+ * result unconditionally, and the result count is then advanced by
+ * the number of bits set, so there is no branch per value.  The test
+ * is v >= vl && v <= vh, which is what the scalar loop tests for a
+ * range that is not anti, so nils never qualify.  Kernels are
+ * compiled for AVX2 and for SSE4.2, and the one to use is chosen at
+ * run time from what the processor supports; otherwise the scalar
+ * loop is used. */
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define HAVE_SIMDSCAN 1
+
+#include <immintrin.h>
+
+#define AVX2_TARGET	__attribute__((__target__("avx2,bmi2,popcnt")))
+#define SSE42_TARGET	__attribute__((__target__("sse4.2,popcnt")))
+
+/* one byte per set bit of m with its bit number */
+#define AVX2selidx(m)							\
+	_mm_cvtsi64_si128((lng) _pext_u64(0x0706050403020100ULL,	\
+					  _pdep_u64(m, 0x0101010101010101ULL) * 0xFF))
+
+/* store the oids o + i for the set bits i of m (at most 8) at
+ * dst[cnt], followed by garbage up to dst[cnt + 7] */
+static inline AVX2_TARGET BUN
+AVX2compress8(oid *restrict dst, BUN cnt, oid o, unsigned int m)
+{
+	__m128i ix = AVX2selidx(m);
+	__m256i base = _mm256_set1_epi64x((lng) o);
+
+	_mm256_storeu_si256((__m256i *) (dst + cnt),
+			    _mm256_add_epi64(base, _mm256_cvtepu8_epi64(ix)));
+	_mm256_storeu_si256((__m256i *) (dst + cnt + 4),
+			    _mm256_add_epi64(base, _mm256_cvtepu8_epi64(_mm_srli_si128(ix, 4))));
+	return cnt + (BUN) _mm_popcnt_u32(m);
+}
+
+/* store the oids o + i for the set bits i of m (at most 4) at
+ * dst[cnt], followed by garbage up to dst[cnt + 3] */
+static inline AVX2_TARGET BUN
+AVX2compress4(oid *restrict dst, BUN cnt, oid o, unsigned int m)
+{
+	__m128i ix = AVX2selidx(m);
+	__m256i base = _mm256_set1_epi64x((lng) o);
+
+	_mm256_storeu_si256((__m256i *) (dst + cnt),
+			    _mm256_add_epi64(base, _mm256_cvtepu8_epi64(ix)));
+	return cnt + (BUN) _mm_popcnt_u32(m);
+}
+
+/* bit numbers of the set bits of a 4 bit mask */
+static const unsigned char selidx4[16][4] = {
+	{0, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0},
+	{2, 0, 0, 0}, {0, 2, 0, 0}, {1, 2, 0, 0}, {0, 1, 2, 0},
+	{3, 0, 0, 0}, {0, 3, 0, 0}, {1, 3, 0, 0}, {0, 1, 3, 0},
+	{2, 3, 0, 0}, {0, 2, 3, 0}, {1, 2, 3, 0}, {0, 1, 2, 3},
+};
+
+/* store the oids o + i for the set bits i of m (at most 4) at
+ * dst[cnt], followed by garbage up to dst[cnt + 3] */
+static inline SSE42_TARGET BUN
+SSE42compress4(oid *restrict dst, BUN cnt, oid o, unsigned int m)
+{
+	int idx;
+	__m128i ix, base = _mm_set1_epi64x((lng) o);
+
+	memcpy(&idx, selidx4[m], sizeof(idx));
+	ix = _mm_cvtsi32_si128(idx);
+	_mm_storeu_si128((__m128i *) (dst + cnt),
+			 _mm_add_epi64(base, _mm_cvtepu8_epi64(ix)));
+	_mm_storeu_si128((__m128i *) (dst + cnt + 2),
+			 _mm_add_epi64(base, _mm_cvtepu8_epi64(_mm_srli_si128(ix, 2))));
+	return cnt + (BUN) _mm_popcnt_u32(m);
+}
+
+/* store the oids o + i for the set bits i of m (at most 2) at
+ * dst[cnt], followed by garbage up to dst[cnt + 1] */
+static inline SSE42_TARGET BUN
+SSE42compress2(oid *restrict dst, BUN cnt, oid o, unsigned int m)
+{
+	int idx;
+	__m128i ix, base = _mm_set1_epi64x((lng) o);
+
+	memcpy(&idx, selidx4[m], sizeof(idx));
+	ix = _mm_cvtsi32_si128(idx);
+	_mm_storeu_si128((__m128i *) (dst + cnt),
+			 _mm_add_epi64(base, _mm_cvtepu8_epi64(ix)));
+	return cnt + (BUN) _mm_popcnt_u32(m);
+}
+
+/* bit mask of the values in vector V that are in [LO, HI] */
+#define AVX2inside_int(V, LO, HI)					\
+	(~(unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(	\
+		_mm256_or_si256(_mm256_cmpgt_epi32(LO, V),		\
+				_mm256_cmpgt_epi32(V, HI)))) & 0xFF)
+#define AVX2inside_lng(V, LO, HI)					\
+	(~(unsigned int) _mm256_movemask_pd(_mm256_castsi256_pd(	\
+		_mm256_or_si256(_mm256_cmpgt_epi64(LO, V),		\
+				_mm256_cmpgt_epi64(V, HI)))) & 0xF)
+#define AVX2inside_flt(V, LO, HI)					\
+	((unsigned int) _mm256_movemask_ps(_mm256_and_ps(		\
+		_mm256_cmp_ps(V, LO, _CMP_GE_OQ),			\
+		_mm256_cmp_ps(V, HI, _CMP_LE_OQ))))
+#define AVX2inside_dbl(V, LO, HI)					\
+	((unsigned int) _mm256_movemask_pd(_mm256_and_pd(		\
+		_mm256_cmp_pd(V, LO, _CMP_GE_OQ),			\
+		_mm256_cmp_pd(V, HI, _CMP_LE_OQ))))
+#define SSE42inside_int(V, LO, HI)					\
+	(~(unsigned int) _mm_movemask_ps(_mm_castsi128_ps(		\
+		_mm_or_si128(_mm_cmpgt_epi32(LO, V),			\
+			     _mm_cmpgt_epi32(V, HI)))) & 0xF)
+#define SSE42inside_lng(V, LO, HI)					\
+	(~(unsigned int) _mm_movemask_pd(_mm_castsi128_pd(		\
+		_mm_or_si128(_mm_cmpgt_epi64(LO, V),			\
+			     _mm_cmpgt_epi64(V, HI)))) & 0x3)
+#define SSE42inside_flt(V, LO, HI)					\
+	((unsigned int) _mm_movemask_ps(_mm_and_ps(			\
+		_mm_cmpge_ps(V, LO), _mm_cmple_ps(V, HI))))
+#define SSE42inside_dbl(V, LO, HI)					\
+	((unsigned int) _mm_movemask_pd(_mm_and_pd(			\
+		_mm_cmpge_pd(V, LO), _mm_cmple_pd(V, HI))))
+
+/* select the values in [vl, vh] from src[p] up to src[e] and append
+ * their oids to dst[cnt]; dst must have room for e - p more oids,
+ * which suffices since a vector of LANES values never stores more
+ * than LANES oids */
+#define simdscanfunc(ISA, TYPE, VEC, LANES, SET1, LOAD)			\
+static ISA##_TARGET BUN							\
+ISA##scan_##TYPE(const TYPE *restrict src, BUN p, BUN e, lng off,	\
+		 TYPE vl, TYPE vh, oid *restrict dst, BUN cnt)		\
+{									\
+	const VEC lo = SET1(vl), hi = SET1(vh);				\
+									\
+	for (; p + LANES <= e; p += LANES) {				\
+		VEC v = LOAD((const void *) (src + p));			\
+		cnt = ISA##compress##LANES(dst, cnt, (oid) (p + off),	\
+					   ISA##inside_##TYPE(v, lo, hi)); \
+	}								\
+	for (; p < e; p++) {						\
+		dst[cnt] = (oid) (p + off);				\
+		cnt += src[p] >= vl && src[p] <= vh;			\
+	}								\
+	return cnt;							\
+}
+
+simdscanfunc(AVX2, int, __m256i, 8, _mm256_set1_epi32, _mm256_loadu_si256)
+simdscanfunc(AVX2, lng, __m256i, 4, _mm256_set1_epi64x, _mm256_loadu_si256)
+simdscanfunc(AVX2, flt, __m256, 8, _mm256_set1_ps, _mm256_loadu_ps)
+simdscanfunc(AVX2, dbl, __m256d, 4, _mm256_set1_pd, _mm256_loadu_pd)
+simdscanfunc(SSE42, int, __m128i, 4, _mm_set1_epi32, _mm_loadu_si128)
+simdscanfunc(SSE42, lng, __m128i, 2, _mm_set1_epi64x, _mm_loadu_si128)
+simdscanfunc(SSE42, flt, __m128, 4, _mm_set1_ps, _mm_loadu_ps)
+simdscanfunc(SSE42, dbl, __m128d, 2, _mm_set1_pd, _mm_loadu_pd)
+
+#define SIMDSCAN_AVX2	2
+#define SIMDSCAN_SSE42	1
+
+/* which vectorized kernel to use for a column of type t, 0 if none */
+static int
+simdlevel(int t)
+{
+	switch (t) {
+	case TYPE_int:
+	case TYPE_lng:
+	case TYPE_flt:
+	case TYPE_dbl:
+		break;
+	default:
+		return 0;
+	}
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2") &&
+	    __builtin_cpu_supports("bmi2") &&
+	    __builtin_cpu_supports("popcnt"))
+		return SIMDSCAN_AVX2;
+	if (__builtin_cpu_supports("sse4.2") &&
+	    __builtin_cpu_supports("popcnt"))
+		return SIMDSCAN_SSE42;
+	return 0;
+}
+
+#define simdscancall(TYPE)						\
+	do {								\
+		const TYPE *src = (const TYPE *) Tloc(b, 0);		\
+		TYPE vl = *(const TYPE *) tl;				\
+		TYPE vh = *(const TYPE *) th;				\
+		cnt = level == SIMDSCAN_AVX2 ?				\
+			AVX2scan_##TYPE(src, p, e, off, vl, vh, dst, cnt) : \
+			SSE42scan_##TYPE(src, p, e, off, vl, vh, dst, cnt); \
+	} while (0)
+
+/* vectorized select of the values in [tl, th] from b[p] up to b[q];
+ * bn must have room for a result that is as large as the input */
+static BUN
+simdscan(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
+	 BUN p, BUN q, lng off, int level)
+{
+	Interrupt *qry = THRgetinterrupt();
+	oid *restrict dst = (oid *) Tloc(bn, 0);
+	BUN e, r = p, cnt = 0, zmoff = 0;
+	const Heap *zonemap = ZMget(b, &zmoff);
+
+	ALGODEBUG fprintf(stderr,
+			  "#BATselect(b=%s#"BUNFMT",s=%s%s,anti=0): "
+			  "fullscan %s\n", BATgetId(b), BATcount(b),
+			  s ? BATgetId(s) : "NULL",
+			  s && BATtdense(s) ? "(dense)" : "",
+			  level == SIMDSCAN_AVX2 ? "avx2" : "sse4.2");
+	while (p < q) {
+		e = q - p > INTERRUPT_MORSEL ? p + INTERRUPT_MORSEL : q;
+		if (INTERRUPTED(qry)) {
+			GDKerror("BATselect: query interrupted.\n");
+			BBPreclaim(bn);
+			return BUN_NONE;
+		}
+		if (zonemap) {
+			/* skip the blocks that cannot qualify */
+			e = ZMskip(zonemap, b->ttype, zmoff, tl, th, &p, e);
+			if (p == e)
+				continue;
+		}
+		/* a vector store may write past the qualifying values,
+		 * but never past the room for all values of the morsel,
+		 * as the kernels store one oid per value of a vector */
+		if (BATcapacity(bn) < cnt + e - p) {
+			BUN grow = (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r)
+					  * (dbl) (q - p) * 1.1 + 1024);
+			BATsetcount(bn, cnt);
+			if (BATextend(bn, MIN(MAX(BATcapacity(bn) + grow,
+						  cnt + e - p),
+					      cnt + q - p)) != GDK_SUCCEED) {
+				BBPreclaim(bn);
+				return BUN_NONE;
+			}
+			dst = (oid *) Tloc(bn, 0);
+		}
+		switch (ATOMbasetype(b->ttype)) {
+		case TYPE_int:
+			simdscancall(int);
+			break;
+		case TYPE_lng:
+			simdscancall(lng);
+			break;
+		case TYPE_flt:
+			simdscancall(flt);
+			break;
+		case TYPE_dbl:
+			simdscancall(dbl);
+			break;
+		default:
+			assert(0);
+		}
+		p = e;
+	}
+	return cnt;
+}
+#endif
+
+
+/* the number of values of b that a scan for values in [tl, th] cannot
+ * skip using the zone map, BUN_NONE if there is no zone map */
+static BUN
+ZMscancount(BAT *b, const void *tl, const void *th)
+{
+	const Heap *zonemap;
+	BUN p = 0, q = BATcount(b), e, n = 0, zmoff = 0;
+
+	if ((zonemap = ZMget(b, &zmoff)) == NULL)
+		return BUN_NONE;
+	while (p < q) {
+		e = ZMskip(zonemap, b->ttype, zmoff, tl, th, &p, q);
+		n += e - p;
+		p = e;
+	}
+	return n;
+}
+
+/* make sure b has a zone map if it is (a view of) a column of the
+ * database; returns whether it has one */
+static int
+zonemapped(BAT *b)
+{
+	BAT *pb = VIEWtparent(b) ? BBPquickdesc(VIEWtparent(b), 0) : b;
+
+	if (pb == NULL || pb->batRole != PERSISTENT ||
+	    b->tvarsized || b->ttype == TYPE_void ||
+	    ATOMtype(b->ttype) == TYPE_oid)
+		return 0;
+	if (BATzonemap(b) != GDK_SUCCEED) {
+		GDKclrerr();	/* not interested in BATzonemap errors */
+		return 0;
+	}
+	return 1;
+}
+
 static BAT *
 BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	       int li, int hi, int equi, int anti, int lval, int hval,
@@ -861,6 +1193,9 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	int (*cmp)(const void *, const void *);
 #endif
 	int t;
+#ifdef HAVE_SIMDSCAN
+	int simd;
+#endif
 	BUN p, q, cnt;
 	oid o, *restrict dst;
 	lng off;
@@ -883,6 +1218,16 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 
 	assert(!lval || !hval || (*cmp)(tl, th) <= 0);
 
+	/* rather than imprints, use the zone map if it leaves less
+	 * than half of the values to be scanned */
+	if (use_imprints && !anti && (s == NULL || BATtdense(s)) &&
+	    ZMscancount(b, tl, th) < BATcount(b) / 2) {
+		ALGODEBUG fprintf(stderr, "#BATselect(b=%s#" BUNFMT
+				  "): zone map instead of imprints\n",
+				  BATgetId(b), BATcount(b));
+		use_imprints = 0;
+	}
+
 	/* build imprints if they do not exist */
 	if (use_imprints && (BATimprints(b) != GDK_SUCCEED)) {
 		GDKclrerr();	/* not interested in BATimprints errors */
@@ -954,6 +1299,14 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 			q = BUNlast(b);
 		}
 		candlist = NULL;
+#ifdef HAVE_SIMDSCAN
+		/* use a vectorized kernel for a range select if the
+		 * result may be as large as the input */
+		if (!equi && !anti && !use_imprints && maximum >= q - p &&
+		    (simd = simdlevel(t)) != 0) {
+			cnt = simdscan(b, s, bn, tl, th, p, q, off, simd);
+		} else
+#endif
 		/* call type-specific core scan select function */
 		switch (t) {
 		case TYPE_bte:
@@ -1794,6 +2147,10 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 		bn = BAT_hashselect(b, s, bn, tl, maximum);
 	} else {
 		int use_imprints = 0;
+		/* the scan can skip blocks using a zone map if it
+		 * looks for a range of values, not for nil */
+		if (!anti && !(equi && lnil) && (s == NULL || BATtdense(s)))
+			(void) zonemapped(b);
 		if (!equi &&
 		    !b->tvarsized &&
 		    (b->batPersistence == PERSISTENT ||
@@ -1907,6 +2264,7 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 	int sorted = 0;		/* which column is sorted */
 	BAT *tmp;
 	int use_orderidx = 0;
+	int use_imprints = 0;
 	oid ll, lh;
 
 	assert(ATOMtype(l->ttype) == ATOMtype(rl->ttype));
@@ -2150,19 +2508,25 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 		}
 		cnt = BATcount(r1);
 		assert(BATcount(r1) == BATcount(r2));
-	} else if ((BATcount(rl) > 2 ||
-		    l->batPersistence == PERSISTENT ||
-		    (VIEWtparent(l) != 0 &&
-		     (tmp = BBPquickdesc(VIEWtparent(l), 0)) != NULL &&
-		     tmp->batPersistence == PERSISTENT) ||
-		    BATcheckimprints(l)) &&
-		   BATimprints(l) == GDK_SUCCEED) {
-		/* implementation using imprints on left column
+	} else if ((use_imprints =
+		    (BATcount(rl) > 2 ||
+		     l->batPersistence == PERSISTENT ||
+		     (VIEWtparent(l) != 0 &&
+		      (tmp = BBPquickdesc(VIEWtparent(l), 0)) != NULL &&
+		      tmp->batPersistence == PERSISTENT) ||
+		     BATcheckimprints(l)) &&
+		    BATimprints(l) == GDK_SUCCEED) ||
+		   (lcand == NULL && BATcount(rl) > 2 && zonemapped(l))) {
+		/* implementation using imprints or the zone map on
+		 * left column
 		 *
 		 * we use imprints if we can (the type is right for
 		 * imprints) and either the left bat is persistent or
 		 * already has imprints, or the right bats are long
-		 * enough (for creating imprints being worth it) */
+		 * enough (for creating imprints being worth it);
+		 * failing that, the scan of the left column for each
+		 * right range can skip blocks using the zone map of
+		 * a column of the database */
 		BUN maximum;
 
 		sorted = 2;
@@ -2232,13 +2596,13 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, lcand,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				else
 					ncnt = fullscan_bte(l, sl, r1, &vl, &vh,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, NULL,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				break;
 			}
 			case TYPE_sht: {
@@ -2264,13 +2628,13 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, lcand,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				else
 					ncnt = fullscan_sht(l, sl, r1, &vl, &vh,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, NULL,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				break;
 			}
 			case TYPE_int:
@@ -2309,13 +2673,13 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, lcand,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				else
 					ncnt = fullscan_int(l, sl, r1, &vl, &vh,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, NULL,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				break;
 			}
 			case TYPE_lng:
@@ -2354,13 +2718,13 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, lcand,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				else
 					ncnt = fullscan_lng(l, sl, r1, &vl, &vh,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, NULL,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				break;
 			}
 #ifdef HAVE_HGE
@@ -2387,13 +2751,13 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, lcand,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				else
 					ncnt = fullscan_hge(l, sl, r1, &vl, &vh,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, NULL,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				break;
 			}
 #endif
@@ -2420,13 +2784,13 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, lcand,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				else
 					ncnt = fullscan_flt(l, sl, r1, &vl, &vh,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, NULL,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				break;
 			}
 			case TYPE_dbl: {
@@ -2452,13 +2816,13 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, lcand,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				else
 					ncnt = fullscan_dbl(l, sl, r1, &vl, &vh,
 							    1, 1, 0, 0, 1, 1,
 							    lstart, lend, cnt,
 							    off, dst1, NULL,
-							    cnt + maximum, 1);
+							    cnt + maximum, use_imprints);
 				break;
 			}
 			default:
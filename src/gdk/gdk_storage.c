@@ -793,6 +793,7 @@ BATsave(BAT *bd)
 	if (err == GDK_SUCCEED) {
 		bd->batCopiedtodisk = 1;
 		DESCclean(bd);
+		ZMsave(bd);
 		return GDK_SUCCEED;
 	}
 	return err;
@@ -891,6 +892,7 @@ BATdelete(BAT *b)
 		HASHdestroy(b);
 		IMPSdestroy(b);
 		OIDXdestroy(b);
+		ZMdestroy(b);
 	}
 
 	if (b->batCopiedtodisk || (b->theap.storage != STORE_MEM)) {
@@ -545,12 +545,144 @@ MT_check_nr_cores(void)
 	return ncpus;
 }
 
+/*
+ * NUMA topology.  Only the nodes holding cpus the process is allowed
+ * to run on are counted, they are numbered from 0 in the order of the
+ * system.  Without the information (i.e. other than on Linux) there is
+ * just a single node and threads are not bound.
+ */
+#if defined(__linux__) && defined(HAVE_SCHED_H)
+#define MT_MAX_NODES 64
+
+static cpu_set_t MT_nodecpus[MT_MAX_NODES];
+static int MT_nodes = -1;
+static pthread_mutex_t MT_nodes_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* add the cpus in a list like "0-3,8-11" to the set */
+static int
+MT_parse_cpulist(const char *s, cpu_set_t *set)
+{
+	char *e;
+	long lo, hi;
+
+	while (*s && *s != '\n') {
+		lo = hi = strtol(s, &e, 10);
+		if (e == s)
+			return -1;
+		if (*e == '-') {
+			s = e + 1;
+			hi = strtol(s, &e, 10);
+			if (e == s)
+				return -1;
+		}
+		for (; lo <= hi && lo < CPU_SETSIZE; lo++)
+			CPU_SET(lo, set);
+		s = *e == ',' ? e + 1 : e;
+	}
+	return 0;
+}
+
+int
+MT_check_nr_nodes(void)
+{
+	cpu_set_t allowed, cpus;
+	char path[64], line[1024];
+	FILE *f;
+	int i, n = 0;
+
+	pthread_mutex_lock(&MT_nodes_lock);
+	if (MT_nodes >= 0) {
+		pthread_mutex_unlock(&MT_nodes_lock);
+		return MT_nodes;
+	}
+	CPU_ZERO(&allowed);
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+		for (i = 0; i < MT_MAX_NODES; i++) {
+			snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", i);
+			if ((f = fopen(path, "r")) == NULL)
+				continue;
+			CPU_ZERO(&cpus);
+			if (fgets(line, (int) sizeof(line), f) != NULL &&
+			    MT_parse_cpulist(line, &cpus) == 0) {
+				CPU_AND(&MT_nodecpus[n], &cpus, &allowed);
+				if (CPU_COUNT(&MT_nodecpus[n]) > 0)
+					n++;
+			}
+			fclose(f);
+		}
+	}
+	MT_nodes = n > 0 ? n : 1;
+	pthread_mutex_unlock(&MT_nodes_lock);
+	return MT_nodes;
+}
+
+int
+MT_bind_thread_node(int node)
+{
+	if (MT_check_nr_nodes() <= 1 || node < 0 || node >= MT_nodes)
+		return -1;
+	return sched_setaffinity(0, sizeof(cpu_set_t), &MT_nodecpus[node]) == 0 ? 0 : -1;
+}
+#else
+int
+MT_check_nr_nodes(void)
+{
+	return 1;
+}
+
+int
+MT_bind_thread_node(int node)
+{
+	(void) node;
+	return -1;
+}
+#endif
+
 
 
 lng
 GDKusec(void)
 {
-return 0; // hahahahahahah
+	/* Return the time in microseconds since an epoch.  The epoch
+	 * is roughly the time this program started. */
+#ifdef _MSC_VER
+	static LARGE_INTEGER freq, start;	/* automatically initialized to 0 */
+	LARGE_INTEGER ctr;
+
+	if (start.QuadPart == 0 &&
+	    (!QueryPerformanceFrequency(&freq) ||
+	     !QueryPerformanceCounter(&start)))
+		start.QuadPart = -1;
+	if (start.QuadPart > 0) {
+		QueryPerformanceCounter(&ctr);
+		return (lng) (((ctr.QuadPart - start.QuadPart) * 1000000) / freq.QuadPart);
+	}
+#endif
+#ifdef HAVE_GETTIMEOFDAY
+	{
+		static struct timeval tpbase;	/* automatically initialized to 0 */
+		struct timeval tp;
+
+		if (tpbase.tv_sec == 0)
+			gettimeofday(&tpbase, NULL);
+		gettimeofday(&tp, NULL);
+		tp.tv_sec -= tpbase.tv_sec;
+		return (lng) tp.tv_sec * 1000000 + (lng) tp.tv_usec;
+	}
+#else
+#ifdef HAVE_FTIME
+	{
+		static struct timeb tbbase;	/* automatically initialized to 0 */
+		struct timeb tb;
+
+		if (tbbase.time == 0)
+			ftime(&tbbase);
+		ftime(&tb);
+		tb.time -= tbbase.time;
+		return (lng) tb.time * 1000000 + (lng) tb.millitm * 1000;
+	}
+#endif
+#endif
 }
 
 
@@ -317,6 +317,8 @@ typedef struct {
 	} while (0)
 
 gdk_export int MT_check_nr_cores(void);
+gdk_export int MT_check_nr_nodes(void);
+gdk_export int MT_bind_thread_node(int node);	/* of the calling thread, 0 on success */
 
 /*
  * @- Timers
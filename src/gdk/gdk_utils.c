@@ -260,7 +260,9 @@ static volatile ATOMIC_TYPE GDK_vm_cursize = 0;
 #ifdef ATOMIC_LOCK
 static MT_Lock mbyteslock MT_LOCK_INITIALIZER("mbyteslock");
 static MT_Lock GDKstoppedLock MT_LOCK_INITIALIZER("GDKstoppedLock");
+static MT_Lock GDKbusyLock MT_LOCK_INITIALIZER("GDKbusyLock");
 #endif
+static MT_Lock GDKparallelLock MT_LOCK_INITIALIZER("GDKparallelLock");
 
 size_t _MT_pagesize = 0;	/* variable holding page size */
 size_t _MT_npages = 0;		/* variable holding memory size in pages */
@@ -294,6 +296,7 @@ MT_init(void)
 
 static void THRinit(void);
 static void GDKlockHome(int farmid);
+static void GDKparallel_exit(void);
 
 #ifndef STATIC_CODE_ANALYSIS
 #ifndef NDEBUG
@@ -319,7 +322,9 @@ GDKinit(str dbpath)
 	MT_lock_init(&MT_system_lock,"MT_system_lock");
 	ATOMIC_INIT(GDKstoppedLock);
 	ATOMIC_INIT(mbyteslock);
+	ATOMIC_INIT(GDKbusyLock);
 	MT_lock_init(&GDKnameLock, "GDKnameLock");
+	MT_lock_init(&GDKparallelLock, "GDKparallelLock");
 	MT_lock_init(&GDKthreadLock, "GDKthreadLock");
 	MT_lock_init(&GDKtmLock, "GDKtmLock");
 #ifndef NDEBUG
@@ -493,6 +498,7 @@ GDKprepareExit(void)
 
 	if (ATOMIC_TAS(GDKstopped, GDKstoppedLock) != 0)
 		return;
+	GDKparallel_exit();
 
 	MT_lock_set(&GDKthreadLock);
 	for (st = serverthread; st; st = serverthread) {
@@ -543,6 +549,7 @@ GDKreset(int status, int exit)
 		GDKval = 0;
 	}
 
+	GDKparallel_exit();
 	MT_lock_set(&GDKthreadLock);
 	for (st = serverthread; st; st = serverthread) {
 		MT_lock_unset(&GDKthreadLock);
@@ -644,8 +651,10 @@ GDKreset(int status, int exit)
 #if defined(USE_PTHREAD_LOCKS) && defined(ATOMIC_LOCK)
 	MT_lock_destroy(&GDKstoppedLock);
 	MT_lock_destroy(&mbyteslock);
+	MT_lock_destroy(&GDKbusyLock);
 #endif
 	MT_lock_destroy(&GDKnameLock);
+	MT_lock_destroy(&GDKparallelLock);
 	MT_lock_destroy(&GDKthreadLock);
 	MT_lock_destroy(&GDKtmLock);
 #ifndef NDEBUG
@@ -1062,6 +1071,18 @@ GDK_find_thread(MT_Id pid)
 	return NULL;
 }
 
+/* the record of the calling thread, NULL if it is not registered */
+Thread
+THRself(void)
+{
+	Thread s;
+
+	MT_lock_set(&GDKthreadLock);
+	s = GDK_find_thread(MT_getpid());
+	MT_lock_unset(&GDKthreadLock);
+	return s;
+}
+
 Thread
 THRnew(const char *name)
 {
@@ -1203,6 +1224,241 @@ THRgettid(void)
 	return t;
 }
 
+/*
+ * Parallel kernel operations hand their work to a pool of helper
+ * threads, which is started on first use and stopped on exit.
+ * Together with the dataflow workers that execute MAL instructions
+ * (they tell us through GDKbusy) the helpers keep at most
+ * GDKnr_threads cores busy, so an operation called while all cores
+ * are in use runs on its caller alone.
+ */
+typedef struct parjob {
+	struct parjob *next;	/* in the queue of jobs wanting helpers */
+	void (*func)(void *);
+	char *args;
+	size_t size;
+	int nrecs;		/* argument records */
+	int taken;		/* records handed out */
+	int wanted;		/* helpers that may still join */
+	int helping;		/* helpers that joined and did not finish */
+	int waiting;		/* the caller waits for them on done */
+	MT_Sema done;
+	Interrupt *qry;		/* of the caller */
+	char errbuf[GDKMAXERRLEN]; /* errors of the helpers */
+} parjob;
+
+static MT_Sema GDKparallelSema;	/* helpers wait on it for jobs */
+static MT_Id GDKhelpers[GDK_MAXPARALLEL];
+static int GDKnrhelpers;	/* helpers started */
+static int GDKhelping;		/* helpers promised to jobs */
+static int GDKhelpersexit;
+static parjob *GDKjobs;
+static volatile ATOMIC_TYPE GDKbusyworkers = 0;
+
+/* a dataflow worker starts (1) or finishes (-1) an instruction */
+void
+GDKbusy(int delta)
+{
+	if (delta > 0)
+		(void) ATOMIC_INC(GDKbusyworkers, GDKbusyLock);
+	else
+		(void) ATOMIC_DEC(GDKbusyworkers, GDKbusyLock);
+}
+
+/* cores not used by a dataflow worker or a helper, the caller's not
+ * counted; call with GDKparallelLock held */
+static int
+GDKidlecores(void)
+{
+	int busy = (int) ATOMIC_GET(GDKbusyworkers, GDKbusyLock);
+
+	/* the caller may be one of the busy workers */
+	return GDKnr_threads - (busy > 1 ? busy : 1) - GDKhelping;
+}
+
+/* the number of threads (including the caller) a parallel operation
+ * can use now, 1 when all cores are in use */
+int
+GDKparallel_threads(void)
+{
+	int n;
+
+	if (GDKnr_threads <= 1)
+		return 1;
+	MT_lock_set(&GDKparallelLock);
+	n = GDKidlecores() + 1;
+	MT_lock_unset(&GDKparallelLock);
+	if (n > GDK_MAXPARALLEL)
+		n = GDK_MAXPARALLEL;
+	return n < 1 ? 1 : n;
+}
+
+/* run the records of a job that no thread has taken yet */
+static void
+GDKparallel_run(parjob *job)
+{
+	int i;
+
+	for (;;) {
+		MT_lock_set(&GDKparallelLock);
+		i = job->taken < job->nrecs ? job->taken++ : -1;
+		MT_lock_unset(&GDKparallelLock);
+		if (i < 0)
+			break;
+		(*job->func)(job->args + i * job->size);
+	}
+}
+
+static void
+GDKhelper(void *arg)
+{
+	Thread thr;
+	parjob *job;
+	char *buf;
+	size_t len;
+
+	(void) arg;
+	thr = THRnew("GDKhelper");
+	GDKsetbuf(GDKmalloc(GDKMAXERRLEN)); /* where to leave errors */
+	for (;;) {
+		MT_sema_down(&GDKparallelSema);
+		MT_lock_set(&GDKparallelLock);
+		if (GDKhelpersexit) {
+			MT_lock_unset(&GDKparallelLock);
+			break;
+		}
+		/* the job of a wake-up may have been withdrawn */
+		if ((job = GDKjobs) == NULL) {
+			MT_lock_unset(&GDKparallelLock);
+			continue;
+		}
+		if (--job->wanted == 0)
+			GDKjobs = job->next;
+		job->helping++;
+		MT_lock_unset(&GDKparallelLock);
+
+		GDKclrerr();
+		if (thr)
+			THRset_interrupt(thr, job->qry);
+		GDKparallel_run(job);
+		if (thr)
+			THRset_interrupt(thr, NULL);
+
+		MT_lock_set(&GDKparallelLock);
+		if ((buf = GDKerrbuf) != NULL && *buf) {
+			len = strlen(job->errbuf);
+			strncpy(job->errbuf + len, buf, GDKMAXERRLEN - len - 1);
+			job->errbuf[GDKMAXERRLEN - 1] = 0;
+		}
+		GDKhelping--;
+		/* the job is gone once its caller is released */
+		if (--job->helping == 0 && job->wanted == 0 && job->waiting)
+			MT_sema_up(&job->done);
+		MT_lock_unset(&GDKparallelLock);
+	}
+	GDKfree(GDKerrbuf);
+	GDKsetbuf(NULL);
+	if (thr)
+		THRdel(thr);
+}
+
+/* stop the helpers, they are idle since no query runs anymore */
+static void
+GDKparallel_exit(void)
+{
+	int i, n;
+
+	MT_lock_set(&GDKparallelLock);
+	n = GDKnrhelpers;
+	GDKhelpersexit = 1;
+	MT_lock_unset(&GDKparallelLock);
+	for (i = 0; i < n; i++)
+		MT_sema_up(&GDKparallelSema);
+	for (i = 0; i < n; i++)
+		MT_join_thread(GDKhelpers[i]);
+	if (n > 0)
+		MT_sema_destroy(&GDKparallelSema);
+	GDKnrhelpers = GDKhelping = GDKhelpersexit = 0;
+	GDKjobs = NULL;
+}
+
+/* Call func for each of the nrecs argument records in args (each size
+ * bytes long) and wait for all of them.  Idle helpers take records
+ * alongside the calling thread, which does whatever they leave; the
+ * records must therefore not wait for each other. */
+void
+GDKparallel(int nrecs, void (*func)(void *), void *args, size_t size)
+{
+	parjob job;
+	int i, n;
+	char *buf;
+	size_t len;
+
+	assert(nrecs > 0 && nrecs <= GDK_MAXPARALLEL);
+	job.next = NULL;
+	job.func = func;
+	job.args = args;
+	job.size = size;
+	job.nrecs = nrecs;
+	job.taken = job.wanted = job.helping = job.waiting = 0;
+	job.qry = THRgetinterrupt();
+	job.errbuf[0] = 0;
+
+	MT_lock_set(&GDKparallelLock);
+	n = GDKexiting() ? 0 : GDKidlecores();
+	if (n > nrecs - 1)
+		n = nrecs - 1;
+	/* start the helpers the job needs, but keep at most one per core */
+	for (i = GDKnrhelpers; i < GDKhelping + n && i < GDKnr_threads - 1 && i < GDK_MAXPARALLEL; i++) {
+		if (i == 0)
+			MT_sema_init(&GDKparallelSema, 0, "GDKparallelSema");
+		if (MT_create_thread(&GDKhelpers[i], GDKhelper, NULL, MT_THR_JOINABLE) < 0) {
+			if (i == 0)
+				MT_sema_destroy(&GDKparallelSema);
+			break;
+		}
+		GDKnrhelpers++;
+	}
+	if (n > GDKnrhelpers - GDKhelping)
+		n = GDKnrhelpers - GDKhelping;
+	if (n > 0) {
+		MT_sema_init(&job.done, 0, "GDKparallel");
+		job.wanted = n;
+		GDKhelping += n;
+		job.next = GDKjobs;
+		GDKjobs = &job;
+	}
+	MT_lock_unset(&GDKparallelLock);
+	for (i = 0; i < n; i++)
+		MT_sema_up(&GDKparallelSema);
+
+	GDKparallel_run(&job);
+	if (n <= 0)
+		return;
+
+	/* withdraw the promises of helpers that did not join */
+	MT_lock_set(&GDKparallelLock);
+	if (job.wanted > 0) {
+		parjob **jp;
+
+		for (jp = &GDKjobs; *jp != &job; jp = &(*jp)->next)
+			;
+		*jp = job.next;
+		GDKhelping -= job.wanted;
+		job.wanted = 0;
+	}
+	job.waiting = job.helping > 0;
+	MT_lock_unset(&GDKparallelLock);
+	if (job.waiting)
+		MT_sema_down(&job.done);
+	MT_sema_destroy(&job.done);
+	if (job.errbuf[0] && (buf = GDKerrbuf) != NULL) {
+		len = strlen(buf);
+		strncpy(buf + len, job.errbuf, GDKMAXERRLEN - len - 1);
+		buf[GDKMAXERRLEN - 1] = 0;
+	}
+}
+
 int
 THRprintf(stream *s, const char *format, ...)
 {
@@ -1299,17 +1555,21 @@ GDKextractParentAndLastDirFromPath(const char *path, char *last_dir_parent, char
 size_t
 GDKmem_cursize(void)
 {
-	/* RAM/swapmem that Monet is really using now */
-	//return (size_t) ATOMIC_GET(GDK_mallocedbytes_estimate, mbyteslock);
-	return 0;
+	/* RAM/swapmem that Monet is really using now; the counters
+	 * are reset by GDKreset, so memory allocated before a restart
+	 * and freed after it can drive them below zero */
+	ssize_t sz = (ssize_t) ATOMIC_GET(GDK_mallocedbytes_estimate, mbyteslock);
+
+	return sz > 0 ? (size_t) sz : 0;
 }
 
 size_t
 GDKvm_cursize(void)
 {
 	/* current Monet VM address space usage */
-	return 0;
-	//return (size_t) ATOMIC_GET(GDK_vm_cursize, mbyteslock) + GDKmem_cursize();
+	ssize_t sz = (ssize_t) ATOMIC_GET(GDK_vm_cursize, mbyteslock);
+
+	return (sz > 0 ? (size_t) sz : 0) + GDKmem_cursize();
 }
 
 #define heapinc(_memdelta)						\
@@ -1396,6 +1656,15 @@ GDKmalloc_internal(size_t size)
 		GDKerror("allocating too much memory\n");
 		return NULL;
 	}
+	/* heaps move to memory mapped files before they hit the
+	 * memory budget, other large allocations fail right away;
+	 * small ones are let through, so that the failure can still
+	 * be reported */
+	if (size >= 4 * GDK_mmap_pagesize &&
+	    GDKmem_cursize() + size > GDK_mem_maxsize) {
+		GDKerror("GDKmalloc: memory budget of " SZFMT " bytes exceeded\n", GDK_mem_maxsize);
+		return NULL;
+	}
 
 	/* pad to multiple of eight bytes and add some extra space to
 	 * write real size in front; when debugging, also allocate
@@ -1538,6 +1807,11 @@ GDKrealloc(void *s, size_t size)
 		GDKerror("allocating too much memory\n");
 		return NULL;
 	}
+	if (nsize > asize && nsize >= 4 * GDK_mmap_pagesize &&
+	    GDKmem_cursize() + nsize - asize > GDK_mem_maxsize) {
+		GDKerror("GDKrealloc: memory budget of " SZFMT " bytes exceeded\n", GDK_mem_maxsize);
+		return NULL;
+	}
 #ifndef NDEBUG
 	assert((asize & 2) == 0);   /* check against duplicate free */
 	/* check for out-of-bounds writes */
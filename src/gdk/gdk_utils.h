@@ -84,6 +84,7 @@ gdk_export void GDKsetmallocsuccesscount(lng count);
  * takes care of this.
  */
 gdk_export int GDKnr_threads;
+gdk_export void GDKbusy(int delta);
 #ifndef HAVE_EMBEDDED
 __declspec(noreturn) gdk_export void GDKexit(int status)
 	__attribute__((__noreturn__));
@@ -0,0 +1,534 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0.  If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Copyright 1997 - July 2008 CWI, August 2008 - 2017 MonetDB B.V.
+ */
+
+/*
+ * Zone maps
+ *
+ * A zone map records the smallest and the largest value of each
+ * block of ZONEMAP_BLOCK consecutive values of a column of one of the
+ * fixed-width numeric types.  A scan for a range of values can skip
+ * all blocks whose values lie outside of that range, which on
+ * (nearly) ordered data, such as time-ordered event tables, leaves
+ * just a handful of blocks to look at.  Nils are not recorded: a
+ * block that holds nothing but nils gets the empty range [max, min]
+ * of its type.
+ *
+ * Zone maps are cheap to build and they are extended when values are
+ * appended to the column; any other update destroys them.  Like the
+ * order index, a zone map lives in a heap of its own, which is saved
+ * next to the tail heap (extension tzonemap).  The b->tzonemap
+ * pointer is NULL if there is no zone map, (Heap *) 1 if there may
+ * be one on disk, or the loaded heap.  The heap starts with a version
+ * number and the number of values covered, followed by the minimum
+ * and maximum of each block.
+ */
+
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "gdk_private.h"
+
+#define ZONEMAP_VERSION	((size_t) 1)
+#define ZONEMAP_SYNCED	((size_t) 1 << 24) /* heap matches file */
+#define ZONEMAP_BLOCK	((BUN) 1024)	/* values per block */
+#define ZONEMAPOFF	2		/* size_t's in header */
+
+/* number of values covered by the zone map */
+#define ZMcount(hp)	((BUN) ((size_t *) (hp)->base)[1])
+/* the bounds of block i are at positions 2*i (min) and 2*i+1 (max) */
+#define ZMbounds(hp)	((hp)->base + ZONEMAPOFF * SIZEOF_SIZE_T)
+#define ZMblocks(n)	(((n) + ZONEMAP_BLOCK - 1) / ZONEMAP_BLOCK)
+#define ZMsize(b, n)	(ZONEMAPOFF * SIZEOF_SIZE_T + ZMblocks(n) * 2 * (b)->twidth)
+
+static int
+ZMtype(int tpe)
+{
+	if (ATOMtype(tpe) == TYPE_oid)
+		return 0;
+	switch (ATOMbasetype(tpe)) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_flt:
+	case TYPE_dbl:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+/* remove the zone map of b; called with the lock held */
+static void
+ZMremove(BAT *b)
+{
+	Heap *hp = b->tzonemap;
+
+	assert(hp != NULL && hp != (Heap *) 1);
+	b->tzonemap = NULL;
+	if (HEAPdelete(hp, BBP_physical(b->batCacheid), "tzonemap"))
+		IODEBUG fprintf(stderr, "#ZMremove(%s): zone map heap\n", BATgetId(b));
+	GDKfree(hp);
+}
+
+/* load the zone map saved with b if it covers exactly the first cnt
+ * values of b, which are the values b had when the zone map was saved
+ * (any other update removes the file); called with the lock held */
+static void
+ZMload(BAT *b, BUN cnt)
+{
+	Heap *hp;
+	const char *nme = BBP_physical(b->batCacheid);
+	int fd;
+
+	assert(b->tzonemap == (Heap *) 1);
+	b->tzonemap = NULL;
+	if ((hp = GDKzalloc(sizeof(Heap))) != NULL &&
+	    (hp->farmid = BBPselectfarm(b->batRole, b->ttype, zonemapheap)) >= 0 &&
+	    (hp->filename = GDKmalloc(strlen(nme) + 10)) != NULL) {
+		sprintf(hp->filename, "%s.tzonemap", nme);
+
+		/* check whether a persisted zone map can be found */
+		if ((fd = GDKfdlocate(hp->farmid, nme, "rb", "tzonemap")) >= 0) {
+			size_t hdata[ZONEMAPOFF];
+			struct stat st;
+
+			if (read(fd, hdata, sizeof(hdata)) == sizeof(hdata) &&
+			    hdata[0] == (ZONEMAP_VERSION | ZONEMAP_SYNCED) &&
+			    hdata[1] == (size_t) cnt &&
+			    fstat(fd, &st) == 0 &&
+			    st.st_size >= (off_t) (hp->size = hp->free = ZMsize(b, hdata[1])) &&
+			    HEAPload(hp, nme, "tzonemap", 0) == GDK_SUCCEED) {
+				close(fd);
+				hp->parentid = b->batCacheid;
+				b->tzonemap = hp;
+				ALGODEBUG fprintf(stderr, "#BATzonemap: reusing persisted zone map %d\n", b->batCacheid);
+				return;
+			}
+			close(fd);
+			/* unlink unusable file */
+			GDKunlink(hp->farmid, BATDIR, nme, "tzonemap");
+		}
+		GDKfree(hp->filename);
+	}
+	GDKfree(hp);
+	GDKclrerr();	/* we're not currently interested in errors */
+}
+
+/* create an empty zone map heap for b; returns NULL on failure */
+static Heap *
+ZMcreate(BAT *b)
+{
+	Heap *hp;
+	const char *nme;
+	size_t nmelen;
+
+	nme = GDKinmemory() ? ":inmemory" : BBP_physical(b->batCacheid);
+	nmelen = strlen(nme) + 10;
+	if ((hp = GDKzalloc(sizeof(Heap))) == NULL ||
+	    (hp->farmid = BBPselectfarm(b->batRole, b->ttype, zonemapheap)) < 0 ||
+	    (hp->filename = GDKmalloc(nmelen)) == NULL ||
+	    snprintf(hp->filename, nmelen, "%s.tzonemap", nme) < 0 ||
+	    HEAPalloc(hp, ZMsize(b, BATcount(b)), 1) != GDK_SUCCEED) {
+		if (hp)
+			GDKfree(hp->filename);
+		GDKfree(hp);
+		return NULL;
+	}
+	hp->free = ZONEMAPOFF * SIZEOF_SIZE_T;
+	hp->parentid = b->batCacheid;
+	((size_t *) hp->base)[0] = ZONEMAP_VERSION;
+	((size_t *) hp->base)[1] = 0;
+	return hp;
+}
+
+/* widen the bounds with the values of b from position from on, where
+ * from may lie halfway a block */
+#define ZMFILL(TYPE)							\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
+		TYPE *restrict bnd = (TYPE *) ZMbounds(hp);		\
+		const TYPE nil = TYPE##_nil;				\
+		TYPE mn, mx, v;						\
+		BUN i, e, blk;						\
+									\
+		for (i = from; i < cnt; ) {				\
+			blk = i / ZONEMAP_BLOCK;			\
+			e = MIN((blk + 1) * ZONEMAP_BLOCK, cnt);	\
+			if (i == blk * ZONEMAP_BLOCK) {			\
+				mn = GDK_##TYPE##_max;			\
+				mx = GDK_##TYPE##_min;			\
+			} else {					\
+				mn = bnd[2 * blk];			\
+				mx = bnd[2 * blk + 1];			\
+			}						\
+			for (; i < e; i++) {				\
+				v = vals[i];				\
+				if (v != nil) {				\
+					if (v < mn)			\
+						mn = v;			\
+					if (v > mx)			\
+						mx = v;			\
+				}					\
+			}						\
+			bnd[2 * blk] = mn;				\
+			bnd[2 * blk + 1] = mx;				\
+		}							\
+	} while (0)
+
+/* bring the zone map hp of b up to date with the values from position
+ * from on; called with the lock held */
+static gdk_return
+ZMfill(BAT *b, Heap *hp, BUN from)
+{
+	BUN cnt = BATcount(b);
+	size_t size = ZMsize(b, cnt);
+
+	assert(from <= cnt);
+	if (size > hp->size &&
+	    HEAPextend(hp, MAX(size, hp->size + hp->size / 2), 0) != GDK_SUCCEED)
+		return GDK_FAIL;
+	/* the heap no longer matches a saved file */
+	((size_t *) hp->base)[0] = ZONEMAP_VERSION;
+	switch (ATOMbasetype(b->ttype)) {
+	case TYPE_bte:
+		ZMFILL(bte);
+		break;
+	case TYPE_sht:
+		ZMFILL(sht);
+		break;
+	case TYPE_int:
+		ZMFILL(int);
+		break;
+	case TYPE_lng:
+		ZMFILL(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		ZMFILL(hge);
+		break;
+#endif
+	case TYPE_flt:
+		ZMFILL(flt);
+		break;
+	case TYPE_dbl:
+		ZMFILL(dbl);
+		break;
+	default:
+		assert(0);
+	}
+	((size_t *) hp->base)[1] = (size_t) cnt;
+	hp->free = size;
+	return GDK_SUCCEED;
+}
+
+/* save the zone map of b if it covers all values and was changed
+ * since it was last saved; called with the lock held */
+static void
+ZMsync(BAT *b)
+{
+	Heap *hp = b->tzonemap;
+	const char *nme = BBP_physical(b->batCacheid);
+	int fd;
+
+	if (GDKinmemory() ||
+	    hp == NULL || hp == (Heap *) 1 ||
+	    (((size_t *) hp->base)[0] & ZONEMAP_SYNCED) ||
+	    ZMcount(hp) != BATcount(b))
+		return;
+	if (HEAPsave(hp, nme, "tzonemap") == GDK_SUCCEED &&
+	    (fd = GDKfdlocate(hp->farmid, nme, "rb+", "tzonemap")) >= 0) {
+		ALGODEBUG fprintf(stderr, "#BATzonemap: persisting zone map %d\n", b->batCacheid);
+		/* sync-on-disk checked bit */
+		((size_t *) hp->base)[0] |= ZONEMAP_SYNCED;
+		if (write(fd, hp->base, SIZEOF_SIZE_T) >= 0) {
+			if (!(GDKdebug & NOSYNCMASK)) {
+#if defined(NATIVE_WIN32)
+				_commit(fd);
+#elif defined(HAVE_FDATASYNC)
+				fdatasync(fd);
+#elif defined(HAVE_FSYNC)
+				fsync(fd);
+#endif
+			}
+		} else {
+			perror("write zonemap");
+		}
+		close(fd);
+	}
+	GDKclrerr();	/* we're not currently interested in errors */
+}
+
+/* make sure b (or its parent if b is a view) has a zone map that
+ * covers all its values */
+gdk_return
+BATzonemap(BAT *b)
+{
+	Heap *hp;
+	lng t0 = 0;
+
+	BATcheck(b, "BATzonemap", GDK_FAIL);
+
+	if (VIEWtparent(b)) {
+		/* views use the zone map of their parent */
+		b = BBPdescriptor(VIEWtparent(b));
+		assert(b);
+	}
+	if (!ZMtype(b->ttype)) {
+		GDKerror("BATzonemap: unsupported type\n");
+		return GDK_FAIL;
+	}
+
+	ALGODEBUG t0 = GDKusec();
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if (b->tzonemap == (Heap *) 1)
+		ZMload(b, BATcount(b));
+	if ((hp = b->tzonemap) != NULL && ZMcount(hp) > BATcount(b)) {
+		/* values were removed: start all over */
+		ZMremove(b);
+		hp = NULL;
+	}
+	if (hp == NULL) {
+		if ((hp = ZMcreate(b)) == NULL) {
+			MT_lock_unset(&GDKhashLock(b->batCacheid));
+			return GDK_FAIL;
+		}
+		b->tzonemap = hp;
+	}
+	if (ZMcount(hp) < BATcount(b)) {
+		if (ZMfill(b, hp, ZMcount(hp)) != GDK_SUCCEED) {
+			ZMremove(b);
+			MT_lock_unset(&GDKhashLock(b->batCacheid));
+			return GDK_FAIL;
+		}
+		ALGODEBUG fprintf(stderr, "#BATzonemap(%s#" BUNFMT "): "
+				  "zone map construction " LLFMT " usec\n",
+				  BATgetId(b), BATcount(b), GDKusec() - t0);
+		/* if the BAT is on disk as it is, save the zone map
+		 * now, else BATsave will */
+		if ((BBP_status(b->batCacheid) & BBPEXISTING) && !BATdirty(b))
+			ZMsync(b);
+	}
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+	return GDK_SUCCEED;
+}
+
+/* extend the zone map of b, if it has one, with the cnt values that
+ * were just appended to b */
+void
+ZMappend(BAT *b, BUN cnt)
+{
+	Heap *hp;
+
+	if (b->tzonemap == NULL)
+		return;
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if (b->tzonemap == (Heap *) 1)
+		ZMload(b, BATcount(b) - cnt);
+	if ((hp = b->tzonemap) != NULL) {
+		if (ZMcount(hp) > BATcount(b)) {
+			ZMremove(b);
+		} else if (ZMfill(b, hp, ZMcount(hp)) != GDK_SUCCEED) {
+			ZMremove(b);
+			GDKclrerr();	/* not maintaining it is no error */
+		}
+	}
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+}
+
+/* save the zone map of b together with b */
+void
+ZMsave(BAT *b)
+{
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	ZMsync(b);
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+}
+
+/* free the memory of the zone map, but keep the file */
+void
+ZMfree(BAT *b)
+{
+	if (b) {
+		Heap *hp;
+
+		MT_lock_set(&GDKhashLock(b->batCacheid));
+		if ((hp = b->tzonemap) != NULL && hp != (Heap *) 1) {
+			b->tzonemap = GDKinmemory() ? NULL : (Heap *) 1;
+			HEAPfree(hp, 0);
+			GDKfree(hp);
+		}
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+	}
+}
+
+void
+ZMdestroy(BAT *b)
+{
+	if (b) {
+		MT_lock_set(&GDKhashLock(b->batCacheid));
+		if (b->tzonemap == (Heap *) 1) {
+			b->tzonemap = NULL;
+			GDKunlink(BBPselectfarm(b->batRole, b->ttype, zonemapheap),
+				  BATDIR,
+				  BBP_physical(b->batCacheid),
+				  "tzonemap");
+		} else if (b->tzonemap != NULL) {
+			ZMremove(b);
+		}
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+	}
+}
+
+/* return the zone map b can use to skip blocks, which is the one of
+ * its parent if b is a view, provided that it covers all values; off
+ * is set to the position of the first value of b in the zone map */
+const Heap *
+ZMget(BAT *b, BUN *off)
+{
+	BAT *pb = b;
+	const Heap *hp;
+
+	if (VIEWtparent(b)) {
+		pb = BBPdescriptor(VIEWtparent(b));
+		if (pb == NULL || pb->twidth != b->twidth)
+			return NULL;
+	}
+	hp = pb->tzonemap;
+	if (hp == NULL || hp == (Heap *) 1 || ZMcount(hp) != BATcount(pb) ||
+	    !ZMtype(b->ttype) ||
+	    Tloc(b, 0) < Tloc(pb, 0))
+		return NULL;
+	*off = (BUN) ((Tloc(b, 0) - Tloc(pb, 0)) >> b->tshift);
+	if (*off + BATcount(b) > BATcount(pb))
+		return NULL;
+	return hp;
+}
+
+#define ZMSKIP(TYPE)							\
+	do {								\
+		const TYPE *restrict bnd = (const TYPE *) ZMbounds(zm);	\
+		const TYPE vl = * (const TYPE *) tl;			\
+		const TYPE vh = * (const TYPE *) th;			\
+		while (i < j && (bnd[2 * i + 1] < vl || bnd[2 * i] > vh)) \
+			i++;						\
+		k = i;							\
+		while (k < j && bnd[2 * k + 1] >= vl && bnd[2 * k] <= vh) \
+			k++;						\
+	} while (0)
+
+/* Before scanning the values [*p, e) of a BAT for values in the
+ * closed range [*tl, *th], move *p past the blocks that cannot hold
+ * any such value, and return the end of the run of blocks that can
+ * (but at most e).  If there is no such block, *p becomes e. */
+BUN
+ZMskip(const Heap *zm, int tpe, BUN off, const void *tl, const void *th,
+       BUN *p, BUN e)
+{
+	BUN i = (*p + off) / ZONEMAP_BLOCK;
+	BUN j = ZMblocks(e + off);
+	BUN k = j;
+
+	assert(e + off <= ZMcount(zm));
+	switch (ATOMbasetype(tpe)) {
+	case TYPE_bte:
+		ZMSKIP(bte);
+		break;
+	case TYPE_sht:
+		ZMSKIP(sht);
+		break;
+	case TYPE_int:
+		ZMSKIP(int);
+		break;
+	case TYPE_lng:
+		ZMSKIP(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		ZMSKIP(hge);
+		break;
+#endif
+	case TYPE_flt:
+		ZMSKIP(flt);
+		break;
+	case TYPE_dbl:
+		ZMSKIP(dbl);
+		break;
+	default:
+		assert(0);
+		return e;
+	}
+	if (i * ZONEMAP_BLOCK > *p + off)
+		*p = MIN(i * ZONEMAP_BLOCK - off, e);
+	if (k < j)
+		e = k * ZONEMAP_BLOCK - off;
+	return e;
+}
+
+#define ZMMINMAX(TYPE)							\
+	do {								\
+		const TYPE *restrict bnd = (const TYPE *) ZMbounds(hp);	\
+		TYPE v = TYPE##_nil;					\
+		for (i = 0; i < n; i++) {				\
+			if (bnd[2 * i] > bnd[2 * i + 1])		\
+				continue;	/* only nils */		\
+			if (max) {					\
+				if (v == TYPE##_nil || bnd[2 * i + 1] > v) \
+					v = bnd[2 * i + 1];		\
+			} else {					\
+				if (v == TYPE##_nil || bnd[2 * i] < v)	\
+					v = bnd[2 * i];			\
+			}						\
+		}							\
+		* (TYPE *) res = v;					\
+	} while (0)
+
+/* if the zone map of b covers exactly the values of b, store the
+ * smallest (max == 0) or largest (max != 0) non-nil value of b, or nil
+ * if there is none, in res and return 1; else return 0 */
+int
+ZMminmax(BAT *b, int max, void *res)
+{
+	const Heap *hp;
+	BUN off = 0, i, n;
+
+	if ((hp = ZMget(b, &off)) == NULL || off != 0 ||
+	    ZMcount(hp) != BATcount(b))
+		return 0;
+	n = ZMblocks(BATcount(b));
+	switch (ATOMbasetype(b->ttype)) {
+	case TYPE_bte:
+		ZMMINMAX(bte);
+		break;
+	case TYPE_sht:
+		ZMMINMAX(sht);
+		break;
+	case TYPE_int:
+		ZMMINMAX(int);
+		break;
+	case TYPE_lng:
+		ZMMINMAX(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		ZMMINMAX(hge);
+		break;
+#endif
+	case TYPE_flt:
+		ZMMINMAX(flt);
+		break;
+	case TYPE_dbl:
+		ZMMINMAX(dbl);
+		break;
+	default:
+		return 0;
+	}
+	return 1;
+}
@@ -12,6 +12,8 @@
 
 char 	monet_cwd[PATHLENGTH] = { 0 };
 size_t 	monet_memory = 0;
+lng 	memorypool = 0;
+int 	memoryclaims = 0;
 char 	monet_characteristics[PATHLENGTH];
 int		mal_trace;		/* enable profile events on console */
 str     mal_session_uuid;   /* unique marker for the session */
@@ -235,6 +235,12 @@ MCinitClientRecord(Client c, oid user, bstream *fin, stream *fout)
 	c->session = GDKusec();
 	c->qtimeout = 0;
 	c->stimeout = 0;
+	c->qmaxmem = 0;
+	c->qinterrupt.stop = 0;
+	c->qinterrupt.deadline = 0;
+	c->qinterrupt.maxmem = 0;
+	c->qinterrupt.memclaim = 0;
+	c->qstart = 0;
 	c->stage = 0;
 	c->itrace = 0;
 	c->flags = 0;
@@ -393,6 +399,12 @@ freeClient(Client c)
 	//c->active = 0;
 	c->qtimeout = 0;
 	c->stimeout = 0;
+	c->qmaxmem = 0;
+	c->qinterrupt.stop = 0;
+	c->qinterrupt.deadline = 0;
+	c->qinterrupt.maxmem = 0;
+	c->qinterrupt.memclaim = 0;
+	c->qstart = 0;
 	c->user = oid_nil;
 	if( c->username){
 		GDKfree(c->username);
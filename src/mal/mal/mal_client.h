@@ -88,6 +88,9 @@ typedef struct CLIENT {
 	lng 		session;	/* usec since start of server */
 	lng 	    qtimeout;	/* query abort after x usec*/
 	lng	        stimeout;	/* session abort after x usec */
+	lng	        qmaxmem;	/* query abort when its intermediates exceed x bytes */
+	Interrupt   qinterrupt;	/* abort request and deadline of the running query */
+	lng	        qstart;		/* usec since start of server the running query was started */
 	/*
 	 * Communication channels for the interconnect are stored here.
 	 * It is perfectly legal to have a client without input stream.
@@ -42,23 +42,48 @@
 typedef struct FLOWEVENT {
 	struct DATAFLOW *flow;/* execution context */
 	int pc;         /* pc in underlying malblock */
-	int blocks;     /* awaiting for variables */
+	volatile ATOMIC_TYPE blocks;     /* awaiting for variables */
 	sht state;      /* of execution */
 	lng clk;
 	sht cost;
+	sht admitted;   /* memory is reserved for it */
 	lng hotclaim;   /* memory foot print of result variables */
-	lng argclaim;   /* memory foot print of arguments */
-	lng maxclaim;   /* memory foot print of  largest argument, counld be used to indicate result size */
+	lng freeclaim;  /* memory foot print of the arguments it garbage collects */
+	lng maxclaim;   /* memory foot print of largest argument, the estimated result size */
+	struct FLOWEVENT *next;	/* chain in the overflow list or an inbox */
 } *FlowEvent, FlowEventRec;
 
-typedef struct queue {
-	int size;	/* size of queue */
-	int last;	/* last element in the queue */
-	int exitcount;	/* how many threads should exit */
-	FlowEvent *data;
-	MT_Lock l;	/* it's a shared resource, ie we need locks */
-	MT_Sema s;	/* threads wait on empty queues */
-} Queue;
+/*
+ * Eligible instructions are kept in a deque per worker (Chase-Lev).
+ * The owner pushes and pops at the bottom, so it continues with the
+ * instructions it just enabled (LIFO favors garbage collection).
+ * Idle workers steal the oldest entry at the top, the only point of
+ * contention is a compare-and-swap on the top index.
+ * The client is copied into the entry, so that a thief can filter
+ * on it without touching an event it may not own.
+ * The indices only grow and may wrap around, only their distance is
+ * meaningful.  A full deque spills into a shared overflow list.
+ */
+typedef struct {
+	FlowEvent fe;
+	Client cntxt;
+} DequeEntry;
+
+typedef struct {
+	volatile ATOMIC_TYPE top;     /* next entry to steal */
+	volatile ATOMIC_TYPE bottom;  /* next free slot of the owner */
+	DequeEntry *data;             /* allocated by the owner upon first use */
+} Deque;
+
+#define DEQUE_SIZE 4096	/* a power of two */
+#define dq_next(i, n)	((ATOMIC_TYPE) ((size_t) (i) + (n)))
+/* a signed distance, ATOMIC_TYPE may be unsigned (AO_t); the difference
+ * is taken modulo the width of the indices to survive a wrap around */
+#define dq_dist(b, t)							\
+	(sizeof(ATOMIC_TYPE) == sizeof(int) ?				\
+	 (lng) (int) ((unsigned int) (b) - (unsigned int) (t)) :	\
+	 (lng) ((ulng) (b) - (ulng) (t)))
+#define dq_entry(d, i)	((d)->data[(size_t) (i) & (DEQUE_SIZE - 1)])
 
 /*
  * The dataflow dependency is administered in a graph list structure.
@@ -71,40 +96,87 @@ typedef struct DATAFLOW {
 	MalStkPtr stk;
 	int start, stop;    /* guarded block under consideration*/
 	FlowEvent status;   /* status of each instruction */
-	str error;          /* error encountered */
+	str error;          /* error encountered, set once */
 	int *nodes;         /* dependency graph nodes */
 	int *edges;         /* dependency graph */
-	MT_Lock flowlock;   /* lock to protect the above */
-	Queue *done;        /* instructions handled */
+	MT_Lock flowlock;   /* lock to protect the error */
+	volatile ATOMIC_TYPE pending;	/* instructions not handled yet */
+	MT_Sema done;       /* raised when the last instruction is handled */
+	struct worker *worker;	/* works for this flow's client only */
+	lng started;        /* its query, the oldest goes first under memory pressure */
 } *DataFlow, DataFlowRec;
 
 static struct worker {
 	MT_Id id;
 	enum {IDLE, RUNNING, JOINING, EXITED} flag;
 	Client cntxt;				/* client we do work for (NULL -> any) */
-	MT_Sema s;
+	MT_Sema s;					/* released when the client's work is queued */
+	MT_Sema wake;				/* client specific worker waits for work */
+	volatile ATOMIC_TYPE sleeping;
+	Deque todo;					/* pending instructions */
+	int node;					/* NUMA node it runs on */
+	FlowEvent inbox;			/* routed here by other workers */
+	MT_Lock inboxLock;
+	/* locality statistics, only updated by the worker itself */
+	lng executed, corelocal, nodelocal, remote, routed, stolen;
 } workers[THREADS];
 
-static Queue *todo = 0;	/* pending instructions */
+static int dataflowInitialized = 0;
+static volatile ATOMIC_TYPE topworker = 0;	/* workers in use are below */
+static volatile ATOMIC_TYPE exitcount = 0;	/* how many workers should exit */
+static volatile ATOMIC_TYPE sleepers = 0;	/* generic workers waiting for work */
+static MT_Sema idle;						/* on which they wait */
+static int nrnodes = 1;						/* the workers are spread over */
+static volatile int tidworker[THREADS + 1];	/* thread id -> worker + 1 */
+
+/* the deques are unbounded, failure to grow one queues here */
+static FlowEvent overflow = NULL;
+static MT_Lock overflowLock MT_LOCK_INITIALIZER("overflowLock");
+
+/* memory admission, see DFLOWadmit */
+static FlowEvent parked = NULL;
+static lng admitted = 0, deferred = 0, forced = 0;
+static MT_Lock admissionLock MT_LOCK_INITIALIZER("admissionLock");
 
 #ifdef ATOMIC_LOCK
 static MT_Lock exitingLock MT_LOCK_INITIALIZER("exitingLock");
+static MT_Lock dequeLock MT_LOCK_INITIALIZER("dequeLock");
 #endif
 static volatile ATOMIC_TYPE exiting = 0;
 static MT_Lock dataflowLock MT_LOCK_INITIALIZER("dataflowLock");
 
+static void
+dq_destroy(Deque *d)
+{
+	GDKfree(d->data);
+	d->data = NULL;
+	d->top = d->bottom = 0;
+}
+
 void
 mal_dataflow_reset(void)
 {
+	int i;
+
 	stopMALdataflow();
-	memset((char*) workers, 0,  sizeof(workers));
-	if( todo) {
-		GDKfree(todo->data);
-		MT_lock_destroy(&todo->l);
-		MT_sema_destroy(&todo->s);
-		GDKfree(todo);
+	if (dataflowInitialized) {
+		for (i = 0; i < THREADS; i++) {
+			dq_destroy(&workers[i].todo);
+			MT_sema_destroy(&workers[i].s);
+			MT_sema_destroy(&workers[i].wake);
+			MT_lock_destroy(&workers[i].inboxLock);
+		}
+		MT_sema_destroy(&idle);
 	}
-	todo = 0;	/* pending instructions */
+	memset((char*) workers, 0,  sizeof(workers));
+	memset((char*) tidworker, 0,  sizeof(tidworker));
+	dataflowInitialized = 0;
+	nrnodes = 1;
+	topworker = exitcount = sleepers = 0;
+	overflow = NULL;
+	parked = NULL;
+	memorypool = admitted = deferred = forced = 0;
+	memoryclaims = 0;
 	exiting = 0;
 }
 
@@ -128,176 +200,468 @@ DFLOWgraphSize(MalBlkPtr mb, int start, int stop)
  * can be executed in parallel.
  */
 
-static Queue*
-q_create(int sz, const char *name)
+/* called by the owner only */
+static void
+dq_push(Deque *d, FlowEvent fe)
+{
+	ATOMIC_TYPE b = ATOMIC_GET(d->bottom, dequeLock);
+	ATOMIC_TYPE t = ATOMIC_GET(d->top, dequeLock);
+
+	if (d->data == NULL)
+		d->data = (DequeEntry *) GDKmalloc(sizeof(DequeEntry) * DEQUE_SIZE);
+	if (d->data == NULL || dq_dist(b, t) >= DEQUE_SIZE) {
+		MT_lock_set(&overflowLock);
+		fe->next = overflow;
+		overflow = fe;
+		MT_lock_unset(&overflowLock);
+		return;
+	}
+	dq_entry(d, b).fe = fe;
+	dq_entry(d, b).cntxt = fe->flow->cntxt;
+	/* publishes the entry to the thieves */
+	ATOMIC_SET(d->bottom, dq_next(b, 1), dequeLock);
+}
+
+/* called by the owner only, takes the most recently pushed entry */
+static FlowEvent
+dq_pop(Deque *d)
 {
-	Queue *q = (Queue*)GDKmalloc(sizeof(Queue));
+	ATOMIC_TYPE b = dq_next(ATOMIC_GET(d->bottom, dequeLock), -1), t;
+	FlowEvent fe = NULL;
+
+	ATOMIC_SET(d->bottom, b, dequeLock);
+	t = ATOMIC_GET(d->top, dequeLock);
+	if (dq_dist(b, t) >= 0) {
+		fe = dq_entry(d, b).fe;
+		if (t == b) {
+			/* the last entry, race against the thieves */
+			if (!ATOMIC_CAS(d->top, t, dq_next(t, 1), dequeLock))
+				fe = NULL;
+			ATOMIC_SET(d->bottom, dq_next(b, 1), dequeLock);
+		}
+	} else
+		ATOMIC_SET(d->bottom, dq_next(b, 1), dequeLock);
+	return fe;
+}
 
-	if (q == NULL)
-		return NULL;
-	q->size = ((sz << 1) >> 1); /* we want a multiple of 2 */
-	q->last = 0;
-	q->data = (FlowEvent*) GDKmalloc(sizeof(FlowEvent) * q->size);
-	if (q->data == NULL) {
-		GDKfree(q);
-		return NULL;
+/* take the oldest entry, provided it belongs to cntxt (if set) */
+static FlowEvent
+dq_steal(Deque *d, Client cntxt)
+{
+	ATOMIC_TYPE t, b;
+	DequeEntry e;
+
+	for (;;) {
+		t = ATOMIC_GET(d->top, dequeLock);
+		b = ATOMIC_GET(d->bottom, dequeLock);
+		if (dq_dist(b, t) <= 0)
+			return NULL;
+		e = dq_entry(d, t);
+		if (cntxt && e.cntxt != cntxt)
+			return NULL;
+		/* the entry is only ours if nobody moved the top meanwhile */
+		if (ATOMIC_CAS(d->top, t, dq_next(t, 1), dequeLock))
+			return e.fe;
 	}
-	q->exitcount = 0;
+}
+
+/* the overflow list and the inboxes, take an entry of cntxt (if set) */
+static FlowEvent
+list_take(FlowEvent *list, MT_Lock *lock, Client cntxt)
+{
+	FlowEvent fe, *prev;
 
-	MT_lock_init(&q->l, name);
-	MT_sema_init(&q->s, 0, name);
-	return q;
+	MT_lock_set(lock);
+	for (prev = list; (fe = *prev) != NULL; prev = &fe->next)
+		if (cntxt == NULL || fe->flow->cntxt == cntxt) {
+			*prev = fe->next;
+			break;
+		}
+	MT_lock_unset(lock);
+	return fe;
 }
 
-static void
-q_destroy(Queue *q)
+static int
+list_has(FlowEvent *list, MT_Lock *lock, Client cntxt)
+{
+	FlowEvent fe;
+
+	if (*list == NULL)
+		return 0;
+	MT_lock_set(lock);
+	for (fe = *list; fe != NULL; fe = fe->next)
+		if (cntxt == NULL || fe->flow->cntxt == cntxt)
+			break;
+	MT_lock_unset(lock);
+	return fe != NULL;
+}
+
+/* is there work a worker for cntxt (if set) could steal? */
+static int
+DFLOWavailable(Client cntxt)
+{
+	ATOMIC_TYPE i, n = ATOMIC_GET(topworker, dequeLock), t;
+	Deque *d;
+
+	for (i = 0; i < n; i++) {
+		d = &workers[i].todo;
+		t = ATOMIC_GET(d->top, dequeLock);
+		if (dq_dist(ATOMIC_GET(d->bottom, dequeLock), t) > 0 &&
+			(cntxt == NULL || dq_entry(d, t).cntxt == cntxt))
+			return 1;
+		if (list_has(&workers[i].inbox, &workers[i].inboxLock, cntxt))
+			return 1;
+	}
+	return list_has(&overflow, &overflowLock, cntxt);
+}
+
+/*
+ * Thieves start with the neighbours, so that they spread over the
+ * victims, and stay on their own NUMA node as long as possible.
+ * The instructions routed to a specific worker are only taken from
+ * its inbox when all deques are empty.
+ */
+static FlowEvent
+DFLOWsteal(struct worker *t, Client cntxt)
 {
-	assert(q);
-	MT_lock_destroy(&q->l);
-	MT_sema_destroy(&q->s);
-	GDKfree(q->data);
-	GDKfree(q);
+	ATOMIC_TYPE i, n = ATOMIC_GET(topworker, dequeLock);
+	int id = (int) (t - workers), pass;
+	struct worker *v;
+	Deque *d;
+	FlowEvent fe;
+
+	for (pass = 0; pass < 4; pass++) {
+		for (i = 1; i <= n; i++) {
+			v = &workers[(id + i) % n];
+			if ((v->node == t->node) != ((pass & 1) == 0))
+				continue;
+			d = &v->todo;
+			if (pass < 2 && (fe = dq_steal(d, cntxt)) != NULL) {
+				/* more work left behind, pass on the wakeup */
+				if (dq_dist(ATOMIC_GET(d->bottom, dequeLock), ATOMIC_GET(d->top, dequeLock)) > 0 &&
+					ATOMIC_GET(sleepers, dequeLock) > 0)
+					MT_sema_up(&idle);
+				if (v != t)
+					t->stolen++;
+				return fe;
+			}
+			if (pass >= 2 && v != t && v->inbox &&
+				(fe = list_take(&v->inbox, &v->inboxLock, cntxt)) != NULL) {
+				t->stolen++;
+				return fe;
+			}
+		}
+		if (nrnodes == 1)
+			pass++;
+	}
+	if (overflow)
+		return list_take(&overflow, &overflowLock, cntxt);
+	return NULL;
 }
 
-/* keep a simple LIFO queue. It won't be a large one, so shuffles of requeue is possible */
-/* we might actually sort it for better scheduling behavior */
+/*
+ * Locality.  The thread that last touched a variable is kept in the
+ * plan (setVarWorker).  An instruction is at home at the worker that
+ * touched most of its BAT arguments, ties are resolved in favor of
+ * the worker asking.  Returns -1 if none of them is known.
+ */
+#define DFLOWvarworker(mb, a)	(tidworker[(int) getVarWorker(mb, a)] - 1)
+
+static int
+DFLOWhome(MalBlkPtr mb, InstrPtr p, int self)
+{
+	int j, k, w, home = -1, best = 0, votes;
+
+	for (j = p->retc; j < p->argc; j++) {
+		if (isVarConstant(mb, getArg(p, j)) || !isaBatType(getArgType(mb, p, j)) ||
+			(w = DFLOWvarworker(mb, getArg(p, j))) < 0)
+			continue;
+		for (votes = 0, k = p->retc; k < p->argc; k++)
+			if (!isVarConstant(mb, getArg(p, k)) && isaBatType(getArgType(mb, p, k)) &&
+				DFLOWvarworker(mb, getArg(p, k)) == w)
+				votes++;
+		if (votes > best || (votes == best && w == self)) {
+			home = w;
+			best = votes;
+		}
+	}
+	return home;
+}
+
+/* account for the arguments of the instruction worker t is about to run */
 static void
-q_enqueue_(Queue *q, FlowEvent d)
+DFLOWlocality(struct worker *t, MalBlkPtr mb, InstrPtr p)
 {
-	assert(q);
-	assert(d);
-	if (q->last == q->size) {
-		q->size <<= 1;
-		q->data = (FlowEvent*) GDKrealloc(q->data, sizeof(FlowEvent) * q->size);
-		assert(q->data);
+	int j, w, known = 0, core = 1, node = 1;
+
+	t->executed++;
+	for (j = p->retc; j < p->argc; j++) {
+		if (isVarConstant(mb, getArg(p, j)) || !isaBatType(getArgType(mb, p, j)) ||
+			(w = DFLOWvarworker(mb, getArg(p, j))) < 0)
+			continue;
+		known = 1;
+		if (&workers[w] != t) {
+			core = 0;
+			if (workers[w].node != t->node)
+				node = 0;
+		}
 	}
-	q->data[q->last++] = d;
+	if (!known)
+		return;
+	if (core)
+		t->corelocal++;
+	else if (node)
+		t->nodelocal++;
+	else
+		t->remote++;
+}
+
+/* hand an eligible instruction to the worker where it is at home,
+ * provided that worker may take it */
+static int
+DFLOWroute(struct worker *h, FlowEvent fe)
+{
+	Client cntxt = h->cntxt;	/* only a hint, read without the lock */
+
+	if (h->flag != RUNNING || (cntxt && cntxt != fe->flow->cntxt))
+		return 0;
+	MT_lock_set(&h->inboxLock);
+	fe->next = h->inbox;
+	h->inbox = fe;
+	MT_lock_unset(&h->inboxLock);
+	if (ATOMIC_CAS(h->sleeping, 1, 0, dequeLock))
+		MT_sema_up(&h->wake);
+	return 1;
 }
+
+/* new work was queued, wake up those that may take it, w is the
+ * worker specific to the flow (the flow itself may be gone already) */
 static void
-q_enqueue(Queue *q, FlowEvent d)
+DFLOWsignal(struct worker *w)
+{
+	if (ATOMIC_GET(sleepers, dequeLock) > 0)
+		MT_sema_up(&idle);
+	if (w && ATOMIC_CAS(w->sleeping, 1, 0, dequeLock))
+		MT_sema_up(&w->wake);
+}
+
+static int
+DFLOWexitrequest(void)
 {
-	assert(q);
-	assert(d);
-	MT_lock_set(&q->l);
-	q_enqueue_(q, d);
-	MT_lock_unset(&q->l);
-	MT_sema_up(&q->s);
+	ATOMIC_TYPE n;
+
+	while ((n = ATOMIC_GET(exitcount, dequeLock)) > 0)
+		if (ATOMIC_CAS(exitcount, n, n - 1, dequeLock))
+			return 1;
+	return 0;
 }
 
 /*
- * A priority queue over the hot claims of memory may
- * be more effective. It priorizes those instructions
- * that want to use a big recent result
+ * Going to sleep is announced first, and work is checked for
+ * afterwards, while those that queue work first publish it and
+ * then look for sleepers. This way no wakeup is missed.
  */
+static void
+DFLOWsleep(struct worker *t, Client cntxt)
+{
+	if (cntxt == NULL) {
+		ATOMIC_INC(sleepers, dequeLock);
+		if (!DFLOWavailable(NULL) &&
+			ATOMIC_GET(exitcount, dequeLock) == 0 &&
+			!ATOMIC_GET(exiting, exitingLock))
+			MT_sema_down(&idle);
+		ATOMIC_DEC(sleepers, dequeLock);
+		return;
+	}
+	ATOMIC_SET(t->sleeping, 1, dequeLock);
+	MT_lock_set(&dataflowLock);
+	cntxt = t->cntxt;
+	MT_lock_unset(&dataflowLock);
+	if ((cntxt && !DFLOWavailable(cntxt) && !ATOMIC_GET(exiting, exitingLock)) ||
+		!ATOMIC_CAS(t->sleeping, 1, 0, dequeLock))
+		/* nothing to do, or a wakeup is on its way */
+		MT_sema_down(&t->wake);
+}
+
+/*
+ * Memory admission.  Before an instruction runs, the memory it may
+ * need is reserved in the memorypool.  The estimate is a row for each
+ * row of its largest BAT argument, in the width of the result types,
+ * which bounds the result of selections, projections and most
+ * calculations.  Joins and groupings may produce more, but their
+ * actual results show up in the memory accounting of GDK
+ * (GDKmem_cursize) as soon as they are produced, so the next decision
+ * is based on what is really allocated.
+ * The full estimate is reserved, also for instructions that garbage
+ * collect their arguments, as the arguments are only released after
+ * the result has been produced.
+ *
+ * An instruction that would take the memory in use beyond the budget
+ * (GDK_mem_maxsize) is parked, and the worker looks for other work.
+ * Whenever an admitted instruction finishes, the parked ones that fit
+ * again are resumed, those of the oldest query first and within a
+ * query those that free the most memory, so that a running query is
+ * not starved by the ones started after it.  An instruction of a
+ * younger query is also parked when an older one is waiting.  When
+ * nothing is running, nothing can free memory either, so the oldest
+ * parked instruction is admitted regardless (forced), which
+ * guarantees progress.
+ * Instructions without BAT arguments are never held back.
+ */
+static int
+DFLOWadmitted(FlowEvent fe)
+{
+	return (lng) GDKmem_cursize() + memorypool + fe->maxclaim <= (lng) GDK_mem_maxsize;
+}
 
-#ifdef USE_MAL_ADMISSION
+/* called with the admissionLock held */
 static void
-q_requeue_(Queue *q, FlowEvent d)
+DFLOWreserve(FlowEvent fe, int force)
 {
-	int i;
+	fe->admitted = 1;
+	memorypool += fe->maxclaim;
+	memoryclaims++;
+	admitted++;
+	if (force)
+		forced++;
+}
 
-	assert(q);
-	assert(d);
-	if (q->last == q->size) {
-		/* enlarge buffer */
-		q->size <<= 1;
-		q->data = (FlowEvent*) GDKrealloc(q->data, sizeof(FlowEvent) * q->size);
-		assert(q->data);
+static void
+DFLOWclaim(FlowEvent fe, InstrPtr p)
+{
+	DataFlow flow = fe->flow;
+	int j, a, width = 0, tpe;
+	bat bid;
+	BAT *b;
+	lng cnt = 0, total = 0, vheap = 0;
+
+	fe->maxclaim = fe->freeclaim = 0;
+	for (j = p->retc; j < p->argc; j++) {
+		a = getArg(p, j);
+		if (isVarConstant(flow->mb, a) || flow->stk->stk[a].vtype != TYPE_bat ||
+			(bid = flow->stk->stk[a].val.bval) == bat_nil || bid == 0 ||
+			(b = BBPquickdesc(abs(bid), FALSE)) == NULL)
+			continue;
+		if ((lng) BATcount(b) > cnt)
+			cnt = (lng) BATcount(b);
+		total += (lng) BATcount(b);
+		if (b->twidth > width)
+			width = b->twidth;
+		if (b->tvheap && (lng) b->tvheap->free > vheap)
+			vheap = (lng) b->tvheap->free;
+		if (getEndScope(flow->mb, a) == fe->pc)
+			fe->freeclaim += getBatFootprint(bid);
+	}
+	if (cnt == 0)
+		return;
+	/* the mat operations glue their arguments together */
+	if (getModuleId(p) && strcmp(getModuleId(p), "mat") == 0)
+		cnt = total;
+	for (j = 0; j < p->retc; j++) {
+		if (!isaBatType(getArgType(flow->mb, p, j)))
+			continue;
+		tpe = getBatType(getArgType(flow->mb, p, j));
+		/* a polymorphic result is as wide as the widest argument */
+		fe->maxclaim += cnt * (tpe == TYPE_any ? width : ATOMsize(tpe));
+		if (tpe == TYPE_any || ATOMvarsized(tpe))
+			fe->maxclaim += vheap;
 	}
-	for (i = q->last; i > 0; i--)
-		q->data[i] = q->data[i - 1];
-	q->data[0] = d;
-	q->last++;
 }
-static void
-q_requeue(Queue *q, FlowEvent d)
+
+/* an older flow waits for memory, called with the admissionLock held */
+static int
+DFLOWolder(FlowEvent fe)
 {
-	assert(q);
-	assert(d);
-	MT_lock_set(&q->l);
-	q_requeue_(q, d);
-	MT_lock_unset(&q->l);
-	MT_sema_up(&q->s);
+	FlowEvent f;
+
+	for (f = parked; f; f = f->next)
+		if (f->flow->started < fe->flow->started)
+			return 1;
+	return 0;
 }
-#endif
 
-static FlowEvent
-q_dequeue(Queue *q, Client cntxt)
-{
-	FlowEvent r = NULL, s = NULL;
-	//int i;
-
-	assert(q);
-	MT_sema_down(&q->s);
-	if (ATOMIC_GET(exiting, exitingLock))
-		return NULL;
-	MT_lock_set(&q->l);
-	if (cntxt) {
-		int i, minpc = -1;
-
-		for (i = q->last - 1; i >= 0; i--) {
-			if (q->data[i]->flow->cntxt == cntxt) {
-				if(minpc < 0){
-					minpc = i;
-					s = q->data[i];
-				}
-				r = q->data[i];
-				if( s && r && s->pc > r->pc){
-					minpc = i;
-					s = r;
-				}
-			}
-		}
-		if( minpc >= 0){
-			r = q->data[minpc];
-			i = minpc;
-			q->last--;
-			while (i < q->last) {
-				q->data[i] = q->data[i + 1];
-				i++;
-			}
-		} else r = NULL;
-
-		MT_lock_unset(&q->l);
-		return r;
-	}
-	if (q->exitcount > 0) {
-		q->exitcount--;
-		MT_lock_unset(&q->l);
-		return NULL;
-	}
-	assert(q->last > 0);
-	if (q->last > 0) {
-		/* LIFO favors garbage collection */
-		r = q->data[--q->last];
-/*  Line coverage test shows it is an expensive loop that is hardly ever leads to adjustment
-		for(i= q->last-1; r &&  i>=0; i--){
-			s= q->data[i];
-			if( s && s->flow && s->flow->stk &&
-			    r && r->flow && r->flow->stk &&
-			    s->flow->stk->tag < r->flow->stk->tag){
-				q->data[i]= r;
-				r = s;
-			}
-		}
-*/
-		q->data[q->last] = 0;
+static int
+DFLOWadmit(FlowEvent fe)
+{
+	int force;
+
+	DFLOWclaim(fe, getInstrPtr(fe->flow->mb, fe->pc));
+	if (fe->maxclaim == 0) {
+		fe->admitted = 0;
+		return 1;
 	}
-	/* else: terminating */
-	/* try out random draw *
-	{
-		int i;
-		i = rand() % q->last;
-		r = q->data[i];
-		for (i++; i < q->last; i++)
-			q->data[i - 1] = q->data[i];
-		q->last--; i
+	MT_lock_set(&admissionLock);
+	force = memoryclaims == 0;
+	if (force || (DFLOWadmitted(fe) && !DFLOWolder(fe))) {
+		DFLOWreserve(fe, force && !DFLOWadmitted(fe));
+		MT_lock_unset(&admissionLock);
+		return 1;
+	}
+	fe->next = parked;
+	parked = fe;
+	deferred++;
+	MT_lock_unset(&admissionLock);
+	PARDEBUG fprintf(stderr, "#park pc= %d claim= " LLFMT " frees= " LLFMT " pool= " LLFMT " in use= " SZFMT "\n",
+					 fe->pc, fe->maxclaim, fe->freeclaim, memorypool, GDKmem_cursize());
+	return 0;
+}
+
+/*
+ * Return the reservation of an admitted instruction and resume the
+ * parked ones that fit now.  They are queued with worker t.
+ */
+static void
+DFLOWdischarge(struct worker *t, FlowEvent fe)
+{
+	FlowEvent *prev, *best, resumed = NULL, f;
+	int force;
+
+	MT_lock_set(&admissionLock);
+	if (fe->admitted) {
+		fe->admitted = 0;
+		memorypool -= fe->maxclaim;
+		memoryclaims--;
 	}
-	 */
+	while (parked) {
+		best = &parked;
+		for (prev = &parked; *prev; prev = &(*prev)->next)
+			if ((*prev)->flow->started < (*best)->flow->started ||
+				((*prev)->flow->started == (*best)->flow->started &&
+				 (*prev)->freeclaim > (*best)->freeclaim))
+				best = prev;
+		f = *best;
+		force = memoryclaims == 0 && !DFLOWadmitted(f);
+		if (!force && !DFLOWadmitted(f))
+			break;
+		*best = f->next;
+		DFLOWreserve(f, force);
+		f->next = resumed;
+		resumed = f;
+	}
+	MT_lock_unset(&admissionLock);
+	while ((f = resumed) != NULL) {
+		struct worker *w = f->flow->worker;
+
+		resumed = f->next;
+		PARDEBUG fprintf(stderr, "#resume pc= %d claim= " LLFMT " frees= " LLFMT "\n",
+						 f->pc, f->maxclaim, f->freeclaim);
+		dq_push(&t->todo, f);
+		DFLOWsignal(w);
+	}
+}
 
-	MT_lock_unset(&q->l);
-	assert(r);
-	return r;
+/* what the results of an instruction actually occupy */
+static lng
+DFLOWfootprint(FlowEvent fe, InstrPtr p)
+{
+	MalStkPtr stk = fe->flow->stk;
+	lng size = 0;
+	int i;
+
+	for (i = 0; i < p->retc; i++)
+		if (stk->stk[getArg(p, i)].vtype == TYPE_bat)
+			size += getBatFootprint(stk->stk[getArg(p, i)].val.bval);
+	return size;
 }
 
 /*
@@ -305,17 +669,8 @@ q_dequeue(Queue *q, Client cntxt)
  * Beware, we assume that variables are assigned a value once, otherwise
  * the order may really create errors.
  * The order of the instructions should be retained as long as possible.
- * Delay processing when we run out of memory.  Push the instruction back
- * on the end of queue, waiting for another attempt. Problem might become
- * that all threads but one are cycling through the queue, each time
- * finding an eligible instruction, but without enough space.
- * Therefore, we wait for a few milliseconds as an initial punishment.
- *
- * The process could be refined by checking for cheap operations,
- * i.e. those that would require no memory at all (aggr.count)
- * This, however, would lead to a dependency to the upper layers,
- * because in the kernel we don't know what routines are available
- * with this property. Nor do we maintain such properties.
+ * Memory admission may hold an instruction back, it is then parked
+ * until another one finishes, the worker does not wait for it.
  */
 
 static void
@@ -327,11 +682,15 @@ DFLOWworker(void *T)
 	int id = (int) (t - workers);
 	Thread thr;
 	str error = 0;
-	int i,last;
+	int i,h,last,queued;
 	Client cntxt;
 	InstrPtr p;
 
 	thr = THRnew("DFLOWworker");
+	tidworker[thr->tid] = id + 1;
+	/* keep to the memory of our node, the kernel picks the core */
+	if (nrnodes > 1)
+		(void) MT_bind_thread_node(t->node);
 
 #ifdef _MSC_VER
 	srand((unsigned int) GDKusec());
@@ -341,32 +700,31 @@ DFLOWworker(void *T)
 		fprintf(stderr,"DFLOWworker:Could not allocate GDKerrbuf\n");
 	else
 		GDKclrerr();
-	MT_lock_set(&dataflowLock);
-	cntxt = t->cntxt;
-	MT_lock_unset(&dataflowLock);
-	if (cntxt) {
-		/* wait until we are allowed to start working */
-		MT_sema_down(&t->s);
-	}
+	/* wait until we are allowed to start working, a new worker
+	 * for a client gets its deque filled first */
+	MT_sema_down(&t->s);
 	while (1) {
 		if (fnxt == 0) {
-			MT_lock_set(&dataflowLock);
-			cntxt = t->cntxt;
-			MT_lock_unset(&dataflowLock);
-			fe = q_dequeue(todo, cntxt);
+			fe = dq_pop(&t->todo);
 			if (fe == NULL) {
-				if (cntxt) {
-					/* we're not done yet with work for the current
-					 * client (as far as we know), so give up the CPU
-					 * and let the scheduler enter some more work, but
-					 * first compensate for the down we did in
-					 * dequeue */
-					MT_sema_up(&todo->s);
-					MT_sleep_ms(1);
-					continue;
-				}
-				/* no more work to be done: exit */
-				break;
+				MT_lock_set(&dataflowLock);
+				cntxt = t->cntxt;
+				MT_lock_unset(&dataflowLock);
+				if (t->inbox)
+					fe = list_take(&t->inbox, &t->inboxLock, cntxt);
+			}
+			if (fe == NULL) {
+				/* a generic worker only leaves with an empty deque */
+				if (cntxt == NULL && DFLOWexitrequest())
+					break;
+				/* a client specific worker only helps its client */
+				fe = DFLOWsteal(t, cntxt);
+			}
+			if (fe == NULL) {
+				if (ATOMIC_GET(exiting, exitingLock))
+					break;
+				DFLOWsleep(t, cntxt);
+				continue;
 			}
 		} else
 			fe = fnxt;
@@ -378,44 +736,40 @@ DFLOWworker(void *T)
 		flow = fe->flow;
 		assert(flow);
 
-		/* whenever we have a (concurrent) error, skip it */
-		MT_lock_set(&flow->flowlock);
-		if (flow->error) {
-			MT_lock_unset(&flow->flowlock);
-			q_enqueue(flow->done, fe);
+		/* resumed instructions are admitted already */
+		if (flow->error == NULL && !fe->admitted && !DFLOWadmit(fe))
 			continue;
+		fe->hotclaim = 0;
+		/* whenever we have a (concurrent) error, skip it, the error
+		 * is set only once, so it can be inspected without the lock */
+		if (flow->error) {
+			error = MAL_SUCCEED;
+		} else if (INTERRUPTED(&flow->cntxt->qinterrupt)) {
+			/* an interrupted, timed out or oversized query skips its
+			 * remaining instructions, the kernel polls the same record */
+			error = MALinterrupted(flow->cntxt);
+		} else {
+			p = getInstrPtr(flow->mb, fe->pc);
+			DFLOWlocality(t, flow->mb, p);
+			THRset_interrupt(thr, &flow->cntxt->qinterrupt);
+			/* parallel kernel operations only take the cores
+			 * of idle workers */
+			GDKbusy(1);
+			error = runMALsequence(flow->cntxt, flow->mb, fe->pc, fe->pc + 1, flow->stk, 0, 0);
+			GDKbusy(-1);
+			THRset_interrupt(thr, NULL);
+			if (error == MAL_SUCCEED)
+				fe->hotclaim = DFLOWfootprint(fe, p);
+			/* update the numa information. keep the thread-id producing the value */
+			for( i = 0; i < p->argc; i++)
+				setVarWorker(flow->mb,getArg(p,i),thr->tid);
 		}
-		MT_lock_unset(&flow->flowlock);
-
-#ifdef USE_MAL_ADMISSION
-		if (MALrunningThreads() > 2 && MALadmission(fe->argclaim, fe->hotclaim)) {
-			// never block on deblockdataflow()
-			p= getInstrPtr(flow->mb,fe->pc);
-			if( p->fcn != (MALfcn) deblockdataflow){
-				fe->hotclaim = 0;   /* don't assume priority anymore */
-				fe->maxclaim = 0;
-				if (todo->last == 0)
-					MT_sleep_ms(DELAYUNIT);
-				q_requeue(todo, fe);
-				continue;
-			}
-		}
-#endif
-		error = runMALsequence(flow->cntxt, flow->mb, fe->pc, fe->pc + 1, flow->stk, 0, 0);
 		PARDEBUG fprintf(stderr, "#executed pc= %d wrk= %d claim= " LLFMT "," LLFMT "," LLFMT " %s\n",
-						 fe->pc, id, fe->argclaim, fe->hotclaim, fe->maxclaim, error ? error : "");
-#ifdef USE_MAL_ADMISSION
-		/* release the memory claim */
-		MALadmission(-fe->argclaim, -fe->hotclaim);
-#endif
-		/* update the numa information. keep the thread-id producing the value */
-		p= getInstrPtr(flow->mb,fe->pc);
-		for( i = 0; i < p->argc; i++)
-			setVarWorker(flow->mb,getArg(p,i),thr->tid);
+						 fe->pc, id, fe->maxclaim, fe->hotclaim, fe->freeclaim, error ? error : "");
+		if (fe->admitted || parked)
+			DFLOWdischarge(t, fe);
 
-		MT_lock_set(&flow->flowlock);
 		fe->state = DFLOWwrapup;
-		MT_lock_unset(&flow->flowlock);
 		if (error) {
 			MT_lock_set(&flow->flowlock);
 			/* only collect one error (from one thread, needed for stable testing) */
@@ -424,53 +778,40 @@ DFLOWworker(void *T)
 			else
 				GDKfree(error);
 			MT_lock_unset(&flow->flowlock);
-			/* after an error we skip the rest of the block */
-			q_enqueue(flow->done, fe);
-			continue;
+			/* after an error the rest of the block is skipped */
 		}
 
-		/* see if you can find an eligible instruction that uses the
-		 * result just produced. Then we can continue with it right away.
-		 * We are just looking forward for the last block, which means we
-		 * are safe from concurrent actions. No other thread can steal it,
-		 * because we hold the logical lock.
-		 * All eligible instructions are queued
+		/* Reduce the blocked counter for all dependent instructions.
+		 * The one that drops it to zero makes the instruction eligible.
+		 * Those at home elsewhere are routed to that worker, we
+		 * continue right away with the first of the others and queue
+		 * the rest in our own deque.
 		 */
-#ifdef USE_MAL_ADMISSION
-	{
-		InstrPtr p = getInstrPtr(flow->mb, fe->pc);
-		assert(p);
-		fe->hotclaim = 0;
-		fe->maxclaim = 0;
-
-		for (i = 0; i < p->retc; i++){
-			lng footprint;
-			footprint = getMemoryClaim(flow->mb, flow->stk, p, i, FALSE);
-			fe->hotclaim += footprint;
-			if( footprint > fe->maxclaim) fe->maxclaim = footprint;
-		}
-	}
-#endif
-		MT_lock_set(&flow->flowlock);
-
-		for (last = fe->pc - flow->start; last >= 0 && (i = flow->nodes[last]) > 0; last = flow->edges[last])
-			if (flow->status[i].state == DFLOWpending &&
-				flow->status[i].blocks == 1) {
+		queued = 0;
+		for (last = fe->pc - flow->start; last >= 0 && (i = flow->nodes[last]) > 0; last = flow->edges[last]) {
+			if (ATOMIC_DEC(flow->status[i].blocks, dequeLock) == 0) {
 				flow->status[i].state = DFLOWrunning;
-				flow->status[i].blocks = 0;
-				flow->status[i].hotclaim = fe->hotclaim;
-				flow->status[i].argclaim += fe->hotclaim;
-				if( flow->status[i].maxclaim < fe->maxclaim)
-					flow->status[i].maxclaim = fe->maxclaim;
-				fnxt = flow->status + i;
-				break;
+				h = flow->error ? -1 : DFLOWhome(flow->mb, getInstrPtr(flow->mb, flow->status[i].pc), id);
+				if (h >= 0 && h != id && DFLOWroute(&workers[h], flow->status + i)) {
+					t->routed++;
+					queued++;
+				} else if (fnxt == 0) {
+					fnxt = flow->status + i;
+				} else {
+					dq_push(&t->todo, flow->status + i);
+					queued++;
+				}
 			}
-		MT_lock_unset(&flow->flowlock);
-
-		q_enqueue(flow->done, fe);
+		}
+		if (queued)
+			DFLOWsignal(flow->worker);
+		/* the flow may be gone once its last instruction is handled */
+		if (ATOMIC_DEC(flow->pending, dequeLock) == 0)
+			MT_sema_up(&flow->done);
 	}
 	GDKfree(GDKerrbuf);
 	GDKsetbuf(0);
+	tidworker[thr->tid] = 0;
 	THRdel(thr);
 	MT_lock_set(&dataflowLock);
 	t->flag = EXITED;
@@ -491,40 +832,52 @@ DFLOWinitialize(void)
 	int created = 0;
 
 	MT_lock_set(&mal_contextLock);
-	if (todo) {
+	if (dataflowInitialized) {
 		/* somebody else beat us to it */
 		MT_lock_unset(&mal_contextLock);
 		return 0;
 	}
-	todo = q_create(2048, "todo");
-	if (todo == NULL) {
-		MT_lock_unset(&mal_contextLock);
-		return -1;
-	}
-	for (i = 0; i < THREADS; i++)
+	nrnodes = MT_check_nr_nodes();
+	for (i = 0; i < THREADS; i++) {
 		MT_sema_init(&workers[i].s, 0, "DFLOWinitialize");
+		MT_sema_init(&workers[i].wake, 0, "DFLOWworker");
+		MT_lock_init(&workers[i].inboxLock, "DFLOWinbox");
+		workers[i].node = i % nrnodes;
+	}
+	MT_sema_init(&idle, 0, "DFLOWidle");
 	limit = GDKnr_threads ? GDKnr_threads - 1 : 0;
 #ifdef NEED_MT_LOCK_INIT
 	ATOMIC_INIT(exitingLock);
+	ATOMIC_INIT(dequeLock);
 	MT_lock_init(&dataflowLock, "dataflowLock");
+	MT_lock_init(&overflowLock, "overflowLock");
+	MT_lock_init(&admissionLock, "admissionLock");
 #endif
 	MT_lock_set(&dataflowLock);
+	ATOMIC_SET(topworker, limit, dequeLock);
 	for (i = 0; i < limit; i++) {
 		workers[i].flag = RUNNING;
 		workers[i].cntxt = NULL;
-		if (MT_create_thread(&workers[i].id, DFLOWworker, (void *) &workers[i], MT_THR_JOINABLE) < 0)
+		MT_sema_up(&workers[i].s);
+		if (MT_create_thread(&workers[i].id, DFLOWworker, (void *) &workers[i], MT_THR_JOINABLE) < 0) {
 			workers[i].flag = IDLE;
-		else
+			MT_sema_down(&workers[i].s);
+		} else
 			created++;
 	}
 	MT_lock_unset(&dataflowLock);
 	if (created == 0) {
 		/* no threads created */
-		q_destroy(todo);
-		todo = NULL;
+		for (i = 0; i < THREADS; i++) {
+			MT_sema_destroy(&workers[i].s);
+			MT_sema_destroy(&workers[i].wake);
+			MT_lock_destroy(&workers[i].inboxLock);
+		}
+		MT_sema_destroy(&idle);
 		MT_lock_unset(&mal_contextLock);
 		return -1;
 	}
+	dataflowInitialized = 1;
 	MT_lock_unset(&mal_contextLock);
 	return 0;
 }
@@ -660,7 +1013,7 @@ DFLOWinitBlk(DataFlow flow, MalBlkPtr mb, int size)
 		for (n = 0; n < flow->stop - flow->start; n++) {
 			fprintf(stderr, "#[%d] %d: ", flow->start + n, n);
 			fprintInstruction(stderr, mb, 0, getInstrPtr(mb, n + flow->start), LIST_MAL_ALL);
-			fprintf(stderr, "#[%d]Dependents block count %d wakeup", flow->start + n, flow->status[n].blocks);
+			fprintf(stderr, "#[%d]Dependents block count %d wakeup", flow->start + n, (int) flow->status[n].blocks);
 			for (j = n; flow->edges[j]; j = flow->edges[j]) {
 				fprintf(stderr, "%d ", flow->start + flow->nodes[j]);
 				if (flow->edges[j] == -1)
@@ -669,9 +1022,6 @@ DFLOWinitBlk(DataFlow flow, MalBlkPtr mb, int size)
 			fprintf(stderr, "\n");
 		}
 	}
-#ifdef USE_MAL_ADMISSION
-	memorypool = memoryclaims = 0;
-#endif
 	return MAL_SUCCEED;
 }
 
@@ -693,90 +1043,67 @@ static void showFlowEvent(DataFlow flow, int pc)
 	fprintf(stderr, "#end of data flow %d done %d \n", pc, flow->stop - flow->start);
 	for (i = 0; i < flow->stop - flow->start; i++)
 		if (fe[i].state != DFLOWwrapup && fe[i].pc >= 0) {
-			fprintf(stderr, "#missed pc %d status %d %d  blocks %d", fe[i].state, i, fe[i].pc, fe[i].blocks);
+			fprintf(stderr, "#missed pc %d status %d %d  blocks %d", fe[i].state, i, fe[i].pc, (int) fe[i].blocks);
 			printInstruction(GDKstdout, fe[i].flow->mb, 0, getInstrPtr(fe[i].flow->mb, fe[i].pc), LIST_MAL_MAPI);
 		}
 }
 */
 
+/* a client specific worker that never gets to work is set free */
+static void
+DFLOWrelease(struct worker *w)
+{
+	MT_lock_set(&dataflowLock);
+	w->cntxt = NULL;
+	MT_lock_unset(&dataflowLock);
+	MT_sema_up(&w->s);
+}
+
 static str
 DFLOWscheduler(DataFlow flow, struct worker *w)
 {
-	int last;
 	int i;
-#ifdef USE_MAL_ADMISSION
-	int j;
-	InstrPtr p;
-#endif
-	int tasks=0, actions;
+	int actions;
 	str ret = MAL_SUCCEED;
-	FlowEvent fe, f = 0;
+	FlowEvent fe;
 
 	if (flow == NULL)
 		throw(MAL, "dataflow", "DFLOWscheduler(): Called with flow == NULL");
 	actions = flow->stop - flow->start;
-	if (actions == 0)
+	if (actions == 0) {
+		DFLOWrelease(w);
 		throw(MAL, "dataflow", "Empty dataflow block");
-	/* initialize the eligible statements */
+	}
+	ATOMIC_SET(flow->pending, actions, dequeLock);
+	/* initialize the eligible statements, they are queued at the
+	 * client specific worker, which has not started yet, so for now
+	 * we act as the owner of its deque */
 	fe = flow->status;
 
-	MT_lock_set(&flow->flowlock);
 	for (i = 0; i < actions; i++)
 		if (fe[i].blocks == 0) {
-#ifdef USE_MAL_ADMISSION
-			p = getInstrPtr(flow->mb,fe[i].pc);
-			if (p == NULL) {
-				MT_lock_unset(&flow->flowlock);
-				throw(MAL, "dataflow", "DFLOWscheduler(): getInstrPtr(flow->mb,fe[i].pc) returned NULL");
-			}
-			for (j = p->retc; j < p->argc; j++)
-				fe[i].argclaim = getMemoryClaim(fe[0].flow->mb, fe[0].flow->stk, p, j, FALSE);
-#endif
-			q_enqueue(todo, flow->status + i);
-			flow->status[i].state = DFLOWrunning;
-			PARDEBUG fprintf(stderr, "#enqueue pc=%d claim=" LLFMT "\n", flow->status[i].pc, flow->status[i].argclaim);
+			fe[i].state = DFLOWrunning;
+			dq_push(&w->todo, fe + i);
+			PARDEBUG fprintf(stderr, "#enqueue pc=%d\n", fe[i].pc);
 		}
-	MT_lock_unset(&flow->flowlock);
 	MT_sema_up(&w->s);
+	if (ATOMIC_GET(sleepers, dequeLock) > 0)
+		MT_sema_up(&idle);
 
 	PARDEBUG fprintf(stderr, "#run %d instructions in dataflow block\n", actions);
 
-	while (actions != tasks ) {
-		f = q_dequeue(flow->done, NULL);
-		if (ATOMIC_GET(exiting, exitingLock))
-			break;
-		if (f == NULL)
-			throw(MAL, "dataflow", "DFLOWscheduler(): q_dequeue(flow->done) returned NULL");
+	/* the workers resolve the dependencies among themselves, we are
+	 * only told when the last instruction is handled */
+	MT_sema_down(&flow->done);
 
-		/*
-		 * When an instruction is finished we have to reduce the blocked
-		 * counter for all dependent instructions.  for those where it
-		 * drops to zero we can scheduler it we do it here instead of the scheduler
-		 */
-
-		MT_lock_set(&flow->flowlock);
-		tasks++;
-		for (last = f->pc - flow->start; last >= 0 && (i = flow->nodes[last]) > 0; last = flow->edges[last])
-			if (flow->status[i].state == DFLOWpending) {
-				flow->status[i].argclaim += f->hotclaim;
-				if (flow->status[i].blocks == 1 ) {
-					flow->status[i].state = DFLOWrunning;
-					flow->status[i].blocks--;
-					q_enqueue(todo, flow->status + i);
-					PARDEBUG fprintf(stderr, "#enqueue pc=%d claim= " LLFMT "\n", flow->status[i].pc, flow->status[i].argclaim);
-				} else {
-					flow->status[i].blocks--;
-				}
-			}
-		MT_lock_unset(&flow->flowlock);
-	}
 	/* release the worker from its specific task (turn it into a
 	 * generic worker) */
 	MT_lock_set(&dataflowLock);
 	w->cntxt = NULL;
 	MT_lock_unset(&dataflowLock);
+	if (ATOMIC_CAS(w->sleeping, 1, 0, dequeLock))
+		MT_sema_up(&w->wake);
 	/* wrap up errors */
-	assert(flow->done->last == 0);
 	if (flow->error ) {
 		PARDEBUG fprintf(stderr, "#errors encountered %s ", flow->error ? flow->error : "unknown");
 		ret = flow->error;
@@ -825,7 +1152,7 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 	assert(stoppc > startpc);
 
 	/* check existence of workers */
-	if (todo == NULL) {
+	if (!dataflowInitialized) {
 		/* create thread pool */
 		if (GDKnr_threads <= 1 || DFLOWinitialize() < 0) {
 			/* no threads created, run serially */
@@ -833,7 +1160,7 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 			return MAL_SUCCEED;
 		}
 	}
-	assert(todo);
+	assert(dataflowInitialized);
 	/* in addition, create one more worker that will only execute
 	 * tasks for the current client to compensate for our waiting
 	 * until all work is done */
@@ -878,6 +1205,8 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 				workers[i].cntxt = cntxt;
 			}
 			workers[i].flag = RUNNING;
+			if (i >= ATOMIC_GET(topworker, dequeLock))
+				ATOMIC_SET(topworker, i + 1, dequeLock);
 			if (MT_create_thread(&workers[i].id, DFLOWworker, (void *) &workers[i], MT_THR_JOINABLE) < 0) {
 				/* cannot start new thread, run serially */
 				*ret = TRUE;
@@ -896,69 +1225,51 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 	}
 
 	flow = (DataFlow)GDKzalloc(sizeof(DataFlowRec));
-	if (flow == NULL)
+	if (flow == NULL) {
+		DFLOWrelease(&workers[i]);
 		throw(MAL, "dataflow", MAL_MALLOC_FAIL);
+	}
 
 	flow->cntxt = cntxt;
 	flow->mb = mb;
 	flow->stk = stk;
 	flow->error = 0;
+	flow->worker = &workers[i];
+	flow->started = cntxt->qstart;
 
 	/* keep real block count, exclude brackets */
 	flow->start = startpc + 1;
 	flow->stop = stoppc;
 
 	MT_lock_init(&flow->flowlock, "flow->flowlock");
-	flow->done = q_create(stoppc- startpc+1, "flow->done");
-	if (flow->done == NULL) {
-		MT_lock_destroy(&flow->flowlock);
-		GDKfree(flow);
-		throw(MAL, "dataflow", "runMALdataflow(): Failed to create flow->done queue");
-	}
+	MT_sema_init(&flow->done, 0, "flow->done");
 
 	flow->status = (FlowEvent)GDKzalloc((stoppc - startpc + 1) * sizeof(FlowEventRec));
-	if (flow->status == NULL) {
-		q_destroy(flow->done);
-		MT_lock_destroy(&flow->flowlock);
-		GDKfree(flow);
-		throw(MAL, "dataflow", MAL_MALLOC_FAIL);
-	}
 	size = DFLOWgraphSize(mb, startpc, stoppc);
 	size += stoppc - startpc;
 	flow->nodes = (int*)GDKzalloc(sizeof(int) * size);
-	if (flow->nodes == NULL) {
-		GDKfree(flow->status);
-		q_destroy(flow->done);
-		MT_lock_destroy(&flow->flowlock);
-		GDKfree(flow);
-		throw(MAL, "dataflow", MAL_MALLOC_FAIL);
-	}
 	flow->edges = (int*)GDKzalloc(sizeof(int) * size);
-	if (flow->edges == NULL) {
-		GDKfree(flow->nodes);
-		GDKfree(flow->status);
-		q_destroy(flow->done);
-		MT_lock_destroy(&flow->flowlock);
-		GDKfree(flow);
-		throw(MAL, "dataflow", MAL_MALLOC_FAIL);
-	}
-	msg = DFLOWinitBlk(flow, mb, size);
+	if (flow->status == NULL || flow->nodes == NULL || flow->edges == NULL)
+		msg = createException(MAL, "dataflow", MAL_MALLOC_FAIL);
+	else
+		msg = DFLOWinitBlk(flow, mb, size);
 
 	if (msg == MAL_SUCCEED)
 		msg = DFLOWscheduler(flow, &workers[i]);
+	else
+		DFLOWrelease(&workers[i]);
 
 	GDKfree(flow->status);
 	GDKfree(flow->edges);
 	GDKfree(flow->nodes);
-	q_destroy(flow->done);
+	MT_sema_destroy(&flow->done);
 	MT_lock_destroy(&flow->flowlock);
 	GDKfree(flow);
 
 	/* we created one worker, now tell one worker to exit again */
-	MT_lock_set(&todo->l);
-	todo->exitcount++;
-	MT_lock_unset(&todo->l);
-	MT_sema_up(&todo->s);
+	ATOMIC_INC(exitcount, dequeLock);
+	if (ATOMIC_GET(sleepers, dequeLock) > 0)
+		MT_sema_up(&idle);
 
 	return msg;
 }
@@ -980,9 +1291,12 @@ stopMALdataflow(void)
 	int i;
 
 	ATOMIC_SET(exiting, 1, exitingLock);
-	if (todo) {
-		for (i = 0; i < THREADS; i++)
-			MT_sema_up(&todo->s);
+	if (dataflowInitialized) {
+		for (i = 0; i < THREADS; i++) {
+			MT_sema_up(&idle);
+			if (ATOMIC_CAS(workers[i].sleeping, 1, 0, dequeLock))
+				MT_sema_up(&workers[i].wake);
+		}
 		MT_lock_set(&dataflowLock);
 		for (i = 0; i < THREADS; i++) {
 			if (workers[i].flag != IDLE && workers[i].flag != JOINING) {
@@ -996,3 +1310,27 @@ stopMALdataflow(void)
 		MT_lock_unset(&dataflowLock);
 	}
 }
+
+void
+getDataflowStats(DataflowStats *s)
+{
+	int i;
+
+	memset(s, 0, sizeof(*s));
+	s->nodes = nrnodes;
+	if (!dataflowInitialized)
+		return;
+	for (i = 0; i < THREADS; i++) {
+		s->executed += workers[i].executed;
+		s->corelocal += workers[i].corelocal;
+		s->nodelocal += workers[i].nodelocal;
+		s->remote += workers[i].remote;
+		s->routed += workers[i].routed;
+		s->stolen += workers[i].stolen;
+	}
+	MT_lock_set(&admissionLock);
+	s->admitted = admitted;
+	s->deferred = deferred;
+	s->forced = forced;
+	MT_lock_unset(&admissionLock);
+}
@@ -17,4 +17,20 @@ mal_export str deblockdataflow(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrP
 mal_export void stopMALdataflow(void);
 mal_export void mal_dataflow_reset(void);
 
+/* locality and memory admission of the dataflow workers, accumulated since startup */
+typedef struct {
+	lng executed;	/* instructions run by the workers */
+	lng corelocal;	/* whose BAT arguments were last touched by the same worker */
+	lng nodelocal;	/* ... by workers on the same NUMA node */
+	lng remote;		/* ... by a worker on another node */
+	lng routed;		/* handed to the worker that touched their arguments */
+	lng stolen;		/* taken from the queue of another worker */
+	lng admitted;	/* instructions that reserved memory before running */
+	lng deferred;	/* parked for lack of memory */
+	lng forced;		/* admitted beyond the budget, nothing else was running */
+	int nodes;		/* NUMA nodes the workers are bound to */
+} DataflowStats;
+
+mal_export void getDataflowStats(DataflowStats *s);
+
 #endif /*  _MAL_DATAFLOW_H*/
@@ -84,6 +84,8 @@
 #define RUNTIME_OBJECT_UNDEFINED "Object not found"
 #define RUNTIME_UNKNOWN_INSTRUCTION "Instruction type not supported"
 #define RUNTIME_QRY_TIMEOUT "Query aborted due to timeout"
+#define RUNTIME_QRY_INTERRUPT "Query aborted due to interrupt"
+#define RUNTIME_QRY_MEMORY "Query aborted due to exceeding its memory budget"
 #define RUNTIME_SESSION_TIMEOUT "Query aborted due to session timeout"
 #define OPERATION_FAILED "operation failed"
 
@@ -454,6 +454,69 @@ callMAL(Client cntxt, MalBlkPtr mb, MalStkPtr *env, ValPtr argv[], char debug)
 	return ret;
 }
 
+/*
+ * A query is aborted between instructions when it was interrupted,
+ * passed its deadline, or holds more intermediates than its memory
+ * budget allows.  The footprint is an estimate: the heaps of the BATs
+ * an instruction produced are claimed, and those of the BATs garbage
+ * collected after it are released again.  Views, and columns that are
+ * also referenced by the store, are not owned by the query and are
+ * left out.
+ */
+str
+MALinterrupted(Client cntxt)
+{
+	Interrupt *q = &cntxt->qinterrupt;
+
+	if (q->stop)
+		throw(MAL, "mal.interpreter", RUNTIME_QRY_INTERRUPT);
+	if (q->maxmem && q->memclaim > q->maxmem)
+		throw(MAL, "mal.interpreter", RUNTIME_QRY_MEMORY);
+	if (q->deadline && GDKusec() > q->deadline)
+		throw(MAL, "mal.interpreter", RUNTIME_QRY_TIMEOUT);
+	return MAL_SUCCEED;
+}
+
+lng
+getBatFootprint(bat bid)
+{
+	BAT *b;
+	lng size;
+
+	if (bid == bat_nil || bid <= 0 || (b = BBPquickdesc(bid, FALSE)) == NULL)
+		return 0;
+	/* the stack holds the only logical reference to an intermediate */
+	if (isVIEW(b) || b->batPersistence == PERSISTENT || BBP_lrefs(bid) != 1)
+		return 0;
+	size = (lng) b->theap.size;
+	if (b->tvheap)
+		size += (lng) b->tvheap->size;
+	return size;
+}
+
+static void
+updateMemoryClaim(Client cntxt, MalStkPtr stk, InstrPtr pci, int *garbage)
+{
+	lng claim = 0;
+	int i;
+
+	if (pci->token == PATcall || pci->token == CMDcall)
+		for (i = 0; i < pci->retc; i++)
+			if (stk->stk[getArg(pci, i)].vtype == TYPE_bat)
+				claim += getBatFootprint(stk->stk[getArg(pci, i)].val.bval);
+	if (garbageControl(pci))
+		for (i = 0; i < pci->argc; i++)
+			if (garbage[i] >= 0)
+				claim -= getBatFootprint(stk->stk[garbage[i]].val.bval);
+	if (claim == 0)
+		return;
+	MT_lock_set(&mal_contextLock);
+	cntxt->qinterrupt.memclaim += claim;
+	if (cntxt->qinterrupt.memclaim < 0)
+		cntxt->qinterrupt.memclaim = 0;
+	MT_lock_unset(&mal_contextLock);
+}
+
 /*
  * The core of the interpreter is presented next. It takes the context
  * information and starts the interpretation at the designated
@@ -537,6 +600,11 @@ str runMALsequence(Client cntxt, MalBlkPtr mb, int startpc,
 			ret= createException(MAL, "mal.interpreter", "prematurely stopped client");
 			break;
 		}
+		if (INTERRUPTED(&cntxt->qinterrupt)){
+			stkpc = stoppc;
+			ret= MALinterrupted(cntxt);
+			break;
+		}
 		if (cntxt->itrace || mb->trap || stk->status) {
 			if (stk->status == 'p'){
 				// execution is paused
@@ -812,6 +880,9 @@ str runMALsequence(Client cntxt, MalBlkPtr mb, int startpc,
 			}
 
 
+			if (ret == MAL_SUCCEED && cntxt->qinterrupt.maxmem)
+				updateMemoryClaim(cntxt, stk, pci, garbage);
+
 			/* general garbage collection */
 			if (ret == MAL_SUCCEED && garbageControl(pci)) {
 				for (i = 0; i < pci->argc; i++) {
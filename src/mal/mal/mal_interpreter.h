@@ -34,6 +34,7 @@ mal_export void garbageCollector(Client cntxt, MalBlkPtr mb, MalStkPtr stk, int
 mal_export str malCommandCall(MalStkPtr stk, InstrPtr pci);
 mal_export int isNotUsedIn(InstrPtr p, int start, int a);
 mal_export str catchKernelException(Client cntxt, str ret);
+mal_export str MALinterrupted(Client cntxt);
 
 mal_export ptr getArgReference(MalStkPtr stk, InstrPtr pci, int k);
 #if !defined(NDEBUG) && defined(__GNUC__)
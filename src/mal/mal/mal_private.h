@@ -14,6 +14,9 @@
 
 __hidden extern MT_Lock mal_namespaceLock;
 
+/* footprint of an intermediate, 0 if the query does not own it */
+__hidden lng getBatFootprint(bat bid);
+
 extern volatile ATOMIC_TYPE mal_running;
 #ifdef ATOMIC_LOCK
 extern MT_Lock mal_runningLock;
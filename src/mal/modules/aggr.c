@@ -641,6 +641,156 @@ AGGRsubavg2cand_dbl(bat *retval1, bat *retval2, const bat *bid, const bat *gid,
 					   NULL, NULL, "aggr.subavg");
 }
 
+/*
+ * floating point sums and averages merged from exact partial sums,
+ * such that the result does not depend on how the input was split
+ */
+static str
+AGGRpartials(bat *retval1, bat *retval2, bat *retval3, const bat *bid,
+			 const bat *gid, const bat *eid, int skip_nils, const char *malfunc)
+{
+	BAT *b, *g, *e, *pn, *cn, *nn;
+	gdk_return rc;
+
+	b = BATdescriptor(*bid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (b == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	rc = BATgroupsumpartials(&pn, &cn, &nn, b, g, e, NULL, skip_nils);
+	BBPunfix(b->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (rc != GDK_SUCCEED)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	BBPkeepref(*retval1 = pn->batCacheid);
+	BBPkeepref(*retval2 = cn->batCacheid);
+	BBPkeepref(*retval3 = nn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRsumpartials(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bit *skip_nils);
+str
+AGGRsumpartials(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bit *skip_nils)
+{
+	return AGGRpartials(retval1, retval2, retval3, bid, NULL, NULL,
+						*skip_nils, "aggr.sumpartials");
+}
+
+mal_export str AGGRsubsumpartials(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubsumpartials(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRpartials(retval1, retval2, retval3, bid, gid, eid,
+						*skip_nils, "aggr.subsumpartials");
+}
+
+/* the result is returned as BAT in *retval, or as a value in *res if
+ * there are no groups */
+static str
+AGGRmerged(bat *retval, void *res, const bat *pid, const bat *cid, const bat *nid,
+		   const bat *gid, const bat *eid, int skip_nils, int abort_on_error,
+		   int tp, const char *malfunc)
+{
+	BAT *p, *c, *n, *g, *e, *bn;
+
+	p = BATdescriptor(*pid);
+	c = BATdescriptor(*cid);
+	n = nid ? BATdescriptor(*nid) : NULL;
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (p == NULL || c == NULL ||
+		(nid != NULL && n == NULL) ||
+		(gid != NULL && g == NULL) ||
+		(eid != NULL && e == NULL)) {
+		bn = NULL;
+	} else {
+		bn = BATgroupfsum(p, c, n, g, e, tp, skip_nils, abort_on_error);
+	}
+	if (p)
+		BBPunfix(p->batCacheid);
+	if (c)
+		BBPunfix(c->batCacheid);
+	if (n)
+		BBPunfix(n->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (p == NULL || c == NULL ||
+		(nid != NULL && n == NULL) ||
+		(gid != NULL && g == NULL) ||
+		(eid != NULL && e == NULL))
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	if (bn == NULL)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	if (retval) {
+		BBPkeepref(*retval = bn->batCacheid);
+	} else {
+		assert(BATcount(bn) == 1);
+		memcpy(res, Tloc(bn, 0), ATOMsize(tp));
+		BBPunfix(bn->batCacheid);
+	}
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRfsum_flt(flt *res, const bat *pid, const bat *cid);
+str
+AGGRfsum_flt(flt *res, const bat *pid, const bat *cid)
+{
+	return AGGRmerged(NULL, res, pid, cid, NULL, NULL, NULL, 1, 1,
+					  TYPE_flt, "aggr.fsum");
+}
+
+mal_export str AGGRfsum_dbl(dbl *res, const bat *pid, const bat *cid);
+str
+AGGRfsum_dbl(dbl *res, const bat *pid, const bat *cid)
+{
+	return AGGRmerged(NULL, res, pid, cid, NULL, NULL, NULL, 1, 1,
+					  TYPE_dbl, "aggr.fsum");
+}
+
+mal_export str AGGRfavg(dbl *res, const bat *pid, const bat *cid, const bat *nid);
+str
+AGGRfavg(dbl *res, const bat *pid, const bat *cid, const bat *nid)
+{
+	return AGGRmerged(NULL, res, pid, cid, nid, NULL, NULL, 1, 1,
+					  TYPE_dbl, "aggr.favg");
+}
+
+mal_export str AGGRsubfsum_flt(bat *retval, const bat *pid, const bat *cid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
+str
+AGGRsubfsum_flt(bat *retval, const bat *pid, const bat *cid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
+{
+	return AGGRmerged(retval, NULL, pid, cid, NULL, gid, eid, *skip_nils,
+					  *abort_on_error, TYPE_flt, "aggr.subfsum");
+}
+
+mal_export str AGGRsubfsum_dbl(bat *retval, const bat *pid, const bat *cid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
+str
+AGGRsubfsum_dbl(bat *retval, const bat *pid, const bat *cid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
+{
+	return AGGRmerged(retval, NULL, pid, cid, NULL, gid, eid, *skip_nils,
+					  *abort_on_error, TYPE_dbl, "aggr.subfsum");
+}
+
+mal_export str AGGRsubfavg(bat *retval, const bat *pid, const bat *cid, const bat *nid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
+str
+AGGRsubfavg(bat *retval, const bat *pid, const bat *cid, const bat *nid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
+{
+	return AGGRmerged(retval, NULL, pid, cid, nid, gid, eid, *skip_nils,
+					  *abort_on_error, TYPE_dbl, "aggr.subfavg");
+}
+
 mal_export str AGGRsubstdev_dbl(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
 str
 AGGRsubstdev_dbl(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
@@ -871,3 +1021,335 @@ AGGRsubquantilecand(bat *retval, const bat *bid, const bat *quantile, const bat
 					   0, TYPE_any, NULL, NULL, BATgroupquantile,
 					   quantile, "aggr.subquantile");
 }
+
+/*
+ * approximate quantiles, calculated from t-digests: these give a dbl
+ * whatever the type of the input, and can be split by mitosis, which
+ * merges the sketches of the pieces (see subquantilesketch)
+ */
+static str
+AGGRapprox(dbl *res, const bat *bid, const bat *quantile, const char *malfunc)
+{
+	bat tmpid;
+	BAT *bn;
+	str err;
+
+	err = AGGRgrouped(&tmpid, NULL, bid, NULL, NULL, NULL, 1, 0, TYPE_dbl,
+					  quantile ? NULL : BATgroupapproxmedian, NULL,
+					  quantile ? BATgroupapproxquantile : NULL, quantile,
+					  malfunc);
+	if (err != MAL_SUCCEED)
+		return err;
+	if ((bn = BATdescriptor(tmpid)) == NULL) {
+		BBPrelease(tmpid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	*res = BATcount(bn) > 0 ? *(const dbl *) Tloc(bn, 0) : dbl_nil;
+	BBPunfix(tmpid);
+	BBPrelease(tmpid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRapprox_median(dbl *res, const bat *bid);
+str
+AGGRapprox_median(dbl *res, const bat *bid)
+{
+	return AGGRapprox(res, bid, NULL, "aggr.approx_median");
+}
+
+mal_export str AGGRapprox_quantile(dbl *res, const bat *bid, const bat *quantile);
+str
+AGGRapprox_quantile(dbl *res, const bat *bid, const bat *quantile)
+{
+	return AGGRapprox(res, bid, quantile, "aggr.approx_quantile");
+}
+
+mal_export str AGGRsubapprox_median(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubapprox_median(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRgrouped(retval, NULL, bid, gid, eid, NULL, *skip_nils,
+					   0, TYPE_dbl, BATgroupapproxmedian, NULL,
+					   NULL, NULL, "aggr.subapprox_median");
+}
+
+mal_export str AGGRsubapprox_quantile(bat *retval, const bat *bid, const bat *quantile, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubapprox_quantile(bat *retval, const bat *bid, const bat *quantile, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRgrouped(retval, NULL, bid, gid, eid, NULL, *skip_nils,
+					   0, TYPE_dbl, NULL, NULL, BATgroupapproxquantile,
+					   quantile, "aggr.subapprox_quantile");
+}
+
+static str
+AGGRsketch(bat *retval1, bat *retval2, bat *retval3, const bat *bid,
+		   const bat *gid, const bat *eid, int skip_nils, const char *malfunc)
+{
+	BAT *b, *g, *e, *mn, *wn, *cn;
+	gdk_return rc;
+
+	b = BATdescriptor(*bid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (b == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	rc = BATgroupquantilesketch(&mn, &wn, &cn, b, g, e, NULL, skip_nils);
+	BBPunfix(b->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (rc != GDK_SUCCEED)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	BBPkeepref(*retval1 = mn->batCacheid);
+	BBPkeepref(*retval2 = wn->batCacheid);
+	BBPkeepref(*retval3 = cn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRquantilesketch(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bit *skip_nils);
+str
+AGGRquantilesketch(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bit *skip_nils)
+{
+	return AGGRsketch(retval1, retval2, retval3, bid, NULL, NULL,
+					  *skip_nils, "aggr.quantilesketch");
+}
+
+mal_export str AGGRsubquantilesketch(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubquantilesketch(bat *retval1, bat *retval2, bat *retval3, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRsketch(retval1, retval2, retval3, bid, gid, eid,
+					  *skip_nils, "aggr.subquantilesketch");
+}
+
+/* the result is returned as BAT in *retval, or as a value in *res if
+ * there are no groups; without quantile BAT it is the median */
+static str
+AGGRsketchmerged(bat *retval, dbl *res, const bat *mid, const bat *wid,
+				 const bat *cid, const bat *quantile, const bat *gid,
+				 const bat *eid, int skip_nils, const char *malfunc)
+{
+	BAT *m, *w, *c, *q, *g, *e, *bn = NULL;
+	double qvalue = 0.5;
+
+	m = BATdescriptor(*mid);
+	w = BATdescriptor(*wid);
+	c = BATdescriptor(*cid);
+	q = quantile ? BATdescriptor(*quantile) : NULL;
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (m == NULL || w == NULL || c == NULL ||
+		(quantile != NULL && q == NULL) ||
+		(gid != NULL && g == NULL) ||
+		(eid != NULL && e == NULL)) {
+		bn = NULL;
+	} else if (q && BATcount(q) > 0 &&
+			   ((qvalue = ((const dbl *) Tloc(q, 0))[0]) < 0 || qvalue > 1)) {
+		bn = NULL;
+	} else {
+		bn = BATgroupsketchquantile(m, w, c, g, e, qvalue, skip_nils);
+	}
+	if (m)
+		BBPunfix(m->batCacheid);
+	if (w)
+		BBPunfix(w->batCacheid);
+	if (c)
+		BBPunfix(c->batCacheid);
+	if (q)
+		BBPunfix(q->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (m == NULL || w == NULL || c == NULL ||
+		(quantile != NULL && q == NULL) ||
+		(gid != NULL && g == NULL) ||
+		(eid != NULL && e == NULL))
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	if (qvalue < 0 || qvalue > 1)
+		throw(MAL, malfunc,
+			  "quantile value of %f is not in range [0,1]", qvalue);
+	if (bn == NULL)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	if (retval) {
+		BBPkeepref(*retval = bn->batCacheid);
+	} else {
+		*res = BATcount(bn) > 0 ? *(const dbl *) Tloc(bn, 0) : dbl_nil;
+		BBPunfix(bn->batCacheid);
+	}
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRsketchmedian(dbl *res, const bat *mid, const bat *wid, const bat *cid);
+str
+AGGRsketchmedian(dbl *res, const bat *mid, const bat *wid, const bat *cid)
+{
+	return AGGRsketchmerged(NULL, res, mid, wid, cid, NULL, NULL, NULL, 1,
+							"aggr.sketchmedian");
+}
+
+mal_export str AGGRsketchquantile(dbl *res, const bat *mid, const bat *wid, const bat *cid, const bat *quantile);
+str
+AGGRsketchquantile(dbl *res, const bat *mid, const bat *wid, const bat *cid, const bat *quantile)
+{
+	return AGGRsketchmerged(NULL, res, mid, wid, cid, quantile, NULL, NULL, 1,
+							"aggr.sketchquantile");
+}
+
+mal_export str AGGRsubsketchmedian(bat *retval, const bat *mid, const bat *wid, const bat *cid, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubsketchmedian(bat *retval, const bat *mid, const bat *wid, const bat *cid, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRsketchmerged(retval, NULL, mid, wid, cid, NULL, gid, eid,
+							*skip_nils, "aggr.subsketchmedian");
+}
+
+mal_export str AGGRsubsketchquantile(bat *retval, const bat *mid, const bat *wid, const bat *cid, const bat *quantile, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubsketchquantile(bat *retval, const bat *mid, const bat *wid, const bat *cid, const bat *quantile, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRsketchmerged(retval, NULL, mid, wid, cid, quantile, gid, eid,
+							*skip_nils, "aggr.subsketchquantile");
+}
+
+/*
+ * approximate distinct counts, estimated with HyperLogLog sketches:
+ * like the approximate quantiles, these can be split by mitosis, which
+ * merges the sketches of the pieces (see subhllsketch)
+ */
+mal_export str AGGRapprox_count_distinct(lng *res, const bat *bid);
+str
+AGGRapprox_count_distinct(lng *res, const bat *bid)
+{
+	bat tmpid;
+	BAT *bn;
+	str err;
+
+	err = AGGRgrouped(&tmpid, NULL, bid, NULL, NULL, NULL, 1, 0, TYPE_lng,
+					  BATgroupapproxcountdistinct, NULL, NULL, NULL,
+					  "aggr.approx_count_distinct");
+	if (err != MAL_SUCCEED)
+		return err;
+	if ((bn = BATdescriptor(tmpid)) == NULL) {
+		BBPrelease(tmpid);
+		throw(MAL, "aggr.approx_count_distinct", RUNTIME_OBJECT_MISSING);
+	}
+	*res = BATcount(bn) > 0 ? *(const lng *) Tloc(bn, 0) : 0;
+	BBPunfix(tmpid);
+	BBPrelease(tmpid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRsubapprox_count_distinct(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubapprox_count_distinct(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	return AGGRgrouped(retval, NULL, bid, gid, eid, NULL, *skip_nils,
+					   0, TYPE_lng, BATgroupapproxcountdistinct, NULL,
+					   NULL, NULL, "aggr.subapprox_count_distinct");
+}
+
+static str
+AGGRhll(bat *retval, const bat *bid, const bat *gid, const bat *eid,
+		const char *malfunc)
+{
+	BAT *b, *g, *e, *bn;
+
+	b = BATdescriptor(*bid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (b == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	bn = BATgrouphllsketch(b, g, e, NULL);
+	BBPunfix(b->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (bn == NULL)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	BBPkeepref(*retval = bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRhllsketch(bat *retval, const bat *bid);
+str
+AGGRhllsketch(bat *retval, const bat *bid)
+{
+	return AGGRhll(retval, bid, NULL, NULL, "aggr.hllsketch");
+}
+
+mal_export str AGGRsubhllsketch(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils);
+str
+AGGRsubhllsketch(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils)
+{
+	(void) skip_nils;		/* nils are never counted */
+	return AGGRhll(retval, bid, gid, eid, "aggr.subhllsketch");
+}
+
+/* the result is returned as BAT in *retval, or as a value in *res if
+ * there are no groups */
+static str
+AGGRhllmerged(bat *retval, lng *res, const bat *rid, const bat *gid,
+			  const bat *eid, const char *malfunc)
+{
+	BAT *r, *g, *e, *bn;
+
+	r = BATdescriptor(*rid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (r == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (r)
+			BBPunfix(r->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, RUNTIME_OBJECT_MISSING);
+	}
+	bn = BATgrouphllmerge(r, g, e);
+	BBPunfix(r->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (bn == NULL)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	if (retval) {
+		BBPkeepref(*retval = bn->batCacheid);
+	} else {
+		*res = BATcount(bn) > 0 ? *(const lng *) Tloc(bn, 0) : 0;
+		BBPunfix(bn->batCacheid);
+	}
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRhllmerge(lng *res, const bat *rid);
+str
+AGGRhllmerge(lng *res, const bat *rid)
+{
+	return AGGRhllmerged(NULL, res, rid, NULL, NULL, "aggr.hllmerge");
+}
+
+mal_export str AGGRsubhllmerge(bat *retval, const bat *rid, const bat *gid, const bat *eid);
+str
+AGGRsubhllmerge(bat *retval, const bat *rid, const bat *gid, const bat *eid)
+{
+	return AGGRhllmerged(retval, NULL, rid, gid, eid, "aggr.subhllmerge");
+}
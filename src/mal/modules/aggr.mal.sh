@@ -215,6 +215,46 @@ address AGGRsubcountcand
 comment "Grouped count aggregate with candidates list";
 
 
+command sumpartials(b:bat[:flt],skip_nils:bit) (:bat[:dbl],:bat[:lng],:bat[:lng])
+address AGGRsumpartials
+comment "Exact partial sum, to be merged by fsum or favg";
+
+command sumpartials(b:bat[:dbl],skip_nils:bit) (:bat[:dbl],:bat[:lng],:bat[:lng])
+address AGGRsumpartials
+comment "Exact partial sum, to be merged by fsum or favg";
+
+command subsumpartials(b:bat[:flt],g:bat[:oid],e:bat[:any_1],skip_nils:bit) (:bat[:dbl],:bat[:lng],:bat[:lng])
+address AGGRsubsumpartials
+comment "Grouped exact partial sums, to be merged by subfsum or subfavg";
+
+command subsumpartials(b:bat[:dbl],g:bat[:oid],e:bat[:any_1],skip_nils:bit) (:bat[:dbl],:bat[:lng],:bat[:lng])
+address AGGRsubsumpartials
+comment "Grouped exact partial sums, to be merged by subfsum or subfavg";
+
+command fsum(p:bat[:dbl],c:bat[:lng]) :flt
+address AGGRfsum_flt
+comment "Sum of merged exact partial sums";
+
+command fsum(p:bat[:dbl],c:bat[:lng]) :dbl
+address AGGRfsum_dbl
+comment "Sum of merged exact partial sums";
+
+command favg(p:bat[:dbl],c:bat[:lng],n:bat[:lng]) :dbl
+address AGGRfavg
+comment "Average of merged exact partial sums";
+
+command subfsum(p:bat[:dbl],c:bat[:lng],g:bat[:oid],e:bat[:any_1],skip_nils:bit,abort_on_error:bit) :bat[:flt]
+address AGGRsubfsum_flt
+comment "Grouped sum of merged exact partial sums, g maps the groups of c";
+
+command subfsum(p:bat[:dbl],c:bat[:lng],g:bat[:oid],e:bat[:any_1],skip_nils:bit,abort_on_error:bit) :bat[:dbl]
+address AGGRsubfsum_dbl
+comment "Grouped sum of merged exact partial sums, g maps the groups of c";
+
+command subfavg(p:bat[:dbl],c:bat[:lng],n:bat[:lng],g:bat[:oid],e:bat[:any_1],skip_nils:bit,abort_on_error:bit) :bat[:dbl]
+address AGGRsubfavg
+comment "Grouped average of merged exact partial sums, g maps the groups of c";
+
 command median(b:bat[:any_1],g:bat[:oid],e:bat[:any_2]) :bat[:any_1]
 address AGGRmedian3
 comment "Grouped median aggregate";
@@ -258,4 +298,68 @@ command subquantile(b:bat[:any_1],q:bat[:dbl],g:bat[:oid],e:bat[:any_2],s:bat[:o
 address AGGRsubquantilecand
 comment "Grouped median quantile with candidate list";
 
+command approx_median(b:bat[:any_1]) :dbl
+address AGGRapprox_median
+comment "Approximate median aggregate";
+
+command subapprox_median(b:bat[:any_1],g:bat[:oid],e:bat[:any_2],skip_nils:bit) :bat[:dbl]
+address AGGRsubapprox_median
+comment "Grouped approximate median aggregate";
+
+command approx_quantile(b:bat[:any_1],q:bat[:dbl]) :dbl
+address AGGRapprox_quantile
+comment "Approximate quantile aggregate";
+
+command subapprox_quantile(b:bat[:any_1],q:bat[:dbl],g:bat[:oid],e:bat[:any_2],skip_nils:bit) :bat[:dbl]
+address AGGRsubapprox_quantile
+comment "Grouped approximate quantile aggregate";
+
+command quantilesketch(b:bat[:any_1],skip_nils:bit) (:bat[:dbl],:bat[:lng],:bat[:lng])
+address AGGRquantilesketch
+comment "Quantile sketch (centroid means, weights and count), to be merged by sketchmedian or sketchquantile";
+
+command subquantilesketch(b:bat[:any_1],g:bat[:oid],e:bat[:any_2],skip_nils:bit) (:bat[:dbl],:bat[:lng],:bat[:lng])
+address AGGRsubquantilesketch
+comment "Grouped quantile sketches (centroid means, weights and counts), to be merged by subsketchmedian or subsketchquantile";
+
+command sketchmedian(m:bat[:dbl],w:bat[:lng],c:bat[:lng]) :dbl
+address AGGRsketchmedian
+comment "Approximate median of merged quantile sketches";
+
+command sketchquantile(m:bat[:dbl],w:bat[:lng],c:bat[:lng],q:bat[:dbl]) :dbl
+address AGGRsketchquantile
+comment "Approximate quantile of merged quantile sketches";
+
+command subsketchmedian(m:bat[:dbl],w:bat[:lng],c:bat[:lng],g:bat[:oid],e:bat[:any_1],skip_nils:bit) :bat[:dbl]
+address AGGRsubsketchmedian
+comment "Grouped approximate median of merged quantile sketches, g maps the groups of c";
+
+command subsketchquantile(m:bat[:dbl],w:bat[:lng],c:bat[:lng],q:bat[:dbl],g:bat[:oid],e:bat[:any_1],skip_nils:bit) :bat[:dbl]
+address AGGRsubsketchquantile
+comment "Grouped approximate quantile of merged quantile sketches, g maps the groups of c";
+
+command approx_count_distinct(b:bat[:any_1]) :lng
+address AGGRapprox_count_distinct
+comment "Approximate number of distinct non-nil values";
+
+command subapprox_count_distinct(b:bat[:any_1],g:bat[:oid],e:bat[:any_2],skip_nils:bit) :bat[:lng]
+address AGGRsubapprox_count_distinct
+comment "Grouped approximate number of distinct non-nil values";
+
+command hllsketch(b:bat[:any_1]) :bat[:bte]
+address AGGRhllsketch
+comment "HyperLogLog sketch (registers) of the distinct values, to be merged by hllmerge";
+
+command subhllsketch(b:bat[:any_1],g:bat[:oid],e:bat[:any_2],skip_nils:bit) :bat[:bte]
+address AGGRsubhllsketch
+comment "Grouped HyperLogLog sketches (registers of all groups) of the distinct values, to be merged by subhllmerge";
+
+command hllmerge(r:bat[:bte]) :lng
+address AGGRhllmerge
+comment "Approximate number of distinct values of merged HyperLogLog sketches";
+
+command subhllmerge(r:bat[:bte],g:bat[:oid],e:bat[:any_1]) :bat[:lng]
+address AGGRsubhllmerge
+comment "Grouped approximate number of distinct values of merged HyperLogLog sketches, g maps the groups of the sketches";
+
 EOF
@@ -787,6 +787,18 @@ mat_joinNxM(Client cntxt, MalBlkPtr mb, InstrPtr p, matlist_t *ml, int args)
 }
 
 
+/* approximate distinct counts are split into a HyperLogLog sketch per
+ * partition, which the second phase merges */
+static char *
+aggr_phase1(char *aggr)
+{
+	if (aggr == approx_count_distinctRef)
+		return hllsketchRef;
+	if (aggr == subapprox_count_distinctRef)
+		return subhllsketchRef;
+	return aggr;
+}
+
 static char *
 aggr_phase2(char *aggr)
 {
@@ -794,18 +806,158 @@ aggr_phase2(char *aggr)
 		return sumRef;
 	if (aggr == subcountRef || aggr == subavgRef)
 		return subsumRef;
+	if (aggr == approx_count_distinctRef)
+		return hllmergeRef;
+	if (aggr == subapprox_count_distinctRef)
+		return subhllmergeRef;
 	/* min/max/sum/prod and unique are fine */
 	return aggr;
 }
 
+static int
+is_fsum(MalBlkPtr mb, InstrPtr p)
+{
+	int tp = getBatType(getArgType(mb, p, p->retc));
+
+	if (getModuleId(p) != aggrRef || p->retc != 1 || (tp != TYPE_flt && tp != TYPE_dbl))
+		return 0;
+	return getFunctionId(p) == sumRef || getFunctionId(p) == avgRef ||
+	       getFunctionId(p) == subsumRef || getFunctionId(p) == subavgRef;
+}
+
+/* Floating point sums (and the sum underlying avg) are not merged as
+ * per partition results, as rounding would make the outcome depend on
+ * the number of partitions. Each partition produces the exact partial
+ * sums instead, which are merged without loss into the serial result.
+ * For grouped aggregates b, g and e are the mats of the input, groups
+ * and extents, for the ungrouped ones g < 0 and e is ignored. */
+static void
+mat_fsum(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
+{
+	int isAvg = (getFunctionId(p) == avgRef || getFunctionId(p) == subavgRef);
+	int k, j, n = isAvg ? 3 : 2;
+	InstrPtr q, r[3], s;
+
+	for (j = 0; j < n; j++) {
+		r[j] = newInstruction(mb, matRef, packRef);
+		getArg(r[j],0) = newTmpVariable(mb, newBatType(j == 0 ? TYPE_dbl : TYPE_lng));
+	}
+	for(k=1; k< mat[b].mi->argc; k++) {
+		q = newInstruction(mb, aggrRef, g < 0 ? sumpartialsRef : subsumpartialsRef);
+		getArg(q,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+		q = pushReturn(mb, q, newTmpVariable(mb, newBatType(TYPE_lng)));
+		q = pushReturn(mb, q, newTmpVariable(mb, newBatType(TYPE_lng)));
+		q = pushArgument(mb, q, getArg(mat[b].mi,k));
+		if (g < 0) {
+			q = pushBit(mb, q, 1);
+		} else {
+			q = pushArgument(mb, q, getArg(mat[g].mi,k));
+			q = pushArgument(mb, q, getArg(mat[e].mi,k));
+			q = pushArgument(mb, q, getArg(p,4));
+		}
+		pushInstruction(mb,q);
+		for (j = 0; j < n; j++)
+			r[j] = pushArgument(mb, r[j], getArg(q,j));
+	}
+	for (j = 0; j < n; j++)
+		pushInstruction(mb, r[j]);
+
+	if (g < 0)
+		s = newInstruction(mb, aggrRef, isAvg ? favgRef : fsumRef);
+	else
+		s = newInstruction(mb, aggrRef, isAvg ? subfavgRef : subfsumRef);
+	getArg(s,0) = getArg(p,0);
+	for (j = 0; j < n; j++)
+		s = pushArgument(mb, s, getArg(r[j],0));
+	if (g >= 0) {
+		s = pushArgument(mb, s, mat[g].mv);
+		s = pushArgument(mb, s, mat[e].mv);
+		s = pushArgument(mb, s, getArg(p,4));
+		s = pushArgument(mb, s, getArg(p,5));
+	}
+	pushInstruction(mb, s);
+}
+
+/* Approximate quantiles are merged from a sketch of each partition,
+ * the centroids of the t-digests of its groups.  For the ungrouped
+ * aggregates g < 0 and e is ignored.  q is the mat of the quantile
+ * argument, which is the same value for every row; the first value
+ * of every partition is enough to find it.  For the median q < 0. */
+static void
+mat_sketch(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int q, int g, int e)
+{
+	int isQuantile = (getFunctionId(p) == approx_quantileRef || getFunctionId(p) == subapprox_quantileRef);
+	int k, j;
+	InstrPtr r[3], rq = NULL, t, s;
+
+	for (j = 0; j < 3; j++) {
+		r[j] = newInstruction(mb, matRef, packRef);
+		getArg(r[j],0) = newTmpVariable(mb, newBatType(j == 0 ? TYPE_dbl : TYPE_lng));
+	}
+	if (q >= 0) {
+		rq = newInstruction(mb, matRef, packRef);
+		getArg(rq,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+	}
+	for(k=1; k< mat[b].mi->argc; k++) {
+		t = newInstruction(mb, aggrRef, g < 0 ? quantilesketchRef : subquantilesketchRef);
+		getArg(t,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+		t = pushReturn(mb, t, newTmpVariable(mb, newBatType(TYPE_lng)));
+		t = pushReturn(mb, t, newTmpVariable(mb, newBatType(TYPE_lng)));
+		t = pushArgument(mb, t, getArg(mat[b].mi,k));
+		if (g < 0) {
+			t = pushBit(mb, t, 1);
+		} else {
+			t = pushArgument(mb, t, getArg(mat[g].mi,k));
+			t = pushArgument(mb, t, getArg(mat[e].mi,k));
+			t = pushArgument(mb, t, getArg(p,p->argc-1));
+		}
+		pushInstruction(mb,t);
+		for (j = 0; j < 3; j++)
+			r[j] = pushArgument(mb, r[j], getArg(t,j));
+
+		if (q >= 0) {
+			t = newInstruction(mb, algebraRef, sliceRef);
+			getArg(t,0) = newTmpVariable(mb, newBatType(TYPE_dbl));
+			t = pushArgument(mb, t, getArg(mat[q].mi,k));
+			t = pushLng(mb, t, 0);
+			t = pushLng(mb, t, 0);
+			pushInstruction(mb,t);
+			rq = pushArgument(mb, rq, getArg(t,0));
+		}
+	}
+	for (j = 0; j < 3; j++)
+		pushInstruction(mb, r[j]);
+	if (q >= 0)
+		pushInstruction(mb, rq);
+
+	if (g < 0)
+		s = newInstruction(mb, aggrRef, isQuantile ? sketchquantileRef : sketchmedianRef);
+	else
+		s = newInstruction(mb, aggrRef, isQuantile ? subsketchquantileRef : subsketchmedianRef);
+	getArg(s,0) = getArg(p,0);
+	for (j = 0; j < 3; j++)
+		s = pushArgument(mb, s, getArg(r[j],0));
+	if (isQuantile)
+		s = pushArgument(mb, s, q >= 0 ? getArg(rq,0) : getArg(p,2));
+	if (g >= 0) {
+		s = pushArgument(mb, s, mat[g].mv);
+		s = pushArgument(mb, s, mat[e].mv);
+		s = pushArgument(mb, s, getArg(p,p->argc-1));
+	}
+	pushInstruction(mb, s);
+}
+
 static void
 mat_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
 {
 	int tp = getArgType(mb,p,0), k, tp2 = TYPE_lng;
 	int battp = (getModuleId(p)==aggrRef)?newBatType(tp):tp, battp2 = 0;
 	int isAvg = (getFunctionId(p) == avgRef);
+	int isHLL = (getFunctionId(p) == approx_count_distinctRef);
 	InstrPtr r = NULL, s = NULL, q = NULL, u = NULL;
 
+	if (isHLL) /* the partial results are sketches */
+		battp = newBatType(TYPE_bte);
 	/* we pack the partitial result */
 	r = newInstruction(mb, matRef, packRef);
 	getArg(r,0) = newTmpVariable(mb, battp);
@@ -820,8 +972,8 @@ mat_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
 		setModuleId(q,getModuleId(p));
 		if (isAvg)
 			setModuleId(q,batcalcRef);
-		setFunctionId(q,getFunctionId(p));
-		getArg(q,0) = newTmpVariable(mb, tp);
+		setFunctionId(q,aggr_phase1(getFunctionId(p)));
+		getArg(q,0) = newTmpVariable(mb, isHLL ? battp : tp);
 		if (isAvg) 
 			q = pushReturn(mb, q, newTmpVariable(mb, tp2));
 		q = pushArgument(mb,q,getArg(mat[m].mi,k));
@@ -836,7 +988,7 @@ mat_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
 		pushInstruction(mb, u);
 
 	/* Filter empty partitions */
-	if (getModuleId(p) == aggrRef && !isAvg) {
+	if (getModuleId(p) == aggrRef && !isAvg && !isHLL) {
 		s = newInstruction(mb, algebraRef, selectNotNilRef);
 		getArg(s,0) = newTmpVariable(mb, battp);
 		s = pushArgument(mb, s, getArg(r,0));
@@ -980,8 +1132,11 @@ mat_group_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
 	int tp = getArgType(mb,p,0), k, tp2 = 0;
 	char *aggr2 = aggr_phase2(getFunctionId(p));
 	int isAvg = (getFunctionId(p) == subavgRef);
+	int isHLL = (getFunctionId(p) == subapprox_count_distinctRef);
 	InstrPtr ai1 = newInstruction(mb, matRef, packRef), ai10 = NULL, ai2;
 
+	if (isHLL) /* the partial results are sketches */
+		tp = newBatType(TYPE_bte);
 	getArg(ai1,0) = newTmpVariable(mb, tp);
 
 	if (isAvg) { /* counts */
@@ -993,6 +1148,7 @@ mat_group_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
 	for(k=1; k<mat[b].mi->argc; k++) {
 		InstrPtr q = copyInstruction(p);
 
+		setFunctionId(q, aggr_phase1(getFunctionId(p)));
 		getArg(q,0) = newTmpVariable(mb, tp);
 		if (isAvg) {
 			getArg(q,1) = newTmpVariable(mb, tp2);
@@ -1078,8 +1234,9 @@ mat_group_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
 	ai2 = pushArgument(mb, ai2, getArg(ai1, 0));
 	ai2 = pushArgument(mb, ai2, mat[g].mv);
 	ai2 = pushArgument(mb, ai2, mat[e].mv);
-	ai2 = pushBit(mb, ai2, 1); /* skip nils */
-	if (getFunctionId(p) != subminRef && getFunctionId(p) != submaxRef)
+	if (!isHLL)
+		ai2 = pushBit(mb, ai2, 1); /* skip nils */
+	if (!isHLL && getFunctionId(p) != subminRef && getFunctionId(p) != submaxRef)
 		ai2 = pushBit(mb, ai2, 1);
 	pushInstruction(mb, ai2);
 }
@@ -1159,6 +1316,24 @@ mat_group_attr(MalBlkPtr mb, matlist_t *ml, int g, InstrPtr cext, int push )
 	}	
 }
 
+/* The per piece histograms only count the rows of a group within a
+ * piece. Once the groups are packed, the histogram of a finished
+ * grouping is the sum of those counts over the final groups.
+ */
+static void
+mat_group_cnt(MalBlkPtr mb, InstrPtr p, InstrPtr r2)
+{
+	InstrPtr q = newInstruction(mb, aggrRef, subsumRef);
+
+	getArg(q,0) = getArg(p,2);
+	q = pushArgument(mb, q, getArg(r2,0));
+	q = pushArgument(mb, q, getArg(p,0));
+	q = pushArgument(mb, q, getArg(p,1));
+	q = pushBit(mb, q, 1); /* skip nils */
+	q = pushBit(mb, q, 1);
+	pushInstruction(mb, q);
+}
+
 static void
 mat_group_new(MalBlkPtr mb, InstrPtr p, matlist_t *ml, int b)
 {
@@ -1222,9 +1397,12 @@ mat_group_new(MalBlkPtr mb, InstrPtr p, matlist_t *ml, int b)
 	g = ml->top;
 	mat_add_var(ml, r0, p, getArg(p, 0), mat_grp, b, -1, 1);
 	mat_add_var(ml, r1, p, getArg(p, 1), mat_ext, a, ml->top-1, 1); /* point back at group */
-	mat_add_var(ml, r2, p, getArg(p, 2), mat_cnt, -1, ml->top-1, 1); /* point back at ext */
-	if (push)
+	if (push) {
 		mat_pack_group(mb, ml, g);
+		mat_group_cnt(mb, p, r2);
+	} else {
+		mat_add_var(ml, r2, p, getArg(p, 2), mat_cnt, -1, ml->top-1, 1); /* point back at ext */
+	}
 }
 
 static void
@@ -1300,10 +1478,12 @@ mat_group_derive(MalBlkPtr mb, InstrPtr p, matlist_t *ml, int b, int g)
 	mat_add_var(ml, r0, p, getArg(p, 0), mat_grp, b, g, 1);
 	g = ml->top-1;
 	mat_add_var(ml, r1, p, getArg(p, 1), mat_ext, a, ml->top-1, 1); /* point back at group */
-	mat_add_var(ml, r2, p, getArg(p, 2), mat_cnt, -1, ml->top-1, 1); /* point back at ext */
-
-	if (push)
+	if (push) {
 		mat_pack_group(mb, ml, g);
+		mat_group_cnt(mb, p, r2);
+	} else {
+		mat_add_var(ml, r2, p, getArg(p, 2), mat_cnt, -1, ml->top-1, 1); /* point back at ext */
+	}
 }
 
 static void
@@ -1528,7 +1708,7 @@ OPTmergetableImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 	fprintFunction(stderr, mb, 0, LIST_MAL_ALL);
 #endif
 
-	vars= (int*) GDKmalloc(sizeof(int)* mb->vtop);
+	vars= (int*) GDKzalloc(sizeof(int)* mb->vtop);
 	if( vars == NULL){
 		throw(MAL, "optimizer.mergetable", MAL_MALLOC_FAIL);
 	}
@@ -1554,6 +1734,14 @@ OPTmergetableImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 			if (getFunctionId(q) == subgroupdoneRef || getFunctionId(q) == groupdoneRef)
 				groupdone = 1;
 		}
+		/* the histogram of an unfinished grouping only counts within a piece */
+		for (j = p->retc; j < p->argc; j++) {
+			InstrPtr q = old[vars[getArg(p, j)]];
+
+			if (getModuleId(q) == groupRef && q->retc == 3 && getArg(q, 2) == getArg(p, j) &&
+			   (getFunctionId(q) == subgroupRef || getFunctionId(q) == groupRef))
+				groupdone = 1;
+		}
 		if (getModuleId(p) == algebraRef && 
 		    getFunctionId(p) == selectNotNilRef ) 
 			bailout = 1;
@@ -1669,13 +1857,39 @@ OPTmergetableImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 			 getFunctionId(p)== maxRef ||
 			 getFunctionId(p)== avgRef ||
 			 getFunctionId(p)== sumRef ||
-			 getFunctionId(p) == prodRef))) &&
+			 getFunctionId(p) == prodRef ||
+			 getFunctionId(p) == approx_count_distinctRef))) &&
 			(m=is_a_mat(getArg(p,1), &ml)) >= 0) {
-			mat_aggr(mb, p, ml.v, m);
+			if (is_fsum(mb, p))
+				mat_fsum(mb, p, ml.v, m, -1, -1);
+			else
+				mat_aggr(mb, p, ml.v, m);
 			actions++;
 			continue;
 		} 
 
+		/* approximate median and quantile, ungrouped and grouped */
+		if (getModuleId(p) == aggrRef &&
+		   (getFunctionId(p) == approx_medianRef ||
+		    getFunctionId(p) == approx_quantileRef ||
+		    getFunctionId(p) == subapprox_medianRef ||
+		    getFunctionId(p) == subapprox_quantileRef)) {
+			int isQuantile = (getFunctionId(p) == approx_quantileRef || getFunctionId(p) == subapprox_quantileRef);
+			int grouped = (getFunctionId(p) == subapprox_medianRef || getFunctionId(p) == subapprox_quantileRef);
+
+			m = is_a_mat(getArg(p,1), &ml);
+			n = isQuantile ? is_a_mat(getArg(p,2), &ml) : -1;
+			o = grouped ? is_a_mat(getArg(p,2+isQuantile), &ml) : -1;
+			e = grouped ? is_a_mat(getArg(p,3+isQuantile), &ml) : -1;
+			if (m >= 0 && p->argc == 2 + isQuantile + 3 * grouped &&
+			    match == 1 + (n >= 0) + 2 * grouped &&
+			    (!grouped || (o >= 0 && e >= 0))) {
+				mat_sketch(mb, p, ml.v, m, n, o, e);
+				actions++;
+				continue;
+			}
+		}
+
 		if (match == 1 && bats == 1 && p->argc == 4 && isSlice(p) && ((m=is_a_mat(getArg(p,p->retc), &ml)) >= 0)) {
 			mat_topn(mb, p, &ml, m, -1, -1);
 			actions++;
@@ -1726,11 +1940,15 @@ OPTmergetableImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 		    getFunctionId(p) == submaxRef ||
 		    getFunctionId(p) == subavgRef ||
 		    getFunctionId(p) == subsumRef ||
-		    getFunctionId(p) == subprodRef) &&
+		    getFunctionId(p) == subprodRef ||
+		    getFunctionId(p) == subapprox_count_distinctRef) &&
 		   ((m=is_a_mat(getArg(p,1), &ml)) >= 0) &&
 		   ((n=is_a_mat(getArg(p,2), &ml)) >= 0) &&
 		   ((o=is_a_mat(getArg(p,3), &ml)) >= 0)) {
-			mat_group_aggr(mb, p, ml.v, m, n, o);
+			if (is_fsum(mb, p) && p->argc == 6)
+				mat_fsum(mb, p, ml.v, m, n, o);
+			else
+				mat_group_aggr(mb, p, ml.v, m, n, o);
 			actions++;
 			continue;
 		}
@@ -1821,7 +2039,7 @@ OPTmergetableImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 		if (match == 1 && fm == 2 && isSelect(p) && p->retc == 1 &&
 		   (m=is_a_mat(getArg(p,fm), &ml)) >= 0 && 
 		   !ml.v[m].packed && /* not packed yet */ 
-		   !was_a_mat(getArg(p,fm-1), &ml)){ /* not previously packed */
+		   was_a_mat(getArg(p,fm-1), &ml) < 0){ /* not previously packed */
 			r = copyInstruction(p);
 			getArg(r, fm) = getArg(ml.v[m].mi, ml.v[m].mi->argc-1);
 			pushInstruction(mb, r);
@@ -11,28 +11,10 @@
 #include "mal_interpreter.h"
 #include "gdk_utils.h"
 
-static int
-eligible(MalBlkPtr mb)
-{
-	InstrPtr p;
-	int i;
-	for (i = 1; i < mb->stop; i++) {
-		p = getInstrPtr(mb, i);
-		if (getModuleId(p) == sqlRef && getFunctionId(p) == assertRef &&
-			p->argc > 2 && getArgType(mb, p, 2) == TYPE_str &&
-			isVarConstant(mb, getArg(p, 2)) &&
-			getVarConstant(mb, getArg(p, 2)).val.sval != NULL &&
-			(strstr(getVarConstant(mb, getArg(p, 2)).val.sval, "PRIMARY KEY constraint") ||
-			 strstr(getVarConstant(mb, getArg(p, 2)).val.sval, "UNIQUE constraint")))
-			return 0;
-	}
-	return 1;
-}
-
 str
 OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 {
-	int i, j, limit, slimit, estimate = 0, pieces = 1, mito_parts = 0, mito_size = 0, row_size = 0, mt = -1;
+	int i, j, limit, slimit, estimate = 0, pieces = 1, mito_parts = 0, mito_size = 0, row_size = 0, mt = -1, morsels;
 	str schema = 0, table = 0;
 	BUN r = 0, rowcnt = 0;    /* table should be sizeable to consider parallel execution*/
 	InstrPtr q, *old, target = 0;
@@ -48,9 +30,6 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		//return 0;
 	(void) cntxt;
 	(void) stk;
-	if (!eligible(mb))
-		return MAL_SUCCEED;
-
 	activeClients = mb->activeClients = MCactiveClients();
 	old = mb->stmt;
 	for (i = 1; i < mb->stop; i++) {
@@ -65,36 +44,25 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		    	getFunctionId(p) != subavgRef &&
 		    	getFunctionId(p) != subsumRef &&
 		    	getFunctionId(p) != subprodRef &&
+		    	getFunctionId(p) != subapprox_medianRef &&
+		    	getFunctionId(p) != subapprox_quantileRef &&
+		    	getFunctionId(p) != subapprox_count_distinctRef &&
 
 		        getFunctionId(p) != countRef &&
 		    	getFunctionId(p) != minRef &&
 		    	getFunctionId(p) != maxRef &&
 		    	getFunctionId(p) != avgRef &&
 		    	getFunctionId(p) != sumRef &&
-		    	getFunctionId(p) != prodRef)
-			return 0;
-
-		/* do not split up floating point bat that is being summed */
-		if (p->retc == 1 &&
-			(((p->argc == 6 || p->argc == 7) &&
-			  getModuleId(p) == aggrRef &&
-			  getFunctionId(p) == subsumRef) ||
-			 (p->argc == 4 &&
-			  getModuleId(p) == aggrRef &&
-			  getFunctionId(p) == sumRef)) &&
-			isaBatType(getArgType(mb, p, p->retc)) &&
-			(getBatType(getArgType(mb, p, p->retc)) == TYPE_flt ||
-			 getBatType(getArgType(mb, p, p->retc)) == TYPE_dbl))
+		    	getFunctionId(p) != prodRef &&
+		    	getFunctionId(p) != approx_medianRef &&
+		    	getFunctionId(p) != approx_quantileRef &&
+		    	getFunctionId(p) != approx_count_distinctRef)
 			return 0;
 
 		if (p->argc > 2 && (getModuleId(p) == rapiRef || getModuleId(p) == pyapiRef || getModuleId(p) == pyapi3Ref) && 
 		        getFunctionId(p) == subeval_aggrRef)
 			return 0;
 
-		/* Mergetable cannot handle intersect/except's for now */
-		if (getModuleId(p) == algebraRef && getFunctionId(p) == groupbyRef) 
-			return 0;
-
 		/* locate the largest non-partitioned table */
 		if (getModuleId(p) != sqlRef || (getFunctionId(p) != bindRef && getFunctionId(p) != bindidxRef))
 			continue;
@@ -140,6 +108,7 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	 * i.e., (rowcnt > monet_memory/argsize = m) */
 	assert(threads > 0);
 	assert(activeClients > 0);
+	morsels = (int) MIN(rowcnt / MINPARTCNT, (BUN) threads * MORSELS);
 	if (rowcnt > m && m / threads / activeClients > 0) {
 		/* create |pieces| > |threads| partitions such that
 		 * |threads| partitions at a time fit in memory,
@@ -151,7 +120,7 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	} else if (rowcnt > MINPARTCNT) {
 	/* exploit parallelism, but ensure minimal partition size to
 	 * limit overhead */
-		pieces = (int) MIN(rowcnt / MINPARTCNT, (BUN) threads);
+		pieces = morsels;
 	}
 	/* when testing, always aim for full parallelism, but avoid
 	 * empty pieces */
@@ -170,9 +139,17 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	mito_size = GDKgetenv_int("mito_size", 0);
 	if (mito_size > 0) 
 		pieces = (int) ((rowcnt * row_size) / (mito_size * 1024));
-	if (pieces > threads) {
-		pieces = threads;
-	}
+	/* The pieces are not tied to a thread, the dataflow workers take
+	 * them in turn and steal them from each other, so a few more
+	 * than threads keep all workers busy when a selection is skewed
+	 * or other clients occupy some of the workers.  The spare ones
+	 * should still be worth scheduling. */
+	if (pieces > threads)
+		pieces = threads > 1 ? MAX(MIN(pieces, morsels), threads) : 1;
+	/* mergetable replicates the plan per piece, the pieces of a wide
+	 * table should not blow it up */
+	if (pieces > threads && (lng) pieces * mb->stop > MAXPLANSIZE)
+		pieces = MAX(MAXPLANSIZE / mb->stop, threads);
 #ifdef DEBUG_OPT_MITOSIS
 	fprintf(stderr, "#opt_mitosis: target is %s.%s "
 							   " with " BUNFMT " rows of size %d into " SZFMT
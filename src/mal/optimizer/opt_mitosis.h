@@ -13,6 +13,8 @@
 
 #define MAXSLICES 256		/* to be refined */
 #define MINPARTCNT 100000	/* minimal record count per partition */
+#define MORSELS 4		/* pieces per thread, idle workers steal the spare ones */
+#define MAXPLANSIZE 8192	/* instructions a partitioned plan may grow to */
 
 mal_export str OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p);
 
@@ -42,7 +42,6 @@ static struct PIPELINES {
  * If you change the minimal pipe, please also update the man page
  * (see tools/mserver/mserver5.1) accordingly!
  */
-/*
 	{"minimal_pipe",
 	 "optimizer.inline();"
 	 "optimizer.remap();"
@@ -53,7 +52,6 @@ static struct PIPELINES {
 	 "optimizer.candidates();"
 	 "optimizer.garbageCollector();",
 	 "stable", NULL, NULL, 1},
-*/
 /* The default pipe line contains as of Feb2010
  * mitosis-mergetable-reorder, aimed at large tables and improved
  * access locality.
@@ -38,6 +38,9 @@ str andRef;
 str antijoinRef;
 str appendidxRef;
 str appendRef;
+str approx_count_distinctRef;
+str approx_medianRef;
+str approx_quantileRef;
 str arrayRef;
 str assertRef;
 str attachRef;
@@ -119,9 +122,11 @@ str execRef;
 str expandRef;
 str exportOperationRef;
 str export_tableRef;
+str favgRef;
 str findRef;
 str finishRef;
 str firstnRef;
+str fsumRef;
 str generatorRef;
 str getRef;
 str getTraceRef;
@@ -133,6 +138,8 @@ str groupdoneRef;
 str groupRef;
 str hashRef;
 str hgeRef;
+str hllmergeRef;
+str hllsketchRef;
 str identityRef;
 str ifthenelseRef;
 str ilikeRef;
@@ -209,6 +216,7 @@ str pyapi3mapRef;
 str pyapi3Ref;
 str pyapimapRef;
 str pyapiRef;
+str quantilesketchRef;
 str querylogRef;
 str queryRef;
 str raiseRef;
@@ -244,6 +252,8 @@ str setVariableRef;
 str setWriteModeRef;
 str singleRef;
 str sinkRef;
+str sketchmedianRef;
+str sketchquantileRef;
 str sliceRef;
 str sortRef;
 str sortReverseRef;
@@ -255,21 +265,33 @@ str stopRef;
 str stoptraceRef;
 str streamsRef;
 str strRef;
+str subapprox_count_distinctRef;
+str subapprox_medianRef;
+str subapprox_quantileRef;
 str subavgRef;
 str subcountRef;
 str subdeltaRef;
 str subdiffRef;
+str subfavgRef;
+str subfsumRef;
 str subeval_aggrRef;
 str subgroupdoneRef;
 str subgroupRef;
+str subhllmergeRef;
+str subhllsketchRef;
 str subinterRef;
 str submaxRef;
 str submedianRef;
 str subminRef;
 str subprodRef;
+str subquantilesketchRef;
+str subsketchmedianRef;
+str subsketchquantileRef;
 str subsliceRef;
+str subsumpartialsRef;
 str subsumRef;
 str subuniformRef;
+str sumpartialsRef;
 str sumRef;
 str takeRef;
 str thetajoinRef;
@@ -547,6 +569,28 @@ void optimizerInit(void)
 	sumRef = putName("sum");
 	subsumRef = putName("subsum");
 	subavgRef = putName("subavg");
+	sumpartialsRef = putName("sumpartials");
+	subsumpartialsRef = putName("subsumpartials");
+	fsumRef = putName("fsum");
+	subfsumRef = putName("subfsum");
+	favgRef = putName("favg");
+	subfavgRef = putName("subfavg");
+	approx_medianRef = putName("approx_median");
+	approx_quantileRef = putName("approx_quantile");
+	subapprox_medianRef = putName("subapprox_median");
+	subapprox_quantileRef = putName("subapprox_quantile");
+	quantilesketchRef = putName("quantilesketch");
+	subquantilesketchRef = putName("subquantilesketch");
+	sketchmedianRef = putName("sketchmedian");
+	sketchquantileRef = putName("sketchquantile");
+	subsketchmedianRef = putName("subsketchmedian");
+	subsketchquantileRef = putName("subsketchquantile");
+	approx_count_distinctRef = putName("approx_count_distinct");
+	subapprox_count_distinctRef = putName("subapprox_count_distinct");
+	hllsketchRef = putName("hllsketch");
+	subhllsketchRef = putName("subhllsketch");
+	hllmergeRef = putName("hllmerge");
+	subhllmergeRef = putName("subhllmerge");
 	sortRef = putName("sort");
 	takeRef= putName("take");
 	transactionRef= putName("transaction");
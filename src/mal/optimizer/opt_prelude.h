@@ -36,6 +36,9 @@ mal_export	str andRef;
 mal_export  str antijoinRef;
 mal_export  str appendidxRef;
 mal_export  str appendRef;
+mal_export  str approx_count_distinctRef;
+mal_export  str approx_medianRef;
+mal_export  str approx_quantileRef;
 mal_export  str arrayRef;
 mal_export  str assertRef;
 mal_export  str attachRef;
@@ -117,9 +120,11 @@ mal_export  str execRef;
 mal_export  str expandRef;
 mal_export  str exportOperationRef;
 mal_export  str export_tableRef;
+mal_export  str favgRef;
 mal_export  str findRef;
 mal_export  str finishRef;
 mal_export  str firstnRef;
+mal_export  str fsumRef;
 mal_export  str generatorRef;
 mal_export  str getRef;
 mal_export  str getTraceRef;
@@ -131,6 +136,8 @@ mal_export  str groupdoneRef;
 mal_export  str groupRef;
 mal_export  str hashRef;
 mal_export  str hgeRef;
+mal_export  str hllmergeRef;
+mal_export  str hllsketchRef;
 mal_export  str identityRef;
 mal_export  str ifthenelseRef;
 mal_export  str ilikeRef;
@@ -209,6 +216,7 @@ mal_export  str pyapi3mapRef;
 mal_export  str pyapi3Ref;
 mal_export  str pyapimapRef;
 mal_export  str pyapiRef;
+mal_export  str quantilesketchRef;
 mal_export  str querylogRef;
 mal_export  str queryRef;
 mal_export	str raiseRef;
@@ -244,6 +252,8 @@ mal_export  str setVariableRef;
 mal_export  str setWriteModeRef;
 mal_export  str singleRef;
 mal_export  str sinkRef;
+mal_export  str sketchmedianRef;
+mal_export  str sketchquantileRef;
 mal_export  str sliceRef;
 mal_export  str sortRef;
 mal_export  str sortReverseRef;
@@ -255,21 +265,33 @@ mal_export  str stopRef;
 mal_export  str stoptraceRef;
 mal_export  str streamsRef;
 mal_export  str strRef;
+mal_export  str subapprox_count_distinctRef;
+mal_export  str subapprox_medianRef;
+mal_export  str subapprox_quantileRef;
 mal_export  str subavgRef;
 mal_export  str subcountRef;
 mal_export  str subdeltaRef;
 mal_export  str subdiffRef;
+mal_export  str subfavgRef;
+mal_export  str subfsumRef;
 mal_export  str subeval_aggrRef;
 mal_export  str subgroupdoneRef;
 mal_export  str subgroupRef;
+mal_export  str subhllmergeRef;
+mal_export  str subhllsketchRef;
 mal_export  str subinterRef;
 mal_export  str submaxRef;
 mal_export  str submedianRef;
 mal_export  str subminRef;
 mal_export  str subprodRef;
+mal_export  str subquantilesketchRef;
+mal_export  str subsketchmedianRef;
+mal_export  str subsketchquantileRef;
 mal_export  str subsliceRef;
+mal_export  str subsumpartialsRef;
 mal_export  str subsumRef;
 mal_export  str subuniformRef;
+mal_export  str sumpartialsRef;
 mal_export  str sumRef;
 mal_export  str takeRef;
 mal_export  str thetajoinRef;
@@ -2177,7 +2177,7 @@ rel2bin_except(backend *be, sql_rel *rel, list *refs)
 	stmt *lgrp = NULL, *rgrp = NULL;
 	stmt *lext = NULL, *rext = NULL, *next = NULL;
 	stmt *lcnt = NULL, *rcnt = NULL, *ncnt = NULL, *zero = NULL;
-	stmt *s, *lm, *rm;
+	stmt *s, *lm, *rm, *grp;
 	list *lje = sa_list(sql->sa);
 	list *rje = sa_list(sql->sa);
 
@@ -2231,39 +2231,41 @@ rel2bin_except(backend *be, sql_rel *rel, list *refs)
 	lm = stmt_result(be, s, 0);
 	rm = stmt_result(be, s, 1);
 
-	s = stmt_mirror(be, lext);
-	s = stmt_tdiff(be, s, lm);
+	grp = stmt_mirror(be, lcnt);
+	s = stmt_tdiff(be, grp, lm);
 
 	/* first we find those missing in R */
-	next = stmt_project(be, s, lext);
+	next = stmt_project(be, s, grp);
 	ncnt = stmt_project(be, s, lcnt);
 	zero = stmt_const(be, s, stmt_atom_lng(be, 0));
 
-	/* ext, lcount, rcount */
-	lext = stmt_project(be, lm, lext);
+	/* group, lcount, rcount */
+	grp = stmt_project(be, lm, grp);
 	lcnt = stmt_project(be, lm, lcnt);
 	rcnt = stmt_project(be, rm, rcnt);
 
 	/* append those missing in L */
-	lext = stmt_append(be, lext, next);
+	grp = stmt_append(be, grp, next);
 	lcnt = stmt_append(be, lcnt, ncnt);
 	rcnt = stmt_append(be, rcnt, zero);
 
  	min = sql_bind_func(sql->sa, sql->session->schema, "sql_sub", lng, lng, F_FUNC);
 	s = stmt_binop(be, lcnt, rcnt, min); /* use count */
 
-	/* now we have gid,cnt, blowup to full groupsizes */
-	s = stmt_gen_group(be, lext, s);
+	/* now we have group,cnt, blowup to full groupsizes */
+	s = stmt_gen_group(be, grp, s);
 
-	/* project columns of left hand expression */
+	/* project the grouped columns of left hand expression, these
+	 * only depend on the extents, which keeps the groupings above
+	 * partitionable */
 	stmts = sa_list(sql->sa);
-	for (n = left->op4.lval->h; n; n = n->next) {
+	for (n = left->op4.lval->h, m = lje->h; n && m; n = n->next, m = m->next) {
 		stmt *c1 = column(be, n->data);
 		const char *rnme = NULL;
 		const char *nme = column_name(sql->sa, c1);
 
 		/* retain name via the stmt_alias */
-		c1 = stmt_project(be, s, c1);
+		c1 = stmt_project(be, s, m->data);
 
 		rnme = table_name(sql->sa, c1);
 		c1 = stmt_alias(be, c1, rnme, nme);
@@ -2340,26 +2342,25 @@ rel2bin_inter(backend *be, sql_rel *rel, list *refs)
 	lm = stmt_result(be, s, 0);
 	rm = stmt_result(be, s, 1);
 		
-	/* ext, lcount, rcount */
-	lext = stmt_project(be, lm, lext);
+	/* lcount, rcount */
 	lcnt = stmt_project(be, lm, lcnt);
 	rcnt = stmt_project(be, rm, rcnt);
 
  	min = sql_bind_func(sql->sa, sql->session->schema, "sql_min", lng, lng, F_FUNC);
 	s = stmt_binop(be, lcnt, rcnt, min);
 
-	/* now we have gid,cnt, blowup to full groupsizes */
-	s = stmt_gen_group(be, lext, s);
+	/* now we have group,cnt, blowup to full groupsizes */
+	s = stmt_gen_group(be, lm, s);
 
-	/* project columns of left hand expression */
+	/* project the grouped columns of left hand expression */
 	stmts = sa_list(sql->sa);
-	for (n = left->op4.lval->h; n; n = n->next) {
+	for (n = left->op4.lval->h, m = lje->h; n && m; n = n->next, m = m->next) {
 		stmt *c1 = column(be, n->data);
 		const char *rnme = NULL;
 		const char *nme = column_name(sql->sa, c1);
 
 		/* retain name via the stmt_alias */
-		c1 = stmt_project(be, s, c1);
+		c1 = stmt_project(be, s, m->data);
 
 		rnme = table_name(sql->sa, c1);
 		c1 = stmt_alias(be, c1, rnme, nme);
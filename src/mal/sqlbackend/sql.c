@@ -68,6 +68,11 @@ rel_no_mitosis(sql_rel *rel)
 		return 1;
 	if (is_topn(rel->op) || is_project(rel->op))
 		return rel_no_mitosis(rel->l);
+	/* the key checks of bulk inserts and updates are worth splitting up */
+	if ((rel->op == op_insert || rel->op == op_update) && rel->l &&
+	    is_basetable(((sql_rel*)rel->l)->op) && ((sql_rel*)rel->l)->l &&
+	    list_length(((sql_table*)((sql_rel*)rel->l)->l)->keys.set))
+		return 0;
 	if (is_modify(rel->op) && rel->card <= CARD_AGGR)
 		return rel_no_mitosis(rel->r);
 	if (is_select(rel->op) && rel_is_table(rel->l) && rel->exps) {
@@ -510,13 +510,22 @@ SQLinitClient(Client c)
 			buffer createdb_buf;
 			stream* createdb_stream = buffer_rastream(&createdb_buf, "createdb.sql");
 			bstream* createdb_bstream = bstream_create(createdb_stream, createdb_len);
+			str optimizer;
 			createdb_buf.pos = 0;
 			createdb_buf.len = createdb_len;
 			createdb_buf.buf = createdb_inline;
+			/* the catalog script consists of DDL only, which gains
+			 * nothing from the full optimizer pipeline */
+			optimizer = stack_get_string(m, "optimizer");
+			optimizer = optimizer ? GDKstrdup(optimizer) : NULL;
+			stack_set_string(m, "optimizer", "minimal_pipe");
 			if (bstream_next(createdb_bstream) >= 0)
 				msg = SQLstatementIntern(c, &createdb_bstream->buf, "sql.init", TRUE, FALSE, NULL);
 			else
 				msg = createException(MAL, "createdb", "could not load inlined createdb script");
+			stack_set_string(m, "optimizer", optimizer ? optimizer : "default_pipe");
+			if (optimizer)
+				GDKfree(optimizer);
 
 			bstream_destroy(createdb_bstream);
 			if (m->sa)
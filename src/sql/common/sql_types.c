@@ -1583,6 +1583,7 @@ sqltypeinit( sql_allocator *sa)
 
 	sql_create_aggr(sa, "count_no_nil", "aggr", "count_no_nil", NULL, LNG);
 	sql_create_aggr(sa, "count", "aggr", "count", NULL, LNG);
+	sql_create_aggr(sa, "approx_count_distinct", "aggr", "approx_count_distinct", ANY, LNG);
 
 	/* order based operators */
 	sql_create_analytic(sa, "diff", "sql", "diff", ANY, NULL, NULL, BIT, SCALE_NONE);
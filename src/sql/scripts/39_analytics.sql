@@ -185,6 +185,44 @@ create aggregate quantile(val TIMESTAMP, q DOUBLE) returns TIMESTAMP
 	external name "aggr"."quantile";
 GRANT EXECUTE ON AGGREGATE quantile(TIMESTAMP, DOUBLE) TO PUBLIC;
 
+create aggregate approx_median(val TINYINT) returns DOUBLE
+	external name "aggr"."approx_median";
+GRANT EXECUTE ON AGGREGATE approx_median(TINYINT) TO PUBLIC;
+create aggregate approx_median(val SMALLINT) returns DOUBLE
+	external name "aggr"."approx_median";
+GRANT EXECUTE ON AGGREGATE approx_median(SMALLINT) TO PUBLIC;
+create aggregate approx_median(val INTEGER) returns DOUBLE
+	external name "aggr"."approx_median";
+GRANT EXECUTE ON AGGREGATE approx_median(INTEGER) TO PUBLIC;
+create aggregate approx_median(val BIGINT) returns DOUBLE
+	external name "aggr"."approx_median";
+GRANT EXECUTE ON AGGREGATE approx_median(BIGINT) TO PUBLIC;
+create aggregate approx_median(val REAL) returns DOUBLE
+	external name "aggr"."approx_median";
+GRANT EXECUTE ON AGGREGATE approx_median(REAL) TO PUBLIC;
+create aggregate approx_median(val DOUBLE) returns DOUBLE
+	external name "aggr"."approx_median";
+GRANT EXECUTE ON AGGREGATE approx_median(DOUBLE) TO PUBLIC;
+
+create aggregate approx_quantile(val TINYINT, q DOUBLE) returns DOUBLE
+	external name "aggr"."approx_quantile";
+GRANT EXECUTE ON AGGREGATE approx_quantile(TINYINT, DOUBLE) TO PUBLIC;
+create aggregate approx_quantile(val SMALLINT, q DOUBLE) returns DOUBLE
+	external name "aggr"."approx_quantile";
+GRANT EXECUTE ON AGGREGATE approx_quantile(SMALLINT, DOUBLE) TO PUBLIC;
+create aggregate approx_quantile(val INTEGER, q DOUBLE) returns DOUBLE
+	external name "aggr"."approx_quantile";
+GRANT EXECUTE ON AGGREGATE approx_quantile(INTEGER, DOUBLE) TO PUBLIC;
+create aggregate approx_quantile(val BIGINT, q DOUBLE) returns DOUBLE
+	external name "aggr"."approx_quantile";
+GRANT EXECUTE ON AGGREGATE approx_quantile(BIGINT, DOUBLE) TO PUBLIC;
+create aggregate approx_quantile(val REAL, q DOUBLE) returns DOUBLE
+	external name "aggr"."approx_quantile";
+GRANT EXECUTE ON AGGREGATE approx_quantile(REAL, DOUBLE) TO PUBLIC;
+create aggregate approx_quantile(val DOUBLE, q DOUBLE) returns DOUBLE
+	external name "aggr"."approx_quantile";
+GRANT EXECUTE ON AGGREGATE approx_quantile(DOUBLE, DOUBLE) TO PUBLIC;
+
 create aggregate corr(e1 TINYINT, e2 TINYINT) returns TINYINT
 	external name "aggr"."corr";
 GRANT EXECUTE ON AGGREGATE corr(TINYINT, TINYINT) TO PUBLIC;
@@ -22,6 +22,12 @@ GRANT EXECUTE ON AGGREGATE median(HUGEINT) TO PUBLIC;
 create aggregate quantile(val HUGEINT, q DOUBLE) returns HUGEINT
 	external name "aggr"."quantile";
 GRANT EXECUTE ON AGGREGATE quantile(HUGEINT, DOUBLE) TO PUBLIC;
+create aggregate approx_median(val HUGEINT) returns DOUBLE
+	external name "aggr"."approx_median";
+GRANT EXECUTE ON AGGREGATE approx_median(HUGEINT) TO PUBLIC;
+create aggregate approx_quantile(val HUGEINT, q DOUBLE) returns DOUBLE
+	external name "aggr"."approx_quantile";
+GRANT EXECUTE ON AGGREGATE approx_quantile(HUGEINT, DOUBLE) TO PUBLIC;
 create aggregate corr(e1 HUGEINT, e2 HUGEINT) returns HUGEINT
 	external name "aggr"."corr";
 GRANT EXECUTE ON AGGREGATE corr(HUGEINT, HUGEINT) TO PUBLIC;
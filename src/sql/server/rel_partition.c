@@ -149,6 +149,9 @@ rel_partition(mvc *sql, sql_rel *rel)
 	} else if (rel->op == op_anti && rel->l && rel->r) {
 		rel_partition(sql, rel->l);
 		rel_partition(sql, rel->r);
+	} else if (is_modify(rel->op) && rel->r) {
+		/* bulk inserts/updates split up their input, the key checks on it are partition safe */
+		rel_partition(sql, rel->r);
 	} else if (is_join(rel->op)) {
 		if (has_groupby(rel->l) || has_groupby(rel->r)) {
 			rel_partition(sql, rel->l);
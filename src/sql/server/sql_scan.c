@@ -107,6 +107,7 @@ scanner_init_keywords(void)
 	failed += keywords_insert("SUM", AGGR);
 	failed += keywords_insert("PROD", AGGR);
 	failed += keywords_insert("COUNT", AGGR);
+	failed += keywords_insert("APPROX_COUNT_DISTINCT", AGGR);
 
 	failed += keywords_insert("LAG", AGGR);
 	failed += keywords_insert("LEAD", AGGR);
@@ -10,6 +10,7 @@
 #include "bat_storage.h"
 #include "bat_utils.h"
 #include "sql_string.h"
+#include "sql_types.h" /* EC_DEC */
 #include "algebra.h"
 #include "gdk_atoms.h"
 
@@ -1138,6 +1139,69 @@ double_elim_col(sql_trans *tr, sql_column *col)
 	return de;
 }
 
+/* the smallest and largest value of the base and inserted values of a
+ * column, as found in their zone maps; updated values may lie outside
+ * of that range, so then the range is unknown */
+static int
+range_col(sql_trans *tr, sql_column *col, void **min, void **max)
+{
+	sql_delta *d;
+	bat bids[2];
+	int i, tpe = col->type.type->localtype, found = 0;
+	ValRecord lo, hi, v;
+	char *buf = NULL;
+
+	if (!isTable(col->t) || !col->t->s || col->type.type->eclass == EC_DEC)
+		return 0;
+	if (!col->data) {
+		sql_column *oc = tr_find_column(tr->parent, col);
+		col->data = timestamp_delta(oc->data, tr->stime);
+	}
+	d = col->data;
+	if (!d || d->ucnt)
+		return 0;
+	bids[0] = d->bid;
+	bids[1] = d->ibid;
+	for (i = 0; i < 2; i++) {
+		BAT *b;
+
+		if (!bids[i] || (b = temp_descriptor(bids[i])) == NULL)
+			continue;
+		if (BATcount(b) == 0) {
+			bat_destroy(b);
+			continue;
+		}
+		if (BATzonemap(b) != GDK_SUCCEED) {
+			GDKclrerr();
+			bat_destroy(b);
+			return 0;
+		}
+		if (BATmin(b, &v.val) != NULL &&
+		    ATOMcmp(tpe, &v.val, ATOMnilptr(tpe)) != 0) {
+			/* not only nils */
+			if (!found || ATOMcmp(tpe, &v.val, &lo.val) < 0)
+				lo = v;
+			if (BATmax(b, &v.val) != NULL &&
+			    (!found || ATOMcmp(tpe, &v.val, &hi.val) > 0))
+				hi = v;
+			found = 1;
+		}
+		bat_destroy(b);
+	}
+	if (!found)
+		return 0;
+	if (ATOMformat(tpe, &lo.val, &buf) < 0)
+		return 0;
+	*min = sa_strdup(tr->sa, buf);
+	GDKfree(buf);
+	buf = NULL;
+	if (ATOMformat(tpe, &hi.val, &buf) < 0)
+		return 0;
+	*max = sa_strdup(tr->sa, buf);
+	GDKfree(buf);
+	return 1;
+}
+
 static int
 load_delta(sql_delta *bat, int bid, int type)
 {
@@ -2783,6 +2847,7 @@ bat_storage_init( store_functions *sf)
 	sf->dcount_col = (dcount_col_fptr)&dcount_col;
 	sf->sorted_col = (prop_col_fptr)&sorted_col;
 	sf->double_elim_col = (prop_col_fptr)&double_elim_col;
+	sf->range_col = (range_col_fptr)&range_col;
 
 	sf->create_col = (create_col_fptr)&create_col;
 	sf->create_idx = (create_idx_fptr)&create_idx;
@@ -134,6 +134,7 @@ typedef int (*delete_tab_fptr) (sql_trans *tr, sql_table *t, void *d, int tpe);
 /*
 -- count number of rows in column (excluding the deletes)
 -- check for sortedness
+-- get the smallest and largest value of a column, returns 0 if unknown
  */
 typedef size_t (*count_del_fptr) (sql_trans *tr, sql_table *t);
 typedef size_t (*count_upd_fptr) (sql_trans *tr, sql_table *t);
@@ -141,6 +142,7 @@ typedef size_t (*count_col_fptr) (sql_trans *tr, sql_column *c, int all /* all o
 typedef size_t (*count_idx_fptr) (sql_trans *tr, sql_idx *i, int all /* all or new only */);
 typedef size_t (*dcount_col_fptr) (sql_trans *tr, sql_column *c);
 typedef int (*prop_col_fptr) (sql_trans *tr, sql_column *c);
+typedef int (*range_col_fptr) (sql_trans *tr, sql_column *c, void **min, void **max);
 
 /*
 -- create the necessary storage resources for columns, indices and tables
@@ -220,6 +222,7 @@ typedef struct store_functions {
 	dcount_col_fptr dcount_col;
 	prop_col_fptr sorted_col;
 	prop_col_fptr double_elim_col; /* varsize col with double elimination */
+	range_col_fptr range_col;
 
 	create_col_fptr create_col;
 	create_idx_fptr create_idx;
@@ -4843,6 +4843,9 @@ sql_trans_ranges( sql_trans *tr, sql_column *col, void **min, void **max )
 				return 1;
 			}
 		}
+		/* no statistics, get from the zone maps */
+		if (store_funcs.range_col)
+			return store_funcs.range_col(tr, col, min, max);
 	}
 	return 0;
 }
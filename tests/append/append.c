@@ -0,0 +1,143 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100
+#define NBATCHES 1000
+
+#ifndef _WIN32
+static double now_usec(void) {
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000000.0 + tv.tv_usec;
+}
+#endif
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int32_t xcol;
+	monetdb_column_str ycol;
+	monetdb_column_double zcol;
+	monetdb_column_date dcol;
+	monetdb_column* input[4];
+	int32_t xs[BATCH];
+	char* ys[BATCH];
+	double zs[BATCH];
+	monetdb_data_date ds[BATCH];
+	int i;
+#ifndef _WIN32
+	double start;
+#endif
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, y string, z double NOT NULL, d date)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	for (i = 0; i < BATCH; i++) {
+		xs[i] = i % 7 == 0 ? -1 : i;
+		ys[i] = i % 2 == 0 ? "even" : NULL;
+		zs[i] = i / 2.0;
+		ds[i].year = 2000;
+		ds[i].month = 1 + i % 12;
+		ds[i].day = 1;
+	}
+	xcol.type = monetdb_int32_t;
+	xcol.data = xs;
+	xcol.count = BATCH;
+	xcol.null_value = -1;
+	ycol.type = monetdb_str;
+	ycol.data = ys;
+	ycol.count = BATCH;
+	ycol.null_value = NULL;
+	zcol.type = monetdb_double;
+	zcol.data = zs;
+	zcol.count = BATCH;
+	zcol.null_value = -1;
+	dcol.type = monetdb_date;
+	dcol.data = ds;
+	dcol.count = BATCH;
+	input[0] = (monetdb_column*) &xcol;
+	input[1] = (monetdb_column*) &ycol;
+	input[2] = (monetdb_column*) &zcol;
+	input[3] = (monetdb_column*) &dcol;
+
+	err = monetdb_append_columns(conn, "sys", "test", input, 4);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT COUNT(*), COUNT(x), SUM(x), COUNT(y), SUM(z), COUNT(DISTINCT d) FROM test", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (((monetdb_column_int64_t*) monetdb_result_fetch(result, 0))->data[0] != BATCH ||
+		((monetdb_column_int64_t*) monetdb_result_fetch(result, 1))->data[0] != 85 ||
+		((monetdb_column_int64_t*) monetdb_result_fetch(result, 2))->data[0] != 4950 - 735 ||
+		((monetdb_column_int64_t*) monetdb_result_fetch(result, 3))->data[0] != 50 ||
+		((monetdb_column_double*) monetdb_result_fetch(result, 4))->data[0] != 2475 ||
+		((monetdb_column_int64_t*) monetdb_result_fetch(result, 5))->data[0] != 12)
+		error("Wrong appended values")
+	monetdb_cleanup_result(conn, result);
+
+	// NOT NULL is checked before anything is appended
+	zs[3] = -1;
+	err = monetdb_append_columns(conn, "sys", "test", input, 4);
+	if (err == 0)
+		error("NOT NULL violation not detected")
+	zs[3] = 1.5;
+
+	// tables with keys go through the insert plan
+	err = monetdb_query(conn, "CREATE TABLE keyed (x integer PRIMARY KEY, y string, z double, d date)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (i = 0; i < BATCH; i++)
+		xs[i] = i;
+	err = monetdb_append_columns(conn, "sys", "keyed", input, 4);
+	if (err != 0)
+		error(err)
+	err = monetdb_append_columns(conn, "sys", "keyed", input, 4);
+	if (err == 0)
+		error("PRIMARY KEY violation not detected")
+	err = monetdb_query(conn, "SELECT COUNT(*), SUM(x) FROM keyed", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (((monetdb_column_int64_t*) monetdb_result_fetch(result, 0))->data[0] != BATCH ||
+		((monetdb_column_int64_t*) monetdb_result_fetch(result, 1))->data[0] != 4950)
+		error("Wrong keyed append")
+	monetdb_cleanup_result(conn, result);
+
+#ifndef _WIN32
+	// micro-batch ingestion
+	start = now_usec();
+	for (i = 0; i < NBATCHES; i++) {
+		err = monetdb_append_columns(conn, "sys", "test", input, 4);
+		if (err != 0)
+			error(err)
+	}
+	printf("monetdb_append_columns: %.1f usec/batch of %d rows\n", (now_usec() - start) / NBATCHES, BATCH);
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM test", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (((monetdb_column_int64_t*) monetdb_result_fetch(result, 0))->data[0] != BATCH * (NBATCHES + 1))
+		error("Wrong row count after micro-batches")
+	monetdb_cleanup_result(conn, result);
+#endif
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
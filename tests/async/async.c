@@ -0,0 +1,132 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define NCONNS 4
+#define NROWS 100000
+
+typedef struct {
+	volatile int done;
+	char* err;
+	monetdb_result* result;
+} callback_state;
+
+static void on_complete(monetdb_connection conn, void* userdata, char* err, monetdb_result* result, long affected_rows) {
+	callback_state* state = (callback_state*) userdata;
+	(void) conn;
+	(void) affected_rows;
+	state->err = err;
+	state->result = result;
+	state->done = 1;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conns[NCONNS];
+	monetdb_query_handle* handles[NCONNS];
+	monetdb_result* result = 0;
+	callback_state state;
+	char query[BUFSIZ];
+	long affected_rows = 0;
+	int i;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+
+	for (i = 0; i < NCONNS; i++) {
+		conns[i] = monetdb_connect();
+		if (conns[i] == NULL)
+			error("Connection failed")
+	}
+	err = monetdb_query(conns[0], "CREATE TABLE test (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	{
+		monetdb_column_int32_t xcol;
+		monetdb_column* input[1];
+		xcol.type = monetdb_int32_t;
+		xcol.count = NROWS;
+		xcol.null_value = -1;
+		xcol.data = malloc(sizeof(int32_t) * NROWS);
+		if (!xcol.data)
+			error("Malloc fail")
+		for (i = 0; i < NROWS; i++)
+			xcol.data[i] = i;
+		input[0] = (monetdb_column*) &xcol;
+		err = monetdb_append_columns(conns[0], "sys", "test", input, 1);
+		free(xcol.data);
+		if (err != 0)
+			error(err)
+	}
+
+	// one query in flight on every connection, collected in reverse order
+	for (i = 0; i < NCONNS; i++) {
+		snprintf(query, BUFSIZ, "SELECT COUNT(*) FROM test WHERE x %% %d = 0", i + 1);
+		err = monetdb_query_submit(conns[i], query, &handles[i]);
+		if (err != 0)
+			error(err)
+	}
+	if (!monetdb_query_poll(handles[0])) {
+		monetdb_query_handle* busy = 0;
+		err = monetdb_query_submit(conns[0], "SELECT 1", &busy);
+		if (err == 0 || busy)
+			error("Second query on a busy connection accepted")
+	}
+	for (i = NCONNS - 1; i >= 0; i--) {
+		err = monetdb_query_collect(handles[i], &result, NULL);
+		if (err != 0)
+			error(err)
+		if (result->nrows != 1 ||
+			((monetdb_column_int64_t*) monetdb_result_fetch(result, 0))->data[0] != (NROWS + i) / (i + 1))
+			error("Wrong asynchronous result")
+		monetdb_cleanup_result(conns[i], result);
+	}
+
+	// updates report their affected rows
+	err = monetdb_query_submit(conns[1], "UPDATE test SET x = x + 1 WHERE x < 10", &handles[1]);
+	if (err != 0)
+		error(err)
+	err = monetdb_query_collect(handles[1], NULL, &affected_rows);
+	if (err != 0)
+		error(err)
+	if (affected_rows != 10)
+		error("Wrong number of affected rows")
+
+	// errors are delivered through the callback as well
+	memset(&state, 0, sizeof(state));
+	err = monetdb_query_async(conns[2], "SELECT * FROM nonexistent", on_complete, &state);
+	if (err != 0)
+		error(err)
+#ifndef _WIN32
+	for (i = 0; i < 10000 && !state.done; i++)
+		usleep(1000);
+#endif
+	if (!state.done || !state.err || state.result)
+		error("Callback did not report the error")
+
+	memset(&state, 0, sizeof(state));
+	err = monetdb_query_async(conns[3], "SELECT MAX(x) FROM test", on_complete, &state);
+	if (err != 0)
+		error(err)
+#ifndef _WIN32
+	for (i = 0; i < 10000 && !state.done; i++)
+		usleep(1000);
+#endif
+	if (!state.done || state.err || !state.result ||
+		((monetdb_column_int32_t*) monetdb_result_fetch(state.result, 0))->data[0] != NROWS - 1)
+		error("Callback did not deliver the result")
+	monetdb_cleanup_result(conns[3], state.result);
+
+	for (i = 0; i < NCONNS; i++)
+		monetdb_disconnect(conns[i]);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,137 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 10
+#define NROWS (BATCH * NBATCHES)
+#define NGROUPS 5
+
+// the estimates of the sketches are off by a few percent at most
+#define TOLERANCE 0.07
+
+// runs a query with two bigint columns, an approximate and an exact count,
+// and checks that they are close on every row
+static int check(void* conn, const char* query, size_t nrows) {
+	monetdb_result* result = 0;
+	monetdb_column_int64_t* col[2];
+	size_t i;
+	int j;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (result->ncols != 2 || result->nrows != nrows)
+		error("Wrong result shape")
+	for (j = 0; j < 2; j++) {
+		col[j] = (monetdb_column_int64_t*) monetdb_result_fetch(result, j);
+		if (!col[j] || col[j]->type != monetdb_int64_t)
+			error("Wrong result type")
+	}
+	for (i = 0; i < nrows; i++) {
+		int64_t approx = col[0]->data[i], exact = col[1]->data[i];
+		if (approx < exact * (1 - TOLERANCE) || approx > exact * (1 + TOLERANCE)) {
+			fprintf(stderr, "%s: row %zu is %lld, expected about %lld\n", query, i, (long long) approx, (long long) exact);
+			error("Inaccurate distinct count")
+		}
+	}
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+static int64_t single(void* conn, const char* query) {
+	monetdb_result* result = 0;
+	monetdb_column_int64_t* col;
+	int64_t res;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0) {
+		fprintf(stderr, "Failure: %s\n", err);
+		return -1;
+	}
+	col = (monetdb_column_int64_t*) monetdb_result_fetch(result, 0);
+	if (result->nrows != 1 || !col || col->type != monetdb_int64_t) {
+		fprintf(stderr, "Failure: Wrong result\n");
+		return -1;
+	}
+	res = col->data[0];
+	monetdb_cleanup_result(conn, result);
+	return res;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int32_t xcol, gcol;
+	monetdb_column* input[2];
+	int i, k;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, g integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	// nothing to count: no rows, or only NULLs
+	if (single(conn, "SELECT approx_count_distinct(x) FROM test") != 0)
+		error("Wrong count of an empty table")
+	err = monetdb_query(conn, "INSERT INTO test VALUES (NULL, 1), (NULL, 2)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (single(conn, "SELECT approx_count_distinct(x) FROM test") != 0)
+		error("NULL values are counted")
+	err = monetdb_query(conn, "DELETE FROM test", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	xcol.type = gcol.type = monetdb_int32_t;
+	xcol.count = gcol.count = BATCH;
+	xcol.null_value = gcol.null_value = -1;
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	gcol.data = malloc(BATCH * sizeof(int32_t));
+	if (!xcol.data || !gcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &xcol;
+	input[1] = (monetdb_column*) &gcol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			int row = k * BATCH + i;
+			xcol.data[i] = (int32_t) ((int64_t) row * 7919 % NROWS);
+			gcol.data[i] = row % NGROUPS;
+		}
+		err = monetdb_append_columns(conn, "sys", "test", input, 2);
+		if (err != 0)
+			error(err)
+	}
+
+	if (check(conn, "SELECT approx_count_distinct(x), COUNT(DISTINCT x) FROM test", 1))
+		return -1;
+	if (check(conn, "SELECT approx_count_distinct(x % 10), COUNT(DISTINCT x % 10) FROM test WHERE x >= 0", 1))
+		return -1;
+	if (check(conn, "SELECT approx_count_distinct(x % 3000), COUNT(DISTINCT x % 3000) FROM test WHERE x >= 0", 1))
+		return -1;
+	if (check(conn, "SELECT approx_count_distinct(CAST(x AS DOUBLE)), COUNT(DISTINCT x) FROM test WHERE x >= 0", 1))
+		return -1;
+	if (check(conn, "SELECT approx_count_distinct(CAST(x % 100000 AS VARCHAR(10))), COUNT(DISTINCT x % 100000) FROM test WHERE x >= 0", 1))
+		return -1;
+	if (check(conn, "SELECT approx_count_distinct(x), COUNT(DISTINCT x) FROM test WHERE x >= 0 GROUP BY g", NGROUPS))
+		return -1;
+	if (check(conn, "SELECT approx_count_distinct(x / 7), COUNT(DISTINCT x / 7) FROM test WHERE x >= 0 GROUP BY g", NGROUPS))
+		return -1;
+	// merging the sketches of the pieces of a split plan loses nothing
+	if (single(conn, "SELECT approx_count_distinct(x) FROM test") !=
+	    single(conn, "SELECT approx_count_distinct(x) FROM test WHERE x >= 0"))
+		error("Split plan gives a different estimate")
+
+	free(xcol.data);
+	free(gcol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,108 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define NROWS 10
+#define NEXPRS 1000
+#define DEFAULT_RUNS 20
+
+static double now_ms(void) {
+#ifdef _WIN32
+	return (double) GetTickCount64();
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#endif
+}
+
+// measures the dataflow scheduling overhead: the query below compiles into a
+// plan with thousands of independent instructions that each do next to nothing
+int main(int argc, char** argv) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_result* result = 0;
+	monetdb_statement* stmt = 0;
+	monetdb_dataflow_stats stats;
+	int runs = argc > 1 ? atoi(argv[1]) : DEFAULT_RUNS;
+	double total = 0, best = -1, t;
+	char* query;
+	size_t len = 0;
+	int i;
+
+	if (runs <= 0)
+		error("Number of runs must be positive")
+	query = malloc(NEXPRS * 32 + 64);
+	if (!query)
+		error("Malloc fail")
+	len += sprintf(query + len, "SELECT SUM(x + 0)");
+	for (i = 1; i < NEXPRS; i++)
+		len += sprintf(query + len, ", SUM(x + %d)", i);
+	sprintf(query + len, " FROM test");
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (i = 0; i < NROWS; i++) {
+		char insert[64];
+		sprintf(insert, "INSERT INTO test VALUES (%d)", i);
+		err = monetdb_query(conn, insert, 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+	}
+
+	// compile once, so that only the execution of the plan is measured
+	err = monetdb_prepare(conn, query, &stmt);
+	if (err != 0)
+		error(err)
+	for (i = 0; i < runs; i++) {
+		t = now_ms();
+		err = monetdb_execute(stmt, &result, NULL);
+		if (err != 0)
+			error(err)
+		t = now_ms() - t;
+		if (result->ncols != NEXPRS)
+			error("Wrong number of result columns")
+		monetdb_cleanup_result(conn, result);
+		total += t;
+		if (best < 0 || t < best)
+			best = t;
+	}
+	printf("instructions: ~%d\n", NEXPRS * 2);
+	printf("runs: %d\n", runs);
+	printf("average: %.2f ms\n", total / runs);
+	printf("best: %.2f ms\n", best);
+
+	err = monetdb_dataflow_statistics(&stats);
+	if (err != 0)
+		error(err)
+	if (stats.core_local + stats.node_local + stats.remote > stats.executed)
+		error("Inconsistent locality statistics")
+	printf("numa nodes: %d\n", stats.numa_nodes);
+	printf("parallel instructions: %lld (core local %lld, node local %lld, remote %lld)\n",
+		(long long) stats.executed, (long long) stats.core_local, (long long) stats.node_local, (long long) stats.remote);
+	printf("routed: %lld, stolen: %lld\n", (long long) stats.routed, (long long) stats.stolen);
+	printf("memory admission: %lld admitted, %lld deferred, %lld forced\n",
+		(long long) stats.admitted, (long long) stats.deferred, (long long) stats.forced);
+
+	free(query);
+	monetdb_cleanup_statement(conn, stmt);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
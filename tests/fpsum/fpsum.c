@@ -0,0 +1,157 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 3
+#define NGROUPS 4
+
+// every triple of rows (1e100, 1, -1e100) adds exactly 1 to the sum, while a
+// naive running sum loses the 1 to rounding. the results must be exact no
+// matter how the table is split up for parallel execution.
+static int check(void* conn, const char* query, double sum, double avg) {
+	char* err;
+	monetdb_result* result = 0;
+	monetdb_column* s;
+	monetdb_column_double* a;
+	double v;
+	size_t i;
+
+	err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (result->ncols != 2 || result->nrows == 0)
+		error("Wrong result shape")
+	s = monetdb_result_fetch(result, 0);
+	a = (monetdb_column_double*) monetdb_result_fetch(result, 1);
+	if (!s || !a || (s->type != monetdb_double && s->type != monetdb_float) || a->type != monetdb_double)
+		error("Wrong result types")
+	for (i = 0; i < result->nrows; i++) {
+		if (s->type == monetdb_float)
+			v = ((monetdb_column_float*) s)->data[i];
+		else
+			v = ((monetdb_column_double*) s)->data[i];
+		if (v != sum) {
+			fprintf(stderr, "%s: sum %.17g, expected %.17g\n", query, v, sum);
+			error("Inexact sum")
+		}
+		if (a->data[i] != avg) {
+			fprintf(stderr, "%s: avg %.17g, expected %.17g\n", query, a->data[i], avg);
+			error("Inexact average")
+		}
+	}
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_result* result = 0;
+	monetdb_column_int32_t xcol, gcol;
+	monetdb_column_double zcol;
+	monetdb_column_float fcol;
+	monetdb_column* input[4];
+	monetdb_column_double* zres;
+	int i, k;
+	double triples = BATCH * NBATCHES / 3;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, g integer, z double, f real)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	xcol.type = gcol.type = monetdb_int32_t;
+	xcol.count = gcol.count = zcol.count = fcol.count = BATCH;
+	xcol.null_value = gcol.null_value = -1;
+	zcol.type = monetdb_double;
+	zcol.null_value = -1;
+	fcol.type = monetdb_float;
+	fcol.null_value = -1;
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	gcol.data = malloc(BATCH * sizeof(int32_t));
+	zcol.data = malloc(BATCH * sizeof(double));
+	fcol.data = malloc(BATCH * sizeof(float));
+	if (!xcol.data || !gcol.data || !zcol.data || !fcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &xcol;
+	input[1] = (monetdb_column*) &gcol;
+	input[2] = (monetdb_column*) &zcol;
+	input[3] = (monetdb_column*) &fcol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			int row = k * BATCH + i;
+			xcol.data[i] = row;
+			gcol.data[i] = row / 3 % NGROUPS;
+			zcol.data[i] = row % 3 == 0 ? 1e100 : row % 3 == 1 ? 1 : -1e100;
+			fcol.data[i] = row % 3 == 0 ? 1e30f : row % 3 == 1 ? 1 : -1e30f;
+		}
+		err = monetdb_append_columns(conn, "sys", "test", input, 4);
+		if (err != 0)
+			error(err)
+	}
+
+	if (check(conn, "SELECT SUM(z), AVG(z) FROM test", triples, 1.0 / 3))
+		return -1;
+	if (check(conn, "SELECT SUM(z), AVG(z) FROM test WHERE x >= 0", triples, 1.0 / 3))
+		return -1;
+	if (check(conn, "SELECT SUM(f), AVG(f) FROM test WHERE x >= 0", triples, 1.0 / 3))
+		return -1;
+	if (check(conn, "SELECT SUM(z), AVG(z) FROM test WHERE x >= 0 GROUP BY g", triples / NGROUPS, 1.0 / 3))
+		return -1;
+	if (check(conn, "SELECT SUM(f), AVG(f) FROM test WHERE x >= 0 GROUP BY g", triples / NGROUPS, 1.0 / 3))
+		return -1;
+
+	// nothing to sum is NULL
+	err = monetdb_query(conn, "SELECT SUM(z), AVG(z) FROM test WHERE x < 0", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	zres = (monetdb_column_double*) monetdb_result_fetch(result, 0);
+	if (!zres || result->nrows != 1 || !zres->is_null(zres->data[0]))
+		error("Sum of nothing is not NULL")
+	zres = (monetdb_column_double*) monetdb_result_fetch(result, 1);
+	if (!zres || !zres->is_null(zres->data[0]))
+		error("Average of nothing is not NULL")
+	monetdb_cleanup_result(conn, result);
+
+	// the sum overflows, the average does not
+	err = monetdb_query(conn, "CREATE TABLE big (z double, g integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO big VALUES (1e308, 1), (1e308, 1), (1e308, 2), (-1e308, 2), (1e308, 2)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT AVG(z) FROM big WHERE g = 1", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	zres = (monetdb_column_double*) monetdb_result_fetch(result, 0);
+	if (!zres || result->nrows != 1 || zres->data[0] != 1e308)
+		error("Wrong average of large values")
+	monetdb_cleanup_result(conn, result);
+	err = monetdb_query(conn, "SELECT AVG(z) FROM big GROUP BY g ORDER BY g", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	zres = (monetdb_column_double*) monetdb_result_fetch(result, 0);
+	if (!zres || result->nrows != 2 || zres->data[0] != 1e308 || zres->data[1] != 1e308 / 3)
+		error("Wrong grouped average of large values")
+	monetdb_cleanup_result(conn, result);
+	if (monetdb_query(conn, "SELECT SUM(z) FROM big WHERE g = 1", 1, &result, NULL, NULL) == 0)
+		error("Overflowing sum accepted")
+
+	free(xcol.data);
+	free(gcol.data);
+	free(zcol.data);
+	free(fcol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
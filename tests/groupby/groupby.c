@@ -0,0 +1,98 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 12
+#define NROWS (BATCH * NBATCHES)
+
+// runs a query that returns the number of groups and a checksum over them.
+// with enough rows the groups are built in parallel over hash partitions of
+// the input, which must give the same groups as a sequential scan.
+static int check(void* conn, const char* query, int64_t ngroups, int64_t sum) {
+	monetdb_result* result = 0;
+	monetdb_column_int64_t* col[2];
+	int j;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (result->ncols != 2 || result->nrows != 1)
+		error("Wrong result shape")
+	for (j = 0; j < 2; j++) {
+		col[j] = (monetdb_column_int64_t*) monetdb_result_fetch(result, j);
+		if (!col[j] || col[j]->type != monetdb_int64_t)
+			error("Wrong result type")
+	}
+	if (col[0]->data[0] != ngroups || col[1]->data[0] != sum) {
+		fprintf(stderr, "%s: %lld %lld, expected %lld %lld\n", query,
+			(long long) col[0]->data[0], (long long) col[1]->data[0], (long long) ngroups, (long long) sum);
+		error("Wrong grouping result")
+	}
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int32_t xcol;
+	monetdb_column* input[1];
+	int64_t sum;
+	int i, k;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	xcol.type = monetdb_int32_t;
+	xcol.count = BATCH;
+	xcol.null_value = -1;
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	if (!xcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &xcol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++)
+			xcol.data[i] = k * BATCH + i;
+		err = monetdb_append_columns(conn, "sys", "test", input, 1);
+		if (err != 0)
+			error(err)
+	}
+
+	// the first row of every group, weighted by the size of the group
+	sum = 0;
+	for (i = 0; i < NROWS; i++)
+		sum += i < 700001 ? (int64_t) i * (i + 700001 < NROWS ? 2 : 1) : 0;
+	if (check(conn, "SELECT COUNT(*), SUM(CAST(m AS BIGINT) * c) FROM (SELECT x % 700001 AS k, COUNT(*) AS c, MIN(x) AS m FROM test GROUP BY k) s", 700001, sum))
+		return -1;
+	if (check(conn, "SELECT COUNT(*), SUM(c) FROM (SELECT x % 1000 AS a, x % 1777 AS b, COUNT(*) AS c FROM test GROUP BY a, b) s", NROWS, NROWS))
+		return -1;
+	if (check(conn, "SELECT COUNT(*), SUM(c) FROM (SELECT x % 1000 AS a, x % 3 AS b, COUNT(*) AS c FROM test GROUP BY a, b) s", 3000, NROWS))
+		return -1;
+	if (check(conn, "SELECT COUNT(*), SUM(c) FROM (SELECT CAST(x % 600011 AS VARCHAR(10)) AS k, COUNT(*) AS c FROM test GROUP BY k) s", 600011, NROWS))
+		return -1;
+	if (check(conn, "SELECT COUNT(*), SUM(c) FROM (SELECT CAST(x % 800011 AS DOUBLE) AS k, COUNT(*) AS c FROM test GROUP BY k) s", 800011, NROWS))
+		return -1;
+	// all NULLs end up in a single group
+	sum = 0;
+	for (i = 0; i < 700001; i++)
+		if (i % 5 != 0 || (i + 700001 < NROWS && (i + 700001) % 5 != 0))
+			sum++;
+	if (check(conn, "SELECT COUNT(*), COUNT(k) FROM (SELECT CASE WHEN x % 5 = 0 THEN NULL ELSE x % 700001 END AS k FROM test GROUP BY k) s", sum + 1, sum))
+		return -1;
+
+	free(xcol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
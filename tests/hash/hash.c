@@ -0,0 +1,107 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 12
+#define NROWS (BATCH * NBATCHES)
+#define NKEYS 700001
+
+// runs a query that returns a count and a sum. the joins run on the whole
+// table at once, so the hash table on the inner side is large enough to be
+// built on several threads, and must link the same rows as a sequential build.
+static int check(void* conn, const char* query, int64_t cnt, int64_t sum) {
+	monetdb_result* result = 0;
+	monetdb_column_int64_t* col[2];
+	int j;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (result->ncols != 2 || result->nrows != 1)
+		error("Wrong result shape")
+	for (j = 0; j < 2; j++) {
+		col[j] = (monetdb_column_int64_t*) monetdb_result_fetch(result, j);
+		if (!col[j] || col[j]->type != monetdb_int64_t)
+			error("Wrong result type")
+	}
+	if (col[0]->data[0] != cnt || col[1]->data[0] != sum) {
+		fprintf(stderr, "%s: %lld %lld, expected %lld %lld\n", query,
+			(long long) col[0]->data[0], (long long) col[1]->data[0], (long long) cnt, (long long) sum);
+		error("Wrong join result")
+	}
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int32_t xcol;
+	monetdb_column_double dcol, ucol;
+	monetdb_column* input[3];
+	int64_t cnt, sum;
+	int i, k;
+
+	// sequential plans, so the tables are not split up
+	err = monetdb_startup(NULL, 1, 1);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, d double, u double)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	xcol.type = monetdb_int32_t;
+	dcol.type = ucol.type = monetdb_double;
+	xcol.count = dcol.count = ucol.count = BATCH;
+	xcol.null_value = -1;
+	dcol.null_value = ucol.null_value = -1;
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	dcol.data = malloc(BATCH * sizeof(double));
+	ucol.data = malloc(BATCH * sizeof(double));
+	if (!xcol.data || !dcol.data || !ucol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &xcol;
+	input[1] = (monetdb_column*) &dcol;
+	input[2] = (monetdb_column*) &ucol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			xcol.data[i] = k * BATCH + i;
+			dcol.data[i] = (k * BATCH + i) % NKEYS;
+			ucol.data[i] = (k * BATCH + i) * 7 % NROWS * 0.5;
+		}
+		err = monetdb_append_columns(conn, "sys", "test", input, 3);
+		if (err != 0)
+			error(err)
+	}
+
+	// unique keys, every row matches itself
+	sum = (int64_t) NROWS * (NROWS - 1) / 2;
+	if (check(conn, "SELECT COUNT(*), SUM(CAST(b.x AS BIGINT)) FROM test a, test b WHERE a.u = b.u", NROWS, sum))
+		return -1;
+	// duplicate keys, the first rows come in pairs that match each other
+	cnt = sum = 0;
+	for (i = 0; i < NROWS; i++) {
+		int n = i % NKEYS + NKEYS < NROWS ? 2 : 1;
+		cnt += n;
+		sum += (int64_t) i * n;
+	}
+	if (check(conn, "SELECT COUNT(*), SUM(CAST(b.x AS BIGINT)) FROM test a, test b WHERE a.d = b.d", cnt, sum))
+		return -1;
+	// a few keys against all rows, both rows with a key must be found
+	if (check(conn, "SELECT COUNT(*), SUM(CAST(x AS BIGINT)) FROM test WHERE d IN (SELECT u FROM test WHERE x < 200)", 2 * 100, 7 * 99 * 100 + 100 * NKEYS))
+		return -1;
+
+	free(xcol.data);
+	free(dcol.data);
+	free(ucol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
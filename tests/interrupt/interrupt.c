@@ -0,0 +1,108 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define NROWS 30000
+// a nested loop join over all pairs without any matches, runs for seconds unless it is stopped
+#define SLOW_QUERY "SELECT COUNT(*) FROM test a, test b WHERE a.x > b.x + 1000000"
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_query_handle* handle = 0;
+	monetdb_result* result = 0;
+	int i;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+
+	err = monetdb_query(conn, "CREATE TABLE test (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	{
+		monetdb_column_int32_t xcol;
+		monetdb_column* input[1];
+		xcol.type = monetdb_int32_t;
+		xcol.count = NROWS;
+		xcol.null_value = -1;
+		xcol.data = malloc(sizeof(int32_t) * NROWS);
+		if (!xcol.data)
+			error("Malloc fail")
+		for (i = 0; i < NROWS; i++)
+			xcol.data[i] = i;
+		input[0] = (monetdb_column*) &xcol;
+		err = monetdb_append_columns(conn, "sys", "test", input, 1);
+		free(xcol.data);
+		if (err != 0)
+			error(err)
+	}
+
+	// a query that runs past its timeout fails
+	err = monetdb_set_query_timeout(conn, 100);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, SLOW_QUERY, 1, &result, NULL, NULL);
+	// caught between instructions or inside the kernel loop
+	if (err == 0 || (!strstr(err, "timeout") && !strstr(err, "interrupted")))
+		error("Query did not time out")
+	err = monetdb_set_query_timeout(conn, 0);
+	if (err != 0)
+		error(err)
+
+	// the connection is usable again, and the failed query left no transaction behind
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM test", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (((monetdb_column_int64_t*) monetdb_result_fetch(result, 0))->data[0] != NROWS)
+		error("Wrong result after timeout")
+	monetdb_cleanup_result(conn, result);
+
+	// interrupt a query running on another thread
+	err = monetdb_query_submit(conn, SLOW_QUERY, &handle);
+	if (err != 0)
+		error(err)
+#ifndef _WIN32
+	usleep(100000);
+#endif
+	err = monetdb_interrupt(conn);
+	if (err != 0)
+		error(err)
+	err = monetdb_query_collect(handle, &result, NULL);
+	if (err == 0 || !strstr(err, "interrupted"))
+		error("Query was not interrupted")
+
+	// an interrupted update is rolled back
+	err = monetdb_query_submit(conn, "UPDATE test SET x = (" SLOW_QUERY ")", &handle);
+	if (err != 0)
+		error(err)
+#ifndef _WIN32
+	usleep(100000);
+#endif
+	err = monetdb_interrupt(conn);
+	if (err != 0)
+		error(err)
+	err = monetdb_query_collect(handle, NULL, NULL);
+	if (err == 0)
+		error("Update was not interrupted")
+	err = monetdb_query(conn, "SELECT MAX(x) FROM test", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (((monetdb_column_int32_t*) monetdb_result_fetch(result, 0))->data[0] != NROWS - 1)
+		error("Interrupted update was not rolled back")
+	monetdb_cleanup_result(conn, result);
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
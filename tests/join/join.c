@@ -0,0 +1,143 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 20
+#define PRIME 2000003
+#define DEFAULT_RUNS 5
+
+static double now_ms(void) {
+#ifdef _WIN32
+	return (double) GetTickCount64();
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#endif
+}
+
+static int run(void* conn, const char* query, int64_t* res, double* first, double* rest, int runs) {
+	monetdb_result* result = 0;
+	monetdb_column_int64_t* col[2];
+	double t;
+	char* err;
+	int i, j;
+
+	*rest = 0;
+	for (i = 0; i < runs; i++) {
+		t = now_ms();
+		err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+		if (err != 0)
+			error(err)
+		t = now_ms() - t;
+		if (i == 0)
+			*first = t;
+		else
+			*rest += t;
+		if (result->ncols != 2 || result->nrows != 1)
+			error("Wrong result shape")
+		for (j = 0; j < 2; j++) {
+			col[j] = (monetdb_column_int64_t*) monetdb_result_fetch(result, j);
+			if (!col[j] || col[j]->type != monetdb_int64_t)
+				error("Wrong result type")
+			res[j] = col[j]->data[0];
+		}
+		monetdb_cleanup_result(conn, result);
+	}
+	if (runs > 1)
+		*rest /= runs - 1;
+	return 0;
+}
+
+static int load(void* conn) {
+	monetdb_column_int32_t acol, bcol, xcol;
+	monetdb_column* input[3];
+	char* err;
+	int i, k;
+
+	err = monetdb_query(conn, "CREATE TABLE test (a integer, b integer, x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	acol.type = bcol.type = xcol.type = monetdb_int32_t;
+	acol.count = bcol.count = xcol.count = BATCH;
+	acol.null_value = bcol.null_value = xcol.null_value = -1;
+	acol.data = malloc(BATCH * sizeof(int32_t));
+	bcol.data = malloc(BATCH * sizeof(int32_t));
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	if (!acol.data || !bcol.data || !xcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &acol;
+	input[1] = (monetdb_column*) &bcol;
+	input[2] = (monetdb_column*) &xcol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			int64_t row = k * BATCH + i;
+			acol.data[i] = (int32_t) (row * 7 % PRIME);
+			bcol.data[i] = (int32_t) (row * 13 % PRIME);
+			xcol.data[i] = (int32_t) row;
+		}
+		err = monetdb_append_columns(conn, "sys", "test", input, 3);
+		if (err != 0)
+			error(err)
+	}
+	free(acol.data);
+	free(bcol.data);
+	free(xcol.data);
+	return 0;
+}
+
+// the debug flags of the kernel, with NORADIXMASK set BATjoin builds a hash
+// table where it would otherwise partition both sides
+extern int GDKdebug;
+#define NORADIXMASK (1 << 30)
+
+// joins two large unsorted key columns with the sequential plan, so that
+// there is a single join over all rows. it runs once as a radix join, which
+// partitions both sides on the hash of the keys and joins the partitions on
+// all threads, and once as a hash join on the same plan and input.
+int main(int argc, char** argv) {
+	const char* query = "SELECT COUNT(*), SUM(CAST(l.x AS BIGINT) * 3 + r.x) FROM test l, test r WHERE l.a = r.b";
+	int runs = argc > 1 ? atoi(argv[1]) : DEFAULT_RUNS;
+	int64_t res[2][2];
+	double first[2], rest[2];
+	int hash, debug;
+	void* conn;
+	char* err;
+
+	if (runs <= 0)
+		error("Number of runs must be positive")
+	err = monetdb_startup(NULL, 1, 1);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	if (load(conn))
+		return -1;
+	debug = GDKdebug;
+	for (hash = 0; hash < 2; hash++) {
+		GDKdebug = hash ? debug | NORADIXMASK : debug & ~NORADIXMASK;
+		if (run(conn, query, res[hash], &first[hash], &rest[hash], runs))
+			return -1;
+	}
+	GDKdebug = debug;
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	if (res[0][0] != res[1][0] || res[0][1] != res[1][1])
+		error("Radix join gives a different result")
+
+	printf("rows: %d\n", BATCH * NBATCHES);
+	printf("matches: %lld\n", (long long) res[0][0]);
+	printf("radix join: %.2f ms first run, %.2f ms average\n", first[0], rest[0]);
+	printf("hash join: %.2f ms first run, %.2f ms average\n", first[1], rest[1]);
+	return 0;
+}
@@ -0,0 +1,129 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 3
+
+// the key checks of a bulk insert or update are split up with the rest of the
+// plan, duplicates that end up in different pieces must still be found
+static int violates(void* conn, const char* query, const char* constraint) {
+	char* err = monetdb_query(conn, (char*) query, 1, NULL, NULL, NULL);
+	if (err == 0) {
+		fprintf(stderr, "%s: no %s violation\n", query, constraint);
+		return 0;
+	}
+	if (strstr(err, constraint) == NULL) {
+		fprintf(stderr, "%s: %s\n", query, err);
+		return 0;
+	}
+	return 1;
+}
+
+static int count(void* conn, const char* table, int64_t expected) {
+	char query[64], *err;
+	monetdb_result* result = 0;
+	monetdb_column_int64_t* col;
+
+	sprintf(query, "SELECT COUNT(*) FROM %s", table);
+	err = monetdb_query(conn, query, 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t*) monetdb_result_fetch(result, 0);
+	if (!col || result->nrows != 1 || col->data[0] != expected)
+		error("Wrong row count")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int32_t xcol;
+	monetdb_column* input[1];
+	int i, k;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	xcol.type = monetdb_int32_t;
+	xcol.count = BATCH;
+	xcol.null_value = -1;
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	if (!xcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &xcol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++)
+			xcol.data[i] = k * BATCH + i;
+		err = monetdb_append_columns(conn, "sys", "test", input, 1);
+		if (err != 0)
+			error(err)
+	}
+
+	err = monetdb_query(conn, "CREATE TABLE pk (a integer PRIMARY KEY)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE uk (a integer UNIQUE, b integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE mk (a integer, b integer, PRIMARY KEY (a, b))", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	// every value twice, half a table apart
+	if (!violates(conn, "INSERT INTO pk SELECT x % 150000 FROM test", "PRIMARY KEY constraint"))
+		return -1;
+	// a single duplicate of the first row in the last row
+	if (!violates(conn, "INSERT INTO pk SELECT CASE WHEN x = 299999 THEN 0 ELSE x END FROM test", "PRIMARY KEY constraint"))
+		return -1;
+	if (!violates(conn, "INSERT INTO mk SELECT x % 150000, x / 200000 FROM test", "PRIMARY KEY constraint"))
+		return -1;
+	if (count(conn, "pk", 0) || count(conn, "mk", 0))
+		return -1;
+
+	// the in-memory store appends at most a batch at a time
+	err = monetdb_query(conn, "INSERT INTO pk SELECT x FROM test WHERE x % 3 = 0", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO mk SELECT x % 150000, x / 150000 FROM test WHERE x % 3 = 0", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	// NULLs never violate a unique constraint
+	err = monetdb_query(conn, "INSERT INTO uk SELECT CASE WHEN x % 2 = 0 THEN NULL ELSE x END, x FROM test WHERE x % 3 = 0", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (count(conn, "pk", BATCH) || count(conn, "mk", BATCH) || count(conn, "uk", BATCH))
+		return -1;
+
+	// against the keys that are already there
+	if (!violates(conn, "INSERT INTO pk SELECT x + 3 FROM test WHERE x > 299990", "PRIMARY KEY constraint"))
+		return -1;
+	if (!violates(conn, "UPDATE pk SET a = a % 150000", "PRIMARY KEY constraint"))
+		return -1;
+	if (!violates(conn, "UPDATE uk SET a = b % 150000", "UNIQUE constraint"))
+		return -1;
+	if (!violates(conn, "UPDATE mk SET b = 0", "PRIMARY KEY constraint"))
+		return -1;
+	err = monetdb_query(conn, "UPDATE pk SET a = a + 300000", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (count(conn, "pk", BATCH))
+		return -1;
+
+	free(xcol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,87 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define NROWS 100000
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_result* result = 0;
+	int i;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+
+	err = monetdb_query(conn, "CREATE TABLE test (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	{
+		monetdb_column_int32_t xcol;
+		monetdb_column* input[1];
+		xcol.type = monetdb_int32_t;
+		xcol.count = NROWS;
+		xcol.null_value = -1;
+		xcol.data = malloc(sizeof(int32_t) * NROWS);
+		if (!xcol.data)
+			error("Malloc fail")
+		for (i = 0; i < NROWS; i++)
+			xcol.data[i] = i;
+		input[0] = (monetdb_column*) &xcol;
+		err = monetdb_append_columns(conn, "sys", "test", input, 1);
+		free(xcol.data);
+		if (err != 0)
+			error(err)
+	}
+
+	// intermediates of 400KB do not fit in a budget of 64KB
+	err = monetdb_set_query_memory_limit(conn, 64 * 1024);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT x * 2 FROM test WHERE x > 10", 1, &result, NULL, NULL);
+	if (err == 0 || !strstr(err, "memory budget"))
+		error("Query exceeded its memory budget")
+	err = monetdb_query(conn, "SELECT COUNT(*) FROM test WHERE x < 10", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (((monetdb_column_int64_t*) monetdb_result_fetch(result, 0))->data[0] != 10)
+		error("Wrong result within the memory budget")
+	monetdb_cleanup_result(conn, result);
+
+	err = monetdb_set_query_memory_limit(conn, 0);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT x * 2 FROM test WHERE x > 10", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (result->nrows != NROWS - 11)
+		error("Wrong result without a memory budget")
+	monetdb_cleanup_result(conn, result);
+
+	// without a database directory nothing can be moved to disk, so large allocations fail beyond the global budget
+	err = monetdb_set_memory_limit(1024 * 1024);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT x * 2 FROM test WHERE x > 10", 1, &result, NULL, NULL);
+	if (err == 0 || !strstr(err, "memory budget"))
+		error("Query exceeded the global memory budget")
+	err = monetdb_set_memory_limit(0);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "SELECT x * 2 FROM test WHERE x > 10", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	monetdb_cleanup_result(conn, result);
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,136 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define NROWS 1000
+#define NCALLS 2000
+
+#ifndef _WIN32
+static double now_usec(void) {
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000000.0 + tv.tv_usec;
+}
+#endif
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_result* result = 0;
+	monetdb_statement* stmt = 0;
+	char query[BUFSIZ];
+	long affected_rows = 0;
+	int i;
+#ifndef _WIN32
+	double start, query_time, execute_time;
+#endif
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, y string, z double)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	err = monetdb_prepare(conn, "INSERT INTO test VALUES (?, ?, ?)", &stmt);
+	if (err != 0)
+		error(err)
+	if (stmt->nparam != 3 || stmt->type[0] != monetdb_int32_t || stmt->type[1] != monetdb_str || stmt->type[2] != monetdb_double)
+		error("Wrong parameter description for INSERT")
+	for (i = 0; i < NROWS; i++) {
+		snprintf(query, BUFSIZ, "value %d", i);
+		if ((err = monetdb_bind_int32_t(stmt, 0, i)) != 0 ||
+			(err = (i % 10 == 0 ? monetdb_bind_null(stmt, 1) : monetdb_bind_str(stmt, 1, query))) != 0 ||
+			(err = monetdb_bind_double(stmt, 2, i / 2.0)) != 0)
+			error(err)
+		err = monetdb_execute(stmt, NULL, &affected_rows);
+		if (err != 0)
+			error(err)
+		if (affected_rows != 1)
+			error("Wrong number of affected rows for INSERT")
+	}
+	monetdb_cleanup_statement(conn, stmt);
+
+	err = monetdb_prepare(conn, "SELECT y, z FROM test WHERE x = ?", &stmt);
+	if (err != 0)
+		error(err)
+	if (stmt->nparam != 1)
+		error("Wrong number of parameters for SELECT")
+
+	// compare the results of the prepared statement with regular queries
+	for (i = 0; i < NROWS; i += 37) {
+		monetdb_result* check = 0;
+		monetdb_column_str *ycol, *ycheck;
+		monetdb_column_double *zcol, *zcheck;
+
+		err = monetdb_bind_int32_t(stmt, 0, i);
+		if (err != 0)
+			error(err)
+		err = monetdb_execute(stmt, &result, NULL);
+		if (err != 0)
+			error(err)
+		snprintf(query, BUFSIZ, "SELECT y, z FROM test WHERE x = %d", i);
+		err = monetdb_query(conn, query, 1, &check, NULL, NULL);
+		if (err != 0)
+			error(err)
+		if (result->nrows != 1 || check->nrows != 1 || result->ncols != 2)
+			error("Wrong result size")
+		ycol = (monetdb_column_str *) monetdb_result_fetch(result, 0);
+		ycheck = (monetdb_column_str *) monetdb_result_fetch(check, 0);
+		zcol = (monetdb_column_double *) monetdb_result_fetch(result, 1);
+		zcheck = (monetdb_column_double *) monetdb_result_fetch(check, 1);
+		if (!ycol || !ycheck || !zcol || !zcheck)
+			error("Fetch failed")
+		if ((ycol->data[0] == NULL) != (ycheck->data[0] == NULL) ||
+			(ycol->data[0] && strcmp(ycol->data[0], ycheck->data[0]) != 0) ||
+			zcol->data[0] != zcheck->data[0])
+			error("Prepared result differs from query result")
+		monetdb_cleanup_result(conn, result);
+		monetdb_cleanup_result(conn, check);
+	}
+
+#ifndef _WIN32
+	// per-call latency of a point lookup, parsed every time versus prepared once
+	start = now_usec();
+	for (i = 0; i < NCALLS; i++) {
+		snprintf(query, BUFSIZ, "SELECT y, z FROM test WHERE x = %d", i % NROWS);
+		err = monetdb_query(conn, query, 1, &result, NULL, NULL);
+		if (err != 0)
+			error(err)
+		monetdb_cleanup_result(conn, result);
+	}
+	query_time = (now_usec() - start) / NCALLS;
+
+	start = now_usec();
+	for (i = 0; i < NCALLS; i++) {
+		err = monetdb_bind_int32_t(stmt, 0, i % NROWS);
+		if (err != 0)
+			error(err)
+		err = monetdb_execute(stmt, &result, NULL);
+		if (err != 0)
+			error(err)
+		monetdb_cleanup_result(conn, result);
+	}
+	execute_time = (now_usec() - start) / NCALLS;
+
+	printf("monetdb_query:   %.1f usec/call\n", query_time);
+	printf("monetdb_execute: %.1f usec/call\n", execute_time);
+#endif
+
+	monetdb_cleanup_statement(conn, stmt);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
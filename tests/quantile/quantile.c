@@ -0,0 +1,129 @@
+#include "embedded.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 10
+#define NROWS (BATCH * NBATCHES)
+#define NGROUPS 7
+
+// runs a query with a single double column and checks every row against the
+// expected values, which are allowed to be off by at most tol.
+static int check(void* conn, const char* query, const double* expected, size_t nrows, double tol) {
+	monetdb_result* result = 0;
+	monetdb_column_double* col;
+	size_t i;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (result->ncols != 1 || result->nrows != nrows)
+		error("Wrong result shape")
+	col = (monetdb_column_double*) monetdb_result_fetch(result, 0);
+	if (!col || col->type != monetdb_double)
+		error("Wrong result type")
+	for (i = 0; i < nrows; i++) {
+		int isnull = col->is_null(col->data[i]);
+		if (isnull != isnan(expected[i]) || (!isnull && fabs(col->data[i] - expected[i]) > tol)) {
+			fprintf(stderr, "%s: row %zu is %.17g, expected %.17g\n", query, i, col->data[i], expected[i]);
+			error("Wrong quantile")
+		}
+	}
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int32_t xcol, gcol;
+	monetdb_column* input[2];
+	double expected[NGROUPS];
+	int i, k;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+
+	// a few values are summarized exactly
+	err = monetdb_query(conn, "CREATE TABLE small (x integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	expected[0] = NAN;
+	if (check(conn, "SELECT approx_median(x) FROM small", expected, 1, 0))
+		return -1;
+	err = monetdb_query(conn, "INSERT INTO small VALUES (4), (1), (NULL), (3), (10)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	expected[0] = 3.5;
+	if (check(conn, "SELECT approx_median(x) FROM small", expected, 1, 0))
+		return -1;
+	expected[0] = 1;
+	if (check(conn, "SELECT approx_quantile(x, 0) FROM small", expected, 1, 0))
+		return -1;
+	expected[0] = 10;
+	if (check(conn, "SELECT approx_quantile(x, 1) FROM small", expected, 1, 0))
+		return -1;
+	if (monetdb_query(conn, "SELECT approx_quantile(x, 1.5) FROM small", 1, NULL, NULL, NULL) == 0)
+		error("Quantile out of range accepted")
+
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, g integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	xcol.type = gcol.type = monetdb_int32_t;
+	xcol.count = gcol.count = BATCH;
+	xcol.null_value = gcol.null_value = -1;
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	gcol.data = malloc(BATCH * sizeof(int32_t));
+	if (!xcol.data || !gcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &xcol;
+	input[1] = (monetdb_column*) &gcol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			int row = k * BATCH + i;
+			// a permutation of 0..NROWS-1, so the input is not sorted
+			xcol.data[i] = (int32_t) ((int64_t) row * 7919 % NROWS);
+			gcol.data[i] = row % NGROUPS;
+		}
+		err = monetdb_append_columns(conn, "sys", "test", input, 2);
+		if (err != 0)
+			error(err)
+	}
+
+	// the rank of an approximate quantile is off by well under a percent,
+	// whether the table is split up or not. the extreme quantiles are exact.
+	expected[0] = (NROWS - 1) / 2.0;
+	if (check(conn, "SELECT approx_median(x) FROM test WHERE x >= 0", expected, 1, NROWS / 100.0))
+		return -1;
+	expected[0] = 0.9 * (NROWS - 1);
+	if (check(conn, "SELECT approx_quantile(x, 0.9) FROM test WHERE x >= 0", expected, 1, NROWS / 100.0))
+		return -1;
+	expected[0] = 0.01 * (NROWS - 1);
+	if (check(conn, "SELECT approx_quantile(x, 0.01) FROM test WHERE x >= 0", expected, 1, NROWS / 1000.0))
+		return -1;
+	expected[0] = NROWS - 1;
+	if (check(conn, "SELECT approx_quantile(x, 1) FROM test WHERE x >= 0", expected, 1, 0))
+		return -1;
+	for (i = 0; i < NGROUPS; i++)
+		expected[i] = (NROWS - 1) / 2.0;
+	if (check(conn, "SELECT approx_median(x) FROM test WHERE x >= 0 GROUP BY g ORDER BY g", expected, NGROUPS, NROWS / 100.0))
+		return -1;
+	for (i = 0; i < NGROUPS; i++)
+		expected[i] = 0.25 * (NROWS - 1);
+	if (check(conn, "SELECT approx_quantile(x, 0.25) FROM test WHERE x >= 0 GROUP BY g ORDER BY g", expected, NGROUPS, NROWS / 100.0))
+		return -1;
+
+	free(xcol.data);
+	free(gcol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
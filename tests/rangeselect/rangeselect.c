@@ -0,0 +1,127 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define LARGE 131072
+
+// runs a count query and checks its result
+static int check(void* conn, const char* query, int64_t expected) {
+	monetdb_result* result = 0;
+	monetdb_column_int64_t* col;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	col = (monetdb_column_int64_t*) monetdb_result_fetch(result, 0);
+	if (result->nrows != 1 || !col || col->type != monetdb_int64_t)
+		error("Wrong result")
+	if (col->data[0] != expected) {
+		fprintf(stderr, "%s: %lld, expected %lld\n", query, (long long) col->data[0], (long long) expected);
+		error("Wrong count")
+	}
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+// the values are 0 up to n (n excluded) but for the last one of an odd
+// count, with every pair swapped so that the columns are not sorted
+static int64_t value(int64_t row) {
+	return row ^ 1;
+}
+
+// range selects on computed (transient) columns of every type with a
+// vectorized kernel, which select all or all but one of the values
+static int check_all(void* conn, int64_t n) {
+	static const char* queries[] = {
+		"SELECT COUNT(*) FROM (SELECT i + 0 AS v FROM test) s WHERE v BETWEEN %d AND %lld",
+		"SELECT COUNT(*) FROM (SELECT l + 0 AS v FROM test) s WHERE v BETWEEN %d AND %lld",
+		"SELECT COUNT(*) FROM (SELECT f + 0 AS v FROM test) s WHERE v BETWEEN %d AND %lld",
+		"SELECT COUNT(*) FROM (SELECT d + 0 AS v FROM test) s WHERE v BETWEEN %d AND %lld",
+	};
+	char query[200];
+	size_t i;
+	for (i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) {
+		snprintf(query, sizeof(query), queries[i], 0, (long long) n);
+		if (check(conn, query, n))
+			return -1;
+		// 0 is the value of the second row
+		snprintf(query, sizeof(query), queries[i], 1, (long long) n);
+		if (check(conn, query, n >= 2 ? n - 1 : n))
+			return -1;
+	}
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int32_t icol;
+	monetdb_column_int64_t lcol;
+	monetdb_column_float fcol;
+	monetdb_column_double dcol;
+	monetdb_column* input[4];
+	// results are allocated in multiples of 256 oids, a vector store past
+	// the last selected value is only caught when the input fills them
+	static const int sizes[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 31, 32, 33, 253, 254, 255, 256, 512, 1024, LARGE};
+	int64_t n = 0;
+	int i, k;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (i integer, l bigint, f real, d double)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	icol.type = monetdb_int32_t;
+	lcol.type = monetdb_int64_t;
+	fcol.type = monetdb_float;
+	dcol.type = monetdb_double;
+	icol.null_value = -1;
+	lcol.null_value = -1;
+	fcol.null_value = -1;
+	dcol.null_value = -1;
+	icol.data = malloc(LARGE * sizeof(int32_t));
+	lcol.data = malloc(LARGE * sizeof(int64_t));
+	fcol.data = malloc(LARGE * sizeof(float));
+	dcol.data = malloc(LARGE * sizeof(double));
+	if (!icol.data || !lcol.data || !fcol.data || !dcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &icol;
+	input[1] = (monetdb_column*) &lcol;
+	input[2] = (monetdb_column*) &fcol;
+	input[3] = (monetdb_column*) &dcol;
+
+	// the table grows to each size in turn, so the last vector of the
+	// kernels is full as well as partial
+	for (k = 0; k < (int) (sizeof(sizes) / sizeof(sizes[0])); k++) {
+		int cnt = sizes[k] - (int) n;
+		for (i = 0; i < cnt; i++) {
+			icol.data[i] = (int32_t) value(n + i);
+			lcol.data[i] = value(n + i);
+			fcol.data[i] = (float) value(n + i);
+			dcol.data[i] = (double) value(n + i);
+		}
+		icol.count = lcol.count = fcol.count = dcol.count = cnt;
+		err = monetdb_append_columns(conn, "sys", "test", input, 4);
+		if (err != 0)
+			error(err)
+		n += cnt;
+		if (check_all(conn, n))
+			return -1;
+	}
+
+	free(icol.data);
+	free(lcol.data);
+	free(fcol.data);
+	free(dcol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,194 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_result* result = 0;
+	monetdb_column_view* view;
+	monetdb_column_int32_t* col;
+	size_t r;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, y string, z double)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO test VALUES (42, 'Hello', 1.5), (NULL, 'World', NULL), (7, NULL, 3.25), (42, 'Hello', 0)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	// zero-copy views must agree with the converted columns
+	err = monetdb_query(conn, "SELECT x, z, x + 1 FROM test", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	view = monetdb_result_fetch_view(result, 0);
+	col = (monetdb_column_int32_t*) monetdb_result_fetch(result, 0);
+	if (!view || !col || view->type != monetdb_int32_t || !view->data || view->count != 4)
+		error("Invalid integer view")
+	for (r = 0; r < view->count; r++) {
+		if (((const int32_t*) view->data)[r] != col->data[r])
+			error("Integer view differs from fetched column")
+	}
+	if (((const int32_t*) view->data)[1] != *(const int32_t*) view->null_value)
+		error("Integer view has wrong nil")
+	view = monetdb_result_fetch_view(result, 1);
+	if (!view || view->type != monetdb_double || ((const double*) view->data)[2] != 3.25)
+		error("Invalid double view")
+	if (monetdb_result_fetch_view(result, 1) != view)
+		error("View not cached")
+	monetdb_cleanup_result(conn, result);
+
+	// string views read straight from the var-heap
+	err = monetdb_query(conn, "SELECT y FROM test", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	view = monetdb_result_fetch_view(result, 0);
+	if (!view || view->type != monetdb_str || view->count != 4)
+		error("Invalid string view")
+	if (strcmp(monetdb_column_view_str(view, 0), "Hello") != 0 ||
+		strcmp(monetdb_column_view_str(view, 1), "World") != 0 ||
+		monetdb_column_view_str(view, 2) != NULL)
+		error("Wrong string view values")
+	if (!view->dict || view->dict_count != 3 || view->codes[0] != view->codes[3] ||
+		strcmp(view->dict[view->codes[1]], "World") != 0 ||
+		strcmp(view->dict[view->codes[2]], (const char*) view->null_value) != 0)
+		error("Wrong string dictionary")
+	monetdb_cleanup_result(conn, result);
+
+	// chunked cursor, every row is handed out exactly once
+	err = monetdb_query(conn, "SELECT x, y FROM test", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	{
+		monetdb_result* chunk = 0;
+		size_t nrows = 0, nchunks = 0;
+		int32_t sum = 0;
+		while ((err = monetdb_result_next_chunk(result, 3, &chunk)) == 0 && chunk) {
+			monetdb_column_int32_t* xcol = (monetdb_column_int32_t*) monetdb_result_fetch(chunk, 0);
+			monetdb_column_str* ycol = (monetdb_column_str*) monetdb_result_fetch(chunk, 1);
+			if (!xcol || !ycol || xcol->count != chunk->nrows || chunk->ncols != 2)
+				error("Invalid chunk")
+			for (r = 0; r < chunk->nrows; r++) {
+				if (!xcol->is_null(xcol->data[r]))
+					sum += xcol->data[r];
+			}
+			nrows += chunk->nrows;
+			nchunks++;
+		}
+		if (err != 0)
+			error(err)
+		if (nrows != 4 || nchunks != 2 || sum != 91)
+			error("Wrong chunked result")
+	}
+	monetdb_cleanup_result(conn, result);
+
+	// Arrow export shares the integer column, import appends into a copy of the table
+	err = monetdb_query(conn, "SELECT x, y, z FROM test", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	{
+		struct ArrowSchema schema;
+		struct ArrowArray array;
+		const int32_t* xs;
+		const unsigned char* validity;
+		const int32_t* offsets;
+		monetdb_result* copy = 0;
+
+		err = monetdb_result_to_arrow(result, &schema, &array);
+		if (err != 0)
+			error(err)
+		if (strcmp(schema.format, "+s") != 0 || schema.n_children != 3 || array.length != 4 ||
+			strcmp(schema.children[0]->format, "i") != 0 || strcmp(schema.children[1]->format, "u") != 0 ||
+			strcmp(schema.children[2]->format, "g") != 0)
+			error("Invalid Arrow schema")
+		xs = array.children[0]->buffers[1];
+		validity = array.children[0]->buffers[0];
+		if (array.children[0]->null_count != 1 || !validity || validity[0] != 0x0D || xs[0] != 42 || xs[2] != 7)
+			error("Wrong Arrow integer column")
+		if (xs != monetdb_result_fetch_view(result, 0)->data)
+			error("Arrow integer column not shared")
+		offsets = array.children[1]->buffers[1];
+		if (array.children[1]->null_count != 1 || offsets[4] != 15 ||
+			memcmp(array.children[1]->buffers[2], "HelloWorldHello", 15) != 0)
+			error("Wrong Arrow string column")
+
+		err = monetdb_query(conn, "CREATE TABLE test_copy (x integer, y string, z double)", 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+		err = monetdb_append_arrow(conn, "sys", "test_copy", &schema, &array);
+		if (err != 0)
+			error(err)
+		// a slice of the batch appends only the rows of the slice
+		err = monetdb_query(conn, "CREATE TABLE test_slice (x integer, y string, z double)", 1, NULL, NULL, NULL);
+		if (err != 0)
+			error(err)
+		array.offset = 1;
+		array.length = 2;
+		err = monetdb_append_arrow(conn, "sys", "test_slice", &schema, &array);
+		if (err != 0)
+			error(err)
+		schema.release(&schema);
+		array.release(&array);
+		monetdb_cleanup_result(conn, result);
+
+		err = monetdb_query(conn, "SELECT COUNT(*), COUNT(x), SUM(x), COUNT(y), SUM(z) FROM test_copy WHERE y = 'Hello' OR y IS NULL", 1, &copy, NULL, NULL);
+		if (err != 0)
+			error(err)
+		if (((monetdb_column_int64_t*) monetdb_result_fetch(copy, 0))->data[0] != 3 ||
+			((monetdb_column_int64_t*) monetdb_result_fetch(copy, 1))->data[0] != 3 ||
+			((monetdb_column_int64_t*) monetdb_result_fetch(copy, 2))->data[0] != 91 ||
+			((monetdb_column_int64_t*) monetdb_result_fetch(copy, 3))->data[0] != 2 ||
+			((monetdb_column_double*) monetdb_result_fetch(copy, 4))->data[0] != 4.75)
+			error("Wrong Arrow round-trip")
+		monetdb_cleanup_result(conn, copy);
+		err = monetdb_query(conn, "SELECT COUNT(*), COUNT(x), SUM(x), MIN(y), SUM(z) FROM test_slice", 1, &copy, NULL, NULL);
+		if (err != 0)
+			error(err)
+		if (((monetdb_column_int64_t*) monetdb_result_fetch(copy, 0))->data[0] != 2 ||
+			((monetdb_column_int64_t*) monetdb_result_fetch(copy, 1))->data[0] != 1 ||
+			((monetdb_column_int64_t*) monetdb_result_fetch(copy, 2))->data[0] != 7 ||
+			strcmp(((monetdb_column_str*) monetdb_result_fetch(copy, 3))->data[0], "World") != 0 ||
+			((monetdb_column_double*) monetdb_result_fetch(copy, 4))->data[0] != 3.25)
+			error("Wrong Arrow slice")
+		monetdb_cleanup_result(conn, copy);
+	}
+
+	// nil dates and timestamps are Arrow nulls with a value of 0
+	err = monetdb_query(conn, "SELECT CAST(NULL AS DATE), CAST(NULL AS TIMESTAMP) UNION ALL SELECT DATE '1970-01-02', TIMESTAMP '1970-01-01 00:00:01'", 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	{
+		struct ArrowSchema schema;
+		struct ArrowArray array;
+		const int32_t* days;
+		const int64_t* msecs;
+
+		err = monetdb_result_to_arrow(result, &schema, &array);
+		if (err != 0)
+			error(err)
+		days = array.children[0]->buffers[1];
+		msecs = array.children[1]->buffers[1];
+		if (array.length != 2 || array.children[0]->null_count != 1 || array.children[1]->null_count != 1 ||
+			days[0] != 0 || days[1] != 1 || msecs[0] != 0 || msecs[1] != 1000)
+			error("Wrong Arrow date and timestamp columns")
+		schema.release(&schema);
+		array.release(&array);
+		monetdb_cleanup_result(conn, result);
+	}
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
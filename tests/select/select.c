@@ -0,0 +1,143 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 50
+#define NROWS (BATCH * NBATCHES)
+#define NVALUES 1000
+#define NULLEVERY 97
+#define DEFAULT_RUNS 5
+
+static double now_ms(void) {
+#ifdef _WIN32
+	return (double) GetTickCount64();
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#endif
+}
+
+static int value(int64_t row) {
+	return (int) (row * 7919 % NVALUES);
+}
+
+static int load(void* conn) {
+	monetdb_column_int32_t icol;
+	monetdb_column_int64_t lcol;
+	monetdb_column_float fcol;
+	monetdb_column_double dcol;
+	monetdb_column* input[4];
+	char* err;
+	int i, k;
+
+	err = monetdb_query(conn, "CREATE TABLE test (i integer, l bigint, f real, d double)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	icol.type = monetdb_int32_t;
+	lcol.type = monetdb_int64_t;
+	fcol.type = monetdb_float;
+	dcol.type = monetdb_double;
+	icol.count = lcol.count = fcol.count = dcol.count = BATCH;
+	icol.null_value = -1;
+	lcol.null_value = -1;
+	fcol.null_value = -1;
+	dcol.null_value = -1;
+	icol.data = malloc(BATCH * sizeof(int32_t));
+	lcol.data = malloc(BATCH * sizeof(int64_t));
+	fcol.data = malloc(BATCH * sizeof(float));
+	dcol.data = malloc(BATCH * sizeof(double));
+	if (!icol.data || !lcol.data || !fcol.data || !dcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &icol;
+	input[1] = (monetdb_column*) &lcol;
+	input[2] = (monetdb_column*) &fcol;
+	input[3] = (monetdb_column*) &dcol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			int64_t row = (int64_t) k * BATCH + i;
+			int v = row % NULLEVERY == 0 ? -1 : value(row);
+			icol.data[i] = v;
+			lcol.data[i] = v;
+			fcol.data[i] = (float) v;
+			dcol.data[i] = v;
+		}
+		err = monetdb_append_columns(conn, "sys", "test", input, 4);
+		if (err != 0)
+			error(err)
+	}
+	free(icol.data);
+	free(lcol.data);
+	free(fcol.data);
+	free(dcol.data);
+	return 0;
+}
+
+// counts the rows with a value below the given bound in a column of each
+// type, for a range of selectivities. the whole column is selected from at
+// once, with a vectorized kernel if the processor has one.
+int main(int argc, char** argv) {
+	const char* columns[] = {"i", "l", "f", "d"};
+	const char* types[] = {"int", "bigint", "real", "double"};
+	const int percents[] = {1, 10, 50, 90, 100};
+	int runs = argc > 1 ? atoi(argv[1]) : DEFAULT_RUNS;
+	char* err;
+	void* conn;
+	int c, s, i;
+
+	if (runs <= 0)
+		error("Number of runs must be positive")
+	// sequential plans, so the tables are not split up
+	err = monetdb_startup(NULL, 1, 1);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	if (load(conn))
+		return -1;
+
+	printf("rows: %d\n", NROWS);
+	for (c = 0; c < 4; c++) {
+		for (s = 0; s < 5; s++) {
+			int bound = NVALUES * percents[s] / 100;
+			int64_t expected = 0, row;
+			double t, total = 0;
+			char query[200];
+
+			for (row = 0; row < NROWS; row++)
+				expected += row % NULLEVERY != 0 && value(row) < bound;
+			snprintf(query, sizeof(query), "SELECT COUNT(*) FROM test WHERE %s BETWEEN 0 AND %d", columns[c], bound - 1);
+			for (i = 0; i < runs; i++) {
+				monetdb_result* result = 0;
+				monetdb_column_int64_t* col;
+				t = now_ms();
+				err = monetdb_query(conn, query, 1, &result, NULL, NULL);
+				if (err != 0)
+					error(err)
+				total += now_ms() - t;
+				col = (monetdb_column_int64_t*) monetdb_result_fetch(result, 0);
+				if (!col || col->type != monetdb_int64_t || col->count != 1)
+					error("Wrong result type")
+				if (col->data[0] != expected) {
+					fprintf(stderr, "%s: %lld, expected %lld\n", query, (long long) col->data[0], (long long) expected);
+					error("Wrong select result")
+				}
+				monetdb_cleanup_result(conn, result);
+			}
+			printf("%s, %d%% selected: %.2f ms average\n", types[c], percents[s], total / runs);
+		}
+	}
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,107 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 3
+
+// runs a query that returns a count and a sum, and compares it to the result
+// of an equivalent query that does not use a set operation. the set
+// operations are split up with the table they read, equal rows in different
+// pieces have to end up in the same group.
+static int check(void* conn, const char* query, const char* reference) {
+	const char* queries[2] = {query, reference};
+	int64_t res[2][2];
+	int i, j;
+
+	for (i = 0; i < 2; i++) {
+		monetdb_result* result = 0;
+		char* err = monetdb_query(conn, (char*) queries[i], 1, &result, NULL, NULL);
+		if (err != 0)
+			error(err)
+		if (result->ncols != 2 || result->nrows != 1)
+			error("Wrong result shape")
+		for (j = 0; j < 2; j++) {
+			monetdb_column_int64_t* col = (monetdb_column_int64_t*) monetdb_result_fetch(result, j);
+			if (!col || col->type != monetdb_int64_t)
+				error("Wrong result type")
+			res[i][j] = col->data[0];
+		}
+		monetdb_cleanup_result(conn, result);
+	}
+	if (res[0][0] != res[1][0] || res[0][1] != res[1][1]) {
+		fprintf(stderr, "%s: %lld %lld, expected %lld %lld\n", query,
+			(long long) res[0][0], (long long) res[0][1], (long long) res[1][0], (long long) res[1][1]);
+		error("Wrong set operation result")
+	}
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int32_t xcol, ycol;
+	monetdb_column* input[2];
+	int i, k;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, y integer)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	xcol.type = ycol.type = monetdb_int32_t;
+	xcol.count = ycol.count = BATCH;
+	xcol.null_value = ycol.null_value = -1;
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	ycol.data = malloc(BATCH * sizeof(int32_t));
+	if (!xcol.data || !ycol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &xcol;
+	input[1] = (monetdb_column*) &ycol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			xcol.data[i] = k * BATCH + i;
+			ycol.data[i] = (k * BATCH + i) / 7 % 3;
+		}
+		err = monetdb_append_columns(conn, "sys", "test", input, 2);
+		if (err != 0)
+			error(err)
+	}
+
+	if (check(conn,
+		"SELECT COUNT(*), SUM(a) FROM (SELECT x % 1000 AS a FROM test WHERE x >= 0 EXCEPT SELECT x % 997 FROM test WHERE x > 5) s",
+		"SELECT COUNT(*), SUM(a) FROM (SELECT DISTINCT x % 1000 AS a FROM test WHERE x % 1000 NOT IN (SELECT x % 997 FROM test WHERE x > 5)) s"))
+		return -1;
+	if (check(conn,
+		"SELECT COUNT(*), SUM(a) FROM (SELECT x % 1000 AS a FROM test WHERE x >= 0 INTERSECT SELECT x % 997 FROM test WHERE x > 5) s",
+		"SELECT COUNT(*), SUM(a) FROM (SELECT DISTINCT x % 1000 AS a FROM test WHERE x % 1000 IN (SELECT x % 997 FROM test WHERE x > 5)) s"))
+		return -1;
+	if (check(conn,
+		"SELECT COUNT(*), SUM(a * 3 + b) FROM (SELECT x % 1000 AS a, y AS b FROM test WHERE x >= 0 EXCEPT SELECT x % 997, y FROM test WHERE x > 150000) s",
+		"SELECT COUNT(*), SUM(a * 3 + b) FROM (SELECT DISTINCT x % 1000 AS a, y AS b FROM test WHERE (x % 1000) * 3 + y NOT IN (SELECT (x % 997) * 3 + y FROM test WHERE x > 150000)) s"))
+		return -1;
+	// with duplicates, every value occurs 300 times on the left and about 301 times on the right
+	if (check(conn,
+		"SELECT COUNT(*), SUM(a) FROM (SELECT x % 1000 AS a FROM test WHERE x >= 0 EXCEPT ALL SELECT x % 997 FROM test WHERE x > 5) s",
+		"SELECT CAST(300 * COUNT(*) AS BIGINT), CAST(300 * SUM(a) AS BIGINT) FROM (SELECT DISTINCT x % 1000 AS a FROM test WHERE x % 1000 >= 997) s"))
+		return -1;
+	if (check(conn,
+		"SELECT COUNT(*), SUM(a) FROM (SELECT x % 1000 AS a FROM test WHERE x >= 0 INTERSECT ALL SELECT x % 997 FROM test WHERE x > 5) s",
+		"SELECT CAST(300 * COUNT(*) AS BIGINT), CAST(300 * SUM(a) AS BIGINT) FROM (SELECT DISTINCT x % 1000 AS a FROM test WHERE x % 1000 < 997) s"))
+		return -1;
+
+	free(xcol.data);
+	free(ycol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
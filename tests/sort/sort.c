@@ -0,0 +1,236 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 12
+#define NROWS (BATCH * NBATCHES)
+
+// the value of each sort key for row x, 1 if it is NULL
+static int int_key(int x, int32_t* v) {
+	*v = (int32_t) ((int64_t) x * 7919 % 1000) - 500;
+	return x % 101 == 0;
+}
+
+static int lng_key(int x, int64_t* v) {
+	*v = ((int64_t) x * 2654435761 % 1000003 - 500000) * 1000000007;
+	return x % 103 == 0;
+}
+
+static int dbl_key(int x, double* v) {
+	*v = (x * 37 % 20001 - 10000) / 8.0;
+	return x % 89 == 0;
+}
+
+static int flt_key(int x, float* v) {
+	// zeroes of both signs, which compare equal
+	*v = x % 3 == 0 ? -0.0f : x % 3 == 1 ? 0.0f : (float) (x % 1000 - 500) + 0.5f;
+	return 0;
+}
+
+static int str_key(int x, char* v) {
+	sprintf(v, "s%d", x * 31 % 500009);
+	return x % 97 == 0;
+}
+
+// compares the keys of two rows, NULL being the smallest value
+#define compare(a, anull, b, bnull) ((anull) || (bnull) ? (bnull) - (anull) : (a) < (b) ? -1 : (a) > (b))
+
+// runs an ORDER BY query that returns a key and the row number x, and checks
+// that every row is there once with its own key, in the right order: by key
+// (descending if desc), then by x.
+static int check(void* conn, const char* query, int desc) {
+	monetdb_result* result = 0;
+	monetdb_column* keys;
+	monetdb_column_int32_t* xs;
+	int64_t sum = 0, sumsq = 0, expsum = 0, expsumsq = 0;
+	size_t i;
+	int c = 0, prevc = 0;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (result->ncols != 2 || result->nrows != NROWS)
+		error("Wrong result shape")
+	keys = (monetdb_column*) monetdb_result_fetch(result, 0);
+	xs = (monetdb_column_int32_t*) monetdb_result_fetch(result, 1);
+	if (!keys || !xs || xs->type != monetdb_int32_t)
+		error("Wrong result type")
+	for (i = 0; i < NROWS; i++) {
+		int x = xs->data[i], n, pn = 0;
+		if (x < 0 || x >= NROWS)
+			error("Wrong row number")
+		sum += x;
+		sumsq += (int64_t) x * x;
+		expsum += (int64_t) i;
+		expsumsq += (int64_t) i * i;
+		switch (keys->type) {
+		case monetdb_int32_t: {
+			monetdb_column_int32_t* k = (monetdb_column_int32_t*) keys;
+			int32_t v;
+			n = int_key(x, &v);
+			if (n != k->is_null(k->data[i]) || (!n && v != k->data[i]))
+				error("Wrong key")
+			if (i > 0) {
+				pn = k->is_null(k->data[i - 1]);
+				c = compare(k->data[i - 1], pn, k->data[i], n);
+			}
+			break;
+		}
+		case monetdb_int64_t: {
+			monetdb_column_int64_t* k = (monetdb_column_int64_t*) keys;
+			int64_t v;
+			n = lng_key(x, &v);
+			if (n != k->is_null(k->data[i]) || (!n && v != k->data[i]))
+				error("Wrong key")
+			if (i > 0) {
+				pn = k->is_null(k->data[i - 1]);
+				c = compare(k->data[i - 1], pn, k->data[i], n);
+			}
+			break;
+		}
+		case monetdb_double: {
+			monetdb_column_double* k = (monetdb_column_double*) keys;
+			double v;
+			n = dbl_key(x, &v);
+			if (n != k->is_null(k->data[i]) || (!n && v != k->data[i]))
+				error("Wrong key")
+			if (i > 0) {
+				pn = k->is_null(k->data[i - 1]);
+				c = compare(k->data[i - 1], pn, k->data[i], n);
+			}
+			break;
+		}
+		case monetdb_float: {
+			monetdb_column_float* k = (monetdb_column_float*) keys;
+			float v;
+			n = flt_key(x, &v);
+			if (n != k->is_null(k->data[i]) || (!n && memcmp(&v, &k->data[i], sizeof(v)) != 0))
+				error("Wrong key")
+			if (i > 0) {
+				pn = k->is_null(k->data[i - 1]);
+				c = compare(k->data[i - 1], pn, k->data[i], n);
+			}
+			break;
+		}
+		case monetdb_str: {
+			monetdb_column_str* k = (monetdb_column_str*) keys;
+			char v[20];
+			n = str_key(x, v);
+			if (n != k->is_null(k->data[i]) || (!n && strcmp(v, k->data[i]) != 0))
+				error("Wrong key")
+			if (i > 0) {
+				pn = k->is_null(k->data[i - 1]);
+				c = pn || n ? n - pn : strcmp(k->data[i - 1], k->data[i]);
+				c = c < 0 ? -1 : c > 0;
+			}
+			break;
+		}
+		default:
+			error("Wrong result type")
+		}
+		if (i > 0) {
+			if (desc)
+				c = -c;
+			if (c > 0 || (c == 0 && prevc >= x)) {
+				fprintf(stderr, "%s: row %zu out of order\n", query, i);
+				error("Wrong sort order")
+			}
+		}
+		prevc = x;
+	}
+	if (sum != expsum || sumsq != expsumsq)
+		error("Rows lost or duplicated")
+	monetdb_cleanup_result(conn, result);
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int32_t xcol, icol;
+	monetdb_column_int64_t lcol;
+	monetdb_column_double dcol;
+	monetdb_column_float fcol;
+	monetdb_column* input[5];
+	int i, k;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE test (x integer, i integer, l bigint, d double, f real)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	xcol.type = icol.type = monetdb_int32_t;
+	lcol.type = monetdb_int64_t;
+	dcol.type = monetdb_double;
+	fcol.type = monetdb_float;
+	xcol.count = icol.count = lcol.count = dcol.count = fcol.count = BATCH;
+	xcol.null_value = icol.null_value = INT32_MIN;
+	lcol.null_value = INT64_MIN;
+	dcol.null_value = 1e300;
+	fcol.null_value = 1e30f;
+	xcol.data = malloc(BATCH * sizeof(int32_t));
+	icol.data = malloc(BATCH * sizeof(int32_t));
+	lcol.data = malloc(BATCH * sizeof(int64_t));
+	dcol.data = malloc(BATCH * sizeof(double));
+	fcol.data = malloc(BATCH * sizeof(float));
+	if (!xcol.data || !icol.data || !lcol.data || !dcol.data || !fcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &xcol;
+	input[1] = (monetdb_column*) &icol;
+	input[2] = (monetdb_column*) &lcol;
+	input[3] = (monetdb_column*) &dcol;
+	input[4] = (monetdb_column*) &fcol;
+	for (k = 0; k < NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			int x = k * BATCH + i;
+			xcol.data[i] = x;
+			if (int_key(x, &icol.data[i]))
+				icol.data[i] = icol.null_value;
+			if (lng_key(x, &lcol.data[i]))
+				lcol.data[i] = lcol.null_value;
+			if (dbl_key(x, &dcol.data[i]))
+				dcol.data[i] = dcol.null_value;
+			flt_key(x, &fcol.data[i]);
+		}
+		err = monetdb_append_columns(conn, "sys", "test", input, 5);
+		if (err != 0)
+			error(err)
+	}
+
+	if (check(conn, "SELECT i, x FROM test ORDER BY i, x", 0))
+		return -1;
+	if (check(conn, "SELECT i, x FROM test ORDER BY i DESC, x", 1))
+		return -1;
+	if (check(conn, "SELECT l, x FROM test ORDER BY l, x", 0))
+		return -1;
+	if (check(conn, "SELECT l, x FROM test ORDER BY l DESC, x", 1))
+		return -1;
+	if (check(conn, "SELECT d, x FROM test ORDER BY d, x", 0))
+		return -1;
+	if (check(conn, "SELECT d, x FROM test ORDER BY d DESC, x", 1))
+		return -1;
+	if (check(conn, "SELECT f, x FROM test ORDER BY f, x", 0))
+		return -1;
+	if (check(conn, "SELECT s, x FROM (SELECT CASE WHEN x % 97 = 0 THEN NULL ELSE 's' || CAST(x * 31 % 500009 AS VARCHAR(10)) END AS s, x FROM test) t ORDER BY s, x", 0))
+		return -1;
+	if (check(conn, "SELECT s, x FROM (SELECT CASE WHEN x % 97 = 0 THEN NULL ELSE 's' || CAST(x * 31 % 500009 AS VARCHAR(10)) END AS s, x FROM test) t ORDER BY s DESC, x", 1))
+		return -1;
+
+	free(xcol.data);
+	free(icol.data);
+	free(lcol.data);
+	free(dcol.data);
+	free(fcol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,67 @@
+#include "embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define DEFAULT_RUNS 10
+
+static double now_ms(void) {
+#ifdef _WIN32
+	return (double) GetTickCount64();
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#endif
+}
+
+// measures the latency of bringing up an in-memory database, running a first query and shutting it down again
+int main(int argc, char** argv) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_result* result = 0;
+	int runs = argc > 1 ? atoi(argv[1]) : DEFAULT_RUNS;
+	double first = 0, startup = 0, query = 0, shutdown = 0, t;
+	int i;
+
+	if (runs <= 0)
+		error("Number of runs must be positive")
+	for (i = 0; i < runs; i++) {
+		t = now_ms();
+		err = monetdb_startup(NULL, 1, 0);
+		if (err != 0)
+			error(err)
+		conn = monetdb_connect();
+		if (conn == NULL)
+			error("Connection failed")
+		t = now_ms() - t;
+		if (i == 0)
+			first = t;
+		startup += t;
+
+		t = now_ms();
+		err = monetdb_query(conn, "SELECT COUNT(*) FROM functions", 1, &result, NULL, NULL);
+		if (err != 0)
+			error(err)
+		monetdb_cleanup_result(conn, result);
+		query += now_ms() - t;
+
+		t = now_ms();
+		monetdb_disconnect(conn);
+		monetdb_shutdown();
+		shutdown += now_ms() - t;
+	}
+	printf("runs: %d\n", runs);
+	printf("first startup: %.1f ms\n", first);
+	printf("startup: %.1f ms\n", startup / runs);
+	printf("first query: %.1f ms\n", query / runs);
+	printf("shutdown: %.1f ms\n", shutdown / runs);
+	return 0;
+}
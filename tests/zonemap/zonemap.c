@@ -0,0 +1,242 @@
+#include "embedded.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define error(msg) {fprintf(stderr, "Failure: %s\n", msg); return -1;}
+
+#define BATCH 100000
+#define NBATCHES 10
+#define NROWS (BATCH * (NBATCHES + 1))
+#define NULLEVERY 10007
+
+// time-ordered, but not sorted: every row is about 10 later than the one
+// before it, give or take 6
+static int64_t timestamps[NROWS];
+static int nrows;
+
+static int64_t event_time(int row) {
+	if (row % NULLEVERY == NULLEVERY - 1)
+		return INT64_MIN;
+	return (int64_t) row * 10 + (int64_t) row * 7919 % 13 - 6;
+}
+
+static int64_t expected_count(int64_t lo, int64_t hi) {
+	int64_t cnt = 0;
+	int i;
+	for (i = 0; i < nrows; i++)
+		cnt += timestamps[i] != INT64_MIN && timestamps[i] >= lo && timestamps[i] <= hi;
+	return cnt;
+}
+
+static int64_t single(void* conn, const char* query) {
+	monetdb_result* result = 0;
+	monetdb_column_int64_t* col;
+	int64_t res;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0) {
+		fprintf(stderr, "Failure: %s\n", err);
+		return -1;
+	}
+	col = (monetdb_column_int64_t*) monetdb_result_fetch(result, 0);
+	if (result->nrows != 1 || !col || col->type != monetdb_int64_t) {
+		fprintf(stderr, "Failure: Wrong result\n");
+		return -1;
+	}
+	res = col->data[0];
+	monetdb_cleanup_result(conn, result);
+	return res;
+}
+
+// whether the plan of a query mentions a table, -1 on failure
+static int plan_uses(void* conn, const char* query, const char* table) {
+	monetdb_result* result = 0;
+	monetdb_column_str* col;
+	size_t i;
+	int found = 0;
+	char* err = monetdb_query(conn, (char*) query, 1, &result, NULL, NULL);
+	if (err != 0) {
+		fprintf(stderr, "Failure: %s\n", err);
+		return -1;
+	}
+	col = (monetdb_column_str*) monetdb_result_fetch(result, 0);
+	if (!col || col->type != monetdb_str) {
+		fprintf(stderr, "Failure: Wrong plan\n");
+		return -1;
+	}
+	for (i = 0; i < result->nrows; i++)
+		found |= strstr(col->data[i], table) != NULL;
+	monetdb_cleanup_result(conn, result);
+	return found;
+}
+
+// runs count queries over the range [lo, hi] of ts, plain and split up
+static int check(void* conn, int64_t lo, int64_t hi) {
+	static const char* queries[] = {
+		"SELECT COUNT(*) FROM events WHERE ts BETWEEN %lld AND %lld",
+		"SELECT COUNT(*) FROM events WHERE ts >= %lld AND ts <= %lld AND v >= 0",
+		"SELECT COUNT(*) FROM events WHERE ts > %lld - 1 AND ts < %lld + 1",
+		"SELECT COUNT(*) FROM events WHERE CAST(ts AS DOUBLE) BETWEEN %lld AND %lld",
+		"SELECT COUNT(*) FROM events WHERE d BETWEEN %lld / 10.0 AND %lld / 10.0 AND v >= 0",
+	};
+	char query[200];
+	size_t i;
+	int64_t expected = expected_count(lo, hi);
+	for (i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) {
+		int64_t res;
+		snprintf(query, sizeof(query), queries[i], (long long) lo, (long long) hi);
+		res = single(conn, query);
+		if (res != expected) {
+			fprintf(stderr, "%s: %lld, expected %lld\n", query, (long long) res, (long long) expected);
+			error("Wrong count")
+		}
+	}
+	return 0;
+}
+
+static int check_all(void* conn) {
+	int64_t last = (int64_t) nrows * 10;
+	// nothing, a few rows, a block or two, a large part and all of it
+	if (check(conn, -1000, -100) || check(conn, last + 100, last + 1000) ||
+		check(conn, 12345, 12400) || check(conn, 500000, 530000) ||
+		check(conn, last / 4, last / 2) || check(conn, -100, last + 100) ||
+		check(conn, last - 50, last + 100))
+		return -1;
+	if (single(conn, "SELECT COUNT(*) FROM events WHERE ts = 123450") != expected_count(123450, 123450))
+		error("Wrong point select")
+	if (single(conn, "SELECT COUNT(*) FROM events WHERE ts IS NULL") != (nrows + 1) / NULLEVERY)
+		error("Wrong count of NULLs")
+	if (single(conn, "SELECT MIN(ts) FROM events") != -6)
+		error("Wrong minimum")
+	return 0;
+}
+
+int main(void) {
+	char* err = 0;
+	void* conn = 0;
+	monetdb_column_int64_t tscol;
+	monetdb_column_int32_t vcol;
+	monetdb_column_double dcol;
+	monetdb_column* input[3];
+	int i, k;
+
+	err = monetdb_startup(NULL, 1, 0);
+	if (err != 0)
+		error(err)
+	conn = monetdb_connect();
+	if (conn == NULL)
+		error("Connection failed")
+	err = monetdb_query(conn, "CREATE TABLE events (ts bigint, v integer, d double)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+
+	tscol.type = monetdb_int64_t;
+	vcol.type = monetdb_int32_t;
+	dcol.type = monetdb_double;
+	tscol.count = vcol.count = dcol.count = BATCH;
+	tscol.null_value = INT64_MIN;
+	vcol.null_value = INT32_MIN;
+	dcol.null_value = -1;
+	tscol.data = malloc(BATCH * sizeof(int64_t));
+	vcol.data = malloc(BATCH * sizeof(int32_t));
+	dcol.data = malloc(BATCH * sizeof(double));
+	if (!tscol.data || !vcol.data || !dcol.data)
+		error("Malloc fail")
+	input[0] = (monetdb_column*) &tscol;
+	input[1] = (monetdb_column*) &vcol;
+	input[2] = (monetdb_column*) &dcol;
+	for (k = 0; k <= NBATCHES; k++) {
+		for (i = 0; i < BATCH; i++) {
+			int row = k * BATCH + i;
+			timestamps[row] = tscol.data[i] = event_time(row);
+			vcol.data[i] = row % 1000;
+			dcol.data[i] = tscol.data[i] == INT64_MIN ? -1 : tscol.data[i] / 10.0;
+		}
+		err = monetdb_append_columns(conn, "sys", "events", input, 3);
+		if (err != 0)
+			error(err)
+		nrows += BATCH;
+		// the first batches are queried, the ones appended after that
+		// have to be found as well
+		if (k == NBATCHES / 2 || k == NBATCHES) {
+			if (check_all(conn))
+				return -1;
+		}
+	}
+	if (single(conn, "SELECT MAX(ts) FROM events") != event_time(NROWS - 1))
+		error("Wrong maximum")
+
+	// joins with range predicates
+	err = monetdb_query(conn, "CREATE TABLE periods (lo bigint, hi bigint)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO periods VALUES (100, 200), (54321, 55000), (9000000, 9000100), (-50, -10)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (single(conn, "SELECT COUNT(*) FROM events, periods WHERE ts BETWEEN lo AND hi") !=
+		expected_count(100, 200) + expected_count(54321, 55000) + expected_count(9000000, 9000100))
+		error("Wrong range join")
+
+	// updates and deletes replace values anywhere in the column
+	err = monetdb_query(conn, "UPDATE events SET ts = -500 WHERE v = 7 AND ts < 100000", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	for (i = 0; i < nrows; i++)
+		if (i % 1000 == 7 && timestamps[i] != INT64_MIN && timestamps[i] < 100000)
+			timestamps[i] = -500;
+	if (single(conn, "SELECT COUNT(*) FROM events WHERE ts BETWEEN -1000 AND -100") != expected_count(-1000, -100))
+		error("Updated values not found")
+	if (single(conn, "SELECT MIN(ts) FROM events") != -500)
+		error("Wrong minimum after update")
+	err = monetdb_query(conn, "DELETE FROM events WHERE ts BETWEEN 200000 AND 300000", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (single(conn, "SELECT COUNT(*) FROM events WHERE ts BETWEEN 150000 AND 350000") !=
+		expected_count(150000, 350000) - expected_count(200000, 300000))
+		error("Deleted values found")
+
+	// read-only parts of a merge table that cannot hold values in the
+	// range are skipped, also without statistics
+	err = monetdb_query(conn, "CREATE TABLE part1 (ts bigint)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE TABLE part2 (ts bigint)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO part1 SELECT ts FROM events WHERE ts < 500000", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "INSERT INTO part2 SELECT ts FROM events WHERE ts BETWEEN 500000 AND 1000000", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "ALTER TABLE part1 SET READ ONLY", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "ALTER TABLE part2 SET READ ONLY", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "CREATE MERGE TABLE history (ts bigint)", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "ALTER TABLE history ADD TABLE part1", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	err = monetdb_query(conn, "ALTER TABLE history ADD TABLE part2", 1, NULL, NULL, NULL);
+	if (err != 0)
+		error(err)
+	if (plan_uses(conn, "PLAN SELECT COUNT(*) FROM history WHERE ts BETWEEN 600000 AND 700000", "part1") != 0)
+		error("Merge table part not skipped")
+	if (plan_uses(conn, "PLAN SELECT COUNT(*) FROM history WHERE ts BETWEEN 400000 AND 700000", "part1") != 1)
+		error("Merge table part skipped")
+	if (single(conn, "SELECT COUNT(*) FROM history WHERE ts BETWEEN 600000 AND 700000") != expected_count(600000, 700000))
+		error("Wrong count of merge table")
+
+	free(tscol.data);
+	free(vcol.data);
+	free(dcol.data);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}